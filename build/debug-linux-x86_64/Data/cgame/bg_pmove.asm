@@ -0,0 +1,10517 @@
+data
+export pm_stopspeed
+align 4
+LABELV pm_stopspeed
+byte 4 1120403456
+export pm_duckScale
+align 4
+LABELV pm_duckScale
+byte 4 1048576000
+export pm_swimScale
+align 4
+LABELV pm_swimScale
+byte 4 1041865114
+export pm_accelerate
+align 4
+LABELV pm_accelerate
+byte 4 1092616192
+export pm_airaccelerate
+align 4
+LABELV pm_airaccelerate
+byte 4 1065353216
+export pm_wateraccelerate
+align 4
+LABELV pm_wateraccelerate
+byte 4 1082130432
+export pm_flyaccelerate
+align 4
+LABELV pm_flyaccelerate
+byte 4 1090519040
+export pm_friction
+align 4
+LABELV pm_friction
+byte 4 1086324736
+export pm_waterfriction
+align 4
+LABELV pm_waterfriction
+byte 4 1065353216
+export pm_spectatorfriction
+align 4
+LABELV pm_spectatorfriction
+byte 4 1084227584
+export c_pmove
+align 4
+LABELV c_pmove
+byte 4 0
+export PM_AddEvent
+code
+proc PM_AddEvent 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $51
+endproc PM_AddEvent 0 12
+export PM_AddTouchEnt
+proc PM_AddTouchEnt 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1022
+NEI4 $53
+ADDRGP4 $52
+JUMPV
+LABELV $53
+ADDRGP4 pm
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $55
+ADDRGP4 $52
+JUMPV
+LABELV $55
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $60
+JUMPV
+LABELV $57
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $61
+ADDRGP4 $52
+JUMPV
+LABELV $61
+LABELV $58
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $60
+ADDRLP4 0
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LTI4 $57
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $52
+endproc PM_AddTouchEnt 12 0
+proc PM_StartTorsoAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $64
+ADDRGP4 $63
+JUMPV
+LABELV $64
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $63
+endproc PM_StartTorsoAnim 8 0
+proc PM_StartLegsAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $67
+ADDRGP4 $66
+JUMPV
+LABELV $67
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $69
+ADDRGP4 $66
+JUMPV
+LABELV $69
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $66
+endproc PM_StartLegsAnim 8 0
+proc PM_ContinueLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $72
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $74
+ADDRGP4 $71
+JUMPV
+LABELV $74
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $71
+endproc PM_ContinueLegsAnim 0 4
+proc PM_ContinueTorsoAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $77
+ADDRGP4 $76
+JUMPV
+LABELV $77
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $79
+ADDRGP4 $76
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $76
+endproc PM_ContinueTorsoAnim 0 4
+proc PM_ForceLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $81
+endproc PM_ForceLegsAnim 0 4
+export PM_ClipVelocity
+proc PM_ClipVelocity 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $83
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $84
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $85
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $86
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $85
+LABELV $82
+endproc PM_ClipVelocity 32 0
+proc PM_Friction 48 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+LABELV $90
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $94
+ADDRLP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $89
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $89
+JUMPV
+LABELV $94
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+GTI4 $98
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $100
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 36
+INDIRI4
+NEI4 $100
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $105
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $108
+ADDRLP4 40
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $109
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $105
+LABELV $100
+LABELV $98
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_waterfriction
+INDIRF4
+MULF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $111
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $114
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_spectatorfriction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $114
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $117
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+LABELV $117
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $89
+endproc PM_Friction 48 4
+proc PM_Accelerate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $120
+ADDRGP4 $119
+JUMPV
+LABELV $120
+ADDRLP4 4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $123
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $123
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $125
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $125
+LABELV $119
+endproc PM_Accelerate 32 0
+proc PM_CmdScale 64 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $130
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $130
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $132
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $134
+CNSTF4 0
+RETF4
+ADDRGP4 $129
+JUMPV
+LABELV $134
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1123942400
+ADDRLP4 8
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $136
+ADDRLP4 4
+INDIRF4
+RETF4
+ADDRGP4 $129
+JUMPV
+LABELV $136
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $138
+ADDRLP4 4
+INDIRF4
+RETF4
+ADDRGP4 $129
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $140
+ADDRLP4 4
+CNSTF4 1061158912
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $142
+ADDRLP4 4
+CNSTF4 1063675494
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $142
+LABELV $141
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $144
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $149
+ADDRLP4 48
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LTI4 $145
+LABELV $151
+ADDRLP4 48
+INDIRI4
+CNSTI4 11
+EQI4 $150
+ADDRLP4 48
+INDIRI4
+CNSTI4 13
+EQI4 $150
+ADDRGP4 $145
+JUMPV
+LABELV $149
+ADDRLP4 4
+CNSTF4 1066611507
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $150
+ADDRLP4 4
+CNSTF4 1063675494
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 4
+CNSTF4 1061158912
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $145
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $129
+endproc PM_CmdScale 64 4
+proc PM_SetMovementDir 72 0
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $155
+ADDRLP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+EQI4 $153
+LABELV $155
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+NEI4 $156
+ADDRLP4 8
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+LEI4 $156
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $156
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+GEI4 $158
+ADDRLP4 16
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+LEI4 $158
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $158
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+GEI4 $160
+ADDRLP4 24
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $160
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $160
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $162
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $162
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $162
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $164
+ADDRLP4 40
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+GEI4 $164
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $164
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+LEI4 $166
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+GEI4 $166
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $166
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+LEI4 $168
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+NEI4 $168
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $168
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $154
+ADDRLP4 64
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $154
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $172
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $174
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $174
+LABELV $173
+LABELV $154
+LABELV $152
+endproc PM_SetMovementDir 72 0
+proc PM_CheckJump 8 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $177
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $177
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $179
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $179
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $181
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $181
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+CNSTI4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $185
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTF4 1069547520
+ADDRLP4 4
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $185
+CNSTI4 31
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $188
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $189
+CNSTI4 1
+RETI4
+LABELV $176
+endproc PM_CheckJump 8 4
+proc PM_CheckWaterJump 56 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $191
+CNSTI4 0
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $191
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $193
+CNSTI4 0
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $193
+ADDRLP4 12
+ADDRGP4 pml
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 pml+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $203
+CNSTI4 0
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $203
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 33619969
+BANDI4
+CNSTI4 0
+EQI4 $206
+CNSTI4 0
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $206
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2000
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $190
+endproc PM_CheckWaterJump 56 8
+proc PM_WaterJumpMove 12 4
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $212
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -113
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $212
+LABELV $210
+endproc PM_WaterJumpMove 12 4
+proc PM_WaterMove 80 16
+ADDRLP4 40
+ADDRGP4 PM_CheckWaterJump
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $215
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $214
+JUMPV
+LABELV $215
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $217
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+LTI4 $219
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 3281387520
+LEF4 $221
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $223
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1112014848
+ASGNF4
+LABELV $224
+LABELV $221
+LABELV $219
+LABELV $217
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $225
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $228
+ADDRLP4 8+8
+CNSTF4 3240099840
+ASGNF4
+ADDRGP4 $226
+JUMPV
+LABELV $228
+ADDRLP4 8+8
+CNSTF4 3262119936
+ASGNF4
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $232
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $233
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $232
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $226
+ADDRLP4 24
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+LEF4 $238
+ADDRLP4 20
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $238
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $240
+ADDRLP4 20
+CNSTF4 1056964608
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $240
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $242
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1065353216
+LEF4 $255
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $255
+LABELV $242
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_SlideMove
+CALLI4
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 pm_wateraccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+LABELV $214
+endproc PM_WaterMove 80 16
+proc PM_FlyMove 52 12
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $258
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $262
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $262
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $259
+ADDRLP4 20
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 pm_flyaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $257
+endproc PM_FlyMove 52 12
+proc PM_AirMove 84 16
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 68
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 44
+ARGP4
+ADDRLP4 72
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $273
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $274
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $273
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $279
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+LABELV $268
+endproc PM_AirMove 84 16
+proc PM_WalkMove 128 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+LEI4 $285
+ADDRGP4 pml
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRGP4 pml+4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 pml+8
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $285
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $284
+JUMPV
+LABELV $285
+ADDRLP4 76
+ADDRGP4 PM_CheckJump
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $299
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $284
+JUMPV
+LABELV $299
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $284
+JUMPV
+LABELV $297
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 80
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 48
+ARGP4
+ADDRLP4 84
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+ADDRGP4 pml
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $311
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $312
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $311
+ADDRLP4 28
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $316
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+LEF4 $318
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $318
+LABELV $316
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $320
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 100
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRGP4 pm_swimScale
+INDIRF4
+SUBF4
+ADDRLP4 96
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+LEF4 $322
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+LABELV $322
+LABELV $320
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 96
+INDIRI4
+NEI4 $328
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 96
+INDIRI4
+EQI4 $324
+LABELV $328
+ADDRLP4 72
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ASGNF4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 72
+ADDRGP4 pm_accelerate
+INDIRF4
+ASGNF4
+LABELV $325
+ADDRLP4 28
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 100
+INDIRI4
+NEI4 $333
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $329
+LABELV $333
+ADDRLP4 104
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $329
+LABELV $330
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1065353216
+LEF4 $337
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 116
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+LABELV $337
+ADDRLP4 116
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+NEF4 $339
+ADDRLP4 116
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+NEF4 $339
+ADDRGP4 $284
+JUMPV
+LABELV $339
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $284
+endproc PM_WalkMove 128 16
+proc PM_DeadMove 20 4
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 $341
+JUMPV
+LABELV $342
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $345
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $346
+LABELV $341
+endproc PM_DeadMove 20 4
+proc PM_NoclipMove 104 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 40
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+GEF4 $348
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+CNSTF4 1069547520
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $351
+ADDRLP4 68
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 68
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $352
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $354
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $354
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $349
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 72
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $356
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $356
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRGP4 pm_accelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $347
+endproc PM_NoclipMove 104 12
+proc PM_FootstepForSurface 740 0
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $366
+CNSTI4 0
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $366
+ADDRLP4 0
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 267386880
+BANDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 97517568
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $419
+LABELV $418
+ADDRLP4 16
+CNSTI4 42991616
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $385
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $421
+LABELV $420
+ADDRLP4 24
+CNSTI4 22020096
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $381
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $423
+LABELV $422
+ADDRLP4 32
+CNSTI4 11534336
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $425
+LABELV $424
+ADDRLP4 40
+CNSTI4 6291456
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $379
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $427
+LABELV $426
+ADDRLP4 48
+CNSTI4 4194304
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $379
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $429
+LABELV $428
+ADDRLP4 0
+INDIRI4
+CNSTI4 3145728
+EQI4 $379
+ADDRGP4 $370
+JUMPV
+LABELV $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 5242880
+EQI4 $379
+ADDRGP4 $370
+JUMPV
+LABELV $427
+ADDRLP4 56
+CNSTI4 8388608
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $431
+LABELV $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 7340032
+EQI4 $380
+ADDRGP4 $370
+JUMPV
+LABELV $431
+ADDRLP4 64
+CNSTI4 9437184
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LTI4 $370
+LABELV $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 10485760
+EQI4 $380
+ADDRGP4 $370
+JUMPV
+LABELV $425
+ADDRLP4 72
+CNSTI4 16777216
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $381
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+INDIRI4
+GTI4 $434
+LABELV $433
+ADDRLP4 80
+CNSTI4 13631488
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+GTI4 $436
+LABELV $435
+ADDRLP4 0
+INDIRI4
+CNSTI4 12582912
+EQI4 $380
+ADDRGP4 $370
+JUMPV
+LABELV $436
+ADDRLP4 88
+CNSTI4 14680064
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $370
+LABELV $437
+ADDRLP4 0
+INDIRI4
+CNSTI4 15728640
+EQI4 $381
+ADDRGP4 $370
+JUMPV
+LABELV $434
+ADDRLP4 96
+CNSTI4 18874368
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $381
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GTI4 $439
+LABELV $438
+ADDRLP4 0
+INDIRI4
+CNSTI4 17825792
+EQI4 $381
+ADDRGP4 $370
+JUMPV
+LABELV $439
+ADDRLP4 104
+CNSTI4 19922944
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $381
+ADDRLP4 0
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $370
+LABELV $440
+ADDRLP4 0
+INDIRI4
+CNSTI4 20971520
+EQI4 $381
+ADDRGP4 $370
+JUMPV
+LABELV $423
+ADDRLP4 112
+CNSTI4 32505856
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $383
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $442
+LABELV $441
+ADDRLP4 120
+CNSTI4 27262976
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $382
+ADDRLP4 0
+INDIRI4
+ADDRLP4 120
+INDIRI4
+GTI4 $444
+LABELV $443
+ADDRLP4 128
+CNSTI4 24117248
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $382
+ADDRLP4 0
+INDIRI4
+ADDRLP4 128
+INDIRI4
+GTI4 $446
+LABELV $445
+ADDRLP4 0
+INDIRI4
+CNSTI4 23068672
+EQI4 $381
+ADDRGP4 $370
+JUMPV
+LABELV $446
+ADDRLP4 136
+CNSTI4 25165824
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+EQI4 $382
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $370
+LABELV $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 26214400
+EQI4 $382
+ADDRGP4 $370
+JUMPV
+LABELV $444
+ADDRLP4 144
+CNSTI4 29360128
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+EQI4 $382
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+GTI4 $449
+LABELV $448
+ADDRLP4 0
+INDIRI4
+CNSTI4 28311552
+EQI4 $382
+ADDRGP4 $370
+JUMPV
+LABELV $449
+ADDRLP4 152
+CNSTI4 30408704
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $382
+ADDRLP4 0
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LTI4 $370
+LABELV $450
+ADDRLP4 0
+INDIRI4
+CNSTI4 31457280
+EQI4 $382
+ADDRGP4 $370
+JUMPV
+LABELV $442
+ADDRLP4 160
+CNSTI4 37748736
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $384
+ADDRLP4 0
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GTI4 $452
+LABELV $451
+ADDRLP4 168
+CNSTI4 34603008
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 168
+INDIRI4
+EQI4 $383
+ADDRLP4 0
+INDIRI4
+ADDRLP4 168
+INDIRI4
+GTI4 $454
+LABELV $453
+ADDRLP4 0
+INDIRI4
+CNSTI4 33554432
+EQI4 $383
+ADDRGP4 $370
+JUMPV
+LABELV $454
+ADDRLP4 176
+CNSTI4 35651584
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $383
+ADDRLP4 0
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LTI4 $370
+LABELV $455
+ADDRLP4 0
+INDIRI4
+CNSTI4 36700160
+EQI4 $384
+ADDRGP4 $370
+JUMPV
+LABELV $452
+ADDRLP4 184
+CNSTI4 39845888
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $384
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+GTI4 $457
+LABELV $456
+ADDRLP4 0
+INDIRI4
+CNSTI4 38797312
+EQI4 $384
+ADDRGP4 $370
+JUMPV
+LABELV $457
+ADDRLP4 192
+CNSTI4 40894464
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $385
+ADDRLP4 0
+INDIRI4
+ADDRLP4 192
+INDIRI4
+LTI4 $370
+LABELV $458
+ADDRLP4 0
+INDIRI4
+CNSTI4 41943040
+EQI4 $385
+ADDRGP4 $370
+JUMPV
+LABELV $421
+ADDRLP4 200
+CNSTI4 62914560
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 200
+INDIRI4
+GTI4 $460
+LABELV $459
+ADDRLP4 208
+CNSTI4 52428800
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $387
+ADDRLP4 0
+INDIRI4
+ADDRLP4 208
+INDIRI4
+GTI4 $462
+LABELV $461
+ADDRLP4 216
+CNSTI4 47185920
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $386
+ADDRLP4 0
+INDIRI4
+ADDRLP4 216
+INDIRI4
+GTI4 $464
+LABELV $463
+ADDRLP4 224
+CNSTI4 45088768
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $386
+ADDRLP4 0
+INDIRI4
+ADDRLP4 224
+INDIRI4
+GTI4 $466
+LABELV $465
+ADDRLP4 0
+INDIRI4
+CNSTI4 44040192
+EQI4 $385
+ADDRGP4 $370
+JUMPV
+LABELV $466
+ADDRLP4 0
+INDIRI4
+CNSTI4 46137344
+EQI4 $386
+ADDRGP4 $370
+JUMPV
+LABELV $464
+ADDRLP4 232
+CNSTI4 49283072
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $387
+ADDRLP4 0
+INDIRI4
+ADDRLP4 232
+INDIRI4
+GTI4 $468
+LABELV $467
+ADDRLP4 0
+INDIRI4
+CNSTI4 48234496
+EQI4 $386
+ADDRGP4 $370
+JUMPV
+LABELV $468
+ADDRLP4 240
+CNSTI4 50331648
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 240
+INDIRI4
+EQI4 $387
+ADDRLP4 0
+INDIRI4
+ADDRLP4 240
+INDIRI4
+LTI4 $370
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 51380224
+EQI4 $387
+ADDRGP4 $370
+JUMPV
+LABELV $462
+ADDRLP4 248
+CNSTI4 57671680
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $389
+ADDRLP4 0
+INDIRI4
+ADDRLP4 248
+INDIRI4
+GTI4 $471
+LABELV $470
+ADDRLP4 256
+CNSTI4 54525952
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 256
+INDIRI4
+EQI4 $388
+ADDRLP4 0
+INDIRI4
+ADDRLP4 256
+INDIRI4
+GTI4 $473
+LABELV $472
+ADDRLP4 0
+INDIRI4
+CNSTI4 53477376
+EQI4 $388
+ADDRGP4 $370
+JUMPV
+LABELV $473
+ADDRLP4 264
+CNSTI4 55574528
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $388
+ADDRLP4 0
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $370
+LABELV $474
+ADDRLP4 0
+INDIRI4
+CNSTI4 56623104
+EQI4 $388
+ADDRGP4 $370
+JUMPV
+LABELV $471
+ADDRLP4 272
+CNSTI4 59768832
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 272
+INDIRI4
+EQI4 $389
+ADDRLP4 0
+INDIRI4
+ADDRLP4 272
+INDIRI4
+GTI4 $476
+LABELV $475
+ADDRLP4 0
+INDIRI4
+CNSTI4 58720256
+EQI4 $389
+ADDRGP4 $370
+JUMPV
+LABELV $476
+ADDRLP4 280
+CNSTI4 60817408
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 280
+INDIRI4
+EQI4 $389
+ADDRLP4 0
+INDIRI4
+ADDRLP4 280
+INDIRI4
+LTI4 $370
+LABELV $477
+ADDRLP4 0
+INDIRI4
+CNSTI4 61865984
+EQI4 $376
+ADDRGP4 $370
+JUMPV
+LABELV $460
+ADDRLP4 288
+CNSTI4 73400320
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 288
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 288
+INDIRI4
+GTI4 $479
+LABELV $478
+ADDRLP4 296
+CNSTI4 68157440
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+EQI4 $390
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+GTI4 $481
+LABELV $480
+ADDRLP4 304
+CNSTI4 65011712
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+GTI4 $483
+LABELV $482
+ADDRLP4 0
+INDIRI4
+CNSTI4 63963136
+EQI4 $376
+ADDRGP4 $370
+JUMPV
+LABELV $483
+ADDRLP4 312
+CNSTI4 66060288
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 312
+INDIRI4
+EQI4 $390
+ADDRLP4 0
+INDIRI4
+ADDRLP4 312
+INDIRI4
+LTI4 $370
+LABELV $484
+ADDRLP4 0
+INDIRI4
+CNSTI4 67108864
+EQI4 $390
+ADDRGP4 $370
+JUMPV
+LABELV $481
+ADDRLP4 320
+CNSTI4 70254592
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 320
+INDIRI4
+EQI4 $391
+ADDRLP4 0
+INDIRI4
+ADDRLP4 320
+INDIRI4
+GTI4 $486
+LABELV $485
+ADDRLP4 0
+INDIRI4
+CNSTI4 69206016
+EQI4 $390
+ADDRGP4 $370
+JUMPV
+LABELV $486
+ADDRLP4 328
+CNSTI4 71303168
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 328
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 328
+INDIRI4
+LTI4 $370
+LABELV $487
+ADDRLP4 0
+INDIRI4
+CNSTI4 72351744
+EQI4 $378
+ADDRGP4 $370
+JUMPV
+LABELV $479
+ADDRLP4 336
+CNSTI4 82837504
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 336
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 336
+INDIRI4
+GTI4 $489
+LABELV $488
+ADDRLP4 344
+CNSTI4 79691776
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 344
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 344
+INDIRI4
+GTI4 $491
+LABELV $490
+ADDRLP4 0
+INDIRI4
+CNSTI4 74448896
+EQI4 $378
+ADDRGP4 $370
+JUMPV
+LABELV $491
+ADDRLP4 352
+CNSTI4 80740352
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 352
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 352
+INDIRI4
+LTI4 $370
+LABELV $492
+ADDRLP4 0
+INDIRI4
+CNSTI4 81788928
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $489
+ADDRLP4 360
+CNSTI4 94371840
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 360
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 360
+INDIRI4
+GTI4 $494
+LABELV $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 93323264
+EQI4 $375
+ADDRGP4 $370
+JUMPV
+LABELV $494
+ADDRLP4 368
+CNSTI4 95420416
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 368
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 368
+INDIRI4
+LTI4 $370
+LABELV $495
+ADDRLP4 0
+INDIRI4
+CNSTI4 96468992
+EQI4 $375
+ADDRGP4 $370
+JUMPV
+LABELV $419
+ADDRLP4 376
+CNSTI4 145752064
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 376
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 376
+INDIRI4
+GTI4 $497
+LABELV $496
+ADDRLP4 384
+CNSTI4 117440512
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 384
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 384
+INDIRI4
+GTI4 $499
+LABELV $498
+ADDRLP4 392
+CNSTI4 106954752
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 392
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 392
+INDIRI4
+GTI4 $501
+LABELV $500
+ADDRLP4 400
+CNSTI4 101711872
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 400
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 400
+INDIRI4
+GTI4 $503
+LABELV $502
+ADDRLP4 408
+CNSTI4 99614720
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 408
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 408
+INDIRI4
+GTI4 $505
+LABELV $504
+ADDRLP4 0
+INDIRI4
+CNSTI4 98566144
+EQI4 $375
+ADDRGP4 $370
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRI4
+CNSTI4 100663296
+EQI4 $376
+ADDRGP4 $370
+JUMPV
+LABELV $503
+ADDRLP4 416
+CNSTI4 103809024
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 416
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 416
+INDIRI4
+GTI4 $507
+LABELV $506
+ADDRLP4 0
+INDIRI4
+CNSTI4 102760448
+EQI4 $376
+ADDRGP4 $370
+JUMPV
+LABELV $507
+ADDRLP4 424
+CNSTI4 104857600
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 424
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 424
+INDIRI4
+LTI4 $370
+LABELV $508
+ADDRLP4 0
+INDIRI4
+CNSTI4 105906176
+EQI4 $376
+ADDRGP4 $370
+JUMPV
+LABELV $501
+ADDRLP4 432
+CNSTI4 112197632
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 432
+INDIRI4
+EQI4 $377
+ADDRLP4 0
+INDIRI4
+ADDRLP4 432
+INDIRI4
+GTI4 $510
+LABELV $509
+ADDRLP4 440
+CNSTI4 109051904
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 440
+INDIRI4
+EQI4 $377
+ADDRLP4 0
+INDIRI4
+ADDRLP4 440
+INDIRI4
+GTI4 $512
+LABELV $511
+ADDRLP4 0
+INDIRI4
+CNSTI4 108003328
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $512
+ADDRLP4 448
+CNSTI4 110100480
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 448
+INDIRI4
+EQI4 $377
+ADDRLP4 0
+INDIRI4
+ADDRLP4 448
+INDIRI4
+LTI4 $370
+LABELV $513
+ADDRLP4 0
+INDIRI4
+CNSTI4 111149056
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $510
+ADDRLP4 456
+CNSTI4 114294784
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 456
+INDIRI4
+EQI4 $377
+ADDRLP4 0
+INDIRI4
+ADDRLP4 456
+INDIRI4
+GTI4 $515
+LABELV $514
+ADDRLP4 0
+INDIRI4
+CNSTI4 113246208
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $515
+ADDRLP4 464
+CNSTI4 115343360
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 464
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 464
+INDIRI4
+LTI4 $370
+LABELV $516
+ADDRLP4 0
+INDIRI4
+CNSTI4 116391936
+EQI4 $378
+ADDRGP4 $370
+JUMPV
+LABELV $499
+ADDRLP4 472
+CNSTI4 130023424
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 472
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 472
+INDIRI4
+GTI4 $518
+LABELV $517
+ADDRLP4 480
+CNSTI4 123731968
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 480
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 480
+INDIRI4
+GTI4 $520
+LABELV $519
+ADDRLP4 488
+CNSTI4 119537664
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 488
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 488
+INDIRI4
+GTI4 $522
+LABELV $521
+ADDRLP4 0
+INDIRI4
+CNSTI4 118489088
+EQI4 $378
+ADDRGP4 $370
+JUMPV
+LABELV $522
+ADDRLP4 496
+CNSTI4 120586240
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 496
+INDIRI4
+LTI4 $370
+LABELV $523
+ADDRLP4 0
+INDIRI4
+CNSTI4 121634816
+EQI4 $378
+ADDRGP4 $370
+JUMPV
+LABELV $520
+ADDRLP4 504
+CNSTI4 125829120
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 504
+INDIRI4
+EQI4 $377
+ADDRLP4 0
+INDIRI4
+ADDRLP4 504
+INDIRI4
+GTI4 $525
+LABELV $524
+ADDRLP4 0
+INDIRI4
+CNSTI4 124780544
+EQI4 $376
+ADDRGP4 $370
+JUMPV
+LABELV $525
+ADDRLP4 512
+CNSTI4 126877696
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 512
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 512
+INDIRI4
+LTI4 $370
+LABELV $526
+ADDRLP4 0
+INDIRI4
+CNSTI4 128974848
+EQI4 $375
+ADDRGP4 $370
+JUMPV
+LABELV $518
+ADDRLP4 520
+CNSTI4 139460608
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 520
+INDIRI4
+EQI4 $394
+ADDRLP4 0
+INDIRI4
+ADDRLP4 520
+INDIRI4
+GTI4 $528
+LABELV $527
+ADDRLP4 528
+CNSTI4 132120576
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 528
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 528
+INDIRI4
+GTI4 $530
+LABELV $529
+ADDRLP4 0
+INDIRI4
+CNSTI4 131072000
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $530
+ADDRLP4 536
+CNSTI4 137363456
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 536
+INDIRI4
+EQI4 $392
+ADDRLP4 0
+INDIRI4
+ADDRLP4 536
+INDIRI4
+LTI4 $370
+LABELV $531
+ADDRLP4 0
+INDIRI4
+CNSTI4 138412032
+EQI4 $393
+ADDRGP4 $370
+JUMPV
+LABELV $528
+ADDRLP4 544
+CNSTI4 141557760
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 544
+INDIRI4
+EQI4 $396
+ADDRLP4 0
+INDIRI4
+ADDRLP4 544
+INDIRI4
+GTI4 $533
+LABELV $532
+ADDRLP4 0
+INDIRI4
+CNSTI4 140509184
+EQI4 $395
+ADDRGP4 $370
+JUMPV
+LABELV $533
+ADDRLP4 552
+CNSTI4 142606336
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 552
+INDIRI4
+EQI4 $392
+ADDRLP4 0
+INDIRI4
+ADDRLP4 552
+INDIRI4
+LTI4 $370
+LABELV $534
+ADDRLP4 0
+INDIRI4
+CNSTI4 144703488
+EQI4 $375
+ADDRGP4 $370
+JUMPV
+LABELV $497
+ADDRLP4 560
+CNSTI4 168820736
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 560
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 560
+INDIRI4
+GTI4 $536
+LABELV $535
+ADDRLP4 568
+CNSTI4 158334976
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 568
+INDIRI4
+EQI4 $402
+ADDRLP4 0
+INDIRI4
+ADDRLP4 568
+INDIRI4
+GTI4 $538
+LABELV $537
+ADDRLP4 576
+CNSTI4 152043520
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $398
+ADDRLP4 0
+INDIRI4
+ADDRLP4 576
+INDIRI4
+GTI4 $540
+LABELV $539
+ADDRLP4 584
+CNSTI4 147849216
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 584
+INDIRI4
+EQI4 $378
+ADDRLP4 0
+INDIRI4
+ADDRLP4 584
+INDIRI4
+GTI4 $542
+LABELV $541
+ADDRLP4 0
+INDIRI4
+CNSTI4 146800640
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $542
+ADDRLP4 592
+CNSTI4 149946368
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 592
+INDIRI4
+EQI4 $392
+ADDRLP4 0
+INDIRI4
+ADDRLP4 592
+INDIRI4
+LTI4 $370
+LABELV $543
+ADDRLP4 0
+INDIRI4
+CNSTI4 150994944
+EQI4 $397
+ADDRGP4 $370
+JUMPV
+LABELV $540
+ADDRLP4 600
+CNSTI4 154140672
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 600
+INDIRI4
+EQI4 $400
+ADDRLP4 0
+INDIRI4
+ADDRLP4 600
+INDIRI4
+GTI4 $545
+LABELV $544
+ADDRLP4 0
+INDIRI4
+CNSTI4 153092096
+EQI4 $399
+ADDRGP4 $370
+JUMPV
+LABELV $545
+ADDRLP4 608
+CNSTI4 155189248
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 608
+INDIRI4
+EQI4 $401
+ADDRLP4 0
+INDIRI4
+ADDRLP4 608
+INDIRI4
+LTI4 $370
+LABELV $546
+ADDRLP4 0
+INDIRI4
+CNSTI4 156237824
+EQI4 $392
+ADDRGP4 $370
+JUMPV
+LABELV $538
+ADDRLP4 616
+CNSTI4 163577856
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 616
+INDIRI4
+EQI4 $406
+ADDRLP4 0
+INDIRI4
+ADDRLP4 616
+INDIRI4
+GTI4 $548
+LABELV $547
+ADDRLP4 624
+CNSTI4 160432128
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 624
+INDIRI4
+EQI4 $403
+ADDRLP4 0
+INDIRI4
+ADDRLP4 624
+INDIRI4
+GTI4 $550
+LABELV $549
+ADDRLP4 0
+INDIRI4
+CNSTI4 159383552
+EQI4 $402
+ADDRGP4 $370
+JUMPV
+LABELV $550
+ADDRLP4 632
+CNSTI4 161480704
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 632
+INDIRI4
+EQI4 $404
+ADDRLP4 0
+INDIRI4
+ADDRLP4 632
+INDIRI4
+LTI4 $370
+LABELV $551
+ADDRLP4 0
+INDIRI4
+CNSTI4 162529280
+EQI4 $405
+ADDRGP4 $370
+JUMPV
+LABELV $548
+ADDRLP4 640
+CNSTI4 165675008
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 640
+INDIRI4
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+ADDRLP4 640
+INDIRI4
+GTI4 $553
+LABELV $552
+ADDRLP4 0
+INDIRI4
+CNSTI4 164626432
+EQI4 $407
+ADDRGP4 $370
+JUMPV
+LABELV $553
+ADDRLP4 648
+CNSTI4 166723584
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 648
+INDIRI4
+EQI4 $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 648
+INDIRI4
+LTI4 $370
+LABELV $554
+ADDRLP4 0
+INDIRI4
+CNSTI4 167772160
+EQI4 $377
+ADDRGP4 $370
+JUMPV
+LABELV $536
+ADDRLP4 656
+CNSTI4 182452224
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $411
+ADDRLP4 0
+INDIRI4
+ADDRLP4 656
+INDIRI4
+GTI4 $556
+LABELV $555
+ADDRLP4 664
+CNSTI4 174063616
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 664
+INDIRI4
+EQI4 $410
+ADDRLP4 0
+INDIRI4
+ADDRLP4 664
+INDIRI4
+GTI4 $558
+LABELV $557
+ADDRLP4 672
+CNSTI4 170917888
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 672
+INDIRI4
+EQI4 $408
+ADDRLP4 0
+INDIRI4
+ADDRLP4 672
+INDIRI4
+GTI4 $560
+LABELV $559
+ADDRLP4 0
+INDIRI4
+CNSTI4 169869312
+EQI4 $407
+ADDRGP4 $370
+JUMPV
+LABELV $560
+ADDRLP4 680
+CNSTI4 171966464
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 680
+INDIRI4
+EQI4 $408
+ADDRLP4 0
+INDIRI4
+ADDRLP4 680
+INDIRI4
+LTI4 $370
+LABELV $561
+ADDRLP4 0
+INDIRI4
+CNSTI4 173015040
+EQI4 $409
+ADDRGP4 $370
+JUMPV
+LABELV $558
+ADDRLP4 688
+CNSTI4 176160768
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 688
+INDIRI4
+EQI4 $402
+ADDRLP4 0
+INDIRI4
+ADDRLP4 688
+INDIRI4
+GTI4 $563
+LABELV $562
+ADDRLP4 0
+INDIRI4
+CNSTI4 175112192
+EQI4 $410
+ADDRGP4 $370
+JUMPV
+LABELV $563
+ADDRLP4 696
+CNSTI4 180355072
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 696
+INDIRI4
+EQI4 $411
+ADDRLP4 0
+INDIRI4
+ADDRLP4 696
+INDIRI4
+LTI4 $370
+LABELV $564
+ADDRLP4 0
+INDIRI4
+CNSTI4 181403648
+EQI4 $411
+ADDRGP4 $370
+JUMPV
+LABELV $556
+ADDRLP4 704
+CNSTI4 188743680
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 704
+INDIRI4
+EQI4 $413
+ADDRLP4 0
+INDIRI4
+ADDRLP4 704
+INDIRI4
+GTI4 $566
+LABELV $565
+ADDRLP4 712
+CNSTI4 184549376
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 712
+INDIRI4
+EQI4 $411
+ADDRLP4 0
+INDIRI4
+ADDRLP4 712
+INDIRI4
+GTI4 $568
+LABELV $567
+ADDRLP4 0
+INDIRI4
+CNSTI4 183500800
+EQI4 $411
+ADDRGP4 $370
+JUMPV
+LABELV $568
+ADDRLP4 720
+CNSTI4 185597952
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 720
+INDIRI4
+EQI4 $411
+ADDRLP4 0
+INDIRI4
+ADDRLP4 720
+INDIRI4
+LTI4 $370
+LABELV $569
+ADDRLP4 0
+INDIRI4
+CNSTI4 187695104
+EQI4 $412
+ADDRGP4 $370
+JUMPV
+LABELV $566
+ADDRLP4 728
+CNSTI4 190840832
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 728
+INDIRI4
+EQI4 $415
+ADDRLP4 0
+INDIRI4
+ADDRLP4 728
+INDIRI4
+GTI4 $571
+LABELV $570
+ADDRLP4 0
+INDIRI4
+CNSTI4 189792256
+EQI4 $414
+ADDRGP4 $370
+JUMPV
+LABELV $571
+ADDRLP4 736
+CNSTI4 191889408
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 736
+INDIRI4
+EQI4 $416
+ADDRLP4 0
+INDIRI4
+ADDRLP4 736
+INDIRI4
+LTI4 $370
+LABELV $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 192937984
+EQI4 $417
+ADDRGP4 $370
+JUMPV
+LABELV $370
+CNSTI4 37
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $375
+CNSTI4 38
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $376
+CNSTI4 39
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $377
+CNSTI4 40
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $378
+CNSTI4 41
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $379
+CNSTI4 42
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $380
+CNSTI4 43
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $381
+CNSTI4 44
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $382
+CNSTI4 45
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $383
+CNSTI4 46
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $384
+CNSTI4 47
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $385
+CNSTI4 48
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $386
+CNSTI4 49
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $387
+CNSTI4 50
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $388
+CNSTI4 51
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $389
+CNSTI4 52
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $390
+CNSTI4 53
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $391
+CNSTI4 54
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $392
+CNSTI4 55
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $393
+CNSTI4 56
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $394
+CNSTI4 57
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $395
+CNSTI4 58
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $396
+CNSTI4 59
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $397
+CNSTI4 60
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $398
+CNSTI4 61
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $399
+CNSTI4 62
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $400
+CNSTI4 63
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $401
+CNSTI4 64
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $402
+CNSTI4 65
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $403
+CNSTI4 66
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $404
+CNSTI4 67
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $405
+CNSTI4 68
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $406
+CNSTI4 69
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $407
+CNSTI4 70
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $408
+CNSTI4 71
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $409
+CNSTI4 72
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $410
+CNSTI4 73
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $411
+CNSTI4 74
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $412
+CNSTI4 75
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $413
+CNSTI4 76
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $414
+CNSTI4 77
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $415
+CNSTI4 78
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $416
+CNSTI4 79
+RETI4
+ADDRGP4 $365
+JUMPV
+LABELV $417
+CNSTI4 80
+RETI4
+LABELV $365
+endproc PM_FootstepForSurface 740 0
+proc PM_CrashLand 76 4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 40
+INDIRI4
+EQI4 $574
+CNSTI4 21
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $574
+CNSTI4 19
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+LABELV $575
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 pml+112+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 pml+124+8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+GEF4 $580
+ADDRGP4 $573
+JUMPV
+LABELV $580
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 8
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 953267991
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $582
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $582
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $584
+ADDRGP4 $573
+JUMPV
+LABELV $584
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $586
+ADDRLP4 0
+CNSTF4 1062836634
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $586
+CNSTI4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $588
+ADDRLP4 0
+CNSTF4 1063675494
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $588
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $591
+ADDRGP4 $573
+JUMPV
+LABELV $591
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $593
+ADDRLP4 0
+INDIRF4
+CNSTF4 1118306304
+LEF4 $597
+CNSTI4 24
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $597
+ADDRLP4 0
+INDIRF4
+CNSTF4 1116471296
+LEF4 $599
+CNSTI4 25
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $599
+ADDRLP4 0
+INDIRF4
+CNSTF4 1114112000
+LEF4 $601
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $603
+CNSTI4 26
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $603
+ADDRLP4 4
+CNSTI4 250
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $601
+ADDRLP4 0
+INDIRF4
+CNSTF4 1111490560
+LEF4 $605
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $607
+CNSTI4 27
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $607
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRF4
+CNSTF4 1109065728
+LEF4 $609
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $611
+CNSTI4 28
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $611
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $609
+ADDRLP4 0
+INDIRF4
+CNSTF4 1105199104
+LEF4 $613
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $615
+CNSTI4 29
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $615
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $613
+ADDRLP4 0
+INDIRF4
+CNSTF4 1088421888
+LEF4 $617
+CNSTI4 30
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $617
+ADDRLP4 60
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRLP4 0
+INDIRF4
+CNSTF4 1114636288
+LEF4 $619
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $621
+CNSTI4 28
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $621
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRLP4 0
+INDIRF4
+CNSTF4 1109393408
+LEF4 $623
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $625
+CNSTI4 29
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $625
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $624
+JUMPV
+LABELV $623
+ADDRLP4 0
+INDIRF4
+CNSTF4 1088421888
+LEF4 $627
+CNSTI4 30
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $628
+JUMPV
+LABELV $627
+ADDRLP4 60
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $628
+LABELV $624
+LABELV $620
+LABELV $594
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1209810944
+LEF4 $629
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $629
+CNSTI4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $631
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $631
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $634
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $634
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $573
+endproc PM_CrashLand 76 4
+proc PM_CorrectAllSolid 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRGP4 $639
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $637
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+LABELV $640
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $644
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+LABELV $648
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $654
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 56
+CNSTI4 1
+RETI4
+ADDRGP4 $636
+JUMPV
+LABELV $654
+LABELV $649
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $648
+LABELV $645
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LEI4 $644
+LABELV $641
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $640
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $636
+endproc PM_CorrectAllSolid 40 28
+proc PM_GroundTraceMissed 80 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $662
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $664
+ADDRGP4 $666
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $664
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $668
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $671
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $672
+JUMPV
+LABELV $671
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $672
+LABELV $668
+LABELV $662
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+LABELV $661
+endproc PM_GroundTraceMissed 80 28
+proc PM_GroundTrace 92 28
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRLP4 0
+INDIRB
+ASGNB 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $679
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 PM_CorrectAllSolid
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRGP4 $675
+JUMPV
+LABELV $681
+LABELV $679
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $683
+ADDRGP4 PM_GroundTraceMissed
+CALLV
+pop
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $683
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 0
+LEF4 $688
+ADDRLP4 80
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1092616192
+LEF4 $688
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRGP4 $697
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $695
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $698
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $698
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $699
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $688
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1060320051
+GEF4 $702
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRGP4 $708
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $706
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $702
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 1
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $713
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -49
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $713
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $715
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $717
+ADDRGP4 $719
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $717
+ADDRGP4 PM_CrashLand
+CALLV
+pop
+ADDRGP4 pml+124+8
+INDIRF4
+CNSTF4 3276275712
+GEF4 $720
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 250
+ASGNI4
+LABELV $720
+LABELV $715
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddTouchEnt
+CALLV
+pop
+LABELV $675
+endproc PM_GroundTrace 92 28
+proc PM_SetWaterLevel 56 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $729
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRLP4 40
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $732
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $735
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $735
+LABELV $732
+LABELV $729
+LABELV $726
+endproc PM_SetWaterLevel 56 8
+proc PM_CheckDuck 72 28
+ADDRGP4 pm
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $738
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 -16
+ASGNI4
+ADDRGP4 $737
+JUMPV
+LABELV $738
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $740
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $740
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $742
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 188
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $744
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $744
+LABELV $742
+LABELV $741
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $746
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 20
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1113587712
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 40
+ASGNI4
+LABELV $747
+LABELV $737
+endproc PM_CheckDuck 72 28
+proc PM_Footsteps 60 4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $749
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $748
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $748
+JUMPV
+LABELV $749
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $753
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $753
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+GEF4 $748
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $757
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $748
+JUMPV
+LABELV $757
+CNSTI4 22
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $748
+JUMPV
+LABELV $753
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 40
+INDIRI4
+EQI4 $759
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $761
+CNSTI4 32
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $761
+CNSTI4 13
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $759
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $763
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $765
+CNSTI4 16
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $766
+JUMPV
+LABELV $765
+CNSTI4 15
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $766
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $764
+JUMPV
+LABELV $763
+ADDRLP4 4
+CNSTF4 1050253722
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $767
+CNSTI4 33
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $768
+JUMPV
+LABELV $767
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $768
+LABELV $764
+LABELV $760
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 192
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+BXORI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $770
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $772
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRLP4 56
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $773
+JUMPV
+LABELV $772
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $776
+CNSTI4 81
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $778
+CNSTI4 83
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $779
+JUMPV
+LABELV $778
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $780
+LABELV $780
+LABELV $779
+LABELV $777
+LABELV $773
+LABELV $770
+LABELV $748
+endproc PM_Footsteps 60 4
+proc PM_WaterEvents 16 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $783
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $783
+CNSTI4 84
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $783
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $786
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $786
+CNSTI4 85
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $786
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $789
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $789
+CNSTI4 86
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $789
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $792
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $792
+CNSTI4 87
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $792
+LABELV $782
+endproc PM_WaterEvents 16 4
+proc PM_BeginWeaponChange 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $798
+ADDRFP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $796
+LABELV $798
+ADDRGP4 $795
+JUMPV
+LABELV $796
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $799
+ADDRGP4 $795
+JUMPV
+LABELV $799
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $801
+ADDRGP4 $795
+JUMPV
+LABELV $801
+CNSTI4 36
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $795
+endproc PM_BeginWeaponChange 12 8
+proc PM_FinishWeaponChange 16 8
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $806
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $804
+LABELV $806
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $804
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $807
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $807
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $803
+endproc PM_FinishWeaponChange 16 8
+proc PM_TorsoAnimation 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $810
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $812
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+ADDRGP4 $809
+JUMPV
+LABELV $812
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+LABELV $810
+LABELV $809
+endproc PM_TorsoAnimation 0 4
+proc PM_Weapon 28 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $815
+ADDRGP4 $814
+JUMPV
+LABELV $815
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $817
+ADDRGP4 $814
+JUMPV
+LABELV $817
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $819
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $819
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $821
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $822
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+CNSTI4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $825
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 100
+LTI4 $825
+ADDRGP4 $814
+JUMPV
+LABELV $825
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+CNSTI4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 105
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 244
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $821
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $822
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $829
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $829
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $834
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $832
+LABELV $834
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+EQI4 $835
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 PM_BeginWeaponChange
+CALLV
+pop
+LABELV $835
+LABELV $832
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $837
+ADDRGP4 $814
+JUMPV
+LABELV $837
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $839
+ADDRGP4 PM_FinishWeaponChange
+CALLV
+pop
+ADDRGP4 $814
+JUMPV
+LABELV $839
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $841
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $843
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $814
+JUMPV
+LABELV $843
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $814
+JUMPV
+LABELV $841
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $845
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $845
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $847
+ADDRGP4 pm
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $849
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $849
+CNSTI4 8
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $848
+JUMPV
+LABELV $847
+CNSTI4 7
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $848
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $851
+CNSTI4 35
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $851
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $853
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $853
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $855
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+GTI4 $855
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $871-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $871
+address $858
+address $859
+address $860
+address $861
+address $862
+address $863
+address $864
+address $865
+address $866
+address $867
+address $868
+address $869
+address $870
+code
+LABELV $855
+LABELV $858
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $859
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $860
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $861
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $862
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $863
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $864
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $865
+ADDRLP4 0
+CNSTI4 1200
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $866
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $867
+ADDRLP4 0
+CNSTI4 50
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $868
+ADDRLP4 0
+CNSTI4 1500
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $869
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $870
+ADDRLP4 0
+CNSTI4 200
+ASGNI4
+LABELV $856
+CNSTI4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $873
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $873
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $814
+endproc PM_Weapon 28 4
+proc PM_Animate 0 4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $877
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $878
+CNSTI4 6
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 2294
+ASGNI4
+CNSTI4 88
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $878
+JUMPV
+LABELV $877
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $881
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $882
+CNSTI4 29
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $882
+JUMPV
+LABELV $881
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $885
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $886
+CNSTI4 30
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $886
+JUMPV
+LABELV $885
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $889
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $890
+CNSTI4 25
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $890
+JUMPV
+LABELV $889
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $893
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $894
+CNSTI4 26
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $897
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $898
+CNSTI4 28
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 600
+ASGNI4
+ADDRGP4 $898
+JUMPV
+LABELV $897
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $901
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $903
+CNSTI4 27
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 600
+ASGNI4
+LABELV $903
+LABELV $901
+LABELV $898
+LABELV $894
+LABELV $890
+LABELV $886
+LABELV $882
+LABELV $878
+LABELV $876
+endproc PM_Animate 0 4
+proc PM_DropTimers 4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $906
+ADDRGP4 pml+40
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $908
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -113
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $909
+LABELV $906
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $912
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $915
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $915
+LABELV $912
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $917
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $920
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $920
+LABELV $917
+LABELV $905
+endproc PM_DropTimers 4 0
+export PM_UpdateViewAngles
+proc PM_UpdateViewAngles 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+EQI4 $925
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $923
+LABELV $925
+ADDRGP4 $922
+JUMPV
+LABELV $923
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $926
+ADDRGP4 $922
+JUMPV
+LABELV $926
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $928
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDP4
+INDIRI4
+ADDI4
+CVII2 4
+ASGNI2
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $932
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 16000
+LEI4 $934
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDP4
+CNSTI4 16000
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 16000
+ASGNI2
+ADDRGP4 $935
+JUMPV
+LABELV $934
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 -16000
+GEI4 $936
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDP4
+CNSTI4 -16000
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 -16000
+ASGNI2
+LABELV $936
+LABELV $935
+LABELV $932
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDP4
+CNSTF4 1001652224
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $929
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $928
+LABELV $922
+endproc PM_UpdateViewAngles 28 0
+export PmoveSingle
+proc PmoveSingle 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 pm
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 c_pmove
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $939
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $939
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GTI4 $943
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+LEI4 $941
+LABELV $943
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $941
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $944
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $945
+JUMPV
+LABELV $944
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $945
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $946
+ADDRLP4 28
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+EQI4 $946
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $946
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+ADDRLP4 24
+INDIRI4
+EQI4 $946
+ADDRLP4 20
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $946
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $946
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $947
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LEI4 $948
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRLP4 40
+INDIRI4
+NEI4 $948
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $948
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $950
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1024
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $950
+ADDRGP4 pml
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 pml+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 1
+GEI4 $953
+ADDRGP4 pml+40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 200
+LEI4 $957
+ADDRGP4 pml+40
+CNSTI4 200
+ASGNI4
+LABELV $957
+LABELV $954
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pml+112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+36
+CNSTF4 981668463
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+24
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $967
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $967
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $969
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $970
+JUMPV
+LABELV $969
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $973
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $971
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 56
+INDIRI4
+EQI4 $971
+LABELV $973
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+LABELV $971
+LABELV $970
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $974
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $974
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $976
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_FlyMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $938
+JUMPV
+LABELV $976
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $978
+ADDRGP4 PM_NoclipMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $938
+JUMPV
+LABELV $978
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $980
+ADDRGP4 $938
+JUMPV
+LABELV $980
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 5
+EQI4 $984
+ADDRLP4 60
+INDIRI4
+CNSTI4 6
+NEI4 $982
+LABELV $984
+ADDRGP4 $938
+JUMPV
+LABELV $982
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 pml+136
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $986
+ADDRGP4 PM_DeadMove
+CALLV
+pop
+LABELV $986
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $988
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $989
+JUMPV
+LABELV $988
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $990
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $991
+JUMPV
+LABELV $990
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $992
+ADDRGP4 PM_WalkMove
+CALLV
+pop
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRGP4 PM_AirMove
+CALLV
+pop
+LABELV $993
+LABELV $991
+LABELV $989
+ADDRGP4 PM_Animate
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 PM_Weapon
+CALLV
+pop
+ADDRGP4 PM_TorsoAnimation
+CALLV
+pop
+ADDRGP4 PM_Footsteps
+CALLV
+pop
+ADDRGP4 PM_WaterEvents
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRGP4 trap_SnapVector
+CALLV
+pop
+LABELV $938
+endproc PmoveSingle 64 16
+export Pmove
+proc Pmove 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+GEI4 $996
+ADDRGP4 $995
+JUMPV
+LABELV $996
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $998
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $998
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 1016
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1000
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1003
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+LEI4 $1004
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRLP4 12
+INDIRI4
+CNSTI4 66
+LEI4 $1007
+ADDRLP4 12
+CNSTI4 66
+ASGNI4
+LABELV $1007
+LABELV $1004
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PmoveSingle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1009
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 20
+ASGNI1
+LABELV $1009
+LABELV $1001
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1000
+LABELV $995
+endproc Pmove 24 4
+import PM_StepSlideMove
+import PM_SlideMove
+bss
+export pml
+align 4
+LABELV pml
+skip 140
+export pm
+align 4
+LABELV pm
+skip 4
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $719
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 76
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $708
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $697
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $666
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 108
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $639
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
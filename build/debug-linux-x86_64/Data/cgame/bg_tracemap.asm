@@ -0,0 +1,5149 @@
+data
+align 4
+LABELV $80
+byte 4 0
+align 4
+LABELV $81
+byte 4 0
+export BG_GenerateTracemap
+code
+proc BG_GenerateTracemap 1300 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $82
+ARGP4
+ADDRLP4 200
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 200
+ARGP4
+ADDRLP4 1224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $83
+ADDRGP4 $85
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $83
+ADDRLP4 1236
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+EQF4 $86
+ADDRGP4 $88
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $86
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $89
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 tracemap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 786460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 120
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 100
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1248
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 132
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 1248
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1252
+CNSTI4 4
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1252
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1252
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 1248
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $90
+ADDRLP4 1256
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 1256
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 1256
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $94
+ADDRLP4 1260
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1264
+CNSTP4 0
+ASGNP4
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 1268
+ADDRGP4 $81
+ASGNP4
+ADDRLP4 1268
+INDIRP4
+ADDRLP4 1268
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $108
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $107
+JUMPV
+LABELV $108
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $112
+ADDRLP4 76+8
+CNSTF4 3347054336
+ASGNF4
+LABELV $112
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1272
+CNSTP4 0
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1276
+ADDRGP4 $81
+ASGNP4
+ADDRLP4 1276
+INDIRP4
+ADDRLP4 1276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $120
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $107
+JUMPV
+LABELV $120
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $107
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+LEF4 $130
+ADDRLP4 120
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $130
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+GEF4 $107
+ADDRLP4 100
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $117
+LABELV $106
+ADDRGP4 $105
+JUMPV
+LABELV $107
+ADDRLP4 1272
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1272
+INDIRI4
+ASGNI4
+ADDRLP4 1276
+ADDRGP4 $80
+INDIRI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $140
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $138
+LABELV $140
+ADDRGP4 $80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1284
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1284
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $81
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $138
+LABELV $95
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $94
+LABELV $91
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $90
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1256
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1256
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $81
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $142
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 108
+CNSTI4 65536
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $143
+ADDRLP4 1260
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $147
+ADDRLP4 1264
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 3347054592
+NEF4 $161
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $157
+JUMPV
+LABELV $160
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $163
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $167
+ADDRLP4 76+8
+CNSTF4 1199570688
+ASGNF4
+LABELV $167
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1268
+CNSTP4 0
+ASGNP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1272
+ADDRGP4 $81
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ADDRLP4 1272
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $171
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $174
+ADDRLP4 4+12
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRLP4 1276
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+NEI4 $177
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+LEF4 $183
+ADDRLP4 116
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $183
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+GEF4 $162
+ADDRLP4 108
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $177
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $172
+JUMPV
+LABELV $174
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $197
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $162
+JUMPV
+LABELV $197
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $201
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+LEF4 $207
+ADDRLP4 116
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $207
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+GEF4 $162
+ADDRLP4 108
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $201
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $172
+LABELV $161
+ADDRGP4 $160
+JUMPV
+LABELV $162
+LABELV $157
+ADDRLP4 1268
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1268
+INDIRI4
+ASGNI4
+ADDRLP4 1272
+ADDRGP4 $80
+INDIRI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $220
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $218
+LABELV $220
+ADDRGP4 $80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1280
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1280
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $81
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $218
+LABELV $148
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $147
+LABELV $144
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $143
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1260
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1260
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $81
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $221
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 112
+CNSTI4 65536
+ASGNI4
+ADDRLP4 128
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $222
+ADDRLP4 1264
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $226
+ADDRLP4 1268
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1276
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 1276
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $234
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 1276
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $234
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1280
+CNSTP4 0
+ASGNP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1284
+ADDRGP4 $81
+ASGNP4
+ADDRLP4 1284
+INDIRP4
+ADDRLP4 1284
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $238
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $238
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 1280
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1284
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $235
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $247
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+LEF4 $250
+ADDRLP4 128
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $250
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+GEF4 $254
+ADDRLP4 112
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $254
+LABELV $247
+ADDRLP4 1280
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1280
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+ADDRGP4 $80
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $260
+ADDRLP4 1284
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $258
+LABELV $260
+ADDRGP4 $80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1292
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1292
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $81
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $258
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $226
+LABELV $223
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $222
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1264
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1264
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $81
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 1132331008
+ADDRLP4 120
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+NEF4 $261
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+LABELV $261
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $263
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $267
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+LTF4 $271
+ADDRLP4 1268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $271
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $280
+LABELV $277
+LABELV $268
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $267
+LABELV $264
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $263
+ADDRLP4 124
+CNSTF4 1132331008
+ADDRLP4 128
+INDIRI4
+ADDRLP4 112
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+NEF4 $284
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+LABELV $284
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $286
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+LTF4 $294
+ADDRLP4 1268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $300
+JUMPV
+LABELV $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $303
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $303
+LABELV $300
+LABELV $291
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $290
+LABELV $287
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $286
+ADDRLP4 116
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $307
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 124
+CNSTF4 1132331008
+ADDRLP4 116
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $308
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $309
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $317
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 1268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $318
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $323
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $327
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $327
+LABELV $324
+LABELV $314
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $313
+LABELV $310
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $309
+ADDRLP4 136
+ARGP4
+ADDRLP4 1268
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 1272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 2
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 1
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 1
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 32
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $332
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $336
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $337
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $337
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $350
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $350
+address $344
+address $345
+address $346
+address $347
+address $348
+address $349
+code
+LABELV $344
+ADDRLP4 100
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $345
+ADDRLP4 120
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $346
+ADDRLP4 112
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $347
+ADDRLP4 128
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $348
+ADDRLP4 108
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $349
+ADDRLP4 116
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $340
+ADDRLP4 1280
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1280
+INDIRF4
+ADDRLP4 1284
+INDIRF4
+LTF4 $353
+ADDRLP4 1276
+ADDRLP4 1280
+INDIRF4
+ADDRLP4 1284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 1276
+ADDRLP4 1280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $354
+ADDRLP4 88
+ADDRLP4 1276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $355
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 1292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+LTF4 $360
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $361
+ADDRLP4 88
+ADDRLP4 1288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $356
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $362
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 1292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+LTF4 $367
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $368
+ADDRLP4 88
+ADDRLP4 1288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 255
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $363
+LABELV $337
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $336
+LABELV $333
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $332
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $369
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $79
+endproc BG_GenerateTracemap 1300 28
+export BG_LoadTraceMap
+proc BG_LoadTraceMap 1180 12
+ADDRLP4 1132
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 1136
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1148
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+LTI4 $371
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $373
+ADDRLP4 1056
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+LABELV $374
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+LTI4 $373
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $377
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $381
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $385
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $385
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $387
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $387
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $413
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $413
+address $389
+address $393
+address $397
+address $401
+address $405
+address $409
+code
+LABELV $389
+ADDRLP4 1156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $393
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $397
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $401
+ADDRLP4 1168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $405
+ADDRLP4 1172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $409
+ADDRLP4 1176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $387
+LABELV $388
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $382
+JUMPV
+LABELV $385
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $418
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $418
+ADDRLP4 1156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $424
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $434
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $434
+LABELV $382
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $381
+LABELV $378
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $377
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $439
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $440
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $441
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $445
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $449
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $449
+LABELV $446
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $445
+LABELV $442
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $441
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $454
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $455
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $456
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $460
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $464
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $464
+LABELV $461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $460
+LABELV $457
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $456
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $469
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $470
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $471
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $475
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $479
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $479
+LABELV $476
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $475
+LABELV $472
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $471
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $484
+ARGP4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1160
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+RETI4
+ADDRGP4 $370
+JUMPV
+LABELV $372
+ADDRGP4 tracemap+786436
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786436+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1152
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1156
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor
+ADDRLP4 1152
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRLP4 1156
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor+4
+ADDRLP4 1152
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRLP4 1156
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 tracemap+786452
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 tracemap+786456
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+RETI4
+LABELV $370
+endproc BG_LoadTraceMap 1180 12
+proc BG_ClampPointToTracemapExtends 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+GEF4 $501
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786436
+INDIRF4
+ASGNF4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+LEF4 $505
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786444
+INDIRF4
+ASGNF4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $506
+LABELV $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+GEF4 $509
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ASGNF4
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+LEF4 $515
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+ASGNF4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $516
+LABELV $510
+LABELV $500
+endproc BG_ClampPointToTracemapExtends 4 0
+export BG_GetSkyHeightAtPoint
+proc BG_GetSkyHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $522
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $521
+JUMPV
+LABELV $522
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $521
+endproc BG_GetSkyHeightAtPoint 16 8
+export BG_GetSkyGroundHeightAtPoint
+proc BG_GetSkyGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $531
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $530
+JUMPV
+LABELV $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $530
+endproc BG_GetSkyGroundHeightAtPoint 16 8
+export BG_GetGroundHeightAtPoint
+proc BG_GetGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $540
+CNSTF4 3347054592
+RETF4
+ADDRGP4 $539
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $539
+endproc BG_GetGroundHeightAtPoint 16 8
+export BG_GetTracemapGroundFloor
+proc BG_GetTracemapGroundFloor 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $549
+CNSTI4 -65536
+RETI4
+ADDRGP4 $548
+JUMPV
+LABELV $549
+ADDRGP4 tracemap+786452
+INDIRI4
+RETI4
+LABELV $548
+endproc BG_GetTracemapGroundFloor 0 0
+export BG_GetTracemapGroundCeil
+proc BG_GetTracemapGroundCeil 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $553
+CNSTI4 65536
+RETI4
+ADDRGP4 $552
+JUMPV
+LABELV $553
+ADDRGP4 tracemap+786456
+INDIRI4
+RETI4
+LABELV $552
+endproc BG_GetTracemapGroundCeil 0 0
+export FinalizeTracemapClamp
+proc FinalizeTracemapClamp 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $559
+LABELV $558
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $561
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $563
+ADDRFP4 4
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $563
+LABELV $562
+LABELV $556
+endproc FinalizeTracemapClamp 0 0
+bss
+align 4
+LABELV one_over_mapgrid_factor
+skip 8
+align 4
+LABELV tracemap
+skip 786460
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $484
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $369
+byte 1 84
+byte 1 82
+byte 1 85
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 45
+byte 1 88
+byte 1 70
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 0
+byte 1 0
+align 1
+LABELV $331
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $221
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $142
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $141
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $89
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $88
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $85
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $82
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
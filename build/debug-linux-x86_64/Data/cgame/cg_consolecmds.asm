@@ -0,0 +1,3856 @@
+code
+proc CG_TargetCommand_f 20 12
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $89
+ADDRGP4 $88
+JUMPV
+LABELV $89
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $91
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $88
+endproc CG_TargetCommand_f 20 12
+proc CG_SizeUp_f 4 12
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $92
+endproc CG_SizeUp_f 4 12
+proc CG_SizeDown_f 4 12
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $95
+endproc CG_SizeDown_f 4 12
+proc CG_Viewpos_f 0 20
+ADDRGP4 $98
+ARGP4
+ADDRGP4 cg+125184+24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+125624+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $97
+endproc CG_Viewpos_f 0 20
+proc CG_ScoresDown_f 0 4
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 cg+131364
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+123084
+INDIRI4
+GEI4 $110
+ADDRGP4 cg+131364
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $116
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 cg+134968
+INDIRI4
+CNSTI4 0
+NEI4 $111
+ADDRGP4 cg+134968
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+131368
+CNSTI4 0
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRGP4 cg+134968
+CNSTI4 1
+ASGNI4
+LABELV $111
+LABELV $109
+endproc CG_ScoresDown_f 0 4
+proc CG_ScoresUp_f 0 0
+ADDRGP4 cg+134968
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRGP4 cg+134968
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+134976
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $124
+LABELV $123
+endproc CG_ScoresUp_f 0 0
+proc CG_LoadHud_f 1028 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $131
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ADDRLP4 0
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $132
+ADDRLP4 1024
+ADDRGP4 $134
+ASGNP4
+LABELV $132
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadMenus
+CALLV
+pop
+ADDRGP4 CG_HudMenuHacks
+CALLV
+pop
+ADDRGP4 menuScoreboard
+CNSTP4 0
+ASGNP4
+LABELV $130
+endproc CG_LoadHud_f 1028 12
+proc CG_scrollScoresDown_f 0 12
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $136
+ADDRGP4 cg+134972
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+LABELV $136
+LABELV $135
+endproc CG_scrollScoresDown_f 0 12
+proc CG_scrollScoresUp_f 0 12
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $140
+ADDRGP4 cg+134972
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ScrollFeeder
+CALLV
+pop
+LABELV $140
+LABELV $139
+endproc CG_scrollScoresUp_f 0 12
+proc CG_spWin_f 0 12
+ADDRGP4 $144
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $145
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 cgs+5042112+22932
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $150
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $143
+endproc CG_spWin_f 0 12
+proc CG_spLose_f 0 12
+ADDRGP4 $144
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $145
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 cgs+5042112+22936
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $154
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $151
+endproc CG_spLose_f 0 12
+proc CG_TellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $156
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $155
+endproc CG_TellTarget_f 264 20
+proc CG_TellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $160
+ADDRGP4 $159
+JUMPV
+LABELV $160
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $159
+endproc CG_TellAttacker_f 264 20
+proc CG_VoiceTellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $163
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $162
+endproc CG_VoiceTellTarget_f 264 20
+proc CG_VoiceTellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $167
+ADDRGP4 $166
+JUMPV
+LABELV $167
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $166
+endproc CG_VoiceTellAttacker_f 264 20
+proc CG_NextTeamMember_f 0 0
+ADDRGP4 CG_SelectNextPlayer
+CALLV
+pop
+LABELV $169
+endproc CG_NextTeamMember_f 0 0
+proc CG_PrevTeamMember_f 0 0
+ADDRGP4 CG_SelectPrevPlayer
+CALLV
+pop
+LABELV $170
+endproc CG_PrevTeamMember_f 0 0
+proc CG_NextOrder_f 16 0
+ADDRLP4 0
+CNSTI4 6112
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $174
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $176
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+EQI4 $176
+ADDRGP4 $171
+JUMPV
+LABELV $176
+LABELV $174
+ADDRGP4 cgs+474984
+INDIRI4
+CNSTI4 7
+GEI4 $180
+ADDRLP4 4
+ADDRGP4 cgs+474984
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+474984
+INDIRI4
+CNSTI4 3
+NEI4 $184
+ADDRLP4 8
+ADDRGP4 CG_OtherTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRLP4 12
+ADDRGP4 cgs+474984
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $187
+LABELV $184
+ADDRGP4 cgs+474984
+INDIRI4
+CNSTI4 4
+NEI4 $181
+ADDRLP4 8
+ADDRGP4 CG_YourTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRLP4 12
+ADDRGP4 cgs+474984
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRGP4 cgs+474984
+CNSTI4 1
+ASGNI4
+LABELV $181
+ADDRGP4 cgs+474988
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+474992
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+LABELV $171
+endproc CG_NextOrder_f 16 0
+proc CG_ConfirmOrder_f 8 12
+ADDRGP4 $201
+ARGP4
+ADDRGP4 cgs+475008
+INDIRI4
+ARGI4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $204
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+475000
+INDIRI4
+GEI4 $205
+ADDRGP4 $209
+ARGP4
+ADDRGP4 cgs+475004
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 cgs+475000
+CNSTI4 0
+ASGNI4
+LABELV $205
+LABELV $200
+endproc CG_ConfirmOrder_f 8 12
+proc CG_DenyOrder_f 4 12
+ADDRGP4 $201
+ARGP4
+ADDRGP4 cgs+475008
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+475000
+INDIRI4
+GEI4 $216
+ADDRGP4 cgs+475000
+CNSTI4 0
+ASGNI4
+LABELV $216
+LABELV $212
+endproc CG_DenyOrder_f 4 12
+proc CG_TaskOffense_f 4 8
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+EQI4 $226
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $222
+LABELV $226
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $228
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $223
+ADDRGP4 $209
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $221
+endproc CG_TaskOffense_f 4 8
+proc CG_TaskDefense_f 8 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $209
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $230
+endproc CG_TaskDefense_f 8 8
+proc CG_TaskPatrol_f 8 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $209
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $232
+endproc CG_TaskPatrol_f 8 8
+proc CG_TaskCamp_f 8 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $209
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $234
+endproc CG_TaskCamp_f 8 8
+proc CG_TaskFollow_f 8 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $237
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $209
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $236
+endproc CG_TaskFollow_f 8 8
+proc CG_TaskRetrieve_f 8 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $209
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $238
+endproc CG_TaskRetrieve_f 8 8
+proc CG_TaskEscort_f 8 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $241
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $209
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $240
+endproc CG_TaskEscort_f 8 8
+proc CG_TaskOwnFlag_f 4 8
+ADDRGP4 $227
+ARGP4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $242
+endproc CG_TaskOwnFlag_f 4 8
+proc CG_TauntKillInsult_f 0 8
+CNSTI4 0
+ARGI4
+ADDRGP4 $245
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $244
+endproc CG_TauntKillInsult_f 0 8
+proc CG_TauntPraise_f 0 8
+CNSTI4 0
+ARGI4
+ADDRGP4 $247
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $246
+endproc CG_TauntPraise_f 0 8
+proc CG_TauntTaunt_f 0 8
+CNSTI4 0
+ARGI4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $248
+endproc CG_TauntTaunt_f 0 8
+proc CG_TauntDeathInsult_f 0 8
+CNSTI4 0
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $250
+endproc CG_TauntDeathInsult_f 0 8
+proc CG_TauntGauntlet_f 0 8
+CNSTI4 0
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $252
+endproc CG_TauntGauntlet_f 0 8
+proc CG_TaskSuicide_f 136 16
+ADDRLP4 132
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $255
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $254
+endproc CG_TaskSuicide_f 136 16
+proc CG_StartOrbit_f 1028 12
+ADDRGP4 $259
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $260
+ADDRGP4 $258
+JUMPV
+LABELV $260
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+CNSTF4 0
+EQF4 $262
+ADDRGP4 $144
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $145
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRGP4 $144
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $145
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $263
+LABELV $258
+endproc CG_StartOrbit_f 1028 12
+export CG_GenerateTracemap
+proc CG_GenerateTracemap 8 16
+ADDRGP4 cg+130280
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRGP4 $269
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $265
+JUMPV
+LABELV $266
+ADDRLP4 0
+ADDRGP4 CG_Trace
+ASGNP4
+ADDRLP4 0+4
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRGP4 cgs+60172
+ARGP4
+ADDRGP4 cg+130264
+ARGP4
+ADDRGP4 cg+130272
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_GenerateTracemap
+CALLV
+pop
+LABELV $265
+endproc CG_GenerateTracemap 8 16
+data
+align 4
+LABELV commands
+address $275
+address CG_TestGun_f
+address $276
+address CG_TestModel_f
+address $277
+address CG_TestModelNextFrame_f
+address $278
+address CG_TestModelPrevFrame_f
+address $279
+address CG_TestModelNextSkin_f
+address $280
+address CG_TestModelPrevSkin_f
+address $281
+address CG_Viewpos_f
+address $282
+address CG_ScoresDown_f
+address $283
+address CG_ScoresUp_f
+address $284
+address CG_ZoomDown_f
+address $285
+address CG_ZoomUp_f
+address $286
+address CG_SizeUp_f
+address $287
+address CG_SizeDown_f
+address $288
+address CG_NextWeapon_f
+address $289
+address CG_PrevWeapon_f
+address $290
+address CG_Weapon_f
+address $291
+address CG_TargetCommand_f
+address $292
+address CG_TellTarget_f
+address $293
+address CG_TellAttacker_f
+address $294
+address CG_VoiceTellTarget_f
+address $295
+address CG_VoiceTellAttacker_f
+address $296
+address CG_LoadHud_f
+address $297
+address CG_NextTeamMember_f
+address $298
+address CG_PrevTeamMember_f
+address $299
+address CG_NextOrder_f
+address $300
+address CG_ConfirmOrder_f
+address $301
+address CG_DenyOrder_f
+address $302
+address CG_TaskOffense_f
+address $303
+address CG_TaskDefense_f
+address $304
+address CG_TaskPatrol_f
+address $305
+address CG_TaskCamp_f
+address $306
+address CG_TaskFollow_f
+address $307
+address CG_TaskRetrieve_f
+address $308
+address CG_TaskEscort_f
+address $309
+address CG_TaskSuicide_f
+address $310
+address CG_TaskOwnFlag_f
+address $311
+address CG_TauntKillInsult_f
+address $312
+address CG_TauntPraise_f
+address $313
+address CG_TauntTaunt_f
+address $314
+address CG_TauntDeathInsult_f
+address $315
+address CG_TauntGauntlet_f
+address $316
+address CG_spWin_f
+address $317
+address CG_spLose_f
+address $318
+address CG_scrollScoresDown_f
+address $319
+address CG_scrollScoresUp_f
+address $320
+address CG_StartOrbit_f
+address $321
+address CG_LoadDeferredPlayers
+address $322
+address CG_GenerateTracemap
+export CG_ConsoleCommand
+code
+proc CG_ConsoleCommand 16 8
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $324
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $328
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $328
+LABELV $325
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 48
+LTU4 $324
+CNSTI4 0
+RETI4
+LABELV $323
+endproc CG_ConsoleCommand 16 8
+export CG_InitConsoleCommands
+proc CG_InitConsoleCommands 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $332
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $333
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $335
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 48
+LTU4 $332
+ADDRGP4 $336
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $337
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $338
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $339
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $340
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $341
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $342
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $343
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $344
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $345
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $346
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $347
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $348
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $349
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $350
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $351
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $352
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $353
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $354
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $355
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $356
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $357
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $358
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $359
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $360
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $361
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $362
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $363
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $364
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $331
+endproc CG_InitConsoleCommands 4 4
+import menuScoreboard
+import trap_PC_FreeSource
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Menu_FindItemByName
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $364
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $363
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $362
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $361
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $360
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $359
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $358
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $357
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $356
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $355
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $354
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $353
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $352
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $351
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $350
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $349
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $348
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $347
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $346
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $345
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $344
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $343
+byte 1 118
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $342
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $341
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $340
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $339
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $338
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $337
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $336
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $322
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $321
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $320
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $319
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $318
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $317
+byte 1 115
+byte 1 112
+byte 1 76
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $316
+byte 1 115
+byte 1 112
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $315
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $314
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $313
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $312
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $311
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $310
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $309
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $308
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 69
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $307
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $306
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $305
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $304
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $303
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $302
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $301
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 121
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $299
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $298
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $297
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $296
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $295
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $294
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $293
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $292
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $291
+byte 1 116
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $290
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $289
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $288
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $287
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $286
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $285
+byte 1 45
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $284
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $283
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $282
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $281
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $280
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $279
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $278
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $277
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $275
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $269
+byte 1 78
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $259
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $257
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $253
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $251
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $249
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $247
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $245
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $243
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $241
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $239
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $237
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $235
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $233
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $231
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $229
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $228
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $215
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 54
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 54
+byte 1 0
+align 1
+LABELV $214
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $209
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $204
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 0
+align 1
+LABELV $203
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $158
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $154
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 76
+byte 1 79
+byte 1 83
+byte 1 69
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $150
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 87
+byte 1 73
+byte 1 78
+byte 1 33
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $134
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $131
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $116
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $98
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $93
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $91
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
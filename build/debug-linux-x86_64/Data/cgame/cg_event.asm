@@ -0,0 +1,13392 @@
+bss
+align 1
+LABELV $80
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $81
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $83
+ASGNP4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 4
+ADDRGP4 $84
+ASGNP4
+LABELV $82
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $85
+ADDRLP4 0
+ADDRGP4 $87
+ASGNP4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $88
+ADDRLP4 0
+ADDRGP4 $90
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $91
+ADDRLP4 0
+ADDRGP4 $93
+ASGNP4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $94
+ADDRLP4 0
+ADDRGP4 $96
+ASGNP4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $97
+ADDRLP4 0
+ADDRGP4 $99
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $100
+ADDRLP4 0
+ADDRGP4 $102
+ASGNP4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $103
+ADDRGP4 $105
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $106
+ADDRGP4 $108
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $109
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRGP4 $112
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $110
+LABELV $107
+LABELV $104
+LABELV $101
+LABELV $98
+LABELV $95
+LABELV $92
+LABELV $89
+LABELV $86
+ADDRGP4 $80
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $113
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $80
+RETP4
+LABELV $79
+endproc CG_PlaceString 12 20
+proc CG_Obituary 128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $117
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $115
+LABELV $117
+ADDRGP4 $118
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $115
+ADDRLP4 44
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $120
+ADDRGP4 $114
+JUMPV
+LABELV $120
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $122
+LABELV $124
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 1022
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 48
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+LABELV $123
+ADDRLP4 92
+ADDRLP4 44
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $126
+ADDRLP4 96
+ADDRLP4 48
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $126
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 88
+ADDRGP4 $84
+ASGNP4
+ADDRLP4 52
+INDIRI4
+CNSTI4 19
+LTI4 $129
+ADDRLP4 52
+INDIRI4
+CNSTI4 27
+GTI4 $129
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $147-76
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $147
+address $131
+address $133
+address $135
+address $137
+address $129
+address $139
+address $141
+address $143
+address $145
+code
+LABELV $131
+ADDRLP4 40
+ADDRGP4 $132
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $133
+ADDRLP4 40
+ADDRGP4 $134
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $135
+ADDRLP4 40
+ADDRGP4 $136
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $137
+ADDRLP4 40
+ADDRGP4 $138
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $139
+ADDRLP4 40
+ADDRGP4 $140
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $141
+ADDRLP4 40
+ADDRGP4 $142
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $143
+ADDRLP4 40
+ADDRGP4 $144
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $145
+ADDRLP4 40
+ADDRGP4 $146
+ASGNP4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+LABELV $130
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $149
+ADDRLP4 52
+INDIRI4
+CNSTI4 5
+LTI4 $151
+ADDRLP4 52
+INDIRI4
+CNSTI4 17
+GTI4 $151
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $204-20
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $204
+address $153
+address $161
+address $151
+address $169
+address $151
+address $177
+address $151
+address $151
+address $151
+address $185
+address $151
+address $193
+address $195
+code
+LABELV $153
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+NEI4 $154
+ADDRLP4 40
+ADDRGP4 $156
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $154
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $157
+ADDRLP4 40
+ADDRGP4 $159
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $157
+ADDRLP4 40
+ADDRGP4 $160
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $161
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+NEI4 $162
+ADDRLP4 40
+ADDRGP4 $164
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $162
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $165
+ADDRLP4 40
+ADDRGP4 $167
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $165
+ADDRLP4 40
+ADDRGP4 $168
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $169
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+NEI4 $170
+ADDRLP4 40
+ADDRGP4 $172
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $170
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $173
+ADDRLP4 40
+ADDRGP4 $175
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $173
+ADDRLP4 40
+ADDRGP4 $176
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $177
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+NEI4 $178
+ADDRLP4 40
+ADDRGP4 $180
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $178
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $181
+ADDRLP4 40
+ADDRGP4 $183
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $181
+ADDRLP4 40
+ADDRGP4 $184
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $185
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+NEI4 $186
+ADDRLP4 40
+ADDRGP4 $188
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $186
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $189
+ADDRLP4 40
+ADDRGP4 $191
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $189
+ADDRLP4 40
+ADDRGP4 $192
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $193
+ADDRLP4 40
+ADDRGP4 $194
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $195
+ADDRLP4 40
+ADDRGP4 $196
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+NEI4 $197
+ADDRLP4 40
+ADDRGP4 $199
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $197
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $200
+ADDRLP4 40
+ADDRGP4 $202
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $200
+ADDRLP4 40
+ADDRGP4 $203
+ASGNP4
+LABELV $152
+LABELV $149
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $206
+ADDRGP4 $208
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $209
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+GEI4 $212
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRGP4 $218
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 120
+INDIRP4
+ASGNP4
+LABELV $213
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_singlePlayer+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $223
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $219
+LABELV $223
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $219
+LABELV $209
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $224
+ADDRLP4 0
+CNSTI4 1022
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 56
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $227
+ADDRGP4 cg+134980
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $227
+LABELV $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 1022
+EQI4 $232
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $234
+ADDRLP4 52
+INDIRI4
+CNSTI4 23
+GTI4 $234
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $289
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $289
+address $236
+address $241
+address $243
+address $246
+address $248
+address $250
+address $253
+address $256
+address $256
+address $259
+address $262
+address $264
+address $266
+address $268
+address $268
+address $271
+address $274
+address $276
+address $279
+address $234
+address $234
+address $234
+address $234
+address $282
+code
+LABELV $236
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $237
+ADDRLP4 96
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $237
+ADDRLP4 40
+ADDRGP4 $239
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $237
+ADDRLP4 40
+ADDRGP4 $240
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $241
+ADDRLP4 40
+ADDRGP4 $242
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $243
+ADDRLP4 40
+ADDRGP4 $244
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $245
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $246
+ADDRLP4 40
+ADDRGP4 $247
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $248
+ADDRLP4 40
+ADDRGP4 $249
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $250
+ADDRLP4 40
+ADDRGP4 $251
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $252
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $253
+ADDRLP4 40
+ADDRGP4 $254
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $255
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $256
+ADDRLP4 40
+ADDRGP4 $257
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $258
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $259
+ADDRLP4 40
+ADDRGP4 $260
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $261
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $262
+ADDRLP4 40
+ADDRGP4 $263
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $261
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $264
+ADDRLP4 40
+ADDRGP4 $265
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $266
+ADDRLP4 40
+ADDRGP4 $267
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $268
+ADDRLP4 40
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $270
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $271
+ADDRLP4 40
+ADDRGP4 $272
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $273
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $274
+ADDRLP4 40
+ADDRGP4 $275
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $273
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $276
+ADDRLP4 40
+ADDRGP4 $277
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $278
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $279
+ADDRLP4 40
+ADDRGP4 $280
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $281
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $282
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $283
+ADDRLP4 40
+ADDRGP4 $285
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $286
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $283
+ADDRLP4 40
+ADDRGP4 $287
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $84
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 40
+ADDRGP4 $288
+ASGNP4
+LABELV $235
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $290
+ADDRGP4 $292
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $290
+LABELV $232
+ADDRGP4 $293
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $114
+endproc CG_Obituary 128 20
+proc CG_UseItem 32 20
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 105
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $297
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $295
+LABELV $297
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $295
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $298
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRGP4 $303
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $304
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $302
+LABELV $298
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $310
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $306
+ADDRGP4 $305
+JUMPV
+LABELV $305
+LABELV $307
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 cgs+5042112+23984
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $310
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $311
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+GEI4 $311
+ADDRLP4 16
+CNSTI4 6112
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $311
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 cgs+5042112+23968
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $306
+LABELV $294
+endproc CG_UseItem 32 20
+proc CG_ItemPickup 0 0
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $319
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 0
+EQI4 $322
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $322
+ADDRGP4 cg+145216
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125084
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $322
+LABELV $319
+LABELV $318
+endproc CG_ItemPickup 0 0
+export CG_WaterLevel
+proc CG_WaterLevel 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $333
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $331
+LABELV $333
+ADDRLP4 24
+CNSTI4 20
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 24
+CNSTI4 40
+ASGNI4
+LABELV $332
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $336
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 1056964608
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $339
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+LABELV $342
+LABELV $339
+LABELV $336
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $330
+endproc CG_WaterLevel 56 8
+export CG_PainEvent
+proc CG_PainEvent 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $345
+ADDRGP4 $344
+JUMPV
+LABELV $345
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $348
+ADDRLP4 0
+ADDRGP4 $350
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $351
+ADDRLP4 0
+ADDRGP4 $353
+ASGNP4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $354
+ADDRLP4 0
+ADDRGP4 $356
+ASGNP4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 0
+ADDRGP4 $357
+ASGNP4
+LABELV $355
+LABELV $352
+LABELV $349
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $358
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $360
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $359
+JUMPV
+LABELV $360
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $363
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $344
+endproc CG_PainEvent 16 20
+lit
+align 4
+LABELV $797
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_EntityEvent
+code
+proc CG_EntityEvent 268 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRGP4 $369
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $366
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $365
+ADDRGP4 $375
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $365
+JUMPV
+LABELV $370
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $378
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $376
+LABELV $378
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $376
+ADDRLP4 12
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $380
+ADDRLP4 8
+INDIRI4
+CNSTI4 123
+GTI4 $380
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1729-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1729
+address $382
+address $387
+address $392
+address $397
+address $402
+address $407
+address $446
+address $451
+address $458
+address $465
+address $476
+address $481
+address $486
+address $491
+address $496
+address $505
+address $514
+address $664
+address $672
+address $672
+address $672
+address $681
+address $686
+address $695
+address $702
+address $716
+address $730
+address $744
+address $758
+address $772
+address $786
+address $792
+address $803
+address $810
+address $817
+address $825
+address $832
+address $919
+address $941
+address $930
+address $952
+address $963
+address $974
+address $994
+address $1005
+address $1016
+address $1027
+address $1038
+address $1049
+address $1060
+address $1071
+address $1082
+address $1093
+address $1104
+address $1115
+address $1126
+address $1137
+address $1148
+address $1159
+address $1170
+address $1181
+address $1192
+address $1203
+address $1214
+address $1225
+address $1236
+address $1247
+address $1258
+address $1269
+address $1280
+address $1291
+address $1302
+address $1313
+address $1324
+address $1335
+address $1346
+address $1357
+address $1368
+address $1379
+address $1390
+address $1401
+address $1412
+address $1423
+address $1434
+address $1441
+address $1448
+address $1455
+address $1461
+address $1467
+address $1473
+address $1479
+address $1485
+address $1491
+address $1497
+address $1503
+address $1503
+address $1503
+address $1503
+address $1533
+address $1540
+address $1548
+address $1585
+address $1603
+address $1616
+address $1629
+address $1634
+address $1639
+address $1644
+address $1649
+address $1654
+address $1659
+address $1664
+address $1669
+address $1674
+address $1679
+address $1684
+address $1689
+address $1694
+address $1699
+address $1704
+address $1709
+address $1714
+address $1719
+code
+LABELV $382
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRGP4 $386
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $383
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $387
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRGP4 $391
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $388
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $392
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $393
+ADDRGP4 $396
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $393
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1022
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $397
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRGP4 $401
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $398
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $402
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRGP4 $406
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $403
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $407
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $408
+ADDRGP4 $411
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $412
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+NEI4 $412
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+NEI4 $416
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125184+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+NEI4 $430
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+125184+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $430
+LABELV $417
+LABELV $412
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $381
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $446
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $447
+ADDRGP4 $450
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $447
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $451
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $452
+ADDRGP4 $455
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $452
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24060
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $458
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRGP4 $462
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $459
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24064
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $465
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRGP4 $469
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $466
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $470
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24068
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $470
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24072
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $476
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $477
+ADDRGP4 $480
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 CG_KamikazeEffect
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $481
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRGP4 $485
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ObeliskExplode
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $486
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRGP4 $490
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 CG_ObeliskPain
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $491
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $492
+ADDRGP4 $495
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $492
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $496
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $497
+ADDRGP4 $500
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $497
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+64408
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $501
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+64408
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $501
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $505
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRGP4 $509
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $506
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+64408
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $510
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+64408
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $510
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $514
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $515
+ADDRGP4 $518
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $515
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $381
+ADDRLP4 60
+INDIRI4
+CNSTI4 13
+GTI4 $381
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $663
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $663
+address $522
+address $530
+address $538
+address $548
+address $565
+address $599
+address $633
+address $639
+address $645
+address $648
+address $651
+address $654
+address $657
+address $660
+code
+LABELV $522
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRGP4 cgs+5042112+22868
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $523
+ADDRGP4 cgs+5042112+22872
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $530
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $531
+ADDRGP4 cgs+5042112+22868
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $531
+ADDRGP4 cgs+5042112+22872
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $538
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 cgs+5042112+22880
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRGP4 cgs+5042112+22876
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $540
+ADDRGP4 cgs+5042112+22896
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $548
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $549
+ADDRGP4 cgs+5042112+22880
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22908
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $549
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $556
+ADDRGP4 cgs+5042112+22880
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRGP4 cgs+5042112+22876
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $557
+ADDRGP4 cgs+5042112+22892
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $565
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $570
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $566
+LABELV $570
+ADDRGP4 $381
+JUMPV
+LABELV $566
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $571
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $574
+ADDRGP4 cgs+5042112+22884
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22912
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $574
+ADDRGP4 cgs+5042112+22888
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22900
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $571
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $381
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $588
+ADDRGP4 cgs+5042112+22888
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22916
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $588
+ADDRGP4 cgs+5042112+22884
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22904
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $599
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $604
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $600
+LABELV $604
+ADDRGP4 $381
+JUMPV
+LABELV $600
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $608
+ADDRGP4 cgs+5042112+22884
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22912
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $608
+ADDRGP4 cgs+5042112+22888
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22900
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $605
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $381
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $622
+ADDRGP4 cgs+5042112+22888
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22916
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $622
+ADDRGP4 cgs+5042112+22884
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cgs+5042112+22904
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $633
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $381
+ADDRGP4 cgs+5042112+22928
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $639
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $381
+ADDRGP4 cgs+5042112+22928
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $645
+ADDRGP4 cgs+5042112+22840
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $648
+ADDRGP4 cgs+5042112+22844
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $651
+ADDRGP4 cgs+5042112+22848
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $654
+ADDRGP4 cgs+5042112+22852
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $657
+ADDRGP4 cgs+5042112+22856
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $660
+ADDRGP4 cgs+5042112+23980
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $664
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $665
+ADDRGP4 $668
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $665
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+EQI4 $381
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $672
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $673
+ADDRGP4 $676
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $673
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+NEI4 $677
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $679
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $677
+ADDRGP4 $680
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 19
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $681
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $682
+ADDRGP4 $685
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $682
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $686
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $687
+ADDRGP4 $690
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $687
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $691
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 11
+BANDI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $691
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $695
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $696
+ADDRGP4 $699
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $696
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $702
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRGP4 $706
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $703
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $707
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+NEI4 $381
+ADDRGP4 cg+125076
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+125080
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $716
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $717
+ADDRGP4 $720
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $717
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $721
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+NEI4 $381
+ADDRGP4 cg+125076
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+125080
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $730
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $731
+ADDRGP4 $734
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $731
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $735
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+NEI4 $381
+ADDRGP4 cg+125076
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+125080
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $744
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $745
+ADDRGP4 $748
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $745
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $749
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+NEI4 $381
+ADDRGP4 cg+125076
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+125080
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $758
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $759
+ADDRGP4 $762
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $759
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $763
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+NEI4 $381
+ADDRGP4 cg+125076
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+125080
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $772
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRGP4 $776
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $773
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24208
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+NEI4 $381
+ADDRGP4 cg+125076
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 cg+125080
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $786
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRGP4 $790
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $787
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $791
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $792
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRGP4 $796
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $793
+ADDRLP4 92
+ADDRGP4 $797
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+5042112+22312
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+5042112+24204
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $791
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $803
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $804
+ADDRGP4 $807
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $804
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+CNSTF4 1063675494
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffectDefault
+CALLV
+pop
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+CNSTI4 2
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 104
+INDIRI4
+BANDI4
+ADDRLP4 104
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24128
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $810
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $811
+ADDRGP4 $814
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $811
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffectDefault
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24200
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $817
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $818
+ADDRGP4 $821
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $818
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $381
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $825
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $826
+ADDRGP4 $829
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $826
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24096
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $832
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $833
+ADDRGP4 $836
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $833
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRLP4 12
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+LTI4 $840
+ADDRLP4 108
+INDIRI4
+CNSTI4 18
+GTI4 $840
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $918
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $918
+address $843
+address $846
+address $850
+address $854
+address $858
+address $862
+address $866
+address $870
+address $874
+address $878
+address $882
+address $886
+address $890
+address $894
+address $898
+address $902
+address $906
+address $910
+address $914
+code
+LABELV $840
+LABELV $843
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 2
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 120
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $846
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+CNSTI4 2
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1408
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $850
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 2
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1472
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $854
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1504
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $858
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 2
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 152
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+768
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $862
+ADDRLP4 156
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+CNSTI4 2
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 160
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $866
+ADDRLP4 164
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1600
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $870
+ADDRLP4 172
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+CNSTI4 2
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 176
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1632
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $874
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+832
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $878
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+CNSTI4 2
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 192
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+848
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $882
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 200
+CNSTI4 2
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ARGI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 200
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1728
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $886
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+CNSTI4 2
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 208
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+880
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $890
+ADDRLP4 212
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 216
+CNSTI4 2
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ARGI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1792
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $894
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+CNSTI4 2
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 224
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1824
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $898
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 232
+CNSTI4 2
+ASGNI4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 232
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+928
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $902
+ADDRLP4 236
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 240
+CNSTI4 2
+ASGNI4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 240
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+944
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $906
+ADDRLP4 244
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 248
+CNSTI4 2
+ASGNI4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 248
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1920
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $910
+ADDRLP4 252
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+CNSTI4 2
+ASGNI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 256
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1952
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $914
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+CNSTI4 2
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 264
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1984
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $919
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRGP4 $923
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $920
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+32
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $930
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $931
+ADDRGP4 $934
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $931
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+96
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $941
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $942
+ADDRGP4 $945
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $942
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+64
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $952
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $953
+ADDRGP4 $956
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $953
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+128
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $963
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $964
+ADDRGP4 $967
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $964
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+80
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $974
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $975
+ADDRGP4 $978
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $975
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRLP4 12
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+LTI4 $982
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+GTI4 $982
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $993
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $993
+address $985
+address $989
+address $989
+address $989
+code
+LABELV $982
+LABELV $985
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 2
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 120
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+192
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $989
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+CNSTI4 2
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+1440
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $994
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRGP4 $998
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $995
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1005
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRGP4 $1009
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1006
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+256
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1016
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1017
+ADDRGP4 $1020
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1017
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+144
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1027
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1028
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1028
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+320
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1038
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+ADDRGP4 $1042
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1039
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+176
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1049
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1050
+ADDRGP4 $1053
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1050
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+192
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1060
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1061
+ADDRGP4 $1064
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1061
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+208
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1071
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRGP4 $1075
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1072
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1082
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1083
+ADDRGP4 $1086
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1083
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+480
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1093
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1094
+ADDRGP4 $1097
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1094
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+256
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1104
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1105
+ADDRGP4 $1108
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1105
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+544
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1115
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRGP4 $1119
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1116
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+288
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1126
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1127
+ADDRGP4 $1130
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1127
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+304
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1137
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1138
+ADDRGP4 $1141
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1138
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+320
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1148
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1149
+ADDRGP4 $1152
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1149
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+336
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1159
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1160
+ADDRGP4 $1163
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1160
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+352
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1170
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1171
+ADDRGP4 $1174
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1171
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+736
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1181
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1182
+ADDRGP4 $1185
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1182
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+384
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1192
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1193
+ADDRGP4 $1196
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1193
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+400
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1203
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1204
+ADDRGP4 $1207
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1204
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+416
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1214
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1215
+ADDRGP4 $1218
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1215
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1225
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1226
+ADDRGP4 $1229
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1226
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+448
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1236
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1237
+ADDRGP4 $1240
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1237
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+464
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1247
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1248
+ADDRGP4 $1251
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1248
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+480
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1258
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1259
+ADDRGP4 $1262
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1259
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+496
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1269
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1270
+ADDRGP4 $1273
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1270
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+512
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1280
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1281
+ADDRGP4 $1284
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1281
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1291
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+ADDRGP4 $1295
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1292
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+544
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1302
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1303
+ADDRGP4 $1306
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1303
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+560
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1313
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1314
+ADDRGP4 $1317
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1314
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+576
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1324
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1325
+ADDRGP4 $1328
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1325
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+592
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1335
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1336
+ADDRGP4 $1339
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1336
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1346
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1347
+ADDRGP4 $1350
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1347
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+624
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1357
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1358
+ADDRGP4 $1361
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1358
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+640
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1368
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1369
+ADDRGP4 $1372
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1369
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+656
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1379
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1380
+ADDRGP4 $1383
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1380
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+672
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1390
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1391
+ADDRGP4 $1394
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1391
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+688
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1401
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1402
+ADDRGP4 $1405
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1402
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 7
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24224+2016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1412
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1413
+ADDRGP4 $1416
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1413
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1423
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1424
+ADDRGP4 $1427
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1424
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 112
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+26336+1040
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1434
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1435
+ADDRGP4 $1438
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1435
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24212
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1441
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1442
+ADDRGP4 $1445
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1442
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24216
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1448
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1449
+ADDRGP4 $1452
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1449
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24220
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1455
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1456
+ADDRGP4 $1459
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1456
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1460
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1461
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1462
+ADDRGP4 $1465
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1462
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1466
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1467
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1468
+ADDRGP4 $1471
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1468
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $1472
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1473
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1474
+ADDRGP4 $1477
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1474
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $1478
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1479
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1480
+ADDRGP4 $1483
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1480
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $1484
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1485
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1486
+ADDRGP4 $1489
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1486
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $1490
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1491
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1492
+ADDRGP4 $1495
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1492
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $1496
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1497
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1498
+ADDRGP4 $1501
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1498
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $1502
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1503
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1504
+ADDRGP4 $1507
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1504
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123116+96
+INDIRI4
+EQI4 $1508
+ADDRGP4 $381
+JUMPV
+LABELV $1508
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $1520
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+ADDRLP4 128
+INDIRI4
+NEI4 $1520
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $1520
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $1512
+LABELV $1520
+ADDRGP4 $381
+JUMPV
+LABELV $1512
+ADDRLP4 116
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+125064
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 200
+GEI4 $1523
+ADDRLP4 120
+ADDRGP4 cg+125060
+INDIRF4
+CNSTI4 200
+ADDRLP4 116
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $1524
+JUMPV
+LABELV $1523
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+LABELV $1524
+ADDRLP4 124
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 380
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 cg+125060
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+125060
+INDIRF4
+CNSTF4 1107296256
+LEF4 $1527
+ADDRGP4 cg+125060
+CNSTF4 1107296256
+ASGNF4
+LABELV $1527
+ADDRGP4 cg+125064
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $1533
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1534
+ADDRGP4 $1537
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1534
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffectSmall
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24200
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1540
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1541
+ADDRGP4 $1544
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1541
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 116
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+CNSTF4 1063675494
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffectSmall
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 124
+CNSTI4 2
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 124
+INDIRI4
+BANDI4
+ADDRLP4 124
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+24104
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1548
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1549
+ADDRGP4 $1552
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1549
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+LTI4 $1555
+ADDRLP4 136
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1553
+LABELV $1555
+ADDRGP4 $381
+JUMPV
+LABELV $1553
+ADDRLP4 132
+CNSTI4 48
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 132
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 5
+EQI4 $1558
+ADDRLP4 140
+INDIRI4
+CNSTI4 7
+NEI4 $1556
+LABELV $1558
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+23964
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1557
+JUMPV
+LABELV $1556
+ADDRLP4 132
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1561
+ADDRLP4 144
+ADDRLP4 132
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 4
+LTI4 $1562
+ADDRLP4 144
+INDIRI4
+CNSTI4 7
+GTI4 $1562
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1578-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1578
+address $1566
+address $1569
+address $1572
+address $1575
+code
+LABELV $1566
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24000
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1562
+JUMPV
+LABELV $1569
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24008
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1562
+JUMPV
+LABELV $1572
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24004
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1562
+JUMPV
+LABELV $1575
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+24012
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1562
+JUMPV
+LABELV $1561
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22940
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1562
+LABELV $1557
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $381
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1585
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1586
+ADDRGP4 $1589
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1586
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+LTI4 $1592
+ADDRLP4 132
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1590
+LABELV $1592
+ADDRGP4 $381
+JUMPV
+LABELV $1590
+ADDRGP4 cg+145188
+INDIRI4
+CNSTI4 0
+EQI4 $1593
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+5042112+23964
+INDIRI4
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $1594
+JUMPV
+LABELV $1593
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22940
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedAnnouncerSound
+CALLV
+pop
+LABELV $1594
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $381
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1603
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1604
+ADDRGP4 $1607
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1604
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $1608
+ADDRGP4 cg+145032
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+145036
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $1608
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+5042112+23988
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1616
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1617
+ADDRGP4 $1620
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1617
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $1621
+ADDRGP4 cg+145032
+CNSTI4 3
+ASGNI4
+ADDRGP4 cg+145036
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $1621
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+5042112+23992
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1629
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1630
+ADDRGP4 $1633
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1634
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1635
+ADDRGP4 $1638
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1635
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1639
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1640
+ADDRGP4 $1643
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1640
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1644
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1645
+ADDRGP4 $1648
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1645
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1649
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1650
+ADDRGP4 $1653
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1650
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1654
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1655
+ADDRGP4 $1658
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1655
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1659
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1660
+ADDRGP4 $1663
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1660
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1664
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1665
+ADDRGP4 $1668
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1669
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1670
+ADDRGP4 $1673
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1670
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1674
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1675
+ADDRGP4 $1678
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1675
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1679
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1680
+ADDRGP4 $1683
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1680
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1684
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1685
+ADDRGP4 $1688
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1685
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1689
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1690
+ADDRGP4 $1693
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1694
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1695
+ADDRGP4 $1698
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1695
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1699
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1700
+ADDRGP4 $1703
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1704
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1705
+ADDRGP4 $1708
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1705
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1709
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1710
+ADDRGP4 $1713
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1710
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1714
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1715
+ADDRGP4 $1718
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1715
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $1719
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1720
+ADDRGP4 $1723
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1720
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1724
+ADDRGP4 $1727
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1724
+ADDRGP4 $1728
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $381
+LABELV $365
+endproc CG_EntityEvent 268 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $1732
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1734
+ADDRGP4 $1731
+JUMPV
+LABELV $1734
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1736
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1736
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+SUBI4
+ASGNI4
+ADDRGP4 $1733
+JUMPV
+LABELV $1732
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+NEI4 $1738
+ADDRGP4 $1731
+JUMPV
+LABELV $1738
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $1740
+ADDRGP4 $1731
+JUMPV
+LABELV $1740
+LABELV $1733
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $1731
+endproc CG_CheckEvents 8 12
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1728
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1727
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1723
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1718
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1713
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $1708
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $1703
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $1698
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $1693
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $1688
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $1683
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $1678
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 10
+byte 1 0
+align 1
+LABELV $1673
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 10
+byte 1 0
+align 1
+LABELV $1668
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $1663
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 10
+byte 1 0
+align 1
+LABELV $1658
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $1653
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $1648
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $1643
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $1638
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $1633
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $1620
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1607
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1589
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1552
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1544
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1537
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1507
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1502
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $1501
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1496
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1495
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 66
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1490
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1489
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $1484
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1483
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 77
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1478
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $1477
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $1472
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1471
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $1466
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1465
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1460
+byte 1 42
+byte 1 103
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1459
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1452
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1445
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1438
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1427
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $1416
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1405
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1394
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 10
+byte 1 0
+align 1
+LABELV $1383
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $1372
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 87
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1361
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 82
+byte 1 73
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $1350
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $1339
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $1328
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 70
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1317
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $1306
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 79
+byte 1 70
+byte 1 10
+byte 1 0
+align 1
+LABELV $1295
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 75
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $1284
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1273
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1262
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1251
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $1240
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 70
+byte 1 82
+byte 1 79
+byte 1 90
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1229
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 87
+byte 1 79
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $1218
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 70
+byte 1 69
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1207
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1196
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 68
+byte 1 85
+byte 1 67
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1185
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $1174
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $1163
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1152
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1141
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $1130
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 70
+byte 1 82
+byte 1 79
+byte 1 90
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1119
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 72
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $1108
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1097
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $1086
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 85
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1075
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1064
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1053
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 85
+byte 1 66
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1042
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1031
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 83
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1020
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 79
+byte 1 78
+byte 1 71
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 85
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1009
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 79
+byte 1 78
+byte 1 71
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $998
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $978
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $967
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $956
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 68
+byte 1 68
+byte 1 76
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $945
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 10
+byte 1 0
+align 1
+LABELV $934
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $923
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 95
+byte 1 70
+byte 1 82
+byte 1 79
+byte 1 90
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $836
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $829
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $821
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $814
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $807
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $796
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $791
+byte 1 42
+byte 1 106
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $790
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $776
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $763
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $762
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 77
+byte 1 71
+byte 1 95
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $749
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $748
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 77
+byte 1 71
+byte 1 95
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $735
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $734
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 77
+byte 1 71
+byte 1 95
+byte 1 49
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $721
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 52
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $720
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 77
+byte 1 71
+byte 1 95
+byte 1 50
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $707
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 53
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $706
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 77
+byte 1 71
+byte 1 95
+byte 1 53
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $700
+byte 1 42
+byte 1 100
+byte 1 102
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $699
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 73
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $690
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $685
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $680
+byte 1 42
+byte 1 100
+byte 1 100
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $679
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $676
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $668
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $518
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $509
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $500
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $495
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $490
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $485
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $480
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $469
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $462
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $455
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 10
+byte 1 0
+align 1
+LABELV $450
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $411
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $406
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $401
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $396
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $391
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $386
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $375
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $369
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $363
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $362
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $357
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $356
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $353
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $350
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 52
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $304
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $303
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $293
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $292
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $288
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $287
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $286
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 0
+align 1
+LABELV $285
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $281
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $280
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $278
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $277
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $275
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $273
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $272
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $270
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $269
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $267
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $265
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $263
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $261
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $260
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $258
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $257
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $255
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $254
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $252
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $251
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $249
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $247
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $245
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $244
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $242
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $240
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $239
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $226
+byte 1 78
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $218
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $215
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $208
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $203
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $202
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $199
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $196
+byte 1 103
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $194
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $192
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $191
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $188
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $184
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $183
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $180
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $176
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $175
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $172
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $168
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $167
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $164
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $160
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $159
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $156
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $142
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $140
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $138
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $136
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $134
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $132
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $128
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $118
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $113
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $112
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $111
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $105
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $102
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $99
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $96
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $93
+byte 1 94
+byte 1 51
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $90
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $87
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $84
+byte 1 0
+align 1
+LABELV $83
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
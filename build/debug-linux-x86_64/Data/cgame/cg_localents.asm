@@ -0,0 +1,6179 @@
+export CG_InitLocalEntities
+code
+proc CG_InitLocalEntities 12 12
+ADDRGP4 cg_localEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 671744
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_activeLocalEntities+4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRGP4 cg_localEntities
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $81
+ADDRLP4 8
+CNSTI4 328
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+328
+ADDP4
+ASGNP4
+LABELV $82
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2047
+LTI4 $81
+LABELV $79
+endproc CG_InitLocalEntities 12 12
+export CG_FreeLocalEntity
+proc CG_FreeLocalEntity 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $88
+ADDRGP4 $90
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $88
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $87
+endproc CG_FreeLocalEntity 12 4
+export CG_AllocLocalEntity
+proc CG_AllocLocalEntity 12 12
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $92
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $92
+ADDRLP4 4
+ADDRGP4 cg_freeLocalEntities
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 328
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $91
+endproc CG_AllocLocalEntity 12 12
+export CG_BloodTrail
+proc CG_BloodTrail 44 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+123080
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTF4 1157234688
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 cgs+5042112+22328
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $102
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $104
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $101
+LABELV $97
+endproc CG_BloodTrail 44 48
+export CG_FragmentBounceMark
+proc CG_FragmentBounceMark 20 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $108
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+5042112+22412
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $112
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+5042112+22420
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $112
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $107
+endproc CG_FragmentBounceMark 20 44
+export CG_FragmentBounceSound
+proc CG_FragmentBounceSound 16 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $117
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $118
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRLP4 8
+ADDRGP4 cgs+5042112+24188
+INDIRI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $125
+ADDRLP4 8
+ADDRGP4 cgs+5042112+24192
+INDIRI4
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRLP4 8
+ADDRGP4 cgs+5042112+24196
+INDIRI4
+ASGNI4
+LABELV $126
+LABELV $122
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $131
+LABELV $131
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $116
+endproc CG_FragmentBounceSound 16 20
+export CG_ReflectVelocity
+proc CG_ReflectVelocity 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRLP4 16
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+123080
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+123080
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $148
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $144
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1109393408
+LTF4 $148
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+123080
+INDIRI4
+NEGI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+GEF4 $144
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $144
+LABELV $145
+LABELV $133
+endproc CG_ReflectVelocity 56 12
+proc CG_AddFragment 204 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $150
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1000
+GEI4 $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 172
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+CNSTF4 1065353216
+ADDRLP4 164
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRGP4 $149
+JUMPV
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $150
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2000
+ADDI4
+GEI4 $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 176
+CNSTP4 0
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $162
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDRLP4 80
+INDIRB
+ASGNB 12
+ADDRLP4 180
+CNSTF4 0
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+EQI4 $170
+ADDRLP4 184
+INDIRI4
+CNSTI4 4
+EQI4 $172
+ADDRGP4 $168
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $168
+JUMPV
+LABELV $172
+ADDRLP4 68+4
+CNSTI4 360
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 360
+ASGNI4
+ADDRLP4 196
+CNSTI4 2047
+ASGNI4
+ADDRLP4 200
+CNSTF4 1157627904
+ASGNF4
+ADDRLP4 68
+ADDRLP4 192
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 196
+INDIRI4
+BANDI4
+MULI4
+CVIF4 4
+ADDRLP4 200
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 192
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 196
+INDIRI4
+BANDI4
+MULI4
+CVIF4 4
+ADDRLP4 200
+INDIRF4
+DIVF4
+CNSTF4 1131413504
+ADDF4
+ASGNF4
+LABELV $168
+ADDRLP4 68
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_BloodTrail
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $162
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $180
+CNSTI4 816
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $180
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $184
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 180
+CNSTF4 0
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRLP4 92
+ADDRLP4 56
+INDIRF4
+ADDRLP4 80
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 92+4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 192
+CNSTP4 0
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $203
+ADDRLP4 0
+ADDRLP4 108
+INDIRB
+ASGNB 56
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $203
+LABELV $180
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceMark
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ReflectVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $149
+endproc CG_AddFragment 204 28
+proc CG_AddFadeRGB 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $211
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $214
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 125
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $217
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $218
+ADDRLP4 0
+INDIRP4
+CNSTI4 126
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $220
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $221
+ADDRLP4 0
+INDIRP4
+CNSTI4 127
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $208
+endproc CG_AddFadeRGB 60 4
+proc CG_AddMoveScaleFade 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $223
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $223
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $224
+ADDRLP4 36
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $229
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $230
+ADDRLP4 0
+INDIRP4
+CNSTI4 127
+ADDP4
+ADDRLP4 32
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $231
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+GEF4 $244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $222
+JUMPV
+LABELV $244
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $222
+endproc CG_AddMoveScaleFade 56 12
+proc CG_EmitPolyVerts 176 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $247
+ADDRLP4 132
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 100
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 100+4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 100+8
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 124
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 100
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 100+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 100+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+NEGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 112+4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 112+8
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 112
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 112+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 112+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 100
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100+4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100+8
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112+4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 112+8
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $248
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+ADDF4
+ADDRLP4 112+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+ADDF4
+ADDRLP4 112+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+SUBF4
+ADDRLP4 112+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+SUBF4
+ADDRLP4 112+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+48
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+SUBF4
+ADDRLP4 112+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+SUBF4
+ADDRLP4 112+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+ADDF4
+ADDRLP4 112+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+ADDF4
+ADDRLP4 112+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $382
+CNSTI4 24
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0+20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0+20+1
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 125
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0+20+2
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 126
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0+20+3
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 127
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $383
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 4
+LTI4 $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $246
+endproc CG_EmitPolyVerts 176 20
+proc CG_AddScaleFade 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $396
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CNSTI4 127
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+GEF4 $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $393
+JUMPV
+LABELV $408
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_EmitPolyVerts
+CALLV
+pop
+LABELV $393
+endproc CG_AddScaleFade 52 4
+proc CG_AddFallScaleFade 56 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $413
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $414
+ADDRLP4 0
+INDIRP4
+CNSTI4 127
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+GEF4 $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $410
+JUMPV
+LABELV $425
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_EmitPolyVerts
+CALLV
+pop
+LABELV $410
+endproc CG_AddFallScaleFade 56 4
+proc CG_AddExplosion 28 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $428
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $431
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 0
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $432
+ADDRGP4 cg_fadeExplosions+12
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $428
+LABELV $427
+endproc CG_AddExplosion 28 28
+proc CG_AddSpriteExplosion 220 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRB
+ASGNB 172
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 192
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 192
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 1065353216
+LEF4 $438
+ADDRLP4 172
+CNSTF4 1065353216
+ASGNF4
+LABELV $438
+ADDRLP4 0+124
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 200
+CNSTF4 1051260355
+CNSTF4 1132396544
+ADDRLP4 172
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LTF4 $448
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $449
+ADDRLP4 0+124+3
+ADDRLP4 196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+152
+CNSTF4 1109917696
+CNSTF4 1065353216
+ADDRLP4 172
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $451
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 212
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 212
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1056964608
+GEF4 $454
+ADDRLP4 176
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 176
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 176
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $455
+ADDRGP4 cg_fadeExplosions+12
+INDIRI4
+CNSTI4 0
+EQI4 $456
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1065353216
+ASGNF4
+LABELV $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRLP4 184
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $451
+LABELV $436
+endproc CG_AddSpriteExplosion 220 28
+export CG_AddKamikaze
+proc CG_AddKamikaze 316 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 216
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 236
+CNSTF4 0
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+LEI4 $463
+ADDRLP4 216
+INDIRI4
+CNSTI4 2000
+GEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $465
+ADDRGP4 cgs+5042112+23972
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ADDRLP4 244
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $465
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+ADDRGP4 cgs+5042112+22516
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+136
+ADDRLP4 212
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+68
+ADDRLP4 212
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 216
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ASGNF4
+ADDRLP4 4+28
+ADDRLP4 176
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+4
+ADDRLP4 176+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12
+ADDRLP4 176+12
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+4
+ADDRLP4 176+12+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+8
+ADDRLP4 176+12+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24
+ADDRLP4 176+24
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+4
+ADDRLP4 176+24+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+8
+ADDRLP4 176+24+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 1500
+LEI4 $508
+ADDRLP4 0
+ADDRLP4 216
+INDIRI4
+CNSTI4 1500
+SUBI4
+CVIF4 4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $509
+ADDRLP4 248
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 0
+ADDRLP4 248
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 248
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LTF4 $512
+ADDRLP4 244
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 244
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $513
+ADDRLP4 4+124
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 264
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+LTF4 $517
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $518
+JUMPV
+LABELV $517
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $518
+ADDRLP4 4+124+1
+ADDRLP4 260
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 276
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+LTF4 $522
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $523
+JUMPV
+LABELV $522
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $523
+ADDRLP4 4+124+2
+ADDRLP4 272
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 288
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 292
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+LTF4 $527
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $528
+ADDRLP4 4+124+3
+ADDRLP4 284
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $463
+ADDRLP4 216
+INDIRI4
+CNSTI4 250
+LEI4 $529
+ADDRLP4 216
+INDIRI4
+CNSTI4 2250
+GEI4 $529
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+LTF4 $533
+ADDRLP4 248
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRLP4 248
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $534
+ADDRLP4 212
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 248
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $536
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $537
+ADDRLP4 212
+INDIRP4
+CNSTI4 125
+ADDP4
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+LTF4 $539
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $540
+ADDRLP4 212
+INDIRP4
+CNSTI4 126
+ADDP4
+ADDRLP4 276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $542
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $543
+ADDRLP4 212
+INDIRP4
+CNSTI4 127
+ADDP4
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 216
+INDIRI4
+CNSTI4 2000
+GEI4 $544
+ADDRLP4 0
+ADDRLP4 216
+INDIRI4
+CNSTI4 250
+SUBI4
+CVIF4 4
+CNSTF4 1155186688
+DIVF4
+ASGNF4
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $546
+ADDRGP4 cgs+5042112+23976
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $546
+ADDRLP4 0
+CNSTI4 2250
+ADDRLP4 216
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+LABELV $545
+ADDRLP4 212
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 176+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 176+12
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 176+12+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 176+12+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 176+24
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 176+24+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 176+24+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 212
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 212
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 304
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ARGF4
+ADDRLP4 304
+INDIRF4
+ARGF4
+ADDRLP4 304
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $529
+ADDRLP4 216
+INDIRI4
+CNSTI4 2000
+LEI4 $562
+ADDRLP4 216
+INDIRI4
+CNSTI4 3000
+GEI4 $562
+ADDRLP4 256
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+NEF4 $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+NEF4 $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+NEF4 $564
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 264
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 264
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+LABELV $564
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+ADDRGP4 cgs+5042112+22516
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+136
+ADDRLP4 212
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+68
+ADDRLP4 212
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 220+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 220+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 216
+INDIRI4
+CNSTI4 2000
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4+28
+ADDRLP4 176
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+4
+ADDRLP4 176+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12
+ADDRLP4 176+12
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+4
+ADDRLP4 176+12+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+8
+ADDRLP4 176+12+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24
+ADDRLP4 176+24
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+4
+ADDRLP4 176+24+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+8
+ADDRLP4 176+24+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 2500
+LEI4 $607
+ADDRLP4 0
+ADDRLP4 216
+INDIRI4
+CNSTI4 2500
+SUBI4
+CVIF4 4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRGP4 $608
+JUMPV
+LABELV $607
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $608
+ADDRLP4 268
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 0
+ADDRLP4 268
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 268
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 276
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+LTF4 $611
+ADDRLP4 264
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 264
+ADDRLP4 272
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $612
+ADDRLP4 4+124
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 284
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 284
+INDIRF4
+ADDRLP4 288
+INDIRF4
+LTF4 $616
+ADDRLP4 280
+ADDRLP4 284
+INDIRF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $617
+JUMPV
+LABELV $616
+ADDRLP4 280
+ADDRLP4 284
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $617
+ADDRLP4 4+124+1
+ADDRLP4 280
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 296
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 300
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+LTF4 $621
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 292
+ADDRLP4 296
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $622
+ADDRLP4 4+124+2
+ADDRLP4 292
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 308
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+LTF4 $626
+ADDRLP4 304
+ADDRLP4 308
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 304
+ADDRLP4 308
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $627
+ADDRLP4 4+124+3
+ADDRLP4 304
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $562
+LABELV $459
+endproc CG_AddKamikaze 316 28
+proc CG_AddRefEntity 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+GEI4 $629
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $628
+JUMPV
+LABELV $629
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $628
+endproc CG_AddRefEntity 0 4
+lit
+align 4
+LABELV $633
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_AddScorePlum
+code
+proc CG_AddScorePlum 160 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $633
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $635
+ADDRLP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 125
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 126
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRGP4 $636
+JUMPV
+LABELV $635
+ADDRLP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 125
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 126
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+LTI4 $637
+ADDRLP4 8
+INDIRP4
+CNSTI4 125
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $638
+JUMPV
+LABELV $637
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+LTI4 $639
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 125
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LTI4 $641
+ADDRLP4 8
+INDIRP4
+CNSTI4 126
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $642
+JUMPV
+LABELV $641
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $643
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 126
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+LABELV $643
+LABELV $642
+LABELV $640
+LABELV $638
+LABELV $636
+ADDRLP4 80
+INDIRF4
+CNSTF4 1048576000
+GEF4 $645
+ADDRLP4 136
+CNSTF4 1149173760
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $648
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $649
+ADDRLP4 8
+INDIRP4
+CNSTI4 127
+ADDP4
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRLP4 8
+INDIRP4
+CNSTI4 127
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $646
+ADDRLP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1121714176
+CNSTF4 1120403456
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 132
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 136
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 140
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1137180672
+GEF4 $681
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $681
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 148
+INDIRI4
+GEI4 $683
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $683
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $688
+JUMPV
+LABELV $685
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $686
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $688
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $685
+ADDRLP4 12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $685
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $689
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 cgs+5042112+22340
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $692
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $694
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $691
+LABELV $632
+endproc CG_AddScorePlum 160 12
+export CG_BubbleThink
+proc CG_BubbleThink 80 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 16+12
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $701
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddMoveScaleFade
+CALLV
+pop
+LABELV $701
+endproc CG_BubbleThink 80 28
+export CG_AddLocalEntities
+proc CG_AddLocalEntities 24 8
+ADDRLP4 8
+ADDRGP4 cg+123092
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123092
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $713
+JUMPV
+LABELV $710
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $714
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $711
+JUMPV
+LABELV $714
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $717
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+GTI4 $717
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $733
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $733
+address $721
+address $722
+address $723
+address $718
+address $725
+address $726
+address $727
+address $728
+address $729
+address $730
+address $731
+address $732
+code
+LABELV $717
+ADDRGP4 $720
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $721
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddSpriteExplosion
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $722
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddExplosion
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $723
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddKamikaze
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $725
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFragment
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $726
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScaleFade
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $727
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFadeRGB
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $728
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFallScaleFade
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $729
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddMoveScaleFade
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $730
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_BubbleThink
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $731
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScorePlum
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $732
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+LABELV $718
+LABELV $711
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $713
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $710
+ADDRGP4 cg+123092
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $706
+endproc CG_AddLocalEntities 24 8
+bss
+export cg_freeLocalEntities
+align 4
+LABELV cg_freeLocalEntities
+skip 4
+export cg_activeLocalEntities
+align 4
+LABELV cg_activeLocalEntities
+skip 328
+export cg_localEntities
+align 4
+LABELV cg_localEntities
+skip 671744
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $720
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $90
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
@@ -0,0 +1,11930 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+export CG_InitTeamChat
+code
+proc CG_InitTeamChat 0 12
+ADDRGP4 teamChat1
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 teamChat2
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 systemChat
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $88
+endproc CG_InitTeamChat 0 12
+export CG_SetPrintString
+proc CG_SetPrintString 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $90
+ADDRGP4 systemChat
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRGP4 teamChat2
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 teamChat1
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $91
+LABELV $89
+endproc CG_SetPrintString 0 8
+export CG_CheckOrderPending
+proc CG_CheckOrderPending 28 12
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+GEI4 $93
+ADDRGP4 $92
+JUMPV
+LABELV $93
+ADDRGP4 cgs+474988
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cgs+474984
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $99
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+GTI4 $99
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $127-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $127
+address $102
+address $106
+address $110
+address $113
+address $116
+address $120
+address $123
+code
+LABELV $102
+ADDRLP4 8
+ADDRGP4 $103
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $104
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $105
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $106
+ADDRLP4 8
+ADDRGP4 $107
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $108
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $110
+ADDRLP4 8
+ADDRGP4 $111
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $112
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $113
+ADDRLP4 8
+ADDRGP4 $114
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $115
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $116
+ADDRLP4 8
+ADDRGP4 $117
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $118
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $119
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $120
+ADDRLP4 8
+ADDRGP4 $121
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $122
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $123
+ADDRLP4 8
+ADDRGP4 $124
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $125
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $126
+ASGNP4
+LABELV $99
+LABELV $100
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $129
+ADDRGP4 $132
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $133
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $133
+ADDRGP4 $137
+ARGP4
+ADDRGP4 cgs+474984
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $132
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $139
+ADDRGP4 $141
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $139
+LABELV $134
+LABELV $130
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $143
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $143
+ADDRGP4 cgs+474988
+CNSTI4 0
+ASGNI4
+LABELV $96
+LABELV $92
+endproc CG_CheckOrderPending 28 12
+proc CG_SetSelectedPlayerName 4 8
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $147
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $147
+ADDRLP4 0
+CNSTI4 6112
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $148
+ADDRGP4 $155
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $156
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 cgs+474984
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRGP4 $155
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $148
+LABELV $146
+endproc CG_SetSelectedPlayerName 4 8
+export CG_GetSelectedPlayer
+proc CG_GetSelectedPlayer 0 0
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $165
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $161
+LABELV $165
+ADDRGP4 cg_currentSelectedPlayer+12
+CNSTI4 0
+ASGNI4
+LABELV $161
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+RETI4
+LABELV $160
+endproc CG_GetSelectedPlayer 0 0
+export CG_SelectNextPlayer
+proc CG_SelectNextPlayer 4 0
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $169
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $169
+ADDRLP4 0
+ADDRGP4 cg_currentSelectedPlayer+12
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRGP4 cg_currentSelectedPlayer+12
+CNSTI4 0
+ASGNI4
+LABELV $170
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $168
+endproc CG_SelectNextPlayer 4 0
+export CG_SelectPrevPlayer
+proc CG_SelectPrevPlayer 4 0
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LEI4 $176
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GTI4 $176
+ADDRLP4 0
+ADDRGP4 cg_currentSelectedPlayer+12
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $177
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $175
+endproc CG_SelectPrevPlayer 4 0
+proc CG_DrawPlayerArmorIcon 36 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRGP4 $182
+JUMPV
+LABELV $183
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $190
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $186
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $186
+LABELV $190
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22172
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 360
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22168
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $193
+LABELV $187
+LABELV $182
+endproc CG_DrawPlayerArmorIcon 36 32
+proc CG_DrawPlayerArmorValue 32 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $206
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $207
+LABELV $204
+endproc CG_DrawPlayerArmorValue 32 32
+proc CG_DrawPlayerAmmoIcon 52 32
+ADDRLP4 0
+CNSTI4 816
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $215
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $211
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $211
+LABELV $215
+ADDRLP4 32
+ADDRGP4 cg+123116+152
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $212
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $224
+ADDRLP4 32
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $224
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $224
+LABELV $221
+LABELV $212
+LABELV $209
+endproc CG_DrawPlayerAmmoIcon 52 32
+proc CG_DrawPlayerAmmoValue 36 32
+ADDRLP4 0
+CNSTI4 816
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+LEI4 $239
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $242
+LABELV $239
+LABELV $237
+LABELV $234
+endproc CG_DrawPlayerAmmoValue 36 32
+proc CG_DrawPlayerHead 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 cg+145228
+INDIRF4
+CNSTF4 0
+EQF4 $246
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+145228
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $246
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+145228
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1067450368
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1069547520
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+ADDRGP4 cg+145232
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+145260
+CNSTF4 1110704128
+ADDRGP4 cg+145232
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+145248
+CNSTF4 1101004800
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+145244
+CNSTF4 1084227584
+ADDRLP4 60
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+145264
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+145252
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+145252
+INDIRI4
+LTI4 $262
+ADDRGP4 cg+145260
+ADDRGP4 cg+145248
+INDIRF4
+ASGNF4
+ADDRGP4 cg+145256
+ADDRGP4 cg+145244
+INDIRF4
+ASGNF4
+ADDRGP4 cg+145264
+ADDRGP4 cg+145252
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+145252
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+145248
+CNSTF4 1101004800
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+145244
+CNSTF4 1084227584
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+LABELV $262
+LABELV $247
+ADDRGP4 cg+145264
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+LEI4 $276
+ADDRGP4 cg+145264
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $276
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+145264
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+145252
+INDIRI4
+ADDRGP4 cg+145264
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+145260
+INDIRF4
+ADDRGP4 cg+145248
+INDIRF4
+ADDRGP4 cg+145260
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+145256
+INDIRF4
+ADDRGP4 cg+145244
+INDIRF4
+ADDRGP4 cg+145256
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $243
+endproc CG_DrawPlayerHead 68 24
+proc CG_DrawSelectedPlayerHealth 36 32
+ADDRLP4 24
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $296
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $299
+LABELV $296
+LABELV $294
+endproc CG_DrawSelectedPlayerHealth 36 32
+proc CG_DrawSelectedPlayerArmor 36 32
+ADDRLP4 24
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $304
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $307
+LABELV $304
+LABELV $302
+LABELV $300
+endproc CG_DrawSelectedPlayerArmor 36 32
+export CG_StatusHandle
+proc CG_StatusHandle 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $309
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+GTI4 $309
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $331-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $331
+address $311
+address $314
+address $317
+address $320
+address $323
+address $326
+code
+LABELV $311
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22616
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $314
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22628
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $317
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22636
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $320
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22640
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $323
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22624
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $326
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22620
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22612
+INDIRI4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $308
+endproc CG_StatusHandle 8 0
+export CG_NodeHandle
+proc CG_NodeHandle 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $334
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+GTI4 $334
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $365
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $365
+address $336
+address $339
+address $342
+address $345
+address $348
+address $351
+address $354
+address $357
+address $360
+code
+LABELV $336
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22644
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $339
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22648
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $342
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22652
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $345
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22656
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $348
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22660
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $351
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22664
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $354
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22668
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $357
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22672
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $360
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22676
+INDIRI4
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22704
+INDIRI4
+ASGNI4
+LABELV $335
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $333
+endproc CG_NodeHandle 8 0
+export CG_ObstacleHandle
+proc CG_ObstacleHandle 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $367
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GTI4 $367
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $389
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $389
+address $369
+address $372
+address $375
+address $378
+address $381
+address $384
+code
+LABELV $369
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22680
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $372
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22684
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $375
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22688
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $378
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22692
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $381
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22696
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $384
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22700
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 0
+ADDRGP4 cgs+5042112+22704
+INDIRI4
+ASGNI4
+LABELV $368
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $366
+endproc CG_ObstacleHandle 8 0
+proc CG_DrawSelectedPlayerStatus 16 20
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $392
+ADDRGP4 cgs+474988
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+474992
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $397
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $397
+ADDRGP4 $390
+JUMPV
+LABELV $397
+ADDRGP4 cgs+474984
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $395
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $392
+LABELV $390
+endproc CG_DrawSelectedPlayerStatus 16 20
+proc CG_DrawPlayerStatus 16 20
+ADDRLP4 0
+CNSTI4 6112
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $406
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $406
+LABELV $403
+endproc CG_DrawPlayerStatus 16 20
+proc CG_DrawSelectedPlayerName 20 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 4
+ADDRGP4 cgs+474996
+INDIRI4
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $413
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $414
+LABELV $408
+endproc CG_DrawSelectedPlayerName 20 32
+proc CG_DrawSelectedPlayerLocation 24 32
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $418
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $422
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $420
+LABELV $422
+ADDRLP4 8
+ADDRGP4 $423
+ASGNP4
+LABELV $420
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $418
+LABELV $416
+endproc CG_DrawSelectedPlayerLocation 24 32
+proc CG_DrawPlayerLocation 20 32
+ADDRLP4 0
+CNSTI4 6112
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $427
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $431
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $429
+LABELV $431
+ADDRLP4 4
+ADDRGP4 $423
+ASGNP4
+LABELV $429
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $427
+LABELV $424
+endproc CG_DrawPlayerLocation 20 32
+proc CG_DrawSelectedPlayerWeapon 12 20
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $434
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22180
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $437
+LABELV $434
+LABELV $432
+endproc CG_DrawSelectedPlayerWeapon 12 20
+proc CG_DrawPlayerScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $445
+LABELV $442
+endproc CG_DrawPlayerScore 28 32
+proc CG_DrawPlayerItem 36 32
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 4+4
+CNSTI4 360
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $451
+LABELV $448
+LABELV $446
+endproc CG_DrawPlayerItem 36 32
+proc CG_DrawSelectedPlayerPowerup 40 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $462
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $464
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $468
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $470
+ADDRLP4 24
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $460
+JUMPV
+LABELV $470
+LABELV $468
+LABELV $465
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $464
+LABELV $462
+LABELV $460
+endproc CG_DrawSelectedPlayerPowerup 40 20
+proc CG_DrawSelectedPlayerHead 84 32
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $476
+ADDRLP4 60
+ADDRGP4 cgs+474996
+INDIRI4
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 64
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $477
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $478
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRGP4 $472
+JUMPV
+LABELV $483
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $499
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $499
+LABELV $481
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $502
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22180
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $502
+LABELV $478
+LABELV $472
+endproc CG_DrawSelectedPlayerHead 84 32
+proc CG_DrawPlayerHealth 32 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $509
+LABELV $506
+endproc CG_DrawPlayerHealth 32 32
+proc CG_DrawRedScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+63360
+INDIRI4
+CNSTI4 -9999
+NEI4 $511
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $514
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRGP4 cgs+63360
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $512
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $510
+endproc CG_DrawRedScore 28 32
+proc CG_DrawBlueScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+63364
+INDIRI4
+CNSTI4 -9999
+NEI4 $517
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $514
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $518
+JUMPV
+LABELV $517
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRGP4 cgs+63364
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $518
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $516
+endproc CG_DrawBlueScore 28 32
+proc CG_DrawRedName 4 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $521
+endproc CG_DrawRedName 4 32
+proc CG_DrawBlueName 4 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $523
+endproc CG_DrawBlueName 4 32
+proc CG_DrawBlueFlagName 16 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $529
+JUMPV
+LABELV $526
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $531
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $531
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+152
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $531
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $531
+LABELV $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $529
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $526
+LABELV $525
+endproc CG_DrawBlueFlagName 16 32
+lit
+align 4
+LABELV $548
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $555
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawBlueFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+EQI4 $541
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+EQI4 $541
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+NEI4 $540
+ADDRLP4 0
+ADDRGP4 $548
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $541
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $552
+JUMPV
+LABELV $551
+CNSTI4 9
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $553
+ADDRLP4 8
+ADDRGP4 $555
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+63372
+INDIRI4
+CNSTI4 0
+LTI4 $556
+ADDRGP4 cgs+63372
+INDIRI4
+CNSTI4 2
+GTI4 $556
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+63372
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22596
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22596
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $557
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $553
+LABELV $552
+LABELV $540
+endproc CG_DrawBlueFlagStatus 28 20
+proc CG_DrawBlueFlagHead 36 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $566
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $571
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $571
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+152
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $571
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $565
+JUMPV
+LABELV $571
+LABELV $567
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $569
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $566
+LABELV $565
+endproc CG_DrawBlueFlagHead 36 24
+proc CG_DrawRedFlagName 16 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $583
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $588
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $588
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+152
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $588
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $582
+JUMPV
+LABELV $588
+LABELV $584
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $586
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $583
+LABELV $582
+endproc CG_DrawRedFlagName 16 32
+lit
+align 4
+LABELV $605
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $612
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_DrawRedFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+EQI4 $598
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+EQI4 $598
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+NEI4 $597
+ADDRLP4 0
+ADDRGP4 $605
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $597
+JUMPV
+LABELV $598
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $609
+JUMPV
+LABELV $608
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $610
+ADDRLP4 8
+ADDRGP4 $612
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+63368
+INDIRI4
+CNSTI4 0
+LTI4 $613
+ADDRGP4 cgs+63368
+INDIRI4
+CNSTI4 2
+GTI4 $613
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+63368
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22596
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22596
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $614
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $610
+LABELV $609
+LABELV $597
+endproc CG_DrawRedFlagStatus 28 20
+proc CG_DrawRedFlagHead 36 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $623
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $628
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $628
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+152
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $628
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $622
+JUMPV
+LABELV $628
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $626
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $623
+LABELV $622
+endproc CG_DrawRedFlagHead 36 24
+proc CG_HarvesterSkulls 72 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+EQI4 $641
+ADDRGP4 $639
+JUMPV
+LABELV $641
+ADDRLP4 0
+INDIRI4
+CNSTI4 99
+LEI4 $644
+ADDRLP4 0
+CNSTI4 99
+ASGNI4
+LABELV $644
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $649
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $649
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 3233808384
+ASGNF4
+ADDRLP4 20+4
+CNSTI4 360
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $658
+ADDRLP4 44
+ADDRGP4 cgs+5042112+36
+INDIRI4
+ASGNI4
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 44
+ADDRGP4 cgs+5042112+40
+INDIRI4
+ASGNI4
+LABELV $659
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 1108082688
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $665
+ADDRLP4 44
+ADDRGP4 cgs+5042112+44
+INDIRI4
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $665
+ADDRLP4 44
+ADDRGP4 cgs+5042112+48
+INDIRI4
+ASGNI4
+LABELV $666
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $650
+LABELV $646
+LABELV $639
+endproc CG_HarvesterSkulls 72 32
+lit
+align 4
+LABELV $682
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_OneFlagStatus 32 20
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+EQI4 $673
+ADDRGP4 $672
+JUMPV
+LABELV $673
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $676
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 0
+LTI4 $678
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 4
+GTI4 $678
+ADDRLP4 8
+ADDRGP4 $682
+INDIRB
+ASGNB 16
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 2
+NEI4 $683
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 3
+NEI4 $688
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 4
+NEI4 $692
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+LABELV $692
+LABELV $689
+LABELV $684
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22596
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $678
+LABELV $676
+LABELV $672
+endproc CG_OneFlagStatus 32 20
+proc CG_DrawCTFPowerUp 8 20
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+GEI4 $698
+ADDRGP4 $697
+JUMPV
+LABELV $698
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $702
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $702
+LABELV $697
+endproc CG_DrawCTFPowerUp 8 20
+proc CG_DrawTeamColor 8 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+LABELV $705
+endproc CG_DrawTeamColor 8 24
+proc CG_DrawAreaPowerUp 240 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $713
+ADDRLP4 200
+ADDRLP4 148+4
+ASGNP4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 200
+ADDRLP4 148
+ASGNP4
+LABELV $714
+ADDRLP4 192
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $716
+ADDRGP4 $707
+JUMPV
+LABELV $716
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $718
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 364
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $722
+ADDRGP4 $719
+JUMPV
+LABELV $722
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 364
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2147483647
+NEI4 $724
+ADDRGP4 $719
+JUMPV
+LABELV $724
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 364
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GTI4 $727
+ADDRGP4 $719
+JUMPV
+LABELV $727
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $732
+JUMPV
+LABELV $729
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $733
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $735
+ADDRLP4 208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $736
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $738
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $735
+ADDRGP4 $731
+JUMPV
+LABELV $733
+LABELV $730
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $732
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $729
+LABELV $731
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $719
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $718
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $744
+JUMPV
+LABELV $741
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $745
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 364
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $747
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $748
+JUMPV
+LABELV $747
+ADDRLP4 188
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 216+12
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $748
+ADDRLP4 168
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ARGF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 148+12
+INDIRF4
+ARGF4
+ADDRLP4 216
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 148
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ADDRLP4 148+12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+ADDRLP4 148+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $745
+LABELV $742
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $744
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $741
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $707
+endproc CG_DrawAreaPowerUp 240 32
+export CG_GetValue
+proc CG_GetValue 44 0
+ADDRLP4 4
+CNSTI4 816
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 21
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $774
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $782
+LABELV $781
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $770
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $776
+ADDRLP4 20
+INDIRI4
+CNSTI4 7
+EQI4 $771
+ADDRGP4 $765
+JUMPV
+LABELV $782
+ADDRLP4 24
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 28
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $779
+ADDRLP4 24
+INDIRI4
+CNSTI4 29
+EQI4 $777
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $765
+LABELV $783
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 41
+EQI4 $766
+ADDRLP4 32
+INDIRI4
+CNSTI4 42
+EQI4 $768
+ADDRGP4 $765
+JUMPV
+LABELV $766
+ADDRLP4 36
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 6112
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $768
+ADDRLP4 40
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 6112
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $770
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $771
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $774
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $776
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $777
+ADDRGP4 cgs+63360
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $779
+ADDRGP4 cgs+63364
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $761
+JUMPV
+LABELV $765
+CNSTF4 3212836864
+RETF4
+LABELV $761
+endproc CG_GetValue 44 0
+export CG_OtherTeamHasFlag
+proc CG_OtherTeamHasFlag 8 0
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+EQI4 $789
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $785
+LABELV $789
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $791
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $794
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 3
+NEI4 $794
+CNSTI4 1
+RETI4
+ADDRGP4 $784
+JUMPV
+LABELV $794
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $797
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 2
+NEI4 $797
+CNSTI4 1
+RETI4
+ADDRGP4 $784
+JUMPV
+LABELV $797
+CNSTI4 0
+RETI4
+ADDRGP4 $784
+JUMPV
+LABELV $791
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $800
+ADDRGP4 cgs+63368
+INDIRI4
+CNSTI4 1
+NEI4 $800
+CNSTI4 1
+RETI4
+ADDRGP4 $784
+JUMPV
+LABELV $800
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $803
+ADDRGP4 cgs+63372
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $803
+CNSTI4 1
+RETI4
+ADDRGP4 $784
+JUMPV
+LABELV $803
+CNSTI4 0
+RETI4
+ADDRGP4 $784
+JUMPV
+LABELV $785
+CNSTI4 0
+RETI4
+LABELV $784
+endproc CG_OtherTeamHasFlag 8 0
+export CG_YourTeamHasFlag
+proc CG_YourTeamHasFlag 8 0
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+EQI4 $811
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $807
+LABELV $811
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $813
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $816
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 2
+NEI4 $816
+CNSTI4 1
+RETI4
+ADDRGP4 $806
+JUMPV
+LABELV $816
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $819
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 3
+NEI4 $819
+CNSTI4 1
+RETI4
+ADDRGP4 $806
+JUMPV
+LABELV $819
+CNSTI4 0
+RETI4
+ADDRGP4 $806
+JUMPV
+LABELV $813
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $822
+ADDRGP4 cgs+63372
+INDIRI4
+CNSTI4 1
+NEI4 $822
+CNSTI4 1
+RETI4
+ADDRGP4 $806
+JUMPV
+LABELV $822
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $825
+ADDRGP4 cgs+63368
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $825
+CNSTI4 1
+RETI4
+ADDRGP4 $806
+JUMPV
+LABELV $825
+CNSTI4 0
+RETI4
+ADDRGP4 $806
+JUMPV
+LABELV $807
+CNSTI4 0
+RETI4
+LABELV $806
+endproc CG_YourTeamHasFlag 8 0
+export CG_OwnerDrawVisible
+proc CG_OwnerDrawVisible 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $829
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $833
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $833
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $834
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $829
+ADDRFP4 0
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $835
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+EQI4 $839
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $840
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $841
+ADDRLP4 0
+ADDRGP4 CG_OtherTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $841
+ADDRFP4 0
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $843
+ADDRLP4 0
+ADDRGP4 CG_YourTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $843
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $845
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $847
+ADDRGP4 cgs+63368
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $851
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 2
+NEI4 $847
+LABELV $851
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $847
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $852
+ADDRGP4 cgs+63372
+INDIRI4
+CNSTI4 1
+EQI4 $856
+ADDRGP4 cgs+63376
+INDIRI4
+CNSTI4 3
+NEI4 $852
+LABELV $856
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $852
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $845
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $857
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $859
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $859
+LABELV $857
+ADDRFP4 0
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $862
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+GEI4 $864
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $864
+LABELV $862
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $867
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+NEI4 $869
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $869
+LABELV $867
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $872
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $874
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $874
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $872
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $877
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 6
+NEI4 $879
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $879
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $877
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $882
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+NEI4 $884
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $884
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $882
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $887
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 8
+NEI4 $889
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $889
+CNSTI4 0
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $887
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $892
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 25
+GEI4 $894
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $894
+LABELV $892
+ADDRFP4 0
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $897
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 25
+LTI4 $899
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $899
+LABELV $897
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $902
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 0
+NEI4 $904
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $904
+LABELV $902
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $907
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+NEI4 $909
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $909
+LABELV $907
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $912
+LABELV $912
+ADDRFP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $914
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $922
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $922
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $916
+LABELV $922
+CNSTI4 1
+RETI4
+ADDRGP4 $828
+JUMPV
+LABELV $916
+LABELV $914
+CNSTI4 0
+RETI4
+LABELV $828
+endproc CG_OwnerDrawVisible 4 0
+proc CG_DrawPlayerHasFlag 16 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $925
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $926
+JUMPV
+LABELV $925
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+LABELV $926
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123116+364+32
+INDIRI4
+CNSTI4 0
+EQI4 $927
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $928
+JUMPV
+LABELV $927
+ADDRGP4 cg+123116+364+36
+INDIRI4
+CNSTI4 0
+EQI4 $932
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $933
+JUMPV
+LABELV $932
+ADDRGP4 cg+123116+364+40
+INDIRI4
+CNSTI4 0
+EQI4 $937
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $937
+LABELV $933
+LABELV $928
+LABELV $923
+endproc CG_DrawPlayerHasFlag 16 24
+proc CG_DrawAreaSystemChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 systemChat
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $942
+endproc CG_DrawAreaSystemChat 8 32
+proc CG_DrawAreaTeamChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $943
+endproc CG_DrawAreaTeamChat 8 32
+proc CG_DrawAreaChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat2
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $944
+endproc CG_DrawAreaChat 8 32
+export CG_GetKillerText
+proc CG_GetKillerText 8 8
+ADDRLP4 0
+ADDRGP4 $946
+ASGNP4
+ADDRGP4 cg+134980
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $947
+ADDRGP4 $950
+ARGP4
+ADDRGP4 cg+134980
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $947
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $945
+endproc CG_GetKillerText 8 8
+proc CG_DrawKiller 24 32
+ADDRGP4 cg+134980
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $953
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $953
+LABELV $952
+endproc CG_DrawKiller 24 32
+proc CG_DrawCapFragLimit 16 32
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+LEI4 $961
+ADDRLP4 4
+ADDRGP4 cgs+60160
+INDIRI4
+ASGNI4
+ADDRGP4 $962
+JUMPV
+LABELV $961
+ADDRLP4 4
+ADDRGP4 cgs+60156
+INDIRI4
+ASGNI4
+LABELV $962
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $963
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $956
+endproc CG_DrawCapFragLimit 16 32
+proc CG_Draw1stPlace 8 32
+ADDRGP4 cgs+63360
+INDIRI4
+CNSTI4 -9999
+EQI4 $965
+ADDRGP4 $963
+ARGP4
+ADDRGP4 cgs+63360
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $965
+LABELV $964
+endproc CG_Draw1stPlace 8 32
+proc CG_Draw2ndPlace 8 32
+ADDRGP4 cgs+63364
+INDIRI4
+CNSTI4 -9999
+EQI4 $970
+ADDRGP4 $963
+ARGP4
+ADDRGP4 cgs+63364
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $970
+LABELV $969
+endproc CG_Draw2ndPlace 8 32
+export CG_GetGameStatusText
+proc CG_GetGameStatusText 12 12
+ADDRLP4 0
+ADDRGP4 $946
+ASGNP4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+GEI4 $975
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $976
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $981
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $976
+JUMPV
+LABELV $975
+ADDRGP4 cg+131376
+INDIRI4
+ADDRGP4 cg+131376+4
+INDIRI4
+NEI4 $984
+ADDRGP4 $989
+ARGP4
+ADDRGP4 cg+131376
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $985
+JUMPV
+LABELV $984
+ADDRGP4 cg+131376
+INDIRI4
+ADDRGP4 cg+131376+4
+INDIRI4
+LTI4 $991
+ADDRGP4 $996
+ARGP4
+ADDRGP4 cg+131376
+INDIRI4
+ARGI4
+ADDRGP4 cg+131376+4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $992
+JUMPV
+LABELV $991
+ADDRGP4 $1000
+ARGP4
+ADDRGP4 cg+131376+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+131376
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $992
+LABELV $985
+LABELV $976
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $974
+endproc CG_GetGameStatusText 12 12
+proc CG_DrawGameStatus 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 CG_GetGameStatusText
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1004
+endproc CG_DrawGameStatus 8 32
+export CG_GameTypeString
+proc CG_GameTypeString 0 0
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 1
+NEI4 $1006
+ADDRGP4 $1009
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1006
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+NEI4 $1010
+ADDRGP4 $1013
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1010
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+NEI4 $1014
+ADDRGP4 $1017
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1014
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+NEI4 $1018
+ADDRGP4 $1021
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1018
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $1022
+ADDRGP4 $1025
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1022
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 6
+NEI4 $1026
+ADDRGP4 $1029
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1026
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+NEI4 $1030
+ADDRGP4 $1033
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1030
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 8
+NEI4 $1034
+ADDRGP4 $1037
+RETP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1034
+ADDRGP4 $946
+RETP4
+LABELV $1005
+endproc CG_GameTypeString 0 0
+proc CG_DrawGameType 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 CG_GameTypeString
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1038
+endproc CG_DrawGameType 8 32
+proc CG_Text_Paint_Limit 76 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1040
+ADDRLP4 28
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cgDC+240+12
+ASGNP4
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1044
+ADDRLP4 36
+ADDRGP4 cgDC+240+20568
+ASGNP4
+ADDRGP4 $1045
+JUMPV
+LABELV $1044
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1049
+ADDRLP4 36
+ADDRGP4 cgDC+240+41124
+ASGNP4
+LABELV $1049
+LABELV $1045
+ADDRLP4 32
+ADDRFP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $1054
+ADDRLP4 24
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $1054
+ADDRLP4 24
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $1054
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1057
+JUMPV
+LABELV $1056
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1059
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $1057
+JUMPV
+LABELV $1059
+ADDRLP4 60
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+LEF4 $1062
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1058
+JUMPV
+LABELV $1062
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintChar
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $1057
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1065
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1065
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $1056
+LABELV $1065
+LABELV $1058
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1040
+LABELV $1039
+endproc CG_Text_Paint_Limit 76 40
+export CG_DrawNewTeamInfo
+proc CG_DrawNewTeamInfo 112 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $1068
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1069
+JUMPV
+LABELV $1068
+ADDRLP4 72
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $1069
+ADDRLP4 32
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1073
+JUMPV
+LABELV $1070
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+NEI4 $1075
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 64
+INDIRF4
+LEF4 $1078
+ADDRLP4 64
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1078
+LABELV $1075
+LABELV $1071
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1073
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $1070
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $1080
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1084
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1084
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+LEF4 $1086
+ADDRLP4 68
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1086
+LABELV $1084
+LABELV $1081
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $1080
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1091
+JUMPV
+LABELV $1088
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1093
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+NEI4 $1093
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1096
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1100
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1102
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+LABELV $1102
+LABELV $1100
+LABELV $1097
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LEI4 $1096
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1108344832
+ADDF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 84
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22548
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+474988
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+474992
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $1109
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1109
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1107
+JUMPV
+LABELV $1109
+ADDRGP4 cgs+474984
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $1107
+JUMPV
+LABELV $1106
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+LABELV $1107
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1115
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 88
+INDIRF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1119
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1117
+LABELV $1119
+ADDRLP4 20
+ADDRGP4 $423
+ASGNP4
+LABELV $1117
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+CNSTF4 1073741824
+ADDF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $1120
+ADDRGP4 $1090
+JUMPV
+LABELV $1120
+LABELV $1093
+LABELV $1089
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1091
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $1088
+LABELV $1090
+LABELV $1066
+endproc CG_DrawNewTeamInfo 112 32
+proc CG_DrawTeamSpectators 60 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+135012
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+LEF4 $1125
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1126
+JUMPV
+LABELV $1125
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1126
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+136036
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+136040
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRGP4 cg+136040
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 CG_ClearClipRegion
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 cg+136040
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1132
+JUMPV
+LABELV $1131
+ADDRLP4 56
+ADDRGP4 cg+136040
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1132
+ADDRGP4 cg+136040
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $1131
+ADDRGP4 cg+136036
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1122
+endproc CG_DrawTeamSpectators 60 32
+export CG_DrawMedal
+proc CG_DrawMedal 32 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 8
+CNSTI4 56
+ADDRGP4 cg+131372
+INDIRI4
+MULI4
+ADDRGP4 cg+131384
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 54
+LTI4 $1140
+ADDRLP4 12
+INDIRI4
+CNSTI4 60
+GTI4 $1150
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1151-216
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1151
+address $1142
+address $1148
+address $1147
+address $1143
+address $1144
+address $1149
+address $1145
+code
+LABELV $1150
+ADDRFP4 0
+INDIRI4
+CNSTI4 70
+EQI4 $1146
+ADDRGP4 $1140
+JUMPV
+LABELV $1142
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1143
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1144
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1145
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1146
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1147
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1148
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1141
+JUMPV
+LABELV $1149
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1140
+LABELV $1141
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1153
+ADDRFP4 0
+INDIRI4
+CNSTI4 59
+EQI4 $1155
+ADDRFP4 0
+INDIRI4
+CNSTI4 54
+NEI4 $1157
+ADDRGP4 $1159
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1156
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1156
+JUMPV
+LABELV $1157
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1156
+JUMPV
+LABELV $1155
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $1162
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1162
+ADDRLP4 4
+ADDRGP4 $1164
+ASGNP4
+LABELV $1156
+LABELV $1153
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1165
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1092616192
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1165
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1137
+endproc CG_DrawMedal 32 32
+export CG_OwnerDraw
+proc CG_OwnerDraw 24 24
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $1168
+ADDRGP4 $1167
+JUMPV
+LABELV $1168
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $1175
+ADDRLP4 16
+INDIRI4
+CNSTI4 70
+GTI4 $1175
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 $1231-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1231
+address $1176
+address $1178
+address $1192
+address $1195
+address $1179
+address $1181
+address $1182
+address $1188
+address $1189
+address $1185
+address $1190
+address $1191
+address $1175
+address $1175
+address $1175
+address $1175
+address $1175
+address $1175
+address $1193
+address $1194
+address $1200
+address $1201
+address $1202
+address $1203
+address $1204
+address $1205
+address $1197
+address $1196
+address $1198
+address $1199
+address $1206
+address $1208
+address $1209
+address $1210
+address $1211
+address $1212
+address $1175
+address $1214
+address $1219
+address $1186
+address $1187
+address $1213
+address $1175
+address $1175
+address $1175
+address $1216
+address $1217
+address $1218
+address $1220
+address $1221
+address $1177
+address $1180
+address $1222
+address $1222
+address $1222
+address $1222
+address $1222
+address $1222
+address $1222
+address $1223
+address $1224
+address $1183
+address $1184
+address $1215
+address $1207
+address $1228
+address $1229
+address $1230
+address $1222
+code
+LABELV $1176
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1177
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1178
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorValue
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1179
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1180
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1181
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoValue
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1182
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1183
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1184
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1185
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerStatus
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1186
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerArmor
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1187
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHealth
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1188
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1189
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerLocation
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1190
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerWeapon
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1191
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerPowerup
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1192
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerHead
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1193
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerItem
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1194
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerScore
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1195
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerHealth
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1196
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedScore
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1197
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueScore
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1198
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedName
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1199
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueName
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1200
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawBlueFlagHead
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1201
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagStatus
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1202
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagName
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1203
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawRedFlagHead
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1204
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagStatus
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1205
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagName
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1206
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1207
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1208
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_OneFlagStatus
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1209
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerLocation
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1210
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTeamColor
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1211
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawCTFPowerUp
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1212
+ADDRLP4 0
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaPowerUp
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1213
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawPlayerStatus
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1214
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1215
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1216
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaSystemChat
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1217
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaTeamChat
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1218
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaChat
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1219
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameType
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1220
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameStatus
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1221
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawKiller
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1222
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawMedal
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1223
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamSpectators
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1224
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $1175
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawNewTeamInfo
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1228
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawCapFragLimit
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1229
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw1stPlace
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1230
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2ndPlace
+CALLV
+pop
+LABELV $1175
+LABELV $1167
+endproc CG_OwnerDraw 24 24
+export CG_MouseEvent
+proc CG_MouseEvent 16 12
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 0
+EQI4 $1241
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 2
+NEI4 $1234
+LABELV $1241
+ADDRGP4 cg+134968
+INDIRI4
+CNSTI4 0
+NEI4 $1234
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1233
+JUMPV
+LABELV $1234
+ADDRLP4 4
+ADDRGP4 cgs+474956
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+474956
+INDIRI4
+CNSTI4 0
+GEI4 $1243
+ADDRGP4 cgs+474956
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1243
+ADDRGP4 cgs+474956
+INDIRI4
+CNSTI4 640
+LEI4 $1247
+ADDRGP4 cgs+474956
+CNSTI4 640
+ASGNI4
+LABELV $1247
+LABELV $1244
+ADDRLP4 8
+ADDRGP4 cgs+474960
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+474960
+INDIRI4
+CNSTI4 0
+GEI4 $1252
+ADDRGP4 cgs+474960
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1252
+ADDRGP4 cgs+474960
+INDIRI4
+CNSTI4 480
+LEI4 $1256
+ADDRGP4 cgs+474960
+CNSTI4 480
+ASGNI4
+LABELV $1256
+LABELV $1253
+ADDRGP4 cgs+474956
+INDIRI4
+ARGI4
+ADDRGP4 cgs+474960
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Display_CursorType
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+474980
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1263
+ADDRGP4 cgs+474980
+ADDRGP4 cgs+5042112+28
+INDIRI4
+ASGNI4
+ADDRGP4 $1264
+JUMPV
+LABELV $1263
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $1268
+ADDRGP4 cgs+474980
+ADDRGP4 cgs+5042112+32
+INDIRI4
+ASGNI4
+LABELV $1268
+LABELV $1264
+ADDRGP4 cgs+474976
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1273
+ADDRGP4 cgs+474976
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1274
+JUMPV
+LABELV $1273
+CNSTP4 0
+ARGP4
+ADDRGP4 cgs+474956
+INDIRI4
+ARGI4
+ADDRGP4 cgs+474960
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $1274
+LABELV $1233
+endproc CG_MouseEvent 16 12
+export CG_HideTeamMenu
+proc CG_HideTeamMenu 0 4
+ADDRGP4 $1280
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $1281
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $1279
+endproc CG_HideTeamMenu 0 4
+export CG_ShowTeamMenu
+proc CG_ShowTeamMenu 0 4
+ADDRGP4 $1280
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $1282
+endproc CG_ShowTeamMenu 0 4
+export CG_EventHandling
+proc CG_EventHandling 0 0
+ADDRGP4 cgs+474964
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1285
+ADDRGP4 CG_HideTeamMenu
+CALLV
+pop
+ADDRGP4 $1286
+JUMPV
+LABELV $1285
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1287
+ADDRGP4 $1288
+JUMPV
+LABELV $1287
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1289
+LABELV $1289
+LABELV $1288
+LABELV $1286
+LABELV $1283
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 8 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1292
+ADDRGP4 $1291
+JUMPV
+LABELV $1292
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+123116+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1301
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 2
+NEI4 $1294
+ADDRGP4 cg+134968
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1294
+LABELV $1301
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1291
+JUMPV
+LABELV $1294
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+474956
+INDIRI4
+ARGI4
+ADDRGP4 cgs+474960
+INDIRI4
+ARGI4
+ADDRGP4 Display_HandleKey
+CALLV
+pop
+ADDRGP4 cgs+474976
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1304
+ADDRGP4 cgs+474976
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+NEI4 $1308
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1308
+ADDRGP4 cgs+474956
+INDIRI4
+ARGI4
+ADDRGP4 cgs+474960
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+474976
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1308
+LABELV $1305
+LABELV $1291
+endproc CG_KeyEvent 8 16
+export CG_ClientNumFromName
+proc CG_ClientNumFromName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1317
+JUMPV
+LABELV $1314
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1319
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+81820+4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1319
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1313
+JUMPV
+LABELV $1319
+LABELV $1315
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1317
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $1314
+CNSTI4 -1
+RETI4
+LABELV $1313
+endproc CG_ClientNumFromName 12 8
+export CG_ShowResponseHead
+proc CG_ShowResponseHead 20 16
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 1116733440
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 $1325
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $1326
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 cg+145044
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 CG_PopScreenPlacement
+CALLV
+pop
+LABELV $1324
+endproc CG_ShowResponseHead 20 16
+export CG_RunMenuScript
+proc CG_RunMenuScript 0 0
+LABELV $1329
+endproc CG_RunMenuScript 0 0
+export CG_GetTeamColor
+proc CG_GetTeamColor 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1331
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $1332
+JUMPV
+LABELV $1331
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1334
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRGP4 $1335
+JUMPV
+LABELV $1334
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1043207291
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+LABELV $1335
+LABELV $1332
+LABELV $1330
+endproc CG_GetTeamColor 8 0
+import cgDC
+import trap_PC_FreeSource
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Menu_FindItemByName
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_Draw3DModel
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1326
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 88
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1325
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1281
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1280
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1164
+byte 1 87
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1159
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $1037
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $1033
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1029
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1025
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $1021
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1017
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1013
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1009
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1000
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $996
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $989
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $981
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $963
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $950
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $946
+byte 1 0
+align 1
+LABELV $514
+byte 1 45
+byte 1 0
+align 1
+LABELV $423
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $208
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $159
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $156
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $137
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $132
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $126
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $125
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $124
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $122
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $121
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $119
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $118
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $117
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $115
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $114
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $111
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $109
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $108
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $107
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $104
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $103
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
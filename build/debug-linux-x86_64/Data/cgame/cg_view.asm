@@ -0,0 +1,4455 @@
+export CG_TestModel_f
+code
+proc CG_TestModel_f 36 12
+ADDRGP4 cg+145528
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145292
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $83
+ADDRGP4 $79
+JUMPV
+LABELV $83
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+145464
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+145464
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+145292+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+NEI4 $89
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+145292+108
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+145292+80
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+145292+100
+CNSTI4 0
+ASGNI4
+LABELV $89
+ADDRGP4 cg+145292+8
+INDIRI4
+CNSTI4 0
+NEI4 $97
+ADDRGP4 $101
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $97
+ADDRGP4 cg+145292+68
+ADDRGP4 cg+125184+24
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+125184+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+145292+68+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+125184+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+145292+68+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+125184+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+125624+4
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+145292+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $79
+endproc CG_TestModel_f 36 12
+export CG_TestGun_f
+proc CG_TestGun_f 0 0
+ADDRGP4 CG_TestModel_f
+CALLV
+pop
+ADDRGP4 cg+145292+8
+INDIRI4
+CNSTI4 0
+NEI4 $133
+ADDRGP4 $132
+JUMPV
+LABELV $133
+ADDRGP4 cg+145528
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+145292+4
+CNSTI4 12
+ASGNI4
+LABELV $132
+endproc CG_TestGun_f 0 0
+export CG_TestModelNextFrame_f
+proc CG_TestModelNextFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+145292+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $143
+ARGP4
+ADDRGP4 cg+145292+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $140
+endproc CG_TestModelNextFrame_f 4 8
+export CG_TestModelPrevFrame_f
+proc CG_TestModelPrevFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+145292+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+145292+80
+INDIRI4
+CNSTI4 0
+GEI4 $149
+ADDRGP4 cg+145292+80
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRGP4 $143
+ARGP4
+ADDRGP4 cg+145292+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $146
+endproc CG_TestModelPrevFrame_f 4 8
+export CG_TestModelNextSkin_f
+proc CG_TestModelNextSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+145292+112
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $160
+ARGP4
+ADDRGP4 cg+145292+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $157
+endproc CG_TestModelNextSkin_f 4 8
+export CG_TestModelPrevSkin_f
+proc CG_TestModelPrevSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+145292+112
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+145292+112
+INDIRI4
+CNSTI4 0
+GEI4 $166
+ADDRGP4 cg+145292+112
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRGP4 $160
+ARGP4
+ADDRGP4 cg+145292+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $163
+endproc CG_TestModelPrevSkin_f 4 8
+proc CG_AddTestModel 32 4
+ADDRGP4 cg+145464
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+145292+8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+145292+8
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRGP4 $101
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $174
+JUMPV
+LABELV $178
+ADDRGP4 cg+145528
+INDIRI4
+CNSTI4 0
+EQI4 $182
+ADDRGP4 cg+145292+68
+ADDRGP4 cg+125184+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+145292+28
+ADDRGP4 cg+125184+36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+145292+28+12
+ADDRGP4 cg+125184+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+145292+28+24
+ADDRGP4 cg+125184+36+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $205
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+145292+68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+125184+36
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+145292+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+125184+36+12
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+145292+68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+125184+36+24
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $206
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $205
+LABELV $182
+ADDRGP4 cg+145292
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $174
+endproc CG_AddTestModel 32 4
+proc CG_CalcVrect 12 8
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $228
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 30
+GEI4 $231
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 100
+LEI4 $235
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 0
+ADDRGP4 cg_viewsize+12
+INDIRI4
+ASGNI4
+LABELV $236
+LABELV $232
+LABELV $229
+ADDRGP4 cg+125184+8
+ADDRGP4 cgs+24196+35880
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+125184+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+125184+12
+ADDRGP4 cgs+24196+35884
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+125184+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+125184
+CNSTF4 1056964608
+ADDRGP4 cgs+24196+35880
+INDIRI4
+ADDRGP4 cg+125184+8
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+125184+4
+CNSTF4 1056964608
+ADDRGP4 cgs+24196+35884
+INDIRI4
+ADDRGP4 cg+125184+12
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $227
+endproc CG_CalcVrect 12 8
+proc CG_StepOffset 8 0
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+125064
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+GEI4 $265
+ADDRLP4 4
+ADDRGP4 cg+125184+24+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125060
+INDIRF4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+LABELV $265
+LABELV $262
+endproc CG_StepOffset 8 0
+data
+align 4
+LABELV $272
+byte 4 3233808384
+byte 4 3233808384
+byte 4 3233808384
+align 4
+LABELV $273
+byte 4 1086324736
+byte 4 1086324736
+byte 4 1086324736
+code
+proc CG_OffsetThirdPersonView 184 28
+ADDRLP4 140
+ADDRGP4 cg+125184+24+8
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRGP4 cg+123116+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg+125624
+INDIRB
+ASGNB 12
+ADDRGP4 cg+123116+236
+INDIRI4
+CNSTI4 0
+GTI4 $280
+ADDRLP4 48+4
+ADDRGP4 cg+123116+236+16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+125624+4
+ADDRGP4 cg+123116+236+16
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $280
+ADDRLP4 48
+INDIRF4
+CNSTF4 1110704128
+LEF4 $293
+ADDRLP4 48
+CNSTF4 1110704128
+ASGNF4
+LABELV $293
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRLP4 144
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+125184+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+125624
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 148
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+125624
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 152
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $332
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+123116+96
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $339
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+CNSTF4 1065353216
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+123116+96
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+LABELV $339
+LABELV $332
+ADDRGP4 cg+125184+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+GEF4 $366
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+LABELV $366
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+125624
+CNSTF4 3261411041
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 cg+125624+4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $271
+endproc CG_OffsetThirdPersonView 184 28
+proc CG_OffsetFirstPersonView 84 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $374
+ADDRGP4 $373
+JUMPV
+LABELV $374
+ADDRLP4 24
+ADDRGP4 cg+125184+24
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+125624
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $380
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cg+123116+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $373
+JUMPV
+LABELV $380
+ADDRGP4 cg+145228
+INDIRF4
+CNSTF4 0
+EQF4 $386
+ADDRLP4 32
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+145228
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $391
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+145272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+145276
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 32
+CNSTF4 1065353216
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+LEF4 $395
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+145272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+145276
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $395
+LABELV $392
+LABELV $386
+ADDRLP4 4
+ADDRGP4 cg+123116+56
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg+125184+36
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 cg+125184+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runpitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runroll+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg+125184+36
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 cg+125184+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runyaw+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+145288
+INDIRF4
+CNSTF4 1128792064
+LEF4 $440
+ADDRLP4 56
+ADDRGP4 cg+145288
+INDIRF4
+ASGNF4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 56
+CNSTF4 1128792064
+ASGNF4
+LABELV $441
+ADDRLP4 20
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+145280
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+123116+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $444
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $444
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+145280
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+123116+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $450
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $450
+ADDRGP4 cg+145284
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $454
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $454
+ADDRLP4 64
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+145280
+INDIRF4
+ADDRGP4 cg_bobyaw+8
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+123116+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $459
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $459
+ADDRGP4 cg+145284
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $463
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $463
+ADDRLP4 68
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRGP4 cg+123116+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+125072
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 100
+GEI4 $470
+ADDRLP4 76
+ADDRGP4 cg+125184+24+8
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125068
+INDIRF4
+CNSTI4 100
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+SUBF4
+ASGNF4
+LABELV $470
+ADDRLP4 28
+ADDRGP4 cg+145280
+INDIRF4
+ADDRGP4 cg+145288
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1086324736
+LEF4 $479
+ADDRLP4 28
+CNSTF4 1086324736
+ASGNF4
+LABELV $479
+ADDRLP4 76
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+125080
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+GEF4 $483
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 cg+125184+24+8
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125076
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRLP4 0
+INDIRF4
+CNSTF4 1138819072
+GEF4 $489
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 cg+125184+24+8
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125076
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $489
+LABELV $484
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+LABELV $373
+endproc CG_OffsetFirstPersonView 84 0
+export CG_ZoomDown_f
+proc CG_ZoomDown_f 0 0
+ADDRGP4 cg+130324
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRGP4 $495
+JUMPV
+LABELV $496
+ADDRGP4 cg+130324
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+130328
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $495
+endproc CG_ZoomDown_f 0 0
+export CG_ZoomUp_f
+proc CG_ZoomUp_f 0 0
+ADDRGP4 cg+130324
+INDIRI4
+CNSTI4 0
+NEI4 $503
+ADDRGP4 $502
+JUMPV
+LABELV $503
+ADDRGP4 cg+130324
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+130328
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $502
+endproc CG_ZoomUp_f 0 0
+proc CG_CalcFov 56 8
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 5
+NEI4 $510
+ADDRLP4 32
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125636
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRGP4 cgs+60152
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $515
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $519
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $520
+JUMPV
+LABELV $519
+ADDRLP4 0
+INDIRF4
+CNSTF4 1126170624
+LEF4 $521
+ADDRLP4 0
+CNSTF4 1126170624
+ASGNF4
+LABELV $521
+LABELV $520
+LABELV $516
+ADDRGP4 cg+125636
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg_zoomFov+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $525
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRLP4 8
+INDIRF4
+CNSTF4 1126170624
+LEF4 $527
+ADDRLP4 8
+CNSTF4 1126170624
+ASGNF4
+LABELV $527
+LABELV $526
+ADDRGP4 cg+130324
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRLP4 24
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+130328
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LEF4 $534
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $530
+JUMPV
+LABELV $534
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRLP4 24
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+130328
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+GTF4 $538
+ADDRLP4 32
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $538
+LABELV $530
+LABELV $511
+ADDRGP4 cg_fovAspectAdjust+12
+INDIRI4
+CNSTI4 0
+EQI4 $540
+ADDRLP4 32
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+125184+8
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125184+12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1135869952
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $540
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+125184+8
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+125184+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1135869952
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 cg+125184+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $553
+ADDRLP4 28
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 cg+125184+76
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRLP4 44
+ADDRGP4 cg+125184+76
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $554
+ADDRGP4 cg+125184+16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+20
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+130324
+INDIRI4
+CNSTI4 0
+NEI4 $564
+ADDRGP4 cg+130332
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRGP4 cg+130332
+ADDRGP4 cg+125184+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $565
+ADDRGP4 cg+125184+76
+INDIRI4
+CNSTI4 2
+BANDI4
+RETI4
+LABELV $509
+endproc CG_CalcFov 56 8
+export CG_DrawSkyBoxPortal
+proc CG_DrawSkyBoxPortal 448 4
+ADDRLP4 440
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_skybox+12
+INDIRI4
+ADDRLP4 440
+INDIRI4
+EQI4 $578
+ADDRGP4 cg+130288
+INDIRI4
+ADDRLP4 440
+INDIRI4
+NEI4 $574
+LABELV $578
+ADDRGP4 $573
+JUMPV
+LABELV $574
+ADDRLP4 0
+ADDRGP4 cg+125184
+INDIRB
+ASGNB 440
+ADDRGP4 cg+125184+24
+ADDRGP4 cg+130292
+INDIRB
+ASGNB 12
+ADDRGP4 cg+130316
+INDIRI4
+CNSTI4 0
+LEI4 $583
+ADDRGP4 cg+125184+368
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+125184+388
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg+125184+384
+ADDRGP4 cg+130316
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+125184+436
+CNSTF4 0
+ASGNF4
+LABELV $583
+ADDRGP4 cg+125184+372
+ADDRGP4 cg+130304
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125184+432
+ADDRGP4 cg+130320
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+72
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 cg_skybox+12
+INDIRI4
+CNSTI4 2
+NEI4 $604
+ADDRLP4 444
+ADDRGP4 cg+125184+76
+ASGNP4
+ADDRLP4 444
+INDIRP4
+ADDRLP4 444
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $604
+ADDRGP4 cg+125184
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRGP4 cg+125184
+ADDRLP4 0
+INDIRB
+ASGNB 440
+ADDRLP4 444
+ADDRGP4 cg+125184+76
+ASGNP4
+ADDRLP4 444
+INDIRP4
+ADDRLP4 444
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $573
+endproc CG_DrawSkyBoxPortal 448 4
+proc CG_DamageBlendBlob 196 12
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $614
+ADDRGP4 $613
+JUMPV
+LABELV $614
+ADDRGP4 cg+145240
+INDIRF4
+CNSTF4 0
+NEF4 $617
+ADDRGP4 $613
+JUMPV
+LABELV $617
+ADDRLP4 176
+CNSTI4 500
+ASGNI4
+ADDRLP4 172
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+145228
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LEI4 $624
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LTI4 $622
+LABELV $624
+ADDRGP4 $613
+JUMPV
+LABELV $622
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+68
+ADDRGP4 cg+125184+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125184+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125184+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125184+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+145232
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+145232
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+145232
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+145236
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+145236
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+145236
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+152
+CNSTF4 1077936128
+ADDRGP4 cg+145240
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+120
+ADDRGP4 cgs+5042112+22272
+INDIRI4
+ASGNI4
+ADDRLP4 0+124
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 188
+CNSTF4 1128792064
+CNSTF4 1065353216
+ADDRLP4 172
+INDIRI4
+CVIF4 4
+ADDRLP4 176
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LTF4 $708
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $709
+ADDRLP4 0+124+3
+ADDRLP4 184
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $613
+endproc CG_DamageBlendBlob 196 12
+proc CG_CalcViewValues 40 12
+ADDRGP4 cg+125184
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 440
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+123116
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $714
+ADDRGP4 cg+125184+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125624
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125624
+ARGP4
+ADDRGP4 cg+125184+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $710
+JUMPV
+LABELV $714
+ADDRGP4 cg+145284
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 7
+RSHI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+145280
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+145288
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125624
+ADDRLP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 28
+ADDRGP4 cg_thirdPersonAngle+8
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+ADDRGP4 cg+123080
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $728
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+CNSTF4 0
+LEF4 $734
+ADDRLP4 32
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+124976
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+LEF4 $741
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $741
+ADDRGP4 cg+125184+24
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRGP4 cg+124980
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+125184+24+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRGP4 cg+124980+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+125184+24+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+ADDRGP4 cg+124980+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRGP4 cg+124976
+CNSTI4 0
+ASGNI4
+LABELV $742
+LABELV $734
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+LABELV $766
+ADDRGP4 cg+125624
+ARGP4
+ADDRGP4 cg+125184+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+123112
+INDIRI4
+CNSTI4 0
+EQI4 $771
+ADDRLP4 28
+ADDRGP4 cg+125184+76
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $771
+ADDRLP4 28
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $710
+endproc CG_CalcViewValues 40 12
+proc CG_PowerupTimerSounds 16 20
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $777
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 408
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+GTI4 $782
+ADDRGP4 $778
+JUMPV
+LABELV $782
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $785
+ADDRGP4 $778
+JUMPV
+LABELV $785
+ADDRLP4 12
+CNSTI4 1000
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+123088
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+EQI4 $788
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+5042112+23996
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $788
+LABELV $778
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $777
+LABELV $776
+endproc CG_PowerupTimerSounds 16 20
+export CG_AddBufferedAnnouncerSound
+proc CG_AddBufferedAnnouncerSound 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $796
+ADDRGP4 $795
+JUMPV
+LABELV $796
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $798
+ADDRGP4 cg+145056
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145048
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145052
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145060
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $795
+JUMPV
+LABELV $798
+ADDRGP4 cg+145048
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+145060
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+145048
+ADDRGP4 cg+145048
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 32
+MODI4
+ASGNI4
+ADDRGP4 cg+145048
+INDIRI4
+ADDRGP4 cg+145052
+INDIRI4
+NEI4 $809
+ADDRGP4 cg+145052
+ADDRGP4 cg+145052
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 32
+MODI4
+ASGNI4
+LABELV $809
+LABELV $795
+endproc CG_AddBufferedAnnouncerSound 0 12
+export CG_HasBufferedAnnouncerSound
+proc CG_HasBufferedAnnouncerSound 4 0
+ADDRGP4 cg+145052
+INDIRI4
+ADDRGP4 cg+145048
+INDIRI4
+EQI4 $821
+ADDRGP4 cg+145052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+145060
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $821
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $822
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $815
+endproc CG_HasBufferedAnnouncerSound 4 0
+proc CG_PlayBufferedAnnouncerSounds 8 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $828
+ADDRGP4 cg+145212
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $824
+LABELV $828
+ADDRGP4 cg+145056
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145048
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145052
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145060
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $823
+JUMPV
+LABELV $824
+ADDRGP4 cg+145056
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+GEI4 $834
+ADDRLP4 4
+ADDRGP4 CG_HasBufferedAnnouncerSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRGP4 cg+145188
+ADDRGP4 cg+145052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+145060
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+145188
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+145052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+145060
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145052
+ADDRGP4 cg+145052
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 32
+MODI4
+ASGNI4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+LEI4 $848
+ADDRGP4 cg+145056
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $839
+JUMPV
+LABELV $848
+ADDRGP4 cg+145056
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 1500
+ADDI4
+ASGNI4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRGP4 cg+145188
+CNSTI4 0
+ASGNI4
+LABELV $839
+LABELV $834
+LABELV $823
+endproc CG_PlayBufferedAnnouncerSounds 8 12
+export CG_SetupFrustum
+proc CG_SetupFrustum 48 4
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRGP4 cg+125184+16
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 frustum
+ADDRGP4 cg+125184+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+8
+ADDRGP4 cg+125184+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 frustum
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+4
+ADDRGP4 frustum+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+8
+ADDRGP4 frustum+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+16
+ADDRGP4 cg+125184+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+16+4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+16+8
+ADDRGP4 cg+125184+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+16
+ADDRGP4 frustum+16
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+16+4
+ADDRGP4 frustum+16+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+16+8
+ADDRGP4 frustum+16+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRGP4 cg+125184+20
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 frustum+32
+ADDRGP4 cg+125184+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+32+4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+32+8
+ADDRGP4 cg+125184+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+32
+ADDRGP4 frustum+32
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+32+4
+ADDRGP4 frustum+32+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+32+8
+ADDRGP4 frustum+32+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+48
+ADDRGP4 cg+125184+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+48+4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+48+8
+ADDRGP4 cg+125184+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+48
+ADDRGP4 frustum+48
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+48+4
+ADDRGP4 frustum+48+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+48+8
+ADDRGP4 frustum+48+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $988
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum+12
+ADDP4
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum
+ADDP4
+INDIRF4
+MULF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $989
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $988
+LABELV $856
+endproc CG_SetupFrustum 48 4
+export CG_CullPoint
+proc CG_CullPoint 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1004
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 frustum
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 0
+GEF4 $1008
+CNSTI4 1
+RETI4
+ADDRGP4 $1003
+JUMPV
+LABELV $1008
+LABELV $1005
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1004
+CNSTI4 0
+RETI4
+LABELV $1003
+endproc CG_CullPoint 24 0
+export CG_CullPointAndRadius
+proc CG_CullPointAndRadius 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1011
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 frustum
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRF4
+NEGF4
+GEF4 $1015
+CNSTI4 1
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1015
+LABELV $1012
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1011
+CNSTI4 0
+RETI4
+LABELV $1010
+endproc CG_CullPointAndRadius 24 0
+export CG_DrawActiveFrame
+proc CG_DrawActiveFrame 24 16
+ADDRGP4 cg+123084
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRGP4 cg+130336
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1020
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1017
+JUMPV
+LABELV $1020
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 CG_PB_ClearPolyBuffers
+CALLV
+pop
+ADDRGP4 CG_ProcessSnapshots
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1027
+ADDRGP4 cg+36
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1023
+LABELV $1027
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1017
+JUMPV
+LABELV $1023
+ADDRGP4 cg+125084
+INDIRI4
+ARGI4
+ADDRGP4 cg+130332
+INDIRF4
+ARGF4
+ADDRGP4 trap_SetUserCmdValue
+CALLV
+pop
+ADDRGP4 cg+131360
+INDIRI4
+CNSTI4 0
+NEI4 $1030
+ADDRGP4 CG_SetupDlightstyles
+CALLV
+pop
+LABELV $1030
+ADDRLP4 4
+ADDRGP4 cg
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 CG_PredictPlayerState
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1038
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1040
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $1038
+LABELV $1040
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1039
+JUMPV
+LABELV $1038
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1039
+ADDRGP4 cg+123108
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_CalcViewValues
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 CG_SetupFrustum
+CALLV
+pop
+ADDRGP4 CG_DrawSkyBoxPortal
+CALLV
+pop
+ADDRGP4 cg+123112
+INDIRI4
+CNSTI4 0
+NEI4 $1041
+ADDRGP4 CG_AddPacketEntities
+CALLV
+pop
+ADDRGP4 CG_AddLocalEntities
+CALLV
+pop
+ADDRGP4 CG_AddMarks
+CALLV
+pop
+ADDRGP4 CG_AddParticles
+CALLV
+pop
+ADDRGP4 CG_AddAtmosphericEffects
+CALLV
+pop
+LABELV $1041
+ADDRGP4 cg+123116
+ARGP4
+ADDRGP4 CG_AddViewWeapon
+CALLV
+pop
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+ADDRGP4 CG_DamageBlendBlob
+CALLV
+pop
+LABELV $1045
+ADDRGP4 CG_PlayBufferedAnnouncerSounds
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedVoiceChats
+CALLV
+pop
+ADDRGP4 cg+145292+8
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRGP4 CG_AddTestModel
+CALLV
+pop
+LABELV $1048
+ADDRGP4 cg+125184+72
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125184+80
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 CG_PowerupTimerSounds
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRGP4 cg+125184+36
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1065
+ADDRGP4 cg+123080
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+123088
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+123080
+INDIRI4
+CNSTI4 0
+GEI4 $1070
+ADDRGP4 cg+123080
+CNSTI4 0
+ASGNI4
+LABELV $1070
+ADDRGP4 cg+123088
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 CG_AddLagometerFrameInfo
+CALLV
+pop
+LABELV $1065
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+EQF4 $1076
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1080
+ADDRLP4 20
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+123080
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+LEF4 $1081
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1081
+JUMPV
+LABELV $1080
+ADDRLP4 20
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+123080
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1096
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+LABELV $1096
+LABELV $1081
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+CNSTF4 0
+EQF4 $1102
+ADDRGP4 $1105
+ARGP4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1102
+LABELV $1076
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActive
+CALLV
+pop
+ADDRGP4 cg_stats+12
+INDIRI4
+CNSTI4 0
+EQI4 $1107
+ADDRGP4 $1110
+ARGP4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1107
+LABELV $1017
+endproc CG_DrawActiveFrame 24 16
+bss
+align 4
+LABELV frustum
+skip 64
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1110
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1105
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $234
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $160
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $143
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
@@ -0,0 +1,20043 @@
+export BotResetNodeSwitches
+code
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $70
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $72
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $76
+JUMPV
+LABELV $73
+CNSTI4 1
+ARGI4
+ADDRGP4 $77
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $74
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $76
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $73
+CNSTI4 4
+ARGI4
+ADDRGP4 $78
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $71
+endproc BotDumpNodeSwitches 40 20
+export BotRecordNodeSwitch
+proc BotRecordNodeSwitch 40 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5328
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $80
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $82
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $81
+ADDRGP4 bot_shownodechanges+12
+INDIRI4
+CNSTI4 0
+EQI4 $84
+CNSTI4 1
+ARGI4
+ADDRGP4 $77
+ARGP4
+CNSTI4 144
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $84
+ADDRLP4 36
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $79
+endproc BotRecordNodeSwitch 40 32
+lit
+align 4
+LABELV $88
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $89
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc BotGetAirGoal 112 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 $88
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRGP4 $89
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $92
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 104
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $96
+LABELV $92
+CNSTI4 0
+RETI4
+LABELV $87
+endproc BotGetAirGoal 112 28
+proc BotGoForAir 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $100
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $107
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $100
+CNSTI4 0
+RETI4
+LABELV $99
+endproc BotGoForAir 68 24
+export BotNearbyGoal
+proc BotNearbyGoal 20 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $110
+CNSTI4 1
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOnlyPickupImportantItems
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 300
+GEI4 $114
+ADDRFP4 12
+CNSTI4 10
+ASGNI4
+LABELV $114
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $109
+endproc BotNearbyGoal 20 24
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $117
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $119
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $121
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $121
+LABELV $119
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $126
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $128
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $118
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $118
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $118
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $118
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $118
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $117
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $140
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $139
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $144
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $144
+LABELV $139
+LABELV $118
+CNSTI4 0
+RETI4
+LABELV $116
+endproc BotReachedGoal 40 16
+proc BotGetItemLongTermGoal 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $147
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $149
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $151
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+LABELV $154
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $146
+JUMPV
+LABELV $151
+CNSTI4 1
+RETI4
+LABELV $146
+endproc BotGetItemLongTermGoal 20 16
+proc BotGetLongTermGoal 520 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $156
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 272+4
+INDIRI4
+CNSTI4 0
+NEI4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRLP4 456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 0
+EQF4 $161
+ADDRLP4 456
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 460
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 460
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 464
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 260
+ADDRLP4 272+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 472
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+CNSTF4 1182793728
+GEF4 $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $178
+LABELV $170
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 272+16
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $181
+ADDRLP4 400
+INDIRI4
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ADDRLP4 272+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7152
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7156
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7160
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7164
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7168
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7172
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $181
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $184
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 272+4
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $186
+ADDRLP4 456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 0
+EQF4 $189
+ADDRLP4 456
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 460
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 460
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $189
+ADDRLP4 260
+ADDRLP4 272+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 468
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 472
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+ADDRLP4 476
+INDIRF4
+ADDRLP4 476
+INDIRF4
+MULF4
+GEF4 $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 484
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 452
+ADDRLP4 484
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+GEF4 $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $205
+LABELV $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 488
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $211
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $213
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 492
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 492
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1028443341
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+MULF4
+GEF4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $216
+LABELV $214
+LABELV $211
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $218
+ADDRLP4 260
+ADDRLP4 272+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 496
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 496
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 496
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $218
+LABELV $209
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 440
+ARGP4
+ADDRLP4 496
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRLP4 260
+ADDRLP4 440
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 440+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 440+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 508
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 508
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 508
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTI4 400
+ARGI4
+ADDRLP4 508
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $233
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $236
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 480
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 272+16
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $240
+ADDRLP4 400
+INDIRI4
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ADDRLP4 272+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7152
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7156
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7160
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7164
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7168
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7172
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $240
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $243
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 492
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $243
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $184
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRF4
+LEF4 $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $248
+LABELV $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $250
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $250
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 0
+EQF4 $252
+ADDRLP4 460
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $255
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $252
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 472
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+CNSTF4 1199570944
+GEF4 $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 476
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 480
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 480
+INDIRF4
+ADDF4
+ADDRLP4 480
+INDIRF4
+ADDRLP4 476
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $261
+LABELV $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $262
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $265
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 0
+EQF4 $267
+ADDRLP4 460
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+SUBF4
+LEF4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 6448
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+INDIRI4
+NEI4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $275
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 0
+EQF4 $277
+ADDRLP4 460
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $279
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $277
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $285
+LABELV $283
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $275
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 9
+EQI4 $290
+ADDRLP4 460
+INDIRI4
+CNSTI4 10
+NEI4 $288
+LABELV $290
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $291
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 468
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $291
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $298
+LABELV $296
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotSetTeamCampDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7672
+ADDP4
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ARGP4
+ADDRLP4 484
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 488
+ADDRFP4 0
+INDIRP4
+CNSTI4 7672
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRF4
+ADDRLP4 488
+INDIRI4
+ADDRLP4 488
+INDIRI4
+MULI4
+CVIF4 4
+GEF4 $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 492
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $309
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 440
+ARGP4
+ADDRLP4 496
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRLP4 260
+ADDRLP4 440
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 440+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 440+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 508
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 508
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 508
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+EQI4 $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 508
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 452
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+GEF4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $320
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $329
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $331
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $335
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $335
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $337
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $337
+ADDRLP4 4
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 9668
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $342
+JUMPV
+LABELV $339
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $343
+ADDRLP4 4
+ARGP4
+ADDRGP4 $345
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $343
+LABELV $340
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $342
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 9676
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $351
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $353
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $352
+JUMPV
+LABELV $353
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 480
+ADDRFP4 0
+INDIRP4
+CNSTI4 9676
+ADDP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+ADDRLP4 480
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $355
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 480
+ADDRFP4 0
+INDIRP4
+CNSTI4 9676
+ADDP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+ADDRLP4 480
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $356
+LABELV $352
+LABELV $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $359
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $357
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $335
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $362
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $364
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $366
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $367
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $371
+ADDRLP4 468
+INDIRI4
+CNSTI4 1
+EQI4 $372
+ADDRGP4 $368
+JUMPV
+LABELV $371
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $372
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $373
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 484
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRLP4 484
+INDIRI4
+CNSTI4 1
+EQI4 $379
+ADDRGP4 $375
+JUMPV
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $375
+LABELV $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $373
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 468
+INDIRI4
+CNSTI4 1
+EQI4 $388
+ADDRGP4 $384
+JUMPV
+LABELV $387
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $385
+JUMPV
+LABELV $388
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 492
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 492
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $394
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $395
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $361
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $399
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $399
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $402
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $399
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $407
+ADDRGP4 $403
+JUMPV
+LABELV $406
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $404
+JUMPV
+LABELV $407
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $404
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $360
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $412
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $414
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $416
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $366
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $367
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $416
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $420
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 464
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+EQI4 $427
+ADDRLP4 464
+INDIRI4
+CNSTI4 1
+EQI4 $428
+ADDRGP4 $424
+JUMPV
+LABELV $427
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $428
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $435
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $437
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $440
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $445
+ADDRGP4 $441
+JUMPV
+LABELV $444
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $442
+JUMPV
+LABELV $445
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $442
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 488
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 488
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $448
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $413
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $452
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $402
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $454
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $412
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $457
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $460
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $440
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $466
+ADDRGP4 $462
+JUMPV
+LABELV $465
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $466
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 484
+INDIRF4
+CNSTF4 1112014848
+LEF4 $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRLP4 492
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 492
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $469
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 500
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 500
+INDIRF4
+CNSTF4 1163984896
+GEF4 $473
+ADDRLP4 504
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 504
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $475
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $456
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $479
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 464
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+EQI4 $484
+ADDRLP4 464
+INDIRI4
+CNSTI4 1
+EQI4 $485
+ADDRGP4 $481
+JUMPV
+LABELV $484
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $485
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $482
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $486
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $492
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $494
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $440
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $499
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $500
+ADDRGP4 $496
+JUMPV
+LABELV $499
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $500
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $497
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRLP4 488
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 488
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $503
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $505
+ADDRLP4 472
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+CNSTF4 0
+EQF4 $507
+ADDRLP4 472
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $507
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $509
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $440
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $507
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $510
+ADDRLP4 480
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 480
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $510
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $512
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $512
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $505
+LABELV $477
+LABELV $457
+LABELV $413
+LABELV $361
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 464
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+RETI4
+LABELV $155
+endproc BotGetLongTermGoal 520 16
+proc BotLongTermGoal 436 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7396
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $515
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 7396
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 404
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 404
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7396
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 412
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $517
+ADDRLP4 404
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 404
+INDIRF4
+CNSTF4 0
+GEF4 $520
+ADDRLP4 404
+INDIRF4
+NEGF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $520
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 408
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $520
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+EQI4 $523
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12+16
+ARGP4
+ADDRLP4 408
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRLP4 412
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRLP4 412
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRFP4 0
+INDIRP4
+CNSTI4 7380
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7352
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7340
+ADDP4
+ADDRLP4 12+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7356
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7360
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7364
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7368
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7372
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7376
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $527
+LABELV $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+EQI4 $530
+ADDRFP4 0
+INDIRP4
+CNSTI4 7400
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $530
+ADDRFP4 0
+INDIRP4
+CNSTI4 7400
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 7408
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $532
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7340
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7344
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7348
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7408
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 428
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 428
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $538
+ADDRLP4 396
+INDIRF4
+CNSTF4 1176256512
+GEF4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 7408
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $540
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7340
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $536
+ADDRLP4 396
+INDIRF4
+CNSTF4 1215570944
+LEF4 $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 428
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 428
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $544
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 432
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 432
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $542
+LABELV $515
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+RETI4
+LABELV $514
+endproc BotLongTermGoal 436 16
+export AIEnter_Intermission
+proc AIEnter_Intermission 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $556
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $553
+endproc AIEnter_Intermission 16 16
+export AINode_Intermission
+proc AINode_Intermission 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $560
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRFP4 0
+INDIRP4
+CNSTI4 6568
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+LABELV $562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $559
+JUMPV
+LABELV $560
+CNSTI4 1
+RETI4
+LABELV $559
+endproc AINode_Intermission 8 8
+export AIEnter_Observer
+proc AIEnter_Observer 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $565
+endproc AIEnter_Observer 8 16
+export AINode_Observer
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $568
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $567
+JUMPV
+LABELV $568
+CNSTI4 1
+RETI4
+LABELV $567
+endproc AINode_Observer 4 8
+export AIEnter_Stand
+proc AIEnter_Stand 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $571
+endproc AIEnter_Stand 8 16
+export AINode_Stand
+proc AINode_Stand 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $574
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $573
+JUMPV
+LABELV $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+LABELV $574
+ADDRFP4 0
+INDIRP4
+CNSTI4 6568
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $573
+JUMPV
+LABELV $579
+CNSTI4 1
+RETI4
+LABELV $573
+endproc AINode_Stand 4 12
+export AIEnter_Respawn
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+LABELV $582
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $588
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRGP4 $588
+JUMPV
+LABELV $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $594
+LABELV $592
+LABELV $588
+CNSTI4 1
+RETI4
+LABELV $586
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 96 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $597
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $597
+CNSTI4 2
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $597
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $599
+CNSTI4 3
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $599
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $601
+CNSTI4 4
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $601
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $603
+CNSTI4 5
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $603
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5440
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 5488
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $605
+CNSTI4 6
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $605
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5444
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 5492
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $607
+CNSTI4 7
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $607
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $609
+CNSTI4 8
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $609
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $611
+CNSTI4 9
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $611
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $613
+CNSTI4 10
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $613
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $615
+CNSTI4 11
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $615
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $617
+CNSTI4 12
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $617
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LEI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LEI4 $619
+CNSTI4 13
+RETI4
+ADDRGP4 $596
+JUMPV
+LABELV $619
+CNSTI4 -1
+RETI4
+LABELV $596
+endproc BotSelectActivateWeapon 96 0
+export BotClearPath
+proc BotClearPath 376 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $622
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+NEI4 $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 264
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $633
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $633
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $635
+ADDRLP4 340
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $637
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $639
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 352
+CNSTP4 0
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $645
+ADDRLP4 276+52
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $641
+LABELV $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $641
+LABELV $639
+LABELV $637
+LABELV $635
+LABELV $624
+LABELV $622
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $648
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+NEI4 $648
+ADDRLP4 256
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 260
+CNSTI4 -1
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $653
+JUMPV
+LABELV $650
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 12+12+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+12+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+12+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 336
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+GEF4 $664
+ADDRLP4 256
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $664
+LABELV $651
+ADDRLP4 248
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $653
+ADDRLP4 248
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+INDIRI4
+LTI4 $650
+ADDRLP4 260
+INDIRI4
+CNSTI4 -1
+EQI4 $666
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 264
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $675
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $675
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $677
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $677
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $678
+JUMPV
+LABELV $677
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $679
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $680
+LABELV $678
+LABELV $676
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $681
+ADDRLP4 360
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $683
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $691
+ADDRLP4 276+52
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $687
+LABELV $691
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $687
+LABELV $685
+LABELV $683
+LABELV $681
+LABELV $666
+LABELV $648
+LABELV $621
+endproc BotClearPath 376 28
+export AIEnter_Wait
+proc AIEnter_Wait 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $694
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Wait
+ASGNP4
+LABELV $692
+endproc AIEnter_Wait 212 16
+export AINode_Wait
+proc AINode_Wait 124 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $699
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $698
+JUMPV
+LABELV $699
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $702
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $704
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $698
+JUMPV
+LABELV $702
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $707
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $698
+JUMPV
+LABELV $705
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $708
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $708
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $710
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $712
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 100
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $716
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $718
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $698
+JUMPV
+LABELV $716
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $718
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $698
+JUMPV
+LABELV $714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $719
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $719
+ADDRLP4 64
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $719
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $725
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 12+24
+INDIRI4
+ASGNI4
+LABELV $725
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $729
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $731
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $698
+JUMPV
+LABELV $729
+CNSTI4 1
+RETI4
+LABELV $698
+endproc AINode_Wait 124 12
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $733
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $732
+endproc AIEnter_Seek_ActivateEntity 8 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 344 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $737
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $735
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $738
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $740
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $738
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $743
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $744
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $744
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $746
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $748
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $750
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $748
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 308
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 308
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 312
+INDIRI4
+EQI4 $751
+ADDRLP4 76
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 320
+CNSTP4 0
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $757
+ADDRLP4 76+52
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $753
+LABELV $757
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $758
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 332
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 332
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRLP4 340
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $762
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $762
+LABELV $758
+LABELV $753
+LABELV $751
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $764
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+4
+INDIRI4
+CNSTI4 0
+NEI4 $766
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $769
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $766
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 132+16
+ARGP4
+ADDRLP4 316
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+NEI4 $770
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $770
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $773
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $775
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $775
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $777
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $779
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $779
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $782
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+LABELV $778
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $773
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $765
+JUMPV
+LABELV $764
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $784
+JUMPV
+LABELV $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $785
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $787
+LABELV $785
+LABELV $784
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $789
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $791
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $793
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $793
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $782
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+LABELV $792
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $789
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $795
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $795
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $797
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $797
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $765
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $801
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 320
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 320
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $801
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $808
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $812
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $812
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $808
+LABELV $799
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $815
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $816
+JUMPV
+LABELV $815
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+CNSTI4 0
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 320
+INDIRI4
+EQI4 $820
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRLP4 56
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 332
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $820
+JUMPV
+LABELV $819
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 264
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $830
+ADDRLP4 56
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $831
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 324
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $828
+LABELV $820
+LABELV $816
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $837
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 316
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $841
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $843
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $845
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $844
+JUMPV
+LABELV $843
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $845
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $734
+JUMPV
+LABELV $841
+CNSTI4 1
+RETI4
+LABELV $734
+endproc AINode_Seek_ActivateEntity 344 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $847
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $850
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $850
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $848
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $846
+endproc AIEnter_Seek_NBG 212 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $855
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $856
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $858
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $856
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $861
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $862
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $862
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $864
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $864
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $866
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $866
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $868
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $870
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $868
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $875
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $873
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $875
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $871
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $877
+JUMPV
+LABELV $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $878
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $878
+LABELV $877
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $880
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $882
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $880
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $883
+CNSTI4 0
+RETI4
+ADDRGP4 $851
+JUMPV
+LABELV $883
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $885
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $885
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $887
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $888
+JUMPV
+LABELV $887
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $892
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 200
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 188
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $902
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+LABELV $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $910
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $911
+JUMPV
+LABELV $910
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $911
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $900
+LABELV $892
+LABELV $888
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $917
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $917
+CNSTI4 1
+RETI4
+LABELV $851
+endproc AINode_Seek_NBG 208 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $922
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $925
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $923
+JUMPV
+LABELV $922
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $925
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $923
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $921
+endproc AIEnter_Seek_LTG 212 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 224 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $928
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $930
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $928
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $931
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $933
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $931
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $937
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $937
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $939
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $941
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $941
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $943
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $945
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $943
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 172
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $948
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $950
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $948
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $950
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckTeamScores
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $951
+CNSTI4 1
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $951
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWantsToCamp
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $953
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $955
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $958
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $959
+JUMPV
+LABELV $958
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $959
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $960
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $956
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $960
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $964
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $956
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $964
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $956
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $956
+ADDRLP4 108
+CNSTI4 80
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $955
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotNearbyGoalPickupRange_LTG
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 52+12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $973
+ADDRLP4 196
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $973
+ADDRLP4 108
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $973
+LABELV $956
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $975
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $977
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $975
+LABELV $953
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $978
+CNSTI4 0
+RETI4
+ADDRGP4 $926
+JUMPV
+LABELV $978
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $980
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $980
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $982
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $983
+JUMPV
+LABELV $982
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $986
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $987
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $987
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $987
+JUMPV
+LABELV $986
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 116
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $997
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $998
+JUMPV
+LABELV $997
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 0
+EQF4 $1003
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $1007
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $1007
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 220
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1007
+LABELV $1004
+LABELV $998
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 216
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $995
+LABELV $987
+LABELV $983
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1013
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1013
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1017
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+GEF4 $1019
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $1021
+LABELV $1019
+LABELV $1017
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_Random
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $926
+endproc AINode_Seek_LTG 224 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1024
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $1023
+endproc AIEnter_Battle_Fight 12 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1024
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $1025
+endproc AIEnter_Battle_SuicidalFight 12 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 328 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 240
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1028
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1030
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1028
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $1031
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1031
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1034
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1036
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1034
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1037
+CNSTI4 1
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1037
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+LTI4 $1041
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+LABELV $1041
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1042
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1039
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 52+4
+INDIRI4
+CNSTI4 0
+NEI4 $1043
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1046
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1043
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $1051
+ADDRFP4 0
+INDIRP4
+CNSTI4 6448
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+NEI4 $1053
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_Kill
+CALLI4
+pop
+LABELV $1053
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1055
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1047
+ADDRLP4 52
+ARGP4
+ADDRLP4 292
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1056
+LABELV $1048
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1058
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1058
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1060
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1062
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 244
+ADDRLP4 52+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1065
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1071
+ADDRLP4 308
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1067
+LABELV $1071
+ADDRLP4 244+8
+ADDRLP4 244+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1067
+LABELV $1065
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 244
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1073
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1073
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $1073
+LABELV $1062
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1075
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1077
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1079
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1077
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1079
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1075
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1080
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1082
+ADDRLP4 256
+CNSTI4 150
+ASGNI4
+ADDRGP4 $1083
+JUMPV
+LABELV $1082
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotNearbyGoalPickupRange_NoLTG
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 308
+INDIRI4
+ASGNI4
+LABELV $1083
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 184
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 256
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1087
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1085
+LABELV $1080
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1088
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1088
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1090
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1090
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1092
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1093
+JUMPV
+LABELV $1092
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+LABELV $1093
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1095
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1096
+JUMPV
+LABELV $1095
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1096
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1098
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1100
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1102
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1100
+LABELV $1098
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+LEI4 $1103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+pop
+LABELV $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+LEI4 $1105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+pop
+LABELV $1105
+CNSTI4 1
+RETI4
+LABELV $1026
+endproc AINode_Battle_Fight 328 16
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1108
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $1107
+endproc AIEnter_Battle_Chase 8 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 372 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 236
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1113
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1116
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1119
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1122
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1120
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+LTI4 $1125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1123
+LABELV $1125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1126
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1123
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108+4
+INDIRI4
+CNSTI4 0
+NEI4 $1127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1130
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1127
+ADDRLP4 108
+ARGP4
+ADDRLP4 300
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1133
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1134
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1136
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1136
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1138
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $1138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1142
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1143
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1145
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1146
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1148
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1146
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1161
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 332
+INDIRF4
+CNSTF4 0
+EQF4 $1165
+ADDRLP4 332
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $1163
+LABELV $1165
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1166
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1163
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1167
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1169
+ADDRLP4 240
+CNSTI4 150
+ASGNI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1169
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotNearbyGoalPickupRange_NoLTG
+CALLI4
+ASGNI4
+ADDRLP4 240
+ADDRLP4 336
+INDIRI4
+ASGNI4
+LABELV $1170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1172
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 240
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1174
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1172
+LABELV $1167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1175
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1175
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1177
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1180
+JUMPV
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $1183
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1185
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1186
+JUMPV
+LABELV $1187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+ADDRGP4 $1186
+JUMPV
+LABELV $1185
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $1190
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56+40+4
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 348
+INDIRF4
+CNSTF4 1110704128
+LEF4 $1193
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ADDRLP4 352
+INDIRP4
+INDIRF4
+CNSTF4 1110704128
+SUBF4
+ASGNF4
+ADDRGP4 $1194
+JUMPV
+LABELV $1193
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56+40+4
+INDIRF4
+ARGF4
+ADDRLP4 352
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 352
+INDIRF4
+CNSTF4 3258187776
+GEF4 $1197
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+ADDRGP4 $1198
+JUMPV
+LABELV $1197
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ADDRLP4 56+40+4
+INDIRF4
+ASGNF4
+LABELV $1198
+LABELV $1194
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 360
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 56+40
+INDIRF4
+ASGNF4
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 364
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 368
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1190
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1204
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1204
+ADDRLP4 256
+ADDRLP4 244
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 244+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 244+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1205
+JUMPV
+LABELV $1204
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 244
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1210
+ADDRLP4 256
+ADDRLP4 244
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 244+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 244+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1211
+JUMPV
+LABELV $1210
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $1211
+LABELV $1205
+LABELV $1186
+ADDRLP4 348
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 348
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1183
+LABELV $1180
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1217
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $1217
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1222
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+NEI4 $1224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1228
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1226
+CNSTI4 1
+RETI4
+LABELV $1109
+endproc AINode_Battle_Chase 372 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1230
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $1229
+endproc AIEnter_Battle_Retreat 8 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 376 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 252
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1233
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1235
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1233
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1236
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1238
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1236
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1241
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1242
+CNSTI4 1
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1242
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+LTI4 $1246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1244
+LABELV $1246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1247
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1244
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108+4
+INDIRI4
+CNSTI4 0
+NEI4 $1248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1251
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1248
+ADDRLP4 108
+ARGP4
+ADDRLP4 308
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1254
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1257
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1257
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1259
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1261
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1259
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1264
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1265
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 108+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1268
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1274
+ADDRLP4 336
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1270
+LABELV $1274
+ADDRLP4 240+8
+ADDRLP4 240+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1270
+LABELV $1268
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1276
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1276
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+LABELV $1276
+LABELV $1265
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $1278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1280
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1278
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1281
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 336
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1285
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1283
+LABELV $1281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckTeamScores
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 340
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1288
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1286
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1289
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1291
+ADDRLP4 256
+CNSTI4 150
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+ADDRLP4 256
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1292
+JUMPV
+LABELV $1294
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+ADDRLP4 256
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1292
+JUMPV
+LABELV $1298
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+ADDRLP4 256
+CNSTI4 80
+ASGNI4
+ADDRGP4 $1292
+JUMPV
+LABELV $1291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotNearbyGoalPickupRange_LTG
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $1292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1306
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 256
+INDIRI4
+CNSTI4 100
+DIVI4
+CVIF4 4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1308
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1306
+LABELV $1289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1309
+CNSTI4 0
+RETI4
+ADDRGP4 $1231
+JUMPV
+LABELV $1309
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1311
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+EQI4 $1313
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1314
+JUMPV
+LABELV $1313
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 356
+INDIRI4
+NEI4 $1317
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 356
+INDIRI4
+NEI4 $1317
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1320
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1321
+JUMPV
+LABELV $1322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+ADDRGP4 $1321
+JUMPV
+LABELV $1320
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1325
+ADDRLP4 264
+ADDRLP4 240
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264+4
+ADDRLP4 240+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264+8
+ADDRLP4 240+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1326
+JUMPV
+LABELV $1325
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $1326
+ADDRLP4 372
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 372
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1321
+LABELV $1317
+LABELV $1314
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1332
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1337
+JUMPV
+LABELV $1336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1337
+CNSTI4 1
+RETI4
+LABELV $1231
+endproc AINode_Battle_Retreat 376 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1340
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1343
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $1341
+JUMPV
+LABELV $1340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1343
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $1341
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1339
+endproc AIEnter_Battle_NBG 212 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 364 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1347
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1345
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1348
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1350
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1348
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1353
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1354
+CNSTI4 1
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1354
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+LTI4 $1358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1356
+LABELV $1358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1359
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108+4
+INDIRI4
+CNSTI4 0
+NEI4 $1360
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1363
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1360
+ADDRLP4 108
+ARGP4
+ADDRLP4 300
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1366
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1367
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1369
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1371
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $1371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1373
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 108+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1376
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1382
+ADDRLP4 324
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1378
+LABELV $1382
+ADDRLP4 240+8
+ADDRLP4 240+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1378
+LABELV $1376
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1384
+ADDRLP4 328
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1384
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+LABELV $1384
+LABELV $1373
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1386
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1388
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1390
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1390
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1386
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $1391
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1392
+JUMPV
+LABELV $1391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1393
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1393
+LABELV $1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1395
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1399
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1399
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1395
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1400
+CNSTI4 0
+RETI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1400
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1402
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1402
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+EQI4 $1404
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1405
+JUMPV
+LABELV $1404
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1408
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 348
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1411
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1413
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1412
+JUMPV
+LABELV $1413
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+ADDRGP4 $1412
+JUMPV
+LABELV $1411
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1416
+ADDRLP4 256
+ADDRLP4 240
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 240+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 240+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1417
+JUMPV
+LABELV $1416
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $1417
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1412
+LABELV $1408
+LABELV $1405
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1423
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1423
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1427
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1428
+JUMPV
+LABELV $1427
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1428
+CNSTI4 1
+RETI4
+LABELV $1344
+endproc AINode_Battle_NBG 364 20
+bss
+export nodeswitch
+align 1
+LABELV nodeswitch
+skip 7344
+export numnodeswitches
+align 4
+LABELV numnodeswitches
+skip 4
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamFormationDist
+import BotSetTeamCampDist
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotDetermineVisibleTeammates
+import BotTeamAI
+import AIEnter_Seek_Camp
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import maxclients
+import mapname
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotGoHarvest
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotCheckBlockedTeammates
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack_New
+import BotCheckAttack
+import BotAimAtEnemy_New
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotChooseRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotCountVisibleEnemies
+import BotCountVisibleTeamMatesAndEnemies
+import BotCountAllTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotHasScout
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotOnlyPickupImportantItems
+import BotAIWaiting
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotCheckTeamScores
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotNearbyGoalPickupRange_LTG
+import BotNearbyGoalPickupRange_NoLTG
+import BotUpdateBattleInventory
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_alt_attack
+import bot_alt_aim
+import bot_alt_pickup
+import bot_alt_aggressive
+import bot_teamavoidpickup
+import bot_teamblock
+import bot_teamredstrategy
+import bot_teambluestrategy
+import bot_shownodechanges
+import bot_noaccerror
+import bot_nowalk
+import bot_noshoot
+import bot_equalizer_teambon
+import bot_equalizer_fembon
+import bot_equalizer_react
+import bot_equalizer_aim
+import bot_equalize
+import bot_predictobstacles
+import bot_blocktime
+import bot_checktime
+import bot_visualrange
+import bot_memorydump
+import bot_interbreedwrite
+import bot_interbreedcycle
+import bot_interbreedbots
+import bot_interbreedchar
+import bot_challenge
+import bot_rocketjump
+import bot_report
+import bot_pause
+import bot_nochat
+import bot_fastchat
+import bot_testclusters
+import bot_testsolid
+import bot_testrchat
+import bot_testichat
+import bot_reloadcharacters
+import bot_thinktime
+import bot_saveroutingcache
+import bot_aasoptimize
+import bot_forcewrite
+import bot_forcereachability
+import bot_forceclustering
+import bot_visualizejumppads
+import bot_reachability
+import bot_groundonly
+import bot_maxdebugpolys
+import bot_debug
+import bot_developer
+import bot_enable
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_TraceEntities
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1399
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1390
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1366
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1363
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1359
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1353
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1350
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1347
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1343
+byte 1 94
+byte 1 54
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1308
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1288
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1285
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1280
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1264
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $1261
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1254
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1251
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1247
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1241
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1238
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1235
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1230
+byte 1 94
+byte 1 51
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $1228
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1174
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1166
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1148
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 46
+byte 1 0
+align 1
+LABELV $1145
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $1142
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1133
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1130
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1126
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1122
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1119
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1116
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1113
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1108
+byte 1 94
+byte 1 53
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 0
+align 1
+LABELV $1102
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1087
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1079
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1055
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1046
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1042
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1036
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1033
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1030
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1024
+byte 1 94
+byte 1 49
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 0
+align 1
+LABELV $977
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $950
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $945
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $936
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $933
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $930
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $925
+byte 1 94
+byte 1 50
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $882
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $875
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $870
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $861
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $858
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $855
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $850
+byte 1 94
+byte 1 50
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $845
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $782
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $781
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $769
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $750
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 46
+byte 1 0
+align 1
+LABELV $743
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $740
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $737
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $733
+byte 1 94
+byte 1 52
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $731
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $718
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $707
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $704
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $701
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $697
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $696
+byte 1 94
+byte 1 52
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $591
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $583
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $581
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $578
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $572
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $570
+byte 1 79
+byte 1 66
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $566
+byte 1 79
+byte 1 66
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $564
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $556
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $555
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $554
+byte 1 97
+byte 1 105
+byte 1 78
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $522
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $519
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $509
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $440
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $439
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $402
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $401
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $367
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $366
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $359
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $346
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $345
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 0
+align 1
+LABELV $328
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $309
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $308
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $295
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $287
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $284
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $279
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $272
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $269
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $264
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $255
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $254
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $245
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $238
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $235
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 71
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 33
+byte 1 0
+align 1
+LABELV $215
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $191
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $164
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $163
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $83
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $82
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $78
+byte 1 0
+align 1
+LABELV $77
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $72
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
@@ -0,0 +1,46523 @@
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $70
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $72
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $74
+CNSTI4 1
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $74
+ADDRFP4 0
+INDIRP4
+CNSTI4 5560
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $76
+CNSTI4 2
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $76
+CNSTI4 0
+RETI4
+LABELV $71
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+LTI4 $81
+ADDRLP4 1024
+INDIRI4
+CNSTI4 64
+LTI4 $79
+LABELV $81
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+CNSTI4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $85
+ADDRLP4 0
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $82
+LABELV $85
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $82
+CNSTI4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $88
+ADDRLP4 0
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+NEI4 $86
+LABELV $88
+CNSTI4 1
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $86
+CNSTI4 2
+RETI4
+LABELV $78
+endproc BotTeam 1044 12
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $93
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $94
+ADDRGP4 $90
+JUMPV
+LABELV $93
+CNSTI4 1
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $94
+CNSTI4 0
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $90
+CNSTI4 2
+RETI4
+LABELV $89
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $95
+JUMPV
+LABELV $96
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $95
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $98
+JUMPV
+LABELV $99
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $98
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $102
+ADDRLP4 8
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $106
+ADDRLP4 8
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $102
+LABELV $106
+ADDRLP4 12
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $107
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $107
+CNSTI4 0
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $102
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $111
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+GEI4 $111
+ADDRLP4 0
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $114
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $116
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $116
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_GetEntityPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $118
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $118
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $120
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $120
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $122
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $122
+CNSTI4 0
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $111
+CNSTI4 1
+RETI4
+LABELV $101
+endproc EntityIsDead 20 4
+proc EntityCarriesFlag 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $125
+CNSTI4 1
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $127
+CNSTI4 1
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $129
+CNSTI4 1
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $129
+CNSTI4 0
+RETI4
+LABELV $124
+endproc EntityCarriesFlag 0 0
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $132
+CNSTI4 1
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $132
+CNSTI4 0
+RETI4
+LABELV $131
+endproc EntityIsShooting 0 0
+proc EntityIsAlreadyMined 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $135
+CNSTI4 1
+RETI4
+ADDRGP4 $134
+JUMPV
+LABELV $135
+CNSTI4 0
+RETI4
+LABELV $134
+endproc EntityIsAlreadyMined 0 0
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $138
+CNSTI4 1
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $138
+CNSTI4 0
+RETI4
+LABELV $137
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $141
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $141
+CNSTI4 0
+RETI4
+LABELV $140
+endproc EntityHasQuad 0 0
+proc EntityHasKamikaze 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $144
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $144
+CNSTI4 0
+RETI4
+LABELV $143
+endproc EntityHasKamikaze 0 0
+proc EntityCarriesCubes 236 8
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $147
+CNSTI4 0
+RETI4
+ADDRGP4 $146
+JUMPV
+LABELV $147
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+232
+INDIRI4
+CNSTI4 0
+LEI4 $149
+CNSTI4 1
+RETI4
+ADDRGP4 $146
+JUMPV
+LABELV $149
+CNSTI4 0
+RETI4
+LABELV $146
+endproc EntityCarriesCubes 236 8
+export EntityIsInvisible
+proc EntityIsInvisible 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $153
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $155
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $157
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $159
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 EntityHasKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $161
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $161
+CNSTI4 1
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $153
+CNSTI4 0
+RETI4
+LABELV $152
+endproc EntityIsInvisible 16 4
+export Bot1FCTFCarryingFlag
+proc Bot1FCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+EQI4 $164
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 5564
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $166
+CNSTI4 1
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $166
+CNSTI4 0
+RETI4
+LABELV $163
+endproc Bot1FCTFCarryingFlag 0 0
+export BotHarvesterCarryingCubes
+proc BotHarvesterCarryingCubes 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $169
+CNSTI4 0
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $171
+CNSTI4 1
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $173
+CNSTI4 1
+RETI4
+ADDRGP4 $168
+JUMPV
+LABELV $173
+CNSTI4 0
+RETI4
+LABELV $168
+endproc BotHarvesterCarryingCubes 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $176
+ADDRGP4 $175
+JUMPV
+LABELV $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7268
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7280
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7276
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $175
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 152 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+LTI4 $179
+ADDRLP4 132
+INDIRI4
+CNSTI4 13
+GTI4 $179
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $200-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $200
+address $182
+address $183
+address $184
+address $185
+address $186
+address $187
+address $180
+address $189
+address $198
+address $198
+address $199
+address $199
+address $199
+code
+LABELV $182
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $184
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $185
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $187
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRGP4 $180
+JUMPV
+LABELV $190
+ADDRLP4 140
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+EQI4 $197
+ADDRLP4 140
+INDIRI4
+CNSTI4 5
+NEI4 $196
+LABELV $197
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $195
+LABELV $196
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $193
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $193
+LABELV $195
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $193
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $198
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $199
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $180
+ADDRGP4 $203
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $178
+endproc BotSetTeamStatus 152 12
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $207
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $213
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $213
+LABELV $210
+LABELV $207
+LABELV $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $215
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7280
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7276
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $219
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $221
+LABELV $219
+LABELV $217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $204
+JUMPV
+LABELV $215
+CNSTI4 0
+RETI4
+LABELV $204
+endproc BotSetLastOrderedTask 60 16
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $224
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $226
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $228
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $226
+LABELV $223
+endproc BotRefuseOrder 8 12
+proc BotCTFSeekGoals 216 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $242
+ADDRGP4 $234
+JUMPV
+LABELV $237
+ADDRLP4 148
+ADDRGP4 ctf_blueflag
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $242
+ADDRLP4 148
+ADDRGP4 ctf_redflag
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRGP4 ctf_redflag+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 188
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 148
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $235
+ADDRLP4 148
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1124073472
+GEF4 $249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 7204
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $250
+ADDRGP4 $203
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $229
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $255
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $229
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 168
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $260
+LABELV $258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $272
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $229
+LABELV $272
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+LTI4 $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $229
+LABELV $275
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 200
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $281
+LABELV $281
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+CNSTI4 6
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+CNSTI4 7
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+CNSTI4 8
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+CNSTI4 10
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+CNSTI4 11
+EQI4 $229
+ADDRLP4 176
+INDIRI4
+CNSTI4 12
+EQI4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $277
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $229
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 6
+EQI4 $229
+ADDRLP4 172
+INDIRI4
+CNSTI4 8
+EQI4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 188
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRGP4 $229
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $297
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $299
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 4
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 5
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 6
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 7
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 8
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 10
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 11
+EQI4 $310
+ADDRLP4 184
+INDIRI4
+CNSTI4 12
+NEI4 $301
+LABELV $310
+ADDRGP4 $229
+JUMPV
+LABELV $301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRGP4 $229
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $313
+ADDRGP4 $229
+JUMPV
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $315
+ADDRGP4 $229
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 50
+GEI4 $317
+ADDRGP4 $229
+JUMPV
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $321
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $322
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $320
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 196
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $323
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $323
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $323
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $327
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $327
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $328
+LABELV $324
+ADDRLP4 208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $229
+endproc BotCTFSeekGoals 216 12
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $336
+LABELV $334
+LABELV $333
+endproc BotCTFRetreatGoals 8 4
+proc Bot1FCTFSeekGoals 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $345
+LABELV $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 164
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $353
+LABELV $351
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 4
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 8
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 10
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 11
+EQI4 $364
+ADDRLP4 152
+INDIRI4
+CNSTI4 12
+NEI4 $355
+LABELV $364
+ADDRGP4 $338
+JUMPV
+LABELV $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $373
+LABELV $373
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 7
+EQI4 $380
+ADDRLP4 156
+INDIRI4
+CNSTI4 8
+EQI4 $380
+ADDRLP4 156
+INDIRI4
+CNSTI4 10
+EQI4 $380
+ADDRLP4 156
+INDIRI4
+CNSTI4 11
+EQI4 $380
+ADDRLP4 156
+INDIRI4
+CNSTI4 12
+NEI4 $375
+LABELV $380
+ADDRGP4 $338
+JUMPV
+LABELV $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $385
+ADDRGP4 $338
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $387
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 6
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 7
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 8
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 10
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 11
+EQI4 $401
+ADDRLP4 164
+INDIRI4
+CNSTI4 12
+NEI4 $391
+LABELV $401
+ADDRGP4 $338
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRGP4 $338
+JUMPV
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $404
+ADDRGP4 $338
+JUMPV
+LABELV $404
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $406
+ADDRGP4 $338
+JUMPV
+LABELV $406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 50
+GEI4 $408
+ADDRGP4 $338
+JUMPV
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $413
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $411
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $414
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $417
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $417
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $418
+LABELV $415
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $338
+endproc Bot1FCTFSeekGoals 192 12
+proc Bot1FCTFRetreatGoals 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $426
+LABELV $424
+LABELV $423
+endproc Bot1FCTFRetreatGoals 12 8
+proc BotObeliskSeekGoals 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $429
+ADDRGP4 $428
+JUMPV
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $431
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $440
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+EQI4 $440
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+EQI4 $440
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+EQI4 $440
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+EQI4 $440
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+EQI4 $440
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+NEI4 $433
+LABELV $440
+ADDRGP4 $428
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $441
+ADDRGP4 $428
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $443
+ADDRGP4 $428
+JUMPV
+LABELV $443
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 50
+GEI4 $445
+ADDRGP4 $428
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $450
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $448
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $451
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $451
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $457
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $457
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $458
+LABELV $452
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $428
+endproc BotObeliskSeekGoals 48 12
+export BotGoHarvest
+proc BotGoHarvest 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $463
+endproc BotGoHarvest 4 12
+proc BotObeliskRetreatGoals 0 0
+LABELV $466
+endproc BotObeliskRetreatGoals 0 0
+proc BotHarvesterSeekGoals 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $467
+JUMPV
+LABELV $468
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $472
+ADDRGP4 $467
+JUMPV
+LABELV $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $476
+LABELV $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $478
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $478
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 2
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 3
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 4
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 5
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 7
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 8
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 10
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 11
+EQI4 $489
+ADDRLP4 156
+INDIRI4
+CNSTI4 12
+NEI4 $480
+LABELV $489
+ADDRGP4 $467
+JUMPV
+LABELV $480
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $490
+ADDRGP4 $467
+JUMPV
+LABELV $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $492
+ADDRGP4 $467
+JUMPV
+LABELV $492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 50
+GEI4 $494
+ADDRGP4 $467
+JUMPV
+LABELV $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $496
+LABELV $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $467
+JUMPV
+LABELV $500
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $504
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $505
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $503
+JUMPV
+LABELV $502
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $503
+ADDRLP4 172
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 172
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $506
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $506
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $510
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $510
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $510
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $511
+LABELV $507
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $467
+endproc BotHarvesterSeekGoals 192 12
+proc BotHarvesterRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $516
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $517
+LABELV $516
+endproc BotHarvesterRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $524
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $524
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $526
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $526
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $528
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskRetreatGoals
+CALLV
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $528
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterRetreatGoals
+CALLV
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $522
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskSeekGoals
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterSeekGoals
+CALLV
+pop
+LABELV $538
+LABELV $537
+LABELV $535
+LABELV $533
+LABELV $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $521
+endproc BotTeamGoals 0 4
+proc BotFirstReachabilityArea 124 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+LTI4 $541
+ADDRLP4 108
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $541
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 76+8
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRLP4 112
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 76
+ADDRLP4 112
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRLP4 112
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $542
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $548
+JUMPV
+LABELV $545
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 botCheckedAreas
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+EQI4 $549
+ADDRGP4 $546
+JUMPV
+LABELV $549
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 botCheckedAreas
+ADDP4
+CNSTU1 1
+ASGNU1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_AreaCenter
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $553
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $555
+ADDRLP4 72
+ADDRLP4 72
+INDIRF4
+CNSTF4 1107296256
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $555
+ADDRLP4 72
+INDIRF4
+ADDRLP4 104
+INDIRF4
+GEF4 $554
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 16+4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $554
+ADDRLP4 16
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $554
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $554
+ADDRLP4 100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $553
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 16+4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $565
+ADDRLP4 16
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $565
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $565
+ADDRLP4 100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $565
+LABELV $554
+LABELV $551
+LABELV $546
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $548
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $545
+LABELV $547
+ADDRLP4 100
+INDIRI4
+RETI4
+LABELV $540
+endproc BotFirstReachabilityArea 124 28
+export BotPointAreaNum
+proc BotPointAreaNum 344 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $570
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+840
+ADDP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $570
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+836
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $570
+ADDRGP4 botCheckedAreas
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 65536
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 280
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $574
+ADDRLP4 280
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $574
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $576
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+LABELV $576
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRLP4 32
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $580
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+840
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+836
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $580
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $578
+ADDRLP4 268
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 268+8
+ADDRLP4 268+8
+INDIRF4
+CNSTF4 1106247680
+SUBF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 312
+INDIRI4
+LTI4 $585
+ADDRLP4 316
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+ADDRLP4 312
+INDIRI4
+EQI4 $585
+ADDRLP4 316
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $585
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $585
+ADDRLP4 268
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 320
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $591
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 324
+INDIRI4
+ASGNI4
+LABELV $591
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $593
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $595
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+840
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+836
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $595
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $593
+ADDRLP4 324
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 240
+ADDRLP4 324
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 324
+INDIRF4
+ASGNF4
+ADDRLP4 240+8
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 256
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 240+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 240+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 240
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 240+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 240+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 240+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 240+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRLP4 240
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $609
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 340
+INDIRI4
+ASGNI4
+LABELV $609
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $613
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+840
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+836
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $613
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $611
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $617
+ADDRLP4 300
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+ADDRLP4 296
+INDIRI4
+EQI4 $617
+ADDRLP4 300
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $617
+ADDRLP4 304
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+ADDRGP4 g_entities+236+48
+ADDP4
+ARGP4
+ADDRLP4 304
+INDIRI4
+ADDRGP4 g_entities+236+60
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $625
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 312
+INDIRI4
+ASGNI4
+LABELV $625
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $629
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+840
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+836
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $629
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $627
+LABELV $617
+ADDRLP4 4
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $636
+JUMPV
+LABELV $633
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $639
+ADDRLP4 304
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+CNSTF4 1132462080
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $640
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $639
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $643
+ADDRLP4 304
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+CNSTF4 1132462080
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $644
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $643
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 304
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $647
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 308
+INDIRI4
+ASGNI4
+LABELV $647
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $651
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+840
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 852
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+836
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $651
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $649
+LABELV $634
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1055286886
+ADDF4
+ASGNF4
+LABELV $636
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $633
+ADDRLP4 32
+INDIRI4
+RETI4
+LABELV $569
+endproc BotPointAreaNum 344 20
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $658
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $656
+LABELV $658
+CNSTI4 3
+ARGI4
+ADDRGP4 $659
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $660
+RETP4
+ADDRGP4 $655
+JUMPV
+LABELV $656
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $655
+endproc ClientSkin 1032 12
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $665
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $663
+LABELV $665
+CNSTI4 3
+ARGI4
+ADDRGP4 $666
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $660
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $662
+JUMPV
+LABELV $663
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $662
+endproc ClientName 1032 12
+export ClientFromName
+proc ClientFromName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $672
+JUMPV
+LABELV $669
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $674
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $668
+JUMPV
+LABELV $674
+LABELV $670
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $672
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $669
+CNSTI4 -1
+RETI4
+LABELV $668
+endproc ClientFromName 1036 12
+export ClientOnSameTeamFromName
+proc ClientOnSameTeamFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $677
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $682
+ADDRGP4 $678
+JUMPV
+LABELV $682
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $684
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $676
+JUMPV
+LABELV $684
+LABELV $678
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $680
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $677
+CNSTI4 -1
+RETI4
+LABELV $676
+endproc ClientOnSameTeamFromName 1040 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $688
+JUMPV
+LABELV $687
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $693
+JUMPV
+LABELV $690
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $694
+ADDRGP4 $692
+JUMPV
+LABELV $694
+LABELV $691
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $693
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $696
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $690
+LABELV $696
+LABELV $692
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $697
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $686
+JUMPV
+LABELV $697
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $688
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $687
+CNSTP4 0
+RETP4
+LABELV $686
+endproc stristr 12 4
+lit
+align 1
+LABELV $700
+byte 1 0
+skip 127
+export EasyClientName
+code
+proc EasyClientName 196 12
+ADDRLP4 5
+ADDRGP4 $700
+INDIRB
+ASGNB 128
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $704
+JUMPV
+LABELV $701
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $702
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $704
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $701
+ADDRLP4 5
+ARGP4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 148
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRGP4 $708
+JUMPV
+LABELV $705
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $706
+ADDRLP4 5
+ARGP4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+LABELV $708
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $705
+ADDRLP4 5
+ARGP4
+ADDRGP4 $710
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $711
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 164
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 164
+INDIRU4
+EQU4 $712
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 164
+INDIRU4
+EQU4 $712
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $714
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $715
+JUMPV
+LABELV $714
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $715
+LABELV $712
+ADDRLP4 168
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 109
+EQI4 $722
+ADDRLP4 168
+INDIRI4
+CNSTI4 77
+NEI4 $716
+LABELV $722
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $725
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+EQI4 $725
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 115
+EQI4 $725
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 83
+NEI4 $716
+LABELV $725
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $716
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 65
+LTI4 $731
+ADDRLP4 172
+INDIRI4
+CNSTI4 90
+GTI4 $731
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $736
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $737
+LABELV $736
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $738
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $737
+LABELV $738
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $733
+LABELV $737
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $739
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $739
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $740
+LABELV $734
+LABELV $731
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $730
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $699
+endproc EasyClientName 196 12
+export BotSynonymContext
+proc BotSynonymContext 12 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRLP4 4
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $744
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $742
+LABELV $744
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $745
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $743
+JUMPV
+LABELV $745
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $743
+JUMPV
+LABELV $742
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $747
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $748
+JUMPV
+LABELV $749
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $748
+JUMPV
+LABELV $747
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $751
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $753
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $754
+LABELV $751
+LABELV $748
+LABELV $743
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $741
+endproc BotSynonymContext 12 4
+proc BotUsesMidRangeWeapon 12 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $756
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $756
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 $760-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $760
+address $759
+address $759
+address $756
+address $756
+address $756
+address $756
+address $759
+address $759
+address $759
+address $759
+address $759
+address $759
+code
+LABELV $759
+CNSTI4 1
+RETI4
+ADDRGP4 $755
+JUMPV
+LABELV $756
+CNSTI4 0
+RETI4
+LABELV $755
+endproc BotUsesMidRangeWeapon 12 0
+proc BotUsesCloseCombatWeapon 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $766
+ADDRGP4 $763
+JUMPV
+LABELV $766
+CNSTI4 1
+RETI4
+ADDRGP4 $762
+JUMPV
+LABELV $763
+CNSTI4 0
+RETI4
+LABELV $762
+endproc BotUsesCloseCombatWeapon 4 0
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $770
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $768
+LABELV $770
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $771
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $771
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $769
+LABELV $767
+endproc BotChooseWeapon 20 8
+proc BotWantsToWalk 16 4
+ADDRGP4 bot_nowalk+12
+INDIRI4
+CNSTI4 0
+EQI4 $774
+CNSTI4 0
+RETI4
+ADDRGP4 $773
+JUMPV
+LABELV $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRF4
+CNSTF4 1036831949
+GEF4 $777
+CNSTI4 0
+RETI4
+ADDRGP4 $773
+JUMPV
+LABELV $777
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $780
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $780
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $795
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $795
+address $780
+address $780
+address $780
+address $780
+address $785
+address $788
+address $780
+address $792
+code
+LABELV $785
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $780
+CNSTI4 0
+RETI4
+ADDRGP4 $773
+JUMPV
+LABELV $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $780
+CNSTI4 0
+RETI4
+ADDRGP4 $773
+JUMPV
+LABELV $792
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $780
+CNSTI4 0
+RETI4
+ADDRGP4 $773
+JUMPV
+LABELV $780
+CNSTI4 1
+RETI4
+LABELV $773
+endproc BotWantsToWalk 16 4
+proc BotSetupForMovement 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+32
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $800
+ADDRLP4 0+36
+CNSTI4 4
+ASGNI4
+ADDRGP4 $801
+JUMPV
+LABELV $800
+ADDRLP4 0+36
+CNSTI4 2
+ASGNI4
+LABELV $801
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $804
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $804
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $807
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $807
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $810
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $810
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $810
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $813
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $813
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 76
+INDIRI4
+EQI4 $816
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $816
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $816
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $796
+endproc BotSetupForMovement 84 12
+proc BotCheckItemPickup 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+GEI4 $822
+ADDRGP4 $821
+JUMPV
+LABELV $822
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $824
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $826
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $828
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $828
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $830
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $830
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $830
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $832
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $832
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $832
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $834
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $834
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $834
+LABELV $826
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $836
+ADDRFP4 0
+INDIRP4
+CNSTI4 7412
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $840
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $842
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $844
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $843
+JUMPV
+LABELV $842
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $845
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $848
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $848
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+EQI4 $848
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $852
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $850
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $850
+LABELV $852
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $853
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $850
+LABELV $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $844
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $850
+LABELV $848
+LABELV $845
+LABELV $843
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $840
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $854
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $856
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $858
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $857
+JUMPV
+LABELV $856
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $859
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $862
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $866
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $864
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $864
+LABELV $866
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $867
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $864
+LABELV $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $858
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $864
+LABELV $862
+LABELV $859
+LABELV $857
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $854
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $839
+LABELV $836
+LABELV $821
+endproc BotCheckItemPickup 28 12
+proc BotUpdateInventory 1292 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5420
+ADDP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1044
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 1052
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 1068
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 1076
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5440
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRLP4 1084
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5444
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 1092
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 1100
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1108
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 1116
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 1124
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 1132
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5492
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 34
+NEI4 $870
+ADDRLP4 1184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $871
+JUMPV
+LABELV $870
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $871
+ADDRFP4 0
+INDIRP4
+CNSTI4 5520
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 35
+NEI4 $873
+ADDRLP4 1192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $874
+JUMPV
+LABELV $873
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+LABELV $874
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 380
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $876
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $877
+JUMPV
+LABELV $876
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $877
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $879
+ADDRLP4 1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $880
+JUMPV
+LABELV $879
+ADDRLP4 1208
+CNSTI4 0
+ASGNI4
+LABELV $880
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $882
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+LABELV $883
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 39
+NEI4 $885
+ADDRLP4 1224
+CNSTI4 1
+ASGNI4
+ADDRGP4 $886
+JUMPV
+LABELV $885
+ADDRLP4 1224
+CNSTI4 0
+ASGNI4
+LABELV $886
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+ADDRLP4 1224
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 40
+NEI4 $888
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRGP4 $889
+JUMPV
+LABELV $888
+ADDRLP4 1232
+CNSTI4 0
+ASGNI4
+LABELV $889
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 41
+NEI4 $891
+ADDRLP4 1240
+CNSTI4 1
+ASGNI4
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRLP4 1240
+CNSTI4 0
+ASGNI4
+LABELV $892
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+ADDRLP4 1240
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 42
+NEI4 $894
+ADDRLP4 1248
+CNSTI4 1
+ASGNI4
+ADDRGP4 $895
+JUMPV
+LABELV $894
+ADDRLP4 1248
+CNSTI4 0
+ASGNI4
+LABELV $895
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+ADDRLP4 1248
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $897
+ADDRLP4 1256
+CNSTI4 1
+ASGNI4
+ADDRGP4 $898
+JUMPV
+LABELV $897
+ADDRLP4 1256
+CNSTI4 0
+ASGNI4
+LABELV $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+ADDRLP4 1256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $900
+ADDRLP4 1264
+CNSTI4 1
+ASGNI4
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRLP4 1264
+CNSTI4 0
+ASGNI4
+LABELV $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 5560
+ADDP4
+ADDRLP4 1264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $903
+ADDRLP4 1272
+CNSTI4 1
+ASGNI4
+ADDRGP4 $904
+JUMPV
+LABELV $903
+ADDRLP4 1272
+CNSTI4 0
+ASGNI4
+LABELV $904
+ADDRFP4 0
+INDIRP4
+CNSTI4 5564
+ADDP4
+ADDRLP4 1272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+EQI4 $905
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $906
+JUMPV
+LABELV $905
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $906
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1288
+ADDRGP4 BotOnlyPickupImportantItems
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $868
+endproc BotUpdateInventory 1292 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $908
+ADDRGP4 $907
+JUMPV
+LABELV $908
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5592
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5588
+ADDP4
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 64
+LTI4 $926
+ADDRLP4 156
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $928
+ADDRLP4 156
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $926
+LABELV $928
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $927
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $924
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $925
+JUMPV
+LABELV $924
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+LABELV $925
+ADDRFP4 0
+INDIRP4
+CNSTI4 5596
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $907
+endproc BotUpdateBattleInventory 160 8
+proc BotWantsToUseKamikaze 100 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $930
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $932
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $932
+CNSTI4 1
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $936
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $936
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $938
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $938
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $938
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LEI4 $940
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LEI4 $940
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $940
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $942
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $942
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $942
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $944
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $944
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $944
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5440
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LEI4 $946
+ADDRFP4 0
+INDIRP4
+CNSTI4 5488
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LEI4 $946
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $946
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5444
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $948
+ADDRFP4 0
+INDIRP4
+CNSTI4 5492
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $948
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $948
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $950
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $950
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $950
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $952
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $952
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $952
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $954
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $954
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $954
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $956
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $956
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $956
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $958
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $958
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $958
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LEI4 $931
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LEI4 $931
+CNSTI4 0
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $930
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $962
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $962
+CNSTI4 1
+RETI4
+ADDRGP4 $929
+JUMPV
+LABELV $962
+LABELV $931
+CNSTI4 0
+RETI4
+LABELV $929
+endproc BotWantsToUseKamikaze 100 0
+proc BotUseKamikaze 320 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $967
+ADDRGP4 $966
+JUMPV
+LABELV $967
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $969
+ADDRGP4 $966
+JUMPV
+LABELV $969
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRLP4 224
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+LTI4 $972
+ADDRLP4 224
+INDIRI4
+CNSTI4 7
+GTI4 $972
+ADDRLP4 224
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1077-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1077
+address $973
+address $972
+address $976
+address $979
+address $1006
+address $1033
+address $1050
+code
+LABELV $973
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleEnemies
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 232
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LEI4 $972
+ADDRLP4 232
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $980
+ADDRGP4 $966
+JUMPV
+LABELV $980
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $982
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1233125376
+GEF4 $991
+ADDRGP4 $966
+JUMPV
+LABELV $991
+LABELV $982
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $993
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1002
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $1002
+LABELV $993
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 252
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 2
+LEI4 $972
+ADDRLP4 252
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $1006
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1007
+ADDRGP4 $966
+JUMPV
+LABELV $1007
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1009
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 272
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1018
+ADDRGP4 $966
+JUMPV
+LABELV $1018
+LABELV $1009
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1020
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1029
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $1029
+LABELV $1020
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 272
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LEI4 $972
+ADDRLP4 272
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $1033
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1037
+ADDRGP4 $1034
+JUMPV
+LABELV $1037
+ADDRLP4 164
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1035
+JUMPV
+LABELV $1034
+ADDRLP4 164
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1035
+ADDRLP4 152
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 152+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 152+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+CNSTF4 1224401224
+GEF4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1049
+ADDRLP4 168+52
+INDIRI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $972
+LABELV $1049
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1051
+ADDRGP4 $966
+JUMPV
+LABELV $1051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1053
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 312
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 312
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1062
+ADDRGP4 $966
+JUMPV
+LABELV $1062
+LABELV $1053
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1064
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 316
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1073
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $966
+JUMPV
+LABELV $1073
+LABELV $1064
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 312
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+LEI4 $972
+ADDRLP4 312
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $972
+LABELV $966
+endproc BotUseKamikaze 320 28
+proc BotBattleUseItems 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1080
+ADDRFP4 0
+INDIRP4
+CNSTI4 5520
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $1082
+LABELV $1080
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseKamikaze
+CALLV
+pop
+LABELV $1079
+endproc BotBattleUseItems 0 4
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1084
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1089
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1089
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1090
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1087
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1092
+CNSTI4 1
+RETI4
+ADDRGP4 $1091
+JUMPV
+LABELV $1092
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $1094
+CNSTI4 1
+RETI4
+ADDRGP4 $1091
+JUMPV
+LABELV $1094
+CNSTI4 0
+RETI4
+LABELV $1091
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9156
+INDIRI4
+CNSTI4 0
+EQI4 $1097
+CNSTI4 1
+RETI4
+ADDRGP4 $1096
+JUMPV
+LABELV $1097
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $1103
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $1101
+LABELV $1103
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1101
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1102
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1096
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $1104
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $1107
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1108
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $1107
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $1108
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1109
+CNSTI4 2
+ARGI4
+ADDRGP4 $1111
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1106
+JUMPV
+LABELV $1109
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1106
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1116
+JUMPV
+LABELV $1113
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1117
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1112
+JUMPV
+LABELV $1117
+LABELV $1114
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1116
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1113
+CNSTP4 0
+RETP4
+LABELV $1112
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1123
+JUMPV
+LABELV $1120
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1121
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1123
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1120
+LABELV $1119
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1125
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $1126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $1125
+LABELV $1124
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $1132
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1132
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1133
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1130
+endproc TeamPlayIsOn 4 0
+export BotCanCamp
+proc BotCanCamp 172 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+GEI4 $1135
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1137
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1137
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1141
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1141
+LABELV $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1143
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1145
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1147
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1147
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $1149
+LABELV $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1149
+LABELV $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1149
+LABELV $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $1149
+LABELV $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1149
+LABELV $1155
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1149
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $1158
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1158
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 128+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 200
+LEI4 $1169
+CNSTI4 0
+RETI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1169
+LABELV $1156
+CNSTI4 1
+RETI4
+LABELV $1134
+endproc BotCanCamp 172 8
+export BotAggression
+proc BotAggression 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 176
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRGP4 bot_alt_aggressive+12
+INDIRI4
+CNSTI4 0
+NEI4 $1172
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1175
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1177
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1179
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1181
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $1183
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1183
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 4+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 4+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 4+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 132+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 132+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1195
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 64
+LTI4 $1197
+ADDRLP4 188
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1201
+ADDRLP4 188
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1197
+LABELV $1201
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1197
+ADDRLP4 156
+INDIRI4
+CNSTI4 42
+LEI4 $1202
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1202
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1204
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1204
+ADDRLP4 152
+INDIRI4
+CNSTI4 40000
+GEI4 $1206
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1206
+ADDRLP4 148
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1208
+ADDRLP4 152
+INDIRI4
+CNSTI4 500
+GEI4 $1208
+ADDRLP4 132
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 4+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $1210
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1210
+LABELV $1208
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1195
+ADDRLP4 156
+INDIRI4
+CNSTI4 200
+LEI4 $1213
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1213
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 1
+NEI4 $1215
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1215
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1218
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1218
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1218
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 13
+NEI4 $1220
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1220
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 8
+NEI4 $1223
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1223
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 7
+NEI4 $1226
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1226
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 6
+NEI4 $1229
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1229
+ADDRLP4 4+112
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1232
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $1235
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1235
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1235
+LABELV $1181
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1237
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1239
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1239
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1241
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1241
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1243
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1243
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+GEF4 $1245
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1245
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+GEF4 $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1249
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1249
+LABELV $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1251
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1253
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1253
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1255
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1257
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1257
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1257
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1259
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1259
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1259
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1261
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1263
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1263
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1263
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1265
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1265
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1265
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1267
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1267
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1267
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1269
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1269
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1269
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1271
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1271
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1271
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1273
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1273
+CNSTI4 100
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1273
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1172
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1275
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1275
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1277
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1277
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1279
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1279
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1281
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $1283
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1283
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 4+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 4+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 4+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 132+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 132+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1295
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 64
+LTI4 $1297
+ADDRLP4 188
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1301
+ADDRLP4 188
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1297
+LABELV $1301
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1297
+ADDRLP4 156
+INDIRI4
+CNSTI4 42
+LEI4 $1302
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1302
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1304
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1304
+ADDRLP4 152
+INDIRI4
+CNSTI4 40000
+GEI4 $1306
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1306
+ADDRLP4 148
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1308
+ADDRLP4 152
+INDIRI4
+CNSTI4 500
+GEI4 $1308
+ADDRLP4 132
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 4+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $1310
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1310
+LABELV $1308
+LABELV $1295
+ADDRLP4 156
+INDIRI4
+CNSTI4 200
+LEI4 $1313
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1313
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 1
+NEI4 $1315
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1315
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1318
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1318
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1318
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 13
+NEI4 $1320
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1323
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1324
+LABELV $1320
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 8
+NEI4 $1325
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1328
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1328
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1329
+LABELV $1325
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 7
+NEI4 $1330
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1330
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 6
+NEI4 $1333
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1333
+ADDRLP4 4+112
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1336
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1336
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $1339
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1339
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1339
+LABELV $1281
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1341
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1341
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1343
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1343
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1345
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1345
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1347
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1347
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+GEF4 $1349
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1349
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+GEF4 $1351
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1353
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1353
+LABELV $1351
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1355
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+LABELV $1357
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1359
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1359
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1361
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1361
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1363
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1363
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1363
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1365
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1365
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1365
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1367
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1367
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1367
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1369
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1369
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1369
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1371
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1371
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1371
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1373
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1373
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1375
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1375
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1375
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1377
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1377
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1377
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1171
+endproc BotAggression 216 16
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1380
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1379
+JUMPV
+LABELV $1380
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1382
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1379
+JUMPV
+LABELV $1382
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1384
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1379
+JUMPV
+LABELV $1384
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1386
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1379
+JUMPV
+LABELV $1386
+CNSTF4 0
+RETF4
+LABELV $1379
+endproc BotFeelingBad 0 0
+proc BotTeammateNeedsNBG 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 396
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1392
+ADDRFP4 4
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1392
+ADDRFP4 4
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1389
+LABELV $1392
+CNSTI4 1
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1389
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1393
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+CNSTI4 50
+LTI4 $1393
+CNSTI4 0
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1393
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1395
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1395
+CNSTI4 0
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1395
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRFP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1397
+CNSTI4 0
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1397
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 20
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1399
+ADDRFP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1399
+CNSTI4 0
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1399
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 24
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1401
+ADDRFP4 4
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 15
+LTI4 $1401
+CNSTI4 0
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1401
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1403
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1403
+CNSTI4 0
+RETI4
+ADDRGP4 $1388
+JUMPV
+LABELV $1403
+CNSTI4 1
+RETI4
+LABELV $1388
+endproc BotTeammateNeedsNBG 32 8
+proc BotAvoidItemPickup 1260 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_teamavoidpickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1406
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1406
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $1409
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1409
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1411
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1411
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $1416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $1416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1224
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+EQI4 $1413
+LABELV $1416
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1413
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1417
+CNSTI4 0
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1417
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1228
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1212
+ADDRLP4 1228
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1420
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1425
+ADDRGP4 $1421
+JUMPV
+LABELV $1425
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRLP4 1232
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $1427
+ADDRGP4 $1421
+JUMPV
+LABELV $1427
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1236
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $1429
+ADDRGP4 $1421
+JUMPV
+LABELV $1429
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $1431
+ADDRGP4 $1421
+JUMPV
+LABELV $1431
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1434
+ADDRGP4 $1421
+JUMPV
+LABELV $1434
+ADDRLP4 4
+ARGP4
+ADDRLP4 1240
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+EQI4 $1436
+ADDRGP4 $1421
+JUMPV
+LABELV $1436
+ADDRLP4 132
+CNSTI4 852
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 1244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1244
+INDIRF4
+CNSTF4 0
+GTF4 $1438
+ADDRGP4 $1421
+JUMPV
+LABELV $1438
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 4+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 4+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 4+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 1188
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 132
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $1447
+ADDRLP4 136
+ARGP4
+ADDRLP4 1252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1252
+INDIRF4
+CNSTF4 1143111680
+CNSTF4 1140457472
+ADDRLP4 1212
+INDIRF4
+MULF4
+SUBF4
+LEF4 $1449
+ADDRGP4 $1421
+JUMPV
+LABELV $1449
+ADDRLP4 4+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 1188
+ARGP4
+ADDRLP4 1256
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $1448
+ADDRGP4 $1421
+JUMPV
+LABELV $1447
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1454
+ADDRGP4 $1421
+JUMPV
+LABELV $1454
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1456
+ADDRGP4 $1421
+JUMPV
+LABELV $1456
+ADDRLP4 136
+ARGP4
+ADDRLP4 1252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1252
+INDIRF4
+CNSTF4 1140457472
+CNSTF4 1137180672
+ADDRLP4 1212
+INDIRF4
+MULF4
+SUBF4
+LEF4 $1458
+ADDRGP4 $1421
+JUMPV
+LABELV $1458
+ADDRLP4 4+44
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 1188
+ARGP4
+ADDRLP4 1256
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $1460
+ADDRGP4 $1421
+JUMPV
+LABELV $1460
+LABELV $1448
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1463
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+LEI4 $1463
+ADDRGP4 $1421
+JUMPV
+LABELV $1463
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1466
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+LEI4 $1466
+ADDRGP4 $1421
+JUMPV
+LABELV $1466
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1469
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1469
+ADDRGP4 $1421
+JUMPV
+LABELV $1469
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+640
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1472
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1472
+ADDRGP4 $1421
+JUMPV
+LABELV $1472
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1252
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $1475
+ADDRLP4 136
+ARGP4
+ADDRLP4 1256
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1256
+INDIRF4
+CNSTF4 1193033728
+LEF4 $1476
+ADDRGP4 $1421
+JUMPV
+LABELV $1475
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 1200
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 1200
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 1200+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 1200+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1479
+ADDRGP4 $1421
+JUMPV
+LABELV $1479
+LABELV $1476
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRLP4 1256
+ADDRGP4 BotTeammateNeedsNBG
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $1485
+CNSTI4 1
+RETI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1485
+LABELV $1421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1423
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1420
+CNSTI4 0
+RETI4
+LABELV $1405
+endproc BotAvoidItemPickup 1260 16
+export BotAIWaiting
+proc BotAIWaiting 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1488
+CNSTI4 0
+RETI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1488
+CNSTI4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $1490
+CNSTI4 0
+RETI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1493
+CNSTI4 0
+RETI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1493
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1495
+CNSTI4 0
+RETI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1495
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotAvoidItemPickup
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1497
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1497
+CNSTI4 0
+RETI4
+LABELV $1487
+endproc BotAIWaiting 12 8
+proc BotHasEmergencyGoal 16 4
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1501
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $1501
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1526-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1526
+address $1502
+address $1519
+address $1501
+address $1523
+code
+LABELV $1502
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1505
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1506
+CNSTI4 1
+RETI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1505
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1509
+CNSTI4 1
+RETI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1509
+LABELV $1506
+LABELV $1503
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1501
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1513
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1501
+CNSTI4 1
+RETI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1513
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1501
+CNSTI4 1
+RETI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1501
+CNSTI4 1
+RETI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1501
+CNSTI4 1
+RETI4
+ADDRGP4 $1499
+JUMPV
+LABELV $1501
+CNSTI4 0
+RETI4
+LABELV $1499
+endproc BotHasEmergencyGoal 16 4
+export BotNearbyGoalPickupRange_NoLTG
+proc BotNearbyGoalPickupRange_NoLTG 220 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 51
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1529
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+EQI4 $1531
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1534
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 12+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 12+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 40000
+GEI4 $1544
+ADDRLP4 140
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 12+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRLP4 184
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $1546
+CNSTI4 10
+RETI4
+ADDRGP4 $1528
+JUMPV
+LABELV $1546
+LABELV $1544
+LABELV $1534
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $1549
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1549
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+SUBI4
+ASGNI4
+LABELV $1549
+LABELV $1531
+LABELV $1529
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1551
+CNSTI4 300
+RETI4
+ADDRGP4 $1528
+JUMPV
+LABELV $1551
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1553
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1553
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1555
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1555
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1557
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1557
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1559
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1559
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1561
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1561
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1561
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1563
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1563
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1563
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1565
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1565
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1565
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1567
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1567
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1567
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1569
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1569
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1569
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1571
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1571
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1573
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1573
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1573
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1575
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1575
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1575
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1577
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1577
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1577
+ADDRLP4 4
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1579
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1579
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $1581
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1583
+ADDRLP4 0
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1583
+LABELV $1581
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $1585
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1585
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1528
+endproc BotNearbyGoalPickupRange_NoLTG 220 16
+export BotNearbyGoalPickupRange_LTG
+proc BotNearbyGoalPickupRange_LTG 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 51
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 16
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotHasEmergencyGoal
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1588
+CNSTI4 50
+RETI4
+ADDRGP4 $1587
+JUMPV
+LABELV $1588
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1590
+CNSTI4 400
+RETI4
+ADDRGP4 $1587
+JUMPV
+LABELV $1590
+ADDRLP4 0
+CNSTI4 200
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1592
+CNSTI4 300
+RETI4
+ADDRGP4 $1587
+JUMPV
+LABELV $1592
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1594
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1594
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1596
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1596
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1598
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1598
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1600
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1602
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1602
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1604
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1604
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1604
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1606
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1606
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1606
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1608
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1608
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1608
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1610
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1610
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1610
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1612
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1612
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1612
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1614
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1614
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1614
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1616
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1616
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1616
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1618
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1618
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1618
+ADDRLP4 4
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1620
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1620
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1622
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1624
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1624
+LABELV $1622
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $1626
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1626
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1587
+endproc BotNearbyGoalPickupRange_LTG 68 16
+export BotOnlyPickupImportantItems
+proc BotOnlyPickupImportantItems 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1629
+CNSTI4 1
+RETI4
+ADDRGP4 $1628
+JUMPV
+LABELV $1629
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1631
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $1633
+CNSTI4 1
+RETI4
+ADDRGP4 $1628
+JUMPV
+LABELV $1633
+LABELV $1631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotHasEmergencyGoal
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1635
+CNSTI4 1
+RETI4
+ADDRGP4 $1628
+JUMPV
+LABELV $1635
+CNSTI4 0
+RETI4
+LABELV $1628
+endproc BotOnlyPickupImportantItems 12 4
+export BotWantsToRetreat
+proc BotWantsToRetreat 164 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1638
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1638
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $1642
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1642
+LABELV $1640
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1644
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+LABELV $1644
+ADDRLP4 136
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 4
+LTI4 $1647
+ADDRLP4 136
+INDIRI4
+CNSTI4 7
+GTI4 $1647
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1676-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1676
+address $1648
+address $1655
+address $1662
+address $1671
+code
+LABELV $1648
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1649
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1649
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1651
+CNSTI4 0
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1651
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1647
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1655
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1656
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1656
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1658
+CNSTI4 0
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1658
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1647
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1662
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1665
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1665
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+LTI4 $1667
+ADDRLP4 160
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1667
+ADDRLP4 160
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1667
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1667
+CNSTI4 0
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1671
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1672
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1672
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $1647
+CNSTI4 0
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 50
+GEI4 $1678
+CNSTI4 1
+RETI4
+ADDRGP4 $1637
+JUMPV
+LABELV $1678
+CNSTI4 0
+RETI4
+LABELV $1637
+endproc BotWantsToRetreat 164 8
+export BotWantsToChase
+proc BotWantsToChase 164 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1681
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1681
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1683
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $1685
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1685
+LABELV $1683
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1687
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+LABELV $1687
+ADDRLP4 136
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 4
+LTI4 $1690
+ADDRLP4 136
+INDIRI4
+CNSTI4 7
+GTI4 $1690
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1720-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1720
+address $1691
+address $1698
+address $1705
+address $1715
+code
+LABELV $1691
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1692
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1692
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1694
+CNSTI4 1
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1694
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1690
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1698
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1699
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1699
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1701
+CNSTI4 1
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1701
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1690
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1705
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1708
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1708
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+LTI4 $1710
+ADDRLP4 160
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1714
+ADDRLP4 160
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1710
+LABELV $1714
+CNSTI4 1
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1710
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1715
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1716
+CNSTI4 0
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1716
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $1690
+CNSTI4 1
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 50
+LEI4 $1722
+CNSTI4 1
+RETI4
+ADDRGP4 $1680
+JUMPV
+LABELV $1722
+CNSTI4 0
+RETI4
+LABELV $1680
+endproc BotWantsToChase 164 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $1724
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $1726
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1726
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1729
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1729
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $1731
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1731
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1733
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $1735
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 120
+GEI4 $1735
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1735
+LABELV $1733
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1737
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $1739
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 120
+GEI4 $1739
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1739
+LABELV $1737
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $1741
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1741
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1741
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 23
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1743
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1743
+CNSTI4 1
+RETI4
+LABELV $1725
+endproc BotCanAndWantsToRocketJump 12 16
+export BotHasScout
+proc BotHasScout 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1746
+CNSTI4 0
+RETI4
+ADDRGP4 $1745
+JUMPV
+LABELV $1746
+CNSTI4 1
+RETI4
+LABELV $1745
+endproc BotHasScout 0 0
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1749
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1749
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1749
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1749
+CNSTI4 0
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1749
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1751
+CNSTI4 0
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1751
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1753
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1755
+CNSTI4 0
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1755
+LABELV $1753
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1757
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 60
+LEI4 $1757
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1757
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1759
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1759
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1759
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1761
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1761
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1761
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1763
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1763
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1763
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1765
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1765
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1765
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1767
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1767
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1767
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1769
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1769
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1769
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1771
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1771
+CNSTI4 1
+RETI4
+ADDRGP4 $1748
+JUMPV
+LABELV $1771
+CNSTI4 0
+RETI4
+LABELV $1748
+endproc BotHasPersistantPowerupAndWeapon 40 0
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $1774
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $1775
+JUMPV
+LABELV $1774
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1775
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1773
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 160 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1777
+CNSTI4 0
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1777
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 6
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 11
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 12
+EQI4 $1792
+ADDRLP4 132
+INDIRI4
+CNSTI4 13
+NEI4 $1779
+LABELV $1792
+CNSTI4 0
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1779
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $1793
+CNSTI4 0
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1793
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $1795
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1795
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $1797
+CNSTI4 0
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1797
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $1802
+JUMPV
+LABELV $1799
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1804
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $1804
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1804
+LABELV $1800
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $1802
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1799
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $1806
+CNSTI4 0
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1806
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1776
+endproc BotWantsToCamp 160 16
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $1810
+JUMPV
+LABELV $1809
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $1810
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1809
+LABELV $1808
+endproc BotDontAvoid 68 12
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1814
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1815
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1816
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1813
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 232 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 360
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1818
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $1820
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $1820
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1202702336
+GEF4 $1820
+CNSTI4 0
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1820
+ADDRFP4 0
+INDIRP4
+CNSTI4 7084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1822
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $1824
+ADDRFP4 0
+INDIRP4
+CNSTI4 7088
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $1824
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7092
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1824
+CNSTI4 0
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1822
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+CNSTF4 1053609165
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 196
+CNSTI4 90
+ASGNI4
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+ADDRLP4 196
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 196
+INDIRI4
+GEI4 $1826
+ADDRLP4 152
+CNSTI4 90
+ASGNI4
+LABELV $1826
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1831
+JUMPV
+LABELV $1828
+ADDRLP4 96
+CNSTI4 852
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1833
+ADDRGP4 $1829
+JUMPV
+LABELV $1833
+ADDRLP4 96
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1835
+ADDRGP4 $1829
+JUMPV
+LABELV $1835
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $1837
+ADDRGP4 $1829
+JUMPV
+LABELV $1837
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 G_GetEntityEventSoundCoefficient
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $1839
+ADDRGP4 $1829
+JUMPV
+LABELV $1839
+ADDRLP4 108
+INDIRI4
+CNSTI4 10
+GEI4 $1841
+ADDRGP4 $1829
+JUMPV
+LABELV $1841
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 G_GetEntityPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1843
+ADDRLP4 84
+ADDRLP4 148
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1844
+JUMPV
+LABELV $1843
+ADDRLP4 84
+ADDRLP4 96
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 96
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 96
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 84
+ADDRLP4 216
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 1056964608
+ADDRLP4 84+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1844
+ADDRLP4 0
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 108
+INDIRI4
+MULI4
+LEI4 $1855
+ADDRGP4 $1829
+JUMPV
+LABELV $1855
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 112
+ARGP4
+ADDRLP4 220
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $1857
+ADDRGP4 $1829
+JUMPV
+LABELV $1857
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+CNSTI4 852
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 g_entities+12+12
+ADDP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_InPVSIgnorePortals
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1859
+ADDRGP4 $1829
+JUMPV
+LABELV $1859
+ADDRLP4 136
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 156
+INDIRF4
+DIVF4
+GTF4 $1863
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 84
+INDIRB
+ASGNB 12
+LABELV $1863
+LABELV $1829
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1831
+ADDRLP4 80
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1828
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $1865
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1073741824
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7092
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7088
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1865
+ADDRFP4 0
+INDIRP4
+CNSTI4 7088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1867
+CNSTI4 0
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1867
+ADDRFP4 0
+INDIRP4
+CNSTI4 7104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1869
+CNSTI4 0
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1869
+LABELV $1818
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $1871
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1875
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1877
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1878
+JUMPV
+LABELV $1877
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1878
+LABELV $1875
+ADDRLP4 104
+INDIRF4
+CNSTF4 1061158912
+GEF4 $1879
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1881
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1882
+JUMPV
+LABELV $1881
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1882
+LABELV $1879
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1893
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 112
+ARGP4
+ADDRLP4 196
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1895
+ADDRGP4 $1872
+JUMPV
+LABELV $1895
+LABELV $1893
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 1128792064
+LEF4 $1897
+ADDRLP4 204
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 212
+CNSTP4 0
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $1914
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1920
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1922
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CNSTF4 1073741824
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1922
+CNSTI4 1
+RETI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1920
+LABELV $1914
+LABELV $1897
+LABELV $1872
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 10
+LTI4 $1871
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1924
+ADDRFP4 0
+INDIRP4
+CNSTI4 7108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1925
+JUMPV
+LABELV $1924
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1925
+CNSTI4 0
+RETI4
+LABELV $1817
+endproc BotRoamGoal 232 28
+export BotChooseRoamGoal
+proc BotChooseRoamGoal 12 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1927
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+MULF4
+GEF4 $1929
+CNSTI4 1
+RETI4
+ADDRGP4 $1926
+JUMPV
+LABELV $1929
+CNSTI4 0
+RETI4
+ADDRGP4 $1926
+JUMPV
+LABELV $1927
+CNSTI4 1
+RETI4
+LABELV $1926
+endproc BotChooseRoamGoal 12 16
+lit
+align 4
+LABELV $1933
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $1934
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1935
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAttackMove
+code
+proc BotAttackMove 532 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $1933
+INDIRB
+ASGNB 12
+ADDRLP4 352
+ADDRGP4 $1934
+INDIRB
+ASGNB 12
+ADDRLP4 364
+ADDRGP4 $1935
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRFP4 4
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+GEI4 $1936
+ADDRLP4 60
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $1936
+ADDRFP4 4
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1938
+ADDRLP4 264+40
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 264+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRFP4 4
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 264+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 264+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 264+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 264+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 264+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 264+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $1938
+ADDRLP4 60
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 432
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 436
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 440
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 444
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $1952
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $1952
+ADDRLP4 260
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1954
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $1954
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+4
+INDIRI4
+CNSTI4 0
+NEI4 $1956
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $1956
+ADDRLP4 24
+ADDRLP4 132+16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 132+16+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 132+16+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 452
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 452
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 456
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1970
+ADDRLP4 56
+INDIRF4
+CNSTF4 1166016512
+CNSTF4 1157627904
+ADDRLP4 456
+INDIRF4
+MULF4
+SUBF4
+LEF4 $1970
+ADDRLP4 328
+ADDRLP4 328
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRGP4 $1971
+JUMPV
+LABELV $1970
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 460
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+EQI4 $1972
+ADDRLP4 328
+CNSTF4 0
+ASGNF4
+LABELV $1972
+LABELV $1971
+ADDRLP4 464
+CNSTF4 1149239296
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 464
+INDIRF4
+ADDF4
+LEF4 $1974
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+LABELV $1974
+ADDRFP4 4
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $1976
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $1976
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1978
+ADDRLP4 472
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 332
+INDIRF4
+GEF4 $1980
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1981
+JUMPV
+LABELV $1980
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1982
+ADDRLP4 476
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 328
+INDIRF4
+GEF4 $1982
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1982
+LABELV $1981
+LABELV $1978
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1984
+ADDRLP4 340
+ADDRFP4 4
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 340+8
+ADDRLP4 340+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 376
+ARGP4
+ADDRLP4 340
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRLP4 364
+ARGP4
+ADDRLP4 132+16
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 376+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1992
+ADDRLP4 376+52
+INDIRI4
+ADDRLP4 320
+INDIRI4
+NEI4 $1988
+LABELV $1992
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+LABELV $1988
+LABELV $1984
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $1993
+ADDRFP4 4
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1995
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1996
+JUMPV
+LABELV $1995
+ADDRFP4 4
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1996
+LABELV $1993
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $2003
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 50
+GTI4 $2002
+LABELV $2003
+ADDRLP4 132+116
+INDIRI4
+CNSTI4 8
+EQI4 $2005
+ADDRLP4 132+116
+INDIRI4
+CNSTI4 9
+EQI4 $2005
+ADDRLP4 132+116
+INDIRI4
+CNSTI4 13
+NEI4 $1997
+LABELV $2005
+ADDRLP4 56
+INDIRF4
+CNSTF4 1128792064
+GEF4 $1997
+ADDRLP4 336
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1997
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+EQI4 $1997
+LABELV $2002
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1998
+JUMPV
+LABELV $1997
+ADDRLP4 480
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 480
+INDIRI4
+EQI4 $2009
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 480
+INDIRI4
+NEI4 $2006
+LABELV $2009
+ADDRLP4 124
+CNSTI4 4500
+ASGNI4
+ADDRLP4 128
+CNSTI4 250
+ASGNI4
+ADDRGP4 $2007
+JUMPV
+LABELV $2006
+ADDRLP4 484
+CNSTI4 7
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+EQI4 $2013
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 484
+INDIRI4
+NEI4 $2010
+LABELV $2013
+ADDRLP4 124
+CNSTI4 2000
+ASGNI4
+ADDRLP4 128
+CNSTI4 150
+ASGNI4
+ADDRGP4 $2011
+JUMPV
+LABELV $2010
+ADDRLP4 488
+CNSTI4 6
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 488
+INDIRI4
+EQI4 $2017
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 488
+INDIRI4
+NEI4 $2014
+LABELV $2017
+ADDRLP4 124
+CNSTI4 700
+ASGNI4
+ADDRLP4 128
+CNSTI4 100
+ASGNI4
+ADDRGP4 $2015
+JUMPV
+LABELV $2014
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2018
+ADDRLP4 124
+CNSTI4 576
+ASGNI4
+ADDRLP4 128
+CNSTI4 192
+ASGNI4
+ADDRGP4 $2019
+JUMPV
+LABELV $2018
+ADDRLP4 492
+CNSTI4 10
+ASGNI4
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 492
+INDIRI4
+NEI4 $2020
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 492
+INDIRI4
+EQI4 $2020
+ADDRLP4 124
+CNSTI4 968
+ASGNI4
+ADDRLP4 128
+CNSTI4 100
+ASGNI4
+ADDRGP4 $2021
+JUMPV
+LABELV $2020
+ADDRLP4 496
+ADDRFP4 4
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 64
+LTI4 $2023
+ADDRLP4 496
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2027
+ADDRLP4 496
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2023
+LABELV $2027
+ADDRLP4 124
+CNSTI4 300
+ASGNI4
+ADDRLP4 128
+CNSTI4 150
+ASGNI4
+ADDRGP4 $2024
+JUMPV
+LABELV $2023
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 504
+INDIRI4
+ASGNI4
+LABELV $2024
+LABELV $2021
+LABELV $2019
+LABELV $2015
+LABELV $2011
+LABELV $2007
+LABELV $1998
+ADDRLP4 260
+INDIRF4
+CNSTF4 1053609165
+GTF4 $2028
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+ADDI4
+CVIF4 4
+LEF4 $2030
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $2032
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $2032
+LABELV $2030
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+SUBI4
+CVIF4 4
+GEF4 $2034
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $2036
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $2036
+LABELV $2034
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $2028
+ADDRLP4 504
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 324
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 260
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 1060320051
+LEF4 $2038
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 324
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2038
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 512
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $2040
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 50
+LEI4 $2040
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2040
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+INDIRF4
+ADDRLP4 324
+INDIRF4
+LEF4 $2042
+ADDRLP4 520
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $2044
+ADDRLP4 524
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+ADDRLP4 524
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2044
+LABELV $2042
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $2046
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2053
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2053
+ADDRLP4 520
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $2059
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2060
+JUMPV
+LABELV $2059
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+ADDI4
+CVIF4 4
+LEF4 $2067
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2068
+JUMPV
+LABELV $2067
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+SUBI4
+CVIF4 4
+GEF4 $2075
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2075
+LABELV $2068
+LABELV $2060
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+EQI4 $2083
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1931
+JUMPV
+LABELV $2083
+ADDRLP4 528
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+ADDRLP4 528
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2047
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $2046
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+LABELV $1931
+endproc BotAttackMove 532 28
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2088
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2086
+LABELV $2088
+CNSTI4 0
+RETI4
+ADDRGP4 $2085
+JUMPV
+LABELV $2086
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2091
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $2089
+LABELV $2091
+CNSTI4 0
+RETI4
+ADDRGP4 $2085
+JUMPV
+LABELV $2089
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $2092
+ADDRLP4 8
+CNSTI4 1376
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1156
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2094
+CNSTI4 1
+RETI4
+ADDRGP4 $2085
+JUMPV
+LABELV $2094
+LABELV $2092
+CNSTI4 0
+RETI4
+LABELV $2085
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2097
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $2101
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $2102
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $2102
+JUMPV
+LABELV $2101
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $2105
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $2105
+LABELV $2102
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $2107
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $2108
+CNSTI4 0
+RETI4
+ADDRGP4 $2096
+JUMPV
+LABELV $2107
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRI4
+NEGI4
+CVIF4 4
+MULF4
+GEF4 $2111
+CNSTI4 0
+RETI4
+ADDRGP4 $2096
+JUMPV
+LABELV $2111
+LABELV $2108
+LABELV $2098
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $2097
+CNSTI4 1
+RETI4
+LABELV $2096
+endproc InFieldOfVision 32 4
+export BotEntityVisible
+proc BotEntityVisible 428 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $2114
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2114
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 84
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 84+4
+INDIRI4
+CNSTI4 0
+NEI4 $2116
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2116
+ADDRLP4 72
+ADDRLP4 84+56
+INDIRF4
+ADDRLP4 84+68
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 84+56+4
+INDIRF4
+ADDRLP4 84+68+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 84+56+8
+INDIRF4
+ADDRLP4 84+68+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 72
+ADDRLP4 356
+INDIRF4
+ADDRLP4 72
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1056964608
+ADDRLP4 72+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 84+16
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 84+16+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 84+16+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 72
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 312
+ADDRGP4 bot_visualrange+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 212
+ARGP4
+ADDRLP4 364
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 312
+INDIRI4
+CVIF4 4
+LEF4 $2152
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2152
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ARGP4
+ADDRLP4 344
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 332
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 344
+ARGP4
+ADDRLP4 368
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+NEI4 $2154
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2154
+ADDRLP4 84
+ARGP4
+ADDRLP4 372
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $2156
+ADDRLP4 212
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 376
+INDIRF4
+CNSTF4 1202702336
+LEF4 $2156
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2156
+ADDRLP4 296
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 296
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 272
+ADDRLP4 296+4
+INDIRF4
+ASGNF4
+ADDRLP4 272+4
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 272+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 1
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 380
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 384
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 320
+ADDRLP4 388
+INDIRI4
+CNSTI4 48
+BANDI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 392
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 396
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 400
+INDIRI4
+CNSTI4 48
+BANDI4
+ASGNI4
+ADDRLP4 292
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 256
+CNSTF4 0
+ASGNF4
+ADDRLP4 404
+CNSTI4 0
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 404
+INDIRI4
+NEI4 $2163
+ADDRLP4 324
+INDIRI4
+ADDRLP4 404
+INDIRI4
+EQI4 $2161
+LABELV $2163
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2161
+ADDRLP4 408
+CNSTI4 0
+ASGNI4
+ADDRLP4 320
+INDIRI4
+ADDRLP4 408
+INDIRI4
+NEI4 $2166
+ADDRLP4 328
+INDIRI4
+ADDRLP4 408
+INDIRI4
+EQI4 $2164
+LABELV $2166
+ADDRLP4 292
+CNSTF4 1056964608
+ASGNF4
+LABELV $2164
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $2167
+ADDRLP4 236
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRLP4 224
+ADDRLP4 72
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRLP4 412
+CNSTP4 0
+ASGNP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2175
+ADDRLP4 0+52
+INDIRI4
+ADDRLP4 268
+INDIRI4
+NEI4 $2171
+LABELV $2175
+ADDRLP4 416
+CNSTI4 0
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 416
+INDIRI4
+EQI4 $2176
+ADDRLP4 288
+INDIRI4
+ADDRLP4 416
+INDIRI4
+EQI4 $2176
+ADDRLP4 212
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 420
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRGP4 $2177
+JUMPV
+LABELV $2176
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $2187
+ADDRLP4 236
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRLP4 420
+CNSTP4 0
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 212
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRGP4 $2188
+JUMPV
+LABELV $2187
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $2199
+ADDRLP4 224
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 420
+CNSTP4 0
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 212
+ADDRLP4 224
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+4
+ADDRLP4 224+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 224+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRGP4 $2200
+JUMPV
+LABELV $2199
+ADDRLP4 252
+CNSTF4 0
+ASGNF4
+LABELV $2200
+LABELV $2188
+LABELV $2177
+ADDRLP4 424
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 252
+INDIRF4
+MULF4
+ADDRLP4 424
+INDIRF4
+GEF4 $2212
+ADDRLP4 420
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2213
+JUMPV
+LABELV $2212
+ADDRLP4 420
+CNSTF4 981668463
+ADDRLP4 252
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2213
+ADDRLP4 248
+ADDRLP4 424
+INDIRF4
+ADDRLP4 420
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 248
+ADDRLP4 248
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LEF4 $2214
+ADDRLP4 256
+ADDRLP4 248
+INDIRF4
+ASGNF4
+LABELV $2214
+ADDRLP4 256
+INDIRF4
+CNSTF4 1008981770
+LTF4 $2216
+CNSTI4 1
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2216
+LABELV $2171
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $2218
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 84+68+8
+INDIRF4
+ADDRLP4 84+56+8
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $2219
+JUMPV
+LABELV $2218
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+NEI4 $2225
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+68+8
+INDIRF4
+ADDRLP4 84+56+8
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $2226
+JUMPV
+LABELV $2225
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+NEI4 $2232
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 84+68+8
+INDIRF4
+ADDRLP4 84+56+8
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 416
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 84+68
+INDIRF4
+ADDRLP4 416
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 272+4
+INDIRF4
+ADDRLP4 84+68
+INDIRF4
+ADDRLP4 416
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 272+8
+INDIRF4
+ADDRLP4 84+68
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2233
+JUMPV
+LABELV $2232
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+NEI4 $2248
+ADDRLP4 416
+CNSTF4 3221225472
+ASGNF4
+ADDRLP4 420
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 416
+INDIRF4
+ADDRLP4 84+68
+INDIRF4
+ADDRLP4 420
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 272+4
+INDIRF4
+ADDRLP4 416
+INDIRF4
+ADDRLP4 84+68
+INDIRF4
+ADDRLP4 420
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 272+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 84+68
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2248
+LABELV $2233
+LABELV $2226
+LABELV $2219
+LABELV $2168
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 5
+LTI4 $2167
+CNSTI4 0
+RETI4
+LABELV $2113
+endproc BotEntityVisible 428 28
+bss
+align 1
+LABELV $2260
+skip 65536
+align 4
+LABELV $2261
+skip 262144
+code
+proc BotEntityIndirectlyVisible 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $2262
+CNSTI4 0
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2262
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2266
+ADDRFP4 4
+INDIRI4
+CNSTI4 1022
+LTI4 $2264
+LABELV $2266
+CNSTI4 0
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2264
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2267
+CNSTI4 0
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2267
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+LTI4 $2269
+ADDRLP4 24
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2273
+ADDRLP4 24
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2269
+LABELV $2273
+CNSTI4 0
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDetermineVisibleTeammates
+CALLV
+pop
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $2277
+JUMPV
+LABELV $2274
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7508
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2280
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2278
+LABELV $2280
+ADDRGP4 $2275
+JUMPV
+LABELV $2278
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LSHI4
+ADDRGP4 $2261
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $2281
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2275
+JUMPV
+LABELV $2281
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 $2260
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2284
+CNSTI4 1
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2284
+LABELV $2275
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2277
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7504
+ADDP4
+INDIRI4
+LTI4 $2274
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2286
+CNSTI4 0
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2286
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2291
+JUMPV
+LABELV $2288
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7508
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2294
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2292
+LABELV $2294
+ADDRGP4 $2289
+JUMPV
+LABELV $2292
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LSHI4
+ADDRGP4 $2261
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+LEI4 $2295
+ADDRGP4 $2289
+JUMPV
+LABELV $2295
+ADDRLP4 8
+CNSTI4 852
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2298
+ADDRGP4 $2289
+JUMPV
+LABELV $2298
+ADDRLP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2300
+ADDRGP4 $2289
+JUMPV
+LABELV $2300
+ADDRLP4 8
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2302
+ADDRGP4 $2289
+JUMPV
+LABELV $2302
+ADDRLP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 1127481344
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $2305
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2306
+JUMPV
+LABELV $2305
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $2306
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 $2260
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LSHI4
+ADDRGP4 $2261
+ADDP4
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+ADDI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 2000
+MODI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2308
+CNSTI4 1
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2308
+LABELV $2289
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2291
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7504
+ADDP4
+INDIRI4
+LTI4 $2288
+CNSTI4 0
+RETI4
+LABELV $2259
+endproc BotEntityIndirectlyVisible 48 12
+export BotFindEnemy
+proc BotFindEnemy 556 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 448
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 440
+ADDRLP4 448
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 452
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 452
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 456
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 444
+ADDRLP4 456
+INDIRF4
+ASGNF4
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $2314
+ADDRLP4 460
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2314
+ADDRLP4 460
+CNSTI4 0
+ASGNI4
+LABELV $2315
+ADDRLP4 148
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6444
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2316
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 540
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $2318
+ADDRLP4 468
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $2319
+JUMPV
+LABELV $2318
+ADDRLP4 468
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $2319
+ADDRLP4 544
+CNSTI4 852
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2320
+ADDRLP4 544
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2320
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2320
+ADDRLP4 472
+ADDRLP4 468
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 472+8
+ADDRLP4 472+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 484
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 552
+CNSTP4 0
+ASGNP4
+ADDRLP4 552
+INDIRP4
+ARGP4
+ADDRLP4 552
+INDIRP4
+ARGP4
+ADDRLP4 472
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 484+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2329
+ADDRLP4 484+52
+INDIRI4
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $2325
+LABELV $2329
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+NEI4 $2330
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2330
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2325
+LABELV $2316
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2332
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 156+4
+INDIRI4
+CNSTI4 0
+NEI4 $2334
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2334
+ADDRLP4 156
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2337
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2337
+ADDRLP4 156
+ARGP4
+ADDRLP4 468
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $2339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $2339
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2339
+ADDRLP4 156
+ARGP4
+ADDRLP4 476
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $2341
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $2341
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2341
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $2343
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2343
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2343
+ADDRLP4 440
+INDIRF4
+CNSTF4 1045220557
+GEF4 $2345
+CNSTI4 0
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2345
+ADDRLP4 132
+ADDRLP4 156+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 156+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 156+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 492
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+EQI4 $2354
+ADDRLP4 444
+INDIRF4
+CNSTF4 1056964608
+GEF4 $2354
+ADDRFP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2333
+JUMPV
+LABELV $2354
+ADDRLP4 132
+ARGP4
+ADDRLP4 496
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 496
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2333
+JUMPV
+LABELV $2332
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+LABELV $2333
+ADDRLP4 468
+CNSTI4 0
+ASGNI4
+ADDRLP4 292
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $2359
+JUMPV
+LABELV $2356
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2361
+ADDRGP4 $2357
+JUMPV
+LABELV $2361
+ADDRLP4 128
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2363
+ADDRGP4 $2357
+JUMPV
+LABELV $2363
+CNSTI4 852
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 g_entities+368
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2365
+ADDRGP4 $2357
+JUMPV
+LABELV $2365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $2368
+ADDRGP4 $2357
+JUMPV
+LABELV $2368
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2370
+ADDRGP4 $2357
+JUMPV
+LABELV $2370
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2373
+ADDRGP4 $2357
+JUMPV
+LABELV $2373
+ADDRLP4 0
+ARGP4
+ADDRLP4 476
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $2375
+ADDRGP4 $2357
+JUMPV
+LABELV $2375
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2377
+ADDRLP4 0
+ARGP4
+ADDRLP4 480
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $2379
+ADDRLP4 0
+ARGP4
+ADDRLP4 484
+ADDRGP4 EntityIsAlreadyMined
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $2377
+LABELV $2379
+ADDRGP4 $2357
+JUMPV
+LABELV $2377
+ADDRLP4 296
+INDIRF4
+CNSTF4 1056964608
+GEF4 $2380
+ADDRLP4 0
+ARGP4
+ADDRLP4 488
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $2380
+ADDRGP4 $2357
+JUMPV
+LABELV $2380
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $2382
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 492
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 492
+INDIRF4
+CNSTF4 1167663104
+GEF4 $2393
+ADDRGP4 $2357
+JUMPV
+LABELV $2393
+LABELV $2382
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 496
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 496
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 500
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $2402
+ADDRLP4 0
+ARGP4
+ADDRLP4 504
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+NEI4 $2402
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2404
+ADDRLP4 440
+INDIRF4
+CNSTF4 1058642330
+LEF4 $2406
+ADDRLP4 144
+INDIRI4
+CNSTI4 490000
+GEI4 $2406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 508
+ADDRGP4 BotUsesMidRangeWeapon
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $2406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 512
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $2406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $2406
+ADDRLP4 520
+CNSTI4 852
+ASGNI4
+ADDRLP4 520
+INDIRI4
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 g_entities+556
+ADDP4
+INDIRI4
+ADDRLP4 520
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+556
+ADDP4
+INDIRI4
+CNSTI4 20
+ADDI4
+LEI4 $2408
+ADDRGP4 $2357
+JUMPV
+LABELV $2408
+ADDRLP4 440
+INDIRF4
+CNSTF4 1061997773
+LEF4 $2412
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 50
+LEI4 $2412
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2412
+ADDRLP4 0+16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRLP4 532
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 156+16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRLP4 536
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+CNSTF4 1069547520
+ADDRLP4 532
+INDIRF4
+MULF4
+ADDRLP4 536
+INDIRF4
+LEF4 $2412
+ADDRGP4 $2357
+JUMPV
+LABELV $2412
+ADDRLP4 440
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2416
+ADDRLP4 540
+CNSTI4 852
+ASGNI4
+ADDRLP4 544
+CNSTI4 300
+ASGNI4
+ADDRLP4 548
+ADDRLP4 540
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 548
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $2416
+ADDRLP4 548
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+LEI4 $2416
+ADDRGP4 $2357
+JUMPV
+LABELV $2416
+LABELV $2406
+ADDRLP4 144
+INDIRI4
+ADDRLP4 288
+INDIRI4
+LEI4 $2421
+ADDRGP4 $2357
+JUMPV
+LABELV $2421
+LABELV $2404
+LABELV $2402
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 508
+INDIRI4
+GEI4 $2423
+ADDRLP4 148
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $2425
+ADDRLP4 0
+ARGP4
+ADDRLP4 512
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $2423
+LABELV $2425
+ADDRLP4 152
+CNSTI4 360
+ASGNI4
+ADDRGP4 $2424
+JUMPV
+LABELV $2423
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 360
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 516
+INDIRI4
+ASGNI4
+LABELV $2424
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $2426
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2428
+ADDRGP4 $2357
+JUMPV
+LABELV $2428
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2430
+ADDRGP4 $2357
+JUMPV
+LABELV $2430
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 520
+ADDRGP4 BotEntityIndirectlyVisible
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $2432
+ADDRGP4 $2357
+JUMPV
+LABELV $2432
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 524
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+GTI4 $2435
+ADDRGP4 $2357
+JUMPV
+LABELV $2435
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $2437
+ADDRGP4 $2357
+JUMPV
+LABELV $2437
+LABELV $2426
+ADDRLP4 520
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 520
+INDIRI4
+GEI4 $2439
+ADDRLP4 144
+INDIRI4
+CNSTI4 10000
+LEI4 $2439
+ADDRLP4 148
+INDIRI4
+ADDRLP4 520
+INDIRI4
+NEI4 $2439
+ADDRLP4 0
+ARGP4
+ADDRLP4 524
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $2439
+ADDRLP4 0
+ARGP4
+ADDRLP4 528
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $2439
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRLP4 532
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+EQI4 $2441
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2441
+ADDRGP4 $2357
+JUMPV
+LABELV $2441
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_ActivateEntity
+CVPU4 4
+NEU4 $2443
+ADDRGP4 $2357
+JUMPV
+LABELV $2443
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 0+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 0+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 428
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 0+44
+ARGP4
+CNSTI4 90
+ARGI4
+ADDRLP4 428
+ARGP4
+ADDRLP4 540
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $2452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 544
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+EQI4 $2455
+ADDRGP4 $2357
+JUMPV
+LABELV $2455
+LABELV $2452
+LABELV $2439
+ADDRLP4 292
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 0
+INDIRB
+ASGNB 128
+LABELV $2357
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2359
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2356
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $2457
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+LTI4 $2461
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+INDIRI4
+ARGI4
+ADDRLP4 480
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $2459
+LABELV $2461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2459
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 484
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 484
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2310
+JUMPV
+LABELV $2457
+CNSTI4 0
+RETI4
+LABELV $2310
+endproc BotFindEnemy 556 28
+export BotTeamCubeCarrierVisible
+proc BotTeamCubeCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2468
+JUMPV
+LABELV $2465
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2470
+ADDRGP4 $2466
+JUMPV
+LABELV $2470
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2472
+ADDRGP4 $2466
+JUMPV
+LABELV $2472
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2474
+ADDRGP4 $2466
+JUMPV
+LABELV $2474
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2477
+ADDRGP4 $2466
+JUMPV
+LABELV $2477
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2479
+ADDRGP4 $2466
+JUMPV
+LABELV $2479
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2481
+ADDRGP4 $2466
+JUMPV
+LABELV $2481
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2464
+JUMPV
+LABELV $2466
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2468
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2465
+CNSTI4 -1
+RETI4
+LABELV $2464
+endproc BotTeamCubeCarrierVisible 144 12
+export BotEnemyCubeCarrierVisible
+proc BotEnemyCubeCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2487
+JUMPV
+LABELV $2484
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2489
+ADDRGP4 $2485
+JUMPV
+LABELV $2489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2491
+ADDRGP4 $2485
+JUMPV
+LABELV $2491
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2493
+ADDRGP4 $2485
+JUMPV
+LABELV $2493
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2496
+ADDRGP4 $2485
+JUMPV
+LABELV $2496
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2498
+ADDRGP4 $2485
+JUMPV
+LABELV $2498
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2500
+ADDRGP4 $2485
+JUMPV
+LABELV $2500
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2483
+JUMPV
+LABELV $2485
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2487
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2484
+CNSTI4 -1
+RETI4
+LABELV $2483
+endproc BotEnemyCubeCarrierVisible 144 12
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2506
+JUMPV
+LABELV $2503
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2508
+ADDRGP4 $2504
+JUMPV
+LABELV $2508
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2510
+ADDRGP4 $2504
+JUMPV
+LABELV $2510
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2512
+ADDRGP4 $2504
+JUMPV
+LABELV $2512
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2515
+ADDRGP4 $2504
+JUMPV
+LABELV $2515
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2517
+ADDRGP4 $2504
+JUMPV
+LABELV $2517
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2519
+ADDRGP4 $2504
+JUMPV
+LABELV $2519
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2502
+JUMPV
+LABELV $2504
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2506
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2503
+CNSTI4 -1
+RETI4
+LABELV $2502
+endproc BotTeamFlagCarrierVisible 144 12
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 140 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2525
+JUMPV
+LABELV $2522
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2527
+ADDRGP4 $2523
+JUMPV
+LABELV $2527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2529
+ADDRGP4 $2523
+JUMPV
+LABELV $2529
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2531
+ADDRGP4 $2523
+JUMPV
+LABELV $2531
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2534
+ADDRGP4 $2523
+JUMPV
+LABELV $2534
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2536
+ADDRGP4 $2523
+JUMPV
+LABELV $2536
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2521
+JUMPV
+LABELV $2523
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2525
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2522
+CNSTI4 -1
+RETI4
+LABELV $2521
+endproc BotTeamFlagCarrier 140 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2539
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2544
+ADDRGP4 $2540
+JUMPV
+LABELV $2544
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2546
+ADDRGP4 $2540
+JUMPV
+LABELV $2546
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2548
+ADDRGP4 $2540
+JUMPV
+LABELV $2548
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2551
+ADDRGP4 $2540
+JUMPV
+LABELV $2551
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2553
+ADDRGP4 $2540
+JUMPV
+LABELV $2553
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2555
+ADDRGP4 $2540
+JUMPV
+LABELV $2555
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2538
+JUMPV
+LABELV $2540
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2542
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2539
+CNSTI4 -1
+RETI4
+LABELV $2538
+endproc BotEnemyFlagCarrierVisible 144 12
+export BotCountVisibleEnemies
+proc BotCountVisibleEnemies 164 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2558
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2558
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2563
+JUMPV
+LABELV $2560
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2565
+ADDRGP4 $2561
+JUMPV
+LABELV $2565
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2567
+ADDRGP4 $2561
+JUMPV
+LABELV $2567
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2570
+ADDRGP4 $2561
+JUMPV
+LABELV $2570
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+LEF4 $2579
+ADDRGP4 $2561
+JUMPV
+LABELV $2579
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $2581
+ADDRGP4 $2561
+JUMPV
+LABELV $2581
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2583
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2583
+LABELV $2561
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2563
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2560
+LABELV $2557
+endproc BotCountVisibleEnemies 164 12
+export BotCountVisibleTeamMatesAndEnemies
+proc BotCountVisibleTeamMatesAndEnemies 172 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2586
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2586
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2588
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2588
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2593
+JUMPV
+LABELV $2590
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2595
+ADDRGP4 $2591
+JUMPV
+LABELV $2595
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2597
+ADDRGP4 $2591
+JUMPV
+LABELV $2597
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2600
+ADDRGP4 $2591
+JUMPV
+LABELV $2600
+ADDRLP4 144
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 4
+EQI4 $2604
+ADDRLP4 144
+INDIRI4
+CNSTI4 5
+NEI4 $2602
+LABELV $2604
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2605
+ADDRGP4 $2591
+JUMPV
+LABELV $2605
+LABELV $2602
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $2614
+ADDRGP4 $2591
+JUMPV
+LABELV $2614
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $2616
+ADDRGP4 $2591
+JUMPV
+LABELV $2616
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2618
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2619
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2619
+JUMPV
+LABELV $2618
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2622
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2622
+LABELV $2619
+LABELV $2591
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2593
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2590
+LABELV $2585
+endproc BotCountVisibleTeamMatesAndEnemies 172 12
+export BotCountAllTeamMates
+proc BotCountAllTeamMates 168 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $2625
+CNSTI4 0
+RETI4
+ADDRGP4 $2624
+JUMPV
+LABELV $2625
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $2630
+JUMPV
+LABELV $2627
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2632
+ADDRGP4 $2628
+JUMPV
+LABELV $2632
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2634
+ADDRGP4 $2628
+JUMPV
+LABELV $2634
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2637
+ADDRGP4 $2628
+JUMPV
+LABELV $2637
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+LEF4 $2646
+ADDRGP4 $2628
+JUMPV
+LABELV $2646
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2648
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2648
+LABELV $2628
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2630
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2627
+ADDRLP4 144
+INDIRI4
+RETI4
+LABELV $2624
+endproc BotCountAllTeamMates 168 8
+proc BotEqualizeTeamScore 4 0
+ADDRGP4 bot_equalize+12
+INDIRI4
+CNSTI4 0
+NEI4 $2651
+CNSTI4 0
+RETI4
+ADDRGP4 $2650
+JUMPV
+LABELV $2651
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+EQI4 $2654
+CNSTI4 0
+RETI4
+ADDRGP4 $2650
+JUMPV
+LABELV $2654
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 bot_equalizer_teambon+8
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+CVIF4 4
+GEF4 $2656
+CNSTI4 1
+RETI4
+ADDRGP4 $2650
+JUMPV
+LABELV $2656
+CNSTI4 0
+RETI4
+LABELV $2650
+endproc BotEqualizeTeamScore 4 0
+proc BotEqualizeWeakestHumanTeamScore 2320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_equalize+12
+INDIRI4
+CNSTI4 0
+NEI4 $2660
+CNSTI4 0
+RETI4
+ADDRGP4 $2659
+JUMPV
+LABELV $2660
+ADDRLP4 2280
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 2280
+INDIRI4
+CNSTI4 0
+NEI4 $2663
+CNSTI4 0
+RETI4
+ADDRGP4 $2659
+JUMPV
+LABELV $2663
+ADDRLP4 2284
+CNSTI4 0
+ASGNI4
+ADDRLP4 2272
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 2276
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 2268
+CNSTI4 999999
+ASGNI4
+ADDRLP4 2260
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 2264
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRGP4 $2668
+JUMPV
+LABELV $2665
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2670
+ADDRGP4 $2666
+JUMPV
+LABELV $2670
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2288
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 2288
+INDIRI4
+CNSTI4 0
+EQI4 $2672
+ADDRGP4 $2666
+JUMPV
+LABELV $2672
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1028+4
+INDIRI4
+CNSTI4 0
+NEI4 $2674
+ADDRGP4 $2666
+JUMPV
+LABELV $2674
+ADDRLP4 1028
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2677
+ADDRGP4 $2666
+JUMPV
+LABELV $2677
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2681
+ADDRLP4 4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 2292
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2292
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2679
+LABELV $2681
+ADDRGP4 $2666
+JUMPV
+LABELV $2679
+ADDRLP4 4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 2296
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2296
+INDIRP4
+ARGP4
+ADDRLP4 2300
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2300
+INDIRI4
+CNSTI4 3
+NEI4 $2682
+ADDRGP4 $2666
+JUMPV
+LABELV $2682
+CNSTI4 852
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2684
+ADDRGP4 $2666
+JUMPV
+LABELV $2684
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1220
+ARGP4
+ADDRLP4 2304
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 2304
+INDIRI4
+CNSTI4 0
+EQI4 $2688
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1156
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ClientSkin
+CALLP4
+pop
+ADDRLP4 1156
+ARGP4
+ADDRGP4 $2692
+ARGP4
+ADDRLP4 2308
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2308
+INDIRI4
+CNSTI4 0
+NEI4 $2690
+ADDRLP4 2268
+ADDRLP4 1220+300
+INDIRI4
+ASGNI4
+LABELV $2690
+ADDRLP4 1156
+ARGP4
+ADDRGP4 $2696
+ARGP4
+ADDRLP4 2312
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2312
+INDIRI4
+CNSTI4 0
+NEI4 $2694
+ADDRLP4 2272
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2260
+ADDRLP4 1220+300
+INDIRI4
+CVIF4 4
+ADDRGP4 bot_equalizer_fembon+8
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $2694
+ADDRLP4 1156
+ARGP4
+ADDRGP4 $2701
+ARGP4
+ADDRLP4 2316
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2316
+INDIRI4
+CNSTI4 0
+NEI4 $2699
+ADDRLP4 2276
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2264
+ADDRLP4 1220+300
+INDIRI4
+ASGNI4
+LABELV $2699
+LABELV $2688
+LABELV $2666
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2668
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2665
+ADDRLP4 2268
+INDIRI4
+ADDRLP4 2264
+INDIRI4
+LEI4 $2705
+ADDRLP4 2268
+INDIRI4
+ADDRLP4 2260
+INDIRI4
+GTI4 $2703
+LABELV $2705
+CNSTI4 0
+RETI4
+ADDRGP4 $2659
+JUMPV
+LABELV $2703
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRLP4 2272
+INDIRI4
+NEI4 $2709
+ADDRLP4 2260
+INDIRI4
+ADDRLP4 2264
+INDIRI4
+LTI4 $2708
+LABELV $2709
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRLP4 2276
+INDIRI4
+NEI4 $2706
+ADDRLP4 2264
+INDIRI4
+ADDRLP4 2260
+INDIRI4
+GEI4 $2706
+LABELV $2708
+CNSTI4 1
+RETI4
+ADDRGP4 $2659
+JUMPV
+LABELV $2706
+CNSTI4 0
+RETI4
+LABELV $2659
+endproc BotEqualizeWeakestHumanTeamScore 2320 12
+export BotAimAtEnemy
+proc BotAimAtEnemy 2272 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2140
+INDIRI4
+CNSTI4 0
+LTI4 $2713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2140
+INDIRI4
+ARGI4
+ADDRLP4 2144
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+EQI4 $2711
+LABELV $2713
+ADDRGP4 $2710
+JUMPV
+LABELV $2711
+ADDRLP4 2148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+LEI4 $2716
+ADDRLP4 2148
+INDIRI4
+CNSTI4 14
+LTI4 $2714
+LABELV $2716
+ADDRGP4 $2710
+JUMPV
+LABELV $2714
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2717
+ADDRGP4 $2710
+JUMPV
+LABELV $2717
+ADDRLP4 0
+ARGP4
+ADDRLP4 2152
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 2152
+INDIRI4
+CNSTI4 0
+EQI4 $2720
+ADDRGP4 $2710
+JUMPV
+LABELV $2720
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $2722
+ADDRLP4 832
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2729
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2725
+LABELV $2729
+ADDRLP4 832+8
+ADDRLP4 832+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $2725
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRGP4 $2710
+JUMPV
+LABELV $2722
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 2160
+ADDRLP4 144+4
+INDIRI4
+ASGNI4
+ADDRLP4 2164
+CNSTI4 2
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LTI4 $2735
+ADDRLP4 2160
+INDIRI4
+CNSTI4 13
+GTI4 $2735
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LSHI4
+ADDRGP4 $2750-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2750
+address $2738
+address $2739
+address $2740
+address $2741
+address $2742
+address $2743
+address $2744
+address $2745
+address $2746
+address $2747
+address $2748
+address $2749
+code
+LABELV $2738
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2172
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2739
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2176
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2176
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2180
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2740
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 39
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2188
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2188
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2741
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2196
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2196
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2742
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2200
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2200
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 41
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2743
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2208
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 42
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2212
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2212
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2744
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2216
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 43
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2220
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2745
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2224
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2224
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2228
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2228
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2746
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2232
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2236
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2747
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2244
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2244
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2748
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2248
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2248
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2252
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2252
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2749
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2256
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2256
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2260
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2260
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2735
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2264
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2264
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2268
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2268
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+LABELV $2736
+ADDRLP4 732
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2168
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 732+4
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 732+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2771
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ADDRLP4 732
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+LABELV $2771
+ADDRLP4 828
+INDIRF4
+CNSTF4 1063675494
+GEF4 $2774
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 1158676480
+LEF4 $2783
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRF4
+ADDRLP4 732
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+INDIRF4
+ADDRLP4 732+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6724
+ADDP4
+INDIRF4
+ADDRLP4 732+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $2785
+ADDRLP4 140
+CNSTF4 1060320051
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2785
+LABELV $2783
+LABELV $2774
+ADDRLP4 0
+ARGP4
+ADDRLP4 2172
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 2172
+INDIRI4
+CNSTI4 0
+EQI4 $2789
+ADDRLP4 2176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $2791
+ADDRLP4 140
+CNSTF4 1053609165
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2791
+LABELV $2789
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2793
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+LABELV $2793
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 0
+GTF4 $2795
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $2795
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ARGP4
+ADDRLP4 2180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 804
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+LEF4 $2797
+ADDRLP4 804
+CNSTF4 1128792064
+ASGNF4
+LABELV $2797
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1056964608
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 844
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRLP4 844
+INDIRF4
+CNSTF4 1071644672
+LEF4 $2799
+ADDRLP4 804
+ADDRGP4 floattime
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1073741824
+LEF4 $2801
+ADDRLP4 804
+CNSTF4 1073741824
+ASGNF4
+LABELV $2801
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 804
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2799
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2188
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2188
+INDIRI4
+CNSTI4 0
+NEI4 $2805
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2192
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2192
+INDIRI4
+CNSTI4 0
+EQI4 $2803
+LABELV $2805
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRGP4 bot_equalizer_aim+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2803
+ADDRLP4 140
+INDIRF4
+CNSTF4 0
+GTF4 $2807
+ADDRLP4 140
+CNSTF4 953267991
+ASGNF4
+LABELV $2807
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2809
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $2809
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2200
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 2200
+INDIRI4
+CNSTI4 0
+NEI4 $2811
+ADDRLP4 720
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 828
+INDIRF4
+CNSTF4 1056964608
+LEF4 $2814
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $2816
+ADDRLP4 880+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 880+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ARGP4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 832
+ARGP4
+ADDRLP4 2208
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $2831
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1176256512
+LEF4 $2837
+ADDRLP4 720
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2839
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $2839
+LABELV $2837
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $2831
+LABELV $2816
+LABELV $2814
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 50
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 948
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2844
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 2212
+CNSTP4 0
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ARGP4
+ADDRLP4 2212
+INDIRP4
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065185444
+GEF4 $2846
+ADDRGP4 $2710
+JUMPV
+LABELV $2846
+LABELV $2844
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRGP4 $2812
+JUMPV
+LABELV $2811
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 144+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ARGP4
+ADDRLP4 2208
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $2854
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 952+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2854
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2862
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2862
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2871
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2871
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+LABELV $2871
+LABELV $2862
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $2876
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1176256512
+LEF4 $2892
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1149239296
+LTF4 $2890
+LABELV $2892
+ADDRLP4 828
+INDIRF4
+CNSTF4 1061997773
+LEF4 $2893
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2893
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2236
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 2016
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2016+8
+ADDRLP4 2016+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 2240
+CNSTF4 0
+ASGNF4
+ADDRLP4 2004+8
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004+4
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2032
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2016
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 2244
+CNSTI4 0
+ASGNI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2004
+ARGP4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 720
+ADDRLP4 2032
+INDIRB
+ASGNB 12
+ADDRGP4 $2894
+JUMPV
+LABELV $2893
+ADDRLP4 828
+INDIRF4
+CNSTF4 1053609165
+LEF4 $2926
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2236
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 2028
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 2244
+ADDRLP4 2028
+INDIRF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2028
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2926
+LABELV $2894
+LABELV $2890
+LABELV $2876
+ADDRLP4 828
+INDIRF4
+CNSTF4 1058642330
+LEF4 $2961
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2961
+ADDRLP4 144+344+196
+INDIRF4
+CNSTF4 1112014848
+LEF4 $2961
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $2967
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2212
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 2212
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $2967
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 1992
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 748+4
+INDIRI4
+CNSTI4 0
+EQI4 $2979
+ADDRLP4 1992+8
+ADDRLP4 0+16+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $2980
+JUMPV
+LABELV $2979
+ADDRLP4 1992+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $2980
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 1992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 2216
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1112014848
+GEF4 $2992
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 1992
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 1992+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2220
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2220
+INDIRF4
+CNSTF4 1163984896
+GEF4 $3006
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 808
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 808+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 808+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3017
+ADDRLP4 748+12+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 748+12
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3027
+ADDRLP4 720
+ADDRLP4 1992
+INDIRB
+ASGNB 12
+LABELV $3027
+LABELV $3017
+LABELV $3006
+LABELV $2992
+LABELV $2967
+LABELV $2961
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3030
+ADDRLP4 2212
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2212
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+4
+ADDRLP4 720+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 2220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3030
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 748+12
+INDIRB
+ASGNB 12
+LABELV $2812
+ADDRLP4 144+344+188
+INDIRF4
+CNSTF4 0
+EQF4 $3040
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 864
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 852
+ADDRLP4 808
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+4
+ADDRLP4 808+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 868
+ADDRLP4 852
+INDIRB
+ASGNB 12
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3060
+ADDRLP4 2220
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3061
+JUMPV
+LABELV $3060
+ADDRLP4 2220
+CNSTF4 0
+ASGNF4
+LABELV $3061
+ADDRLP4 868+8
+ADDRLP4 868+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2220
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3066
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3075
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3083
+ADDRLP4 2224
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3084
+JUMPV
+LABELV $3083
+ADDRLP4 2224
+CNSTF4 0
+ASGNF4
+LABELV $3084
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2224
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $3075
+LABELV $3066
+LABELV $3040
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3089
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+NEF4 $3092
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+LEF4 $3095
+ADDRLP4 820
+CNSTF4 1125515264
+ASGNF4
+LABELV $3095
+ADDRLP4 804
+CNSTF4 1053609165
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 804
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3092
+ADDRLP4 140
+INDIRF4
+CNSTF4 1061997773
+GEF4 $3097
+ADDRLP4 128
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+LABELV $3099
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRLP4 744
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 128
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3100
+ADDRLP4 744
+ADDRLP4 744
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 744
+INDIRI4
+CNSTI4 3
+LTI4 $3099
+LABELV $3097
+LABELV $3089
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2216
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2220
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRP4
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 2224
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2228
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2228
+INDIRP4
+ADDRLP4 2228
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2224
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2232
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2236
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2232
+INDIRP4
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 848
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 848
+INDIRF4
+CNSTF4 1063675494
+GTF4 $3108
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $3105
+LABELV $3108
+ADDRLP4 140
+INDIRF4
+CNSTF4 1063675494
+LEF4 $3109
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $3109
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $3111
+ADDRLP4 2244
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2244
+INDIRP4
+ADDRLP4 2244
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $3111
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $3109
+LABELV $3105
+LABELV $2710
+endproc BotAimAtEnemy 2272 56
+export BotAimAtEnemy_New
+proc BotAimAtEnemy_New 2272 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2140
+INDIRI4
+CNSTI4 0
+LTI4 $3116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2140
+INDIRI4
+ARGI4
+ADDRLP4 2144
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+EQI4 $3114
+LABELV $3116
+ADDRGP4 $3113
+JUMPV
+LABELV $3114
+ADDRLP4 2148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+LEI4 $3119
+ADDRLP4 2148
+INDIRI4
+CNSTI4 14
+LTI4 $3117
+LABELV $3119
+ADDRGP4 $3113
+JUMPV
+LABELV $3117
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $3120
+ADDRGP4 $3113
+JUMPV
+LABELV $3120
+ADDRLP4 0
+ARGP4
+ADDRLP4 2152
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 2152
+INDIRI4
+CNSTI4 0
+EQI4 $3123
+ADDRGP4 $3113
+JUMPV
+LABELV $3123
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $3125
+ADDRLP4 832
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3132
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $3128
+LABELV $3132
+ADDRLP4 832+8
+ADDRLP4 832+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $3128
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRGP4 $3113
+JUMPV
+LABELV $3125
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 2160
+ADDRLP4 144+4
+INDIRI4
+ASGNI4
+ADDRLP4 2164
+CNSTI4 2
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LTI4 $3138
+ADDRLP4 2160
+INDIRI4
+CNSTI4 13
+GTI4 $3138
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LSHI4
+ADDRGP4 $3153-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3153
+address $3141
+address $3142
+address $3143
+address $3144
+address $3145
+address $3146
+address $3147
+address $3148
+address $3149
+address $3150
+address $3151
+address $3152
+code
+LABELV $3141
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2172
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3142
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2176
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2176
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2180
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3143
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 39
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2188
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2188
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3144
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2196
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2196
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3145
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2200
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2200
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 41
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3146
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2208
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 42
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2212
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2212
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3147
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2216
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 43
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2220
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2224
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2224
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2228
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2228
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3149
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2232
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2236
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3150
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2244
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2244
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3151
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2248
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2248
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2252
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2252
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3152
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2256
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2256
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2260
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2260
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3139
+JUMPV
+LABELV $3138
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2264
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2264
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2268
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2268
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+LABELV $3139
+ADDRLP4 732
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2168
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 732+4
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 732+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $3174
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ADDRLP4 732
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+LABELV $3174
+ADDRLP4 828
+INDIRF4
+CNSTF4 1063675494
+GEF4 $3177
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 1158676480
+LEF4 $3186
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRF4
+ADDRLP4 732
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+INDIRF4
+ADDRLP4 732+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6724
+ADDP4
+INDIRF4
+ADDRLP4 732+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $3188
+ADDRLP4 140
+CNSTF4 1060320051
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3188
+LABELV $3186
+LABELV $3177
+ADDRLP4 0
+ARGP4
+ADDRLP4 2172
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 2172
+INDIRI4
+CNSTI4 0
+EQI4 $3192
+ADDRLP4 2176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $3194
+ADDRLP4 140
+CNSTF4 1053609165
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3194
+LABELV $3192
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3196
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+LABELV $3196
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 0
+GTF4 $3198
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $3198
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ARGP4
+ADDRLP4 2180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 804
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+LEF4 $3200
+ADDRLP4 804
+CNSTF4 1128792064
+ASGNF4
+LABELV $3200
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1056964608
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 844
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRLP4 844
+INDIRF4
+CNSTF4 1071644672
+LEF4 $3202
+ADDRLP4 804
+ADDRGP4 floattime
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1073741824
+LEF4 $3204
+ADDRLP4 804
+CNSTF4 1073741824
+ASGNF4
+LABELV $3204
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 804
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2188
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2188
+INDIRI4
+CNSTI4 0
+NEI4 $3208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2192
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2192
+INDIRI4
+CNSTI4 0
+EQI4 $3206
+LABELV $3208
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRGP4 bot_equalizer_aim+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3206
+ADDRLP4 140
+INDIRF4
+CNSTF4 0
+GTF4 $3210
+ADDRLP4 140
+CNSTF4 953267991
+ASGNF4
+LABELV $3210
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $3212
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $3212
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2200
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 2200
+INDIRI4
+CNSTI4 0
+NEI4 $3214
+ADDRLP4 720
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 828
+INDIRF4
+CNSTF4 1056964608
+LEF4 $3217
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $3219
+ADDRLP4 880+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 880+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ARGP4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 832
+ARGP4
+ADDRLP4 2208
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $3234
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3240
+ADDRLP4 720
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3242
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $3242
+LABELV $3240
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $3234
+LABELV $3219
+LABELV $3217
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 50
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 948
+INDIRF4
+CNSTF4 1063675494
+LEF4 $3247
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065185444
+GEF4 $3253
+ADDRGP4 $3113
+JUMPV
+LABELV $3253
+LABELV $3247
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRGP4 $3215
+JUMPV
+LABELV $3214
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 144+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ARGP4
+ADDRLP4 2208
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $3261
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 952+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $3261
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3269
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3269
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3278
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3278
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+LABELV $3278
+LABELV $3269
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $3283
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3299
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1149239296
+LTF4 $3297
+LABELV $3299
+ADDRLP4 828
+INDIRF4
+CNSTF4 1061997773
+LEF4 $3300
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3300
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2236
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 2016
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2016+8
+ADDRLP4 2016+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 2240
+CNSTF4 0
+ASGNF4
+ADDRLP4 2004+8
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004+4
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2032
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2016
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 2244
+CNSTI4 0
+ASGNI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2004
+ARGP4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 720
+ADDRLP4 2032
+INDIRB
+ASGNB 12
+ADDRGP4 $3301
+JUMPV
+LABELV $3300
+ADDRLP4 828
+INDIRF4
+CNSTF4 1053609165
+LEF4 $3333
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2236
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 2028
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 2244
+ADDRLP4 2028
+INDIRF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2028
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3333
+LABELV $3301
+LABELV $3297
+LABELV $3283
+ADDRLP4 828
+INDIRF4
+CNSTF4 1058642330
+LEF4 $3368
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3368
+ADDRLP4 144+344+196
+INDIRF4
+CNSTF4 1112014848
+LEF4 $3368
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $3374
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2212
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 2212
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $3374
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 1992
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 748+4
+INDIRI4
+CNSTI4 0
+EQI4 $3386
+ADDRLP4 1992+8
+ADDRLP4 0+16+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $3387
+JUMPV
+LABELV $3386
+ADDRLP4 1992+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $3387
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 1992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 2216
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1112014848
+GEF4 $3399
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 1992
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 1992+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2220
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2220
+INDIRF4
+CNSTF4 1163984896
+GEF4 $3413
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 808
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 808+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 808+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3424
+ADDRLP4 748+12+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 748+12
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3434
+ADDRLP4 720
+ADDRLP4 1992
+INDIRB
+ASGNB 12
+LABELV $3434
+LABELV $3424
+LABELV $3413
+LABELV $3399
+LABELV $3374
+LABELV $3368
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3437
+ADDRLP4 2212
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2212
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+4
+ADDRLP4 720+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 2220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3437
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 748+12
+INDIRB
+ASGNB 12
+LABELV $3215
+ADDRLP4 144+344+188
+INDIRF4
+CNSTF4 0
+EQF4 $3447
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 864
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 852
+ADDRLP4 808
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+4
+ADDRLP4 808+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 868
+ADDRLP4 852
+INDIRB
+ASGNB 12
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3467
+ADDRLP4 2220
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3468
+JUMPV
+LABELV $3467
+ADDRLP4 2220
+CNSTF4 0
+ASGNF4
+LABELV $3468
+ADDRLP4 868+8
+ADDRLP4 868+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2220
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3473
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3482
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3490
+ADDRLP4 2224
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3491
+JUMPV
+LABELV $3490
+ADDRLP4 2224
+CNSTF4 0
+ASGNF4
+LABELV $3491
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2224
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $3482
+LABELV $3473
+LABELV $3447
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3496
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+NEF4 $3499
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+LEF4 $3502
+ADDRLP4 820
+CNSTF4 1125515264
+ASGNF4
+LABELV $3502
+ADDRLP4 804
+CNSTF4 1053609165
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 804
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3499
+ADDRLP4 140
+INDIRF4
+CNSTF4 1061997773
+GEF4 $3504
+ADDRLP4 128
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+LABELV $3506
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRLP4 744
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 128
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3507
+ADDRLP4 744
+ADDRLP4 744
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 744
+INDIRI4
+CNSTI4 3
+LTI4 $3506
+LABELV $3504
+LABELV $3496
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2216
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2220
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRP4
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 2224
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2228
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2228
+INDIRP4
+ADDRLP4 2228
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2224
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2232
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2236
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2232
+INDIRP4
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 848
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 848
+INDIRF4
+CNSTF4 1063675494
+GTF4 $3515
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $3512
+LABELV $3515
+ADDRLP4 140
+INDIRF4
+CNSTF4 1063675494
+LEF4 $3516
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $3516
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $3518
+ADDRLP4 2244
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2244
+INDIRP4
+ADDRLP4 2244
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $3518
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $3516
+LABELV $3512
+LABELV $3113
+endproc BotAimAtEnemy_New 2272 56
+proc BotMayRadiusDamageTeamMate 4184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $3521
+CNSTI4 0
+RETI4
+ADDRGP4 $3520
+JUMPV
+LABELV $3521
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+NEI4 $3524
+CNSTI4 0
+RETI4
+ADDRGP4 $3520
+JUMPV
+LABELV $3524
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3527
+ADDRFP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $3527
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3529
+ADDRLP4 4160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4160
+INDIRI4
+ADDRLP4 4132
+ADDP4
+ADDRLP4 4160
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4164
+INDIRI4
+ADDRLP4 4144
+ADDP4
+ADDRLP4 4164
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3530
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3529
+ADDRLP4 4132
+ARGP4
+ADDRLP4 4144
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4160
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4160
+INDIRI4
+ASGNI4
+ADDRLP4 4156
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 4128
+ADDRLP4 4168
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3537
+JUMPV
+LABELV $3534
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $3538
+ADDRGP4 $3535
+JUMPV
+LABELV $3538
+ADDRLP4 4
+CNSTI4 852
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3540
+ADDRGP4 $3535
+JUMPV
+LABELV $3540
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3542
+ADDRGP4 $3535
+JUMPV
+LABELV $3542
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+ADDRLP4 4156
+INDIRI4
+EQI4 $3544
+ADDRGP4 $3535
+JUMPV
+LABELV $3544
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3546
+ADDRGP4 $3535
+JUMPV
+LABELV $3546
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3548
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $3552
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3553
+JUMPV
+LABELV $3552
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $3554
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3555
+JUMPV
+LABELV $3554
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3555
+LABELV $3553
+LABELV $3549
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3548
+ADDRLP4 8
+ARGP4
+ADDRLP4 4172
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4172
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDRLP4 4128
+INDIRF4
+MULF4
+LTF4 $3556
+ADDRGP4 $3535
+JUMPV
+LABELV $3556
+CNSTI4 1
+RETI4
+ADDRGP4 $3520
+JUMPV
+LABELV $3535
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3537
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $3534
+CNSTI4 0
+RETI4
+LABELV $3520
+endproc BotMayRadiusDamageTeamMate 4184 16
+export BotCheckAttack
+proc BotCheckAttack 992 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+GEI4 $3559
+ADDRGP4 $3558
+JUMPV
+LABELV $3559
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+LEI4 $3563
+ADDRLP4 868
+INDIRI4
+CNSTI4 14
+LTI4 $3561
+LABELV $3563
+ADDRGP4 $3558
+JUMPV
+LABELV $3561
+ADDRLP4 828
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 876
+CNSTI4 2
+ASGNI4
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LTI4 $3564
+ADDRLP4 828
+INDIRI4
+CNSTI4 13
+GTI4 $3564
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3564
+ADDRGP4 $3558
+JUMPV
+LABELV $3564
+ADDRLP4 656
+INDIRI4
+ARGI4
+ADDRLP4 660
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 660+4
+INDIRI4
+CNSTI4 0
+NEI4 $3566
+ADDRGP4 $3558
+JUMPV
+LABELV $3566
+ADDRLP4 660
+ARGP4
+ADDRLP4 880
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 880
+INDIRI4
+CNSTI4 0
+EQI4 $3569
+ADDRGP4 $3558
+JUMPV
+LABELV $3569
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3571
+ADDRLP4 884
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRLP4 884
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3575
+ADDRLP4 884
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $3571
+LABELV $3575
+ADDRLP4 888
+CNSTI4 852
+ADDRLP4 660
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3576
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3576
+ADDRGP4 $3558
+JUMPV
+LABELV $3576
+LABELV $3571
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 888
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 856
+ADDRLP4 888
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 892
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 800
+ADDRLP4 892
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ARGP4
+ADDRLP4 896
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 896
+INDIRI4
+CNSTI4 0
+EQI4 $3580
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+CNSTF4 1069547520
+ADDF4
+ASGNF4
+ADDRLP4 800
+INDIRF4
+CNSTF4 1075838976
+LEF4 $3582
+ADDRLP4 800
+CNSTF4 1075838976
+ASGNF4
+LABELV $3582
+LABELV $3580
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 900
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+CNSTI4 0
+NEI4 $3586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 904
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 904
+INDIRI4
+CNSTI4 0
+EQI4 $3584
+LABELV $3586
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+ADDRGP4 bot_equalizer_react+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3584
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3588
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $3558
+JUMPV
+LABELV $3588
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3590
+ADDRGP4 $3558
+JUMPV
+LABELV $3590
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3592
+ADDRGP4 $3558
+JUMPV
+LABELV $3592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $3594
+ADDRGP4 $3558
+JUMPV
+LABELV $3594
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 49
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 908
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 908
+INDIRF4
+ASGNF4
+ADDRLP4 912
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 912
+INDIRI4
+CNSTI4 64
+LTI4 $3601
+ADDRLP4 912
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3600
+ADDRLP4 912
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $3600
+LABELV $3601
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $3596
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 920
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 920
+INDIRI4
+CNSTI4 0
+EQI4 $3596
+LABELV $3600
+ADDRLP4 836
+CNSTF4 0
+ASGNF4
+LABELV $3596
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $3602
+ADDRLP4 924
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 924
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 836
+INDIRF4
+LEF4 $3604
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 836
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3605
+JUMPV
+LABELV $3604
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 836
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3605
+LABELV $3602
+ADDRLP4 788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6708
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6712
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 932
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 0
+EQI4 $3608
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 936
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 936
+INDIRI4
+CNSTI4 0
+EQI4 $3608
+ADDRLP4 788
+ARGP4
+ADDRLP4 940
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 940
+INDIRF4
+CNSTF4 1163984896
+LEF4 $3608
+ADDRGP4 $3558
+JUMPV
+LABELV $3608
+ADDRLP4 944
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 944
+INDIRI4
+CNSTI4 1
+LTI4 $3610
+ADDRLP4 944
+INDIRI4
+CNSTI4 13
+GTI4 $3610
+ADDRLP4 944
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3624-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3624
+address $3613
+address $3614
+address $3615
+address $3616
+address $3617
+address $3618
+address $3618
+address $3619
+address $3619
+address $3620
+address $3621
+address $3622
+address $3623
+code
+LABELV $3613
+ADDRLP4 860
+CNSTI4 90
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3614
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3615
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3616
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3617
+ADDRLP4 860
+CNSTI4 40
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3618
+ADDRLP4 860
+CNSTI4 120
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3619
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3620
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3621
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3622
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3623
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3611
+JUMPV
+LABELV $3610
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+LABELV $3611
+ADDRLP4 788
+ARGP4
+ADDRLP4 952
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 952
+INDIRF4
+CNSTF4 1176256512
+GEF4 $3626
+ADDRLP4 840
+CNSTI4 120
+ASGNI4
+ADDRGP4 $3627
+JUMPV
+LABELV $3626
+ADDRLP4 840
+ADDRLP4 860
+INDIRI4
+ASGNI4
+LABELV $3627
+ADDRLP4 788
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 856
+INDIRF4
+CNSTF4 1058642330
+LEF4 $3628
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 840
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 844
+ARGP4
+ADDRLP4 956
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $3630
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $3630
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $3632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3632
+ADDRGP4 $3558
+JUMPV
+LABELV $3632
+LABELV $3628
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 840
+INDIRI4
+ARGI4
+ADDRLP4 844
+ARGP4
+ADDRLP4 956
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $3634
+ADDRGP4 $3558
+JUMPV
+LABELV $3634
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRGP4 AngleVectorsForwardRight
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+4
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 588+8
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+8
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3238002688
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 972
+CNSTP4 0
+ASGNP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3660
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3660
+ADDRGP4 $3558
+JUMPV
+LABELV $3660
+ADDRLP4 980
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 816
+ADDRLP4 0
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+344+160
+ARGP4
+ADDRLP4 12+344+172
+ARGP4
+ADDRLP4 816
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 0
+LTI4 $3674
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 64
+GEI4 $3674
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+52
+INDIRI4
+ARGI4
+ADDRLP4 984
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $3681
+ADDRGP4 $3558
+JUMPV
+LABELV $3681
+LABELV $3678
+LABELV $3674
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+NEI4 $3687
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3684
+LABELV $3687
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3688
+CNSTF4 1148846080
+ADDRLP4 600+8
+INDIRF4
+MULF4
+ADDRLP4 12+344+196
+INDIRF4
+GEF4 $3692
+ADDRLP4 988
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 864
+ADDRLP4 988
+INDIRF4
+ADDRLP4 12+344+192
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 988
+INDIRF4
+ADDRLP4 600+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3700
+ADDRGP4 $3558
+JUMPV
+LABELV $3700
+LABELV $3692
+LABELV $3688
+LABELV $3684
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3702
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+12
+ARGP4
+ADDRLP4 12+344+196
+INDIRF4
+ARGF4
+ADDRLP4 988
+ADDRGP4 BotMayRadiusDamageTeamMate
+CALLI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $3706
+ADDRGP4 $3558
+JUMPV
+LABELV $3706
+LABELV $3702
+ADDRGP4 bot_noshoot+12
+INDIRI4
+CNSTI4 0
+EQI4 $3711
+ADDRGP4 $3558
+JUMPV
+LABELV $3711
+ADDRLP4 12+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3714
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3715
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $3715
+JUMPV
+LABELV $3714
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $3715
+ADDRLP4 988
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $3558
+endproc BotCheckAttack 992 28
+export BotCheckAttack_New
+proc BotCheckAttack_New 992 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+GEI4 $3720
+ADDRGP4 $3719
+JUMPV
+LABELV $3720
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+LEI4 $3724
+ADDRLP4 868
+INDIRI4
+CNSTI4 14
+LTI4 $3722
+LABELV $3724
+ADDRGP4 $3719
+JUMPV
+LABELV $3722
+ADDRLP4 828
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 876
+CNSTI4 2
+ASGNI4
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LTI4 $3725
+ADDRLP4 828
+INDIRI4
+CNSTI4 13
+GTI4 $3725
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3725
+ADDRGP4 $3719
+JUMPV
+LABELV $3725
+ADDRLP4 656
+INDIRI4
+ARGI4
+ADDRLP4 660
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 660+4
+INDIRI4
+CNSTI4 0
+NEI4 $3727
+ADDRGP4 $3719
+JUMPV
+LABELV $3727
+ADDRLP4 660
+ARGP4
+ADDRLP4 880
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 880
+INDIRI4
+CNSTI4 0
+EQI4 $3730
+ADDRGP4 $3719
+JUMPV
+LABELV $3730
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3732
+ADDRLP4 884
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRLP4 884
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3736
+ADDRLP4 884
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $3732
+LABELV $3736
+ADDRLP4 888
+CNSTI4 852
+ADDRLP4 660
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3737
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+596
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3737
+ADDRGP4 $3719
+JUMPV
+LABELV $3737
+LABELV $3732
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 888
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 888
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 892
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 800
+ADDRLP4 892
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ARGP4
+ADDRLP4 896
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 896
+INDIRI4
+CNSTI4 0
+EQI4 $3741
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+CNSTF4 1069547520
+ADDF4
+ASGNF4
+ADDRLP4 800
+INDIRF4
+CNSTF4 1075838976
+LEF4 $3743
+ADDRLP4 800
+CNSTF4 1075838976
+ASGNF4
+LABELV $3743
+LABELV $3741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 900
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+CNSTI4 0
+NEI4 $3747
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 904
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 904
+INDIRI4
+CNSTI4 0
+EQI4 $3745
+LABELV $3747
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+ADDRGP4 bot_equalizer_react+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3745
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3749
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $3719
+JUMPV
+LABELV $3749
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3751
+ADDRGP4 $3719
+JUMPV
+LABELV $3751
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3753
+ADDRGP4 $3719
+JUMPV
+LABELV $3753
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $3755
+ADDRGP4 $3719
+JUMPV
+LABELV $3755
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 49
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 908
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 908
+INDIRF4
+ASGNF4
+ADDRLP4 912
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 912
+INDIRI4
+CNSTI4 64
+LTI4 $3762
+ADDRLP4 912
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3761
+ADDRLP4 912
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $3761
+LABELV $3762
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $3757
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 920
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 920
+INDIRI4
+CNSTI4 0
+EQI4 $3757
+LABELV $3761
+ADDRLP4 840
+CNSTF4 0
+ASGNF4
+LABELV $3757
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $3763
+ADDRLP4 924
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 924
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 840
+INDIRF4
+LEF4 $3765
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3766
+JUMPV
+LABELV $3765
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 840
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3766
+LABELV $3763
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 12+272
+INDIRF4
+CNSTF4 0
+NEF4 $3767
+ADDRLP4 836
+INDIRF4
+CNSTF4 1045220557
+LEF4 $3770
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 932
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 0
+NEI4 $3770
+ADDRGP4 $3719
+JUMPV
+LABELV $3770
+LABELV $3767
+ADDRLP4 788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6708
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6712
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 936
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 936
+INDIRI4
+CNSTI4 0
+EQI4 $3774
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 940
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 940
+INDIRI4
+CNSTI4 0
+EQI4 $3774
+ADDRLP4 788
+ARGP4
+ADDRLP4 944
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 944
+INDIRF4
+CNSTF4 1163984896
+LEF4 $3774
+ADDRGP4 $3719
+JUMPV
+LABELV $3774
+ADDRLP4 948
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 1
+LTI4 $3776
+ADDRLP4 948
+INDIRI4
+CNSTI4 13
+GTI4 $3776
+ADDRLP4 948
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3790-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3790
+address $3779
+address $3780
+address $3781
+address $3782
+address $3783
+address $3784
+address $3784
+address $3785
+address $3785
+address $3786
+address $3787
+address $3788
+address $3789
+code
+LABELV $3779
+ADDRLP4 860
+CNSTI4 90
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3780
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3781
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3782
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3783
+ADDRLP4 860
+CNSTI4 40
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3784
+ADDRLP4 860
+CNSTI4 120
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3785
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3786
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3787
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3788
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3789
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3777
+JUMPV
+LABELV $3776
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+LABELV $3777
+ADDRLP4 788
+ARGP4
+ADDRLP4 956
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 956
+INDIRF4
+CNSTF4 1176256512
+GEF4 $3792
+ADDRLP4 844
+CNSTI4 120
+ASGNI4
+ADDRGP4 $3793
+JUMPV
+LABELV $3792
+ADDRLP4 844
+ADDRLP4 860
+INDIRI4
+ASGNI4
+LABELV $3793
+ADDRLP4 788
+ARGP4
+ADDRLP4 848
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 836
+INDIRF4
+CNSTF4 1058642330
+LEF4 $3794
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 844
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 848
+ARGP4
+ADDRLP4 960
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $3796
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $3796
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $3798
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3798
+ADDRGP4 $3719
+JUMPV
+LABELV $3798
+LABELV $3794
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 844
+INDIRI4
+ARGI4
+ADDRLP4 848
+ARGP4
+ADDRLP4 960
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $3800
+ADDRGP4 $3719
+JUMPV
+LABELV $3800
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRGP4 AngleVectorsForwardRight
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+4
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 588+8
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+8
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3238002688
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 972
+CNSTP4 0
+ASGNP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3826
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3826
+ADDRGP4 $3719
+JUMPV
+LABELV $3826
+ADDRLP4 980
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 816
+ADDRLP4 0
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+344+160
+ARGP4
+ADDRLP4 12+344+172
+ARGP4
+ADDRLP4 816
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 0
+LTI4 $3840
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 64
+GEI4 $3840
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+52
+INDIRI4
+ARGI4
+ADDRLP4 984
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $3847
+ADDRGP4 $3719
+JUMPV
+LABELV $3847
+LABELV $3844
+LABELV $3840
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+NEI4 $3853
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3850
+LABELV $3853
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3854
+CNSTF4 1148846080
+ADDRLP4 600+8
+INDIRF4
+MULF4
+ADDRLP4 12+344+196
+INDIRF4
+GEF4 $3858
+ADDRLP4 988
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 864
+ADDRLP4 988
+INDIRF4
+ADDRLP4 12+344+192
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 988
+INDIRF4
+ADDRLP4 600+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3866
+ADDRGP4 $3719
+JUMPV
+LABELV $3866
+LABELV $3858
+LABELV $3854
+LABELV $3850
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3868
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+12
+ARGP4
+ADDRLP4 12+344+196
+INDIRF4
+ARGF4
+ADDRLP4 988
+ADDRGP4 BotMayRadiusDamageTeamMate
+CALLI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $3872
+ADDRGP4 $3719
+JUMPV
+LABELV $3872
+LABELV $3868
+ADDRGP4 bot_noshoot+12
+INDIRI4
+CNSTI4 0
+EQI4 $3877
+ADDRGP4 $3719
+JUMPV
+LABELV $3877
+ADDRLP4 12+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3880
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3881
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $3881
+JUMPV
+LABELV $3880
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $3881
+ADDRLP4 988
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $3719
+endproc BotCheckAttack_New 992 28
+lit
+align 4
+LABELV $3893
+byte 4 1143832576
+byte 4 1128792064
+byte 4 1139802112
+align 4
+LABELV $3894
+byte 4 1148321792
+byte 4 1139539968
+byte 4 1143603200
+align 4
+LABELV $3895
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 268 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3888
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $3892
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3889
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $3892
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3890
+ARGP4
+ADDRLP4 160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $3886
+LABELV $3892
+ADDRLP4 164
+ADDRGP4 $3893
+INDIRB
+ASGNB 12
+ADDRLP4 176
+ADDRGP4 $3894
+INDIRB
+ASGNB 12
+ADDRLP4 188
+ADDRGP4 $3895
+INDIRB
+ASGNB 12
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3890
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $3896
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $3896
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $3900
+ADDRLP4 208
+INDIRF4
+ADDRLP4 176
+INDIRF4
+GEF4 $3900
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+LEF4 $3902
+ADDRLP4 212
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+GEF4 $3902
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+LEF4 $3906
+ADDRLP4 216
+INDIRF4
+ADDRLP4 176+8
+INDIRF4
+GEF4 $3906
+ADDRGP4 $3885
+JUMPV
+LABELV $3906
+LABELV $3902
+LABELV $3900
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $3913
+JUMPV
+LABELV $3910
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $3915
+ADDRGP4 $3911
+JUMPV
+LABELV $3915
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $3917
+ADDRGP4 $3911
+JUMPV
+LABELV $3917
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $3920
+ADDRGP4 $3911
+JUMPV
+LABELV $3920
+ADDRLP4 0
+ARGP4
+ADDRLP4 216
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $3922
+ADDRGP4 $3911
+JUMPV
+LABELV $3922
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $3924
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 176
+INDIRF4
+GEF4 $3924
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+LEF4 $3928
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+GEF4 $3928
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+LEF4 $3936
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 176+8
+INDIRF4
+GEF4 $3936
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $3944
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3912
+JUMPV
+LABELV $3944
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $3946
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+LABELV $3946
+LABELV $3936
+LABELV $3928
+LABELV $3924
+LABELV $3911
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3913
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $3910
+LABELV $3912
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $3887
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 188
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 188+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 188+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 224
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 228
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 148
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 240
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 244
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ADDRLP4 248
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 244
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 148
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 252
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 256
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $3887
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $3887
+JUMPV
+LABELV $3886
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3890
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $3956
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $3956
+LABELV $3887
+LABELV $3885
+endproc BotMapScripts 268 16
+proc BotModelMinsMaxs 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3962
+JUMPV
+LABELV $3959
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3964
+ADDRGP4 $3960
+JUMPV
+LABELV $3964
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3966
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $3966
+ADDRGP4 $3960
+JUMPV
+LABELV $3966
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3968
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $3968
+ADDRGP4 $3960
+JUMPV
+LABELV $3968
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3970
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3972
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3972
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3974
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3974
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $3958
+JUMPV
+LABELV $3970
+LABELV $3960
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ASGNP4
+LABELV $3962
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3959
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3976
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $3976
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3978
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $3978
+CNSTI4 0
+RETI4
+LABELV $3958
+endproc BotModelMinsMaxs 28 0
+lit
+align 4
+LABELV $3981
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $3982
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+code
+proc BotFuncButtonActivateGoal 600 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRGP4 $3981
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRGP4 $3982
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 536
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3983
+CNSTI4 0
+RETI4
+ADDRGP4 $3980
+JUMPV
+LABELV $3983
+ADDRLP4 148+1
+ARGP4
+ADDRLP4 540
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3986
+CNSTI4 0
+RETI4
+ADDRGP4 $3980
+JUMPV
+LABELV $3986
+ADDRLP4 292
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 544
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3988
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 288
+INDIRF4
+CNSTF4 0
+NEF4 $3989
+ADDRLP4 288
+CNSTF4 1082130432
+ASGNF4
+LABELV $3989
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3991
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 276+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 SetMovedir
+CALLV
+pop
+ADDRLP4 100
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 548
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 552
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 556
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 560
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 552
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 560
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4014
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $4015
+ADDRLP4 564
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 568
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 568
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 572
+CNSTP4 0
+ASGNP4
+ADDRLP4 572
+INDIRP4
+ARGP4
+ADDRLP4 572
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 568
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4027
+ADDRLP4 356+52
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $4023
+LABELV $4027
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $3980
+JUMPV
+LABELV $4023
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4032
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4033
+JUMPV
+LABELV $4032
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4033
+LABELV $4029
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4028
+ADDRLP4 576
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 412
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $4045
+JUMPV
+LABELV $4042
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 0
+EQI4 $4046
+ADDRGP4 $4044
+JUMPV
+LABELV $4046
+LABELV $4043
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $4045
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4042
+LABELV $4044
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4048
+LABELV $4048
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4050
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 412
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4052
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4056
+ADDRLP4 584
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 596
+ADDRLP4 584
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+ADDRLP4 596
+INDIRP4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4057
+JUMPV
+LABELV $4056
+ADDRLP4 584
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 596
+ADDRLP4 584
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+ADDRLP4 596
+INDIRP4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4057
+LABELV $4053
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4052
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $3980
+JUMPV
+LABELV $4050
+CNSTI4 0
+RETI4
+ADDRGP4 $3980
+JUMPV
+LABELV $4015
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4058
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4062
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 564
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 568
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 564
+INDIRF4
+ADDRLP4 568
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4063
+JUMPV
+LABELV $4062
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 564
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 568
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 564
+INDIRF4
+ADDRLP4 568
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4063
+LABELV $4059
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4058
+ADDRLP4 564
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 568
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4075
+JUMPV
+LABELV $4072
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+EQI4 $4076
+ADDRGP4 $4074
+JUMPV
+LABELV $4076
+LABELV $4073
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4075
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $4072
+LABELV $4074
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $4078
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4088
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4092
+ADDRLP4 572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 572
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ADDRLP4 584
+INDIRP4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4093
+JUMPV
+LABELV $4092
+ADDRLP4 572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 572
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ADDRLP4 584
+INDIRP4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4093
+LABELV $4089
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4088
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $3980
+JUMPV
+LABELV $4078
+CNSTI4 0
+RETI4
+LABELV $3980
+endproc BotFuncButtonActivateGoal 600 28
+proc BotFuncDoorActivateGoal 1080 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4095
+CNSTI4 0
+RETI4
+ADDRGP4 $4094
+JUMPV
+LABELV $4095
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $4098
+CNSTI4 0
+RETI4
+ADDRGP4 $4094
+JUMPV
+LABELV $4098
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1076
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $4094
+endproc BotFuncDoorActivateGoal 1080 20
+proc BotTriggerMultipleActivateGoal 284 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4111
+CNSTI4 0
+RETI4
+ADDRGP4 $4110
+JUMPV
+LABELV $4111
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $4114
+CNSTI4 0
+RETI4
+ADDRGP4 $4110
+JUMPV
+LABELV $4114
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4131
+JUMPV
+LABELV $4128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $4132
+ADDRGP4 $4130
+JUMPV
+LABELV $4132
+LABELV $4129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4131
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $4128
+LABELV $4130
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $4134
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4110
+JUMPV
+LABELV $4134
+CNSTI4 0
+RETI4
+LABELV $4110
+endproc BotTriggerMultipleActivateGoal 284 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4145
+CNSTI4 0
+RETI4
+ADDRGP4 $4144
+JUMPV
+LABELV $4145
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $4144
+endproc BotPopFromActivateGoalStack 4 8
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4148
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4152
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $4154
+ADDRLP4 4
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $4154
+LABELV $4152
+LABELV $4149
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $4148
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $4156
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 248
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 244
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $4147
+JUMPV
+LABELV $4156
+CNSTI4 0
+RETI4
+LABELV $4147
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $4160
+JUMPV
+LABELV $4159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $4160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4159
+LABELV $4158
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4166
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4167
+JUMPV
+LABELV $4166
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4167
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $4163
+ADDRGP4 $4162
+JUMPV
+LABELV $4163
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4171
+JUMPV
+LABELV $4168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $4169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4171
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $4168
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4173
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4174
+JUMPV
+LABELV $4173
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $4174
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4162
+endproc BotEnableActivateGoalAreas 12 8
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $4179
+JUMPV
+LABELV $4176
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $4180
+ADDRGP4 $4177
+JUMPV
+LABELV $4180
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4182
+CNSTI4 1
+RETI4
+ADDRGP4 $4175
+JUMPV
+LABELV $4182
+LABELV $4177
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $4179
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4176
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4184
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4188
+ADDRGP4 $4185
+JUMPV
+LABELV $4188
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4190
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $4192
+CNSTI4 1
+RETI4
+ADDRGP4 $4175
+JUMPV
+LABELV $4192
+LABELV $4190
+LABELV $4185
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $4184
+CNSTI4 0
+RETI4
+LABELV $4175
+endproc BotIsGoingToActivateEntity 8 0
+proc BotGetActivateGoal 3296 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 248
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3048
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 3048+4
+INDIRI4
+CNSTI4 0
+NEI4 $4195
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4195
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $4198
+ARGP4
+ADDRLP4 3048+92
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3228
+INDIRI4
+ASGNI4
+ADDRGP4 $4203
+JUMPV
+LABELV $4200
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3232
+INDIRI4
+CNSTI4 0
+NEI4 $4204
+ADDRGP4 $4201
+JUMPV
+LABELV $4204
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $4206
+ADDRGP4 $4202
+JUMPV
+LABELV $4206
+LABELV $4201
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3232
+INDIRI4
+ASGNI4
+LABELV $4203
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4200
+LABELV $4202
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4208
+CNSTI4 3
+ARGI4
+ADDRGP4 $4210
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4208
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4211
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4212
+CNSTI4 3
+ARGI4
+ADDRGP4 $4214
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4212
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4217
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $4215
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4014
+ARGP4
+ADDRLP4 3196
+ARGP4
+ADDRLP4 3240
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+EQI4 $4218
+ADDRLP4 3196
+INDIRF4
+CNSTF4 0
+EQF4 $4220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4220
+LABELV $4218
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3192
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $4223
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4223
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4227
+ARGP4
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $4225
+ADDRLP4 3248
+CNSTF4 0
+ASGNF4
+ADDRLP4 3180+8
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180+4
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+LABELV $4225
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3048+16
+ARGP4
+ADDRLP4 3248
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3248
+INDIRI4
+CNSTI4 0
+NEI4 $4230
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4230
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4233
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3200
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRLP4 3200
+INDIRI4
+CNSTI4 0
+EQI4 $4236
+ADDRLP4 3200
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3176
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4241
+JUMPV
+LABELV $4238
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $4242
+ADDRGP4 $4240
+JUMPV
+LABELV $4242
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $4244
+ADDRGP4 $4239
+JUMPV
+LABELV $4244
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $4246
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4246
+LABELV $4239
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4241
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3176
+INDIRI4
+LTI4 $4238
+LABELV $4240
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4251
+JUMPV
+LABELV $4248
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $4252
+ADDRGP4 $4250
+JUMPV
+LABELV $4252
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+EQI4 $4254
+ADDRGP4 $4249
+JUMPV
+LABELV $4254
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $4256
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4256
+LABELV $4249
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4251
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3176
+INDIRI4
+LTI4 $4248
+LABELV $4250
+LABELV $4236
+LABELV $4233
+LABELV $4215
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4260
+ARGP4
+ADDRLP4 3240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+NEI4 $4258
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4258
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4263
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $4261
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $4264
+CNSTI4 3
+ARGI4
+ADDRGP4 $4267
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4264
+CNSTI4 0
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4261
+CNSTI4 0
+ARGI4
+ADDRLP4 3248
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3248
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4271
+JUMPV
+LABELV $4268
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4275
+JUMPV
+LABELV $4272
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4278
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3252
+INDIRI4
+CNSTI4 0
+NEI4 $4276
+ADDRGP4 $4273
+JUMPV
+LABELV $4276
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $4279
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3260
+INDIRI4
+ASGNI4
+ADDRGP4 $4274
+JUMPV
+LABELV $4279
+LABELV $4273
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+LABELV $4275
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4272
+LABELV $4274
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4281
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $4283
+CNSTI4 3
+ARGI4
+ADDRGP4 $4286
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4283
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $4269
+JUMPV
+LABELV $4281
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4211
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $4287
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $4269
+CNSTI4 3
+ARGI4
+ADDRGP4 $4292
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4269
+JUMPV
+LABELV $4287
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4260
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $4293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3264
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $4295
+ADDRGP4 $4269
+JUMPV
+LABELV $4295
+ADDRLP4 3268
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4297
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4297
+ADDRLP4 3272
+CNSTI4 44
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $4297
+ADDRLP4 3276
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3268
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+LEF4 $4297
+ADDRLP4 3268
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $4297
+ADDRGP4 $4269
+JUMPV
+LABELV $4297
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $4299
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3288
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $4301
+ADDRGP4 $4269
+JUMPV
+LABELV $4301
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $4299
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4293
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4305
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $4303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3268
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $4306
+ADDRGP4 $4269
+JUMPV
+LABELV $4306
+ADDRLP4 3272
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4308
+ADDRLP4 3272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4308
+ADDRLP4 3276
+CNSTI4 44
+ASGNI4
+ADDRLP4 3272
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $4308
+ADDRLP4 3280
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3272
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+LEF4 $4308
+ADDRLP4 3272
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $4308
+ADDRGP4 $4269
+JUMPV
+LABELV $4308
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+EQI4 $4310
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3292
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3292
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $4312
+ADDRGP4 $4269
+JUMPV
+LABELV $4312
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $4310
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4194
+JUMPV
+LABELV $4303
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4316
+ARGP4
+ADDRLP4 3268
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $4314
+ADDRGP4 $4269
+JUMPV
+LABELV $4314
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4319
+ARGP4
+ADDRLP4 3272
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+EQI4 $4321
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4320
+ARGP4
+ADDRLP4 3276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $4317
+LABELV $4321
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4263
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $4322
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+LABELV $4322
+LABELV $4317
+LABELV $4269
+LABELV $4271
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $4325
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $4268
+LABELV $4325
+CNSTI4 0
+RETI4
+LABELV $4194
+endproc BotGetActivateGoal 3296 20
+proc BotGoForActivateGoal 132 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $4327
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $4327
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $4329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4332
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $4326
+JUMPV
+LABELV $4329
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $4334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4336
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $4326
+JUMPV
+LABELV $4334
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $4326
+endproc BotGoForActivateGoal 132 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $4211
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4338
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $4340
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4339
+JUMPV
+LABELV $4338
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $4341
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4339
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $4337
+endproc BotPrintActivateGoalInfo 296 36
+proc BotRandomMove 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $4345
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $4349
+ADDRGP4 $4347
+JUMPV
+LABELV $4349
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CVFI4 4
+CNSTI4 45
+ADDI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+LABELV $4346
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+LTI4 $4345
+LABELV $4347
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $4354
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4355
+JUMPV
+LABELV $4354
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $4355
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+LABELV $4342
+endproc BotRandomMove 36 16
+lit
+align 4
+LABELV $4357
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotObstacleAvoidanceMoveExt
+code
+proc BotObstacleAvoidanceMoveExt 504 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 124
+ADDRGP4 $4357
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 6
+ASGNI4
+ADDRLP4 172
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 172
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 172
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1036831949
+GEF4 $4360
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1135869952
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+LABELV $4360
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $4364
+ADDRLP4 0
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 52
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 0
+LEF4 $4367
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1112014848
+LEF4 $4369
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+ADDRGP4 $4370
+JUMPV
+LABELV $4369
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $4370
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $4368
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $4368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 5
+ASGNI4
+ADDRGP4 $4368
+JUMPV
+LABELV $4367
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 136+8
+ADDRLP4 136+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRLP4 400
+ADDRGP4 VectorToYaw
+CALLF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 404
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 408
+ADDRLP4 404
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 412
+ADDRLP4 404
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 408
+INDIRF4
+MULF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 412
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 416
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 420
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 420
+INDIRF4
+MULF4
+ADDRLP4 112+4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 424
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 416
+INDIRF4
+ADDRLP4 424
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 216
+ADDRLP4 260+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216+4
+ADDRLP4 260+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216+8
+ADDRLP4 260+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRLP4 432
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 228
+INDIRF4
+GTF4 $4398
+ADDRLP4 436
+CNSTF4 1124532224
+ASGNF4
+ADDRGP4 $4399
+JUMPV
+LABELV $4398
+ADDRLP4 436
+CNSTF4 1119092736
+ADDRLP4 228
+INDIRF4
+ADDRLP4 188
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $4399
+ADDRLP4 256
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRLP4 440
+CNSTF4 0
+ASGNF4
+ADDRLP4 204+8
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 444
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRLP4 452
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 232+4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 232+8
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 460
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 460
+INDIRI4
+NEI4 $4407
+ADDRLP4 56+4
+INDIRI4
+ADDRLP4 460
+INDIRI4
+NEI4 $4407
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4410
+ADDRLP4 148
+ADDRLP4 232
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $4410
+ADDRLP4 388
+ADDRLP4 56+8
+INDIRF4
+ASGNF4
+ADDRGP4 $4408
+JUMPV
+LABELV $4407
+ADDRLP4 388
+CNSTF4 0
+ASGNF4
+LABELV $4408
+ADDRLP4 256
+CNSTF4 3212836864
+ADDRLP4 256
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 464
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 464
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRLP4 472
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 472
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 472
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 480
+INDIRI4
+NEI4 $4419
+ADDRLP4 56+4
+INDIRI4
+ADDRLP4 480
+INDIRI4
+NEI4 $4419
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4422
+ADDRLP4 160
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+LABELV $4422
+ADDRLP4 392
+ADDRLP4 56+8
+INDIRF4
+ASGNF4
+ADDRGP4 $4420
+JUMPV
+LABELV $4419
+ADDRLP4 392
+CNSTF4 0
+ASGNF4
+LABELV $4420
+ADDRLP4 484
+CNSTF4 0
+ASGNF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 484
+INDIRF4
+NEF4 $4426
+ADDRLP4 388
+INDIRF4
+ADDRLP4 484
+INDIRF4
+NEF4 $4426
+LABELV $4426
+ADDRLP4 488
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ADDRLP4 492
+INDIRF4
+GEF4 $4430
+ADDRLP4 392
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ADDRLP4 492
+INDIRF4
+LTF4 $4428
+LABELV $4430
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+LTF4 $4431
+ADDRLP4 148
+ADDRLP4 232
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4431
+ADDRLP4 160
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+LABELV $4432
+LABELV $4428
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $4433
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $4435
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 5
+ASGNI4
+LABELV $4435
+LABELV $4433
+LABELV $4368
+LABELV $4364
+ADDRGP4 $203
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4437
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $4356
+endproc BotObstacleAvoidanceMoveExt 504 28
+lit
+align 4
+LABELV $4439
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc BotObstacleAvoidanceMove 76 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 $4439
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1036831949
+GEF4 $4442
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36+4
+CNSTF4 1135869952
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+LABELV $4442
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1112014848
+GTF4 $4453
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $4447
+LABELV $4453
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $4447
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $4458
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+LABELV $4458
+LABELV $4438
+endproc BotObstacleAvoidanceMove 76 16
+proc BotObstacleAvoidanceMoveFast 36 16
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1036831949
+GEF4 $4463
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+CNSTF4 1135869952
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+LABELV $4463
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $4460
+endproc BotObstacleAvoidanceMoveFast 36 16
+export BotAIBlocked
+proc BotAIBlocked 568 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRGP4 bot_blocktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4469
+ADDRFP4 0
+INDIRP4
+CNSTI4 6672
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $203
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4437
+ARGP4
+ADDRLP4 516
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRGP4 $4467
+JUMPV
+LABELV $4469
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $4471
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4472
+JUMPV
+LABELV $4471
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $4473
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4474
+JUMPV
+LABELV $4473
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $4475
+ADDRLP4 152
+CNSTI4 3
+ASGNI4
+ADDRGP4 $4476
+JUMPV
+LABELV $4475
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $4477
+ADDRLP4 152
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4478
+JUMPV
+LABELV $4477
+ADDRLP4 152
+CNSTI4 6
+ASGNI4
+LABELV $4478
+LABELV $4476
+LABELV $4474
+LABELV $4472
+ADDRGP4 $203
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4437
+ARGP4
+ADDRLP4 516
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $4479
+ADDRLP4 148
+CNSTI4 400
+ASGNI4
+ADDRGP4 $4480
+JUMPV
+LABELV $4479
+ADDRLP4 148
+CNSTI4 200
+ASGNI4
+LABELV $4480
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $4481
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4482
+JUMPV
+LABELV $4481
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $4483
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4484
+JUMPV
+LABELV $4483
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+LABELV $4484
+LABELV $4482
+ADDRLP4 524
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 524
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 524
+INDIRI4
+NEI4 $4485
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $4467
+JUMPV
+LABELV $4485
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $4487
+ADDRGP4 $4467
+JUMPV
+LABELV $4487
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 852
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4497
+ADDRLP4 532
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 64
+LTI4 $4499
+ADDRLP4 532
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $4503
+ADDRLP4 532
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $4499
+LABELV $4503
+CNSTI4 2
+ARGI4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 540
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 540
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 540
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_TraceEntities
+CALLV
+pop
+ADDRLP4 208+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4508
+ADDRGP4 $4467
+JUMPV
+LABELV $4508
+LABELV $4499
+ADDRLP4 12+92
+INDIRI4
+CNSTI4 0
+LEI4 $4498
+ADDRLP4 12+92
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $4498
+ADDRLP4 140
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $4217
+ARGP4
+ADDRLP4 536
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 540
+CNSTI4 0
+ASGNI4
+ADDRLP4 536
+INDIRI4
+ADDRLP4 540
+INDIRI4
+NEI4 $4515
+ADDRLP4 140
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ADDRLP4 540
+INDIRI4
+NEI4 $4515
+ADDRLP4 140
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4517
+ADDRLP4 140
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4517
+ADDRGP4 $4467
+JUMPV
+LABELV $4517
+LABELV $4515
+ADDRLP4 140
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $4260
+ARGP4
+ADDRLP4 544
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 548
+CNSTI4 0
+ASGNI4
+ADDRLP4 544
+INDIRI4
+ADDRLP4 548
+INDIRI4
+NEI4 $4519
+ADDRLP4 140
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ADDRLP4 548
+INDIRI4
+NEI4 $4519
+ADDRGP4 $4467
+JUMPV
+LABELV $4519
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $4523
+ADDRLP4 556
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4525
+ADDRLP4 556
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4525
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $4525
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264+4+40
+INDIRI4
+ARGI4
+ADDRLP4 560
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+NEI4 $4527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $4527
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $4498
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 564
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+EQI4 $4498
+ADDRGP4 $4467
+JUMPV
+LABELV $4523
+ADDRLP4 264
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 BotObstacleAvoidanceMoveFast
+CALLV
+pop
+ADDRGP4 $4467
+JUMPV
+LABELV $4497
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $4533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+EQI4 $4533
+ADDRLP4 0
+ARGP4
+ADDRLP4 540
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 544
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 540
+INDIRF4
+CNSTF4 1067450368
+ADDRLP4 544
+INDIRF4
+ADDRLP4 544
+INDIRF4
+MULF4
+MULF4
+LEF4 $4533
+ADDRGP4 $4467
+JUMPV
+LABELV $4533
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 156
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GTF4 $4541
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $4535
+LABELV $4541
+CNSTI4 2
+ARGI4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 556
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_TraceEntities
+CALLV
+pop
+ADDRLP4 208+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4546
+ADDRGP4 $4467
+JUMPV
+LABELV $4546
+LABELV $4535
+LABELV $4498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 BotObstacleAvoidanceMove
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4549
+ADDRFP4 0
+INDIRP4
+CNSTI4 6672
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+GEF4 $4551
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $4553
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $4554
+JUMPV
+LABELV $4553
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $4555
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $4555
+LABELV $4554
+LABELV $4551
+LABELV $4549
+LABELV $4467
+endproc BotAIBlocked 568 28
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 332 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $4558
+CNSTI4 0
+RETI4
+ADDRGP4 $4557
+JUMPV
+LABELV $4558
+ADDRFP4 0
+INDIRP4
+CNSTI4 6696
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $4561
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+LEF4 $4561
+CNSTI4 0
+RETI4
+ADDRGP4 $4557
+JUMPV
+LABELV $4561
+ADDRFP4 0
+INDIRP4
+CNSTI4 6696
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 304
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 304
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+CNSTI4 262144
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $4563
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $4564
+ADDRLP4 308
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 308
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 308
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $4564
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 312
+CNSTP4 0
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $4564
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $4564
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4576
+ADDRLP4 324
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4576
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $4576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $4578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $4557
+JUMPV
+LABELV $4578
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $4564
+JUMPV
+LABELV $4563
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $4582
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $4585
+LABELV $4585
+LABELV $4582
+LABELV $4564
+CNSTI4 0
+RETI4
+LABELV $4557
+endproc BotAIPredictObstacles 332 44
+proc BotCheckConsoleMessages 1004 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $4590
+JUMPV
+LABELV $4589
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 trap_BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 10
+GEI4 $4592
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $4594
+ADDRLP4 952
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 952
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $4594
+ADDRGP4 $4591
+JUMPV
+LABELV $4594
+LABELV $4592
+ADDRLP4 276
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $4599
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 952
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $4602
+ADDRLP4 276
+ADDRLP4 288+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $4602
+LABELV $4599
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 trap_BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $4608
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $4611
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $4611
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 960
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $4615
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4590
+JUMPV
+LABELV $4615
+ADDRLP4 288+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $4618
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4590
+JUMPV
+LABELV $4618
+ADDRLP4 288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 872
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 616
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 872
+ARGP4
+ADDRLP4 964
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 964
+INDIRI4
+NEI4 $4621
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4590
+JUMPV
+LABELV $4621
+ADDRLP4 616
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $4623
+ADDRGP4 $4626
+ARGP4
+ADDRGP4 $4627
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 968
+CNSTP4 0
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $4628
+CNSTI4 1
+ARGI4
+ADDRGP4 $4630
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4624
+JUMPV
+LABELV $4628
+CNSTI4 1
+ARGI4
+ADDRGP4 $4631
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4624
+JUMPV
+LABELV $4623
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $4632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $4632
+ADDRLP4 976
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $4632
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 63
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 944
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 988
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $4634
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 944
+INDIRF4
+GEF4 $4634
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 996
+CNSTP4 0
+ASGNP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 0
+EQI4 $4636
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4591
+JUMPV
+LABELV $4636
+LABELV $4634
+LABELV $4632
+LABELV $4624
+LABELV $4611
+LABELV $4608
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $4590
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+NEI4 $4589
+LABELV $4591
+LABELV $4588
+endproc BotCheckConsoleMessages 1004 48
+lit
+align 4
+LABELV $4639
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotCheckBlockedTeammates
+code
+proc BotCheckBlockedTeammates 500 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRGP4 $4639
+INDIRB
+ASGNB 12
+ADDRGP4 bot_teamblock+12
+INDIRI4
+CNSTI4 0
+NEI4 $4640
+ADDRGP4 $4638
+JUMPV
+LABELV $4640
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $4643
+ADDRGP4 $4638
+JUMPV
+LABELV $4643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $4645
+ADDRGP4 $4638
+JUMPV
+LABELV $4645
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 400
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $4647
+ADDRGP4 $4638
+JUMPV
+LABELV $4647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+EQI4 $4649
+ADDRGP4 $4638
+JUMPV
+LABELV $4649
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 408
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4654
+JUMPV
+LABELV $4651
+ADDRLP4 152
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4656
+ADDRGP4 $4652
+JUMPV
+LABELV $4656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $4658
+ADDRGP4 $4652
+JUMPV
+LABELV $4658
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $4660
+ADDRGP4 $4652
+JUMPV
+LABELV $4660
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4663
+ADDRGP4 $4652
+JUMPV
+LABELV $4663
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+EQI4 $4665
+ADDRGP4 $4652
+JUMPV
+LABELV $4665
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+CNSTI4 0
+NEI4 $4667
+ADDRGP4 $4652
+JUMPV
+LABELV $4667
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 0+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 0+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 428
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 256
+ADDRLP4 428
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 240
+CNSTI4 852
+ADDRLP4 152
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 432
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 432
+INDIRF4
+CNSTF4 1193033728
+GEF4 $4676
+ADDRLP4 0
+ARGP4
+ADDRLP4 436
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+NEI4 $4676
+ADDRLP4 0
+ARGP4
+ADDRLP4 440
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 444
+CNSTI4 0
+ASGNI4
+ADDRLP4 440
+INDIRI4
+ADDRLP4 444
+INDIRI4
+NEI4 $4676
+ADDRLP4 0+80
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 444
+INDIRI4
+NEI4 $4676
+ADDRLP4 256
+INDIRI4
+CNSTI4 16384
+LEI4 $4679
+ADDRGP4 $4652
+JUMPV
+LABELV $4679
+ADDRLP4 240
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $4684
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1114636288
+ARGF4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+EQI4 $4681
+ADDRLP4 0+44
+ARGP4
+CNSTI4 60
+ARGI4
+ADDRLP4 288
+ARGP4
+ADDRLP4 452
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+EQI4 $4681
+LABELV $4684
+ADDRLP4 156
+CNSTI4 42
+ASGNI4
+ADDRGP4 $4682
+JUMPV
+LABELV $4681
+ADDRLP4 156
+CNSTI4 8
+ASGNI4
+LABELV $4682
+ADDRLP4 284
+CNSTI4 200
+ASGNI4
+ADDRGP4 $4677
+JUMPV
+LABELV $4676
+ADDRLP4 256
+INDIRI4
+CNSTI4 65536
+LEI4 $4685
+ADDRGP4 $4652
+JUMPV
+LABELV $4685
+ADDRLP4 156
+CNSTF4 1132462080
+CNSTF4 1124073472
+ADDRLP4 304
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 284
+CNSTI4 400
+ASGNI4
+LABELV $4677
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+INDIRF4
+LTF4 $4687
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $4687
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 456
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 456
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 456
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_TraceEntities
+CALLV
+pop
+ADDRLP4 184+52
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $4701
+ADDRLP4 184+4
+INDIRI4
+CNSTI4 0
+NEI4 $4706
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4701
+LABELV $4706
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 308
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 244+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 240
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 244
+ADDRLP4 240
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 244
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 244+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 3259498496
+LEF4 $4708
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $4708
+ADDRLP4 464
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 128+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $4724
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $4730
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $4732
+ADDRLP4 484
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 484
+INDIRF4
+ADDRLP4 484
+INDIRF4
+MULF4
+ADDRLP4 488
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 492
+INDIRF4
+ADDRLP4 492
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+GEF4 $4734
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 496
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 332+4
+CNSTF4 1135869952
+ADDRLP4 496
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 332+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 332
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRGP4 $4735
+JUMPV
+LABELV $4734
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $4735
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $4738
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $4739
+JUMPV
+LABELV $4738
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+ADDRLP4 320
+INDIRB
+ASGNB 12
+LABELV $4739
+LABELV $4732
+LABELV $4730
+LABELV $4724
+LABELV $4701
+LABELV $4652
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4654
+ADDRLP4 152
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $4651
+LABELV $4638
+endproc BotCheckBlockedTeammates 500 28
+proc BotCheckForGrenades 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4743
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $4741
+LABELV $4743
+ADDRGP4 $4740
+JUMPV
+LABELV $4741
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $4740
+endproc BotCheckForGrenades 4 16
+proc BotCheckForProxMines 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4747
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $4745
+LABELV $4747
+ADDRGP4 $4744
+JUMPV
+LABELV $4745
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $4748
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $4748
+ADDRGP4 $4744
+JUMPV
+LABELV $4748
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $4752
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $4750
+LABELV $4752
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $4753
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $4750
+LABELV $4753
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $4754
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $4750
+LABELV $4754
+ADDRGP4 $4744
+JUMPV
+LABELV $4750
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $4755
+ADDRGP4 $4744
+JUMPV
+LABELV $4755
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4744
+endproc BotCheckForProxMines 40 16
+proc BotCheckForKamikazeBody 0 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $4758
+ADDRGP4 $4757
+JUMPV
+LABELV $4758
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $4760
+ADDRGP4 $4757
+JUMPV
+LABELV $4760
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $4757
+endproc BotCheckForKamikazeBody 0 0
+proc BotCheckEvents 312 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 852
+ADDRLP4 260
+INDIRI4
+MULI4
+ADDRGP4 g_entities+384
+ADDP4
+INDIRI4
+NEI4 $4763
+ADDRGP4 $4762
+JUMPV
+LABELV $4763
+ADDRLP4 264
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDP4
+CNSTI4 852
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 g_entities+384
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $4767
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $4768
+JUMPV
+LABELV $4767
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $4768
+ADDRLP4 268
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 15
+LTI4 $4872
+ADDRLP4 268
+INDIRI4
+CNSTI4 36
+GTI4 $4873
+ADDRLP4 268
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4874-60
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4874
+address $4771
+address $4783
+address $4795
+address $4769
+address $4769
+address $4769
+address $4769
+address $4833
+address $4769
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4871
+address $4769
+address $4770
+address $4770
+code
+LABELV $4872
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $4770
+ADDRGP4 $4769
+JUMPV
+LABELV $4873
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 83
+LTI4 $4769
+ADDRLP4 272
+INDIRI4
+CNSTI4 120
+GTI4 $4769
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4876-332
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4876
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4769
+address $4769
+address $4769
+address $4769
+address $4769
+address $4769
+address $4770
+address $4770
+address $4770
+address $4770
+address $4769
+address $4769
+address $4770
+address $4770
+address $4769
+address $4769
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+address $4770
+code
+LABELV $4771
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4770
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4776
+ADDRLP4 276
+INDIRI4
+CNSTI4 256
+LTI4 $4774
+LABELV $4776
+CNSTI4 3
+ARGI4
+ADDRGP4 $4777
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4770
+JUMPV
+LABELV $4774
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $4780
+ARGP4
+ADDRLP4 280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $4770
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $4770
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $4770
+JUMPV
+LABELV $4783
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4786
+ADDRLP4 276
+INDIRI4
+CNSTI4 256
+LTI4 $4784
+LABELV $4786
+CNSTI4 3
+ARGI4
+ADDRGP4 $4787
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4770
+JUMPV
+LABELV $4784
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $4790
+ARGP4
+ADDRLP4 280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $4788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4791
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRGP4 $4770
+JUMPV
+LABELV $4788
+ADDRLP4 4
+ARGP4
+ADDRGP4 $4794
+ARGP4
+ADDRLP4 284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $4770
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $4770
+JUMPV
+LABELV $4795
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $4796
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4770
+ADDRLP4 276
+INDIRI4
+CNSTI4 5
+GTI4 $4770
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4807
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4807
+address $4801
+address $4802
+address $4803
+address $4804
+address $4805
+address $4806
+code
+LABELV $4801
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4802
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4803
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4804
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4805
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4806
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4796
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $4808
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4770
+ADDRLP4 276
+INDIRI4
+CNSTI4 5
+GTI4 $4770
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4825
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4825
+address $4813
+address $4814
+address $4815
+address $4816
+address $4817
+address $4821
+code
+LABELV $4813
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4814
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4815
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4816
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4817
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $4819
+ADDRLP4 284
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4820
+JUMPV
+LABELV $4819
+ADDRLP4 284
+CNSTI4 1
+ASGNI4
+LABELV $4820
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4821
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $4823
+ADDRLP4 296
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4824
+JUMPV
+LABELV $4823
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+LABELV $4824
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4808
+ADDRLP4 276
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 6
+EQI4 $4828
+ADDRLP4 276
+INDIRI4
+CNSTI4 7
+NEI4 $4770
+LABELV $4828
+ADDRLP4 280
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $4832
+ADDRLP4 280
+INDIRI4
+CNSTI4 1
+EQI4 $4832
+ADDRGP4 $4770
+JUMPV
+LABELV $4832
+ADDRFP4 0
+INDIRP4
+CNSTI4 7464
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $4770
+JUMPV
+LABELV $4833
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+104
+INDIRI4
+CNSTI4 3
+GEI4 $4834
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4835
+JUMPV
+LABELV $4834
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 300
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 292
+INDIRF4
+GEF4 $4838
+ADDRLP4 304
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4839
+JUMPV
+LABELV $4838
+ADDRLP4 304
+CNSTI4 0
+ASGNI4
+LABELV $4839
+ADDRLP4 288
+ADDRLP4 304
+INDIRI4
+ASGNI4
+LABELV $4835
+ADDRLP4 276
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4840
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 280
+INDIRI4
+EQI4 $4845
+ADDRLP4 300
+INDIRI4
+CNSTI4 1023
+EQI4 $4845
+ADDRLP4 300
+INDIRI4
+CNSTI4 1022
+NEI4 $4842
+LABELV $4845
+ADDRFP4 0
+INDIRP4
+CNSTI4 6464
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4843
+JUMPV
+LABELV $4842
+ADDRFP4 0
+INDIRP4
+CNSTI4 6464
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4843
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6484
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6464
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4841
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $4848
+ADDRLP4 280
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+EQI4 $4850
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4850
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4841
+JUMPV
+LABELV $4848
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4841
+JUMPV
+LABELV $4840
+ADDRLP4 280
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4852
+ADDRFP4 0
+INDIRP4
+CNSTI4 6460
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6448
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6488
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $4853
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $4856
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $4857
+JUMPV
+LABELV $4856
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4857
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $4853
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4853
+JUMPV
+LABELV $4852
+ADDRLP4 300
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+NEI4 $4860
+ADDRLP4 276
+INDIRI4
+ADDRLP4 300
+INDIRI4
+NEI4 $4860
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4860
+LABELV $4853
+LABELV $4841
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $4770
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+112
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $4770
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $4770
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4770
+JUMPV
+LABELV $4871
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $4769
+LABELV $4770
+LABELV $4762
+endproc BotCheckEvents 312 16
+proc BotCheckSnapshot 244 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4880
+JUMPV
+LABELV $4879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForProxMines
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForKamikazeBody
+CALLV
+pop
+LABELV $4880
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 -1
+NEI4 $4879
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+188
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+192
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $4878
+endproc BotCheckSnapshot 244 16
+export BotCheckTeamScores
+proc BotCheckTeamScores 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4888
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $4892
+ADDRGP4 $4884
+JUMPV
+LABELV $4888
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 level+68+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 $4886
+JUMPV
+LABELV $4892
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRGP4 level+68+4
+INDIRI4
+ASGNI4
+LABELV $4886
+LABELV $4884
+endproc BotCheckTeamScores 8 0
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $4897
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $4899
+ADDRGP4 $4896
+JUMPV
+LABELV $4899
+LABELV $4897
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $4896
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4902
+ADDRFP4 0
+INDIRP4
+CNSTI4 7248
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $4904
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4904
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7204
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $4906
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $4906
+ADDRFP4 0
+INDIRP4
+CNSTI4 7248
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $4906
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7192
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7192
+ADDP4
+RETP4
+ADDRGP4 $4901
+JUMPV
+LABELV $4902
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $4901
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4909
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $4910
+JUMPV
+LABELV $4909
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $4910
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4911
+CNSTI4 0
+RETI4
+ADDRGP4 $4908
+JUMPV
+LABELV $4911
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $4913
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $4913
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7192
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7248
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $4908
+endproc BotGetAlternateRouteGoal 28 0
+proc BotSetupAlternativeRouteGoals 12 32
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $4916
+ADDRGP4 $4915
+JUMPV
+LABELV $4916
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $4918
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4922
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4920
+CNSTI4 2
+ARGI4
+ADDRGP4 $4923
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4920
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $4919
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4919
+JUMPV
+LABELV $4918
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $4931
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4935
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4933
+CNSTI4 2
+ARGI4
+ADDRGP4 $4936
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4933
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4932
+JUMPV
+LABELV $4931
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $4941
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4935
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4943
+CNSTI4 2
+ARGI4
+ADDRGP4 $4945
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4943
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4942
+JUMPV
+LABELV $4941
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $4950
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4935
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4952
+CNSTI4 2
+ARGI4
+ADDRGP4 $4954
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4952
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4950
+LABELV $4942
+LABELV $4932
+LABELV $4919
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $4915
+endproc BotSetupAlternativeRouteGoals 12 32
+export BotDeathmatchAI
+proc BotDeathmatchAI 1340 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $4960
+ADDRLP4 1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $4962
+ADDRGP4 $4959
+JUMPV
+LABELV $4962
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $4964
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $4965
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $4966
+JUMPV
+LABELV $4965
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $4967
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $4968
+JUMPV
+LABELV $4967
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $4968
+LABELV $4966
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $4960
+ADDRLP4 1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1320
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $4969
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $4969
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+CNSTI4 75751934
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $4969
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4973
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $4971
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4974
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+EQI4 $4978
+ADDRGP4 $4976
+JUMPV
+LABELV $4978
+LABELV $4975
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $4974
+LABELV $4976
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4980
+ADDRGP4 $4959
+JUMPV
+LABELV $4980
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $4982
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $4984
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4982
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4985
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $4985
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnterGame
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4985
+LABELV $4959
+endproc BotDeathmatchAI 1340 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4991
+JUMPV
+LABELV $4988
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4993
+ADDRGP4 $4989
+JUMPV
+LABELV $4993
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4995
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $4995
+ADDRGP4 $4989
+JUMPV
+LABELV $4995
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $4997
+ADDRGP4 $4989
+JUMPV
+LABELV $4997
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $5001
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $4987
+JUMPV
+LABELV $5001
+LABELV $4989
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ASGNP4
+LABELV $4991
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $4988
+LABELV $4987
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5007
+JUMPV
+LABELV $5004
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $5009
+ADDRGP4 $5005
+JUMPV
+LABELV $5009
+ADDRLP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $5011
+ADDRGP4 $5005
+JUMPV
+LABELV $5011
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $5015
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $5003
+JUMPV
+LABELV $5015
+LABELV $5005
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ASGNP4
+LABELV $5007
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $5004
+LABELV $5003
+endproc BotSetEntityNumForGoal 36 8
+proc BotSetEntityNumForGoalWithActivator 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5021
+JUMPV
+LABELV $5018
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5025
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5023
+LABELV $5025
+ADDRGP4 $5019
+JUMPV
+LABELV $5023
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $5026
+ADDRGP4 $5019
+JUMPV
+LABELV $5026
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1120403456
+GEF4 $5030
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $5017
+JUMPV
+LABELV $5030
+LABELV $5019
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 852
+ADDP4
+ASGNP4
+LABELV $5021
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $5018
+LABELV $5017
+endproc BotSetEntityNumForGoalWithActivator 40 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $5036
+JUMPV
+LABELV $5033
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4211
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $5037
+ADDRGP4 $5034
+JUMPV
+LABELV $5037
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $5039
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4227
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $5041
+CNSTI4 0
+RETI4
+ADDRGP4 $5032
+JUMPV
+LABELV $5041
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $5045
+CNSTI4 0
+RETI4
+ADDRGP4 $5032
+JUMPV
+LABELV $5045
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $5032
+JUMPV
+LABELV $5039
+LABELV $5034
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $5036
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5033
+CNSTI4 0
+RETI4
+LABELV $5032
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 156 16
+ADDRGP4 $5048
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $5049
+ARGP4
+ADDRGP4 $5050
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $5051
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5055
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5053
+CNSTI4 2
+ARGI4
+ADDRGP4 $5056
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5053
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5059
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5052
+CNSTI4 2
+ARGI4
+ADDRGP4 $5060
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $5052
+JUMPV
+LABELV $5051
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $5061
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4922
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5063
+CNSTI4 2
+ARGI4
+ADDRGP4 $5065
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5063
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5055
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5066
+CNSTI4 2
+ARGI4
+ADDRGP4 $5068
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5066
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5059
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $5062
+CNSTI4 2
+ARGI4
+ADDRGP4 $5071
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $5062
+JUMPV
+LABELV $5061
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $5072
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5076
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5074
+CNSTI4 2
+ARGI4
+ADDRGP4 $5077
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5074
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $5078
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5081
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5079
+CNSTI4 2
+ARGI4
+ADDRGP4 $5082
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5079
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $5083
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+ADDRGP4 $5073
+JUMPV
+LABELV $5072
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $5084
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5076
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5086
+CNSTI4 2
+ARGI4
+ADDRGP4 $5088
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5086
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $5078
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5081
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5089
+CNSTI4 2
+ARGI4
+ADDRGP4 $5091
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5089
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $5083
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4935
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $5092
+CNSTI4 2
+ARGI4
+ADDRGP4 $4954
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5092
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 $5094
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+LABELV $5084
+LABELV $5073
+LABELV $5062
+LABELV $5052
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $5098
+JUMPV
+LABELV $5095
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $5099
+ADDRGP4 $5096
+JUMPV
+LABELV $5099
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $5101
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $5104
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $5104
+LABELV $5101
+LABELV $5096
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $5098
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5095
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $5047
+endproc BotSetupDeathmatchAI 156 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $5106
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export botCheckedAreas
+align 1
+LABELV botCheckedAreas
+skip 65536
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamFormationDist
+import BotSetTeamCampDist
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotDetermineVisibleTeammates
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Wait
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Wait
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export neutralobelisk
+align 4
+LABELV neutralobelisk
+skip 56
+export blueobelisk
+align 4
+LABELV blueobelisk
+skip 56
+export redobelisk
+align 4
+LABELV redobelisk
+skip 56
+export ctf_neutralflag
+align 4
+LABELV ctf_neutralflag
+skip 56
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+import maxclients
+import mapname
+export gametype
+align 4
+LABELV gametype
+skip 4
+import bot_alt_attack
+import bot_alt_aim
+import bot_alt_pickup
+import bot_alt_aggressive
+import bot_teamavoidpickup
+import bot_teamblock
+import bot_teamredstrategy
+import bot_teambluestrategy
+import bot_shownodechanges
+import bot_noaccerror
+import bot_nowalk
+import bot_noshoot
+import bot_equalizer_teambon
+import bot_equalizer_fembon
+import bot_equalizer_react
+import bot_equalizer_aim
+import bot_equalize
+import bot_predictobstacles
+import bot_blocktime
+import bot_checktime
+import bot_visualrange
+import bot_memorydump
+import bot_interbreedwrite
+import bot_interbreedcycle
+import bot_interbreedbots
+import bot_interbreedchar
+import bot_challenge
+import bot_rocketjump
+import bot_report
+import bot_pause
+import bot_nochat
+import bot_fastchat
+import bot_testclusters
+import bot_testsolid
+import bot_testrchat
+import bot_testichat
+import bot_reloadcharacters
+import bot_thinktime
+import bot_saveroutingcache
+import bot_aasoptimize
+import bot_forcewrite
+import bot_forcereachability
+import bot_forceclustering
+import bot_visualizejumppads
+import bot_reachability
+import bot_groundonly
+import bot_maxdebugpolys
+import bot_debug
+import bot_developer
+import bot_enable
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_TraceEntities
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $5094
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5091
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5088
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5083
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5082
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5081
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5078
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5077
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5076
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5071
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5068
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5065
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5060
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5059
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $5056
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5055
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $5050
+byte 1 50
+byte 1 0
+align 1
+LABELV $5049
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5048
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4984
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4973
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $4964
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $4954
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $4945
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $4936
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $4935
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $4923
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4922
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $4794
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $4791
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $4790
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $4787
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4780
+byte 1 42
+byte 1 102
+byte 1 118
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $4777
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4631
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $4630
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $4627
+byte 1 49
+byte 1 0
+align 1
+LABELV $4626
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $4437
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $4341
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4340
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4336
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $4332
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $4320
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $4319
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $4316
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $4305
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4292
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4286
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4278
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $4267
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4263
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4260
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $4227
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4222
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $4217
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4214
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4211
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4210
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4198
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4014
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $3991
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3988
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $3890
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $3889
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $3888
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2701
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2696
+byte 1 109
+byte 1 121
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $2692
+byte 1 114
+byte 1 97
+byte 1 122
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1816
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1815
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1814
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1111
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $858
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $844
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $711
+byte 1 93
+byte 1 0
+align 1
+LABELV $710
+byte 1 91
+byte 1 0
+align 1
+LABELV $709
+byte 1 32
+byte 1 0
+align 1
+LABELV $667
+byte 1 110
+byte 1 0
+align 1
+LABELV $666
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $661
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $660
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $659
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $276
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $251
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $228
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $203
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $202
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $84
+byte 1 116
+byte 1 0
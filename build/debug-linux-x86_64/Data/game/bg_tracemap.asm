@@ -0,0 +1,5148 @@
+data
+align 4
+LABELV $69
+byte 4 0
+align 4
+LABELV $70
+byte 4 0
+export BG_GenerateTracemap
+code
+proc BG_GenerateTracemap 1300 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $71
+ARGP4
+ADDRLP4 200
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 200
+ARGP4
+ADDRLP4 1224
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $72
+ADDRGP4 $74
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $68
+JUMPV
+LABELV $72
+ADDRLP4 1236
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+EQF4 $75
+ADDRGP4 $77
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $68
+JUMPV
+LABELV $75
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $78
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 tracemap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 786460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 120
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 100
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1248
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 132
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 1248
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1252
+CNSTI4 4
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1252
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1252
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 1248
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $79
+ADDRLP4 1256
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 1256
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 1256
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $83
+ADDRLP4 1260
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1264
+CNSTP4 0
+ASGNP4
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 1268
+ADDRGP4 $70
+ASGNP4
+ADDRLP4 1268
+INDIRP4
+ADDRLP4 1268
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $97
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $101
+ADDRLP4 76+8
+CNSTF4 3347054336
+ASGNF4
+LABELV $101
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1272
+CNSTP4 0
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1276
+ADDRGP4 $70
+ASGNP4
+ADDRLP4 1276
+INDIRP4
+ADDRLP4 1276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $109
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $96
+JUMPV
+LABELV $109
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $96
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+LEF4 $119
+ADDRLP4 120
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $119
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+GEF4 $96
+ADDRLP4 100
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $106
+LABELV $95
+ADDRGP4 $94
+JUMPV
+LABELV $96
+ADDRLP4 1272
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1272
+INDIRI4
+ASGNI4
+ADDRLP4 1276
+ADDRGP4 $69
+INDIRI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $129
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $127
+LABELV $129
+ADDRGP4 $69
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1284
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1284
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $70
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $127
+LABELV $84
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $83
+LABELV $80
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $79
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1256
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1256
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $70
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $131
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 108
+CNSTI4 65536
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $132
+ADDRLP4 1260
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $136
+ADDRLP4 1264
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 3347054592
+NEF4 $150
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $146
+JUMPV
+LABELV $149
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $152
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $151
+JUMPV
+LABELV $152
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $156
+ADDRLP4 76+8
+CNSTF4 1199570688
+ASGNF4
+LABELV $156
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1268
+CNSTP4 0
+ASGNP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1272
+ADDRGP4 $70
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ADDRLP4 1272
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $163
+ADDRLP4 4+12
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRLP4 1276
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+NEI4 $166
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+LEF4 $172
+ADDRLP4 116
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $172
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+GEF4 $151
+ADDRLP4 108
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $166
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $161
+JUMPV
+LABELV $163
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $186
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $151
+JUMPV
+LABELV $186
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $190
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+LEF4 $196
+ADDRLP4 116
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $196
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+GEF4 $151
+ADDRLP4 108
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $190
+ADDRLP4 64+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $161
+LABELV $150
+ADDRGP4 $149
+JUMPV
+LABELV $151
+LABELV $146
+ADDRLP4 1268
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1268
+INDIRI4
+ASGNI4
+ADDRLP4 1272
+ADDRGP4 $69
+INDIRI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $209
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $207
+LABELV $209
+ADDRGP4 $69
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1280
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1280
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $70
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $207
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $136
+LABELV $133
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $132
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1260
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1260
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $70
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $210
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 112
+CNSTI4 65536
+ASGNI4
+ADDRLP4 128
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $211
+ADDRLP4 1264
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CVIF4 4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $215
+ADDRLP4 1268
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 76+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1276
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 1276
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $223
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 1276
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $223
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 1280
+CNSTP4 0
+ASGNP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1284
+ADDRGP4 $70
+ASGNP4
+ADDRLP4 1284
+INDIRP4
+ADDRLP4 1284
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $227
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $224
+JUMPV
+LABELV $227
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 1280
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1284
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $224
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $236
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+LEF4 $239
+ADDRLP4 128
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $239
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+GEF4 $243
+ADDRLP4 112
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $243
+LABELV $236
+ADDRLP4 1280
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 1280
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+ADDRGP4 $69
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $249
+ADDRLP4 1284
+INDIRI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $247
+LABELV $249
+ADDRGP4 $69
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1292
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1292
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $70
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $247
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $215
+LABELV $212
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $211
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1264
+ADDRLP4 60
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1264
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $70
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 124
+CNSTF4 1132331008
+ADDRLP4 120
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+NEF4 $250
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+LABELV $250
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $252
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $256
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+LTF4 $260
+ADDRLP4 1268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $260
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $265
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $269
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $269
+LABELV $266
+LABELV $257
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $256
+LABELV $253
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $252
+ADDRLP4 124
+CNSTF4 1132331008
+ADDRLP4 128
+INDIRI4
+ADDRLP4 112
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+NEF4 $273
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+LABELV $273
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $275
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $279
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+LTF4 $283
+ADDRLP4 1268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $283
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $292
+LABELV $289
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $279
+LABELV $276
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $275
+ADDRLP4 116
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $296
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 124
+CNSTF4 1132331008
+ADDRLP4 116
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $297
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $298
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $302
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $306
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 1268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1272
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 124
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $307
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $312
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $316
+LABELV $313
+LABELV $303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $302
+LABELV $299
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $298
+ADDRLP4 136
+ARGP4
+ADDRLP4 1268
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRLP4 1272
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 2
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 1
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 1
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 32
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $321
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $325
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $329
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $326
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $326
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $339
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $339
+address $333
+address $334
+address $335
+address $336
+address $337
+address $338
+code
+LABELV $333
+ADDRLP4 100
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $334
+ADDRLP4 120
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $335
+ADDRLP4 112
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $336
+ADDRLP4 128
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $337
+ADDRLP4 108
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $338
+ADDRLP4 116
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $329
+ADDRLP4 1280
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1280
+INDIRF4
+ADDRLP4 1284
+INDIRF4
+LTF4 $342
+ADDRLP4 1276
+ADDRLP4 1280
+INDIRF4
+ADDRLP4 1284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 1276
+ADDRLP4 1280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $343
+ADDRLP4 88
+ADDRLP4 1276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $344
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 1292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+LTF4 $349
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $350
+ADDRLP4 88
+ADDRLP4 1288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $345
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $351
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 0
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 1292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 60
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+LTF4 $356
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+ADDRLP4 1296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 1288
+ADDRLP4 1292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $357
+ADDRLP4 88
+ADDRLP4 1288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 88
+CNSTU1 255
+ASGNU1
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $352
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $325
+LABELV $322
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 256
+LTI4 $321
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $358
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $68
+endproc BG_GenerateTracemap 1300 28
+export BG_LoadTraceMap
+proc BG_LoadTraceMap 1180 12
+ADDRLP4 1132
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 1136
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1148
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+LTI4 $360
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $362
+ADDRLP4 1056
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+LABELV $363
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+LTI4 $362
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $366
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $370
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $374
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $374
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $376
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $376
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $402
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $402
+address $378
+address $382
+address $386
+address $390
+address $394
+address $398
+code
+LABELV $378
+ADDRLP4 1156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $382
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $386
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $390
+ADDRLP4 1168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $394
+ADDRLP4 1172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $398
+ADDRLP4 1176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $376
+LABELV $377
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $371
+JUMPV
+LABELV $374
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $407
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $407
+ADDRLP4 1156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $413
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $413
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $419
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $419
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $423
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $423
+LABELV $371
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $370
+LABELV $367
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $366
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $428
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $429
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $430
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $434
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $438
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $438
+LABELV $435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $434
+LABELV $431
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $430
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $443
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $444
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $445
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $449
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $453
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $453
+LABELV $450
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $449
+LABELV $446
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $445
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $458
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $459
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $460
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $464
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $468
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $468
+LABELV $465
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $464
+LABELV $461
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $460
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1160
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+RETI4
+ADDRGP4 $359
+JUMPV
+LABELV $361
+ADDRGP4 tracemap+786436
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786436+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1152
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1156
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor
+ADDRLP4 1152
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRLP4 1156
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor+4
+ADDRLP4 1152
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRLP4 1156
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 tracemap+786452
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 tracemap+786456
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+RETI4
+LABELV $359
+endproc BG_LoadTraceMap 1180 12
+proc BG_ClampPointToTracemapExtends 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+GEF4 $490
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786436
+INDIRF4
+ASGNF4
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+LEF4 $494
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786444
+INDIRF4
+ASGNF4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $495
+LABELV $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+GEF4 $498
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ASGNF4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+LEF4 $504
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+ASGNF4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $505
+LABELV $499
+LABELV $489
+endproc BG_ClampPointToTracemapExtends 4 0
+export BG_GetSkyHeightAtPoint
+proc BG_GetSkyHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $511
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $510
+JUMPV
+LABELV $511
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $510
+endproc BG_GetSkyHeightAtPoint 16 8
+export BG_GetSkyGroundHeightAtPoint
+proc BG_GetSkyGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $520
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $519
+JUMPV
+LABELV $520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $519
+endproc BG_GetSkyGroundHeightAtPoint 16 8
+export BG_GetGroundHeightAtPoint
+proc BG_GetGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $529
+CNSTF4 3347054592
+RETF4
+ADDRGP4 $528
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $528
+endproc BG_GetGroundHeightAtPoint 16 8
+export BG_GetTracemapGroundFloor
+proc BG_GetTracemapGroundFloor 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $538
+CNSTI4 -65536
+RETI4
+ADDRGP4 $537
+JUMPV
+LABELV $538
+ADDRGP4 tracemap+786452
+INDIRI4
+RETI4
+LABELV $537
+endproc BG_GetTracemapGroundFloor 0 0
+export BG_GetTracemapGroundCeil
+proc BG_GetTracemapGroundCeil 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $542
+CNSTI4 65536
+RETI4
+ADDRGP4 $541
+JUMPV
+LABELV $542
+ADDRGP4 tracemap+786456
+INDIRI4
+RETI4
+LABELV $541
+endproc BG_GetTracemapGroundCeil 0 0
+export FinalizeTracemapClamp
+proc FinalizeTracemapClamp 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $548
+LABELV $547
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $550
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $552
+ADDRFP4 4
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $552
+LABELV $551
+LABELV $545
+endproc FinalizeTracemapClamp 0 0
+bss
+align 4
+LABELV one_over_mapgrid_factor
+skip 8
+align 4
+LABELV tracemap
+skip 786460
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $473
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $358
+byte 1 84
+byte 1 82
+byte 1 85
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 45
+byte 1 88
+byte 1 70
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 0
+byte 1 0
+align 1
+LABELV $320
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $210
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $131
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $130
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $78
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $77
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $74
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $71
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
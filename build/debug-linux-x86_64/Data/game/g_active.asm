@@ -0,0 +1,5667 @@
+export G_DamageFeedback
+code
+proc G_DamageFeedback 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $69
+ADDRGP4 $68
+JUMPV
+LABELV $69
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1224
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1220
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $71
+ADDRGP4 $68
+JUMPV
+LABELV $71
+ADDRLP4 4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $73
+ADDRLP4 4
+CNSTF4 1132396544
+ASGNF4
+LABELV $73
+ADDRLP4 0
+INDIRP4
+CNSTI4 1244
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1244
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $76
+JUMPV
+LABELV $75
+ADDRLP4 0
+INDIRP4
+CNSTI4 1232
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8+4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $76
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+LEI4 $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $78
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1224
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1220
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1228
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $68
+endproc G_DamageFeedback 36 12
+export G_WorldEffects
+proc G_WorldEffects 24 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $83
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1292
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 30000
+ADDI4
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $83
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $86
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+LEI4 $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1292
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1292
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GEI4 $87
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1292
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $87
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 15
+ASGNI4
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTI4 19
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1292
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 30000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $87
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 30
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 21
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $108
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $108
+LABELV $103
+LABELV $101
+LABELV $82
+endproc G_WorldEffects 24 32
+export G_SetClientSound
+proc G_SetClientSound 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $111
+ADDRGP4 $113
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRGP4 level+372
+INDIRI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $115
+LABELV $112
+LABELV $110
+endproc G_SetClientSound 12 4
+export ClientImpacts
+proc ClientImpacts 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $118
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $122
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+NEI4 $126
+ADDRGP4 $124
+JUMPV
+LABELV $126
+LABELV $123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $125
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $122
+LABELV $124
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $128
+ADDRGP4 $119
+JUMPV
+LABELV $128
+ADDRLP4 8
+CNSTI4 852
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $130
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $130
+ADDRLP4 8
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $132
+ADDRGP4 $119
+JUMPV
+LABELV $132
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $119
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $121
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LTI4 $118
+LABELV $117
+endproc ClientImpacts 76 12
+data
+align 4
+LABELV $135
+byte 4 1109393408
+byte 4 1109393408
+byte 4 1112539136
+export G_TouchTriggers
+code
+proc G_TouchTriggers 4244 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $136
+ADDRGP4 $134
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $138
+ADDRGP4 $134
+JUMPV
+LABELV $138
+ADDRLP4 4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRGP4 $135
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $135+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $135+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRGP4 $135
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $135+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $135+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4196
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4196
+INDIRI4
+ASGNI4
+ADDRLP4 4204
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4216
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $152
+ADDRLP4 0
+CNSTI4 852
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 92
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4224
+CNSTI4 532
+ASGNI4
+ADDRLP4 4228
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $156
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $156
+ADDRGP4 $153
+JUMPV
+LABELV $156
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+BANDI4
+CNSTI4 0
+NEI4 $158
+ADDRGP4 $153
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $160
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $162
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 Touch_DoorTrigger
+CVPU4 4
+EQU4 $162
+ADDRGP4 $153
+JUMPV
+LABELV $162
+LABELV $160
+ADDRLP4 4232
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4232
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4232
+INDIRI4
+NEI4 $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRLP4 4236
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRGP4 $153
+JUMPV
+LABELV $164
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4236
+ADDRGP4 trap_EntityContact
+CALLI4
+ASGNI4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRGP4 $153
+JUMPV
+LABELV $169
+LABELV $165
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $171
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $173
+LABELV $153
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $155
+ADDRLP4 4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $152
+ADDRLP4 4224
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRI4
+EQI4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 216
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $175
+LABELV $134
+endproc G_TouchTriggers 4244 16
+export SpectatorThink
+proc SpectatorThink 252 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $178
+LABELV $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $183
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $182
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 400
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRLP4 4+220
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+224
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+CNSTI4 1
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+BANDI4
+ADDRLP4 248
+INDIRI4
+EQI4 $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+BANDI4
+ADDRLP4 248
+INDIRI4
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+LABELV $189
+LABELV $177
+endproc SpectatorThink 252 12
+export ClientInactivityTimer
+proc ClientInactivityTimer 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_inactivity+12
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 1280
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 60000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1284
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1065
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 1066
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 1067
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $196
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 1280
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1284
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $203
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1280
+ADDP4
+INDIRI4
+LEI4 $205
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1376
+DIVI4
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $191
+JUMPV
+LABELV $205
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1280
+ADDP4
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 1284
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 1284
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1376
+DIVI4
+ARGI4
+ADDRGP4 $212
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $209
+LABELV $203
+LABELV $197
+LABELV $193
+CNSTI4 1
+RETI4
+LABELV $191
+endproc ClientInactivityTimer 12 8
+lit
+align 4
+LABELV $239
+byte 4 2
+byte 4 3
+byte 4 4
+byte 4 5
+byte 4 6
+byte 4 7
+byte 4 8
+byte 4 9
+byte 4 10
+byte 4 11
+byte 4 12
+byte 4 13
+export ClientTimerActions
+code
+proc ClientTimerActions 108 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1308
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1308
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 376
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $217
+ADDRLP4 4
+CNSTI4 200
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+LABELV $217
+CNSTI4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $219
+ADDRLP4 4
+CNSTI4 200
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $219
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+GEF4 $224
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTF4 1066192077
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $226
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 104
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $223
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $230
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 104
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 100
+LEI4 $232
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $232
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CNSTI4 100
+LEI4 $234
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $234
+LABELV $223
+LABELV $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 1308
+ADDP4
+INDIRI4
+CNSTI4 1000
+GEI4 $214
+CNSTI4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $236
+ADDRLP4 40
+ADDRGP4 $239
+INDIRB
+ASGNB 48
+ADDRLP4 88
+CNSTI4 12
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $240
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $244
+ADDRLP4 20
+INDIRI4
+CNSTI4 13
+GTI4 $244
+ADDRLP4 20
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LSHI4
+ADDRGP4 $258-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $258
+address $246
+address $247
+address $248
+address $249
+address $250
+address $251
+address $252
+address $253
+address $254
+address $255
+address $256
+address $257
+code
+LABELV $246
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRLP4 36
+CNSTI4 5
+ASGNI4
+ADDRLP4 24
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $247
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+ADDRLP4 24
+CNSTI4 500
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $248
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 1500
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $249
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 1250
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $250
+ADDRLP4 32
+CNSTI4 5
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 2000
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $251
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 2000
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $252
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 2000
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $253
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 1750
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $254
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+ADDRLP4 24
+CNSTI4 750
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $255
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 1750
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $256
+ADDRLP4 32
+CNSTI4 50
+ASGNI4
+ADDRLP4 36
+CNSTI4 5
+ASGNI4
+ADDRLP4 24
+CNSTI4 750
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $257
+ADDRLP4 32
+CNSTI4 20
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 750
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 1000
+ASGNI4
+LABELV $245
+ADDRLP4 100
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1316
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $260
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1316
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $260
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1316
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $262
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 104
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1316
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $265
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1316
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GEI4 $264
+ADDRLP4 104
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $267
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $267
+LABELV $262
+LABELV $241
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $243
+ADDRLP4 28
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $240
+LABELV $236
+LABELV $213
+endproc ClientTimerActions 108 12
+export ClientIntermissionThink
+proc ClientIntermissionThink 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BXORI4
+BANDI4
+CNSTI4 0
+EQI4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 1184
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $270
+LABELV $269
+endproc ClientIntermissionThink 24 0
+export ClientEvents
+proc ClientEvents 152 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $273
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $273
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $275
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+LTI4 $326
+ADDRLP4 4
+INDIRI4
+CNSTI4 29
+GTI4 $327
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $328-96
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $328
+address $282
+address $282
+address $282
+address $282
+address $282
+address $282
+code
+LABELV $326
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $281
+ADDRGP4 $280
+JUMPV
+LABELV $327
+ADDRLP4 4
+INDIRI4
+CNSTI4 106
+EQI4 $324
+ADDRLP4 4
+INDIRI4
+CNSTI4 107
+EQI4 $325
+ADDRGP4 $280
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FireWeapon
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $283
+ADDRGP4 $280
+JUMPV
+LABELV $283
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $285
+ADDRGP4 $280
+JUMPV
+LABELV $285
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level+4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $289
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 116
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRLP4 116
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 120
+CNSTP4 0
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 852
+ADDRLP4 40+52
+INDIRI4
+MULI4
+ADDRGP4 level+4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $289
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+LTI4 $294
+ADDRLP4 4
+INDIRI4
+CNSTI4 29
+GTI4 $294
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $302-96
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $302
+address $296
+address $297
+address $298
+address $299
+address $300
+address $301
+code
+LABELV $296
+ADDRLP4 16
+CNSTI4 200
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $297
+ADDRLP4 16
+CNSTI4 50
+ASGNI4
+ADDRLP4 20
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $298
+ADDRLP4 16
+CNSTI4 25
+ASGNI4
+ADDRLP4 20
+CNSTI4 500
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $299
+ADDRLP4 16
+CNSTI4 15
+ASGNI4
+ADDRLP4 20
+CNSTI4 250
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $300
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $301
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $295
+ADDRLP4 124
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $307
+ADDRLP4 12
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $307
+ADDRLP4 12
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $304
+LABELV $307
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $304
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+LABELV $313
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRLP4 12
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 12
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $315
+ADDRLP4 12
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 50
+LEI4 $318
+ADDRLP4 24
+CNSTI4 50
+ASGNI4
+LABELV $318
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+CNSTP4 0
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 23
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+LEI4 $320
+ADDRGP4 $322
+ARGP4
+ADDRLP4 140
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 15
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1064514355
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $320
+ADDRGP4 $323
+ARGP4
+ADDRLP4 140
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 15
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 100
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $325
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_StartKamikaze
+CALLV
+pop
+LABELV $280
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $278
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $275
+LABELV $272
+endproc ClientEvents 152 32
+export SendPendingPredictableEvents
+proc SendPendingPredictableEvents 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+GEI4 $331
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $331
+LABELV $330
+endproc SendPendingPredictableEvents 52 12
+export ClientThink_Real
+proc ClientThink_Real 308 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $334
+ADDRGP4 $333
+JUMPV
+LABELV $334
+ADDRLP4 232
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1044
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $336
+ADDRLP4 232
+INDIRP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $336
+ADDRLP4 232
+INDIRP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+GEI4 $340
+ADDRLP4 232
+INDIRP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $340
+ADDRLP4 236
+ADDRLP4 232
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+GEI4 $344
+ADDRLP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $344
+ADDRGP4 $333
+JUMPV
+LABELV $344
+ADDRLP4 236
+INDIRI4
+CNSTI4 200
+LEI4 $346
+ADDRLP4 236
+CNSTI4 200
+ASGNI4
+LABELV $346
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $348
+ADDRGP4 $351
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $352
+ADDRGP4 $351
+ARGP4
+CNSTF4 1107558400
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $352
+LABELV $349
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 244
+INDIRI4
+NEI4 $358
+ADDRLP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $355
+LABELV $358
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $355
+ADDRGP4 level+9156
+INDIRI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientIntermissionThink
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $362
+ADDRLP4 0
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $365
+ADDRLP4 0
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $367
+ADDRGP4 $333
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorThink
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $365
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 ClientInactivityTimer
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRGP4 $333
+JUMPV
+LABELV $369
+ADDRLP4 0
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $371
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $373
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $374
+LABELV $372
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 g_gravity+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 g_speed+8
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $377
+ADDRLP4 252
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+CNSTF4 1069547520
+ADDRLP4 252
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $377
+ADDRLP4 240
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 256
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ADDRLP4 256
+INDIRI4
+NEI4 $380
+ADDRLP4 260
+ADDRLP4 232
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 1024
+BANDI4
+ADDRLP4 264
+INDIRI4
+NEI4 $380
+ADDRLP4 260
+INDIRI4
+ADDRLP4 256
+INDIRI4
+BANDI4
+ADDRLP4 264
+INDIRI4
+EQI4 $380
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRLP4 264
+INDIRI4
+GTI4 $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 CheckGauntletAttack
+CALLI4
+ASGNI4
+ADDRLP4 4+36
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1060
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $383
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 232
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $386
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $389
+ADDRLP4 4+28
+CNSTI4 37814273
+ASGNI4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRLP4 4+28
+CNSTI4 33619969
+ASGNI4
+LABELV $390
+LABELV $387
+ADDRLP4 4+220
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+224
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4+32
+ADDRGP4 g_debugMove+12
+INDIRI4
+ASGNI4
+ADDRLP4 4+212
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4+216
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1208
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9152
+INDIRI4
+ADDRLP4 272
+INDIRI4
+EQI4 $401
+ADDRGP4 g_singlePlayer+12
+INDIRI4
+ADDRLP4 272
+INDIRI4
+EQI4 $401
+ADDRGP4 level+56
+INDIRI4
+ADDRGP4 level+9152
+INDIRI4
+SUBI4
+CNSTI4 1000
+LTI4 $405
+ADDRLP4 4+4+16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+4+21
+CNSTI1 0
+ASGNI1
+ADDRLP4 4+4+22
+CNSTI1 0
+ASGNI1
+ADDRLP4 4+4+23
+CNSTI1 0
+ASGNI1
+ADDRGP4 level+56
+INDIRI4
+ADDRGP4 level+9152
+INDIRI4
+SUBI4
+CNSTI4 2000
+LTI4 $417
+ADDRGP4 level+56
+INDIRI4
+ADDRGP4 level+9152
+INDIRI4
+SUBI4
+CNSTI4 2500
+GTI4 $417
+CNSTI4 2
+ARGI4
+ADDRGP4 $423
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $405
+LABELV $401
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 280
+ADDRLP4 276
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+LTI4 $424
+ADDRLP4 280
+INDIRI4
+CNSTI4 64
+GEI4 $424
+ADDRLP4 276
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 284
+INDIRF4
+CNSTF4 1193033728
+GEF4 $424
+ADDRLP4 288
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 288
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRF4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 296
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+LABELV $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRLP4 240
+INDIRI4
+EQI4 $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+LABELV $426
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $429
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $432
+ADDRLP4 0
+INDIRP4
+CNSTI4 1300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDRLP4 4+176
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRLP4 4+188
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRLP4 4+204
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+ADDRLP4 4+200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRGP4 ClientEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1188
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ARGP4
+ADDRGP4 BotTestAAS
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 ClientImpacts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRLP4 240
+INDIRI4
+EQI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+LABELV $440
+ADDRLP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+ADDRLP4 232
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 0
+INDIRP4
+CNSTI4 1204
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1196
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1200
+ADDP4
+INDIRI4
+BCOMI4
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $443
+ADDRGP4 level+56
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1276
+ADDP4
+INDIRI4
+LEI4 $333
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+CNSTI4 0
+LEI4 $448
+ADDRGP4 level+56
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1276
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+MULI4
+LEI4 $448
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientRespawn
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $448
+ADDRLP4 232
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+EQI4 $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientRespawn
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $443
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRI4
+ARGI4
+ADDRGP4 ClientTimerActions
+CALLV
+pop
+LABELV $333
+endproc ClientThink_Real 308 16
+export ClientThink
+proc ClientThink 12 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 852
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1044
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1192
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $457
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $457
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_Real
+CALLV
+pop
+LABELV $457
+LABELV $455
+endproc ClientThink 12 8
+export G_RunClient
+proc G_RunClient 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $461
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $461
+ADDRGP4 $460
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1044
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_Real
+CALLV
+pop
+LABELV $460
+endproc G_RunClient 4 4
+export SpectatorClientEndFrame
+proc SpectatorClientEndFrame 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $466
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $468
+ADDRLP4 4
+ADDRGP4 level+364
+INDIRI4
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 4
+INDIRI4
+CNSTI4 -2
+NEI4 $471
+ADDRLP4 4
+ADDRGP4 level+368
+INDIRI4
+ASGNI4
+LABELV $471
+LABELV $469
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $474
+ADDRLP4 0
+CNSTI4 1376
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $476
+ADDRLP4 12
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $476
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 116
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 -3073
+BANDI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3072
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRB
+ASGNB 1040
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $476
+LABELV $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1168
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1376
+DIVI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $478
+LABELV $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $482
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+LABELV $483
+LABELV $465
+endproc SpectatorClientEndFrame 32 4
+export ClientEndFrame
+proc ClientEndFrame 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $485
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorClientEndFrame
+CALLV
+pop
+ADDRGP4 $484
+JUMPV
+LABELV $485
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $487
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 364
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GEI4 $491
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 364
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $491
+LABELV $488
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $487
+CNSTI4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 380
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+LABELV $494
+CNSTI4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 384
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+LABELV $498
+CNSTI4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 388
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+LABELV $502
+CNSTI4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 392
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+LABELV $506
+ADDRGP4 level+9156
+INDIRI4
+CNSTI4 0
+EQI4 $510
+ADDRGP4 $484
+JUMPV
+LABELV $510
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_WorldEffects
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_DamageFeedback
+CALLV
+pop
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1192
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $513
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SetClientSound
+CALLV
+pop
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+LABELV $484
+endproc ClientEndFrame 16 16
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $423
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $351
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $323
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $322
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $212
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $208
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $113
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
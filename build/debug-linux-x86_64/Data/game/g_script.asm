@@ -0,0 +1,5733 @@
+data
+export gScriptActions
+align 4
+LABELV gScriptActions
+address $68
+address G_ScriptAction_GotoMarker
+address $69
+address G_ScriptAction_PlaySound
+address $70
+address G_ScriptAction_PlayAnim
+address $71
+address G_ScriptAction_Wait
+address $72
+address G_ScriptAction_Trigger
+address $73
+address G_ScriptAction_AlertEntity
+address $74
+address G_ScriptAction_RemoveEntity
+address $75
+address G_ScriptAction_Accum
+address $76
+address G_ScriptAction_MissionFailed
+address $77
+address G_ScriptAction_MissionSuccess
+address $78
+address G_ScriptAction_Print
+address $79
+address G_ScriptAction_FaceAngles
+address $80
+address G_ScriptAction_ResetScript
+address $81
+address G_ScriptAction_TagConnect
+address $82
+address G_ScriptAction_Halt
+address $83
+address G_ScriptAction_StopSound
+address $84
+address G_ScriptAction_StartCam
+address $85
+address G_ScriptAction_StartCamBlack
+address $86
+address G_ScriptAction_EntityScriptName
+address $87
+address G_ScriptAction_AIScriptName
+address $88
+address G_ScriptAction_ObjectiveMet
+address $89
+address G_ScriptAction_MapDescription
+address $90
+address G_ScriptAction_BlueRespawntime
+address $91
+address G_ScriptAction_RedRespawntime
+address $92
+address G_ScriptAction_NumberofObjectives
+address $93
+address G_ScriptAction_ObjectiveBlueDesc
+address $94
+address G_ScriptAction_ObjectiveShortBlueDesc
+address $95
+address G_ScriptAction_ObjectiveRedDesc
+address $96
+address G_ScriptAction_ObjectiveShortRedDesc
+address $97
+address G_ScriptAction_ObjectiveImage
+address $98
+address G_ScriptAction_SetWinner
+address $99
+address G_ScriptAction_SetObjectiveStatus
+address $100
+address G_ScriptAction_SetDefendingTeam
+address $101
+address G_ScriptAction_Announce
+address $102
+address G_ScriptAction_SetRoundTimelimit
+address $103
+address G_ScriptAction_OverviewImage
+address $104
+address G_ScriptAction_BackupScript
+address $105
+address G_ScriptAction_RestoreScript
+address $106
+address G_ScriptAction_SetHealth
+address $107
+address G_ScriptAction_MusicStart
+address $108
+address G_ScriptAction_MusicPlay
+address $109
+address G_ScriptAction_MusicStop
+address $110
+address G_ScriptAction_MusicFade
+address $111
+address G_ScriptAction_MusicQueue
+address $112
+address G_ScriptAction_ObjectivesNeeded
+address $113
+address G_ScriptAction_NumSecrets
+byte 4 0
+byte 4 0
+export gScriptEvents
+align 4
+LABELV gScriptEvents
+address $114
+byte 4 0
+address $72
+address G_Script_EventMatch_StringEqual
+address $115
+address G_Script_EventMatch_IntInRange
+address $116
+byte 4 0
+address $117
+address G_Script_EventMatch_StringEqual
+address $118
+byte 4 0
+byte 4 0
+byte 4 0
+export G_Script_EventMatch_StringEqual
+code
+proc G_Script_EventMatch_StringEqual 8 8
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 1
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $120
+CNSTI4 0
+RETI4
+LABELV $119
+endproc G_Script_EventMatch_StringEqual 8 8
+export G_Script_EventMatch_IntInRange
+proc G_Script_EventMatch_IntInRange 44 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $123
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $123
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $123
+CNSTI4 1
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $123
+CNSTI4 0
+RETI4
+LABELV $122
+endproc G_Script_EventMatch_IntInRange 44 8
+export G_Script_EventForString
+proc G_Script_EventForString 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptEvents
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $125
+JUMPV
+LABELV $130
+LABELV $127
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptEvents
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $126
+CNSTI4 -1
+RETI4
+LABELV $125
+endproc G_Script_EventForString 8 8
+export G_Script_ActionForString
+proc G_Script_ActionForString 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptActions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptActions
+ADDP4
+RETP4
+ADDRGP4 $132
+JUMPV
+LABELV $137
+LABELV $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptActions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $133
+CNSTP4 0
+RETP4
+LABELV $132
+endproc G_Script_ActionForString 8 8
+export G_Script_ScriptLoad
+proc G_Script_ScriptLoad 356 16
+ADDRGP4 g_scriptDebug
+ARGP4
+ADDRGP4 $140
+ARGP4
+ADDRGP4 $141
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 level+9476
+CNSTP4 0
+ASGNP4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 344
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 344
+INDIRU4
+CNSTU4 0
+EQU4 $144
+ADDRLP4 72
+ARGP4
+ADDRGP4 $143
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 72
+ARGP4
+ADDRGP4 $147
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $145
+ADDRLP4 0
+ARGP4
+ADDRGP4 $148
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $150
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $143
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+GEI4 $151
+ADDRGP4 $139
+JUMPV
+LABELV $151
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 level+9476
+ADDRLP4 352
+INDIRP4
+ASGNP4
+ADDRGP4 level+9476
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $139
+endproc G_Script_ScriptLoad 356 16
+export G_Script_ScriptParse
+proc G_Script_ScriptParse 1140 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $156
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRGP4 level+9476
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $158
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRGP4 level+9476
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $162
+ARGP4
+ADDRGP4 COM_BeginParseSession
+CALLV
+pop
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 g_temp_events
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+CNSTU4 33536
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1076
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $166
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRLP4 1080
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $165
+JUMPV
+LABELV $166
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $171
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRGP4 $165
+JUMPV
+LABELV $173
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $175
+ADDRLP4 1080
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $175
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $178
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $179
+ADDRLP4 1080
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $185
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 G_Script_EventForString
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+GEI4 $189
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $189
+ADDRLP4 1056
+INDIRI4
+CNSTI4 64
+LTI4 $192
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $192
+ADDRLP4 1040
+CNSTI4 524
+ADDRLP4 1056
+INDIRI4
+MULI4
+ADDRGP4 g_temp_events
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $198
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $198
+ADDRLP4 4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1084
+INDIRU4
+CNSTU4 0
+EQU4 $200
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $202
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $200
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $196
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1084
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $203
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $195
+LABELV $203
+ADDRLP4 4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1088
+INDIRU4
+CNSTU4 0
+EQU4 $207
+ADDRLP4 4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1092
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1100
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $209
+ADDRLP4 1092
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $209
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 G_Script_ActionForString
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $211
+ADDRLP4 1096
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $211
+ADDRLP4 1040
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1036
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1100
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $214
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1104
+INDIRU4
+CNSTU4 0
+EQU4 $218
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $202
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $218
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SoundIndex
+CALLI4
+pop
+LABELV $222
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $224
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $224
+LABELV $229
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1132
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1132
+INDIRU4
+CNSTU4 0
+EQU4 $230
+ADDRGP4 $232
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $230
+LABELV $224
+LABELV $220
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1108
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $233
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $233
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1112
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 1112
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $236
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $236
+ADDRLP4 1036
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1116
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+LABELV $215
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $217
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $214
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1104
+INDIRU4
+CNSTU4 0
+EQU4 $238
+ADDRLP4 4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1108
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1120
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $238
+ADDRLP4 1108
+ADDRLP4 1040
+INDIRP4
+CNSTI4 520
+ADDP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $240
+ADDRLP4 1112
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $242
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $240
+LABELV $207
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1092
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $243
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $206
+LABELV $243
+ADDRLP4 1056
+ADDRLP4 1056
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $244
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $247
+ADDRLP4 1080
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $249
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $251
+ADDRLP4 1080
+ADDRLP4 1060
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRGP4 $246
+JUMPV
+LABELV $253
+LABELV $251
+LABELV $250
+LABELV $248
+LABELV $245
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1080
+INDIRP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $244
+LABELV $246
+LABELV $188
+LABELV $184
+LABELV $179
+LABELV $172
+LABELV $164
+ADDRGP4 $163
+JUMPV
+LABELV $165
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+LEI4 $255
+CNSTU4 524
+ADDRLP4 1056
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 g_temp_events
+ARGP4
+CNSTU4 524
+ADDRLP4 1056
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+LABELV $255
+LABELV $155
+endproc G_Script_ScriptParse 1140 12
+export G_Script_ScriptChange
+proc G_Script_ScriptChange 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ADDRLP4 0+12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_Script_ScriptRun
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $260
+LABELV $257
+endproc G_Script_ScriptChange 28 12
+export G_Script_ScriptEvent
+proc G_Script_ScriptEvent 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $263
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptEvents
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $267
+LABELV $264
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptEvents
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $263
+LABELV $265
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $269
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+EQI4 $262
+ADDRGP4 $274
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $269
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $275
+CNSTI4 524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $279
+ADDRLP4 8
+CNSTI4 524
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $286
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 gScriptEvents+4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $286
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 gScriptEvents+4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $281
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_Script_ScriptChange
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $281
+LABELV $279
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $278
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRI4
+LTI4 $275
+LABELV $277
+LABELV $262
+endproc G_Script_ScriptEvent 24 8
+export G_Script_ScriptRun
+proc G_Script_ScriptRun 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_missionStats+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 1
+LEU4 $288
+CNSTI4 0
+RETI4
+ADDRGP4 $287
+JUMPV
+LABELV $288
+ADDRGP4 g_scriptDebug
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $287
+JUMPV
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 G_ScriptAction_GotoMarker
+CALLI4
+pop
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_ScriptAction_PlayAnim
+CALLI4
+pop
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $297
+CNSTI4 1
+RETI4
+ADDRGP4 $287
+JUMPV
+LABELV $297
+ADDRLP4 0
+CNSTI4 524
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $287
+JUMPV
+LABELV $299
+ADDRGP4 g_scriptDebug+12
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+NEI4 $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+GEI4 $313
+ADDRGP4 $307
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $310
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 12
+ADDRGP4 $146
+ASGNP4
+LABELV $311
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $315
+CNSTI4 0
+RETI4
+ADDRGP4 $287
+JUMPV
+LABELV $315
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRGP4 g_scriptDebug+12
+INDIRI4
+CNSTI4 0
+EQI4 $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+GEI4 $321
+ADDRGP4 $307
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $325
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRLP4 32
+ADDRGP4 $146
+ASGNP4
+LABELV $326
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $321
+LABELV $318
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+LTI4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $287
+endproc G_Script_ScriptRun 44 20
+export script_linkentity
+proc script_linkentity 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $327
+endproc script_linkentity 0 4
+export script_mover_die
+proc script_mover_die 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $332
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $332
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $332
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $331
+LABELV $334
+ADDRLP4 8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 15
+EQI4 $332
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $332
+ADDRGP4 $331
+JUMPV
+LABELV $331
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $332
+LABELV $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $116
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 G_Script_ScriptEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $328
+endproc script_mover_die 16 12
+export script_mover_pain
+proc script_mover_pain 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Script_ScriptEvent
+CALLV
+pop
+LABELV $335
+endproc script_mover_pain 8 12
+export script_mover_spawn
+proc script_mover_spawn 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+LABELV $337
+endproc script_mover_spawn 4 4
+export script_mover_use
+proc script_mover_use 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_mover_spawn
+CALLV
+pop
+LABELV $340
+endproc script_mover_use 0 4
+export script_mover_blocked
+proc script_mover_blocked 8 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $342
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 99
+ARGI4
+ADDRGP4 G_TempEntity
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $341
+JUMPV
+LABELV $342
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 9999
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $341
+endproc script_mover_blocked 8 32
+lit
+align 4
+LABELV $345
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export SP_script_mover
+code
+proc SP_script_mover 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $345
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $346
+ADDRGP4 $348
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $349
+ADDRGP4 $351
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRGP4 script_mover_blocked
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRGP4 script_mover_use
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRGP4 $344
+JUMPV
+LABELV $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 G_SetAngle
+CALLV
+pop
+ADDRGP4 $354
+ARGP4
+ADDRGP4 $141
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRGP4 script_mover_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRGP4 script_mover_pain
+ASGNP4
+ADDRGP4 $359
+ARGP4
+ADDRGP4 $360
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_SpawnFloat
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $357
+ADDRLP4 44
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $357
+ADDRGP4 $365
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ADDRGP4 G_SpawnVector
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $363
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $363
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEF4 $372
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEF4 $372
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 48
+INDIRF4
+EQF4 $367
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_mover_spawn
+CALLV
+pop
+LABELV $344
+endproc SP_script_mover 52 12
+export script_model_med_spawn
+proc script_model_med_spawn 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $373
+endproc script_model_med_spawn 12 4
+export script_model_med_use
+proc script_model_med_use 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_model_med_spawn
+CALLV
+pop
+LABELV $376
+endproc script_model_med_use 0 4
+export SP_script_model_med
+proc SP_script_model_med 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $378
+ADDRGP4 $380
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $381
+ADDRGP4 $383
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRGP4 script_model_med_use
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRGP4 $377
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_model_med_spawn
+CALLV
+pop
+LABELV $377
+endproc SP_script_model_med 12 8
+export SP_script_camera
+proc SP_script_camera 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $387
+ADDRGP4 $389
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $386
+endproc SP_script_camera 16 8
+export SP_script_multiplayer
+proc SP_script_multiplayer 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $391
+ADDRGP4 $389
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $393
+ADDRGP4 $396
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $390
+endproc SP_script_multiplayer 8 8
+bss
+export g_temp_events
+align 4
+LABELV g_temp_events
+skip 33536
+import G_ScriptAction_NumSecrets
+import G_ScriptAction_ObjectivesNeeded
+import G_ScriptAction_MusicQueue
+import G_ScriptAction_MusicFade
+import G_ScriptAction_MusicStop
+import G_ScriptAction_MusicPlay
+import G_ScriptAction_MusicStart
+import G_ScriptAction_SetHealth
+import G_ScriptAction_RestoreScript
+import G_ScriptAction_BackupScript
+import G_ScriptAction_OverviewImage
+import G_ScriptAction_SetRoundTimelimit
+import G_ScriptAction_Announce
+import G_ScriptAction_SetDefendingTeam
+import G_ScriptAction_SetObjectiveStatus
+import G_ScriptAction_SetWinner
+import G_ScriptAction_ObjectiveImage
+import G_ScriptAction_ObjectiveShortRedDesc
+import G_ScriptAction_ObjectiveRedDesc
+import G_ScriptAction_ObjectiveShortBlueDesc
+import G_ScriptAction_ObjectiveBlueDesc
+import G_ScriptAction_ObjectiveMet
+import G_ScriptAction_NumberofObjectives
+import G_ScriptAction_RedRespawntime
+import G_ScriptAction_BlueRespawntime
+import G_ScriptAction_MapDescription
+import G_ScriptAction_AIScriptName
+import G_ScriptAction_EntityScriptName
+import G_ScriptAction_StartCamBlack
+import G_ScriptAction_StartCam
+import G_ScriptAction_StopSound
+import G_ScriptAction_Halt
+import G_ScriptAction_TagConnect
+import G_ScriptAction_ResetScript
+import G_ScriptAction_FaceAngles
+import G_ScriptAction_Print
+import G_ScriptAction_MissionSuccess
+import G_ScriptAction_MissionFailed
+import G_ScriptAction_Accum
+import G_ScriptAction_RemoveEntity
+import G_ScriptAction_AlertEntity
+import G_ScriptAction_PlayAnim
+import G_ScriptAction_PlaySound
+import G_ScriptAction_Trigger
+import G_ScriptAction_Wait
+import G_ScriptAction_GotoMarker
+export g_scriptDebug
+align 4
+LABELV g_scriptDebug
+skip 272
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $396
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 39
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 39
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $395
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $389
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $383
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $380
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $366
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $365
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $360
+byte 1 49
+byte 1 0
+align 1
+LABELV $359
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $354
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $351
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $348
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $336
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $307
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 71
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $274
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $242
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 82
+byte 1 73
+byte 1 80
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $235
+byte 1 34
+byte 1 0
+align 1
+LABELV $232
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 84
+byte 1 111
+byte 1 66
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $213
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $202
+byte 1 32
+byte 1 0
+align 1
+LABELV $194
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 82
+byte 1 73
+byte 1 80
+byte 1 84
+byte 1 95
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $191
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $182
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 123
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $177
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 125
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 125
+byte 1 39
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $150
+byte 1 46
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $148
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 0
+align 1
+LABELV $143
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 48
+byte 1 0
+align 1
+LABELV $140
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $118
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $117
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $116
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $115
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $114
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $111
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $110
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $106
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $104
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $103
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $101
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $100
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $99
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $98
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $97
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $96
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $95
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $94
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $93
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $92
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $91
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $90
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $89
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $88
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $87
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $86
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $85
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $84
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $83
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $82
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $81
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $79
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $78
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $76
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $75
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $74
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $73
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $72
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $71
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $70
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $69
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $68
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
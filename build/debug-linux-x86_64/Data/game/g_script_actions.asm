@@ -0,0 +1,13236 @@
+export G_ScriptAction_GotoMarker
+code
+proc G_ScriptAction_GotoMarker 156 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $69
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $69
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $69
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $74
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GEI4 $71
+LABELV $74
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $72
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $71
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $81
+ADDRGP4 $83
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $81
+CNSTP4 0
+ARGP4
+CNSTI4 480
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $84
+ADDRGP4 $86
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $84
+ADDRLP4 88
+CNSTI4 308
+ASGNI4
+ADDRLP4 32
+ADDRLP4 24
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+CNSTI4 312
+ASGNI4
+ADDRLP4 32+4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 316
+ASGNI4
+ADDRLP4 32+8
+ADDRLP4 24
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 104
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $89
+ADDRGP4 $91
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $89
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 3
+ASGNI4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 112
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $95
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $97
+ADDRLP4 28
+CNSTI4 5
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 28
+CNSTI4 6
+ASGNI4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $106
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+LABELV $106
+LABELV $104
+LABELV $101
+LABELV $98
+LABELV $95
+LABELV $93
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $92
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 72
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $110
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 24
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $116
+ADDRLP4 124
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 124
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $121
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+GTF4 $120
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+LTF4 $123
+LABELV $117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 72
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 72
+INDIRF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 24
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $138
+ADDRLP4 120
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+GTF4 $142
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRLP4 128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $146
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+LTF4 $145
+LABELV $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 128
+INDIRF4
+ASGNF4
+LABELV $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $136
+LABELV $110
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 50
+MODI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 116
+CNSTI4 50
+ASGNI4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 116
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 116
+INDIRI4
+DIVI4
+MULI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ADDRLP4 120
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1065353216
+GEF4 $157
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 128
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 152
+CNSTI4 50
+ASGNI4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+DIVI4
+MULI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $157
+LABELV $155
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $153
+LABELV $72
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $68
+endproc G_ScriptAction_GotoMarker 156 12
+export G_ScriptAction_Wait
+proc G_ScriptAction_Wait 24 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $162
+ADDRGP4 $164
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $162
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+56
+INDIRI4
+GEI4 $167
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $168
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $161
+endproc G_ScriptAction_Wait 24 8
+export G_ScriptAction_Trigger
+proc G_ScriptAction_Trigger 168 12
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 136
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $170
+ADDRGP4 $172
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $170
+ADDRLP4 136
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 148
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 72
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $173
+ADDRGP4 $172
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $173
+ADDRGP4 g_entities+54528
+ARGP4
+CNSTI4 700
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $176
+ADDRLP4 140
+ADDRLP4 64
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 G_Script_ScriptEvent
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $182
+ADDRLP4 140
+INDIRI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+NEI4 $180
+LABELV $182
+ADDRLP4 160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRLP4 160
+INDIRI4
+RETI4
+ADDRGP4 $169
+JUMPV
+LABELV $176
+ADDRGP4 $183
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $169
+endproc G_ScriptAction_Trigger 168 12
+export G_ScriptAction_PlaySound
+proc G_ScriptAction_PlaySound 92 12
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $185
+ADDRGP4 $187
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $185
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $191
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $188
+LABELV $191
+ADDRLP4 8
+ARGP4
+ADDRLP4 88
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 15
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 8
+ARGP4
+ADDRLP4 88
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+LABELV $189
+CNSTI4 1
+RETI4
+LABELV $184
+endproc G_ScriptAction_PlaySound 92 12
+export G_ScriptAction_MusicStart
+proc G_ScriptAction_MusicStart 88 12
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $193
+ADDRGP4 $195
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $193
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $196
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 84
+INDIRI4
+ASGNI4
+LABELV $196
+ADDRGP4 $198
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $192
+endproc G_ScriptAction_MusicStart 88 12
+export G_ScriptAction_MusicPlay
+proc G_ScriptAction_MusicPlay 84 12
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $200
+ADDRGP4 $202
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $200
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $203
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $199
+endproc G_ScriptAction_MusicPlay 84 12
+export G_ScriptAction_MusicStop
+proc G_ScriptAction_MusicStop 20 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $205
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $205
+ADDRGP4 $207
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $204
+endproc G_ScriptAction_MusicStop 20 8
+export G_ScriptAction_MusicFade
+proc G_ScriptAction_MusicFade 36 12
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $211
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $209
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $212
+ADDRGP4 $211
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $212
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $208
+endproc G_ScriptAction_MusicFade 36 12
+export G_ScriptAction_MusicQueue
+proc G_ScriptAction_MusicQueue 76 12
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $216
+ADDRGP4 $218
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $216
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 25
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $215
+endproc G_ScriptAction_MusicQueue 76 12
+export G_ScriptAction_PlayAnim
+proc G_ScriptAction_PlayAnim 204 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+CNSTI4 20
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+NEI4 $220
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $220
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $223
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+ADDRGP4 $229
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $227
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRLP4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $223
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 12+64
+ARGP4
+ADDRLP4 176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $231
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $233
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $235
+ADDRGP4 $229
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $235
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+GEI4 $240
+ADDRLP4 148
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $238
+JUMPV
+LABELV $240
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $246
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $245
+LABELV $238
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 200
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 200
+INDIRP4
+ASGNP4
+LABELV $233
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $248
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $251
+ADDRGP4 $253
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $251
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 200
+INDIRI4
+ASGNI4
+LABELV $248
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+CNSTI4 50
+ADDRLP4 152
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $254
+LABELV $231
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 160
+INDIRI4
+CVIF4 4
+DIVF4
+DIVF4
+ARGF4
+ADDRLP4 184
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 140
+INDIRI4
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+MODI4
+ADDI4
+ASGNI4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 536870912
+BORI4
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 156
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LEI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 -536870913
+BANDI4
+ASGNI4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 536870912
+BORI4
+ASGNI4
+LABELV $260
+LABELV $258
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 536870912
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $261
+ADDRLP4 148
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $263
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 -536870913
+BANDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $263
+CNSTI4 0
+RETI4
+LABELV $219
+endproc G_ScriptAction_PlayAnim 204 12
+export G_ScriptAction_RemoveEntity
+proc G_ScriptAction_RemoveEntity 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $269
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $267
+LABELV $269
+ADDRGP4 $270
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $267
+CNSTP4 0
+ARGP4
+CNSTI4 372
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $266
+endproc G_ScriptAction_RemoveEntity 12 12
+export G_ScriptAction_AlertEntity
+proc G_ScriptAction_AlertEntity 24 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $274
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $272
+LABELV $274
+ADDRGP4 $275
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $272
+CNSTP4 0
+ARGP4
+CNSTI4 480
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $276
+CNSTP4 0
+ARGP4
+CNSTI4 672
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $280
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+NEU4 $278
+LABELV $280
+ADDRGP4 $281
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $271
+JUMPV
+LABELV $278
+LABELV $276
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $282
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $284
+ADDRGP4 $286
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $284
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $283
+CNSTI4 1
+RETI4
+LABELV $271
+endproc G_ScriptAction_AlertEntity 24 12
+export G_ScriptAction_Accum
+proc G_ScriptAction_Accum 144 12
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $288
+ADDRGP4 $290
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $288
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 8
+LTI4 $291
+ADDRGP4 $293
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $291
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $294
+ADDRGP4 $296
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $294
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 88
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $300
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $300
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRLP4 4
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 96
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $303
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $306
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $306
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+GEI4 $304
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 524
+ADDRLP4 104
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRLP4 4
+ARGP4
+ADDRGP4 $312
+ARGP4
+ADDRLP4 100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $310
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $313
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $313
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LEI4 $311
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 524
+ADDRLP4 108
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 108
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $320
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $320
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $318
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 524
+ADDRLP4 112
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 112
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 4
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $327
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $325
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 524
+ADDRLP4 116
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 4
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $334
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $334
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 116
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $339
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $339
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 120
+INDIRI4
+LSHI4
+BCOMI4
+BANDI4
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 4
+ARGP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $341
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $344
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $344
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 124
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 524
+ADDRLP4 128
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 4
+ARGP4
+ADDRGP4 $350
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $351
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $351
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 128
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $349
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTI4 524
+ADDRLP4 132
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 4
+ARGP4
+ADDRGP4 $357
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $358
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $358
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 4
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $360
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $363
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $363
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDP4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 140
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRGP4 $365
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $361
+LABELV $356
+LABELV $349
+LABELV $342
+LABELV $337
+LABELV $332
+LABELV $325
+LABELV $318
+LABELV $311
+LABELV $304
+LABELV $298
+CNSTI4 1
+RETI4
+LABELV $287
+endproc G_ScriptAction_Accum 144 12
+export G_ScriptAction_MissionFailed
+proc G_ScriptAction_MissionFailed 44 8
+ADDRLP4 8
+CNSTI4 6
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $367
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $367
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $367
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $369
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $369
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $369
+CNSTI4 -1
+ARGI4
+ADDRGP4 $371
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 25
+ARGI4
+ADDRGP4 $372
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $373
+ARGP4
+CNSTI4 1000
+ADDRLP4 8
+INDIRI4
+MULI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $374
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $374
+ADDRGP4 $376
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $377
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $366
+endproc G_ScriptAction_MissionFailed 44 8
+export G_ScriptAction_ObjectivesNeeded
+proc G_ScriptAction_ObjectivesNeeded 16 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $379
+ADDRGP4 $381
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $379
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 level+9468
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $378
+endproc G_ScriptAction_ObjectivesNeeded 16 8
+export G_ScriptAction_ObjectiveMet
+proc G_ScriptAction_ObjectiveMet 320 16
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 284
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 284
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $384
+ADDRGP4 $386
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $384
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 292
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9472
+INDIRI4
+ADDRLP4 292
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 292
+INDIRI4
+SUBI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $387
+CNSTI4 1
+RETI4
+ADDRGP4 $383
+JUMPV
+LABELV $387
+ADDRLP4 296
+ADDRGP4 level+9472
+ASGNP4
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 300
+INDIRI4
+SUBI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $391
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+CNSTI4 72
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $391
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 312
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 312
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $393
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 316
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRGP4 $398
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+NEI4 $399
+ADDRGP4 $402
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $400
+JUMPV
+LABELV $399
+CNSTI4 -1
+ARGI4
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $400
+LABELV $394
+CNSTI4 1
+RETI4
+LABELV $383
+endproc G_ScriptAction_ObjectiveMet 320 16
+export G_ScriptAction_NumSecrets
+proc G_ScriptAction_NumSecrets 16 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $405
+ADDRGP4 $407
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $405
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 level+9464
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $404
+endproc G_ScriptAction_NumSecrets 16 8
+export G_ScriptAction_MissionSuccess
+proc G_ScriptAction_MissionSuccess 316 16
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 288
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 288
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $410
+ADDRGP4 $412
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $410
+CNSTI4 1
+ARGI4
+ADDRLP4 292
+ADDRGP4 GetFirstValidBluePlayer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $413
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $413
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+NEI4 $415
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 832
+ADDP4
+INDIRI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 300
+INDIRI4
+SUBI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $418
+CNSTI4 1
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $418
+ADDRLP4 304
+ADDRLP4 8
+INDIRP4
+CNSTI4 832
+ADDP4
+ASGNP4
+ADDRLP4 308
+CNSTI4 1
+ASGNI4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+ADDRLP4 308
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 308
+INDIRI4
+SUBI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9472
+INDIRI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 300
+INDIRI4
+SUBI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $420
+CNSTI4 1
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $420
+ADDRLP4 304
+ADDRGP4 level+9472
+ASGNP4
+ADDRLP4 308
+CNSTI4 1
+ASGNI4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+ADDRLP4 308
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 308
+INDIRI4
+SUBI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $416
+ADDRGP4 $391
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $391
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 308
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $424
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 312
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRGP4 $428
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+NEI4 $429
+ADDRGP4 $402
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $430
+JUMPV
+LABELV $429
+CNSTI4 -1
+ARGI4
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $430
+LABELV $425
+CNSTI4 1
+RETI4
+LABELV $409
+endproc G_ScriptAction_MissionSuccess 316 16
+export G_ScriptAction_Print
+proc G_ScriptAction_Print 4 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $435
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $433
+LABELV $435
+ADDRGP4 $436
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $433
+ADDRGP4 $437
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $432
+endproc G_ScriptAction_Print 4 12
+export G_ScriptAction_FaceAngles
+proc G_ScriptAction_FaceAngles 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $441
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $439
+LABELV $441
+ADDRGP4 $442
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $439
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+NEI4 $443
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $446
+ADDRLP4 32
+ARGP4
+ADDRLP4 48
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $450
+ADDRGP4 $442
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $450
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $447
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $446
+ADDRLP4 32
+ARGP4
+ADDRLP4 48
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $454
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $452
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $457
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $456
+ADDRLP4 32
+ARGP4
+ADDRLP4 56
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $458
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $458
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRLP4 40
+CNSTI4 5
+ASGNI4
+LABELV $460
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $462
+ADDRLP4 40
+CNSTI4 6
+ASGNI4
+LABELV $462
+LABELV $458
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $464
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+GTF4 $468
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $472
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+LTF4 $471
+LABELV $465
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+EQI4 $444
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $481
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+CNSTF4 1157234688
+ADDRLP4 68
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $482
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $485
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $438
+JUMPV
+LABELV $485
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $438
+endproc G_ScriptAction_FaceAngles 76 12
+export G_ScriptAction_ResetScript
+proc G_ScriptAction_ResetScript 0 0
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+NEI4 $491
+CNSTI4 0
+RETI4
+ADDRGP4 $490
+JUMPV
+LABELV $491
+CNSTI4 1
+RETI4
+LABELV $490
+endproc G_ScriptAction_ResetScript 0 0
+export G_ScriptAction_TagConnect
+proc G_ScriptAction_TagConnect 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $495
+ADDRGP4 $497
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $495
+CNSTP4 0
+ARGP4
+CNSTI4 480
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $498
+CNSTP4 0
+ARGP4
+CNSTI4 700
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $500
+ADDRGP4 $502
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $500
+LABELV $498
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $503
+ADDRGP4 $497
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 G_ProcessTagConnect
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $494
+endproc G_ScriptAction_TagConnect 36 12
+export G_ScriptAction_Halt
+proc G_ScriptAction_Halt 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 level+56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+NEI4 $506
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $505
+JUMPV
+LABELV $506
+CNSTI4 1
+RETI4
+LABELV $505
+endproc G_ScriptAction_Halt 44 12
+export G_ScriptAction_StopSound
+proc G_ScriptAction_StopSound 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $513
+endproc G_ScriptAction_StopSound 0 0
+export G_ScriptStartCam
+proc G_ScriptStartCam 20 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $515
+ADDRGP4 $517
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $515
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $514
+endproc G_ScriptStartCam 20 8
+export G_ScriptAction_StartCam
+proc G_ScriptAction_StartCam 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ADDRGP4 G_ScriptStartCam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $519
+endproc G_ScriptAction_StartCam 4 12
+export G_ScriptAction_StartCamBlack
+proc G_ScriptAction_StartCamBlack 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 G_ScriptStartCam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $520
+endproc G_ScriptAction_StartCamBlack 4 12
+export G_ScriptAction_EntityScriptName
+proc G_ScriptAction_EntityScriptName 0 8
+ADDRGP4 $522
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $521
+endproc G_ScriptAction_EntityScriptName 0 8
+export G_ScriptAction_AIScriptName
+proc G_ScriptAction_AIScriptName 0 8
+ADDRGP4 $524
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $523
+endproc G_ScriptAction_AIScriptName 0 8
+export G_ScriptAction_MapDescription
+proc G_ScriptAction_MapDescription 1040 12
+ADDRLP4 1028
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1032
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+CNSTI4 18
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $526
+CNSTI4 18
+ARGI4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $526
+CNSTI4 1
+RETI4
+LABELV $525
+endproc G_ScriptAction_MapDescription 1040 12
+export G_ScriptAction_OverviewImage
+proc G_ScriptAction_OverviewImage 1044 12
+ADDRLP4 1028
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1032
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $529
+ADDRGP4 $531
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $529
+CNSTI4 17
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $532
+ADDRLP4 0
+ARGP4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+CNSTI4 17
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $532
+CNSTI4 1
+RETI4
+LABELV $528
+endproc G_ScriptAction_OverviewImage 1044 12
+export G_ScriptAction_BlueRespawntime
+proc G_ScriptAction_BlueRespawntime 16 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $536
+ADDRGP4 $538
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $536
+ADDRGP4 g_userBlueRespawnTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $539
+ADDRGP4 $543
+ARGP4
+CNSTI4 1000
+ADDRGP4 g_userBlueRespawnTime+12
+INDIRI4
+MULI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRGP4 $545
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $540
+CNSTI4 1
+RETI4
+LABELV $535
+endproc G_ScriptAction_BlueRespawntime 16 8
+export G_ScriptAction_RedRespawntime
+proc G_ScriptAction_RedRespawntime 16 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $547
+ADDRGP4 $549
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $547
+ADDRGP4 g_userRedRespawnTime+12
+INDIRI4
+CNSTI4 0
+EQI4 $550
+ADDRGP4 $543
+ARGP4
+CNSTI4 1000
+ADDRGP4 g_userRedRespawnTime+12
+INDIRI4
+MULI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRGP4 $545
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $551
+CNSTI4 1
+RETI4
+LABELV $546
+endproc G_ScriptAction_RedRespawntime 16 8
+export G_ScriptAction_NumberofObjectives
+proc G_ScriptAction_NumberofObjectives 1056 12
+ADDRLP4 1032
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1036
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $556
+ADDRGP4 $558
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $556
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $561
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $559
+LABELV $561
+ADDRGP4 $562
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $559
+CNSTI4 17
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRLP4 4
+ARGP4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+CNSTI4 17
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $563
+CNSTI4 1
+RETI4
+LABELV $555
+endproc G_ScriptAction_NumberofObjectives 1056 12
+export G_ScriptAction_ObjectiveBlueDesc
+proc G_ScriptAction_ObjectiveBlueDesc 1064 12
+ADDRLP4 1032
+CNSTI4 19
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $567
+ADDRGP4 $569
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $567
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $572
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $570
+LABELV $572
+ADDRGP4 $573
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $570
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $574
+ADDRGP4 $576
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $574
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRLP4 4
+ARGP4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $577
+CNSTI4 1
+RETI4
+LABELV $566
+endproc G_ScriptAction_ObjectiveBlueDesc 1064 12
+export G_ScriptAction_ObjectiveShortBlueDesc
+proc G_ScriptAction_ObjectiveShortBlueDesc 1064 12
+ADDRLP4 1032
+CNSTI4 19
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $581
+ADDRGP4 $583
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $581
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $586
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $584
+LABELV $586
+ADDRGP4 $587
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $584
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $588
+ADDRGP4 $590
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $588
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRLP4 4
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $591
+CNSTI4 1
+RETI4
+LABELV $580
+endproc G_ScriptAction_ObjectiveShortBlueDesc 1064 12
+export G_ScriptAction_ObjectiveRedDesc
+proc G_ScriptAction_ObjectiveRedDesc 1064 12
+ADDRLP4 1032
+CNSTI4 19
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $595
+ADDRGP4 $597
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $595
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $600
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $598
+LABELV $600
+ADDRGP4 $601
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $598
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $602
+ADDRGP4 $604
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $602
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 4
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $605
+CNSTI4 1
+RETI4
+LABELV $594
+endproc G_ScriptAction_ObjectiveRedDesc 1064 12
+export G_ScriptAction_ObjectiveShortRedDesc
+proc G_ScriptAction_ObjectiveShortRedDesc 1064 12
+ADDRLP4 1032
+CNSTI4 19
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $609
+ADDRGP4 $611
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $609
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $614
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $612
+LABELV $614
+ADDRGP4 $615
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $612
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $616
+ADDRGP4 $618
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $616
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRLP4 4
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $619
+CNSTI4 1
+RETI4
+LABELV $608
+endproc G_ScriptAction_ObjectiveShortRedDesc 1064 12
+export G_ScriptAction_ObjectiveImage
+proc G_ScriptAction_ObjectiveImage 1064 12
+ADDRLP4 1032
+CNSTI4 19
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $623
+ADDRGP4 $625
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $623
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $628
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $626
+LABELV $628
+ADDRGP4 $629
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $626
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $630
+ADDRGP4 $632
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $630
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $635
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $633
+ADDRLP4 4
+ARGP4
+ADDRGP4 $635
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $633
+CNSTI4 1
+RETI4
+LABELV $622
+endproc G_ScriptAction_ObjectiveImage 1064 12
+export G_ScriptAction_SetWinner
+proc G_ScriptAction_SetWinner 1048 12
+ADDRLP4 1032
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1036
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $637
+ADDRGP4 $639
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $637
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 -1
+LTI4 $642
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LEI4 $640
+LABELV $642
+ADDRGP4 $643
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $640
+CNSTI4 17
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $644
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+CNSTI4 17
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $636
+endproc G_ScriptAction_SetWinner 1048 12
+export G_ScriptAction_SetObjectiveStatus
+proc G_ScriptAction_SetObjectiveStatus 1076 12
+ADDRLP4 1032
+CNSTI4 19
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1044
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $646
+ADDRGP4 $648
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $646
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $651
+ADDRLP4 1028
+INDIRI4
+CNSTI4 6
+LEI4 $649
+LABELV $651
+ADDRGP4 $652
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $649
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $653
+ADDRGP4 $655
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $653
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 -1
+LTI4 $658
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+LEI4 $656
+LABELV $658
+ADDRGP4 $659
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $656
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 4
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $660
+CNSTI4 1
+RETI4
+LABELV $645
+endproc G_ScriptAction_SetObjectiveStatus 1076 12
+export G_ScriptAction_SetDefendingTeam
+proc G_ScriptAction_SetDefendingTeam 1048 12
+ADDRGP4 level+9156
+INDIRI4
+CNSTI4 0
+EQI4 $664
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $664
+ADDRLP4 1032
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1036
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $667
+ADDRGP4 $669
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $667
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+LTI4 $672
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LEI4 $670
+LABELV $672
+ADDRGP4 $673
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $670
+CNSTI4 17
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+CNSTI4 17
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $663
+endproc G_ScriptAction_SetDefendingTeam 1048 12
+export G_ScriptAction_Announce
+proc G_ScriptAction_Announce 16 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $676
+ADDRGP4 $678
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $676
+ADDRGP4 $679
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $675
+endproc G_ScriptAction_Announce 16 8
+export G_ScriptAction_SetRoundTimelimit
+proc G_ScriptAction_SetRoundTimelimit 16 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $681
+ADDRGP4 $683
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $681
+ADDRGP4 g_timelimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $684
+ADDRGP4 $543
+ARGP4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $687
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRGP4 $687
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $685
+CNSTI4 1
+RETI4
+LABELV $680
+endproc G_ScriptAction_SetRoundTimelimit 16 8
+export G_ScriptAction_BackupScript
+proc G_ScriptAction_BackupScript 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $690
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $692
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+LABELV $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $690
+CNSTI4 1
+RETI4
+LABELV $689
+endproc G_ScriptAction_BackupScript 44 12
+export G_ScriptAction_RestoreScript
+proc G_ScriptAction_RestoreScript 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRB
+ASGNB 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $698
+endproc G_ScriptAction_RestoreScript 4 0
+export G_ScriptAction_SetHealth
+proc G_ScriptAction_SetHealth 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $703
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $701
+LABELV $703
+ADDRGP4 $704
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $701
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $700
+endproc G_ScriptAction_SetHealth 8 4
+import script_linkentity
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $704
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $687
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $683
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $679
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $678
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $674
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $673
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $669
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $662
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $659
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $655
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $652
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $648
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $643
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $639
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $635
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $632
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $629
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $625
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $618
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $615
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $611
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $607
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $604
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $601
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $597
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $593
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $590
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $587
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $583
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $579
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $576
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $573
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $569
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $565
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $562
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $558
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $553
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $549
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $545
+byte 1 37
+byte 1 115
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $543
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $542
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $538
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $534
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $531
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 73
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $524
+byte 1 97
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $522
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $518
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $517
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $502
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 84
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $497
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 84
+byte 1 97
+byte 1 103
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $457
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $454
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 70
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 71
+byte 1 79
+byte 1 84
+byte 1 79
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $442
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 70
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 47
+byte 1 71
+byte 1 79
+byte 1 84
+byte 1 79
+byte 1 84
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $437
+byte 1 40
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $436
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $428
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $412
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $407
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $403
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 71
+byte 1 111
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $398
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $397
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $392
+byte 1 49
+byte 1 0
+align 1
+LABELV $391
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $386
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $381
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 78
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $377
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $376
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $373
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $372
+byte 1 0
+align 1
+LABELV $371
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 47
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $365
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $362
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $357
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $350
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $343
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $338
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $333
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $326
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 102
+byte 1 95
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $319
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $312
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 102
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $305
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 102
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $302
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $299
+byte 1 105
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $296
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $293
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 48
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $290
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $286
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 40
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 34
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $281
+byte 1 94
+byte 1 49
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $275
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $270
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $253
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $250
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $246
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $239
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $229
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 10
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 60
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 62
+byte 1 93
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $218
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 81
+byte 1 117
+byte 1 101
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 46
+byte 1 0
+align 1
+LABELV $214
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $211
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 46
+byte 1 0
+align 1
+LABELV $207
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $203
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $202
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 46
+byte 1 0
+align 1
+LABELV $198
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $195
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 46
+byte 1 0
+align 1
+LABELV $190
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $187
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 10
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 82
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $178
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $172
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $105
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $102
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $99
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $91
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 71
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $86
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 71
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 34
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $83
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 71
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
@@ -0,0 +1,9154 @@
+code
+proc UI_PlayerInfo_SetWeapon 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5624
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $87
+ADDRFP4 0
+INDIRP4
+CNSTI4 5688
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5560
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $88
+ADDRGP4 $86
+JUMPV
+LABELV $88
+ADDRLP4 0
+ADDRGP4 bg_itemlist+48
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $90
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $95
+ADDRGP4 $91
+JUMPV
+LABELV $95
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $97
+ADDRGP4 $92
+JUMPV
+LABELV $97
+LABELV $91
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+LABELV $93
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $90
+LABELV $92
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $99
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $101
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $103
+ADDRFP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $103
+ADDRFP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $101
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $105
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5560
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5564
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LTI4 $107
+ADDRLP4 76
+INDIRI4
+CNSTI4 13
+GTI4 $107
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $120-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $120
+address $110
+address $111
+address $112
+address $113
+address $114
+address $107
+address $107
+address $107
+address $115
+address $116
+address $117
+address $118
+address $119
+code
+LABELV $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1062836634
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1045220557
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1062836634
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1062836634
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $119
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $108
+LABELV $86
+endproc UI_PlayerInfo_SetWeapon 84 12
+proc UI_ForceLegsAnim 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5628
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 18
+NEI4 $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+CNSTI4 1000
+ASGNI4
+LABELV $123
+LABELV $122
+endproc UI_ForceLegsAnim 8 0
+proc UI_SetLegsAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $125
+endproc UI_SetLegsAnim 4 8
+proc UI_ForceTorsoAnim 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5632
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+CNSTI4 2294
+ASGNI4
+LABELV $129
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+EQI4 $133
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $131
+LABELV $133
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+CNSTI4 500
+ASGNI4
+LABELV $131
+LABELV $128
+endproc UI_ForceTorsoAnim 12 0
+proc UI_SetTorsoAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $135
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $135
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $134
+endproc UI_SetTorsoAnim 4 8
+proc UI_TorsoSequencing 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5632
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5624
+ADDP4
+INDIRI4
+EQI4 $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $140
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $142
+ADDRGP4 $137
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $144
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $148
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $146
+LABELV $148
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $146
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $151
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+LABELV $151
+LABELV $137
+endproc UI_TorsoSequencing 16 8
+proc UI_LegsSequencing 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5628
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $153
+CNSTF4 1078530011
+CNSTI4 1000
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 jumpHeight
+CNSTF4 1113587712
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 UI_SetLegsAnim
+CALLV
+pop
+LABELV $160
+LABELV $153
+endproc UI_LegsSequencing 12 8
+proc UI_PositionEntityOnTag 92 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_LerpTagFrameModel
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $163
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $164
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $163
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 68
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 72
+CNSTI4 108
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+RETI4
+LABELV $162
+endproc UI_PositionEntityOnTag 92 36
+proc UI_PositionRotatedEntityOnTag 128 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_R_LerpTagFrameModel
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $169
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $170
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRLP4 104
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 88
+INDIRI4
+RETI4
+LABELV $168
+endproc UI_PositionRotatedEntityOnTag 128 36
+proc UI_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $177
+ADDRFP4 8
+INDIRI4
+CNSTI4 31
+LTI4 $175
+LABELV $177
+ADDRGP4 $178
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $175
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4512
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $174
+endproc UI_SetLerpFrameAnimation 12 8
+proc UI_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $182
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $180
+LABELV $182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $180
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $183
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRGP4 $179
+JUMPV
+LABELV $185
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $187
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $188
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $189
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $189
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $191
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $194
+LABELV $191
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $195
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $197
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $198
+LABELV $196
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $199
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $199
+LABELV $183
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $201
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $201
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+LEI4 $203
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $203
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $205
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $206
+LABELV $179
+endproc UI_RunLerpFrame 48 12
+proc UI_PlayerAnimation 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 uiInfo+224
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 5664
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $209
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_LegsSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRFP4 0
+INDIRP4
+CNSTI4 5628
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5628
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+LABELV $212
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 uiInfo+224
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 5656
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_TorsoSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5632
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $207
+endproc UI_PlayerAnimation 16 12
+proc UI_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $221
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $219
+LABELV $221
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $219
+LABELV $217
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRGP4 $216
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $224
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $226
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $227
+LABELV $225
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $228
+ADDRLP4 8
+ADDRGP4 uiInfo+224
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $231
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 8
+ADDRGP4 uiInfo+224
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $234
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $234
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $229
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $236
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $238
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $238
+LABELV $237
+LABELV $216
+endproc UI_SwingAngles 28 8
+proc UI_MovedirAdjustment 68 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5600
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5612
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5604
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5616
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5608
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5620
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1008981770
+GEF4 $243
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $243
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1008981770
+GEF4 $245
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+LABELV $245
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+NEF4 $249
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LEF4 $249
+CNSTF4 0
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $249
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+GEF4 $252
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LEF4 $252
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $252
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+GEF4 $255
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEF4 $255
+CNSTF4 1110704128
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $255
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+GEF4 $258
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+GEF4 $258
+CNSTF4 3249537024
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $258
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+NEF4 $261
+ADDRLP4 0
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $261
+CNSTF4 0
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $261
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LEF4 $264
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+GEF4 $264
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $264
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LEF4 $267
+ADDRLP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+NEF4 $267
+CNSTF4 3258187776
+RETF4
+ADDRGP4 $240
+JUMPV
+LABELV $267
+CNSTF4 3249537024
+RETF4
+LABELV $240
+endproc UI_MovedirAdjustment 68 8
+proc UI_PlayerAngles 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5600
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5628
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $279
+ADDRFP4 0
+INDIRP4
+CNSTI4 5632
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $277
+LABELV $279
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 UI_MovedirAdjustment
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $288
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $289
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $290
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 84
+INDIRF4
+ASGNF4
+LABELV $292
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $270
+endproc UI_PlayerAngles 88 24
+proc UI_PlayerFloatSprite 172 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1109917696
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+120
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0+152
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $297
+endproc UI_PlayerFloatSprite 172 12
+export UI_MachinegunSpinAngle
+proc UI_MachinegunSpinAngle 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5684
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5676
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5680
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+LEI4 $307
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+LABELV $307
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5680
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $306
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5632
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $309
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $309
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $314
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 5676
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 5684
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5680
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $317
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 5676
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $311
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $304
+endproc UI_MachinegunSpinAngle 32 4
+lit
+align 4
+LABELV $320
+byte 4 0
+skip 168
+align 4
+LABELV $321
+byte 4 0
+skip 168
+align 4
+LABELV $322
+byte 4 0
+skip 168
+align 4
+LABELV $323
+byte 4 0
+skip 168
+align 4
+LABELV $324
+byte 4 0
+skip 168
+align 4
+LABELV $325
+byte 4 0
+skip 168
+align 4
+LABELV $326
+byte 4 3246391296
+byte 4 3246391296
+byte 4 3250585600
+align 4
+LABELV $327
+byte 4 1098907648
+byte 4 1098907648
+byte 4 1113587712
+export UI_DrawPlayer
+code
+proc UI_DrawPlayer 1572 28
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $320
+INDIRB
+ASGNB 172
+ADDRLP4 172
+ADDRGP4 $321
+INDIRB
+ASGNB 172
+ADDRLP4 796
+ADDRGP4 $322
+INDIRB
+ASGNB 172
+ADDRLP4 968
+ADDRGP4 $323
+INDIRB
+ASGNB 172
+ADDRLP4 1140
+ADDRGP4 $324
+INDIRB
+ASGNB 172
+ADDRLP4 1316
+ADDRGP4 $325
+INDIRB
+ASGNB 172
+ADDRLP4 1488
+ADDRGP4 $326
+INDIRB
+ASGNB 12
+ADDRLP4 1500
+ADDRGP4 $327
+INDIRB
+ASGNB 12
+ADDRLP4 1524
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 1524
+INDIRI4
+EQI4 $332
+ADDRFP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 1524
+INDIRI4
+EQI4 $332
+ADDRFP4 16
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 1524
+INDIRI4
+EQI4 $332
+ADDRFP4 16
+INDIRP4
+CNSTI4 4516
+ADDP4
+INDIRI4
+ADDRLP4 1524
+INDIRI4
+NEI4 $328
+LABELV $332
+ADDRGP4 $319
+JUMPV
+LABELV $328
+ADDRLP4 1528
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 1528
+INDIRF4
+EQF4 $335
+ADDRFP4 12
+INDIRF4
+ADDRLP4 1528
+INDIRF4
+NEF4 $333
+LABELV $335
+ADDRGP4 $319
+JUMPV
+LABELV $333
+ADDRGP4 dp_realtime
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5644
+ADDP4
+INDIRI4
+CNSTI4 14
+EQI4 $336
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5648
+ADDP4
+INDIRI4
+LEI4 $336
+ADDRFP4 16
+INDIRP4
+CNSTI4 5636
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5644
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5640
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5644
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5644
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5648
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5624
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+EQI4 $338
+ADDRGP4 weaponChangeSound
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $338
+LABELV $336
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 jumpHeight
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 440
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 796
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 344+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 344+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 344
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 344+16
+CNSTF4 1119092736
+ADDRLP4 344+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uiInfo+212
+INDIRF4
+DIVF4
+CNSTF4 1142947840
+DIVF4
+MULF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 344+16
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1536
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 1516
+ADDRLP4 344+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uiInfo+212
+INDIRF4
+DIVF4
+ADDRLP4 1536
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 344+12
+INDIRI4
+CVIF4 4
+ADDRGP4 uiInfo+208
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 1516
+INDIRF4
+ARGF4
+ADDRLP4 1540
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 344+20
+ADDRLP4 1540
+INDIRF4
+ASGNF4
+ADDRLP4 344+20
+CNSTF4 1122316001
+ADDRLP4 344+20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1512
+CNSTF4 1060320051
+ADDRLP4 1500+8
+INDIRF4
+ADDRLP4 1488+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRLP4 344+16
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1544
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 784
+ADDRLP4 1512
+INDIRF4
+ADDRLP4 1544
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 784+4
+CNSTF4 1056964608
+ADDRLP4 1488+4
+INDIRF4
+ADDRLP4 1500+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 784+8
+CNSTF4 3204448256
+ADDRLP4 1488+8
+INDIRF4
+ADDRLP4 1500+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 344+72
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 172+28
+ARGP4
+ADDRLP4 796+28
+ARGP4
+ADDRGP4 UI_PlayerAngles
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+108
+ARGP4
+ADDRLP4 172+100
+ARGP4
+ADDRLP4 172+80
+ARGP4
+ADDRLP4 172+108
+ARGP4
+ADDRGP4 UI_PlayerAnimation
+CALLV
+pop
+ADDRLP4 1312
+CNSTI4 192
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1548
+ADDRGP4 UI_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+116
+ADDRLP4 1548
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 0+4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 0+88
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 0+124
+ADDRFP4 16
+INDIRP4
+CNSTI4 5596
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+124+1
+ADDRFP4 16
+INDIRP4
+CNSTI4 5597
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+124+2
+ADDRFP4 16
+INDIRP4
+CNSTI4 5598
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+124+3
+ADDRFP4 16
+INDIRP4
+CNSTI4 5599
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRGP4 $319
+JUMPV
+LABELV $388
+ADDRLP4 172+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+8
+INDIRI4
+CNSTI4 0
+NEI4 $392
+ADDRGP4 $319
+JUMPV
+LABELV $392
+ADDRLP4 172+116
+ADDRLP4 0+116
+INDIRI4
+ASGNI4
+ADDRLP4 172+12
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $398
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLI4
+pop
+ADDRLP4 172+4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 172+124
+ADDRFP4 16
+INDIRP4
+CNSTI4 5596
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172+124+1
+ADDRFP4 16
+INDIRP4
+CNSTI4 5597
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172+124+2
+ADDRFP4 16
+INDIRP4
+CNSTI4 5598
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172+124+3
+ADDRFP4 16
+INDIRP4
+CNSTI4 5599
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 796+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 796+8
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRGP4 $319
+JUMPV
+LABELV $408
+ADDRLP4 796+116
+ADDRLP4 0+116
+INDIRI4
+ASGNI4
+ADDRLP4 796+12
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 796
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLI4
+pop
+ADDRLP4 796+4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 796+124
+ADDRFP4 16
+INDIRP4
+CNSTI4 5596
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 796+124+1
+ADDRFP4 16
+INDIRP4
+CNSTI4 5597
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 796+124+2
+ADDRFP4 16
+INDIRP4
+CNSTI4 5598
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 796+124+3
+ADDRFP4 16
+INDIRP4
+CNSTI4 5599
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 796
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 5624
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 968
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 968+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 5556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 968+12
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 968
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $427
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLI4
+pop
+ADDRLP4 968+4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 968+124
+ADDRFP4 16
+INDIRP4
+CNSTI4 5596
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 968+124+1
+ADDRFP4 16
+INDIRP4
+CNSTI4 5597
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 968+124+2
+ADDRFP4 16
+INDIRP4
+CNSTI4 5598
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 968+124+3
+ADDRFP4 16
+INDIRP4
+CNSTI4 5599
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 968
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $423
+ADDRFP4 16
+INDIRP4
+CNSTI4 5560
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRLP4 1140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1140+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 5560
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1552+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1552
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 1564
+ADDRGP4 UI_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 1552+8
+ADDRLP4 1564
+INDIRF4
+ASGNF4
+ADDRLP4 1552
+ARGP4
+ADDRLP4 1140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 1140+12
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 1140
+ARGP4
+ADDRLP4 968
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5556
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $443
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLI4
+pop
+ADDRLP4 1140+4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 1140+124
+ADDRFP4 16
+INDIRP4
+CNSTI4 5596
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1140+124+1
+ADDRFP4 16
+INDIRP4
+CNSTI4 5597
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1140+124+2
+ADDRFP4 16
+INDIRP4
+CNSTI4 5598
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1140+124+3
+ADDRFP4 16
+INDIRP4
+CNSTI4 5599
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $436
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5580
+ADDP4
+INDIRI4
+GTI4 $452
+ADDRFP4 16
+INDIRP4
+CNSTI4 5564
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRLP4 1316
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1316+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 5564
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1316+12
+ADDRLP4 784
+INDIRB
+ASGNB 12
+ADDRLP4 1316
+ARGP4
+ADDRLP4 968
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5556
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLI4
+pop
+ADDRLP4 1316+4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 1316+124
+ADDRFP4 16
+INDIRP4
+CNSTI4 5596
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1316+124+1
+ADDRFP4 16
+INDIRP4
+CNSTI4 5597
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1316+124+2
+ADDRFP4 16
+INDIRP4
+CNSTI4 5598
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1316+124+3
+ADDRFP4 16
+INDIRP4
+CNSTI4 5599
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1316
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $454
+ADDRLP4 1556
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5568
+ADDP4
+INDIRF4
+ADDRLP4 1556
+INDIRF4
+NEF4 $470
+ADDRFP4 16
+INDIRP4
+CNSTI4 5572
+ADDP4
+INDIRF4
+ADDRLP4 1556
+INDIRF4
+NEF4 $470
+ADDRFP4 16
+INDIRP4
+CNSTI4 5576
+ADDP4
+INDIRF4
+ADDRLP4 1556
+INDIRF4
+EQF4 $467
+LABELV $470
+ADDRLP4 1560
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1316+68
+ARGP4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5568
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5572
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 5576
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddJuniorLightToScene
+CALLV
+pop
+LABELV $467
+LABELV $452
+ADDRFP4 16
+INDIRP4
+CNSTI4 5668
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $472
+ADDRGP4 $475
+ARGP4
+ADDRLP4 1552
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 172+68
+ARGP4
+ADDRLP4 1552
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerFloatSprite
+CALLV
+pop
+LABELV $472
+ADDRLP4 1552
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 784
+ADDRLP4 784
+INDIRF4
+ADDRLP4 1552
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 784+4
+ADDRLP4 784+4
+INDIRF4
+ADDRLP4 1552
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 784+8
+ADDRLP4 784+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 784
+ARGP4
+CNSTF4 1140457472
+ARGF4
+ADDRLP4 1556
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1556
+INDIRF4
+ARGF4
+ADDRLP4 1556
+INDIRF4
+ARGF4
+ADDRLP4 1556
+INDIRF4
+ARGF4
+ADDRLP4 1556
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddJuniorLightToScene
+CALLV
+pop
+ADDRLP4 1560
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 784
+ADDRLP4 784
+INDIRF4
+ADDRLP4 1560
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 784+4
+ADDRLP4 784+4
+INDIRF4
+ADDRLP4 1560
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 784+8
+ADDRLP4 784+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 784
+ARGP4
+CNSTF4 1140457472
+ARGF4
+ADDRLP4 1564
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1564
+INDIRF4
+ARGF4
+ADDRLP4 1564
+INDIRF4
+ARGF4
+ADDRLP4 1568
+CNSTF4 0
+ASGNF4
+ADDRLP4 1568
+INDIRF4
+ARGF4
+ADDRLP4 1568
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddJuniorLightToScene
+CALLV
+pop
+ADDRLP4 344
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $319
+endproc UI_DrawPlayer 1572 28
+proc UI_FileExists 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $481
+CNSTI4 1
+RETI4
+ADDRGP4 $480
+JUMPV
+LABELV $481
+CNSTI4 0
+RETI4
+LABELV $480
+endproc UI_FileExists 8 12
+proc UI_FindClientHeadFile 40 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 $484
+ASGNP4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $485
+ADDRLP4 4
+ADDRGP4 $487
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $490
+JUMPV
+LABELV $485
+ADDRLP4 4
+ADDRGP4 $488
+ASGNP4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $492
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $496
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $496
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $496
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $498
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $500
+CNSTI4 1
+RETI4
+ADDRGP4 $483
+JUMPV
+LABELV $500
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $502
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $502
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $502
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $503
+JUMPV
+LABELV $502
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $505
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $506
+CNSTI4 1
+RETI4
+ADDRGP4 $483
+JUMPV
+LABELV $506
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $510
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $508
+LABELV $510
+ADDRGP4 $494
+JUMPV
+LABELV $508
+LABELV $493
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $492
+LABELV $494
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $511
+ADDRGP4 $491
+JUMPV
+LABELV $511
+ADDRLP4 4
+ADDRGP4 $487
+ASGNP4
+LABELV $490
+ADDRGP4 $489
+JUMPV
+LABELV $491
+CNSTI4 0
+RETI4
+LABELV $483
+endproc UI_FindClientHeadFile 40 40
+export UI_AddSkinToFrame
+proc UI_AddSkinToFrame 428 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $516
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $514
+LABELV $516
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $514
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $518
+ADDRLP4 416
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 416
+CNSTF4 0
+ASGNF4
+LABELV $519
+ADDRLP4 8
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $523
+JUMPV
+LABELV $520
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $524
+ADDRLP4 4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $526
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $527
+LABELV $525
+ADDRLP4 424
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 424
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 424
+INDIRI4
+LSHI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $521
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $523
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $520
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+RETI4
+LABELV $513
+endproc UI_AddSkinToFrame 428 8
+proc UI_RegisterSkin 20212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $531
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $529
+LABELV $531
+ADDRGP4 $532
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20160
+INDIRU4
+CNSTU4 64
+LTU4 $533
+ADDRGP4 $535
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $538
+ARGP4
+ADDRLP4 20164
+ADDRGP4 COM_CompareExtension
+CALLI4
+ASGNI4
+ADDRLP4 20164
+INDIRI4
+CNSTI4 0
+NEI4 $536
+ADDRGP4 $539
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $536
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $540
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $540
+ADDRLP4 20152
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20148
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20172
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 20172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GTI4 $542
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $542
+ADDRLP4 144
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $544
+ADDRGP4 $546
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20148
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $544
+ADDRLP4 148
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 20148
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20148
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 148
+ASGNP4
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 44
+ARGI4
+ADDRLP4 20176
+ADDRGP4 COM_ParseExt2
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20176
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $550
+ADDRGP4 $549
+JUMPV
+LABELV $550
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $552
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $552
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $556
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 20180
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20180
+INDIRI4
+CNSTI4 0
+NEI4 $554
+ADDRLP4 4
+ARGP4
+ADDRGP4 SkipRestOfLine
+CALLV
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $554
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $559
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 20184
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20184
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $560
+ARGP4
+ADDRLP4 20188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20188
+INDIRI4
+CNSTI4 0
+NEI4 $557
+LABELV $561
+ADDRLP4 4
+ARGP4
+ADDRGP4 SkipRestOfLine
+CALLV
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $557
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 100
+GEI4 $562
+ADDRLP4 20192
+CNSTI4 0
+ASGNI4
+LABELV $564
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $568
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $568
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 44
+ARGI4
+ADDRLP4 20196
+ADDRGP4 COM_ParseExt2
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20196
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $570
+ADDRGP4 $566
+JUMPV
+LABELV $570
+ADDRLP4 8
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20200
+ADDRGP4 trap_R_RegisterShaderEx
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 20200
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 20204
+ADDRGP4 trap_R_AllocSkinSurface
+CALLI4
+ASGNI4
+ADDRLP4 20192
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDP4
+ADDRLP4 20204
+INDIRI4
+ASGNI4
+LABELV $565
+ADDRLP4 20192
+ADDRLP4 20192
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20192
+INDIRI4
+CNSTI4 10
+LTI4 $564
+LABELV $566
+CNSTI4 44
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 40
+ADDP4
+ADDRLP4 20192
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $562
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $548
+ADDRLP4 20176
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20176
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $572
+ADDRLP4 20176
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $547
+LABELV $572
+LABELV $549
+ADDRLP4 140
+INDIRI4
+CNSTI4 100
+LEI4 $573
+ADDRGP4 $575
+ARGP4
+ADDRLP4 20180
+ADDRLP4 20152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 20180
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 100
+ADDRLP4 20180
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $573
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $576
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $576
+CNSTI4 1
+RETI4
+LABELV $528
+endproc UI_RegisterSkin 20212 16
+proc UI_RegisterClientSkin 100 28
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $579
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $579
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $582
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $580
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 UI_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $583
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $583
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $585
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $586
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $584
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ADDRGP4 UI_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRGP4 $590
+ARGP4
+ADDRLP4 92
+ADDRGP4 UI_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $588
+JUMPV
+LABELV $587
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $588
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $594
+ADDRLP4 68
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $594
+ADDRLP4 72
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $591
+LABELV $594
+CNSTI4 0
+RETI4
+ADDRGP4 $578
+JUMPV
+LABELV $591
+CNSTI4 1
+RETI4
+LABELV $578
+endproc UI_RegisterClientSkin 100 28
+proc UI_ParseAnimationFile 20076 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 4512
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 868
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 5548
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5552
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 20028
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 20028
+INDIRI4
+CNSTI4 0
+GTI4 $596
+CNSTI4 0
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $596
+ADDRLP4 20028
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $598
+ADDRGP4 $546
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $598
+ADDRLP4 28
+ARGP4
+ADDRLP4 20028
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 20028
+INDIRI4
+ADDRLP4 28
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 COM_Compress
+CALLI4
+pop
+ADDRLP4 12
+ADDRLP4 28
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $600
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $603
+ADDRGP4 $602
+JUMPV
+LABELV $603
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 20044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20044
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRLP4 12
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $601
+ADDRGP4 $602
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $612
+ARGP4
+ADDRLP4 20048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20048
+INDIRI4
+CNSTI4 0
+NEI4 $610
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $613
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $617
+ADDRGP4 $601
+JUMPV
+LABELV $617
+LABELV $614
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $613
+ADDRGP4 $601
+JUMPV
+LABELV $610
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 20052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20052
+INDIRI4
+CNSTI4 0
+NEI4 $619
+ADDRLP4 12
+ARGP4
+ADDRLP4 20056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $601
+ADDRGP4 $602
+JUMPV
+LABELV $619
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $626
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $624
+ADDRFP4 4
+INDIRP4
+CNSTI4 5548
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $624
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $629
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $627
+ADDRFP4 4
+INDIRP4
+CNSTI4 5552
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $627
+ADDRLP4 20064
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 48
+LTI4 $630
+ADDRLP4 20064
+INDIRI4
+CNSTI4 57
+GTI4 $630
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $602
+JUMPV
+LABELV $630
+ADDRGP4 $632
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $601
+ADDRGP4 $600
+JUMPV
+LABELV $602
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $633
+ADDRLP4 12
+ARGP4
+ADDRLP4 20040
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20040
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $637
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $635
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+GTI4 $635
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $634
+JUMPV
+LABELV $637
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20044
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $641
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $641
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $643
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $643
+ADDRLP4 20052
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20052
+INDIRP4
+ADDRLP4 20052
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $643
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $645
+ADDRGP4 $635
+JUMPV
+LABELV $645
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $647
+ADDRLP4 20060
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20060
+INDIRP4
+ADDRLP4 20060
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $647
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $649
+ADDRGP4 $635
+JUMPV
+LABELV $649
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20064
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $651
+ADDRGP4 $635
+JUMPV
+LABELV $651
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20072
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20072
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $653
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $653
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $634
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+LTI4 $633
+LABELV $635
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+EQI4 $655
+ADDRGP4 $657
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $655
+CNSTI4 1
+RETI4
+LABELV $595
+endproc UI_ParseAnimationFile 20076 12
+export UI_RegisterClientModelname
+proc UI_RegisterClientModelname 356 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $659
+CNSTI4 0
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $659
+ADDRLP4 128
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 324
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 192
+ADDRLP4 324
+INDIRP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $661
+ADDRLP4 196
+ARGP4
+ADDRGP4 $484
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $661
+ADDRLP4 196
+ARGP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $662
+ADDRLP4 64
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 328
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 192
+ADDRLP4 328
+INDIRP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $663
+ADDRLP4 260
+ARGP4
+ADDRGP4 $484
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 260
+ARGP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $664
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $665
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $666
+ADDRGP4 $668
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $666
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $669
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $670
+ADDRGP4 $668
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $670
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $672
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 64+1
+ARGP4
+ADDRLP4 64+1
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $677
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $673
+ADDRLP4 0
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $678
+ADDRLP4 64
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $678
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $680
+ADDRGP4 $668
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $680
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+NEI4 $682
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 348
+ADDRGP4 $484
+ASGNP4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $684
+ADDRGP4 $686
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $684
+LABELV $682
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $687
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 UI_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+NEI4 $688
+ADDRGP4 $690
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $688
+CNSTI4 1
+RETI4
+LABELV $658
+endproc UI_RegisterClientModelname 356 24
+export UI_PlayerInfo_SetModel
+proc UI_PlayerInfo_SetModel 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5692
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5624
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5640
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5644
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5648
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5668
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5672
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+LABELV $691
+endproc UI_PlayerInfo_SetModel 12 16
+export UI_ColorFromIndex
+proc UI_ColorFromIndex 12 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $693
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $693
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $708-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $708
+address $695
+address $695
+address $695
+address $695
+address $695
+address $695
+address $695
+address $702
+address $703
+address $704
+address $705
+address $706
+address $707
+code
+LABELV $695
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $696
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $696
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $698
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $698
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $694
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $702
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $703
+ADDRFP4 4
+INDIRP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $704
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $705
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $706
+ADDRFP4 4
+INDIRP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $707
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $694
+LABELV $692
+endproc UI_ColorFromIndex 12 0
+export UI_PlayerInfo_UpdateColor
+proc UI_PlayerInfo_UpdateColor 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $711
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5584
+ADDP4
+ARGP4
+ADDRGP4 UI_ColorFromIndex
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 5584
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $713
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $714
+ADDRFP4 0
+INDIRP4
+CNSTI4 5596
+ADDP4
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 5588
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $716
+ADDRLP4 20
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 20
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $717
+ADDRFP4 0
+INDIRP4
+CNSTI4 5597
+ADDP4
+ADDRLP4 20
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 5592
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $719
+ADDRLP4 36
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRLP4 36
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $720
+ADDRFP4 0
+INDIRP4
+CNSTI4 5598
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 5599
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $710
+endproc UI_PlayerInfo_UpdateColor 52 8
+export UI_PlayerInfo_SetInfo
+proc UI_PlayerInfo_SetInfo 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5668
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_PlayerInfo_UpdateColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5600
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5612
+ADDP4
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5672
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 5672
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 14
+EQI4 $721
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5624
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5640
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5644
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5648
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 $721
+JUMPV
+LABELV $722
+ADDRFP4 20
+INDIRI4
+CNSTI4 14
+NEI4 $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 5644
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5648
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $727
+JUMPV
+LABELV $726
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRFP4 0
+INDIRP4
+CNSTI4 5644
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5648
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+LABELV $728
+LABELV $727
+ADDRFP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 5640
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $732
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $730
+LABELV $732
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5624
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5636
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $721
+JUMPV
+LABELV $730
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5628
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 18
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $733
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $735
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $733
+LABELV $735
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $736
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $736
+LABELV $734
+ADDRFP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $740
+ADDRFP4 8
+INDIRI4
+CNSTI4 12
+NEI4 $738
+LABELV $740
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $743
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $741
+LABELV $743
+ADDRFP4 8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRFP4 8
+CNSTI4 11
+ASGNI4
+LABELV $742
+LABELV $738
+ADDRFP4 8
+INDIRI4
+CNSTI4 7
+EQI4 $746
+ADDRFP4 8
+INDIRI4
+CNSTI4 8
+NEI4 $744
+LABELV $746
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $749
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $747
+LABELV $749
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $748
+JUMPV
+LABELV $747
+ADDRFP4 8
+CNSTI4 7
+ASGNI4
+LABELV $748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5580
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $744
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5632
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5624
+ADDP4
+INDIRI4
+NEI4 $753
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $753
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $750
+LABELV $753
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $751
+JUMPV
+LABELV $750
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $756
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $754
+LABELV $756
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $754
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 5660
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $757
+LABELV $755
+LABELV $751
+LABELV $721
+endproc UI_PlayerInfo_SetInfo 36 8
+bss
+align 4
+LABELV jumpHeight
+skip 4
+align 4
+LABELV dp_realtime
+skip 4
+import trap_R_RemapShader
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_MemoryRemaining
+import trap_LAN_CompareServers
+import trap_LAN_ServerStatus
+import trap_LAN_ResetPings
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_SetClipRegion
+import trap_UpdateScreen
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_Cvar_Reset
+import UI_GetBotNameByNumber
+import UI_LoadBots
+import UI_GetNumBots
+import UI_LoadBestScores
+import UI_ClearClipRegion
+import UI_SetClipRegion
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_SetActiveMenu
+import UI_AdjustFrom640
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_DrawSides
+import UI_DrawTopBottom
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawPic
+import UI_ConsoleCommand
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import uiInfo
+import UI_DrawConnectScreen
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_LoadArenasIntoMapList
+import UI_LoadArenas
+import UI_ClearScores
+import UI_ShowPostGame
+import UI_AdjustTimeByGame
+import _UI_SetActiveMenu
+import UI_Load
+import UI_Report
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+export weaponChangeSound
+align 4
+LABELV weaponChangeSound
+skip 4
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ui_serverStatusTimeOut
+import ui_bigFont
+import ui_smallFont
+import ui_scoreTime
+import ui_scoreShutoutBonus
+import ui_scoreSkillBonus
+import ui_scoreTimeBonus
+import ui_scoreBase
+import ui_scoreTeam
+import ui_scorePerfect
+import ui_scoreScore
+import ui_scoreGauntlets
+import ui_scoreAssists
+import ui_scoreDefends
+import ui_scoreExcellents
+import ui_scoreImpressives
+import ui_scoreAccuracy
+import ui_singlePlayerActive
+import ui_lastServerRefresh_3
+import ui_lastServerRefresh_2
+import ui_lastServerRefresh_1
+import ui_lastServerRefresh_0
+import ui_selectedPlayerName
+import ui_selectedPlayer
+import ui_currentOpponent
+import ui_mapIndex
+import ui_currentNetMap
+import ui_currentMap
+import ui_currentTier
+import ui_menuFiles
+import ui_opponentName
+import ui_dedicated
+import ui_serverFilterType
+import ui_netSource
+import ui_joinGameType
+import ui_actualNetGameType
+import ui_netGameType
+import ui_gameType
+import ui_fragLimit
+import ui_captureLimit
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_spSkill
+import ui_botsFile
+import ui_arenasFile
+import trap_PC_FreeSource
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Menu_FindItemByName
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $711
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $690
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $687
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $686
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $677
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $674
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $669
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $668
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $665
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $657
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $632
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $629
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $626
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $612
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $607
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $590
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $589
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $586
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $585
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $582
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $581
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $575
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $560
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $559
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 95
+byte 1 0
+align 1
+LABELV $556
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 0
+align 1
+LABELV $546
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $539
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 34
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $538
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $535
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 81
+byte 1 80
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $532
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $505
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $504
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $499
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $498
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $488
+byte 1 0
+align 1
+LABELV $487
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $484
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $475
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $458
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $443
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $427
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $414
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $398
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $178
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $106
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $105
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
@@ -0,0 +1,36149 @@
+data
+align 4
+LABELV captureFunc
+byte 4 0
+align 4
+LABELV captureData
+byte 4 0
+align 4
+LABELV itemCapture
+byte 4 0
+export DC
+align 4
+LABELV DC
+byte 4 0
+align 4
+LABELV g_waitingForKey
+byte 4 0
+align 4
+LABELV g_editingField
+byte 4 0
+align 4
+LABELV g_bindItem
+byte 4 0
+align 4
+LABELV g_editItem
+byte 4 0
+export menuCount
+align 4
+LABELV menuCount
+byte 4 0
+export openMenuCount
+align 4
+LABELV openMenuCount
+byte 4 0
+align 4
+LABELV debugMode
+byte 4 0
+align 4
+LABELV lastListBoxClickTime
+byte 4 0
+export UI_Alloc
+code
+proc UI_Alloc 12 4
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 1048576
+LEI4 $46
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $48
+ADDRGP4 $50
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $48
+CNSTP4 0
+RETP4
+ADDRGP4 $45
+JUMPV
+LABELV $46
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 UI_memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 15
+ADDI4
+CNSTI4 -16
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $45
+endproc UI_Alloc 12 4
+export UI_InitMemory
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $51
+endproc UI_InitMemory 4 0
+export UI_OutOfMemory
+proc UI_OutOfMemory 0 0
+ADDRGP4 outOfMemory
+INDIRI4
+RETI4
+LABELV $52
+endproc UI_OutOfMemory 0 0
+proc hashForString 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $55
+JUMPV
+LABELV $54
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CVIU4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+CVIU4 4
+MULU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $55
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $54
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 2047
+BANDU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+RETU4
+LABELV $53
+endproc hashForString 20 4
+data
+align 4
+LABELV strPoolIndex
+byte 4 0
+align 4
+LABELV strHandleCount
+byte 4 0
+align 4
+LABELV $58
+address $59
+export String_Alloc
+code
+proc String_Alloc 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $60
+CNSTP4 0
+RETP4
+ADDRGP4 $57
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $62
+ADDRGP4 $58
+INDIRP4
+RETP4
+ADDRGP4 $57
+JUMPV
+LABELV $62
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 hashForString
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 20
+INDIRU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $65
+JUMPV
+LABELV $64
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $67
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $57
+JUMPV
+LABELV $67
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $65
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $64
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 393216
+GEI4 $69
+ADDRLP4 28
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 32
+ADDRGP4 strPoolIndex
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $72
+JUMPV
+LABELV $71
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $72
+ADDRLP4 40
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $74
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+NEU4 $71
+LABELV $74
+CNSTI4 8
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $75
+CNSTP4 0
+RETP4
+ADDRGP4 $57
+JUMPV
+LABELV $75
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $77
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $78
+ADDRLP4 16
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+RETP4
+ADDRGP4 $57
+JUMPV
+LABELV $69
+CNSTP4 0
+RETP4
+LABELV $57
+endproc String_Alloc 48 8
+export String_Report
+proc String_Report 12 16
+ADDRGP4 $80
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $81
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1220542464
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $82
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 393216
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 allocPoint
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1233125376
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $79
+endproc String_Report 12 16
+export String_Init
+proc String_Init 16 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $85
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 strHandle
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $86
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+LTI4 $85
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 strHandleCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 menuCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 openMenuCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 Item_SetupKeywordHash
+CALLV
+pop
+ADDRGP4 Menu_SetupKeywordHash
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $89
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $89
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+LABELV $89
+LABELV $84
+endproc String_Init 16 0
+bss
+align 1
+LABELV $92
+skip 4096
+code
+proc PC_SourceError 136 16
+ADDRLP4 132
+ADDRFP4 4+4
+ASGNP4
+ADDRGP4 $92
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_PC_SourceFileAndLine
+CALLI4
+pop
+ADDRGP4 $94
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $91
+endproc PC_SourceError 136 16
+export LerpColor
+proc LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $96
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $102
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $102
+LABELV $101
+LABELV $97
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $96
+LABELV $95
+endproc LerpColor 12 0
+export Float_Parse
+proc Float_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $105
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $105
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $104
+JUMPV
+LABELV $105
+CNSTI4 0
+RETI4
+LABELV $104
+endproc Float_Parse 16 8
+export PC_Float_Parse
+proc PC_Float_Parse 1052 12
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $108
+CNSTI4 0
+RETI4
+ADDRGP4 $107
+JUMPV
+LABELV $108
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $110
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $113
+CNSTI4 0
+RETI4
+ADDRGP4 $107
+JUMPV
+LABELV $113
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+LABELV $110
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $115
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $107
+JUMPV
+LABELV $115
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $119
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+ASGNF4
+LABELV $120
+CNSTI4 1
+RETI4
+LABELV $107
+endproc PC_Float_Parse 1052 12
+export Color_Parse
+proc Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $128
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $124
+CNSTI4 1
+RETI4
+LABELV $123
+endproc Color_Parse 12 8
+export PC_Color_Parse
+proc PC_Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $131
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $135
+CNSTI4 0
+RETI4
+ADDRGP4 $130
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $132
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $131
+CNSTI4 1
+RETI4
+LABELV $130
+endproc PC_Color_Parse 12 8
+export Int_Parse
+proc Int_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $138
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $138
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $138
+CNSTI4 0
+RETI4
+LABELV $137
+endproc Int_Parse 16 8
+export PC_Int_Parse
+proc PC_Int_Parse 1052 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $141
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $141
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $143
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $143
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $145
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $148
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $148
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+LABELV $145
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $150
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $155
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $155
+CNSTI4 1
+RETI4
+LABELV $140
+endproc PC_Int_Parse 1052 12
+export Rect_Parse
+proc Rect_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $164
+CNSTI4 1
+RETI4
+ADDRGP4 $157
+JUMPV
+LABELV $164
+LABELV $162
+LABELV $160
+LABELV $158
+CNSTI4 0
+RETI4
+LABELV $157
+endproc Rect_Parse 16 8
+export PC_Rect_Parse
+proc PC_Rect_Parse 16 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $167
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $169
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $171
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $173
+CNSTI4 1
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $173
+LABELV $171
+LABELV $169
+LABELV $167
+CNSTI4 0
+RETI4
+LABELV $166
+endproc PC_Rect_Parse 16 8
+export String_Parse
+proc String_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $176
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $176
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $176
+CNSTI4 0
+RETI4
+LABELV $175
+endproc String_Parse 16 8
+export PC_String_Parse
+proc PC_String_Parse 1048 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $179
+CNSTI4 0
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $179
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1044
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $178
+endproc PC_String_Parse 1048 8
+export PC_Script_Parse
+proc PC_Script_Parse 2084 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2064
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $183
+CNSTI4 0
+RETI4
+ADDRGP4 $182
+JUMPV
+LABELV $183
+ADDRLP4 1024+16
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+EQI4 $190
+CNSTI4 0
+RETI4
+ADDRGP4 $182
+JUMPV
+LABELV $189
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 2072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $192
+CNSTI4 0
+RETI4
+ADDRGP4 $182
+JUMPV
+LABELV $192
+ADDRLP4 1024+16
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 2076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $194
+ADDRLP4 0
+ARGP4
+ADDRLP4 2080
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $182
+JUMPV
+LABELV $194
+ADDRLP4 1024+16+1
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $198
+ADDRGP4 $202
+ARGP4
+ADDRLP4 1024+16
+ARGP4
+ADDRLP4 2080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2080
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1024+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $199
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $205
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $190
+ADDRGP4 $189
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $182
+endproc PC_Script_Parse 2084 12
+export Init_Display
+proc Init_Display 0 0
+ADDRGP4 DC
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $206
+endproc Init_Display 0 0
+proc GradientBar_Paint 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 61924
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $207
+endproc GradientBar_Paint 12 20
+export Window_Init
+proc Window_Init 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 180
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $208
+endproc Window_Init 8 12
+export Fade
+proc Fade 8 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 96
+BANDI4
+CNSTI4 0
+EQI4 $210
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+LEI4 $212
+ADDRFP4 12
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $214
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $215
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+GTF4 $215
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -37
+BANDI4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LTF4 $218
+ADDRFP4 4
+INDIRP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $220
+LABELV $218
+LABELV $215
+LABELV $212
+LABELV $210
+LABELV $209
+endproc Fade 8 0
+lit
+align 4
+LABELV $223
+byte 4 0
+skip 12
+export Window_Paint
+code
+proc Window_Paint 68 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 $223
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $224
+ADDRGP4 $222
+JUMPV
+LABELV $224
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $226
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $226
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $231
+ADDRGP4 $222
+JUMPV
+LABELV $231
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+LABELV $233
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $238
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $240
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $248
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $252
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $257
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $258
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -2
+ASGNI4
+LABELV $271
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $273
+LABELV $264
+LABELV $258
+LABELV $251
+LABELV $249
+LABELV $239
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $280
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+LEF4 $282
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 60
+INDIRF4
+ASGNF4
+LABELV $283
+ADDRLP4 16+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $279
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $293
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 32+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRLP4 32+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+LABELV $293
+LABELV $292
+LABELV $290
+LABELV $279
+LABELV $222
+endproc Window_Paint 68 28
+proc Item_SetScreenCoords 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $298
+ADDRGP4 $297
+JUMPV
+LABELV $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $300
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $297
+endproc Item_SetScreenCoords 16 0
+proc Item_UpdatePosition 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $303
+LABELV $305
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $302
+endproc Item_UpdatePosition 28 12
+proc Menu_UpdatePosition 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $309
+ADDRGP4 $308
+JUMPV
+LABELV $309
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $311
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $314
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $316
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $313
+LABELV $308
+endproc Menu_UpdatePosition 20 12
+proc Menu_PostParse 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $318
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $320
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1142947840
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1139802112
+ASGNF4
+LABELV $320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $317
+endproc Menu_PostParse 0 4
+export Menu_ClearFocus
+proc Menu_ClearFocus 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $323
+CNSTP4 0
+RETP4
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $325
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $329
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 260
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $331
+ADDRLP4 20
+CNSTI4 260
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $331
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $328
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $325
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $322
+endproc Menu_ClearFocus 28 8
+export IsVisible
+proc IsVisible 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $335
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $335
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $336
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $333
+endproc IsVisible 12 0
+export Rect_ContainsPoint
+proc Rect_ContainsPoint 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $338
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $340
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $340
+ADDRLP4 12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $340
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $340
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $340
+LABELV $338
+CNSTI4 0
+RETI4
+LABELV $337
+endproc Rect_ContainsPoint 20 0
+proc Menu_ItemsMatchingGroup 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $343
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $347
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $347
+LABELV $349
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $347
+LABELV $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $343
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $342
+endproc Menu_ItemsMatchingGroup 24 8
+export Menu_GetMatchingItemByNumber
+proc Menu_GetMatchingItemByNumber 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $351
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $357
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $355
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $355
+LABELV $357
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $358
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $350
+JUMPV
+LABELV $358
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $355
+LABELV $352
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $354
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $351
+CNSTP4 0
+RETP4
+LABELV $350
+endproc Menu_GetMatchingItemByNumber 24 8
+proc Script_SetColor 36 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $361
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $363
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4194304
+BORI4
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+LABELV $369
+LABELV $367
+LABELV $364
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $372
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $374
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $378
+ADDRGP4 $360
+JUMPV
+LABELV $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $375
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $374
+LABELV $372
+LABELV $361
+LABELV $360
+endproc Script_SetColor 36 8
+proc Script_SetAsset 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $383
+LABELV $383
+LABELV $381
+LABELV $380
+endproc Script_SetAsset 8 8
+proc Script_SetBackground 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $386
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $386
+LABELV $385
+endproc Script_SetBackground 12 8
+export Menu_FindItemByName
+proc Menu_FindItemByName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $391
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $389
+LABELV $391
+CNSTP4 0
+RETP4
+ADDRGP4 $388
+JUMPV
+LABELV $389
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $392
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $396
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $388
+JUMPV
+LABELV $396
+LABELV $393
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $395
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $392
+CNSTP4 0
+RETP4
+LABELV $388
+endproc Menu_FindItemByName 12 8
+proc Script_SetTeamColor 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $401
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $401
+LABELV $399
+LABELV $398
+endproc Script_SetTeamColor 24 4
+proc Script_SetItemColor 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 48
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ADDRGP4 Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRGP4 $405
+JUMPV
+LABELV $408
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+LABELV $420
+LABELV $419
+LABELV $417
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $422
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $424
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $424
+LABELV $422
+LABELV $414
+LABELV $411
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $413
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $410
+LABELV $406
+LABELV $405
+endproc Script_SetItemColor 80 12
+proc Menu_ShowItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $429
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $433
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $435
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $437
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $437
+LABELV $436
+LABELV $433
+LABELV $430
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $432
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $429
+LABELV $428
+endproc Menu_ShowItemByName 24 12
+proc Menu_FadeItemByName 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $444
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 36
+BORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 20
+CNSTI4 68
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $447
+LABELV $444
+LABELV $441
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $443
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $440
+LABELV $439
+endproc Menu_FadeItemByName 32 12
+export Menus_FindByName
+proc Menus_FindByName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $449
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $453
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $448
+JUMPV
+LABELV $453
+LABELV $450
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $452
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $449
+CNSTP4 0
+RETP4
+LABELV $448
+endproc Menus_FindByName 8 8
+export Menus_ShowByName
+proc Menus_ShowByName 8 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $457
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+LABELV $457
+LABELV $456
+endproc Menus_ShowByName 8 4
+export Menus_OpenByName
+proc Menus_OpenByName 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $459
+endproc Menus_OpenByName 0 4
+proc Menu_RunCloseScript 548 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 544
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 544
+INDIRU4
+EQU4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 544
+INDIRU4
+EQU4 $461
+ADDRLP4 0+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $461
+LABELV $460
+endproc Menu_RunCloseScript 548 8
+export Menus_CloseByName
+proc Menus_CloseByName 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $465
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $465
+LABELV $464
+endproc Menus_CloseByName 12 4
+export Menus_CloseAll
+proc Menus_CloseAll 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $471
+JUMPV
+LABELV $468
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $469
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $471
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $468
+LABELV $467
+endproc Menus_CloseAll 8 4
+proc Script_Show 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $474
+LABELV $473
+endproc Script_Show 8 12
+proc Script_Hide 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $477
+LABELV $476
+endproc Script_Hide 8 12
+proc Script_FadeIn 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $480
+LABELV $479
+endproc Script_FadeIn 8 12
+proc Script_FadeOut 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $483
+LABELV $482
+endproc Script_FadeOut 8 12
+proc Script_Open 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $486
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $486
+LABELV $485
+endproc Script_Open 8 8
+proc Script_ConditionalOpen 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $491
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $492
+JUMPV
+LABELV $491
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $492
+LABELV $489
+LABELV $488
+endproc Script_ConditionalOpen 32 8
+proc Script_Close 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $494
+LABELV $493
+endproc Script_Close 8 8
+proc Menu_TransitionItemByName 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $501
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 260
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 48
+INDIRF4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $501
+LABELV $498
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $500
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $497
+LABELV $496
+endproc Menu_TransitionItemByName 52 12
+proc Script_Transition 96 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 52
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 56
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 80
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 Menu_TransitionItemByName
+CALLV
+pop
+LABELV $506
+LABELV $504
+LABELV $503
+endproc Script_Transition 96 24
+proc Menu_OrbitItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $512
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $513
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 65540
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $513
+LABELV $510
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $512
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $509
+LABELV $508
+endproc Menu_OrbitItemByName 24 12
+proc Script_Orbit 48 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Menu_OrbitItemByName
+CALLV
+pop
+LABELV $518
+LABELV $516
+LABELV $515
+endproc Script_Orbit 48 28
+proc Script_SetFocus 36 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_FindItemByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $523
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $523
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearFocus
+CALLP4
+pop
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $525
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $525
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61984
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 61984
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $527
+LABELV $523
+LABELV $521
+LABELV $520
+endproc Script_SetFocus 36 8
+proc Script_SetPlayerModel 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $530
+ADDRGP4 $532
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $530
+LABELV $529
+endproc Script_SetPlayerModel 8 8
+proc Script_SetPlayerHead 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRGP4 $536
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $534
+LABELV $533
+endproc Script_SetPlayerHead 8 8
+proc Script_SetCvar 16 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $538
+LABELV $537
+endproc Script_SetCvar 16 8
+proc Script_Exec 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRGP4 $543
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $541
+LABELV $540
+endproc Script_Exec 12 8
+proc Script_Play 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $545
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $545
+LABELV $544
+endproc Script_Play 12 8
+proc Script_playLooped 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $548
+LABELV $547
+endproc Script_playLooped 12 8
+data
+export commandList
+align 4
+LABELV commandList
+address $550
+address Script_FadeIn
+address $551
+address Script_FadeOut
+address $552
+address Script_Show
+address $553
+address Script_Hide
+address $554
+address Script_SetColor
+address $555
+address Script_Open
+address $556
+address Script_ConditionalOpen
+address $557
+address Script_Close
+address $558
+address Script_SetAsset
+address $559
+address Script_SetBackground
+address $560
+address Script_SetItemColor
+address $561
+address Script_SetTeamColor
+address $562
+address Script_SetFocus
+address $563
+address Script_SetPlayerModel
+address $564
+address Script_SetPlayerHead
+address $565
+address Script_Transition
+address $566
+address Script_SetCvar
+address $567
+address Script_Exec
+address $568
+address Script_Play
+address $569
+address Script_playLooped
+address $570
+address Script_Orbit
+export scriptCommandCount
+align 4
+LABELV scriptCommandCount
+byte 4 21
+code
+proc Item_RunScript 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1040
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1040
+INDIRU4
+EQU4 $572
+ADDRLP4 1044
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+ADDRLP4 1040
+INDIRU4
+EQU4 $572
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $572
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 16
+ASGNP4
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $577
+ADDRGP4 $571
+JUMPV
+LABELV $577
+ADDRLP4 1052
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $579
+ADDRLP4 1052
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $579
+ADDRGP4 $575
+JUMPV
+LABELV $579
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 $584
+JUMPV
+LABELV $581
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList+4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $585
+LABELV $582
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $584
+ADDRLP4 0
+INDIRI4
+ADDRGP4 scriptCommandCount
+INDIRI4
+LTI4 $581
+LABELV $583
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $588
+ADDRLP4 12
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $588
+LABELV $575
+ADDRGP4 $574
+JUMPV
+LABELV $572
+LABELV $571
+endproc Item_RunScript 1064 12
+proc Item_EnableShowViaCvar 2088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2060
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 2060
+INDIRU4
+EQU4 $591
+ADDRLP4 2064
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 2064
+INDIRP4
+CVPU4 4
+ADDRLP4 2060
+INDIRU4
+EQU4 $591
+ADDRLP4 2068
+CNSTI4 0
+ASGNI4
+ADDRLP4 2064
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 2068
+INDIRI4
+EQI4 $591
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+CVPU4 4
+ADDRLP4 2060
+INDIRU4
+EQU4 $591
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 2068
+INDIRI4
+EQI4 $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 1028
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRLP4 1028
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2076
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $599
+ADDRLP4 2080
+CNSTI4 0
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 2080
+CNSTI4 1
+ASGNI4
+LABELV $600
+ADDRLP4 2080
+INDIRI4
+RETI4
+ADDRGP4 $590
+JUMPV
+LABELV $596
+ADDRLP4 2080
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2080
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $601
+ADDRLP4 2080
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $601
+ADDRGP4 $594
+JUMPV
+LABELV $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $604
+CNSTI4 1
+RETI4
+ADDRGP4 $590
+JUMPV
+LABELV $603
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $607
+CNSTI4 0
+RETI4
+ADDRGP4 $590
+JUMPV
+LABELV $607
+LABELV $604
+LABELV $594
+ADDRGP4 $593
+JUMPV
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $610
+ADDRLP4 2076
+CNSTI4 0
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+LABELV $611
+ADDRLP4 2076
+INDIRI4
+RETI4
+ADDRGP4 $590
+JUMPV
+LABELV $591
+CNSTI4 1
+RETI4
+LABELV $590
+endproc Item_EnableShowViaCvar 2088 12
+proc Item_SetFocus 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $617
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 44
+INDIRI4
+NEI4 $617
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 44
+INDIRI4
+NEI4 $617
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 44
+INDIRI4
+NEI4 $613
+LABELV $617
+CNSTI4 0
+RETI4
+ADDRGP4 $612
+JUMPV
+LABELV $613
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $618
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $618
+CNSTI4 0
+RETI4
+ADDRGP4 $612
+JUMPV
+LABELV $618
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $620
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $620
+CNSTI4 0
+RETI4
+ADDRGP4 $612
+JUMPV
+LABELV $620
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 Menu_ClearFocus
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61984
+ADDP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $622
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 16+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $626
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $628
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+LABELV $628
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $626
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $623
+ADDRLP4 76
+ADDRLP4 32
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $623
+ADDRLP4 80
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $634
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+LABELV $636
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $623
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $638
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $638
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $638
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $640
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $644
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $642
+JUMPV
+LABELV $644
+LABELV $641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $643
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $640
+LABELV $642
+CNSTI4 1
+RETI4
+LABELV $612
+endproc Item_SetFocus 84 12
+proc Item_ListBox_MaxScroll 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $647
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $648
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $649
+CNSTI4 0
+RETI4
+ADDRGP4 $646
+JUMPV
+LABELV $649
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $646
+endproc Item_ListBox_MaxScroll 20 4
+proc Item_ListBox_ThumbPosition 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $652
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $654
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $655
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+ADDRGP4 $651
+JUMPV
+LABELV $652
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $656
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $657
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+LABELV $651
+endproc Item_ListBox_ThumbPosition 24 4
+proc Item_ListBox_ThumbDrawPosition 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $659
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $661
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+LTF4 $663
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+GTF4 $663
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $663
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $661
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+LTF4 $665
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+GTF4 $665
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $658
+JUMPV
+LABELV $659
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $658
+endproc Item_ListBox_ThumbDrawPosition 32 4
+proc Item_Slider_ThumbPosition 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $668
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $669
+ADDRLP4 20
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+EQU4 $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRU4
+NEU4 $670
+LABELV $672
+ADDRLP4 8
+INDIRF4
+RETF4
+ADDRGP4 $667
+JUMPV
+LABELV $670
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+GEF4 $673
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $675
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $675
+LABELV $674
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1119879168
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $667
+endproc Item_Slider_ThumbPosition 32 4
+proc Item_Slider_OverSlider 24 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $681
+CNSTI4 8192
+RETI4
+ADDRGP4 $677
+JUMPV
+LABELV $681
+CNSTI4 0
+RETI4
+LABELV $677
+endproc Item_Slider_OverSlider 24 12
+proc Item_ListBox_OverLB 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $684
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $689
+CNSTI4 2048
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $689
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $691
+CNSTI4 4096
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $691
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $693
+CNSTI4 8192
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $693
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $696
+CNSTI4 16384
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $696
+ADDRLP4 52
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $685
+CNSTI4 32768
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $684
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $704
+CNSTI4 2048
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $704
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $707
+CNSTI4 4096
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $710
+CNSTI4 8192
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $710
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $715
+CNSTI4 16384
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $715
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $719
+CNSTI4 32768
+RETI4
+ADDRGP4 $683
+JUMPV
+LABELV $719
+LABELV $685
+CNSTI4 0
+RETI4
+LABELV $683
+endproc Item_ListBox_OverLB 64 12
+proc Item_ListBox_MouseEnter 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -63489
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $723
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $723
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $723
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $735
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $743
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $743
+LABELV $740
+LABELV $735
+LABELV $723
+LABELV $721
+endproc Item_ListBox_MouseEnter 64 12
+proc Item_MouseEnter 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $746
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $750
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $750
+ADDRGP4 $745
+JUMPV
+LABELV $750
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $752
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $752
+ADDRGP4 $745
+JUMPV
+LABELV $752
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $754
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $756
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $756
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $755
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $760
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $760
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $762
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $762
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $764
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_ListBox_MouseEnter
+CALLV
+pop
+LABELV $764
+LABELV $755
+LABELV $746
+LABELV $745
+endproc Item_MouseEnter 44 12
+proc Item_MouseLeave 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $767
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $769
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $769
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -6145
+BANDI4
+ASGNI4
+LABELV $767
+LABELV $766
+endproc Item_MouseLeave 8 8
+export Menu_HitTest
+proc Menu_HitTest 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $775
+JUMPV
+LABELV $772
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $771
+JUMPV
+LABELV $776
+LABELV $773
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $775
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $772
+CNSTP4 0
+RETP4
+LABELV $771
+endproc Menu_HitTest 8 12
+proc Item_SetMouseOver 4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $779
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $781
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $782
+LABELV $779
+LABELV $778
+endproc Item_SetMouseOver 4 0
+proc Item_OwnerDraw_HandleKey 12 16
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $784
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $784
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $783
+JUMPV
+LABELV $784
+CNSTI4 0
+RETI4
+LABELV $783
+endproc Item_OwnerDraw_HandleKey 12 16
+proc Item_ListBox_HandleKey 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $789
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $787
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 36
+INDIRI4
+EQI4 $787
+LABELV $789
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $790
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $794
+ADDRFP4 4
+INDIRI4
+CNSTI4 163
+NEI4 $792
+LABELV $794
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $795
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $797
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $797
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $799
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $799
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $801
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $801
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $796
+JUMPV
+LABELV $795
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $803
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $803
+LABELV $796
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $792
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+EQI4 $807
+ADDRFP4 4
+INDIRI4
+CNSTI4 165
+NEI4 $791
+LABELV $807
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $808
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $810
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $810
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $812
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $812
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $814
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $814
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $816
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $816
+LABELV $809
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $790
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $820
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+NEI4 $818
+LABELV $820
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $821
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $823
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $823
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $825
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $825
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $827
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $827
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $829
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $829
+LABELV $822
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $818
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $833
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+NEI4 $831
+LABELV $833
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $834
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $836
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $836
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $838
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $838
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $840
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $840
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $835
+JUMPV
+LABELV $834
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $842
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $842
+LABELV $835
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $831
+LABELV $791
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+NEI4 $844
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+GEI4 $847
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+LABELV $848
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $849
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $849
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $844
+ADDRFP4 4
+INDIRI4
+CNSTI4 183
+NEI4 $851
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+GEI4 $854
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+LABELV $855
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $856
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $856
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $851
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $860
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+NEI4 $858
+LABELV $860
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $861
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $862
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $862
+JUMPV
+LABELV $861
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $865
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $866
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $866
+JUMPV
+LABELV $865
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $869
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $870
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $870
+JUMPV
+LABELV $869
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $873
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $874
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $874
+JUMPV
+LABELV $873
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $877
+ADDRGP4 $878
+JUMPV
+LABELV $877
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRGP4 lastListBoxClickTime
+INDIRI4
+GEI4 $879
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $879
+ADDRGP4 lastListBoxClickTime
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CNSTI4 300
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+EQI4 $881
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $881
+LABELV $878
+LABELV $874
+LABELV $870
+LABELV $866
+LABELV $862
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $858
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $885
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+NEI4 $883
+LABELV $885
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $883
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+EQI4 $888
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+NEI4 $886
+LABELV $888
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $886
+ADDRFP4 4
+INDIRI4
+CNSTI4 142
+EQI4 $891
+ADDRFP4 4
+INDIRI4
+CNSTI4 162
+NEI4 $889
+LABELV $891
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $892
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $894
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $894
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $896
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $896
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $898
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $892
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $900
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $900
+LABELV $893
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $889
+ADDRFP4 4
+INDIRI4
+CNSTI4 141
+EQI4 $904
+ADDRFP4 4
+INDIRI4
+CNSTI4 168
+NEI4 $902
+LABELV $904
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $905
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $907
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $907
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $909
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $909
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $911
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $911
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $906
+JUMPV
+LABELV $905
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $913
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $913
+LABELV $906
+CNSTI4 1
+RETI4
+ADDRGP4 $786
+JUMPV
+LABELV $902
+LABELV $787
+CNSTI4 0
+RETI4
+LABELV $786
+endproc Item_ListBox_HandleKey 80 12
+proc Item_YesNo_HandleKey 24 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $916
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $921
+ADDRLP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $921
+ADDRLP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $918
+LABELV $921
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $919
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $919
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $919
+JUMPV
+LABELV $918
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $924
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $924
+LABELV $919
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $930
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $931
+JUMPV
+LABELV $930
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $931
+ADDRGP4 $928
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $915
+JUMPV
+LABELV $926
+LABELV $916
+CNSTI4 0
+RETI4
+LABELV $915
+endproc Item_YesNo_HandleKey 24 12
+proc Item_Multi_CountSettings 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $933
+CNSTI4 0
+RETI4
+ADDRGP4 $932
+JUMPV
+LABELV $933
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+RETI4
+LABELV $932
+endproc Item_Multi_CountSettings 4 0
+proc Item_Multi_FindCvarByValue 1040 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $936
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $938
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $939
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $943
+JUMPV
+LABELV $940
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $944
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $945
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $935
+JUMPV
+LABELV $944
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $948
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $935
+JUMPV
+LABELV $948
+LABELV $945
+LABELV $941
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $943
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $940
+LABELV $936
+CNSTI4 0
+RETI4
+LABELV $935
+endproc Item_Multi_FindCvarByValue 1040 12
+proc Item_Multi_Setting 1040 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $951
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $953
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $954
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $958
+JUMPV
+LABELV $955
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $959
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $960
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $950
+JUMPV
+LABELV $959
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $963
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $950
+JUMPV
+LABELV $963
+LABELV $960
+LABELV $956
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $958
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $955
+LABELV $951
+ADDRGP4 $59
+RETP4
+LABELV $950
+endproc Item_Multi_Setting 1040 12
+proc Item_Multi_HandleKey 80 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $966
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $968
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 178
+EQI4 $973
+ADDRLP4 40
+INDIRI4
+CNSTI4 179
+EQI4 $973
+ADDRLP4 40
+INDIRI4
+CNSTI4 180
+NEI4 $970
+LABELV $973
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 52
+INDIRI4
+EQI4 $971
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+NEI4 $977
+ADDRLP4 56
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $978
+JUMPV
+LABELV $977
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+LABELV $978
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $971
+JUMPV
+LABELV $970
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $971
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Item_Multi_FindCvarByValue
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_Multi_CountSettings
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $981
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $982
+JUMPV
+LABELV $981
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $983
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $983
+LABELV $982
+ADDRLP4 0
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $985
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+EQF4 $987
+ADDRGP4 $928
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $989
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $988
+JUMPV
+LABELV $987
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 56
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 60
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+CNSTU4 8
+GEU4 $991
+ADDRLP4 52
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $992
+JUMPV
+LABELV $991
+ADDRLP4 52
+CNSTU4 8
+ASGNU4
+LABELV $992
+ADDRLP4 52
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $989
+ARGP4
+ADDRGP4 $993
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $928
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $994
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $928
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $995
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $988
+LABELV $985
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $996
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $997
+JUMPV
+LABELV $996
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 52
+INDIRF4
+NEF4 $998
+ADDRGP4 $928
+ARGP4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $999
+JUMPV
+LABELV $998
+ADDRGP4 $1000
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $999
+LABELV $997
+CNSTI4 1
+RETI4
+ADDRGP4 $965
+JUMPV
+LABELV $979
+LABELV $968
+LABELV $966
+CNSTI4 0
+RETI4
+LABELV $965
+endproc Item_Multi_HandleKey 80 12
+proc Item_TextField_HandleKey 1080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1002
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1032
+ADDRLP4 1040
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $1004
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+LEI4 $1004
+ADDRLP4 1032
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1004
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1006
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $1008
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1010
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4-1
+ADDP4
+ARGP4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1048
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1013
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1013
+LABELV $1010
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1008
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $1017
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1015
+LABELV $1017
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1015
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1018
+ADDRFP4 4
+INDIRI4
+CNSTI4 48
+LTI4 $1022
+ADDRFP4 4
+INDIRI4
+CNSTI4 57
+LEI4 $1020
+LABELV $1022
+CNSTI4 0
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1020
+LABELV $1018
+ADDRLP4 1048
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $1023
+ADDRLP4 1052
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 255
+EQI4 $1027
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $1025
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LTI4 $1025
+LABELV $1027
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1025
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1060
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1029
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1029
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1029
+LABELV $1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+GEI4 $1007
+ADDRLP4 1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $1007
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LEI4 $1007
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1007
+JUMPV
+LABELV $1006
+ADDRFP4 4
+INDIRI4
+CNSTI4 140
+EQI4 $1037
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+NEI4 $1035
+LABELV $1037
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1038
+ADDRLP4 1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1038
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1035
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+EQI4 $1043
+ADDRFP4 4
+INDIRI4
+CNSTI4 165
+NEI4 $1041
+LABELV $1043
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $1044
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LTI4 $1044
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1044
+ADDRLP4 1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1046
+ADDRLP4 1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1046
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1041
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $1050
+ADDRFP4 4
+INDIRI4
+CNSTI4 163
+NEI4 $1048
+LABELV $1050
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1051
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1051
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1053
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1053
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1048
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+EQI4 $1057
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+NEI4 $1055
+LABELV $1057
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1055
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+EQI4 $1060
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+NEI4 $1058
+LABELV $1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LEI4 $1061
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1061
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1058
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+EQI4 $1065
+ADDRFP4 4
+INDIRI4
+CNSTI4 170
+NEI4 $1063
+LABELV $1065
+ADDRLP4 1076
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1067
+ADDRLP4 1072
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1068
+JUMPV
+LABELV $1067
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+LABELV $1068
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1063
+LABELV $1007
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1072
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $1072
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+NEI4 $1069
+LABELV $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1073
+ADDRLP4 1060
+ADDRLP4 1028
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 4
+EQI4 $1075
+ADDRLP4 1060
+INDIRI4
+CNSTI4 9
+NEI4 $1073
+LABELV $1075
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1073
+LABELV $1069
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1078
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+NEI4 $1076
+LABELV $1078
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1079
+ADDRLP4 1064
+ADDRLP4 1028
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 4
+EQI4 $1081
+ADDRLP4 1064
+INDIRI4
+CNSTI4 9
+NEI4 $1079
+LABELV $1081
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1079
+LABELV $1076
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1085
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $1085
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+NEI4 $1082
+LABELV $1085
+CNSTI4 0
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1082
+CNSTI4 1
+RETI4
+ADDRGP4 $1001
+JUMPV
+LABELV $1002
+CNSTI4 0
+RETI4
+LABELV $1001
+endproc Item_TextField_HandleKey 1080 12
+proc Scroll_ListBox_AutoFunc 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1087
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1087
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1089
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1091
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1091
+LABELV $1089
+LABELV $1086
+endproc Scroll_ListBox_AutoFunc 12 16
+proc Scroll_ListBox_ThumbFunc 44 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1094
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEF4 $1096
+ADDRGP4 $1093
+JUMPV
+LABELV $1096
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1100
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1101
+JUMPV
+LABELV $1100
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1102
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1102
+LABELV $1101
+ADDRLP4 28
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1095
+JUMPV
+LABELV $1094
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+EQF4 $1104
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 8+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8+4
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 8+12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1110
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1111
+JUMPV
+LABELV $1110
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1112
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1112
+LABELV $1111
+ADDRLP4 28
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1104
+LABELV $1095
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1114
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1114
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1116
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1118
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1118
+LABELV $1116
+LABELV $1093
+endproc Scroll_ListBox_ThumbFunc 44 16
+proc Scroll_Slider_ThumbFunc 32 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 20
+INDIRP4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1121
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1122
+JUMPV
+LABELV $1121
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1122
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $1123
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $1124
+JUMPV
+LABELV $1123
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119879168
+ADDF4
+LEF4 $1125
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119879168
+ADDF4
+ASGNF4
+LABELV $1125
+LABELV $1124
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1119879168
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1000
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1120
+endproc Scroll_Slider_ThumbFunc 32 8
+proc Item_StartCapture 28 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1128
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GTI4 $1128
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1155-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1155
+address $1131
+address $1128
+address $1131
+address $1128
+address $1128
+address $1131
+address $1148
+code
+LABELV $1131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6144
+BANDI4
+CNSTI4 0
+EQI4 $1132
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRGP4 scrollInfo
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+8
+CNSTI4 500
+ASGNI4
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1139
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1140
+ADDRGP4 scrollInfo+28
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_AutoFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1129
+JUMPV
+LABELV $1132
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1129
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1129
+JUMPV
+LABELV $1148
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_Slider_OverSlider
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1129
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_Slider_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1128
+LABELV $1129
+LABELV $1127
+endproc Item_StartCapture 28 12
+proc Item_StopCapture 0 0
+LABELV $1157
+endproc Item_StopCapture 0 0
+proc Item_Slider_HandleKey 76 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1159
+ADDRLP4 40
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 178
+EQI4 $1164
+ADDRLP4 40
+INDIRI4
+CNSTI4 179
+EQI4 $1164
+ADDRLP4 40
+INDIRI4
+CNSTI4 180
+NEI4 $1161
+LABELV $1164
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $1162
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 56
+INDIRI4
+EQI4 $1162
+ADDRLP4 32
+CNSTF4 1119879168
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1167
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1168
+JUMPV
+LABELV $1167
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1168
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1120665600
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $1162
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1000
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1161
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1172
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1174
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+SUBF4
+CNSTF4 1101004800
+DIVF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+GEF4 $1176
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1177
+JUMPV
+LABELV $1176
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $1178
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1178
+LABELV $1177
+ADDRGP4 $1000
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1158
+JUMPV
+LABELV $1174
+LABELV $1172
+LABELV $1162
+LABELV $1159
+ADDRGP4 $1180
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1158
+endproc Item_Slider_HandleKey 76 12
+proc Item_HandleKey 32 16
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1182
+ADDRGP4 itemCapture
+INDIRP4
+ARGP4
+ADDRGP4 Item_StopCapture
+CALLV
+pop
+ADDRGP4 itemCapture
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureFunc
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureData
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 178
+EQI4 $1187
+ADDRLP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $1187
+ADDRLP4 0
+INDIRI4
+CNSTI4 180
+NEI4 $1184
+LABELV $1187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Item_StartCapture
+CALLV
+pop
+LABELV $1184
+LABELV $1183
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1188
+CNSTI4 0
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1188
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1190
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1190
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1204-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1204
+address $1193
+address $1194
+address $1195
+address $1196
+address $1197
+address $1198
+address $1190
+address $1201
+address $1196
+address $1203
+address $1199
+address $1200
+address $1202
+code
+LABELV $1193
+CNSTI4 0
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1194
+CNSTI4 0
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1195
+CNSTI4 0
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1196
+CNSTI4 0
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1197
+CNSTI4 0
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Item_YesNo_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Item_Multi_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_OwnerDraw_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_Slider_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1190
+CNSTI4 0
+RETI4
+LABELV $1181
+endproc Item_HandleKey 32 16
+proc Item_Action 4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1207
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1207
+LABELV $1206
+endproc Item_Action 4 8
+export Menu_SetPrevCursorItem
+proc Menu_SetPrevCursorItem 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $1213
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1213
+JUMPV
+LABELV $1212
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GEI4 $1215
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $1215
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1215
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1209
+JUMPV
+LABELV $1217
+LABELV $1213
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -1
+GTI4 $1212
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1209
+endproc Menu_SetPrevCursorItem 52 12
+export Menu_SetNextCursorItem
+proc Menu_SetNextCursorItem 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1223
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1223
+JUMPV
+LABELV $1222
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1225
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1225
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1225
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1219
+JUMPV
+LABELV $1227
+LABELV $1223
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1222
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1219
+endproc Menu_SetNextCursorItem 48 12
+proc Window_CloseCinematic 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1230
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1230
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1230
+LABELV $1229
+endproc Window_CloseCinematic 4 4
+proc Menu_CloseCinematics 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1233
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1238
+JUMPV
+LABELV $1235
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1239
+CNSTI4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1239
+LABELV $1236
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1238
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1235
+LABELV $1233
+LABELV $1232
+endproc Menu_CloseCinematics 4 4
+proc Display_CloseCinematics 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1245
+JUMPV
+LABELV $1242
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_CloseCinematics
+CALLV
+pop
+LABELV $1243
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1245
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1242
+LABELV $1241
+endproc Display_CloseCinematics 4 4
+export Menus_Activate
+proc Menus_Activate 552 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 540
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 540
+INDIRP4
+ADDRLP4 540
+INDIRP4
+INDIRI4
+CNSTI4 6
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1247
+ADDRLP4 0+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1247
+ADDRLP4 544
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 544
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1250
+ADDRLP4 544
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1250
+ADDRLP4 548
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1250
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1246
+endproc Menus_Activate 552 8
+proc Display_VisibleMenuCount 12 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1256
+JUMPV
+LABELV $1253
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $1257
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1257
+LABELV $1254
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1256
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1253
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1252
+endproc Display_VisibleMenuCount 12 0
+proc Menus_HandleOOBClick 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1261
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1263
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1263
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $1263
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1268
+JUMPV
+LABELV $1265
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Menu_OverActiveItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $1269
+LABELV $1266
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1268
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1265
+ADDRLP4 8
+ADDRGP4 Display_VisibleMenuCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1271
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1273
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1273
+LABELV $1271
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1261
+LABELV $1260
+endproc Menus_HandleOOBClick 24 12
+bss
+align 4
+LABELV $1276
+skip 16
+code
+proc Item_CorrectedTextRect 4 12
+ADDRGP4 $1276
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1277
+ADDRGP4 $1276
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRGP4 $1276+8
+INDIRF4
+CNSTF4 0
+EQF4 $1279
+ADDRLP4 0
+ADDRGP4 $1276+4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 $1276+12
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1279
+LABELV $1277
+ADDRGP4 $1276
+RETP4
+LABELV $1275
+endproc Item_CorrectedTextRect 4 12
+export UI_SelectForKey
+proc UI_SelectForKey 32 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 163
+EQI4 $1288
+ADDRLP4 4
+CNSTI4 165
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1287
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1290
+LABELV $1289
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 13
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1287
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1285
+LABELV $1291
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 134
+EQI4 $1288
+ADDRLP4 16
+INDIRI4
+CNSTI4 135
+EQI4 $1287
+ADDRGP4 $1285
+JUMPV
+LABELV $1290
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 169
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1287
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $1285
+LABELV $1292
+ADDRLP4 28
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 178
+LTI4 $1285
+ADDRLP4 28
+INDIRI4
+CNSTI4 188
+GTI4 $1285
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1293-712
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1293
+address $1287
+address $1288
+address $1287
+address $1285
+address $1285
+address $1285
+address $1285
+address $1287
+address $1287
+address $1287
+address $1287
+code
+LABELV $1287
+CNSTI4 1
+RETI4
+ADDRGP4 $1284
+JUMPV
+LABELV $1288
+CNSTI4 -1
+RETI4
+ADDRGP4 $1284
+JUMPV
+LABELV $1285
+CNSTI4 0
+RETI4
+LABELV $1284
+endproc UI_SelectForKey 32 0
+bss
+align 4
+LABELV $1296
+skip 4
+export Menu_HandleKey
+code
+proc Menu_HandleKey 636 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 548
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 548
+INDIRI4
+EQI4 $1297
+ADDRFP4 8
+INDIRI4
+ADDRLP4 548
+INDIRI4
+EQI4 $1297
+ADDRGP4 g_bindItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+pop
+ADDRGP4 $1295
+JUMPV
+LABELV $1297
+ADDRLP4 552
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 552
+INDIRI4
+EQI4 $1299
+ADDRFP4 8
+INDIRI4
+ADDRLP4 552
+INDIRI4
+EQI4 $1299
+ADDRGP4 g_editItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 556
+ADDRGP4 Item_TextField_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+NEI4 $1301
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1295
+JUMPV
+LABELV $1301
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1306
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1306
+ADDRFP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1303
+LABELV $1306
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 564
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 564
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 564
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1304
+JUMPV
+LABELV $1303
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1310
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1310
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+NEI4 $1307
+LABELV $1310
+ADDRGP4 $1295
+JUMPV
+LABELV $1307
+LABELV $1304
+LABELV $1299
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1311
+ADDRGP4 $1295
+JUMPV
+LABELV $1311
+ADDRLP4 556
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 556
+INDIRI4
+EQI4 $1313
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ADDRLP4 556
+INDIRI4
+NEI4 $1313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 564
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 564
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 564
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 568
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+NEI4 $1313
+ADDRGP4 $1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1296
+INDIRI4
+CNSTI4 0
+NEI4 $1315
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1318
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1318
+ADDRFP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1315
+LABELV $1318
+ADDRGP4 $1296
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menus_HandleOOBClick
+CALLV
+pop
+ADDRGP4 $1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1295
+JUMPV
+LABELV $1315
+LABELV $1313
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1322
+JUMPV
+LABELV $1319
+ADDRLP4 572
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 572
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 572
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1323
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1323
+LABELV $1320
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1322
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1319
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1325
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 Item_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+EQI4 $1327
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1295
+JUMPV
+LABELV $1327
+LABELV $1325
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1329
+ADDRGP4 $1295
+JUMPV
+LABELV $1329
+ADDRFP4 4
+INDIRI4
+CNSTI4 155
+EQI4 $1333
+ADDRLP4 576
+CNSTI4 156
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1337
+ADDRFP4 4
+INDIRI4
+ADDRLP4 576
+INDIRI4
+GTI4 $1368
+LABELV $1367
+ADDRLP4 584
+CNSTI4 13
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+EQI4 $1361
+ADDRFP4 4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+GTI4 $1370
+LABELV $1369
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1346
+ADDRGP4 $1331
+JUMPV
+LABELV $1370
+ADDRLP4 592
+CNSTI4 27
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 592
+INDIRI4
+EQI4 $1342
+ADDRFP4 4
+INDIRI4
+ADDRLP4 592
+INDIRI4
+LTI4 $1331
+LABELV $1371
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1341
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $1346
+ADDRGP4 $1331
+JUMPV
+LABELV $1368
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+EQI4 $1346
+ADDRLP4 604
+CNSTI4 169
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 604
+INDIRI4
+EQI4 $1361
+ADDRFP4 4
+INDIRI4
+ADDRLP4 604
+INDIRI4
+GTI4 $1373
+LABELV $1372
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+EQI4 $1341
+ADDRGP4 $1331
+JUMPV
+LABELV $1373
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+LTI4 $1331
+ADDRFP4 4
+INDIRI4
+CNSTI4 188
+GTI4 $1374
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1375-712
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1375
+address $1347
+address $1347
+address $1331
+address $1331
+address $1331
+address $1331
+address $1331
+address $1361
+address $1361
+address $1361
+address $1361
+code
+LABELV $1374
+ADDRFP4 4
+INDIRI4
+CNSTI4 217
+LTI4 $1331
+ADDRFP4 4
+INDIRI4
+CNSTI4 232
+GTI4 $1331
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1377-868
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1377
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+address $1361
+code
+LABELV $1333
+ADDRGP4 $1336
+ARGP4
+ADDRLP4 616
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 616
+INDIRF4
+CNSTF4 0
+EQF4 $1332
+ADDRLP4 620
+ADDRGP4 debugMode
+ASGNP4
+ADDRLP4 620
+INDIRP4
+ADDRLP4 620
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1337
+ADDRGP4 $1336
+ARGP4
+ADDRLP4 620
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $1332
+CNSTI4 2
+ARGI4
+ADDRGP4 $1340
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1332
+JUMPV
+LABELV $1341
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+pop
+ADDRGP4 $1332
+JUMPV
+LABELV $1342
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+NEI4 $1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1332
+ADDRLP4 8+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $1332
+JUMPV
+LABELV $1346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+pop
+ADDRGP4 $1332
+JUMPV
+LABELV $1347
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1332
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1350
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 624
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 628
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 632
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $1332
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1332
+JUMPV
+LABELV $1350
+ADDRLP4 624
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 4
+EQI4 $1356
+ADDRLP4 624
+INDIRI4
+CNSTI4 9
+NEI4 $1354
+LABELV $1356
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 628
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 632
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $1332
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1332
+JUMPV
+LABELV $1354
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 628
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 632
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $1332
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1332
+JUMPV
+LABELV $1361
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1332
+ADDRLP4 624
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 4
+EQI4 $1366
+ADDRLP4 624
+INDIRI4
+CNSTI4 9
+NEI4 $1364
+LABELV $1366
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1332
+JUMPV
+LABELV $1364
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+LABELV $1331
+LABELV $1332
+LABELV $1295
+endproc Menu_HandleKey 636 12
+proc ToWindowCoords 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1380
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1380
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1379
+endproc ToWindowCoords 8 0
+export Rect_ToWindowCoords
+proc Rect_ToWindowCoords 4 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1382
+endproc Rect_ToWindowCoords 4 12
+proc Item_SetTextExtents 312 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1385
+ADDRLP4 264
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $1386
+JUMPV
+LABELV $1385
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1386
+ADDRLP4 0
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1387
+ADDRGP4 $1383
+JUMPV
+LABELV $1387
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1391
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1389
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1389
+LABELV $1391
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1392
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 1
+EQI4 $1394
+ADDRLP4 284
+INDIRI4
+CNSTI4 2
+NEI4 $1392
+LABELV $1394
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 292
+ADDRGP4 DC
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 292
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1393
+JUMPV
+LABELV $1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1395
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1395
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1395
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 292
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1395
+LABELV $1393
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 296
+ADDRGP4 DC
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1397
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $1398
+JUMPV
+LABELV $1397
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1399
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+LABELV $1399
+LABELV $1398
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1389
+LABELV $1383
+endproc Item_SetTextExtents 312 12
+proc Item_TextColor 64 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1402
+ADDRLP4 28
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1403
+JUMPV
+LABELV $1402
+ADDRLP4 28
+CNSTI4 220
+ASGNI4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $1407
+ADDRGP4 DC
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1407
+ADDRLP4 36
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1408
+JUMPV
+LABELV $1407
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1408
+LABELV $1403
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTU4 0
+ASGNU4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $1412
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+EQI4 $1412
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $1412
+ADDRLP4 52
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+EQI4 $1412
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1414
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $1414
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1414
+LABELV $1412
+LABELV $1401
+endproc Item_TextColor 64 28
+proc Item_Text_AutoWrapped_Paint 2132 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1417
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1419
+ADDRGP4 $1416
+JUMPV
+LABELV $1419
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1056
+ADDRLP4 1080
+ASGNP4
+ADDRGP4 $1418
+JUMPV
+LABELV $1417
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1418
+ADDRLP4 1056
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1421
+ADDRGP4 $1416
+JUMPV
+LABELV $1421
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2104
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2104
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+ADDRLP4 2104
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRGP4 $1424
+JUMPV
+LABELV $1423
+ADDRLP4 2108
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 32
+EQI4 $1430
+ADDRLP4 2108
+INDIRI4
+CNSTI4 9
+EQI4 $1430
+ADDRLP4 2108
+INDIRI4
+CNSTI4 10
+EQI4 $1430
+ADDRLP4 2108
+INDIRI4
+CNSTI4 0
+NEI4 $1426
+LABELV $1430
+ADDRLP4 1036
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $1426
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 2112
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 2112
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $1434
+ADDRLP4 1032
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GTF4 $1435
+LABELV $1434
+ADDRLP4 2116
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2116
+INDIRI4
+CNSTI4 10
+EQI4 $1435
+ADDRLP4 2116
+INDIRI4
+CNSTI4 0
+NEI4 $1431
+LABELV $1435
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $1436
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1438
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1439
+JUMPV
+LABELV $1438
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1440
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $1441
+JUMPV
+LABELV $1440
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1442
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ASGNF4
+LABELV $1442
+LABELV $1441
+LABELV $1439
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1048
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1060
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1436
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1444
+ADDRGP4 $1425
+JUMPV
+LABELV $1444
+ADDRLP4 1048
+ADDRLP4 1048
+INDIRF4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 5
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRGP4 $1424
+JUMPV
+LABELV $1431
+ADDRLP4 2120
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRLP4 2128
+CNSTI4 1
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2120
+INDIRI4
+ADDRLP4 2128
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 2124
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2124
+INDIRP4
+ADDRLP4 2128
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2120
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 2124
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1424
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1423
+LABELV $1425
+LABELV $1416
+endproc Item_Text_AutoWrapped_Paint 2132 32
+proc Item_Text_Wrapped_Paint 2124 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1447
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1449
+ADDRGP4 $1446
+JUMPV
+LABELV $1449
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1060
+ADDRLP4 1068
+ASGNP4
+ADDRGP4 $1448
+JUMPV
+LABELV $1447
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1448
+ADDRLP4 1060
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1451
+ADDRGP4 $1446
+JUMPV
+LABELV $1451
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2100
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2100
+INDIRP4
+ASGNP4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRF4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 5
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2120
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2120
+INDIRP4
+ASGNP4
+LABELV $1454
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1456
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1453
+LABELV $1456
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1446
+endproc Item_Text_Wrapped_Paint 2124 32
+proc Item_Text_Paint 1056 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $1458
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Wrapped_Paint
+CALLV
+pop
+ADDRGP4 $1457
+JUMPV
+LABELV $1458
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $1460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_AutoWrapped_Paint
+CALLV
+pop
+ADDRGP4 $1457
+JUMPV
+LABELV $1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1462
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1464
+ADDRGP4 $1457
+JUMPV
+LABELV $1464
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 28
+ASGNP4
+ADDRGP4 $1463
+JUMPV
+LABELV $1462
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1463
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1466
+ADDRGP4 $1457
+JUMPV
+LABELV $1466
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1457
+endproc Item_Text_Paint 1056 32
+proc Item_TextField_Paint 1108 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1469
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1469
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1471
+ADDRLP4 1076
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+4
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 1084
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 1084
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1472
+JUMPV
+LABELV $1471
+ADDRLP4 1048
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1472
+ADDRLP4 1080
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1477
+ADDRLP4 1080
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1477
+ADDRLP4 1076
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1478
+JUMPV
+LABELV $1477
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+LABELV $1478
+ADDRLP4 1064
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 1084
+INDIRI4
+EQI4 $1479
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 1084
+INDIRI4
+EQI4 $1479
+ADDRLP4 1092
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+EQI4 $1482
+ADDRLP4 1088
+CNSTI4 95
+ASGNI4
+ADDRGP4 $1483
+JUMPV
+LABELV $1482
+ADDRLP4 1088
+CNSTI4 124
+ASGNI4
+LABELV $1483
+ADDRLP4 1068
+ADDRLP4 1088
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1104
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1104
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 1068
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1480
+JUMPV
+LABELV $1479
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1480
+LABELV $1468
+endproc Item_TextField_Paint 1108 36
+proc Item_YesNo_Paint 64 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1486
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 $1487
+JUMPV
+LABELV $1486
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+LABELV $1487
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1488
+ADDRLP4 52
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 60
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1488
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1489
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1493
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1498
+ADDRLP4 52
+ADDRGP4 $1495
+ASGNP4
+ADDRGP4 $1499
+JUMPV
+LABELV $1498
+ADDRLP4 52
+ADDRGP4 $1496
+ASGNP4
+LABELV $1499
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1494
+JUMPV
+LABELV $1493
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1501
+ADDRLP4 52
+ADDRGP4 $1495
+ASGNP4
+ADDRGP4 $1502
+JUMPV
+LABELV $1501
+ADDRLP4 52
+ADDRGP4 $1496
+ASGNP4
+LABELV $1502
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1494
+LABELV $1484
+endproc Item_YesNo_Paint 64 32
+proc Item_Multi_Paint 56 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $59
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1504
+ADDRLP4 44
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1505
+JUMPV
+LABELV $1504
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1505
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Item_Multi_Setting
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1510
+JUMPV
+LABELV $1509
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1510
+LABELV $1503
+endproc Item_Multi_Paint 56 32
+data
+align 4
+LABELV g_bindings
+address $1513
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1514
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1515
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1516
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1517
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1518
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1519
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1520
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1521
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1522
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1523
+byte 4 135
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1524
+byte 4 136
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1525
+byte 4 141
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1526
+byte 4 140
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1527
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1528
+byte 4 144
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1529
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1530
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1531
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1532
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1533
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1534
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1535
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1536
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1537
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1538
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1539
+byte 4 48
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1540
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1541
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1542
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1543
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1544
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1545
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1546
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1547
+byte 4 181
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1548
+byte 4 119
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1549
+byte 4 114
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1550
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1551
+byte 4 121
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1552
+byte 4 110
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1553
+byte 4 111
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1554
+byte 4 100
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1555
+byte 4 112
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1556
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1557
+byte 4 102
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1558
+byte 4 118
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1559
+byte 4 101
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1560
+byte 4 105
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1561
+byte 4 107
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1562
+byte 4 145
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1563
+byte 4 146
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1564
+byte 4 147
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1565
+byte 4 148
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1566
+byte 4 149
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1567
+byte 4 162
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1568
+byte 4 168
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1569
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1570
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1571
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1572
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+lit
+align 4
+LABELV g_bindCount
+byte 4 60
+code
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $1574
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1578
+ADDRGP4 $1575
+JUMPV
+LABELV $1578
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $1580
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $1582
+ADDRGP4 $1576
+JUMPV
+LABELV $1582
+LABELV $1580
+LABELV $1575
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1574
+LABELV $1576
+LABELV $1573
+endproc Controls_GetKeyAssignment 280 12
+export Controls_GetConfig
+proc Controls_GetConfig 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1588
+JUMPV
+LABELV $1585
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $1586
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1588
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1585
+LABELV $1584
+endproc Controls_GetConfig 12 8
+export Controls_SetConfig
+proc Controls_SetConfig 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1596
+JUMPV
+LABELV $1593
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1597
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1601
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1601
+LABELV $1597
+LABELV $1594
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1596
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1593
+CNSTI4 2
+ARGI4
+ADDRGP4 $1605
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1592
+endproc Controls_SetConfig 12 8
+export Controls_SetDefaults
+proc Controls_SetDefaults 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1607
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1608
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1610
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1607
+LABELV $1606
+endproc Controls_SetDefaults 12 0
+proc BindingIDFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1619
+JUMPV
+LABELV $1616
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1620
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1615
+JUMPV
+LABELV $1620
+LABELV $1617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1619
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1616
+CNSTI4 -1
+RETI4
+LABELV $1615
+endproc BindingIDFromName 8 8
+proc BindingFromName 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1626
+JUMPV
+LABELV $1623
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1627
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1630
+ADDRGP4 $1625
+JUMPV
+LABELV $1630
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1622
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind2
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1635
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 $1622
+JUMPV
+LABELV $1627
+LABELV $1624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1626
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1623
+LABELV $1625
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1636
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1622
+endproc BindingFromName 16 12
+proc Item_Slider_Paint 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1638
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 12
+ADDRLP4 48
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1639
+JUMPV
+LABELV $1638
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1639
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1644
+JUMPV
+LABELV $1643
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1644
+ADDRLP4 28
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1119879168
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 61964
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 60
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 61968
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1637
+endproc Item_Slider_Paint 64 20
+proc Item_Bind_Paint 56 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1646
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1646
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1648
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $1650
+ADDRLP4 0
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ASGNF4
+ADDRGP4 $1651
+JUMPV
+LABELV $1650
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 52
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRLP4 16
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ADDRLP4 16
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1651
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1649
+JUMPV
+LABELV $1648
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1649
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1658
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BindingFromName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1659
+JUMPV
+LABELV $1658
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 $1660
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1659
+LABELV $1645
+endproc Item_Bind_Paint 56 32
+export Display_KeyBindPending
+proc Display_KeyBindPending 0 0
+ADDRGP4 g_waitingForKey
+INDIRI4
+RETI4
+LABELV $1661
+endproc Display_KeyBindPending 0 0
+proc Item_Bind_HandleKey 20 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+NEI4 $1663
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1665
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+NEI4 $1668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1673
+LABELV $1668
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1673
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $1673
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+EQI4 $1673
+ADDRFP4 4
+INDIRI4
+CNSTI4 186
+EQI4 $1673
+ADDRFP4 4
+INDIRI4
+CNSTI4 187
+EQI4 $1673
+ADDRFP4 4
+INDIRI4
+CNSTI4 188
+NEI4 $1665
+LABELV $1673
+ADDRGP4 g_waitingForKey
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_bindItem
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1665
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1663
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1674
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1674
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1676
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1676
+ADDRLP4 12
+CNSTI4 96
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1694
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $1696
+LABELV $1695
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+EQI4 $1680
+ADDRGP4 $1678
+JUMPV
+LABELV $1696
+ADDRFP4 4
+INDIRI4
+CNSTI4 127
+EQI4 $1681
+ADDRGP4 $1678
+JUMPV
+LABELV $1680
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1681
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1682
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1684
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1684
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1689
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1689
+LABELV $1682
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_bindItem
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1694
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1678
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1697
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1702
+JUMPV
+LABELV $1699
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1703
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1703
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1707
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1707
+LABELV $1700
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1702
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1699
+LABELV $1697
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1713
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1715
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1717
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1717
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1716
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1716
+JUMPV
+LABELV $1715
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1727
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1728
+JUMPV
+LABELV $1727
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1731
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1731
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1731
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1732
+LABELV $1728
+LABELV $1716
+LABELV $1713
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1662
+endproc Item_Bind_HandleKey 20 12
+proc Item_Model_Paint 712 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 612
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 612
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1741
+ADDRGP4 $1740
+JUMPV
+LABELV $1741
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 440
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 688
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 672
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 688
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 676
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 688
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 692
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 692
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 672
+ARGP4
+ADDRLP4 676
+ARGP4
+ADDRLP4 640
+ARGP4
+ADDRLP4 644
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 672
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 676
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 640
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 644
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 648
+ARGP4
+ADDRLP4 660
+ARGP4
+ADDRLP4 696
+CNSTI4 0
+ASGNI4
+ADDRLP4 696
+INDIRI4
+ARGI4
+ADDRLP4 696
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRLP4 616+8
+CNSTF4 3204448256
+ADDRLP4 648+8
+INDIRF4
+ADDRLP4 660+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 616+4
+CNSTF4 1056964608
+ADDRLP4 648+4
+INDIRF4
+ADDRLP4 660+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 680
+CNSTF4 1056964608
+ADDRLP4 660+8
+INDIRF4
+ADDRLP4 648+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 616
+ADDRLP4 680
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 $1755
+JUMPV
+LABELV $1754
+ADDRLP4 616
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1755
+ADDRLP4 612
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1760
+ADDRLP4 700
+ADDRLP4 612
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1761
+JUMPV
+LABELV $1760
+ADDRLP4 700
+ADDRLP4 640
+INDIRF4
+ASGNF4
+LABELV $1761
+ADDRLP4 0+16
+ADDRLP4 700
+INDIRF4
+ASGNF4
+ADDRLP4 612
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1764
+ADDRLP4 704
+ADDRLP4 612
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1765
+JUMPV
+LABELV $1764
+ADDRLP4 704
+ADDRLP4 644
+INDIRF4
+ASGNF4
+LABELV $1765
+ADDRLP4 0+20
+ADDRLP4 704
+INDIRF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0+72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 440
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 612
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1767
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $1769
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 612
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 612
+INDIRP4
+ADDRLP4 612
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 360
+MODI4
+ASGNI4
+LABELV $1769
+LABELV $1767
+ADDRLP4 628
+CNSTF4 0
+ASGNF4
+ADDRLP4 628+4
+ADDRLP4 612
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 628+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 628
+ARGP4
+ADDRLP4 440+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 440+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 440+68
+ADDRLP4 616
+INDIRB
+ASGNB 12
+ADDRLP4 440+12
+ADDRLP4 616
+INDIRB
+ASGNB 12
+ADDRLP4 440+4
+CNSTI4 192
+ASGNI4
+ADDRLP4 440+88
+ADDRLP4 440+68
+INDIRB
+ASGNB 12
+ADDRLP4 440
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1740
+endproc Item_Model_Paint 712 24
+export Item_Image_Paint
+proc Item_Image_Paint 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1781
+ADDRGP4 $1780
+JUMPV
+LABELV $1781
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+CNSTF4 1073741824
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1780
+endproc Item_Image_Paint 16 20
+proc Item_ListBox_Paint 120 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1784
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 61936
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 68
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 61944
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 61940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $1786
+ADDRLP4 40
+ADDRLP4 20
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $1786
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 84
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 61948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1785
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1793
+JUMPV
+LABELV $1790
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1794
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 116
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1794
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+NEI4 $1796
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1796
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+GEF4 $1798
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1785
+JUMPV
+LABELV $1798
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1791
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1793
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1790
+ADDRGP4 $1785
+JUMPV
+LABELV $1784
+ADDRLP4 56
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 61928
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 61944
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 76
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 61932
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $1800
+ADDRLP4 40
+ADDRLP4 16
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $1800
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CNSTI4 61948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1802
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1807
+JUMPV
+LABELV $1804
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1808
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 116
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1808
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+NEI4 $1810
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1810
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GEF4 $1812
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1803
+JUMPV
+LABELV $1812
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1805
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1807
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1804
+ADDRGP4 $1803
+JUMPV
+LABELV $1802
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1817
+JUMPV
+LABELV $1814
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1818
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1820
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 104
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1824
+ADDRLP4 112
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 116
+ADDRLP4 112
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1825
+JUMPV
+LABELV $1824
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1826
+ADDRLP4 112
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 112
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1826
+LABELV $1825
+LABELV $1821
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1823
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+LTI4 $1820
+ADDRGP4 $1819
+JUMPV
+LABELV $1818
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 104
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1828
+ADDRGP4 $1829
+JUMPV
+LABELV $1828
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1830
+ADDRLP4 20
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1830
+LABELV $1829
+LABELV $1819
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+NEI4 $1832
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1832
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+GEF4 $1834
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1834
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1815
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1817
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1814
+LABELV $1816
+LABELV $1803
+LABELV $1785
+LABELV $1783
+endproc Item_ListBox_Paint 120 32
+proc Item_OwnerDraw_Paint 72 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1837
+ADDRGP4 $1836
+JUMPV
+LABELV $1837
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1839
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1841
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1841
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1846
+JUMPV
+LABELV $1843
+ADDRLP4 60
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+LTF4 $1847
+ADDRLP4 4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GTF4 $1847
+ADDRLP4 8
+ARGP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $1845
+JUMPV
+LABELV $1847
+LABELV $1844
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1846
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+LTI4 $1843
+LABELV $1845
+LABELV $1841
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1849
+ADDRLP4 52
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 1061997773
+ADDRLP4 24
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1061997773
+ADDRLP4 24
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 60
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1850
+JUMPV
+LABELV $1849
+ADDRLP4 52
+CNSTI4 220
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $1854
+ADDRGP4 DC
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 56
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1854
+ADDRLP4 60
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 28
+ADDRLP4 60
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 60
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 68
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+LABELV $1854
+LABELV $1850
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1859
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1859
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1859
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1863
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1862
+JUMPV
+LABELV $1863
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1862
+JUMPV
+LABELV $1861
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1862
+LABELV $1839
+LABELV $1836
+endproc Item_OwnerDraw_Paint 72 56
+proc Item_Paint 104 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1869
+ADDRGP4 $1865
+JUMPV
+LABELV $1869
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $1871
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $1873
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 44
+ADDRLP4 68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1029076816
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $1873
+LABELV $1871
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1875
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $1877
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEF4 $1879
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1880
+JUMPV
+LABELV $1879
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+GEF4 $1881
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+LEF4 $1882
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1882
+JUMPV
+LABELV $1881
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+GEF4 $1885
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1885
+LABELV $1882
+LABELV $1880
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEF4 $1887
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1887
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $1889
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+LEF4 $1890
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1890
+JUMPV
+LABELV $1889
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $1893
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1893
+LABELV $1890
+LABELV $1888
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+NEF4 $1895
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1896
+JUMPV
+LABELV $1895
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $1897
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $1898
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1898
+JUMPV
+LABELV $1897
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $1901
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1901
+LABELV $1898
+LABELV $1896
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+NEF4 $1903
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1904
+JUMPV
+LABELV $1903
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $1905
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+LEF4 $1906
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1906
+JUMPV
+LABELV $1905
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $1909
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1909
+LABELV $1906
+LABELV $1904
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+NEI4 $1911
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $1911
+LABELV $1877
+LABELV $1875
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1913
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1913
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1915
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $1916
+JUMPV
+LABELV $1915
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $1916
+LABELV $1913
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $1917
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1919
+ADDRGP4 $1865
+JUMPV
+LABELV $1919
+LABELV $1917
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $1921
+LABELV $1921
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1923
+ADDRGP4 $1865
+JUMPV
+LABELV $1923
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $1925
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68+12
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 68
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1925
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+LTI4 $1931
+ADDRLP4 68
+INDIRI4
+CNSTI4 13
+GTI4 $1931
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1945
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1945
+address $1934
+address $1934
+address $1931
+address $1931
+address $1937
+address $1931
+address $1939
+address $1940
+address $1933
+address $1937
+address $1944
+address $1941
+address $1942
+address $1943
+code
+LABELV $1933
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_OwnerDraw_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1937
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_TextField_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ListBox_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1940
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Model_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1941
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_YesNo_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1942
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Multi_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1943
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Bind_Paint
+CALLV
+pop
+ADDRGP4 $1931
+JUMPV
+LABELV $1944
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Slider_Paint
+CALLV
+pop
+LABELV $1931
+LABELV $1865
+endproc Item_Paint 104 24
+proc Menu_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 656
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61996
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61988
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61992
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $1946
+endproc Menu_Init 0 12
+export Menu_GetFocusedItem
+proc Menu_GetFocusedItem 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1948
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1950
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1954
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1947
+JUMPV
+LABELV $1954
+LABELV $1951
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1953
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1950
+LABELV $1948
+CNSTP4 0
+RETP4
+LABELV $1947
+endproc Menu_GetFocusedItem 8 0
+export Menu_GetFocused
+proc Menu_GetFocused 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1960
+JUMPV
+LABELV $1957
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1961
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1961
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $1956
+JUMPV
+LABELV $1961
+LABELV $1958
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1960
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1957
+CNSTP4 0
+RETP4
+LABELV $1956
+endproc Menu_GetFocused 12 0
+export Menu_ScrollFeeder
+proc Menu_ScrollFeeder 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1966
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1971
+JUMPV
+LABELV $1968
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $1972
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1975
+ADDRLP4 4
+CNSTI4 133
+ASGNI4
+ADDRGP4 $1976
+JUMPV
+LABELV $1975
+ADDRLP4 4
+CNSTI4 132
+ASGNI4
+LABELV $1976
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRGP4 $1965
+JUMPV
+LABELV $1972
+LABELV $1969
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1971
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1968
+LABELV $1966
+LABELV $1965
+endproc Menu_ScrollFeeder 12 16
+export Menu_SetFeederSelection
+proc Menu_SetFeederSelection 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1978
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1980
+ADDRLP4 4
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1981
+JUMPV
+LABELV $1980
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1981
+LABELV $1978
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1982
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1984
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $1988
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1990
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1990
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1977
+JUMPV
+LABELV $1988
+LABELV $1985
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1987
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1984
+LABELV $1982
+LABELV $1977
+endproc Menu_SetFeederSelection 8 8
+export Menu_SetScreenPlacement
+proc Menu_SetScreenPlacement 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1993
+ADDRGP4 $1992
+JUMPV
+LABELV $1993
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1995
+ADDRGP4 $1997
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $1992
+JUMPV
+LABELV $1995
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $1992
+endproc Menu_SetScreenPlacement 0 4
+export Menus_AnyFullScreenVisible
+proc Menus_AnyFullScreenVisible 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2002
+JUMPV
+LABELV $1999
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2003
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+184
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2003
+CNSTI4 1
+RETI4
+ADDRGP4 $1998
+JUMPV
+LABELV $2003
+LABELV $2000
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2002
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1999
+CNSTI4 0
+RETI4
+LABELV $1998
+endproc Menus_AnyFullScreenVisible 12 0
+export Menus_ActivateByName
+proc Menus_ActivateByName 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2011
+JUMPV
+LABELV $2008
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2012
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+ADDRGP4 openMenuCount
+INDIRI4
+CNSTI4 16
+GEI4 $2013
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2013
+ADDRLP4 24
+ADDRGP4 openMenuCount
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 menuStack
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $2013
+JUMPV
+LABELV $2012
+ADDRLP4 20
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $2013
+LABELV $2009
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2011
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2008
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $2007
+endproc Menus_ActivateByName 28 8
+proc Item_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2019
+ADDRGP4 $2018
+JUMPV
+LABELV $2019
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+CNSTF4 1057803469
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2018
+endproc Item_Init 0 12
+export Menu_HandleMouseMove
+proc Menu_HandleMouseMove 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2022
+ADDRGP4 $2021
+JUMPV
+LABELV $2022
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2024
+ADDRGP4 $2021
+JUMPV
+LABELV $2024
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2026
+ADDRGP4 $2021
+JUMPV
+LABELV $2026
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2030
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2028
+LABELV $2030
+ADDRGP4 $2021
+JUMPV
+LABELV $2028
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2031
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2038
+JUMPV
+LABELV $2035
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2039
+ADDRGP4 $2036
+JUMPV
+LABELV $2039
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2041
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2041
+ADDRGP4 $2036
+JUMPV
+LABELV $2041
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2043
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2043
+ADDRGP4 $2036
+JUMPV
+LABELV $2043
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2045
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $2046
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2049
+ADDRLP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2049
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $2051
+ADDRGP4 $2036
+JUMPV
+LABELV $2051
+LABELV $2049
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 IsVisible
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2046
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_MouseEnter
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2046
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $2046
+JUMPV
+LABELV $2045
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2057
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2057
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_MouseLeave
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_SetMouseOver
+CALLV
+pop
+LABELV $2057
+LABELV $2046
+LABELV $2036
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2038
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2035
+LABELV $2032
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LTI4 $2031
+LABELV $2021
+endproc Menu_HandleMouseMove 52 12
+export Menu_Paint
+proc Menu_Paint 48 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2060
+ADDRGP4 $2059
+JUMPV
+LABELV $2060
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2062
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2062
+ADDRGP4 $2059
+JUMPV
+LABELV $2062
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2064
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2064
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2064
+ADDRGP4 $2059
+JUMPV
+LABELV $2064
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2066
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1048576
+BORI4
+ASGNI4
+LABELV $2066
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2068
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2068
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2070
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2071
+JUMPV
+LABELV $2070
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2072
+LABELV $2072
+LABELV $2071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2077
+JUMPV
+LABELV $2074
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Paint
+CALLV
+pop
+LABELV $2075
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2077
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2074
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2078
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2078
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2083
+ADDRGP4 DC
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2083
+LABELV $2059
+endproc Menu_Paint 48 24
+proc Item_ValidateTypeData 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2086
+ADDRGP4 $2085
+JUMPV
+LABELV $2086
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2088
+CNSTI4 232
+ARGI4
+ADDRLP4 0
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 232
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $2089
+JUMPV
+LABELV $2088
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $2096
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $2096
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $2096
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $2096
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2096
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2090
+LABELV $2096
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 28
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2091
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2091
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRGP4 $2091
+JUMPV
+LABELV $2090
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $2101
+CNSTI4 396
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2102
+JUMPV
+LABELV $2101
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2103
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $2103
+LABELV $2102
+LABELV $2091
+LABELV $2089
+LABELV $2085
+endproc Item_ValidateTypeData 8 12
+proc KeywordHash_Key 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2109
+JUMPV
+LABELV $2106
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $2110
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+GTI4 $2110
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $2111
+JUMPV
+LABELV $2110
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $2111
+LABELV $2107
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2109
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2106
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+RSHI4
+BXORI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+RSHI4
+BXORI4
+CNSTI4 511
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $2105
+endproc KeywordHash_Key 20 0
+proc KeywordHash_Add 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $2112
+endproc KeywordHash_Add 8 4
+export KeywordHash_Find
+proc KeywordHash_Find 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2117
+JUMPV
+LABELV $2114
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2118
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2113
+JUMPV
+LABELV $2118
+LABELV $2115
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2117
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2114
+CNSTP4 0
+RETP4
+LABELV $2113
+endproc KeywordHash_Find 16 8
+proc ItemParse_name 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2121
+CNSTI4 0
+RETI4
+ADDRGP4 $2120
+JUMPV
+LABELV $2121
+CNSTI4 1
+RETI4
+LABELV $2120
+endproc ItemParse_name 4 8
+proc ItemParse_focusSound 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2124
+CNSTI4 0
+RETI4
+ADDRGP4 $2123
+JUMPV
+LABELV $2124
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2123
+endproc ItemParse_focusSound 12 8
+proc ItemParse_text 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2127
+CNSTI4 0
+RETI4
+ADDRGP4 $2126
+JUMPV
+LABELV $2127
+CNSTI4 1
+RETI4
+LABELV $2126
+endproc ItemParse_text 4 8
+proc ItemParse_group 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2130
+CNSTI4 0
+RETI4
+ADDRGP4 $2129
+JUMPV
+LABELV $2130
+CNSTI4 1
+RETI4
+LABELV $2129
+endproc ItemParse_group 4 8
+proc ItemParse_asset_model 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2133
+CNSTI4 0
+RETI4
+ADDRGP4 $2132
+JUMPV
+LABELV $2133
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 360
+MODI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2132
+endproc ItemParse_asset_model 20 8
+proc ItemParse_asset_shader 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2136
+CNSTI4 0
+RETI4
+ADDRGP4 $2135
+JUMPV
+LABELV $2136
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2135
+endproc ItemParse_asset_shader 12 8
+proc ItemParse_model_origin 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2139
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2141
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2143
+CNSTI4 1
+RETI4
+ADDRGP4 $2138
+JUMPV
+LABELV $2143
+LABELV $2141
+LABELV $2139
+CNSTI4 0
+RETI4
+LABELV $2138
+endproc ItemParse_model_origin 16 8
+proc ItemParse_model_fovx 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2146
+CNSTI4 0
+RETI4
+ADDRGP4 $2145
+JUMPV
+LABELV $2146
+CNSTI4 1
+RETI4
+LABELV $2145
+endproc ItemParse_model_fovx 8 8
+proc ItemParse_model_fovy 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2149
+CNSTI4 0
+RETI4
+ADDRGP4 $2148
+JUMPV
+LABELV $2149
+CNSTI4 1
+RETI4
+LABELV $2148
+endproc ItemParse_model_fovy 8 8
+proc ItemParse_model_rotation 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2152
+CNSTI4 0
+RETI4
+ADDRGP4 $2151
+JUMPV
+LABELV $2152
+CNSTI4 1
+RETI4
+LABELV $2151
+endproc ItemParse_model_rotation 8 8
+proc ItemParse_model_angle 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2155
+CNSTI4 0
+RETI4
+ADDRGP4 $2154
+JUMPV
+LABELV $2155
+CNSTI4 1
+RETI4
+LABELV $2154
+endproc ItemParse_model_angle 8 8
+proc ItemParse_rect 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2158
+CNSTI4 0
+RETI4
+ADDRGP4 $2157
+JUMPV
+LABELV $2158
+CNSTI4 1
+RETI4
+LABELV $2157
+endproc ItemParse_rect 4 8
+proc ItemParse_style 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2161
+CNSTI4 0
+RETI4
+ADDRGP4 $2160
+JUMPV
+LABELV $2161
+CNSTI4 1
+RETI4
+LABELV $2160
+endproc ItemParse_style 4 8
+proc ItemParse_decoration 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2163
+endproc ItemParse_decoration 4 0
+proc ItemParse_notselectable 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2165
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2165
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2165
+CNSTI4 1
+RETI4
+LABELV $2164
+endproc ItemParse_notselectable 4 4
+proc ItemParse_wrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 262144
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2167
+endproc ItemParse_wrapped 4 0
+proc ItemParse_autowrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2168
+endproc ItemParse_autowrapped 4 0
+proc ItemParse_horizontalscroll 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2169
+endproc ItemParse_horizontalscroll 4 0
+proc ItemParse_type 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2171
+CNSTI4 0
+RETI4
+ADDRGP4 $2170
+JUMPV
+LABELV $2171
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2170
+endproc ItemParse_type 4 8
+proc ItemParse_elementwidth 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2174
+CNSTI4 0
+RETI4
+ADDRGP4 $2173
+JUMPV
+LABELV $2174
+CNSTI4 1
+RETI4
+LABELV $2173
+endproc ItemParse_elementwidth 8 8
+proc ItemParse_elementheight 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2177
+CNSTI4 0
+RETI4
+ADDRGP4 $2176
+JUMPV
+LABELV $2177
+CNSTI4 1
+RETI4
+LABELV $2176
+endproc ItemParse_elementheight 8 8
+proc ItemParse_feeder 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2180
+CNSTI4 0
+RETI4
+ADDRGP4 $2179
+JUMPV
+LABELV $2180
+CNSTI4 1
+RETI4
+LABELV $2179
+endproc ItemParse_feeder 4 8
+proc ItemParse_elementtype 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2183
+CNSTI4 0
+RETI4
+ADDRGP4 $2182
+JUMPV
+LABELV $2183
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2185
+CNSTI4 0
+RETI4
+ADDRGP4 $2182
+JUMPV
+LABELV $2185
+CNSTI4 1
+RETI4
+LABELV $2182
+endproc ItemParse_elementtype 8 8
+proc ItemParse_columns 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2188
+CNSTI4 0
+RETI4
+ADDRGP4 $2187
+JUMPV
+LABELV $2188
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 24
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2190
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+LEI4 $2192
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+LABELV $2192
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2197
+JUMPV
+LABELV $2194
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2198
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2198
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 36
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2198
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2199
+JUMPV
+LABELV $2198
+CNSTI4 0
+RETI4
+ADDRGP4 $2187
+JUMPV
+LABELV $2199
+LABELV $2195
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2197
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $2194
+ADDRGP4 $2191
+JUMPV
+LABELV $2190
+CNSTI4 0
+RETI4
+ADDRGP4 $2187
+JUMPV
+LABELV $2191
+CNSTI4 1
+RETI4
+LABELV $2187
+endproc ItemParse_columns 40 8
+proc ItemParse_border 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2201
+CNSTI4 0
+RETI4
+ADDRGP4 $2200
+JUMPV
+LABELV $2201
+CNSTI4 1
+RETI4
+LABELV $2200
+endproc ItemParse_border 4 8
+proc ItemParse_bordersize 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2204
+CNSTI4 0
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2204
+CNSTI4 1
+RETI4
+LABELV $2203
+endproc ItemParse_bordersize 4 8
+proc ItemParse_visible 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2207
+CNSTI4 0
+RETI4
+ADDRGP4 $2206
+JUMPV
+LABELV $2207
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2209
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2209
+CNSTI4 1
+RETI4
+LABELV $2206
+endproc ItemParse_visible 12 8
+proc ItemParse_ownerdraw 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2212
+CNSTI4 0
+RETI4
+ADDRGP4 $2211
+JUMPV
+LABELV $2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2211
+endproc ItemParse_ownerdraw 4 8
+proc ItemParse_align 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2215
+CNSTI4 0
+RETI4
+ADDRGP4 $2214
+JUMPV
+LABELV $2215
+CNSTI4 1
+RETI4
+LABELV $2214
+endproc ItemParse_align 4 8
+proc ItemParse_textalign 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2218
+CNSTI4 0
+RETI4
+ADDRGP4 $2217
+JUMPV
+LABELV $2218
+CNSTI4 1
+RETI4
+LABELV $2217
+endproc ItemParse_textalign 4 8
+proc ItemParse_textalignx 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2221
+CNSTI4 0
+RETI4
+ADDRGP4 $2220
+JUMPV
+LABELV $2221
+CNSTI4 1
+RETI4
+LABELV $2220
+endproc ItemParse_textalignx 4 8
+proc ItemParse_textaligny 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2224
+CNSTI4 0
+RETI4
+ADDRGP4 $2223
+JUMPV
+LABELV $2224
+CNSTI4 1
+RETI4
+LABELV $2223
+endproc ItemParse_textaligny 4 8
+proc ItemParse_textscale 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2227
+CNSTI4 0
+RETI4
+ADDRGP4 $2226
+JUMPV
+LABELV $2227
+CNSTI4 1
+RETI4
+LABELV $2226
+endproc ItemParse_textscale 4 8
+proc ItemParse_textstyle 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2230
+CNSTI4 0
+RETI4
+ADDRGP4 $2229
+JUMPV
+LABELV $2230
+CNSTI4 1
+RETI4
+LABELV $2229
+endproc ItemParse_textstyle 4 8
+proc ItemParse_backcolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2233
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2237
+CNSTI4 0
+RETI4
+ADDRGP4 $2232
+JUMPV
+LABELV $2237
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2233
+CNSTI4 1
+RETI4
+LABELV $2232
+endproc ItemParse_backcolor 12 8
+proc ItemParse_forecolor 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2240
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2244
+CNSTI4 0
+RETI4
+ADDRGP4 $2239
+JUMPV
+LABELV $2244
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2241
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2240
+CNSTI4 1
+RETI4
+LABELV $2239
+endproc ItemParse_forecolor 16 8
+proc ItemParse_bordercolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2247
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2251
+CNSTI4 0
+RETI4
+ADDRGP4 $2246
+JUMPV
+LABELV $2251
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2248
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2247
+CNSTI4 1
+RETI4
+LABELV $2246
+endproc ItemParse_bordercolor 12 8
+proc ItemParse_outlinecolor 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2254
+CNSTI4 0
+RETI4
+ADDRGP4 $2253
+JUMPV
+LABELV $2254
+CNSTI4 1
+RETI4
+LABELV $2253
+endproc ItemParse_outlinecolor 4 8
+proc ItemParse_background 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2257
+CNSTI4 0
+RETI4
+ADDRGP4 $2256
+JUMPV
+LABELV $2257
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2256
+endproc ItemParse_background 12 8
+proc ItemParse_cinematic 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2260
+CNSTI4 0
+RETI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2260
+CNSTI4 1
+RETI4
+LABELV $2259
+endproc ItemParse_cinematic 4 8
+proc ItemParse_doubleClick 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2263
+CNSTI4 0
+RETI4
+ADDRGP4 $2262
+JUMPV
+LABELV $2263
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2265
+CNSTI4 0
+RETI4
+ADDRGP4 $2262
+JUMPV
+LABELV $2265
+CNSTI4 1
+RETI4
+LABELV $2262
+endproc ItemParse_doubleClick 8 8
+proc ItemParse_onFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2268
+CNSTI4 0
+RETI4
+ADDRGP4 $2267
+JUMPV
+LABELV $2268
+CNSTI4 1
+RETI4
+LABELV $2267
+endproc ItemParse_onFocus 4 8
+proc ItemParse_leaveFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2271
+CNSTI4 0
+RETI4
+ADDRGP4 $2270
+JUMPV
+LABELV $2271
+CNSTI4 1
+RETI4
+LABELV $2270
+endproc ItemParse_leaveFocus 4 8
+proc ItemParse_mouseEnter 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2274
+CNSTI4 0
+RETI4
+ADDRGP4 $2273
+JUMPV
+LABELV $2274
+CNSTI4 1
+RETI4
+LABELV $2273
+endproc ItemParse_mouseEnter 4 8
+proc ItemParse_mouseExit 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2277
+CNSTI4 0
+RETI4
+ADDRGP4 $2276
+JUMPV
+LABELV $2277
+CNSTI4 1
+RETI4
+LABELV $2276
+endproc ItemParse_mouseExit 4 8
+proc ItemParse_mouseEnterText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2280
+CNSTI4 0
+RETI4
+ADDRGP4 $2279
+JUMPV
+LABELV $2280
+CNSTI4 1
+RETI4
+LABELV $2279
+endproc ItemParse_mouseEnterText 4 8
+proc ItemParse_mouseExitText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2283
+CNSTI4 0
+RETI4
+ADDRGP4 $2282
+JUMPV
+LABELV $2283
+CNSTI4 1
+RETI4
+LABELV $2282
+endproc ItemParse_mouseExitText 4 8
+proc ItemParse_action 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2286
+CNSTI4 0
+RETI4
+ADDRGP4 $2285
+JUMPV
+LABELV $2286
+CNSTI4 1
+RETI4
+LABELV $2285
+endproc ItemParse_action 4 8
+proc ItemParse_special 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2289
+CNSTI4 0
+RETI4
+ADDRGP4 $2288
+JUMPV
+LABELV $2289
+CNSTI4 1
+RETI4
+LABELV $2288
+endproc ItemParse_special 4 8
+proc ItemParse_cvarTest 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2292
+CNSTI4 0
+RETI4
+ADDRGP4 $2291
+JUMPV
+LABELV $2292
+CNSTI4 1
+RETI4
+LABELV $2291
+endproc ItemParse_cvarTest 4 8
+proc ItemParse_cvar 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2295
+CNSTI4 0
+RETI4
+ADDRGP4 $2294
+JUMPV
+LABELV $2295
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2297
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $2297
+CNSTI4 1
+RETI4
+LABELV $2294
+endproc ItemParse_cvar 8 8
+proc ItemParse_maxChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2300
+CNSTI4 0
+RETI4
+ADDRGP4 $2299
+JUMPV
+LABELV $2300
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2302
+CNSTI4 0
+RETI4
+ADDRGP4 $2299
+JUMPV
+LABELV $2302
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2299
+endproc ItemParse_maxChars 12 8
+proc ItemParse_maxPaintChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2305
+CNSTI4 0
+RETI4
+ADDRGP4 $2304
+JUMPV
+LABELV $2305
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2307
+CNSTI4 0
+RETI4
+ADDRGP4 $2304
+JUMPV
+LABELV $2307
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2304
+endproc ItemParse_maxPaintChars 12 8
+proc ItemParse_cvarFloat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2310
+CNSTI4 0
+RETI4
+ADDRGP4 $2309
+JUMPV
+LABELV $2310
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2312
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2312
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2312
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2312
+CNSTI4 1
+RETI4
+ADDRGP4 $2309
+JUMPV
+LABELV $2312
+CNSTI4 0
+RETI4
+LABELV $2309
+endproc ItemParse_cvarFloat 20 8
+proc ItemParse_cvarStrList 1068 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2315
+CNSTI4 0
+RETI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2315
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2317
+CNSTI4 0
+RETI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2317
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2319
+CNSTI4 0
+RETI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2319
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2323
+JUMPV
+LABELV $2322
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2325
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2327
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2325
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2328
+CNSTI4 1
+RETI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2328
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2335
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2331
+LABELV $2335
+ADDRGP4 $2323
+JUMPV
+LABELV $2331
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2336
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2337
+JUMPV
+LABELV $2336
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2340
+CNSTI4 0
+RETI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2340
+LABELV $2337
+LABELV $2323
+ADDRGP4 $2322
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2314
+endproc ItemParse_cvarStrList 1068 8
+proc ItemParse_cvarFloatList 1072 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2343
+CNSTI4 0
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2343
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2345
+CNSTI4 0
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2345
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2351
+CNSTI4 0
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2350
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2353
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2327
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2353
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2355
+CNSTI4 1
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2355
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2362
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2358
+LABELV $2362
+ADDRGP4 $2351
+JUMPV
+LABELV $2358
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2364
+CNSTI4 0
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2364
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2366
+CNSTI4 0
+RETI4
+ADDRGP4 $2342
+JUMPV
+LABELV $2366
+LABELV $2351
+ADDRGP4 $2350
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2342
+endproc ItemParse_cvarFloatList 1072 8
+proc ItemParse_addColorRange 44 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 24
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2369
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2369
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2369
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $2373
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 24
+ADDRLP4 36
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2373
+CNSTI4 1
+RETI4
+ADDRGP4 $2368
+JUMPV
+LABELV $2369
+CNSTI4 0
+RETI4
+LABELV $2368
+endproc ItemParse_addColorRange 44 12
+proc ItemParse_ownerdrawFlag 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2376
+CNSTI4 0
+RETI4
+ADDRGP4 $2375
+JUMPV
+LABELV $2376
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2375
+endproc ItemParse_ownerdrawFlag 12 8
+proc ItemParse_enableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2379
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2378
+JUMPV
+LABELV $2379
+CNSTI4 0
+RETI4
+LABELV $2378
+endproc ItemParse_enableCvar 4 8
+proc ItemParse_disableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2382
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 2
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2381
+JUMPV
+LABELV $2382
+CNSTI4 0
+RETI4
+LABELV $2381
+endproc ItemParse_disableCvar 4 8
+proc ItemParse_showCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2385
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2384
+JUMPV
+LABELV $2385
+CNSTI4 0
+RETI4
+LABELV $2384
+endproc ItemParse_showCvar 4 8
+proc ItemParse_hideCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2388
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2387
+JUMPV
+LABELV $2388
+CNSTI4 0
+RETI4
+LABELV $2387
+endproc ItemParse_hideCvar 4 8
+data
+export itemParseKeywords
+align 4
+LABELV itemParseKeywords
+address $2390
+address ItemParse_name
+byte 4 0
+address $2391
+address ItemParse_text
+byte 4 0
+address $2392
+address ItemParse_group
+byte 4 0
+address $2393
+address ItemParse_asset_model
+byte 4 0
+address $2394
+address ItemParse_asset_shader
+byte 4 0
+address $2395
+address ItemParse_model_origin
+byte 4 0
+address $2396
+address ItemParse_model_fovx
+byte 4 0
+address $2397
+address ItemParse_model_fovy
+byte 4 0
+address $2398
+address ItemParse_model_rotation
+byte 4 0
+address $2399
+address ItemParse_model_angle
+byte 4 0
+address $2400
+address ItemParse_rect
+byte 4 0
+address $2401
+address ItemParse_style
+byte 4 0
+address $2402
+address ItemParse_decoration
+byte 4 0
+address $2403
+address ItemParse_notselectable
+byte 4 0
+address $2404
+address ItemParse_wrapped
+byte 4 0
+address $2405
+address ItemParse_autowrapped
+byte 4 0
+address $2406
+address ItemParse_horizontalscroll
+byte 4 0
+address $2407
+address ItemParse_type
+byte 4 0
+address $2408
+address ItemParse_elementwidth
+byte 4 0
+address $2409
+address ItemParse_elementheight
+byte 4 0
+address $2410
+address ItemParse_feeder
+byte 4 0
+address $2411
+address ItemParse_elementtype
+byte 4 0
+address $2412
+address ItemParse_columns
+byte 4 0
+address $2413
+address ItemParse_border
+byte 4 0
+address $2414
+address ItemParse_bordersize
+byte 4 0
+address $2415
+address ItemParse_visible
+byte 4 0
+address $2416
+address ItemParse_ownerdraw
+byte 4 0
+address $2417
+address ItemParse_align
+byte 4 0
+address $2418
+address ItemParse_textalign
+byte 4 0
+address $2419
+address ItemParse_textalignx
+byte 4 0
+address $2420
+address ItemParse_textaligny
+byte 4 0
+address $2421
+address ItemParse_textscale
+byte 4 0
+address $2422
+address ItemParse_textstyle
+byte 4 0
+address $365
+address ItemParse_backcolor
+byte 4 0
+address $368
+address ItemParse_forecolor
+byte 4 0
+address $371
+address ItemParse_bordercolor
+byte 4 0
+address $2423
+address ItemParse_outlinecolor
+byte 4 0
+address $2424
+address ItemParse_background
+byte 4 0
+address $2425
+address ItemParse_onFocus
+byte 4 0
+address $2426
+address ItemParse_leaveFocus
+byte 4 0
+address $2427
+address ItemParse_mouseEnter
+byte 4 0
+address $2428
+address ItemParse_mouseExit
+byte 4 0
+address $2429
+address ItemParse_mouseEnterText
+byte 4 0
+address $2430
+address ItemParse_mouseExitText
+byte 4 0
+address $2431
+address ItemParse_action
+byte 4 0
+address $2432
+address ItemParse_special
+byte 4 0
+address $2433
+address ItemParse_cvar
+byte 4 0
+address $2434
+address ItemParse_maxChars
+byte 4 0
+address $2435
+address ItemParse_maxPaintChars
+byte 4 0
+address $2436
+address ItemParse_focusSound
+byte 4 0
+address $2437
+address ItemParse_cvarFloat
+byte 4 0
+address $2438
+address ItemParse_cvarStrList
+byte 4 0
+address $2439
+address ItemParse_cvarFloatList
+byte 4 0
+address $2440
+address ItemParse_addColorRange
+byte 4 0
+address $2441
+address ItemParse_ownerdrawFlag
+byte 4 0
+address $2442
+address ItemParse_enableCvar
+byte 4 0
+address $2443
+address ItemParse_cvarTest
+byte 4 0
+address $2444
+address ItemParse_disableCvar
+byte 4 0
+address $2445
+address ItemParse_showCvar
+byte 4 0
+address $2446
+address ItemParse_hideCvar
+byte 4 0
+address $2447
+address ItemParse_cinematic
+byte 4 0
+address $2448
+address ItemParse_doubleClick
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc Item_SetupKeywordHash 4 12
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2453
+JUMPV
+LABELV $2450
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $2451
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2453
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2450
+LABELV $2449
+endproc Item_SetupKeywordHash 4 12
+data
+align 4
+LABELV builtinResolutions
+address $2454
+address $2455
+address $2456
+address $2457
+address $2458
+address $2459
+address $2460
+address $2461
+address $2462
+address $2463
+address $2464
+address $2465
+byte 4 0
+align 4
+LABELV knownRatios
+address $2466
+address $2467
+address $2468
+address $2469
+address $2470
+address $2471
+address $2472
+address $2473
+address $2474
+address $2475
+address $2476
+address $2477
+address $2478
+address $2479
+byte 4 0
+byte 4 0
+code
+proc UI_ResolutionToAspect 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+CNSTU4 8
+GEU4 $2482
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $2483
+JUMPV
+LABELV $2482
+ADDRLP4 24
+CNSTU4 8
+ASGNU4
+LABELV $2483
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 $2484
+ARGP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2488
+JUMPV
+LABELV $2485
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $2489
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2487
+JUMPV
+LABELV $2489
+LABELV $2486
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2488
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2485
+LABELV $2487
+LABELV $2480
+endproc UI_ResolutionToAspect 48 16
+proc Item_ApplyHacks 1188 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1108
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 1108
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1108
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2493
+ADDRLP4 1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2493
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 $2495
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $2493
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 48
+GEI4 $2496
+ADDRGP4 $2498
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 48
+ASGNI4
+LABELV $2496
+LABELV $2493
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2499
+ADDRLP4 1128
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2499
+ADDRLP4 1128
+INDIRP4
+ARGP4
+ADDRGP4 $2501
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+EQI4 $2503
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2502
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $2499
+LABELV $2503
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 32
+GEI4 $2504
+ADDRLP4 76
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $2506
+ADDRLP4 76
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2506
+ADDRGP4 $2508
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 76
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 32
+ASGNI4
+LABELV $2504
+LABELV $2499
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $2509
+ADDRLP4 1144
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2509
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRGP4 $989
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $2509
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDRGP4 $2511
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1152
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1104
+ADDRLP4 1152
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1152
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2512
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 80
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2513
+ADDRLP4 52
+ADDRLP4 80
+ASGNP4
+ADDRGP4 $2516
+JUMPV
+LABELV $2515
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1160
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 1160
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2518
+ADDRLP4 1164
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 1164
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1164
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $2518
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRGP4 UI_ResolutionToAspect
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2520
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1164
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1164
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2524
+JUMPV
+LABELV $2521
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $2525
+ADDRLP4 1180
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 1180
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1180
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2523
+JUMPV
+LABELV $2525
+LABELV $2522
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2524
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2521
+LABELV $2523
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2527
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1172
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1172
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $2527
+ADDRLP4 1172
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1172
+INDIRP4
+ADDRLP4 1172
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2516
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2529
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2515
+LABELV $2529
+ADDRGP4 $2514
+JUMPV
+LABELV $2513
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2533
+JUMPV
+LABELV $2530
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRGP4 UI_ResolutionToAspect
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2520
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1156
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1156
+INDIRP4
+ASGNP4
+ADDRLP4 1168
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 1168
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1168
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1176
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1176
+INDIRP4
+ADDRLP4 1176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2533
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2534
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2530
+LABELV $2534
+LABELV $2514
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+GEI4 $2535
+ADDRLP4 56
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 $2537
+ARGP4
+ADDRLP4 1156
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 1156
+INDIRP4
+CNSTI4 97988
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1156
+INDIRP4
+CNSTI4 97992
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2541
+JUMPV
+LABELV $2538
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $2542
+ADDRGP4 $2540
+JUMPV
+LABELV $2542
+LABELV $2539
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2541
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $2538
+LABELV $2540
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+NEI4 $2544
+ADDRLP4 56
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRGP4 UI_ResolutionToAspect
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2520
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1160
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1160
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 1168
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1168
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 1180
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1180
+INDIRP4
+ADDRLP4 1180
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2544
+LABELV $2535
+ADDRGP4 $2546
+ARGP4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2509
+LABELV $2492
+endproc Item_ApplyHacks 1188 20
+proc Item_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2548
+CNSTI4 0
+RETI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2548
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2554
+CNSTI4 0
+RETI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2553
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2556
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2327
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2556
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2558
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_ApplyHacks
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2558
+ADDRGP4 itemParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2562
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2564
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $2554
+JUMPV
+LABELV $2562
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2566
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2568
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2566
+LABELV $2554
+ADDRGP4 $2553
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2547
+endproc Item_Parse 1060 12
+proc Item_InitControls 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2571
+ADDRGP4 $2570
+JUMPV
+LABELV $2571
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2573
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2575
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2575
+LABELV $2573
+LABELV $2570
+endproc Item_InitControls 8 0
+proc MenuParse_font 12 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2578
+CNSTI4 0
+RETI4
+ADDRGP4 $2577
+JUMPV
+LABELV $2578
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62028
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2580
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62028
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2580
+CNSTI4 1
+RETI4
+LABELV $2577
+endproc MenuParse_font 12 20
+proc MenuParse_name 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2583
+CNSTI4 0
+RETI4
+ADDRGP4 $2582
+JUMPV
+LABELV $2583
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2587
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2585
+LABELV $2585
+CNSTI4 1
+RETI4
+LABELV $2582
+endproc MenuParse_name 12 8
+proc MenuParse_fullscreen 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2590
+CNSTI4 0
+RETI4
+ADDRGP4 $2588
+JUMPV
+LABELV $2590
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2588
+endproc MenuParse_fullscreen 12 8
+proc MenuParse_rect 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2593
+CNSTI4 0
+RETI4
+ADDRGP4 $2592
+JUMPV
+LABELV $2593
+CNSTI4 1
+RETI4
+LABELV $2592
+endproc MenuParse_rect 8 8
+proc MenuParse_style 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2596
+CNSTI4 0
+RETI4
+ADDRGP4 $2595
+JUMPV
+LABELV $2596
+CNSTI4 1
+RETI4
+LABELV $2595
+endproc MenuParse_style 8 8
+proc MenuParse_visible 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2599
+CNSTI4 0
+RETI4
+ADDRGP4 $2598
+JUMPV
+LABELV $2599
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2601
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2601
+CNSTI4 1
+RETI4
+LABELV $2598
+endproc MenuParse_visible 16 8
+proc MenuParse_onOpen 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2604
+CNSTI4 0
+RETI4
+ADDRGP4 $2603
+JUMPV
+LABELV $2604
+CNSTI4 1
+RETI4
+LABELV $2603
+endproc MenuParse_onOpen 8 8
+proc MenuParse_onClose 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2607
+CNSTI4 0
+RETI4
+ADDRGP4 $2606
+JUMPV
+LABELV $2607
+CNSTI4 1
+RETI4
+LABELV $2606
+endproc MenuParse_onClose 8 8
+proc MenuParse_onESC 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2610
+CNSTI4 0
+RETI4
+ADDRGP4 $2609
+JUMPV
+LABELV $2610
+CNSTI4 1
+RETI4
+LABELV $2609
+endproc MenuParse_onESC 8 8
+proc MenuParse_border 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2613
+CNSTI4 0
+RETI4
+ADDRGP4 $2612
+JUMPV
+LABELV $2613
+CNSTI4 1
+RETI4
+LABELV $2612
+endproc MenuParse_border 8 8
+proc MenuParse_borderSize 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2616
+CNSTI4 0
+RETI4
+ADDRGP4 $2615
+JUMPV
+LABELV $2616
+CNSTI4 1
+RETI4
+LABELV $2615
+endproc MenuParse_borderSize 8 8
+proc MenuParse_backcolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2619
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2623
+CNSTI4 0
+RETI4
+ADDRGP4 $2618
+JUMPV
+LABELV $2623
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2620
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2619
+CNSTI4 1
+RETI4
+LABELV $2618
+endproc MenuParse_backcolor 16 8
+proc MenuParse_forecolor 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2626
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2630
+CNSTI4 0
+RETI4
+ADDRGP4 $2625
+JUMPV
+LABELV $2630
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2627
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2626
+CNSTI4 1
+RETI4
+LABELV $2625
+endproc MenuParse_forecolor 20 8
+proc MenuParse_bordercolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2633
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2637
+CNSTI4 0
+RETI4
+ADDRGP4 $2632
+JUMPV
+LABELV $2637
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2634
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2633
+CNSTI4 1
+RETI4
+LABELV $2632
+endproc MenuParse_bordercolor 16 8
+proc MenuParse_focuscolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2640
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2644
+CNSTI4 0
+RETI4
+ADDRGP4 $2639
+JUMPV
+LABELV $2644
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2640
+CNSTI4 1
+RETI4
+LABELV $2639
+endproc MenuParse_focuscolor 16 8
+proc MenuParse_disablecolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2647
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2651
+CNSTI4 0
+RETI4
+ADDRGP4 $2646
+JUMPV
+LABELV $2651
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2648
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2647
+CNSTI4 1
+RETI4
+LABELV $2646
+endproc MenuParse_disablecolor 16 8
+proc MenuParse_outlinecolor 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2654
+CNSTI4 0
+RETI4
+ADDRGP4 $2653
+JUMPV
+LABELV $2654
+CNSTI4 1
+RETI4
+LABELV $2653
+endproc MenuParse_outlinecolor 8 8
+proc MenuParse_background 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2657
+CNSTI4 0
+RETI4
+ADDRGP4 $2656
+JUMPV
+LABELV $2657
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2656
+endproc MenuParse_background 16 8
+proc MenuParse_cinematic 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2660
+CNSTI4 0
+RETI4
+ADDRGP4 $2659
+JUMPV
+LABELV $2660
+CNSTI4 1
+RETI4
+LABELV $2659
+endproc MenuParse_cinematic 8 8
+proc MenuParse_ownerdrawFlag 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2663
+CNSTI4 0
+RETI4
+ADDRGP4 $2662
+JUMPV
+LABELV $2663
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2662
+endproc MenuParse_ownerdrawFlag 16 8
+proc MenuParse_ownerdraw 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2666
+CNSTI4 0
+RETI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2666
+CNSTI4 1
+RETI4
+LABELV $2665
+endproc MenuParse_ownerdraw 8 8
+proc MenuParse_popup 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2097152
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2668
+endproc MenuParse_popup 8 0
+proc MenuParse_outOfBounds 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2669
+endproc MenuParse_outOfBounds 8 0
+proc MenuParse_soundLoop 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2671
+CNSTI4 0
+RETI4
+ADDRGP4 $2670
+JUMPV
+LABELV $2671
+CNSTI4 1
+RETI4
+LABELV $2670
+endproc MenuParse_soundLoop 8 8
+proc MenuParse_fadeClamp 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2674
+CNSTI4 0
+RETI4
+ADDRGP4 $2673
+JUMPV
+LABELV $2674
+CNSTI4 1
+RETI4
+LABELV $2673
+endproc MenuParse_fadeClamp 8 8
+proc MenuParse_fadeAmount 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2677
+CNSTI4 0
+RETI4
+ADDRGP4 $2676
+JUMPV
+LABELV $2677
+CNSTI4 1
+RETI4
+LABELV $2676
+endproc MenuParse_fadeAmount 8 8
+proc MenuParse_fadeCycle 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2680
+CNSTI4 0
+RETI4
+ADDRGP4 $2679
+JUMPV
+LABELV $2680
+CNSTI4 1
+RETI4
+LABELV $2679
+endproc MenuParse_fadeCycle 8 8
+proc MenuParse_screenPlacement 1092 12
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2683
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2685
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2682
+JUMPV
+LABELV $2683
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2686
+CNSTI4 0
+RETI4
+ADDRGP4 $2682
+JUMPV
+LABELV $2686
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2691
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2688
+ADDRLP4 1044
+CNSTI4 3
+ASGNI4
+ADDRGP4 $2689
+JUMPV
+LABELV $2688
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2695
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2692
+ADDRLP4 1044
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2693
+JUMPV
+LABELV $2692
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2699
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2696
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2696
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2703
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $2700
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2701
+JUMPV
+LABELV $2700
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2704
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2682
+JUMPV
+LABELV $2701
+LABELV $2697
+LABELV $2693
+LABELV $2689
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $2706
+CNSTI4 0
+RETI4
+ADDRGP4 $2682
+JUMPV
+LABELV $2706
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2711
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $2708
+ADDRLP4 1048
+CNSTI4 3
+ASGNI4
+ADDRGP4 $2709
+JUMPV
+LABELV $2708
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2715
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $2712
+ADDRLP4 1048
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2713
+JUMPV
+LABELV $2712
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2699
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $2716
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2717
+JUMPV
+LABELV $2716
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2703
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $2719
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2720
+JUMPV
+LABELV $2719
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2722
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2682
+JUMPV
+LABELV $2720
+LABELV $2717
+LABELV $2713
+LABELV $2709
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetScreenPlacement
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2682
+endproc MenuParse_screenPlacement 1092 12
+proc MenuParse_itemDef 44 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 96
+GEI4 $2725
+CNSTI4 540
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2727
+CNSTI4 0
+RETI4
+ADDRGP4 $2724
+JUMPV
+LABELV $2727
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Init
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2729
+CNSTI4 0
+RETI4
+ADDRGP4 $2724
+JUMPV
+LABELV $2729
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_InitControls
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2725
+CNSTI4 1
+RETI4
+LABELV $2724
+endproc MenuParse_itemDef 44 8
+data
+export menuParseKeywords
+align 4
+LABELV menuParseKeywords
+address $2731
+address MenuParse_font
+byte 4 0
+address $2390
+address MenuParse_name
+byte 4 0
+address $2732
+address MenuParse_fullscreen
+byte 4 0
+address $2400
+address MenuParse_rect
+byte 4 0
+address $2401
+address MenuParse_style
+byte 4 0
+address $2415
+address MenuParse_visible
+byte 4 0
+address $2733
+address MenuParse_onOpen
+byte 4 0
+address $2734
+address MenuParse_onClose
+byte 4 0
+address $2735
+address MenuParse_onESC
+byte 4 0
+address $2413
+address MenuParse_border
+byte 4 0
+address $2736
+address MenuParse_borderSize
+byte 4 0
+address $365
+address MenuParse_backcolor
+byte 4 0
+address $368
+address MenuParse_forecolor
+byte 4 0
+address $371
+address MenuParse_bordercolor
+byte 4 0
+address $2737
+address MenuParse_focuscolor
+byte 4 0
+address $2738
+address MenuParse_disablecolor
+byte 4 0
+address $2423
+address MenuParse_outlinecolor
+byte 4 0
+address $2424
+address MenuParse_background
+byte 4 0
+address $2416
+address MenuParse_ownerdraw
+byte 4 0
+address $2441
+address MenuParse_ownerdrawFlag
+byte 4 0
+address $2739
+address MenuParse_outOfBounds
+byte 4 0
+address $2740
+address MenuParse_soundLoop
+byte 4 0
+address $2741
+address MenuParse_itemDef
+byte 4 0
+address $2447
+address MenuParse_cinematic
+byte 4 0
+address $2742
+address MenuParse_popup
+byte 4 0
+address $2743
+address MenuParse_fadeClamp
+byte 4 0
+address $2744
+address MenuParse_fadeCycle
+byte 4 0
+address $2745
+address MenuParse_fadeAmount
+byte 4 0
+address $2746
+address MenuParse_screenPlacement
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+code
+proc Menu_SetupKeywordHash 4 12
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2751
+JUMPV
+LABELV $2748
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $2749
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2751
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2748
+LABELV $2747
+endproc Menu_SetupKeywordHash 4 12
+proc Menu_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2753
+CNSTI4 0
+RETI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2753
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2759
+CNSTI4 0
+RETI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2758
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2761
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2763
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2761
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2764
+CNSTI4 1
+RETI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2764
+ADDRGP4 menuParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2768
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2770
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $2759
+JUMPV
+LABELV $2768
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2772
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2774
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2772
+LABELV $2759
+ADDRGP4 $2758
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2752
+endproc Menu_Parse 1060 12
+export Menu_New
+proc Menu_New 12 8
+ADDRLP4 0
+CNSTI4 656
+ADDRGP4 menuCount
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRGP4 menuCount
+INDIRI4
+CNSTI4 64
+GEI4 $2777
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Init
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2779
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_PostParse
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 menuCount
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2779
+LABELV $2777
+LABELV $2776
+endproc Menu_New 12 8
+export Menu_Count
+proc Menu_Count 0 0
+ADDRGP4 menuCount
+INDIRI4
+RETI4
+LABELV $2781
+endproc Menu_Count 0 0
+lit
+align 4
+LABELV $2791
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export Menu_PaintAll
+code
+proc Menu_PaintAll 32 32
+ADDRGP4 captureFunc
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2783
+ADDRGP4 captureData
+INDIRP4
+ARGP4
+ADDRGP4 captureFunc
+INDIRP4
+CALLV
+pop
+LABELV $2783
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2788
+JUMPV
+LABELV $2785
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $2786
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2788
+ADDRLP4 4
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2785
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2789
+ADDRLP4 8
+ADDRGP4 $2791
+INDIRB
+ASGNB 16
+ADDRGP4 $2792
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 98036
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2789
+LABELV $2782
+endproc Menu_PaintAll 32 32
+export Menu_Reset
+proc Menu_Reset 0 0
+ADDRGP4 menuCount
+CNSTI4 0
+ASGNI4
+LABELV $2793
+endproc Menu_Reset 0 0
+export Display_GetContext
+proc Display_GetContext 0 0
+ADDRGP4 DC
+INDIRP4
+RETP4
+LABELV $2794
+endproc Display_GetContext 0 0
+export Display_CaptureItem
+proc Display_CaptureItem 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2799
+JUMPV
+LABELV $2796
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2800
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $2795
+JUMPV
+LABELV $2800
+LABELV $2797
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2799
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2796
+CNSTP4 0
+RETP4
+LABELV $2795
+endproc Display_CaptureItem 8 12
+export Display_MouseMove
+proc Display_MouseMove 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2803
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2805
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $2807
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2802
+JUMPV
+LABELV $2807
+LABELV $2805
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2812
+JUMPV
+LABELV $2809
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+LABELV $2810
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2812
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2809
+ADDRGP4 $2804
+JUMPV
+LABELV $2803
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $2804
+CNSTI4 1
+RETI4
+LABELV $2802
+endproc Display_MouseMove 16 12
+export Display_CursorType
+proc Display_CursorType 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2817
+JUMPV
+LABELV $2814
+ADDRLP4 20
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 Menus
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 Menus+4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1088421888
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2822
+CNSTI4 4
+RETI4
+ADDRGP4 $2813
+JUMPV
+LABELV $2822
+LABELV $2815
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2817
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2814
+CNSTI4 2
+RETI4
+LABELV $2813
+endproc Display_CursorType 36 12
+export Display_HandleKey
+proc Display_HandleKey 12 12
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2825
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $2825
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2827
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $2827
+LABELV $2824
+endproc Display_HandleKey 12 12
+proc Window_CacheContents 12 20
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2830
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2832
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2832
+LABELV $2830
+LABELV $2829
+endproc Window_CacheContents 12 20
+proc Item_CacheContents 0 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2835
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+LABELV $2835
+LABELV $2834
+endproc Item_CacheContents 0 4
+proc Menu_CacheContents 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2838
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2843
+JUMPV
+LABELV $2840
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_CacheContents
+CALLV
+pop
+LABELV $2841
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2843
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2840
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2844
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2844
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+pop
+LABELV $2844
+LABELV $2838
+LABELV $2837
+endproc Menu_CacheContents 8 8
+export Display_CacheAll
+proc Display_CacheAll 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2850
+JUMPV
+LABELV $2847
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_CacheContents
+CALLV
+pop
+LABELV $2848
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2850
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2847
+LABELV $2846
+endproc Display_CacheAll 4 4
+proc Menu_OverActiveItem 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2852
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $2852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2854
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2859
+JUMPV
+LABELV $2856
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2860
+ADDRGP4 $2857
+JUMPV
+LABELV $2860
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2862
+ADDRGP4 $2857
+JUMPV
+LABELV $2862
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2864
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2866
+ADDRLP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2866
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2857
+CNSTI4 1
+RETI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2866
+CNSTI4 1
+RETI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2864
+LABELV $2857
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2859
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2856
+LABELV $2854
+LABELV $2852
+CNSTI4 0
+RETI4
+LABELV $2851
+endproc Menu_OverActiveItem 32 12
+bss
+export menuParseKeywordHash
+align 4
+LABELV menuParseKeywordHash
+skip 2048
+export itemParseKeywordHash
+align 4
+LABELV itemParseKeywordHash
+skip 2048
+export g_nameBind2
+align 1
+LABELV g_nameBind2
+skip 32
+export g_nameBind1
+align 1
+LABELV g_nameBind1
+skip 32
+align 4
+LABELV strHandle
+skip 8192
+align 1
+LABELV strPool
+skip 393216
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV UI_memoryPool
+skip 1048576
+export menuStack
+align 4
+LABELV menuStack
+skip 64
+export Menus
+align 4
+LABELV Menus
+skip 41984
+align 4
+LABELV scrollInfo
+skip 32
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Script_Parse
+import Display_ExpandMacros
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2792
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $2774
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2770
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2763
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $2746
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2745
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2744
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2743
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $2742
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2741
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $2740
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $2739
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2738
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2737
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2736
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2735
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $2734
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $2733
+byte 1 111
+byte 1 110
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2732
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2731
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2722
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2715
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 84
+byte 1 79
+byte 1 77
+byte 1 0
+align 1
+LABELV $2711
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 0
+align 1
+LABELV $2704
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2703
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $2699
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 67
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $2695
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 70
+byte 1 84
+byte 1 0
+align 1
+LABELV $2691
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 0
+align 1
+LABELV $2685
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 115
+byte 1 0
+align 1
+LABELV $2587
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2568
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2564
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2546
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2537
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2520
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $2512
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2511
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2508
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2502
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2501
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2498
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 118
+byte 1 54
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2495
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $2484
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2479
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $2478
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2477
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $2476
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2475
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $2474
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2473
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $2472
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2471
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $2470
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2469
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $2468
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2467
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $2466
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2465
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2464
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $2463
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2462
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $2461
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $2460
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $2459
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $2458
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2457
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2456
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $2455
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2454
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $2448
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2447
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $2446
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2445
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2444
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2443
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2442
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2441
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2440
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2439
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2438
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2437
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2436
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2435
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2434
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2433
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2432
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2431
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2430
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2429
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2428
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2427
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2426
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2425
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2424
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2423
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2422
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2421
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2420
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $2419
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $2418
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2417
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2416
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $2415
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2414
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2413
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2412
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2411
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2410
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2409
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2408
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2407
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2406
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2405
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2404
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2403
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2402
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2401
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2400
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $2399
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2398
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2397
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 121
+byte 1 0
+align 1
+LABELV $2396
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 120
+byte 1 0
+align 1
+LABELV $2395
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2394
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2393
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $2392
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2391
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2390
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2327
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1997
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1660
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $1636
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $1635
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $1605
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1572
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $1571
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $1570
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $1569
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1568
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1567
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $1566
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1565
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1564
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1563
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1562
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1561
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1560
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1559
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 69
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1558
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1557
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1556
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1555
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $1554
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1553
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1552
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 121
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1551
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1550
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1549
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1548
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1547
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $1546
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1545
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1544
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $1543
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1542
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $1541
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $1540
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $1539
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1538
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $1537
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $1536
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $1535
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $1534
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $1533
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $1532
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $1531
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $1530
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $1529
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1528
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $1527
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1526
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1525
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1524
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $1523
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1522
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1521
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1520
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1519
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1518
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1517
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1516
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1515
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1514
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $1513
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1496
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $1495
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1340
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1336
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1180
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1000
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $995
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $994
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $993
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $989
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $928
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $570
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $569
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $568
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $567
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $566
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $565
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $564
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $563
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $562
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $561
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $559
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $558
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $557
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $556
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $555
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $554
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $553
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $552
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $551
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $550
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $543
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 32
+byte 1 0
+align 1
+LABELV $536
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $532
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $371
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $368
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $365
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $205
+byte 1 32
+byte 1 0
+align 1
+LABELV $202
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $197
+byte 1 125
+byte 1 0
+align 1
+LABELV $188
+byte 1 123
+byte 1 0
+align 1
+LABELV $152
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $117
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $94
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $83
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $82
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $81
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $80
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 47
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $59
+byte 1 0
+align 1
+LABELV $50
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 33
+byte 1 10
+byte 1 0
@@ -0,0 +1,5339 @@
+code
+proc BG_TraceTracemapPoint 164 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 56+8
+ADDRLP4 84+12+8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 128
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $91
+ADDRFP4 12
+INDIRP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $90
+JUMPV
+LABELV $91
+ADDRLP4 68+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $94
+ADDRLP4 68+8
+CNSTF4 3347054336
+ASGNF4
+LABELV $94
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $98
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $102
+ADDRFP4 12
+INDIRP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $90
+JUMPV
+LABELV $102
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0+44
+INDIRI4
+ASGNI4
+ADDRGP4 $90
+JUMPV
+LABELV $99
+LABELV $89
+ADDRGP4 $88
+JUMPV
+LABELV $90
+ADDRLP4 56+8
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 3347054592
+NEF4 $114
+ADDRFP4 20
+INDIRP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $111
+JUMPV
+LABELV $113
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $116
+ADDRFP4 20
+INDIRP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $115
+JUMPV
+LABELV $116
+ADDRLP4 68+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $119
+ADDRLP4 68+8
+CNSTF4 1199570688
+ASGNF4
+LABELV $119
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRLP4 156
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+44
+INDIRI4
+ADDRLP4 156
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $126
+ADDRLP4 0+12
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+NEI4 $126
+ADDRFP4 20
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $115
+JUMPV
+LABELV $126
+ADDRLP4 56+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $135
+ADDRFP4 20
+INDIRP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $115
+JUMPV
+LABELV $135
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $138
+ADDRFP4 20
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $115
+JUMPV
+LABELV $138
+ADDRLP4 56+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $124
+LABELV $114
+ADDRGP4 $113
+JUMPV
+LABELV $115
+LABELV $111
+ADDRFP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $146
+ADDRFP4 12
+INDIRP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $146
+ADDRLP4 84+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $148
+ADDRFP4 24
+INDIRP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $147
+JUMPV
+LABELV $148
+ADDRFP4 24
+INDIRP4
+ADDRLP4 84+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRFP4 24
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $147
+ADDRLP4 80
+INDIRI4
+RETI4
+LABELV $80
+endproc BG_TraceTracemapPoint 164 28
+data
+align 4
+LABELV $154
+byte 4 0
+align 4
+LABELV $155
+byte 4 0
+export BG_GenerateTracemap
+code
+proc BG_GenerateTracemap 1232 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 124
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 124
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $157
+ADDRGP4 $159
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $153
+JUMPV
+LABELV $157
+ADDRLP4 1160
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1160
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+EQF4 $160
+ADDRGP4 $162
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $153
+JUMPV
+LABELV $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $163
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 tracemap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 786460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1164
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 52
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRLP4 1168
+CNSTI4 65536
+ASGNI4
+ADDRLP4 20
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 1180
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 1180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1184
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1184
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1184
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 1180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $164
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $168
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 1192
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 1200
+ADDRLP4 1192
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1204
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+ADDRLP4 1204
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 1200
+INDIRI4
+ADDRLP4 1204
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1200
+INDIRI4
+ADDRLP4 1204
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 BG_TraceTracemapPoint
+CALLI4
+ASGNI4
+ADDRLP4 1212
+ADDRGP4 $155
+ASGNP4
+ADDRLP4 1212
+INDIRP4
+ADDRLP4 1212
+INDIRP4
+INDIRI4
+ADDRLP4 1208
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $175
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+LEF4 $177
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $177
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+GEF4 $181
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $181
+LABELV $175
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $185
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+LEF4 $188
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $188
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+GEF4 $192
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $192
+LABELV $185
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $196
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+LEF4 $199
+ADDRLP4 56
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $199
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+GEF4 $203
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $203
+LABELV $196
+ADDRLP4 1216
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRLP4 1220
+ADDRGP4 $154
+INDIRI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $209
+ADDRLP4 1220
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $207
+LABELV $209
+ADDRGP4 $154
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 1228
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1228
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $155
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $207
+LABELV $169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $168
+LABELV $165
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $164
+ADDRGP4 $210
+ARGP4
+ADDRLP4 1188
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1188
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $155
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 32
+CNSTF4 1132331008
+ADDRLP4 52
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $211
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+LABELV $211
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $213
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $217
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+LTF4 $221
+ADDRLP4 1192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $221
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $226
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $230
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $230
+LABELV $227
+LABELV $218
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $217
+LABELV $214
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $213
+ADDRLP4 32
+CNSTF4 1132331008
+ADDRLP4 56
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $234
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+LABELV $234
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+LTF4 $244
+ADDRLP4 1192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $249
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $253
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $253
+LABELV $250
+LABELV $241
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $240
+LABELV $237
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $236
+ADDRLP4 48
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $257
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 32
+CNSTF4 1132331008
+ADDRLP4 48
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $258
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $259
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $267
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 1192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $268
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $273
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $277
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $277
+LABELV $274
+LABELV $264
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $263
+LABELV $260
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $259
+ADDRLP4 60
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 1192
+INDIRP4
+ARGP4
+ADDRLP4 1196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1196
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 2
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 1
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 1
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 32
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $282
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $286
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $287
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $287
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $300
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $300
+address $294
+address $295
+address $296
+address $297
+address $298
+address $299
+code
+LABELV $294
+ADDRLP4 20
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $295
+ADDRLP4 52
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $296
+ADDRLP4 24
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $297
+ADDRLP4 56
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $298
+ADDRLP4 36
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $299
+ADDRLP4 48
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $290
+ADDRLP4 1204
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1208
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1204
+INDIRF4
+ADDRLP4 1208
+INDIRF4
+LTF4 $303
+ADDRLP4 1200
+ADDRLP4 1204
+INDIRF4
+ADDRLP4 1208
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRLP4 1200
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $304
+ADDRLP4 8
+ADDRLP4 1200
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $305
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 1216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1220
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+LTF4 $310
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $311
+ADDRLP4 8
+ADDRLP4 1212
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $306
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $312
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 1216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1220
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+LTF4 $317
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $318
+ADDRLP4 8
+ADDRLP4 1212
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $313
+LABELV $287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $286
+LABELV $283
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $282
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $319
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_LoadTraceMapFile
+CALLI4
+pop
+LABELV $153
+endproc BG_GenerateTracemap 1232 28
+proc BG_TraceMapBSPChecksum 260 12
+ADDRGP4 $321
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CVIU4 4
+RETU4
+LABELV $320
+endproc BG_TraceMapBSPChecksum 260 12
+bss
+align 4
+LABELV $323
+skip 16384
+code
+proc BG_TraceMapTGAChecksum 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 2166136261
+BXORU4
+ASGNU4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+LEI4 $327
+ADDRLP4 8
+CNSTI4 16384
+ASGNI4
+LABELV $327
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 4
+DIVI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $323
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $329
+ADDRLP4 4
+CNSTU4 16777619
+ADDRLP4 4
+INDIRU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $323
+ADDP4
+INDIRI4
+CVIU4 4
+BXORU4
+MULU4
+ASGNU4
+LABELV $330
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $332
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 4
+DIVI4
+LTI4 $329
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $325
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $324
+ADDRLP4 4
+INDIRU4
+RETU4
+LABELV $322
+endproc BG_TraceMapTGAChecksum 12 12
+proc BG_ReadTraceMapCache 52 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $334
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $335
+CNSTI4 0
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $335
+ADDRLP4 36
+INDIRI4
+CVIU4 4
+CNSTU4 786464
+EQU4 $337
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $337
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+NEI4 $353
+ADDRLP4 0+4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $353
+ADDRLP4 0+8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $353
+ADDRLP4 0+12
+INDIRU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRU4
+NEU4 $353
+ADDRLP4 0+16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+NEI4 $353
+ADDRLP4 0+20
+INDIRU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU4
+EQU4 $342
+LABELV $353
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $342
+ADDRGP4 tracemap+4
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRGP4 tracemap+262148
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRGP4 tracemap+524292
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0+28
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $333
+endproc BG_ReadTraceMapCache 52 12
+proc BG_WriteTraceMapCache 16 12
+ADDRGP4 $334
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $365
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $363
+LABELV $365
+ADDRGP4 $362
+JUMPV
+LABELV $363
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 tracemap+4
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 tracemap+262148
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 tracemap+524292
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $362
+endproc BG_WriteTraceMapCache 16 12
+proc BG_ReadTraceMapTGA 1124 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 1088
+CNSTI4 8
+ASGNI4
+ADDRLP4 1092
+CNSTI4 256
+ASGNI4
+ADDRLP4 1060+12
+INDIRU1
+CVUI4 1
+ADDRLP4 1060+13
+INDIRU1
+CVUI4 1
+ADDRLP4 1088
+INDIRI4
+LSHI4
+BORI4
+ADDRLP4 1092
+INDIRI4
+NEI4 $379
+ADDRLP4 1060+14
+INDIRU1
+CVUI4 1
+ADDRLP4 1060+15
+INDIRU1
+CVUI4 1
+ADDRLP4 1088
+INDIRI4
+LSHI4
+BORI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $373
+LABELV $379
+CNSTI4 0
+RETI4
+ADDRGP4 $372
+JUMPV
+LABELV $373
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $384
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $388
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $416
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $416
+address $392
+address $396
+address $400
+address $404
+address $408
+address $412
+code
+LABELV $392
+ADDRLP4 1100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $396
+ADDRLP4 1104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $400
+ADDRLP4 1108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $404
+ADDRLP4 1112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $408
+ADDRLP4 1116
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $412
+ADDRLP4 1120
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $390
+LABELV $391
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $385
+JUMPV
+LABELV $388
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $421
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $421
+ADDRLP4 1100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $427
+ADDRLP4 1104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $433
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $433
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $437
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $437
+LABELV $385
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $384
+LABELV $381
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $380
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $442
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $443
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $444
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $448
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $452
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $452
+LABELV $449
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $448
+LABELV $445
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $444
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $457
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $458
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $459
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $463
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $467
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $467
+LABELV $464
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $463
+LABELV $460
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $459
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $472
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $473
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $478
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $482
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $482
+LABELV $479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $478
+LABELV $475
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $474
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $372
+endproc BG_ReadTraceMapTGA 1124 12
+proc BG_LoadTraceMapFile 148 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1346456916
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+8
+CNSTI4 256
+ASGNI4
+ADDRLP4 100
+ADDRGP4 BG_TraceMapBSPChecksum
+CALLU4
+ASGNU4
+ADDRLP4 0+12
+ADDRLP4 100
+INDIRU4
+ASGNU4
+ADDRLP4 32
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 112
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0+16
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 0
+GEI4 $492
+ADDRGP4 $281
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+RETI4
+ADDRGP4 $487
+JUMPV
+LABELV $492
+ADDRLP4 0+12
+INDIRU4
+CNSTU4 0
+NEU4 $496
+ADDRFP4 12
+CNSTI4 0
+ASGNI4
+LABELV $496
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 BG_TraceMapTGAChecksum
+CALLU4
+ASGNU4
+ADDRLP4 0+20
+ADDRLP4 116
+INDIRU4
+ASGNU4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $503
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ADDRGP4 BG_ReadTraceMapCache
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $501
+LABELV $503
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $281
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+GEI4 $504
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+RETI4
+ADDRGP4 $487
+JUMPV
+LABELV $504
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 132
+ADDRGP4 BG_ReadTraceMapTGA
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $506
+ADDRGP4 $281
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+CNSTI4 256
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+RETI4
+ADDRGP4 $487
+JUMPV
+LABELV $506
+ADDRLP4 0+12
+INDIRU4
+CNSTU4 0
+EQU4 $511
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_WriteTraceMapCache
+CALLV
+pop
+LABELV $511
+LABELV $501
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 tracemap+786436
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786436+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor
+ADDRLP4 124
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRLP4 128
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor+4
+ADDRLP4 124
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRLP4 128
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 tracemap+786452
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+ADDRGP4 tracemap+786456
+ADDRLP4 0+28
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+RETI4
+LABELV $487
+endproc BG_LoadTraceMapFile 148 16
+export BG_LoadTraceMap
+proc BG_LoadTraceMap 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 BG_LoadTraceMapFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $531
+endproc BG_LoadTraceMap 4 16
+proc BG_ClampPointToTracemapExtends 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+GEF4 $533
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786436
+INDIRF4
+ASGNF4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+LEF4 $537
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786444
+INDIRF4
+ASGNF4
+ADDRGP4 $538
+JUMPV
+LABELV $537
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $538
+LABELV $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+GEF4 $541
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ASGNF4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+LEF4 $547
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+ASGNF4
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $548
+LABELV $542
+LABELV $532
+endproc BG_ClampPointToTracemapExtends 4 0
+export BG_GetSkyHeightAtPoint
+proc BG_GetSkyHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $554
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $553
+JUMPV
+LABELV $554
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $553
+endproc BG_GetSkyHeightAtPoint 16 8
+export BG_GetSkyGroundHeightAtPoint
+proc BG_GetSkyGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $563
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $562
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $562
+endproc BG_GetSkyGroundHeightAtPoint 16 8
+export BG_GetGroundHeightAtPoint
+proc BG_GetGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $572
+CNSTF4 3347054592
+RETF4
+ADDRGP4 $571
+JUMPV
+LABELV $572
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $571
+endproc BG_GetGroundHeightAtPoint 16 8
+export BG_GetTracemapGroundFloor
+proc BG_GetTracemapGroundFloor 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $581
+CNSTI4 -65536
+RETI4
+ADDRGP4 $580
+JUMPV
+LABELV $581
+ADDRGP4 tracemap+786452
+INDIRI4
+RETI4
+LABELV $580
+endproc BG_GetTracemapGroundFloor 0 0
+export BG_GetTracemapGroundCeil
+proc BG_GetTracemapGroundCeil 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $585
+CNSTI4 65536
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $585
+ADDRGP4 tracemap+786456
+INDIRI4
+RETI4
+LABELV $584
+endproc BG_GetTracemapGroundCeil 0 0
+export FinalizeTracemapClamp
+proc FinalizeTracemapClamp 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $591
+LABELV $590
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $593
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $595
+ADDRFP4 4
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $595
+LABELV $594
+LABELV $588
+endproc FinalizeTracemapClamp 0 0
+bss
+align 4
+LABELV one_over_mapgrid_factor
+skip 8
+align 4
+LABELV tracemap
+skip 786460
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_RequestFullScores
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_stereoSeparation
+import cg_zProj
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $510
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 120
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $495
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $334
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $321
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $319
+byte 1 84
+byte 1 82
+byte 1 85
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 45
+byte 1 88
+byte 1 70
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 0
+byte 1 0
+align 1
+LABELV $281
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $210
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $163
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $159
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $156
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
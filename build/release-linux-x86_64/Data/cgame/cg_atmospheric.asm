@@ -0,0 +1,5617 @@
+code
+proc CG_AddPolyToPool 64 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_PB_FindFreePolyBuffer
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $81
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 53304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 28700
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $83
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 4
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16400
+ADDP4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16400
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+CNSTI4 1
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+CNSTI4 3
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28704
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $84
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $83
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 53304
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+CNSTI4 28700
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $80
+endproc CG_AddPolyToPool 64 12
+export CG_AtmosphericKludge
+proc CG_AtmosphericKludge 8 0
+ADDRGP4 kludgeChecked
+INDIRI4
+CNSTI4 0
+EQI4 $88
+ADDRGP4 kludgeResult
+INDIRI4
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRGP4 kludgeChecked
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 kludgeResult
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $87
+endproc CG_AtmosphericKludge 8 0
+proc CG_SetParticleActive 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $93
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $94
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $91
+endproc CG_SetParticleActive 4 0
+proc CG_RainParticleGenerate 76 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BG_GetSkyHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $101
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LTF4 $103
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $103
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CNSTI4 0
+LEI4 $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+LEF4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GEF4 $118
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $118
+LABELV $108
+LABELV $105
+ADDRLP4 48
+CNSTI4 10000
+ASGNI4
+ADDRLP4 44
+CNSTF4 1056964608
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 981668463
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 48
+INDIRI4
+MODI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_atmFx+272148
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+LEF4 $123
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $123
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetParticleActive
+CALLI4
+pop
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1132396544
+CNSTF4 1045220557
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1132396544
+CNSTF4 1045220557
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1132396544
+CNSTF4 1045220557
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalizeFast
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+CNSTI4 1
+LEI4 $126
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ASGNP4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cg_atmFx+272000
+ASGNP4
+LABELV $127
+CNSTI4 1
+RETI4
+LABELV $95
+endproc CG_RainParticleGenerate 76 8
+proc CG_RainParticleCheckVisible 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $133
+LABELV $135
+CNSTI4 0
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $133
+ADDRLP4 8
+CNSTF4 981668463
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272024
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+GEF4 $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $138
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1232348160
+LEF4 $146
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $146
+CNSTI4 1
+RETI4
+LABELV $132
+endproc CG_RainParticleCheckVisible 56 8
+proc CG_RainParticleRender 312 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $151
+ADDRGP4 $150
+JUMPV
+LABELV $151
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_CullPoint
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $153
+ADDRGP4 $150
+JUMPV
+LABELV $153
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRLP4 148
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 152
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 136
+INDIRF4
+GTF4 $157
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $157
+ADDRLP4 116
+INDIRF4
+CNSTF4 0
+GTF4 $165
+ADDRGP4 $150
+JUMPV
+LABELV $165
+ADDRLP4 120
+INDIRF4
+CNSTF4 1182793728
+GEF4 $167
+ADDRLP4 120
+CNSTF4 1061158912
+ADDRLP4 120
+INDIRF4
+CNSTF4 1182793728
+DIVF4
+MULF4
+CNSTF4 1048576000
+ADDF4
+ASGNF4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRLP4 120
+CNSTF4 1065353216
+ASGNF4
+LABELV $168
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 156
+ADDRLP4 116
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 84
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+8
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 108
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 72
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 72+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+LTF4 $238
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $239
+ADDRLP4 0+20
+ADDRLP4 168
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+LTF4 $243
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $244
+ADDRLP4 0+20+1
+ADDRLP4 180
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 200
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+LTF4 $248
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $249
+ADDRLP4 0+20+2
+ADDRLP4 192
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 208
+CNSTF4 1120403456
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $253
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $254
+ADDRLP4 0+20+3
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $272
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $273
+ADDRLP4 0+24+20
+ADDRLP4 216
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 232
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+LTF4 $278
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $279
+ADDRLP4 0+24+20+1
+ADDRLP4 228
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+LTF4 $284
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $285
+ADDRLP4 0+48+20+2
+ADDRLP4 240
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 256
+CNSTF4 1128792064
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+LTF4 $290
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $291
+ADDRLP4 0+24+20+3
+ADDRLP4 252
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $309
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $310
+ADDRLP4 0+48+20
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+LTF4 $315
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $316
+ADDRLP4 0+48+20+1
+ADDRLP4 276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $321
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $322
+ADDRLP4 0+48+20+2
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+CNSTF4 1128792064
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $327
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $328
+ADDRLP4 0+48+20+3
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyToPool
+CALLV
+pop
+LABELV $150
+endproc CG_RainParticleRender 312 8
+proc CG_SnowParticleGenerate 68 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BG_GetSkyHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $335
+CNSTI4 0
+RETI4
+ADDRGP4 $329
+JUMPV
+LABELV $335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LTF4 $337
+CNSTI4 0
+RETI4
+ADDRGP4 $329
+JUMPV
+LABELV $337
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CNSTI4 0
+LEI4 $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+SUBF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+LEF4 $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+125184+24+8
+INDIRF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GEF4 $352
+CNSTI4 0
+RETI4
+ADDRGP4 $329
+JUMPV
+LABELV $352
+LABELV $342
+LABELV $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetParticleActive
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1103626240
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalizeFast
+CALLV
+pop
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1077936128
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+CNSTI4 1
+LEI4 $354
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ASGNP4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cg_atmFx+272000
+ASGNP4
+LABELV $355
+CNSTI4 1
+RETI4
+LABELV $329
+endproc CG_SnowParticleGenerate 68 8
+proc CG_SnowParticleCheckVisible 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $361
+LABELV $363
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRLP4 8
+CNSTF4 981668463
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272024
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+GEF4 $366
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $366
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1232348160
+LEF4 $374
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $374
+CNSTI4 1
+RETI4
+LABELV $360
+endproc CG_SnowParticleCheckVisible 56 8
+proc CG_SnowParticleRender 212 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $379
+ADDRGP4 $378
+JUMPV
+LABELV $379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_CullPoint
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRGP4 $378
+JUMPV
+LABELV $381
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTF4 1023410176
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+CNSTF4 1023410176
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 176
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 184
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+GTF4 $384
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 192
+INDIRP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $384
+ADDRLP4 120
+INDIRF4
+CNSTF4 0
+GTF4 $392
+ADDRGP4 $378
+JUMPV
+LABELV $392
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125184+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRLP4 192
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1215570944
+LEF4 $402
+ADDRLP4 136
+CNSTF4 908576172
+ADDRLP4 136
+INDIRF4
+CNSTF4 1215570944
+SUBF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 136
+CNSTF4 1065353216
+ASGNF4
+LABELV $403
+ADDRLP4 120
+ADDRLP4 120
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 196
+ADDRLP4 120
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 84
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 120
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 200
+INDIRF4
+ADDRGP4 cg+125184+36+12
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 200
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg+125184+36+12
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRGP4 cg+125184+36+12+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+8
+ADDRGP4 cg+125184+36+12+8
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 108
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 72
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+ADDRLP4 204
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 72+4
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 116
+ADDRLP4 136
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 116
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 124
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyToPool
+CALLV
+pop
+LABELV $378
+endproc CG_SnowParticleRender 212 8
+proc CG_EffectGust 32 0
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg_atmFx+272044
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272064
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_atmFx+272068
+INDIRI4
+ADDRGP4 cg_atmFx+272064
+INDIRI4
+SUBI4
+MODI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272060
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $547
+ADDRGP4 cg_atmFx+272032
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272052
+INDIRI4
+ADDRGP4 cg_atmFx+272048
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $554
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $555
+ADDRGP4 cg_atmFx+272036
+ADDRGP4 cg_atmFx+272032
+INDIRI4
+ADDRGP4 cg_atmFx+272048
+INDIRI4
+ADDI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272060
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $563
+ADDRGP4 cg_atmFx+272040
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $534
+endproc CG_EffectGust 32 0
+proc CG_EffectGustCurrent 16 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+GEI4 $565
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272096
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+ASGNI4
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272108
+INDIRF4
+ADDRGP4 cg_atmFx+272096
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg_atmFx+272108+4
+INDIRF4
+ADDRGP4 cg_atmFx+272096+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 cg_atmFx+272108+8
+INDIRF4
+ADDRGP4 cg_atmFx+272096+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272032
+INDIRI4
+GEI4 $584
+ADDRLP4 12
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272032
+INDIRI4
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272096
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_atmFx+272096+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg_atmFx+272096+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+ADDRGP4 cg_atmFx+272076
+INDIRF4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+GEI4 $605
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272108
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272076
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ASGNI4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 12
+CNSTF4 1065353216
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272040
+INDIRI4
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272096
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_atmFx+272096+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg_atmFx+272096+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+ADDRGP4 cg_atmFx+272076
+INDIRF4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg_atmFx+272040
+INDIRI4
+LTI4 $629
+CNSTI4 1
+RETI4
+ADDRGP4 $564
+JUMPV
+LABELV $629
+LABELV $606
+LABELV $585
+LABELV $566
+CNSTI4 0
+RETI4
+LABELV $564
+endproc CG_EffectGustCurrent 16 0
+proc CG_EP_ParseFloats 84 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $637
+JUMPV
+LABELV $634
+LABELV $635
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $637
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $638
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+NEI4 $634
+LABELV $638
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $639
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $640
+LABELV $633
+endproc CG_EP_ParseFloats 84 12
+proc CG_EP_ParseInts 84 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $645
+JUMPV
+LABELV $642
+LABELV $643
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $645
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+NEI4 $642
+LABELV $646
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $647
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $648
+LABELV $641
+endproc CG_EP_ParseInts 84 12
+export CG_EffectParse
+proc CG_EffectParse 252 12
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+ADDRGP4 CG_AtmosphericKludge
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $650
+ADDRGP4 $649
+JUMPV
+LABELV $650
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_atmFx+272096+4
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272096
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 cg_atmFx+272108+4
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272108
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 28
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 200
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 204
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 180
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272072
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 cg_atmFx+272076
+CNSTF4 1069547520
+ASGNF4
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 40
+ASGNP4
+ADDRGP4 $663
+JUMPV
+LABELV $660
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $667
+JUMPV
+LABELV $664
+LABELV $665
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $667
+ADDRLP4 208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRLP4 208
+INDIRI4
+CNSTI4 61
+EQI4 $669
+ADDRLP4 208
+INDIRI4
+CNSTI4 44
+NEI4 $664
+LABELV $669
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $670
+ADDRGP4 $662
+JUMPV
+LABELV $670
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $672
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $661
+JUMPV
+LABELV $672
+ADDRLP4 212
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 212
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $677
+JUMPV
+LABELV $674
+LABELV $675
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $677
+ADDRLP4 216
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $678
+ADDRLP4 216
+INDIRI4
+CNSTI4 44
+NEI4 $674
+LABELV $678
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $679
+ADDRLP4 220
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 220
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $679
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $685
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRGP4 cg_atmFx+272028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $687
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $649
+JUMPV
+LABELV $683
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $690
+ARGP4
+ADDRLP4 224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $688
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_atmFx+272132
+ADDRGP4 CG_RainParticleCheckVisible
+ASGNP4
+ADDRGP4 cg_atmFx+272136
+ADDRGP4 CG_RainParticleGenerate
+ASGNP4
+ADDRGP4 cg_atmFx+272140
+ADDRGP4 CG_RainParticleRender
+ASGNP4
+ADDRLP4 228
+CNSTF4 3294363648
+ASGNF4
+ADDRGP4 cg_atmFx+272108+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272096+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRGP4 $682
+JUMPV
+LABELV $688
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $698
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_atmFx+272132
+ADDRGP4 CG_SnowParticleCheckVisible
+ASGNP4
+ADDRGP4 cg_atmFx+272136
+ADDRGP4 CG_SnowParticleGenerate
+ASGNP4
+ADDRGP4 cg_atmFx+272140
+ADDRGP4 CG_SnowParticleRender
+ASGNP4
+ADDRLP4 232
+CNSTF4 3265265664
+ASGNF4
+ADDRGP4 cg_atmFx+272108+8
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272096+8
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRGP4 $682
+JUMPV
+LABELV $698
+ADDRGP4 cg_atmFx+272028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $649
+JUMPV
+LABELV $681
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $712
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $710
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $713
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $718
+ARGP4
+ADDRLP4 228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $716
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $721
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $719
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272096
+ARGP4
+ADDRGP4 cg_atmFx+272096+4
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $727
+ARGP4
+ADDRLP4 236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $725
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272108
+ARGP4
+ADDRGP4 cg_atmFx+272108+4
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $733
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $731
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272072
+ARGP4
+ADDRGP4 cg_atmFx+272076
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $738
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $736
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $737
+JUMPV
+LABELV $736
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $741
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $739
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 CG_EP_ParseInts
+CALLV
+pop
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRGP4 $742
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $740
+LABELV $737
+LABELV $732
+LABELV $726
+LABELV $720
+LABELV $717
+LABELV $714
+LABELV $711
+LABELV $682
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $661
+LABELV $663
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $660
+LABELV $662
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRGP4 cgs+60172
+ARGP4
+ADDRGP4 cg+130264
+ARGP4
+ADDRGP4 cg+130272
+ARGP4
+ADDRLP4 208
+ADDRGP4 BG_LoadTraceMap
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $743
+LABELV $748
+ADDRGP4 cg_atmFx+272028
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $743
+ADDRGP4 cg_atmFx+272088
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CNSTI4 0
+GEI4 $751
+ADDRGP4 cg_atmFx+272088
+CNSTI4 0
+ASGNI4
+LABELV $751
+ADDRGP4 cg_atmFx+272064
+CNSTF4 1148846080
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272068
+CNSTF4 1148846080
+ADDRLP4 28
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272056
+CNSTF4 1148846080
+ADDRLP4 32
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272060
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272048
+CNSTF4 1148846080
+ADDRLP4 168
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272052
+CNSTF4 1148846080
+ADDRLP4 172
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272080
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272084
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+LEI4 $769
+ADDRLP4 212
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+ASGNI4
+ADDRGP4 $770
+JUMPV
+LABELV $769
+ADDRLP4 212
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ASGNI4
+LABELV $770
+ADDRGP4 cg_atmFx+272028
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CNSTI4 4000
+LEI4 $771
+ADDRGP4 cg_atmFx+272028
+CNSTI4 4000
+ASGNI4
+LABELV $771
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $775
+ADDRGP4 $778
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cg_atmFx+272000
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272092
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $780
+ADDRGP4 $785
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $776
+ADDRLP4 232
+ADDRGP4 cg_atmFx+272092
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $787
+LABELV $781
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+LTI4 $780
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $790
+ADDRGP4 $793
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cg_atmFx+272000
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272092
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $795
+ADDRGP4 $800
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $791
+ADDRLP4 232
+ADDRGP4 cg_atmFx+272092
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $802
+LABELV $796
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+LTI4 $795
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRGP4 cg_atmFx+272092
+CNSTI4 0
+ASGNI4
+LABELV $791
+LABELV $776
+ADDRGP4 cg_atmFx+272000
+INDIRI4
+CNSTI4 0
+NEI4 $806
+ADDRGP4 cg_atmFx+272000
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg_atmFx+272092
+CNSTI4 0
+ASGNI4
+LABELV $806
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $811
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 220
+CNSTI4 1000
+ASGNI4
+CNSTI4 68
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_atmFx+60
+ADDP4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 220
+INDIRI4
+MODI4
+ADDRLP4 220
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $812
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $814
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+LTI4 $811
+ADDRGP4 CG_EffectGust
+CALLV
+pop
+LABELV $649
+endproc CG_EffectParse 252 12
+export CG_AddAtmosphericEffects
+proc CG_AddAtmosphericEffects 60 12
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $824
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $824
+ADDRGP4 cg_atmosphericEffects+8
+INDIRF4
+CNSTF4 0
+GTF4 $818
+LABELV $824
+ADDRGP4 $817
+JUMPV
+LABELV $818
+ADDRGP4 cg_atmosphericEffects+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $830
+ADDRLP4 36
+ADDRGP4 cg_atmosphericEffects+8
+INDIRF4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 36
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $831
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_EffectGustCurrent
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $832
+ADDRGP4 CG_EffectGust
+CALLV
+pop
+LABELV $832
+ADDRGP4 cg_atmFx+272148
+ADDRGP4 cg_atmFx+272144
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272144
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_atmFx+272160
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272156
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272152
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272120
+ADDRGP4 cg+125184+36
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272120+4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272120+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $853
+JUMPV
+LABELV $850
+ADDRLP4 0
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_atmFx
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 cg_atmFx+272132
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $854
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cg_atmFx+272136
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $857
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $851
+JUMPV
+LABELV $857
+ADDRLP4 56
+ADDRGP4 cg_atmFx+272156
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $854
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272140
+INDIRP4
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 cg_atmFx+272144
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $851
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $853
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $850
+ADDRGP4 cg_atmFx+272024
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $817
+endproc CG_AddAtmosphericEffects 60 12
+bss
+align 4
+LABELV cg_atmFx
+skip 272164
+align 4
+LABELV kludgeResult
+skip 4
+align 4
+LABELV kludgeChecked
+skip 4
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_RequestFullScores
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_stereoSeparation
+import cg_zProj
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $800
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $793
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $785
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $778
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $742
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $741
+byte 1 72
+byte 1 0
+align 1
+LABELV $738
+byte 1 68
+byte 1 0
+align 1
+LABELV $733
+byte 1 87
+byte 1 0
+align 1
+LABELV $727
+byte 1 71
+byte 1 86
+byte 1 0
+align 1
+LABELV $721
+byte 1 66
+byte 1 86
+byte 1 0
+align 1
+LABELV $718
+byte 1 71
+byte 1 0
+align 1
+LABELV $715
+byte 1 67
+byte 1 0
+align 1
+LABELV $712
+byte 1 66
+byte 1 0
+align 1
+LABELV $709
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 39
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $700
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 0
+align 1
+LABELV $690
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $687
+byte 1 65
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $685
+byte 1 84
+byte 1 0
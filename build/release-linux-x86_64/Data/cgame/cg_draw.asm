@@ -0,0 +1,9149 @@
+data
+export menuScoreboard
+align 4
+LABELV menuScoreboard
+byte 4 0
+align 4
+LABELV DayAbbrev
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+export CG_Text_Width
+code
+proc CG_Text_Width 48 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cgDC+240+12
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $98
+ADDRLP4 12
+ADDRGP4 cgDC+240+20568
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $103
+ADDRLP4 12
+ADDRGP4 cgDC+240+41124
+ASGNP4
+LABELV $103
+LABELV $99
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $108
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $110
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $110
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $110
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $115
+ADDRLP4 16
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $118
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $118
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $112
+LABELV $118
+LABELV $108
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $95
+endproc CG_Text_Width 48 4
+export CG_Text_Height
+proc CG_Text_Height 44 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cgDC+240+12
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $122
+ADDRLP4 20
+ADDRGP4 cgDC+240+20568
+ASGNP4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $127
+ADDRLP4 20
+ADDRGP4 cgDC+240+41124
+ASGNP4
+LABELV $127
+LABELV $123
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $132
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $134
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $134
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $134
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $137
+JUMPV
+LABELV $139
+ADDRLP4 12
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+GEF4 $141
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $141
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $137
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $144
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $144
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $136
+LABELV $144
+LABELV $132
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $119
+endproc CG_Text_Height 44 4
+export CG_Text_PaintChar
+proc CG_Text_PaintChar 12 36
+ADDRLP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $145
+endproc CG_Text_PaintChar 12 36
+export CG_Text_Paint
+proc CG_Text_Paint 80 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgDC+240+12
+ASGNP4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $149
+ADDRLP4 28
+ADDRGP4 cgDC+240+20568
+ASGNP4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $154
+ADDRLP4 28
+ADDRGP4 cgDC+240+41124
+ASGNP4
+LABELV $154
+LABELV $150
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $159
+ADDRLP4 36
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32
+ADDRLP4 40
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LEI4 $161
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $161
+ADDRLP4 32
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $161
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $166
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $164
+JUMPV
+LABELV $166
+ADDRLP4 56
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $171
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $169
+LABELV $171
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $173
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+LABELV $174
+ADDRLP4 64
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 colorBlack+12
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintChar
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $169
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintChar
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $164
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $179
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $179
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $163
+LABELV $179
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $159
+LABELV $146
+endproc CG_Text_Paint 80 40
+export CG_Draw3DModelEx
+proc CG_Draw3DModelEx 620 16
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+EQI4 $185
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+NEI4 $181
+LABELV $185
+ADDRGP4 $180
+JUMPV
+LABELV $181
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 440
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 440
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 440+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 440+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 440+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 616
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 440+116
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 440+4
+CNSTI4 64
+ASGNI4
+ADDRFP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $191
+ADDRLP4 440+124
+ADDRFP4 32
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 440+124+1
+ADDRFP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 440+124+2
+ADDRFP4 32
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 440+124+3
+ADDRFP4 32
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $191
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 440
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $180
+endproc CG_Draw3DModelEx 620 16
+export CG_Draw3DModel
+proc CG_Draw3DModel 0 40
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModelEx
+CALLV
+pop
+LABELV $209
+endproc CG_Draw3DModel 0 40
+export CG_DrawHealthModel
+proc CG_DrawHealthModel 620 16
+ADDRFP4 40
+ADDRFP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+EQI4 $215
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 612
+INDIRI4
+NEI4 $211
+LABELV $215
+ADDRGP4 $210
+JUMPV
+LABELV $211
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 440
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 440
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 440+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 440+68
+ADDRFP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 440+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 616
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 440+116
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 440+4
+CNSTI4 64
+ASGNI4
+ADDRFP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $221
+ADDRLP4 440+124
+ADDRFP4 40
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 440+124+1
+ADDRFP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 440+124+2
+ADDRFP4 40
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 440+124+3
+ADDRFP4 40
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $221
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 440
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $239
+ADDRLP4 440+8
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 440+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 440
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $239
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $210
+endproc CG_DrawHealthModel 620 16
+export CG_DrawHead
+proc CG_DrawHead 84 40
+ADDRLP4 0
+CNSTI4 6112
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRGP4 $243
+JUMPV
+LABELV $248
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1060320051
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 816
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 16+1
+ADDRLP4 0
+INDIRP4
+CNSTI4 101
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 16+2
+ADDRLP4 0
+INDIRP4
+CNSTI4 102
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 72
+CNSTF4 1132396544
+ADDRLP4 48
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+LTF4 $266
+ADDRLP4 68
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 68
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $267
+ADDRLP4 16+3
+ADDRLP4 68
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw3DModelEx
+CALLV
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $268
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $268
+LABELV $246
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $271
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22180
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $271
+LABELV $243
+endproc CG_DrawHead 84 40
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 76 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $276
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $276
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+5042112+52
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+123084
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 72
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $293
+ADDRLP4 56
+ADDRGP4 cgs+5042112+52
+INDIRI4
+ASGNI4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $297
+ADDRLP4 56
+ADDRGP4 cgs+5042112+56
+INDIRI4
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $275
+ADDRLP4 56
+ADDRGP4 cgs+5042112+60
+INDIRI4
+ASGNI4
+LABELV $302
+LABELV $298
+LABELV $294
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $308
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $310
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $275
+CNSTI4 10
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $313
+LABELV $311
+LABELV $309
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $314
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 48
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $314
+LABELV $305
+LABELV $277
+LABELV $275
+endproc CG_DrawFlagModel 76 32
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $319
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $317
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $324
+LABELV $320
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 CG_GetScreenVerticalPlacement
+CALLI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+5042112+22176
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 CG_PopScreenPlacement
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $317
+endproc CG_DrawTeamBackground 20 20
+proc CG_DrawAttacker 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+123116+236
+INDIRI4
+CNSTI4 0
+GTI4 $330
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $329
+JUMPV
+LABELV $330
+ADDRGP4 cg+145048
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $329
+JUMPV
+LABELV $334
+ADDRLP4 0
+ADDRGP4 cg+123116+300+16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $344
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $344
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $340
+LABELV $344
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $329
+JUMPV
+LABELV $340
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $345
+ADDRGP4 cg+145048
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $329
+JUMPV
+LABELV $345
+ADDRLP4 24
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+145048
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10000
+LEI4 $351
+ADDRGP4 cg+145048
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $329
+JUMPV
+LABELV $351
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $329
+endproc CG_DrawAttacker 52 24
+proc CG_DrawSnapshot 16 16
+ADDRGP4 $358
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+60136
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $357
+endproc CG_DrawSnapshot 16 16
+bss
+align 4
+LABELV $363
+skip 16
+align 4
+LABELV $364
+skip 4
+align 4
+LABELV $365
+skip 4
+code
+proc CG_DrawFPS 56 16
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $365
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $364
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $363
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 $364
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $366
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $368
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $363
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $369
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $368
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $372
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $372
+ADDRLP4 24
+CNSTF4 1165623296
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $366
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $362
+endproc CG_DrawFPS 56 16
+proc CG_DrawTimer 56 16
+ADDRLP4 20
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+63356
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $375
+endproc CG_DrawTimer 56 16
+proc CG_DrawTeamOverlay 156 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $379
+JUMPV
+LABELV $380
+ADDRLP4 44
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $384
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+EQI4 $384
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $379
+JUMPV
+LABELV $384
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $387
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 100
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $388
+ADDRLP4 52
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $389
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $394
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $396
+ADDRLP4 60
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $396
+LABELV $394
+LABELV $390
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $392
+ADDRLP4 8
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $389
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $379
+JUMPV
+LABELV $398
+ADDRLP4 60
+INDIRI4
+CNSTI4 12
+LEI4 $400
+ADDRLP4 60
+CNSTI4 12
+ASGNI4
+LABELV $400
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $402
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $406
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $406
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $408
+ADDRLP4 48
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $408
+LABELV $406
+LABELV $403
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $402
+ADDRLP4 48
+INDIRI4
+CNSTI4 16
+LEI4 $410
+ADDRLP4 48
+CNSTI4 16
+ASGNI4
+LABELV $410
+ADDRLP4 84
+ADDRLP4 60
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+CNSTI4 32
+ADDI4
+CNSTI4 56
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 56
+CNSTI4 640
+ADDRLP4 84
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $413
+ADDRLP4 88
+CNSTF4 1090519040
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $414
+ADDRLP4 92
+ADDRFP4 0
+INDIRF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 92
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $415
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 108
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $417
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+5042112+22176
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $426
+ADDRLP4 4
+CNSTI4 6112
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $431
+ADDRLP4 112
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $440
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $438
+LABELV $440
+ADDRLP4 20
+ADDRGP4 $441
+ASGNP4
+LABELV $438
+ADDRLP4 132
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $436
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 132
+CNSTI4 3
+ASGNI4
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 64
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22180
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $444
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ADDRLP4 84
+INDIRI4
+ADDI4
+CNSTI4 8
+SUBI4
+ASGNI4
+LABELV $450
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $451
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $457
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 152
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $460
+LABELV $457
+LABELV $455
+LABELV $452
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LEI4 $451
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $431
+LABELV $427
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $429
+ADDRLP4 8
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $426
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $379
+endproc CG_DrawTeamOverlay 156 36
+proc CG_DrawUpperRight 16 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+CNSTI4 3
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $462
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 1
+NEI4 $462
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $462
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $466
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $469
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $472
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $469
+LABELV $472
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $469
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $473
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $476
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawAttacker
+CALLF4
+pop
+LABELV $476
+LABELV $461
+endproc CG_DrawUpperRight 16 12
+proc CG_DrawRealTimeClock 56 32
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 cg_drawClock+12
+INDIRI4
+CNSTI4 2
+NEI4 $480
+ADDRGP4 $483
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 DayAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRLP4 48
+ADDRGP4 $490
+ASGNP4
+ADDRLP4 44
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $492
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 44
+INDIRI4
+CNSTI4 12
+NEI4 $494
+ADDRLP4 48
+ADDRGP4 $496
+ASGNP4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 44
+INDIRI4
+CNSTI4 12
+LEI4 $497
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 12
+SUBI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 $496
+ASGNP4
+LABELV $497
+LABELV $495
+LABELV $493
+ADDRGP4 $499
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 DayAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 52
+INDIRP4
+ASGNP4
+LABELV $481
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTF4 1045220557
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 40
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $479
+endproc CG_DrawRealTimeClock 56 32
+proc CG_DrawBottomLineRight 4 8
+ADDRLP4 0
+CNSTF4 1139146752
+ASGNF4
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg_drawClock+12
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_DrawRealTimeClock
+CALLI4
+pop
+LABELV $506
+LABELV $505
+endproc CG_DrawBottomLineRight 4 8
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $510
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $516
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $515
+JUMPV
+LABELV $516
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $515
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 68 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $531
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+LEI4 $527
+LABELV $531
+ADDRGP4 $526
+JUMPV
+LABELV $527
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 $532
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 56
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $533
+ADDRGP4 $526
+JUMPV
+LABELV $533
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1135083520
+ASGNF4
+ADDRGP4 $536
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $526
+endproc CG_DrawDisconnect 68 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawLagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $542
+ADDRGP4 cgs+60144
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $538
+LABELV $542
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $538
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 336
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+22300
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $548
+JUMPV
+LABELV $545
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $550
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $552
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $552
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $555
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $555
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $559
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $561
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $561
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $564
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $564
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $559
+LABELV $551
+LABELV $546
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $548
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $545
+ADDRLP4 16
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $568
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $574
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $577
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $582
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $582
+LABELV $577
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $585
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $585
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $589
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $591
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $591
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+5042112+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $589
+LABELV $575
+LABELV $569
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $571
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $568
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $600
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $596
+LABELV $600
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 $601
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $596
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $537
+endproc CG_DrawLagometer 76 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+144000
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+143988
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 cg+143996
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+143992
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+145024
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+144000
+ASGNP4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $614
+ADDRLP4 4
+ADDRGP4 cg+145024
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $614
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $612
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $611
+LABELV $602
+endproc CG_CenterPrint 8 12
+proc CG_DrawCenterString 1072 32
+ADDRGP4 cg+143988
+INDIRI4
+CNSTI4 0
+NEI4 $618
+ADDRGP4 $617
+JUMPV
+LABELV $618
+ADDRGP4 cg+143988
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $623
+ADDRGP4 $617
+JUMPV
+LABELV $623
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+144000
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+143996
+INDIRI4
+CVIF4 4
+CNSTF4 1056964608
+ADDRGP4 cg+145024
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $629
+JUMPV
+LABELV $628
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $631
+ADDRLP4 1060
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRLP4 1060
+INDIRI4
+CNSTI4 10
+NEI4 $635
+LABELV $637
+ADDRGP4 $633
+JUMPV
+LABELV $635
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $632
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LTI4 $631
+LABELV $633
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 36
+ARGP4
+CNSTF4 1056964608
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1060
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1056964608
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1064
+ADDRGP4 CG_Text_Height
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+ADDI4
+ADDI4
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $639
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $641
+ADDRLP4 1068
+INDIRI4
+CNSTI4 10
+NEI4 $638
+LABELV $641
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $642
+ADDRGP4 $630
+JUMPV
+LABELV $642
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $629
+ADDRGP4 $628
+JUMPV
+LABELV $630
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $617
+endproc CG_DrawCenterString 1072 32
+proc CG_DrawCrosshair 44 20
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $645
+ADDRGP4 $644
+JUMPV
+LABELV $645
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $648
+ADDRGP4 $644
+JUMPV
+LABELV $648
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+EQI4 $651
+ADDRGP4 $644
+JUMPV
+LABELV $651
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $655
+JUMPV
+LABELV $654
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $655
+ADDRLP4 28
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $661
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $661
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22280
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1139802112
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $644
+endproc CG_DrawCrosshair 44 20
+proc CG_DrawCrosshair3D 284 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $666
+ADDRGP4 $665
+JUMPV
+LABELV $666
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $669
+ADDRGP4 $665
+JUMPV
+LABELV $669
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+EQI4 $672
+ADDRGP4 $665
+JUMPV
+LABELV $672
+ADDRLP4 256
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+GEI4 $677
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+LABELV $677
+ADDRLP4 264
+ADDRLP4 192
+INDIRI4
+CNSTI4 5
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+5042112+22280
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRGP4 cg_zProj+8
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 172
+INDIRF4
+ADDRGP4 cg_stereoSeparation+8
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg+125184+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 272
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 172
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+ADDRGP4 cgs+24196+35880
+INDIRI4
+CVIF4 4
+ADDRLP4 260
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 180
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRGP4 cg+125184+36
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+ADDRGP4 cg+125184+36+8
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+ARGP4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRLP4 280
+CNSTP4 0
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 180
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 200+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+152
+ADDRLP4 256
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDRLP4 200+8
+INDIRF4
+MULF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+120
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $665
+endproc CG_DrawCrosshair3D 284 28
+proc CG_ScanForCrosshairEntity 96 28
+ADDRLP4 56
+ADDRGP4 cg+125184+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+125184+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+125184+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $729
+ADDRGP4 $713
+JUMPV
+LABELV $729
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $733
+ADDRGP4 $713
+JUMPV
+LABELV $733
+CNSTI4 816
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $735
+ADDRGP4 $713
+JUMPV
+LABELV $735
+ADDRGP4 cg+145032
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+145036
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $713
+endproc CG_ScanForCrosshairEntity 96 28
+proc CG_DrawCrosshairNames 28 32
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $744
+ADDRGP4 $743
+JUMPV
+LABELV $744
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $747
+ADDRGP4 $743
+JUMPV
+LABELV $747
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRGP4 $743
+JUMPV
+LABELV $750
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+145036
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $754
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $743
+JUMPV
+LABELV $754
+ADDRLP4 4
+CNSTI4 6112
+ADDRGP4 cg+145032
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1050253722
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+CNSTF4 1128136704
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $743
+endproc CG_DrawCrosshairNames 28 32
+proc CG_DrawSpectator 0 16
+CNSTI4 1
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $760
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+NEI4 $761
+CNSTI4 200
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $764
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $765
+CNSTI4 8
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $768
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $765
+LABELV $762
+LABELV $759
+endproc CG_DrawSpectator 0 16
+proc CG_DrawVote 12 20
+ADDRGP4 cgs+60236
+INDIRI4
+CNSTI4 0
+NEI4 $770
+ADDRGP4 $769
+JUMPV
+LABELV $770
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+60248
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRGP4 cgs+60248
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+5042112+22708
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $773
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+60236
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $781
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $781
+ADDRGP4 $783
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+60252
+ARGP4
+ADDRGP4 cgs+60240
+INDIRI4
+ARGI4
+ADDRGP4 cgs+60244
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $787
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 76
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $769
+endproc CG_DrawVote 12 20
+proc CG_DrawTeamVote 24 20
+CNSTI4 6112
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $789
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $790
+JUMPV
+LABELV $789
+CNSTI4 6112
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $788
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $795
+LABELV $790
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61276
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $799
+ADDRGP4 $788
+JUMPV
+LABELV $799
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61300
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61300
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+5042112+22708
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $802
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61276
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $810
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $810
+ADDRGP4 $812
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+61308
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+61284
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+61292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $788
+endproc CG_DrawTeamVote 24 20
+data
+align 4
+LABELV $817
+byte 4 1
+code
+proc CG_DrawScoreboard 16 8
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $818
+ADDRLP4 4
+ADDRGP4 menuScoreboard
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -1048577
+BANDI4
+ASGNI4
+LABELV $818
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $817
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $816
+JUMPV
+LABELV $820
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 0
+NEI4 $824
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 5
+NEI4 $824
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $817
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $816
+JUMPV
+LABELV $824
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+145212
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $830
+ADDRGP4 cg+134976
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $830
+CNSTI4 0
+RETI4
+ADDRGP4 $816
+JUMPV
+LABELV $830
+ADDRGP4 cg+134976
+INDIRI4
+CNSTI4 0
+NEI4 $842
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 3
+EQI4 $842
+ADDRGP4 cg+123116+8
+INDIRI4
+CNSTI4 5
+NEI4 $834
+LABELV $842
+ADDRGP4 $835
+JUMPV
+LABELV $834
+ADDRGP4 cg+134984
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $843
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+134988
+CNSTI1 0
+ASGNI1
+ADDRGP4 $817
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $816
+JUMPV
+LABELV $843
+LABELV $835
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $848
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $850
+ADDRGP4 $853
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 menuScoreboard
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $851
+JUMPV
+LABELV $850
+ADDRGP4 $854
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 menuScoreboard
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $851
+LABELV $848
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $855
+ADDRGP4 $817
+INDIRI4
+CNSTI4 0
+EQI4 $857
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRGP4 $817
+CNSTI4 0
+ASGNI4
+LABELV $857
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $855
+ADDRLP4 8
+ADDRGP4 cg+16
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LEI4 $859
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $859
+CNSTI4 1
+RETI4
+LABELV $816
+endproc CG_DrawScoreboard 16 8
+proc CG_DrawIntermission 4 0
+ADDRGP4 cg+134984
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+134980
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $862
+endproc CG_DrawIntermission 4 0
+proc CG_DrawBotInfo 56 16
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $867
+CNSTI4 0
+RETI4
+ADDRGP4 $866
+JUMPV
+LABELV $867
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 864
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $871
+CNSTI4 0
+RETI4
+ADDRGP4 $866
+JUMPV
+LABELV $871
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $873
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $874
+ADDRLP4 4
+ADDRGP4 $876
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 174
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $874
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $877
+ADDRGP4 $879
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 192
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $877
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $880
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $881
+ADDRGP4 $883
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 210
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $881
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $885
+ADDRGP4 $887
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 228
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $885
+CNSTI4 1
+RETI4
+LABELV $866
+endproc CG_DrawBotInfo 56 16
+proc CG_DrawFollow 36 36
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $889
+CNSTI4 0
+RETI4
+ADDRGP4 $888
+JUMPV
+LABELV $889
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 248
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 $895
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 6112
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 CG_DrawBotInfo
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $888
+endproc CG_DrawFollow 36 36
+proc CG_DrawAmmoWarning 12 16
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $900
+ADDRGP4 $899
+JUMPV
+LABELV $900
+ADDRGP4 cg+145028
+INDIRI4
+CNSTI4 0
+NEI4 $903
+ADDRGP4 $899
+JUMPV
+LABELV $903
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+145028
+INDIRI4
+CNSTI4 2
+NEI4 $906
+ADDRLP4 0
+ADDRGP4 $909
+ASGNP4
+ADDRGP4 $907
+JUMPV
+LABELV $906
+ADDRLP4 0
+ADDRGP4 $910
+ASGNP4
+LABELV $907
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $899
+endproc CG_DrawAmmoWarning 12 16
+bss
+align 4
+LABELV $912
+skip 4
+code
+proc CG_DrawProxWarning 48 16
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $913
+ADDRGP4 $912
+CNSTI4 0
+ASGNI4
+ADDRGP4 $911
+JUMPV
+LABELV $913
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $912
+INDIRI4
+CNSTI4 0
+NEI4 $916
+ADDRGP4 $912
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $916
+ADDRLP4 32
+CNSTI4 10
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 $912
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $920
+ADDRLP4 32
+INDIRI4
+CNSTI4 5
+GTI4 $920
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $922
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $921
+JUMPV
+LABELV $920
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $923
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $921
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $911
+endproc CG_DrawProxWarning 48 16
+proc CG_DrawWarmup 48 32
+ADDRLP4 4
+ADDRGP4 cg+145212
+INDIRI4
+ASGNI4
+ADDRGP4 cg+145220
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $928
+ADDRGP4 $925
+JUMPV
+LABELV $928
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $930
+ADDRLP4 8
+ADDRGP4 $932
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+145216
+CNSTI4 0
+ASGNI4
+ADDRGP4 $925
+JUMPV
+LABELV $930
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+NEI4 $934
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $940
+JUMPV
+LABELV $937
+ADDRLP4 32
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+81820
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $942
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $942
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $947
+ADDRLP4 12
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRGP4 $948
+JUMPV
+LABELV $947
+ADDRLP4 20
+CNSTI4 6112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+LABELV $948
+LABELV $942
+LABELV $938
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $940
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $937
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $935
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $935
+ADDRGP4 $953
+ARGP4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1058642330
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+CNSTF4 1114636288
+ARGF4
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $935
+JUMPV
+LABELV $934
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 1
+NEI4 $954
+ADDRLP4 8
+ADDRGP4 $957
+ASGNP4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+NEI4 $958
+ADDRLP4 8
+ADDRGP4 $961
+ASGNP4
+ADDRGP4 $959
+JUMPV
+LABELV $958
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 4
+NEI4 $962
+ADDRLP4 8
+ADDRGP4 $965
+ASGNP4
+ADDRGP4 $963
+JUMPV
+LABELV $962
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 5
+NEI4 $966
+ADDRLP4 8
+ADDRGP4 $969
+ASGNP4
+ADDRGP4 $967
+JUMPV
+LABELV $966
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 6
+NEI4 $970
+ADDRLP4 8
+ADDRGP4 $973
+ASGNP4
+ADDRGP4 $971
+JUMPV
+LABELV $970
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+NEI4 $974
+ADDRLP4 8
+ADDRGP4 $977
+ASGNP4
+ADDRGP4 $975
+JUMPV
+LABELV $974
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 8
+NEI4 $978
+ADDRLP4 8
+ADDRGP4 $981
+ASGNP4
+ADDRGP4 $979
+JUMPV
+LABELV $978
+ADDRLP4 8
+ADDRGP4 $982
+ASGNP4
+LABELV $979
+LABELV $975
+LABELV $971
+LABELV $967
+LABELV $963
+LABELV $959
+LABELV $955
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1058642330
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $935
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+GEI4 $984
+ADDRGP4 cg+145220
+CNSTI4 1
+ASGNI4
+LABELV $984
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $987
+ADDRGP4 cg+145212
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $987
+ADDRGP4 $990
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+145216
+INDIRI4
+EQI4 $991
+ADDRGP4 cg+145216
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $996
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+GTI4 $996
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1015
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1015
+address $997
+address $1000
+address $1003
+address $996
+address $1006
+code
+LABELV $997
+ADDRGP4 cgs+5042112+22820
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $996
+JUMPV
+LABELV $1000
+ADDRGP4 cgs+5042112+22816
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $996
+JUMPV
+LABELV $1003
+ADDRGP4 cgs+5042112+22812
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $996
+JUMPV
+LABELV $1006
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $1007
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+GTI4 $1007
+ADDRGP4 cgs+5042112+22836
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $996
+JUMPV
+LABELV $1007
+ADDRGP4 cgs+5042112+22828
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $996
+LABELV $991
+ADDRLP4 32
+ADDRGP4 cg+145216
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1019
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+EQI4 $1020
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+EQI4 $1021
+ADDRGP4 $1016
+JUMPV
+LABELV $1019
+ADDRLP4 24
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $1017
+JUMPV
+LABELV $1020
+ADDRLP4 24
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $1017
+JUMPV
+LABELV $1021
+ADDRLP4 24
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $1017
+JUMPV
+LABELV $1016
+ADDRLP4 24
+CNSTF4 1055286886
+ASGNF4
+LABELV $1017
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTF4 1134559232
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+CNSTF4 1123680256
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $925
+endproc CG_DrawWarmup 48 32
+export CG_DrawTimedMenus
+proc CG_DrawTimedMenus 4 8
+ADDRGP4 cg+145052
+INDIRI4
+CNSTI4 0
+EQI4 $1023
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cg+145052
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2500
+LEI4 $1028
+ADDRGP4 $1030
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $1031
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 cg+145052
+CNSTI4 0
+ASGNI4
+LABELV $1028
+LABELV $1023
+LABELV $1022
+endproc CG_DrawTimedMenus 4 8
+proc CG_Draw2D 8 8
+ADDRGP4 cgs+474988
+INDIRI4
+CNSTI4 0
+EQI4 $1034
+ADDRGP4 cg+123084
+INDIRI4
+ADDRGP4 cgs+474992
+INDIRI4
+LEI4 $1034
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+LABELV $1034
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+ADDRGP4 $1033
+JUMPV
+LABELV $1039
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1042
+ADDRGP4 $1033
+JUMPV
+LABELV $1042
+ADDRGP4 CG_DrawBottomLineRight
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1045
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1033
+JUMPV
+LABELV $1045
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1048
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1051
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1051
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1049
+JUMPV
+LABELV $1048
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+134976
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1053
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1053
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1057
+CNSTI4 1
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 CG_DrawTimedMenus
+CALLV
+pop
+LABELV $1057
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRGP4 CG_DrawProxWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1060
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1060
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+LABELV $1053
+LABELV $1049
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $1062
+LABELV $1062
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+NEI4 $1065
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+LABELV $1065
+ADDRLP4 0
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1068
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+LABELV $1068
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+134980
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+134980
+INDIRI4
+CNSTI4 0
+NEI4 $1071
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1071
+LABELV $1033
+endproc CG_Draw2D 8 8
+export CG_FogView
+proc CG_FogView 8 28
+ADDRLP4 0
+ADDRGP4 cg+125184+76
+INDIRI4
+CNSTI4 2
+BANDI4
+ASGNI4
+ADDRGP4 cg+125184+24
+ARGP4
+ADDRGP4 cg+125184+368
+ARGP4
+ADDRGP4 cg+125184+372
+ARGP4
+ADDRGP4 cg+125184+384
+ARGP4
+ADDRGP4 cg+125184+388
+ARGP4
+ADDRGP4 cg+125184+436
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_GetViewFog
+CALLV
+pop
+ADDRGP4 cg+125184+368
+INDIRI4
+CNSTI4 0
+NEI4 $1089
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+125184+372
+INDIRF4
+ADDRLP4 4
+INDIRF4
+NEF4 $1102
+ADDRGP4 cg+125184+372+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+NEF4 $1102
+ADDRGP4 cg+125184+372+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+EQF4 $1089
+LABELV $1102
+ADDRGP4 cg+125184+368
+ADDRGP4 cgs+475044
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125184+384
+ADDRGP4 cgs+475060
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+388
+ADDRGP4 cgs+475064
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+436
+ADDRGP4 cgs+475068
+INDIRF4
+ASGNF4
+ADDRGP4 $1090
+JUMPV
+LABELV $1089
+ADDRGP4 cg+125184+368
+INDIRI4
+CNSTI4 0
+NEI4 $1115
+ADDRGP4 cg+125184+368
+ADDRGP4 cgs+475044
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125184+384
+ADDRGP4 cgs+475060
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+388
+ADDRGP4 cgs+475064
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+436
+ADDRGP4 cgs+475068
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184+372
+ADDRGP4 cgs+475048
+INDIRB
+ASGNB 12
+LABELV $1115
+LABELV $1090
+LABELV $1074
+endproc CG_FogView 8 28
+export CG_DrawMiscGamemodels
+proc CG_DrawMiscGamemodels 196 12
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1137
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4456
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1142
+ADDRLP4 188
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRGP4 cgs+475072+4408
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ADDRGP4 cgs+475072+4456
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 CG_CullPointAndRadius
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1146
+ADDRGP4 $1138
+JUMPV
+LABELV $1146
+LABELV $1142
+ADDRGP4 cg+125184+24
+ARGP4
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4408
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_inPVS
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $1152
+ADDRGP4 $1138
+JUMPV
+LABELV $1152
+ADDRLP4 8+68
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+88
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+12
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1167
+ADDRLP4 192
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 8+28
+ADDP4
+ADDRLP4 192
+INDIRI4
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4420
+ADDP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1168
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1167
+ADDRLP4 8+8
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 4460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+475072+4
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 8+116
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1138
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1140
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+130284
+INDIRI4
+LTI4 $1137
+LABELV $1134
+endproc CG_DrawMiscGamemodels 196 12
+export CG_DrawActive
+proc CG_DrawActive 0 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1180
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1179
+JUMPV
+LABELV $1180
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRGP4 CG_DrawMiscGamemodels
+CALLV
+pop
+ADDRGP4 CG_PB_RenderPolyBuffers
+CALLV
+pop
+ADDRGP4 CG_FogView
+CALLV
+pop
+ADDRGP4 cg+125184+432
+ADDRGP4 cg+130320
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125184
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1187
+ADDRGP4 CG_DrawCrosshair3D
+CALLV
+pop
+LABELV $1187
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+LABELV $1179
+endproc CG_DrawActive 0 4
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import cgDC
+import trap_PC_FreeSource
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Menu_FindItemByName
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_RequestFullScores
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+import drawTeamOverlayModificationCount
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_stereoSeparation
+import cg_zProj
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1031
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 88
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1030
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $990
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $982
+byte 1 0
+align 1
+LABELV $981
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $977
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $973
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $969
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $965
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $961
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $957
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $953
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $932
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $923
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 72
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 69
+byte 1 69
+byte 1 78
+byte 1 32
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 68
+byte 1 33
+byte 1 0
+align 1
+LABELV $922
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 77
+byte 1 66
+byte 1 85
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $910
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 33
+byte 1 0
+align 1
+LABELV $909
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 33
+byte 1 0
+align 1
+LABELV $895
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $887
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $884
+byte 1 99
+byte 1 0
+align 1
+LABELV $883
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $880
+byte 1 97
+byte 1 0
+align 1
+LABELV $879
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $876
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $873
+byte 1 108
+byte 1 0
+align 1
+LABELV $854
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $853
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $812
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $787
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $783
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $768
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $764
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $760
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $601
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $536
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $532
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 0
+align 1
+LABELV $499
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $496
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 0
+align 1
+LABELV $490
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $483
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $442
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $441
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $378
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $374
+byte 1 37
+byte 1 105
+byte 1 70
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $358
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 67
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $356
+byte 1 110
+byte 1 0
+align 1
+LABELV $94
+byte 1 83
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $93
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $92
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $91
+byte 1 87
+byte 1 101
+byte 1 100
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $90
+byte 1 84
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $89
+byte 1 77
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $88
+byte 1 83
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 0
@@ -0,0 +1,16927 @@
+data
+align 4
+LABELV cg_customSoundNames
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+skip 56
+export CG_CustomSound
+code
+proc CG_CustomSound 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $98
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $102
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $100
+LABELV $102
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $100
+ADDRLP4 4
+CNSTI4 6112
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $104
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $97
+JUMPV
+LABELV $108
+LABELV $105
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $107
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $110
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $104
+LABELV $110
+CNSTI4 0
+RETI4
+LABELV $97
+endproc CG_CustomSound 16 8
+export CG_CachePlayerSounds
+proc CG_CachePlayerSounds 72 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $112
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $116
+ADDRGP4 $114
+JUMPV
+LABELV $116
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $118
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $112
+LABELV $114
+LABELV $111
+endproc CG_CachePlayerSounds 72 20
+export CG_CachePlayerModels
+proc CG_CachePlayerModels 72 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $120
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $121
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $122
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $123
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $126
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $124
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+LABELV $126
+LABELV $119
+endproc CG_CachePlayerModels 72 20
+proc CG_ParseAnimationFile 20136 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 4948
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $129
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $129
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $131
+ADDRGP4 $133
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $131
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20044
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRLP4 20044
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 20044
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 20044
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $137
+ADDRGP4 $136
+JUMPV
+LABELV $137
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 20052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20052
+INDIRI4
+CNSTI4 0
+NEI4 $139
+ADDRLP4 12
+ARGP4
+ADDRLP4 20056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $142
+ADDRGP4 $136
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $144
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $147
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $150
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $153
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $156
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $159
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 20084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 0
+NEI4 $162
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $162
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 20088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20088
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $165
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 20092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20092
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $168
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 20096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20096
+INDIRI4
+CNSTI4 0
+NEI4 $171
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 20100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20100
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $174
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 20104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20104
+INDIRI4
+CNSTI4 0
+NEI4 $177
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $177
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 20108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20108
+INDIRI4
+CNSTI4 0
+NEI4 $180
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $185
+ARGP4
+ADDRLP4 20112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20112
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 20116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20116
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 20120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20120
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 15
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 20124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20124
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 20128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20128
+INDIRI4
+CNSTI4 0
+NEI4 $195
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 20132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20132
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 18
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $198
+ADDRGP4 $201
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $135
+JUMPV
+LABELV $139
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $202
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $205
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $135
+JUMPV
+LABELV $209
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20064
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDP4
+ADDRLP4 20064
+INDIRF4
+ASGNF4
+LABELV $206
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $205
+ADDRGP4 $135
+JUMPV
+LABELV $202
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $211
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $214
+ADDRGP4 $136
+JUMPV
+LABELV $214
+ADDRLP4 20068
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 102
+EQI4 $218
+ADDRLP4 20068
+INDIRI4
+CNSTI4 70
+NEI4 $216
+LABELV $218
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $216
+ADDRLP4 20072
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 110
+EQI4 $221
+ADDRLP4 20072
+INDIRI4
+CNSTI4 78
+NEI4 $219
+LABELV $221
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $219
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $211
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $222
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $225
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $225
+ADDRLP4 20072
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 48
+LTI4 $228
+ADDRLP4 20072
+INDIRI4
+CNSTI4 57
+GTI4 $228
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $136
+JUMPV
+LABELV $228
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $135
+ADDRGP4 $134
+JUMPV
+LABELV $136
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRLP4 12
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $235
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $233
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+GTI4 $233
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $235
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20052
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $239
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $239
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $241
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $241
+ADDRLP4 20060
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20060
+INDIRP4
+ADDRLP4 20060
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $241
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $233
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20064
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $245
+ADDRLP4 20068
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20068
+INDIRP4
+ADDRLP4 20068
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $245
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $247
+ADDRGP4 $233
+JUMPV
+LABELV $247
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20072
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20072
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20076
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $249
+ADDRGP4 $233
+JUMPV
+LABELV $249
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20080
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20080
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $251
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $251
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $232
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+LTI4 $231
+LABELV $233
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+EQI4 $253
+ADDRGP4 $255
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $253
+ADDRLP4 8
+INDIRP4
+CNSTI4 896
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 916
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 924
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 392
+ADDP4
+ARGP4
+CNSTU4 28
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 944
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 956
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 960
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 964
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 968
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 984
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 996
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1020
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $128
+endproc CG_ParseAnimationFile 20136 12
+proc CG_FileExists 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $257
+CNSTI4 1
+RETI4
+ADDRGP4 $256
+JUMPV
+LABELV $257
+CNSTI4 0
+RETI4
+LABELV $256
+endproc CG_FileExists 8 12
+proc CG_FindClientModelFile 28 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $260
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $266
+ADDRGP4 $263
+JUMPV
+LABELV $266
+ADDRLP4 4
+ADDRGP4 $267
+ASGNP4
+ADDRGP4 $261
+JUMPV
+LABELV $263
+ADDRLP4 4
+ADDRGP4 $268
+ASGNP4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 4
+ADDRGP4 $146
+ASGNP4
+LABELV $261
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $269
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $273
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $273
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $276
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $277
+CNSTI4 1
+RETI4
+ADDRGP4 $259
+JUMPV
+LABELV $277
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $279
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $282
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $282
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $284
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $286
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $286
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $284
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $287
+LABELV $280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $288
+CNSTI4 1
+RETI4
+ADDRGP4 $259
+JUMPV
+LABELV $288
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $292
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $290
+LABELV $292
+ADDRGP4 $271
+JUMPV
+LABELV $290
+LABELV $270
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $269
+LABELV $271
+CNSTI4 0
+RETI4
+LABELV $259
+endproc CG_FindClientModelFile 28 36
+proc CG_FindClientHeadFile 40 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $294
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRGP4 $297
+JUMPV
+LABELV $300
+ADDRLP4 8
+ADDRGP4 $267
+ASGNP4
+ADDRGP4 $295
+JUMPV
+LABELV $297
+ADDRLP4 8
+ADDRGP4 $268
+ASGNP4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 8
+ADDRGP4 $146
+ASGNP4
+LABELV $295
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $301
+ADDRLP4 4
+ADDRGP4 $303
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $301
+ADDRLP4 4
+ADDRGP4 $304
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $308
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $312
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $312
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $313
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $318
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $316
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $317
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $321
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $321
+LABELV $317
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $323
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $326
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $326
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+EQI4 $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $324
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $330
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $330
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+EQI4 $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $331
+LABELV $324
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $318
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 28
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $333
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $336
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $336
+LABELV $333
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $340
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $338
+LABELV $340
+ADDRGP4 $310
+JUMPV
+LABELV $338
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $308
+LABELV $310
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $341
+ADDRGP4 $307
+JUMPV
+LABELV $341
+ADDRLP4 4
+ADDRGP4 $303
+ASGNP4
+LABELV $306
+ADDRGP4 $305
+JUMPV
+LABELV $307
+CNSTI4 0
+RETI4
+LABELV $293
+endproc CG_FindClientHeadFile 40 40
+export CG_AddSkinToFrame
+proc CG_AddSkinToFrame 428 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $346
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $344
+LABELV $346
+CNSTI4 0
+RETI4
+ADDRGP4 $343
+JUMPV
+LABELV $344
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $348
+ADDRLP4 416
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 416
+CNSTF4 0
+ASGNF4
+LABELV $349
+ADDRLP4 8
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $350
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $354
+ADDRLP4 4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $356
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $357
+LABELV $355
+ADDRLP4 424
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 424
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 424
+INDIRI4
+LSHI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $353
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $350
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+RETI4
+LABELV $343
+endproc CG_AddSkinToFrame 428 8
+export CG_RegisterSkin
+proc CG_RegisterSkin 20212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $361
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $359
+LABELV $361
+ADDRGP4 $362
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20160
+INDIRU4
+CNSTU4 64
+LTU4 $363
+ADDRGP4 $365
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $363
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 20164
+ADDRGP4 COM_CompareExtension
+CALLI4
+ASGNI4
+ADDRLP4 20164
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRGP4 $369
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $366
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $370
+ADDRLP4 20152
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20148
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20172
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 20172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GTI4 $372
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $372
+ADDRLP4 144
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $374
+ADDRGP4 $133
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 20148
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $374
+ADDRLP4 148
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 20148
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 144
+INDIRI4
+ADDRLP4 148
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20148
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 148
+ASGNP4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 44
+ARGI4
+ADDRLP4 20176
+ADDRGP4 COM_ParseExt2
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20176
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $379
+ADDRGP4 $378
+JUMPV
+LABELV $379
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $381
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $381
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $385
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 20180
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20180
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRLP4 4
+ARGP4
+ADDRGP4 SkipRestOfLine
+CALLV
+pop
+ADDRGP4 $377
+JUMPV
+LABELV $383
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $388
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 20184
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20184
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 20188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20188
+INDIRI4
+CNSTI4 0
+NEI4 $386
+LABELV $390
+ADDRLP4 4
+ARGP4
+ADDRGP4 SkipRestOfLine
+CALLV
+pop
+ADDRGP4 $377
+JUMPV
+LABELV $386
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 100
+GEI4 $391
+ADDRLP4 20192
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $397
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $397
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 44
+ARGI4
+ADDRLP4 20196
+ADDRGP4 COM_ParseExt2
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20196
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $399
+ADDRGP4 $395
+JUMPV
+LABELV $399
+ADDRLP4 12
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20200
+ADDRGP4 trap_R_RegisterShaderEx
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20200
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $401
+ADDRLP4 8
+ADDRGP4 cgs+5042112+20
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRLP4 76
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20204
+ADDRGP4 trap_R_AllocSkinSurface
+CALLI4
+ASGNI4
+ADDRLP4 20192
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDP4
+ADDRLP4 20204
+INDIRI4
+ASGNI4
+LABELV $394
+ADDRLP4 20192
+ADDRLP4 20192
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20192
+INDIRI4
+CNSTI4 10
+LTI4 $393
+LABELV $395
+CNSTI4 44
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 40
+ADDP4
+ADDRLP4 20192
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $391
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $377
+ADDRLP4 20176
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20176
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $405
+ADDRLP4 20176
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $376
+LABELV $405
+LABELV $378
+ADDRLP4 140
+INDIRI4
+CNSTI4 100
+LEI4 $406
+ADDRGP4 $408
+ARGP4
+ADDRLP4 20180
+ADDRLP4 20152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 20180
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 100
+ADDRLP4 20180
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $406
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $409
+CNSTI4 0
+RETI4
+ADDRGP4 $358
+JUMPV
+LABELV $409
+CNSTI4 1
+RETI4
+LABELV $358
+endproc CG_RegisterSkin 20212 16
+proc CG_RegisterClientSkin 96 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 $415
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 84
+INDIRI4
+ASGNI4
+LABELV $412
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $418
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $416
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $421
+ARGP4
+ADDRGP4 $415
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 88
+INDIRI4
+ASGNI4
+LABELV $419
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRGP4 $424
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $422
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRGP4 $415
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_RegisterSkin
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 92
+INDIRI4
+ASGNI4
+LABELV $425
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRGP4 $430
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $428
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $434
+ADDRLP4 68
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $434
+ADDRLP4 72
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $431
+LABELV $434
+CNSTI4 0
+RETI4
+ADDRGP4 $411
+JUMPV
+LABELV $431
+CNSTI4 1
+RETI4
+LABELV $411
+endproc CG_RegisterClientSkin 96 32
+proc CG_RegisterClientModelname 160 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $436
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $437
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $120
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRGP4 $440
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $438
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $121
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $441
+ADDRGP4 $440
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $441
+ADDRLP4 64
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $443
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $444
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $445
+ADDRLP4 64
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $445
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $124
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $447
+ADDRGP4 $440
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $449
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $451
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $451
+ADDRGP4 $453
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $454
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $456
+ARGP4
+ADDRGP4 $457
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $456
+ARGP4
+ADDRGP4 $458
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $453
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $451
+ADDRGP4 $461
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $452
+LABELV $449
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $462
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRGP4 $465
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $463
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRGP4 $318
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $469
+ADDRGP4 $471
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $472
+CNSTI4 0
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $472
+LABELV $469
+CNSTI4 1
+RETI4
+LABELV $435
+endproc CG_RegisterClientModelname 160 32
+export CG_ColorFromIndex
+proc CG_ColorFromIndex 12 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $476
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $476
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $491-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $491
+address $478
+address $478
+address $478
+address $478
+address $478
+address $478
+address $478
+address $485
+address $486
+address $487
+address $488
+address $489
+address $490
+code
+LABELV $478
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $479
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $479
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $481
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $481
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $477
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $485
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $486
+ADDRFP4 4
+INDIRP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $487
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $488
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $489
+ADDRFP4 4
+INDIRP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $490
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $477
+LABELV $475
+endproc CG_ColorFromIndex 12 0
+proc CG_ColorFromString 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_ColorFromIndex
+CALLV
+pop
+LABELV $493
+endproc CG_ColorFromString 8 8
+proc CG_LoadClientInfo 148 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $495
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $498
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $499
+LABELV $495
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $502
+ADDRLP4 20
+ARGP4
+ADDRGP4 $504
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $502
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 356
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRGP4 $510
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 356
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $507
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $511
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $514
+ADDRLP4 20
+ARGP4
+ADDRGP4 $457
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRLP4 20
+ARGP4
+ADDRGP4 $458
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $515
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRGP4 $520
+ARGP4
+ADDRGP4 $518
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 $523
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $146
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $521
+ADDRGP4 $524
+ARGP4
+ADDRGP4 $523
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $521
+LABELV $512
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $505
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRLP4 92
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $529
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $527
+LABELV $525
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ASGNP4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $530
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $535
+ADDRLP4 92
+ADDRGP4 $533
+ASGNP4
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 92
+ADDRGP4 $518
+ASGNP4
+LABELV $536
+ADDRLP4 16
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $539
+ADDRLP4 92
+ADDRGP4 $537
+ASGNP4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRLP4 92
+ADDRGP4 $523
+ASGNP4
+LABELV $540
+ADDRLP4 16
+ADDRLP4 92
+INDIRP4
+ASGNP4
+LABELV $531
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $541
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $545
+ADDRGP4 $543
+JUMPV
+LABELV $545
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $547
+ADDRGP4 $118
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $547
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $549
+ADDRGP4 $118
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5984
+ADDP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $549
+LABELV $542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $541
+LABELV $543
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $551
+ADDRLP4 92
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 cg_entities+196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $555
+ADDRLP4 92
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $555
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $555
+LABELV $552
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $551
+LABELV $494
+endproc CG_LoadClientInfo 148 24
+proc CG_CopyClientInfoModel 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 500
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 512
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 524
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 528
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 532
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 536
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 540
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 4404
+ADDRLP4 28
+CNSTI4 4944
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 488
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 4948
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 1036
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 40
+CNSTI4 5984
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $559
+endproc CG_CopyClientInfoModel 44 12
+proc CG_ScanForExistingClientInfo 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $561
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRGP4 $562
+JUMPV
+LABELV $567
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $569
+ADDRGP4 $562
+JUMPV
+LABELV $569
+ADDRLP4 8
+CNSTI4 164
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRLP4 16
+CNSTI4 228
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRLP4 24
+CNSTI4 292
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRLP4 32
+CNSTI4 356
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRLP4 40
+CNSTI4 452
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRLP4 48
+CNSTI4 420
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 3
+LTI4 $574
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $571
+LABELV $574
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $571
+LABELV $562
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $564
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $561
+CNSTI4 0
+RETI4
+LABELV $560
+endproc CG_ScanForExistingClientInfo 60 8
+proc CG_SetDeferredClientInfo 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $576
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $584
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $582
+LABELV $584
+ADDRGP4 $577
+JUMPV
+LABELV $582
+ADDRLP4 16
+CNSTI4 228
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $589
+ADDRLP4 24
+CNSTI4 164
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $589
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $585
+ADDRLP4 32
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $585
+LABELV $589
+ADDRGP4 $577
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $577
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $579
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $576
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $590
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $596
+JUMPV
+LABELV $593
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $601
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $599
+LABELV $601
+ADDRGP4 $594
+JUMPV
+LABELV $599
+ADDRLP4 16
+CNSTI4 228
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $602
+ADDRLP4 24
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $602
+LABELV $605
+ADDRGP4 $594
+JUMPV
+LABELV $602
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $594
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $596
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $593
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $590
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $606
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $612
+ADDRGP4 $607
+JUMPV
+LABELV $612
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $607
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $609
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $606
+ADDRGP4 $614
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $575
+endproc CG_SetDeferredClientInfo 36 8
+export CG_NewClientInfo
+proc CG_NewClientInfo 6296 12
+ADDRLP4 6128
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 6124
+CNSTI4 6112
+ADDRLP4 6128
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 6128
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 6132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 6116
+ADDRLP4 6132
+INDIRP4
+ASGNP4
+ADDRLP4 6116
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $617
+ADDRLP4 6124
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $615
+JUMPV
+LABELV $617
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6112
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $619
+ARGP4
+ADDRLP4 6136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6136
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $622
+ARGP4
+ADDRLP4 6140
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6140
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 6144
+INDIRI4
+ASGNI4
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $624
+ARGP4
+ADDRLP4 6148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6148
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+136
+ADDRLP4 6152
+INDIRI4
+ASGNI4
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $626
+ARGP4
+ADDRLP4 6156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6156
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+148
+ADDRLP4 6160
+INDIRI4
+ASGNI4
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 6164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6164
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+140
+ADDRLP4 6168
+INDIRI4
+ASGNI4
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $630
+ARGP4
+ADDRLP4 6172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6172
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+144
+ADDRLP4 6176
+INDIRI4
+ASGNI4
+ADDRLP4 0+420
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+452
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $636
+ARGP4
+ADDRLP4 6180
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6180
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $640
+ADDRLP4 0+164
+ARGP4
+ADDRGP4 $518
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+228
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRGP4 $636
+ARGP4
+ADDRLP4 6184
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 6184
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 6252
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 6248
+ADDRLP4 6252
+INDIRP4
+ASGNP4
+ADDRLP4 6252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $647
+ADDRLP4 6248
+ADDRGP4 $146
+ASGNP4
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRLP4 6256
+ADDRLP4 6248
+INDIRP4
+ASGNP4
+ADDRLP4 6248
+ADDRLP4 6256
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 6256
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $648
+ADDRLP4 0+164
+ARGP4
+ADDRLP4 6184
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+228
+ARGP4
+ADDRLP4 6248
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $641
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $638
+ADDRLP4 6112
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 6252
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 6120
+ADDRLP4 6252
+INDIRP4
+ASGNP4
+ADDRLP4 6120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $638
+ADDRLP4 0+228
+ARGP4
+ADDRLP4 6120
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $638
+JUMPV
+LABELV $637
+ADDRLP4 0+164
+ARGP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+164
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 6184
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 6120
+ADDRLP4 6184
+INDIRP4
+ASGNP4
+ADDRLP4 6120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $663
+ADDRLP4 0+228
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 0+228
+ARGP4
+ADDRLP4 6120
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 6120
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $664
+LABELV $638
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $669
+ARGP4
+ADDRLP4 6184
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6184
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $670
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $673
+ADDRLP4 0+292
+ARGP4
+ADDRGP4 $519
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+356
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRGP4 $680
+ARGP4
+ADDRLP4 6188
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 6188
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 6256
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 6252
+ADDRLP4 6256
+INDIRP4
+ASGNP4
+ADDRLP4 6256
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $681
+ADDRLP4 6252
+ADDRGP4 $146
+ASGNP4
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRLP4 6260
+ADDRLP4 6252
+INDIRP4
+ASGNP4
+ADDRLP4 6252
+ADDRLP4 6260
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 6260
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $682
+ADDRLP4 0+292
+ARGP4
+ADDRLP4 6188
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+356
+ARGP4
+ADDRLP4 6252
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $674
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $671
+ADDRLP4 6112
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 6256
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 6120
+ADDRLP4 6256
+INDIRP4
+ASGNP4
+ADDRLP4 6120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $671
+ADDRLP4 0+356
+ARGP4
+ADDRLP4 6120
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRLP4 0+292
+ARGP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+292
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 6188
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 6120
+ADDRLP4 6188
+INDIRP4
+ASGNP4
+ADDRLP4 6120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $697
+ADDRLP4 0+356
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 0+356
+ARGP4
+ADDRLP4 6120
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 6120
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $698
+LABELV $671
+ADDRLP4 0
+ARGP4
+ADDRLP4 6188
+ADDRGP4 CG_ScanForExistingClientInfo
+CALLI4
+ASGNI4
+ADDRLP4 6188
+INDIRI4
+CNSTI4 0
+NEI4 $703
+ADDRLP4 6200
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 6200
+INDIRI4
+CNSTI4 4000000
+GEI4 $706
+ADDRLP4 6196
+CNSTI4 1
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRLP4 6196
+CNSTI4 0
+ASGNI4
+LABELV $707
+ADDRLP4 6192
+ADDRLP4 6196
+INDIRI4
+ASGNI4
+ADDRLP4 6204
+CNSTI4 0
+ASGNI4
+ADDRLP4 6192
+INDIRI4
+ADDRLP4 6204
+INDIRI4
+NEI4 $713
+ADDRGP4 cg_deferPlayers+12
+INDIRI4
+ADDRLP4 6204
+INDIRI4
+EQI4 $708
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 6204
+INDIRI4
+NEI4 $708
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 6204
+INDIRI4
+NEI4 $708
+LABELV $713
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_SetDeferredClientInfo
+CALLV
+pop
+ADDRLP4 6192
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRGP4 $716
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0+484
+CNSTI4 0
+ASGNI4
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $709
+LABELV $703
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $718
+ARGP4
+ADDRLP4 6192
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6192
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 0+76
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 6200
+CNSTF4 1132396544
+ADDRLP4 0+76
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 6204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 6200
+INDIRF4
+ADDRLP4 6204
+INDIRF4
+LTF4 $723
+ADDRLP4 6196
+ADDRLP4 6200
+INDIRF4
+ADDRLP4 6204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRLP4 6196
+ADDRLP4 6200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $724
+ADDRLP4 0+100
+ADDRLP4 6196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 6212
+CNSTF4 1132396544
+ADDRLP4 0+76+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 6216
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 6212
+INDIRF4
+ADDRLP4 6216
+INDIRF4
+LTF4 $730
+ADDRLP4 6208
+ADDRLP4 6212
+INDIRF4
+ADDRLP4 6216
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 6208
+ADDRLP4 6212
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $731
+ADDRLP4 0+100+1
+ADDRLP4 6208
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 6224
+CNSTF4 1132396544
+ADDRLP4 0+76+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 6228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 6224
+INDIRF4
+ADDRLP4 6228
+INDIRF4
+LTF4 $737
+ADDRLP4 6220
+ADDRLP4 6224
+INDIRF4
+ADDRLP4 6228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $738
+JUMPV
+LABELV $737
+ADDRLP4 6220
+ADDRLP4 6224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $738
+ADDRLP4 0+100+2
+ADDRLP4 6220
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+100+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $741
+ARGP4
+ADDRLP4 6232
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6232
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 0+88
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 6240
+CNSTF4 1132396544
+ADDRLP4 0+88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 6244
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 6240
+INDIRF4
+ADDRLP4 6244
+INDIRF4
+LTF4 $746
+ADDRLP4 6236
+ADDRLP4 6240
+INDIRF4
+ADDRLP4 6244
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 6236
+ADDRLP4 6240
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $747
+ADDRLP4 0+104
+ADDRLP4 6236
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 6252
+CNSTF4 1132396544
+ADDRLP4 0+88+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 6256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 6252
+INDIRF4
+ADDRLP4 6256
+INDIRF4
+LTF4 $753
+ADDRLP4 6248
+ADDRLP4 6252
+INDIRF4
+ADDRLP4 6256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRLP4 6248
+ADDRLP4 6252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $754
+ADDRLP4 0+104+1
+ADDRLP4 6248
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 6264
+CNSTF4 1132396544
+ADDRLP4 0+88+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 6268
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 6264
+INDIRF4
+ADDRLP4 6268
+INDIRF4
+LTF4 $760
+ADDRLP4 6260
+ADDRLP4 6264
+INDIRF4
+ADDRLP4 6268
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRLP4 6260
+ADDRLP4 6264
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $761
+ADDRLP4 0+104+2
+ADDRLP4 6260
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+104+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $764
+ARGP4
+ADDRLP4 6272
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6272
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+128
+ADDRLP4 6276
+INDIRI4
+ASGNI4
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 6280
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6280
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6284
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+132
+ADDRLP4 6284
+INDIRI4
+ASGNI4
+ADDRLP4 6116
+INDIRP4
+ARGP4
+ADDRGP4 $768
+ARGP4
+ADDRLP4 6288
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6112
+ADDRLP4 6288
+INDIRP4
+ASGNP4
+ADDRLP4 6112
+INDIRP4
+ARGP4
+ADDRLP4 6292
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+72
+ADDRLP4 6292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 6124
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 6112
+LABELV $615
+endproc CG_NewClientInfo 6296 12
+export CG_LoadDeferredPlayers
+proc CG_LoadDeferredPlayers 20 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+81820
+ASGNP4
+ADDRGP4 $774
+JUMPV
+LABELV $771
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $777
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $777
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $779
+ADDRGP4 $716
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $772
+JUMPV
+LABELV $779
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $777
+LABELV $772
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ASGNP4
+LABELV $774
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+60168
+INDIRI4
+LTI4 $771
+LABELV $770
+endproc CG_LoadDeferredPlayers 20 8
+proc CG_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $784
+ADDRFP4 8
+INDIRI4
+CNSTI4 37
+LTI4 $782
+LABELV $784
+ADDRGP4 $785
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $782
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $786
+ADDRGP4 $789
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $786
+LABELV $781
+endproc CG_SetLerpFrameAnimation 12 8
+proc CG_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_animSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $791
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $790
+JUMPV
+LABELV $791
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $796
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $794
+LABELV $796
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $794
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $797
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $800
+ADDRGP4 $790
+JUMPV
+LABELV $800
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $802
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $803
+JUMPV
+LABELV $802
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $803
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $805
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $805
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $807
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $809
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $810
+JUMPV
+LABELV $809
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $810
+LABELV $807
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $812
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $812
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $814
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $814
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $815
+LABELV $813
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $816
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRGP4 $823
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $820
+LABELV $816
+LABELV $797
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $824
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $824
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+LEI4 $828
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $828
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $832
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $833
+JUMPV
+LABELV $832
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $833
+LABELV $790
+endproc CG_RunLerpFrame 48 12
+proc CG_ClearLerpFrame 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $835
+endproc CG_ClearLerpFrame 16 12
+proc CG_PlayerAnimation 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_noPlayerAnims+12
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $837
+JUMPV
+LABELV $838
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $841
+ADDRLP4 4
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $842
+JUMPV
+LABELV $841
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $842
+ADDRLP4 0
+CNSTI4 6112
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $844
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $844
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $845
+JUMPV
+LABELV $844
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $845
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $837
+endproc CG_PlayerAnimation 20 16
+proc CG_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $847
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $851
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $849
+LABELV $851
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $849
+LABELV $847
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $852
+ADDRGP4 $846
+JUMPV
+LABELV $852
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $854
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $856
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $857
+JUMPV
+LABELV $856
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $857
+LABELV $855
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $858
+ADDRLP4 8
+ADDRGP4 cg+123080
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $861
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $861
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $859
+JUMPV
+LABELV $858
+ADDRLP4 8
+ADDRGP4 cg+123080
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $864
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $864
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $859
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $866
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $867
+JUMPV
+LABELV $866
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $868
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $868
+LABELV $867
+LABELV $846
+endproc CG_SwingAngles 28 8
+proc CG_AddPainTwitch 12 0
+ADDRLP4 0
+ADDRGP4 cg+123084
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $872
+ADDRGP4 $870
+JUMPV
+LABELV $872
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $874
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $875
+JUMPV
+LABELV $874
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $875
+LABELV $870
+endproc CG_AddPainTwitch 12 0
+data
+align 4
+LABELV $877
+byte 4 0
+byte 4 22
+byte 4 45
+byte 4 -22
+byte 4 0
+byte 4 22
+byte 4 -45
+byte 4 -22
+code
+proc CG_PlayerAngles 104 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $886
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 11
+EQI4 $884
+ADDRLP4 72
+INDIRI4
+CNSTI4 12
+EQI4 $884
+LABELV $886
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $884
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $887
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $888
+JUMPV
+LABELV $887
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $891
+ADDRLP4 40
+INDIRI4
+CNSTI4 7
+LEI4 $889
+LABELV $891
+ADDRGP4 $892
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $889
+LABELV $888
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $877
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $877
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $903
+ADDRLP4 44
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $904
+JUMPV
+LABELV $903
+ADDRLP4 44
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $904
+ADDRLP4 44
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $905
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $905
+ADDRLP4 48
+CNSTI4 6112
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $908
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $908
+LABELV $905
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $910
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $910
+ADDRLP4 48
+CNSTI4 6112
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $913
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 100
+INDIRF4
+ASGNF4
+LABELV $913
+LABELV $910
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPainTwitch
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $876
+endproc CG_PlayerAngles 104 24
+lit
+align 4
+LABELV $919
+byte 4 0
+skip 28
+code
+proc CG_BreathPuff 64 48
+ADDRLP4 4
+ADDRGP4 $919
+INDIRB
+ASGNB 32
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+BANDI4
+CNSTI4 0
+EQI4 $920
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1084227584
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1077936128
+ADDF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_SpawnBubbles
+CALLI4
+pop
+ADDRGP4 $921
+JUMPV
+LABELV $920
+ADDRGP4 cg_enableBreath+12
+INDIRI4
+CNSTI4 0
+EQI4 $922
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 56
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1059648963
+ARGF4
+CNSTF4 1153138688
+ARGF4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 400
+ADDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+5042112+22316
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+LABELV $922
+LABELV $921
+LABELV $918
+endproc CG_BreathPuff 64 48
+proc CG_AddBreathPuffs 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $932
+ADDRGP4 $931
+JUMPV
+LABELV $932
+ADDRLP4 12
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $935
+ADDRGP4 $931
+JUMPV
+LABELV $935
+ADDRLP4 12
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+LEI4 $937
+ADDRGP4 $931
+JUMPV
+LABELV $937
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $940
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+NEI4 $940
+ADDRLP4 20
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+125184+24
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+125184+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+125184+24+4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+125184+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 cg+125184+24+8
+INDIRF4
+CNSTF4 1101004800
+ADDRGP4 cg+125184+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+125184+36+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+125184+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3229614080
+ADDRGP4 cg+125184+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+125184+36
+ARGP4
+ADDRGP4 CG_BreathPuff
+CALLV
+pop
+LABELV $940
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3229614080
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 CG_BreathPuff
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $931
+endproc CG_AddBreathPuffs 40 12
+proc CG_DustTrail 116 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 0
+NEI4 $987
+ADDRGP4 $986
+JUMPV
+LABELV $987
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+LEI4 $990
+ADDRGP4 $986
+JUMPV
+LABELV $990
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 21
+EQI4 $993
+ADDRLP4 80
+INDIRI4
+CNSTI4 19
+EQI4 $993
+ADDRGP4 $986
+JUMPV
+LABELV $993
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+ADDRGP4 cg+123084
+INDIRI4
+GEI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ADDRGP4 cg+123084
+INDIRI4
+ASGNI4
+LABELV $995
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 267386880
+ASGNI4
+ADDRLP4 12+44
+INDIRI4
+ADDRLP4 100
+INDIRI4
+BANDI4
+CNSTI4 36700160
+EQI4 $1000
+ADDRLP4 12+44
+INDIRI4
+ADDRLP4 100
+INDIRI4
+BANDI4
+CNSTI4 37748736
+EQI4 $1000
+ADDRLP4 12+44
+INDIRI4
+ADDRLP4 100
+INDIRI4
+BANDI4
+CNSTI4 38797312
+EQI4 $1000
+ADDRLP4 12+44
+INDIRI4
+ADDRLP4 100
+INDIRI4
+BANDI4
+CNSTI4 39845888
+EQI4 $1000
+ADDRGP4 $986
+JUMPV
+LABELV $1000
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 3253731328
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 108
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+CNSTF4 1060320051
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 cgs+5042112+22544
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $986
+endproc CG_DustTrail 116 48
+proc CG_TrailItem 224 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 220
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 172+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1012
+endproc CG_TrailItem 224 12
+proc CG_PlayerFlag 424 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+5042112+104
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $529
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172+8
+ADDRGP4 cgs+5042112+108
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 172+116
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRLP4 172+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 172+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 400
+CNSTF4 0
+ASGNF4
+ADDRLP4 344+8
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 344+4
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 376
+CNSTI4 0
+ASGNI4
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 22
+EQI4 $1044
+ADDRLP4 368
+INDIRI4
+CNSTI4 23
+NEI4 $1042
+LABELV $1044
+ADDRLP4 384
+CNSTI4 35
+ASGNI4
+ADDRGP4 $1043
+JUMPV
+LABELV $1042
+ADDRLP4 368
+INDIRI4
+CNSTI4 14
+EQI4 $1047
+ADDRLP4 368
+INDIRI4
+CNSTI4 13
+NEI4 $1045
+LABELV $1047
+ADDRLP4 384
+CNSTI4 35
+ASGNI4
+ADDRLP4 376
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1046
+JUMPV
+LABELV $1045
+ADDRLP4 384
+CNSTI4 34
+ASGNI4
+ADDRLP4 376
+CNSTI4 1
+ASGNI4
+LABELV $1046
+LABELV $1043
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 356+8
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 356
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 372
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+ARGF4
+ADDRLP4 412
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 412
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1061
+ADDRLP4 372
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1070
+ADDRLP4 372
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1071
+JUMPV
+LABELV $1070
+ADDRLP4 372
+INDIRF4
+CNSTF4 3212836864
+GEF4 $1072
+ADDRLP4 372
+CNSTF4 3212836864
+ASGNF4
+LABELV $1072
+LABELV $1071
+ADDRLP4 372
+INDIRF4
+ARGF4
+ADDRLP4 416
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 388
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 356
+INDIRF4
+MULF4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 356+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 356+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 0
+GEF4 $1084
+ADDRLP4 344+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 388
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1084
+ADDRLP4 344+4
+CNSTF4 1127481344
+ADDRLP4 388
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $1085
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 0
+GEF4 $1088
+ADDRLP4 344+4
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1088
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1092
+ADDRLP4 344+4
+ADDRLP4 344+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1092
+ADDRLP4 344+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1041865114
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $1061
+LABELV $1048
+ADDRLP4 344+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 380
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ARGP4
+ADDRLP4 384
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRLP4 172+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+80
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+108
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 172+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $529
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLI4
+pop
+ADDRLP4 172
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1026
+endproc CG_PlayerFlag 424 24
+proc CG_PlayerTokens 232 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1105
+ADDRGP4 $1104
+JUMPV
+LABELV $1105
+ADDRLP4 4
+CNSTI4 124
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+136052
+ADDP4
+ASGNP4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $1108
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1104
+JUMPV
+LABELV $1108
+ADDRLP4 212
+INDIRI4
+CNSTI4 10
+LEI4 $1110
+ADDRLP4 212
+CNSTI4 10
+ASGNI4
+LABELV $1110
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1115
+JUMPV
+LABELV $1112
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1119
+JUMPV
+LABELV $1116
+ADDRLP4 220
+CNSTI4 12
+ASGNI4
+ADDRLP4 224
+ADDRLP4 220
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 220
+INDIRI4
+SUBI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1119
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1116
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1113
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1115
+ADDRLP4 8
+INDIRI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+LTI4 $1112
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1123
+JUMPV
+LABELV $1120
+ADDRLP4 220
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 220
+INDIRP4
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196+4
+ADDRLP4 220
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 184+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196+8
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 184+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ARGP4
+ADDRLP4 224
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 224
+INDIRF4
+CNSTF4 1106247680
+LEF4 $1128
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 184+4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 196+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 196+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1128
+ADDRLP4 184
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1121
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1123
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1120
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1134
+ADDRLP4 12+8
+ADDRGP4 cgs+5042112+36
+INDIRI4
+ASGNI4
+ADDRGP4 $1135
+JUMPV
+LABELV $1134
+ADDRLP4 12+8
+ADDRGP4 cgs+5042112+40
+INDIRI4
+ASGNI4
+LABELV $1135
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1148
+JUMPV
+LABELV $1145
+ADDRLP4 12+28
+ADDRLP4 184
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+4
+ADDRLP4 184+4
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+ADDRLP4 184+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRLP4 12+28+24
+ARGP4
+ADDRLP4 12+28+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 12+68
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 208
+CNSTF4 1086918619
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 5000
+ADDI4
+CNSTI4 500
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+CNSTI4 16
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+68+8
+ADDRLP4 12+68+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 220
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1146
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1148
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1145
+LABELV $1104
+endproc CG_PlayerTokens 232 12
+proc CG_PlayerPowerups 20 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1177
+ADDRGP4 $1176
+JUMPV
+LABELV $1177
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1179
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1179
+ADDRLP4 4
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1182
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+5042112+112
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1185
+JUMPV
+LABELV $1184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+5042112+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1185
+LABELV $1182
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1190
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+5042112+4516
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+5042112+56
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1193
+LABELV $1190
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1198
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+5042112+8920
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1201
+JUMPV
+LABELV $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+5042112+60
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1201
+LABELV $1198
+LABELV $1176
+endproc CG_PlayerPowerups 20 28
+proc CG_PlayerFloatSprite 172 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+120
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0+152
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+124
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1206
+endproc CG_PlayerFloatSprite 172 12
+proc CG_PlayerSprites 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 6112
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1109917696
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $1221
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+NEI4 $1224
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1222
+JUMPV
+LABELV $1224
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $1222
+ADDRGP4 cg_drawDebug+12
+INDIRI4
+CNSTI4 1
+NEI4 $1227
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1228
+ADDRLP4 20
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ObstacleHandle
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1227
+ADDRGP4 cg_drawDebug+12
+INDIRI4
+CNSTI4 2
+NEI4 $1232
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1233
+ADDRLP4 20
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_NodeHandle
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1232
+ADDRGP4 cg_drawDebug+12
+INDIRI4
+CNSTI4 3
+NEI4 $1237
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $1240
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1243
+ADDRLP4 20
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1243
+LABELV $1240
+LABELV $1237
+LABELV $1233
+LABELV $1228
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1245
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 cgs+5042112+22260
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1245
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1249
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 cgs+5042112+22256
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1249
+ADDRLP4 16
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1255
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1255
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 2
+LEI4 $1255
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $1218
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $1262
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+5042112+22252
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1218
+JUMPV
+LABELV $1262
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+5042112+22248
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+LABELV $1255
+LABELV $1218
+endproc CG_PlayerSprites 40 12
+lit
+align 4
+LABELV $1269
+byte 4 3245342720
+byte 4 3245342720
+byte 4 0
+align 4
+LABELV $1270
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc CG_PlayerShadow 108 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $1269
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 $1270
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1271
+CNSTI4 0
+RETI4
+ADDRGP4 $1268
+JUMPV
+LABELV $1271
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1274
+CNSTI4 0
+RETI4
+ADDRGP4 $1268
+JUMPV
+LABELV $1274
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1282
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $1282
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $1277
+LABELV $1282
+CNSTI4 0
+RETI4
+ADDRGP4 $1268
+JUMPV
+LABELV $1277
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+EQI4 $1285
+CNSTI4 1
+RETI4
+ADDRGP4 $1268
+JUMPV
+LABELV $1285
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+ADDRLP4 100
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+5042112+22384
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1103101952
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1268
+endproc CG_PlayerShadow 108 44
+proc CG_PlayerSplash 200 28
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1294
+ADDRGP4 $1293
+JUMPV
+LABELV $1294
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1298
+ADDRGP4 $1293
+JUMPV
+LABELV $1298
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+EQI4 $1301
+ADDRGP4 $1293
+JUMPV
+LABELV $1301
+ADDRLP4 96
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1303
+ADDRGP4 $1293
+JUMPV
+LABELV $1303
+ADDRLP4 0
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 192
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 0+48
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 0+48+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 0+72
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 0+72+4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+5042112+22408
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1293
+endproc CG_PlayerSplash 200 28
+export CG_AddRefEntityWithPowerups
+proc CG_AddRefEntityWithPowerups 0 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1384
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1386
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cgs+5042112+22440
+INDIRI4
+ASGNI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1386
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1390
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cgs+5042112+22444
+INDIRI4
+ASGNI4
+ADDRGP4 $1391
+JUMPV
+LABELV $1390
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cgs+5042112+22448
+INDIRI4
+ASGNI4
+LABELV $1391
+LABELV $1387
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1385
+JUMPV
+LABELV $1384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1396
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cgs+5042112+22432
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1396
+ADDRFP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1400
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 100
+DIVI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $1402
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 cgs+5042112+22452
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1402
+LABELV $1400
+LABELV $1385
+LABELV $1383
+endproc CG_AddRefEntityWithPowerups 0 4
+export CG_LightVerts
+proc CG_LightVerts 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_LightForPoint
+CALLI4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1411
+JUMPV
+LABELV $1408
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1414
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $1417
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1418
+JUMPV
+LABELV $1417
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1418
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1421
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1422
+JUMPV
+LABELV $1421
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1422
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1425
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1426
+JUMPV
+LABELV $1425
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1426
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1409
+JUMPV
+LABELV $1414
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1427
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1427
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1431
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1431
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1435
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1435
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1409
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1411
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $1408
+CNSTI4 1
+RETI4
+LABELV $1407
+endproc CG_LightVerts 88 16
+export CG_Player
+proc CG_Player 1056 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 900
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+CNSTI4 0
+LTI4 $1440
+ADDRLP4 900
+INDIRI4
+CNSTI4 64
+LTI4 $1438
+LABELV $1440
+ADDRGP4 $1441
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1438
+ADDRLP4 344
+CNSTI4 6112
+ADDRLP4 900
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ASGNP4
+ADDRLP4 344
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1443
+ADDRGP4 $1437
+JUMPV
+LABELV $1443
+ADDRLP4 864
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+NEI4 $1445
+ADDRGP4 cg+123108
+INDIRI4
+CNSTI4 0
+NEI4 $1448
+ADDRLP4 864
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1449
+JUMPV
+LABELV $1448
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+EQI4 $1451
+ADDRGP4 $1437
+JUMPV
+LABELV $1451
+LABELV $1449
+LABELV $1445
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 520
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 172+28
+ARGP4
+ADDRLP4 520+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1459
+ARGP4
+ADDRLP4 920
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 920
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRLP4 0+28
+CNSTF4 1068624773
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1068624773
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1068624773
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1068624773
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1068624773
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1068624773
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1068624773
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1068624773
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1068624773
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 924
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 924
+INDIRP4
+ADDRLP4 924
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRGP4 $1458
+JUMPV
+LABELV $1457
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 924
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 924
+INDIRI4
+CNSTI4 0
+EQI4 $1504
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 928
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 928
+INDIRI4
+CNSTI4 0
+NEI4 $1502
+LABELV $1504
+ADDRLP4 0+28
+CNSTF4 1066359849
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1066359849
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1066359849
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1066359849
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1066359849
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1066359849
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1066359849
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1066359849
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1066359849
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 932
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 932
+INDIRP4
+ADDRLP4 932
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ASGNF4
+ADDRGP4 $1503
+JUMPV
+LABELV $1502
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 932
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 0
+EQI4 $1553
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1549
+ARGP4
+ADDRLP4 936
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 936
+INDIRI4
+CNSTI4 0
+EQI4 $1553
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1550
+ARGP4
+ADDRLP4 940
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 940
+INDIRI4
+CNSTI4 0
+EQI4 $1553
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 944
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 944
+INDIRI4
+CNSTI4 0
+NEI4 $1547
+LABELV $1553
+ADDRLP4 0+28
+CNSTF4 1067030938
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1067030938
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1067030938
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1067030938
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1067030938
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1067030938
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1067030938
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1067030938
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1067030938
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 948
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 948
+INDIRP4
+ADDRLP4 948
+INDIRP4
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+ADDRGP4 $1548
+JUMPV
+LABELV $1547
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1598
+ARGP4
+ADDRLP4 948
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+EQI4 $1600
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1599
+ARGP4
+ADDRLP4 952
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+NEI4 $1596
+LABELV $1600
+ADDRLP4 0+28
+CNSTF4 1066863165
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1066863165
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1066863165
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1066863165
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1066863165
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1066863165
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1066863165
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1066863165
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1066863165
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 956
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 956
+INDIRP4
+ADDRLP4 956
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRGP4 $1597
+JUMPV
+LABELV $1596
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1645
+ARGP4
+ADDRLP4 956
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+EQI4 $1647
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1646
+ARGP4
+ADDRLP4 960
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $1643
+LABELV $1647
+ADDRLP4 0+28
+CNSTF4 1064849900
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1064849900
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1064849900
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1064849900
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1064849900
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1064849900
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1064849900
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1064849900
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1064849900
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 964
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 964
+INDIRP4
+ADDRLP4 964
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRGP4 $1644
+JUMPV
+LABELV $1643
+ADDRLP4 344
+INDIRP4
+CNSTI4 164
+ADDP4
+ARGP4
+ADDRGP4 $1692
+ARGP4
+ADDRLP4 964
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+NEI4 $1690
+ADDRLP4 0+28
+CNSTF4 1048576000
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1048576000
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1048576000
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1048576000
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1048576000
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1048576000
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1048576000
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1048576000
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1048576000
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 968
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ADDRLP4 968
+INDIRP4
+INDIRF4
+CNSTF4 1099431936
+SUBF4
+ASGNF4
+ADDRGP4 $1691
+JUMPV
+LABELV $1690
+ADDRLP4 0+28
+CNSTF4 1067450368
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1067450368
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1067450368
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1067450368
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1067450368
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1067450368
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1067450368
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1067450368
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1067450368
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 968
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ADDRLP4 968
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+LABELV $1691
+LABELV $1644
+LABELV $1597
+LABELV $1548
+LABELV $1503
+LABELV $1458
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+108
+ARGP4
+ADDRLP4 172+100
+ARGP4
+ADDRLP4 172+80
+ARGP4
+ADDRLP4 172+108
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 896
+ARGP4
+ADDRLP4 968
+ADDRGP4 CG_PlayerShadow
+CALLI4
+ASGNI4
+ADDRLP4 908
+ADDRLP4 968
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSplash
+CALLV
+pop
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 3
+NEI4 $1784
+ADDRLP4 908
+INDIRI4
+CNSTI4 0
+EQI4 $1784
+ADDRLP4 864
+ADDRLP4 864
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $1784
+ADDRLP4 864
+ADDRLP4 864
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 cgs+60148
+INDIRI4
+CNSTI4 7
+NEI4 $1787
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 864
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerTokens
+CALLV
+pop
+LABELV $1787
+ADDRLP4 0+8
+ADDRLP4 344
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 344
+INDIRP4
+CNSTI4 540
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+116
+ADDRLP4 972
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 896
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 864
+INDIRI4
+ASGNI4
+ADDRLP4 0+88
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 0+124
+ADDRLP4 344
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+124+1
+ADDRLP4 344
+INDIRP4
+CNSTI4 101
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+124+2
+ADDRLP4 344
+INDIRP4
+CNSTI4 102
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+124+3
+ADDRLP4 344
+INDIRP4
+CNSTI4 103
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 980
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 984
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 984
+INDIRF4
+LTF4 $1808
+ADDRLP4 976
+ADDRLP4 980
+INDIRF4
+ADDRLP4 984
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1809
+JUMPV
+LABELV $1808
+ADDRLP4 976
+ADDRLP4 980
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1809
+ADDRLP4 0+124+3
+ADDRLP4 976
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1810
+ADDRGP4 $1437
+JUMPV
+LABELV $1810
+ADDRLP4 172+8
+ADDRLP4 344
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172+8
+INDIRI4
+CNSTI4 0
+NEI4 $1814
+ADDRGP4 $1437
+JUMPV
+LABELV $1814
+ADDRLP4 172+116
+ADDRLP4 0+116
+INDIRI4
+ASGNI4
+ADDRLP4 172+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 344
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1820
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLI4
+pop
+ADDRLP4 172+24
+ADDRLP4 896
+INDIRF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 864
+INDIRI4
+ASGNI4
+ADDRLP4 172+124
+ADDRLP4 344
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172+124+1
+ADDRLP4 344
+INDIRP4
+CNSTI4 101
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172+124+2
+ADDRLP4 344
+INDIRP4
+CNSTI4 102
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 172+124+3
+ADDRLP4 344
+INDIRP4
+CNSTI4 103
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 992
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 996
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 992
+INDIRF4
+ADDRLP4 996
+INDIRF4
+LTF4 $1833
+ADDRLP4 988
+ADDRLP4 992
+INDIRF4
+ADDRLP4 996
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1834
+JUMPV
+LABELV $1833
+ADDRLP4 988
+ADDRLP4 992
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1834
+ADDRLP4 172+124+3
+ADDRLP4 988
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 172
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 172+124+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 904
+ADDRGP4 cg+123084
+INDIRI4
+ADDRLP4 344
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 344
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1838
+ADDRLP4 904
+INDIRI4
+CNSTI4 500
+GEI4 $1838
+ADDRLP4 348
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+5042112+22508
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+100
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+116
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+4
+ADDRLP4 348+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 1000
+CNSTF4 0
+ASGNF4
+ADDRLP4 884+8
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRLP4 884+4
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRLP4 884
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRLP4 884
+ARGP4
+ADDRLP4 348+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 348+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 348+68+8
+ADDRLP4 348+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDRLP4 904
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1140457472
+DIVF4
+CNSTF4 3250585600
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 904
+INDIRI4
+CNSTI4 400
+LEI4 $1853
+ADDRLP4 1008
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 912
+ADDRLP4 1008
+INDIRF4
+ADDRLP4 904
+INDIRI4
+CNSTI4 1000
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 1012
+ADDRLP4 1008
+INDIRF4
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1016
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+LTF4 $1857
+ADDRLP4 1004
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1858
+JUMPV
+LABELV $1857
+ADDRLP4 1004
+ADDRLP4 1012
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1858
+ADDRLP4 348+124
+ADDRLP4 1004
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 1024
+CNSTF4 1132396544
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1028
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+ADDRLP4 1028
+INDIRF4
+LTF4 $1862
+ADDRLP4 1020
+ADDRLP4 1024
+INDIRF4
+ADDRLP4 1028
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1863
+JUMPV
+LABELV $1862
+ADDRLP4 1020
+ADDRLP4 1024
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1863
+ADDRLP4 348+124+1
+ADDRLP4 1020
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 1036
+CNSTF4 1132396544
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1040
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1040
+INDIRF4
+LTF4 $1867
+ADDRLP4 1032
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1040
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1868
+JUMPV
+LABELV $1867
+ADDRLP4 1032
+ADDRLP4 1036
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1868
+ADDRLP4 348+124+2
+ADDRLP4 1032
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 1048
+CNSTF4 1132396544
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1052
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1048
+INDIRF4
+ADDRLP4 1052
+INDIRF4
+LTF4 $1872
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRF4
+ADDRLP4 1052
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1873
+JUMPV
+LABELV $1872
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1873
+ADDRLP4 348+124+3
+ADDRLP4 1044
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1854
+JUMPV
+LABELV $1853
+ADDRLP4 348+124
+CNSTU1 255
+ASGNU1
+ADDRLP4 348+124+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 348+124+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 348+124+3
+CNSTU1 255
+ASGNU1
+LABELV $1854
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1838
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1881
+ADDRLP4 692
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 172
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 692+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 692+24
+ADDRLP4 896
+INDIRF4
+ASGNF4
+ADDRLP4 692+4
+ADDRLP4 864
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1886
+ADDRLP4 1000
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 880
+ADDRLP4 1000
+INDIRF4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 7
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+LEF4 $1889
+ADDRLP4 880
+ADDRLP4 880
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1889
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1004
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 868
+CNSTF4 1101004800
+ADDRLP4 1004
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1008
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 868+4
+CNSTF4 1101004800
+ADDRLP4 1008
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+CNSTF4 1086918619
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1012
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 868+8
+CNSTF4 1090519040
+ADDRLP4 1012
+INDIRF4
+MULF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 692+68
+ADDRLP4 172+68
+INDIRF4
+ADDRLP4 868
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+4
+ADDRLP4 172+68+4
+INDIRF4
+ADDRLP4 868+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+8
+ADDRLP4 172+68+8
+INDIRF4
+ADDRLP4 868+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 868+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 692+28+12
+ADDRLP4 868
+INDIRB
+ASGNB 12
+ADDRLP4 692+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 692+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 692+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 692+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 692+28+12
+ARGP4
+ADDRLP4 692+28+24
+ARGP4
+ADDRLP4 692+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22520
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22524
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1887
+JUMPV
+LABELV $1886
+ADDRLP4 880
+CNSTF4 1086918619
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1000
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 868
+CNSTF4 1101004800
+ADDRLP4 1000
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1004
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 868+4
+CNSTF4 1101004800
+ADDRLP4 1004
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1008
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 868+8
+CNSTF4 1101004800
+ADDRLP4 1008
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 692+68
+ADDRLP4 172+68
+INDIRF4
+ADDRLP4 868
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+4
+ADDRLP4 172+68+4
+INDIRF4
+ADDRLP4 868+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+8
+ADDRLP4 172+68+8
+INDIRF4
+ADDRLP4 868+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1012
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 884
+CNSTF4 1106247680
+ADDRLP4 1012
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 884+4
+CNSTF4 1127481344
+ADDRLP4 880
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 884+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1946
+ADDRLP4 884+4
+ADDRLP4 884+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1946
+ADDRLP4 884+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 884
+ARGP4
+ADDRLP4 692+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22520
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 692+28+12
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22524
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 1016
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 880
+ADDRLP4 1016
+INDIRF4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1078530011
+ADDF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+LEF4 $1961
+ADDRLP4 880
+ADDRLP4 880
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1961
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1020
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 868
+CNSTF4 1101004800
+ADDRLP4 1020
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1024
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 868+4
+CNSTF4 1101004800
+ADDRLP4 1024
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1028
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 868+8
+CNSTF4 1101004800
+ADDRLP4 1028
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 692+68
+ADDRLP4 172+68
+INDIRF4
+ADDRLP4 868
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+4
+ADDRLP4 172+68+4
+INDIRF4
+ADDRLP4 868+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+8
+ADDRLP4 172+68+8
+INDIRF4
+ADDRLP4 868+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+CNSTF4 1070141403
+SUBF4
+ARGF4
+ADDRLP4 1032
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 884
+CNSTF4 1106247680
+ADDRLP4 1032
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 884+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 880
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 884+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1978
+ADDRLP4 884+4
+ADDRLP4 884+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1978
+ADDRLP4 884+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 884
+ARGP4
+ADDRLP4 692+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22520
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22524
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 1036
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 880
+ADDRLP4 1036
+INDIRF4
+ADDRGP4 cg+123084
+INDIRI4
+CNSTI4 3
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1070141403
+ADDF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ADDRLP4 1036
+INDIRF4
+LEF4 $1991
+ADDRLP4 880
+ADDRLP4 880
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1991
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 868
+CNSTF4 1101004800
+ADDRLP4 1040
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ARGF4
+ADDRLP4 1044
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 868+4
+CNSTF4 1101004800
+ADDRLP4 1044
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 868+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 692+68
+ADDRLP4 172+68
+INDIRF4
+ADDRLP4 868
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+4
+ADDRLP4 172+68+4
+INDIRF4
+ADDRLP4 868+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+68+8
+ADDRLP4 172+68+8
+INDIRF4
+ADDRLP4 868+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692+28+12
+ADDRLP4 868
+INDIRB
+ASGNB 12
+ADDRLP4 692+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 692+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 692+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 692+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 692+28+12
+ARGP4
+ADDRLP4 692+28+24
+ARGP4
+ADDRLP4 692+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22520
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 692+8
+ADDRGP4 cgs+5042112+22524
+INDIRI4
+ASGNI4
+ADDRLP4 692
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1887
+LABELV $1881
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2030
+ADDRLP4 348
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+5042112+22540
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+100
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+116
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $2030
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2038
+ADDRLP4 348
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+5042112+22528
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+100
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+116
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $2038
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2046
+ADDRLP4 348
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+5042112+22536
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+100
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+116
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $2046
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2054
+ADDRLP4 348
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTU4 172
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 348+8
+ADDRGP4 cgs+5042112+22532
+INDIRI4
+ASGNI4
+ADDRLP4 348+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+100
+CNSTI4 0
+ASGNI4
+ADDRLP4 348+116
+CNSTI4 0
+ASGNI4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $2054
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_PlayerSprites
+CALLV
+pop
+ADDRLP4 520+8
+ADDRLP4 344
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+8
+INDIRI4
+CNSTI4 0
+NEI4 $2063
+ADDRGP4 $1437
+JUMPV
+LABELV $2063
+ADDRLP4 520+116
+ADDRLP4 0+116
+INDIRI4
+ASGNI4
+ADDRLP4 520+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 520
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 344
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $2069
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLI4
+pop
+ADDRLP4 520+24
+ADDRLP4 896
+INDIRF4
+ASGNF4
+ADDRLP4 520+4
+ADDRLP4 864
+INDIRI4
+ASGNI4
+ADDRLP4 520+124
+ADDRLP4 344
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 520+124+1
+ADDRLP4 344
+INDIRP4
+CNSTI4 101
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 520+124+2
+ADDRLP4 344
+INDIRP4
+CNSTI4 102
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 520+124+3
+ADDRLP4 344
+INDIRP4
+CNSTI4 103
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 1004
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1008
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1004
+INDIRF4
+ADDRLP4 1008
+INDIRF4
+LTF4 $2082
+ADDRLP4 1000
+ADDRLP4 1004
+INDIRF4
+ADDRLP4 1008
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2083
+JUMPV
+LABELV $2082
+ADDRLP4 1000
+ADDRLP4 1004
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2083
+ADDRLP4 520+124+3
+ADDRLP4 1000
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 520
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRGP4 CG_AddBreathPuffs
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DustTrail
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_PlayerPowerups
+CALLV
+pop
+LABELV $1437
+endproc CG_Player 1056 28
+export CG_ResetPlayerEntity
+proc CG_ResetPlayerEntity 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+CNSTI4 -99999
+ASGNI4
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 6112
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+81820
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+123084
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugPosition+12
+INDIRI4
+CNSTI4 0
+EQI4 $2089
+ADDRGP4 $2092
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2089
+LABELV $2084
+endproc CG_ResetPlayerEntity 40 12
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SendClientCommand
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_RequestFullScores
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBolt
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffectSmall
+import CG_SpawnEffectDefault
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_ObstacleHandle
+import CG_NodeHandle
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_PaintChar
+import CG_Text_Paint
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_HasBufferedAnnouncerSound
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_AddBufferedAnnouncerSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetupDlightstyles
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_skybox
+import cg_fadeExplosions
+import cg_coronas
+import cg_coronafardist
+import cg_atmosphericEffects
+import cg_trueLightning
+import cg_obeliskRespawnDelay
+import cg_enableBreath
+import cg_enableDust
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_stereoSeparation
+import cg_zProj
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fovGunAdjust
+import cg_fovAspectAdjust
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_drawDebug
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawStatusHead
+import cg_drawWeaponBar
+import cg_drawPickups
+import cg_drawScores
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_hitSounds
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawClock
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_stretch
+import cg_statusScale
+import cg_swingSpeed
+import cg_bobyaw
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runyaw
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2092
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2069
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1820
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1692
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 0
+align 1
+LABELV $1646
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $1645
+byte 1 118
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $1599
+byte 1 98
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1598
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 122
+byte 1 107
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 103
+byte 1 0
+align 1
+LABELV $1550
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $1549
+byte 1 112
+byte 1 105
+byte 1 0
+align 1
+LABELV $1459
+byte 1 114
+byte 1 97
+byte 1 122
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1441
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $892
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $823
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 102
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $789
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $785
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $768
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $766
+byte 1 108
+byte 1 0
+align 1
+LABELV $764
+byte 1 119
+byte 1 0
+align 1
+LABELV $741
+byte 1 99
+byte 1 50
+byte 1 0
+align 1
+LABELV $718
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $716
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $680
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $669
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $636
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $630
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $628
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $626
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $624
+byte 1 116
+byte 1 116
+byte 1 0
+align 1
+LABELV $622
+byte 1 116
+byte 1 0
+align 1
+LABELV $619
+byte 1 110
+byte 1 0
+align 1
+LABELV $614
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $537
+byte 1 109
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $533
+byte 1 106
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $529
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $524
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $523
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $520
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $519
+byte 1 42
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $518
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $510
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $504
+byte 1 47
+byte 1 0
+align 1
+LABELV $471
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $468
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $465
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $462
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $461
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $458
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $457
+byte 1 80
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $456
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $453
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $440
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $430
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $427
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $424
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $421
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $418
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $415
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $414
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $408
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $389
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $388
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 95
+byte 1 0
+align 1
+LABELV $385
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 0
+align 1
+LABELV $369
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 34
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $368
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $365
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 81
+byte 1 80
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $362
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $329
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $328
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $318
+byte 1 36
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $315
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $314
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $304
+byte 1 0
+align 1
+LABELV $303
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $285
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $284
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $276
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $275
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $268
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $267
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $255
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $227
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $224
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $213
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $204
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $201
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 116
+byte 1 50
+byte 1 115
+byte 1 0
+align 1
+LABELV $197
+byte 1 116
+byte 1 50
+byte 1 104
+byte 1 0
+align 1
+LABELV $194
+byte 1 116
+byte 1 50
+byte 1 109
+byte 1 0
+align 1
+LABELV $191
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $188
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $185
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $182
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 0
+align 1
+LABELV $179
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $176
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $173
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $170
+byte 1 104
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 0
+align 1
+LABELV $167
+byte 1 104
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $164
+byte 1 104
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $161
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $158
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $155
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 0
+align 1
+LABELV $152
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $149
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 0
+align 1
+LABELV $146
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $141
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $133
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $125
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $124
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $121
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $120
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $118
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $96
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $95
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 52
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $94
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $93
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $92
+byte 1 42
+byte 1 112
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $91
+byte 1 42
+byte 1 106
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $90
+byte 1 42
+byte 1 103
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $89
+byte 1 42
+byte 1 102
+byte 1 118
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $88
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 53
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $87
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 52
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $86
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $85
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $84
+byte 1 42
+byte 1 102
+byte 1 102
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $83
+byte 1 42
+byte 1 100
+byte 1 102
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $82
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $81
+byte 1 42
+byte 1 100
+byte 1 100
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $80
+byte 1 42
+byte 1 100
+byte 1 100
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $79
+byte 1 42
+byte 1 100
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
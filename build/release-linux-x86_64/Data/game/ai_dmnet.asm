@@ -0,0 +1,20070 @@
+export BotResetNodeSwitches
+code
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $69
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $71
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $72
+CNSTI4 1
+ARGI4
+ADDRGP4 $76
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $73
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $75
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $72
+CNSTI4 4
+ARGI4
+ADDRGP4 $77
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $70
+endproc BotDumpNodeSwitches 40 20
+export BotRecordNodeSwitch
+proc BotRecordNodeSwitch 40 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5328
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $79
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $80
+JUMPV
+LABELV $79
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $82
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $80
+ADDRGP4 bot_shownodechanges+12
+INDIRI4
+CNSTI4 0
+EQI4 $83
+CNSTI4 1
+ARGI4
+ADDRGP4 $76
+ARGP4
+CNSTI4 144
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $83
+ADDRLP4 36
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $78
+endproc BotRecordNodeSwitch 40 32
+lit
+align 4
+LABELV $87
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $88
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc BotGetAirGoal 112 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 $87
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRGP4 $88
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $91
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 104
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $86
+JUMPV
+LABELV $95
+LABELV $91
+CNSTI4 0
+RETI4
+LABELV $86
+endproc BotGetAirGoal 112 28
+proc BotGoForAir 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $99
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $99
+CNSTI4 0
+RETI4
+LABELV $98
+endproc BotGoForAir 68 24
+export BotNearbyGoal
+proc BotNearbyGoal 20 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $109
+CNSTI4 1
+RETI4
+ADDRGP4 $108
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOnlyPickupImportantItems
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 300
+GEI4 $113
+ADDRFP4 12
+CNSTI4 10
+ASGNI4
+LABELV $113
+LABELV $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $108
+endproc BotNearbyGoal 20 24
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $116
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $118
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $120
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $125
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $127
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $117
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $117
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $117
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $117
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $117
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $116
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $139
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $138
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $143
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $143
+LABELV $138
+LABELV $117
+CNSTI4 0
+RETI4
+LABELV $115
+endproc BotReachedGoal 40 16
+proc BotGetItemLongTermGoal 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $148
+LABELV $147
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $150
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+LABELV $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $150
+CNSTI4 1
+RETI4
+LABELV $145
+endproc BotGetItemLongTermGoal 20 16
+proc BotGetLongTermGoal 520 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $155
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 272+4
+INDIRI4
+CNSTI4 0
+NEI4 $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $157
+ADDRLP4 456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 0
+EQF4 $160
+ADDRLP4 456
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 460
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 460
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 464
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRLP4 260
+ADDRLP4 272+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 472
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+CNSTF4 1182793728
+GEF4 $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $177
+LABELV $169
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 272+16
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $180
+ADDRLP4 400
+INDIRI4
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ADDRLP4 272+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7152
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7156
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7160
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7164
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7168
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7172
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $180
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $183
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 272+4
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $185
+ADDRLP4 456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 0
+EQF4 $188
+ADDRLP4 456
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 460
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 460
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $188
+ADDRLP4 260
+ADDRLP4 272+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 468
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 472
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+ADDRLP4 476
+INDIRF4
+ADDRLP4 476
+INDIRF4
+MULF4
+GEF4 $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $202
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 484
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 452
+ADDRLP4 484
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+GEF4 $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $204
+LABELV $202
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 488
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 492
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 492
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1028443341
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+MULF4
+GEF4 $215
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $215
+LABELV $213
+LABELV $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $217
+ADDRLP4 260
+ADDRLP4 272+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 496
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 496
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 496
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $217
+LABELV $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 440
+ARGP4
+ADDRLP4 496
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $226
+ADDRLP4 260
+ADDRLP4 440
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 440+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 440+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 508
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 508
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 508
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTI4 400
+ARGI4
+ADDRLP4 508
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $234
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $235
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 480
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $237
+ARGP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $235
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 272+16
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $239
+ADDRLP4 400
+INDIRI4
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $239
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ADDRLP4 272+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7152
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7156
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7160
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7164
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7168
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7172
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $239
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 492
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $242
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7148
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRF4
+LEF4 $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $247
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $249
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $249
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 0
+EQF4 $251
+ADDRLP4 460
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $251
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $251
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 472
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+CNSTF4 1199570944
+GEF4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 476
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 480
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 480
+INDIRF4
+ADDF4
+ADDRLP4 480
+INDIRF4
+ADDRLP4 476
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $260
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $261
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $264
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 0
+EQF4 $266
+ADDRLP4 460
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+SUBF4
+LEF4 $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 6448
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+INDIRI4
+NEI4 $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 7176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $272
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $274
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 0
+EQF4 $276
+ADDRLP4 460
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $276
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $279
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $279
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $284
+LABELV $282
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $274
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 9
+EQI4 $289
+ADDRLP4 460
+INDIRI4
+CNSTI4 10
+NEI4 $287
+LABELV $289
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $287
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $290
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 468
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $290
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $297
+LABELV $295
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotSetTeamCampDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7672
+ADDP4
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ARGP4
+ADDRLP4 484
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 488
+ADDRFP4 0
+INDIRP4
+CNSTI4 7672
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRF4
+ADDRLP4 488
+INDIRI4
+ADDRLP4 488
+INDIRI4
+MULI4
+CVIF4 4
+GEF4 $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 404
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 492
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 492
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $308
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 492
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 496
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+INDIRI4
+ADDRLP4 496
+INDIRI4
+EQI4 $309
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 440
+ARGP4
+ADDRLP4 496
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRLP4 260
+ADDRLP4 440
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 440+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 440+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 508
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 508
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 508
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 508
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 452
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+GEF4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $319
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $323
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $325
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $327
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $328
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $323
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $327
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $330
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $334
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $336
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $336
+ADDRLP4 4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 9668
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $341
+JUMPV
+LABELV $338
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $342
+ADDRLP4 4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $342
+LABELV $339
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $341
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $345
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 9676
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $352
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $352
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 480
+ADDRFP4 0
+INDIRP4
+CNSTI4 9676
+ADDP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+ADDRLP4 480
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $354
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 480
+ADDRFP4 0
+INDIRP4
+CNSTI4 9676
+ADDP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+ADDRLP4 480
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $355
+LABELV $351
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $356
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9672
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $334
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $361
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $363
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $363
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $366
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $363
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRLP4 468
+INDIRI4
+CNSTI4 1
+EQI4 $371
+ADDRGP4 $367
+JUMPV
+LABELV $370
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $371
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $372
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 484
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $377
+ADDRLP4 484
+INDIRI4
+CNSTI4 1
+EQI4 $378
+ADDRGP4 $374
+JUMPV
+LABELV $377
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $375
+JUMPV
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $374
+LABELV $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $381
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $386
+ADDRLP4 468
+INDIRI4
+CNSTI4 1
+EQI4 $387
+ADDRGP4 $383
+JUMPV
+LABELV $386
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $387
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 492
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 492
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $393
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $360
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $398
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $401
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $405
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $406
+ADDRGP4 $402
+JUMPV
+LABELV $405
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $406
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $409
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $359
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $413
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 464
+INDIRF4
+CNSTF4 0
+EQF4 $415
+ADDRLP4 464
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $366
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $415
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $419
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $413
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $421
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 464
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRLP4 464
+INDIRI4
+CNSTI4 1
+EQI4 $427
+ADDRGP4 $423
+JUMPV
+LABELV $426
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $424
+JUMPV
+LABELV $427
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $434
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $436
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $444
+ADDRGP4 $440
+JUMPV
+LABELV $443
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $444
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $445
+ADDRLP4 488
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 488
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $447
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $412
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $451
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $451
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $401
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $411
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $456
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $459
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $459
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $459
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $464
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $465
+ADDRGP4 $461
+JUMPV
+LABELV $464
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $465
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 484
+INDIRF4
+CNSTF4 1112014848
+LEF4 $466
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $468
+ADDRLP4 492
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 492
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $468
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 500
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 500
+INDIRF4
+CNSTF4 1163984896
+GEF4 $472
+ADDRLP4 504
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 504
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $455
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $478
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 464
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 464
+INDIRI4
+CNSTI4 1
+EQI4 $484
+ADDRGP4 $480
+JUMPV
+LABELV $483
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $481
+JUMPV
+LABELV $484
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $485
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $491
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 468
+INDIRF4
+CNSTF4 0
+EQF4 $493
+ADDRLP4 468
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $493
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $493
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $498
+ADDRLP4 472
+INDIRI4
+CNSTI4 1
+EQI4 $499
+ADDRGP4 $495
+JUMPV
+LABELV $498
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $496
+JUMPV
+LABELV $499
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRLP4 488
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6628
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 488
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $502
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $504
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $504
+ADDRLP4 472
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 472
+INDIRF4
+CNSTF4 0
+EQF4 $506
+ADDRLP4 472
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $506
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $508
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $506
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRLP4 480
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 480
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $511
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $511
+CNSTI4 1
+RETI4
+ADDRGP4 $154
+JUMPV
+LABELV $504
+LABELV $476
+LABELV $456
+LABELV $412
+LABELV $360
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 464
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+RETI4
+LABELV $154
+endproc BotGetLongTermGoal 520 16
+proc BotLongTermGoal 436 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7396
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $514
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 7396
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $516
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 404
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 404
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7396
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 412
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $516
+ADDRLP4 404
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 404
+INDIRF4
+CNSTF4 0
+GEF4 $519
+ADDRLP4 404
+INDIRF4
+NEGF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 408
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $521
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12+16
+ARGP4
+ADDRLP4 408
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRLP4 412
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRLP4 412
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRFP4 0
+INDIRP4
+CNSTI4 7380
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7352
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7340
+ADDP4
+ADDRLP4 12+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7356
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7360
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7364
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7368
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7372
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7376
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $526
+LABELV $522
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 7400
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 7400
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 7408
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $531
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7340
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7344
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7348
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7408
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $535
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $537
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 428
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $521
+ARGP4
+ADDRLP4 428
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $537
+ADDRLP4 396
+INDIRF4
+CNSTF4 1176256512
+GEF4 $539
+ADDRFP4 0
+INDIRP4
+CNSTI4 7408
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $539
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7340
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $535
+ADDRLP4 396
+INDIRF4
+CNSTF4 1215570944
+LEF4 $541
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 7336
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 428
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $521
+ARGP4
+ADDRLP4 428
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7404
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $543
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 432
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 432
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $541
+LABELV $514
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+RETI4
+LABELV $513
+endproc BotLongTermGoal 436 16
+export AIEnter_Intermission
+proc AIEnter_Intermission 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $556
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $556
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $552
+endproc AIEnter_Intermission 16 16
+export AINode_Intermission
+proc AINode_Intermission 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $559
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRFP4 0
+INDIRP4
+CNSTI4 6568
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+LABELV $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $558
+JUMPV
+LABELV $559
+CNSTI4 1
+RETI4
+LABELV $558
+endproc AINode_Intermission 8 8
+export AIEnter_Observer
+proc AIEnter_Observer 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $565
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $564
+endproc AIEnter_Observer 8 16
+export AINode_Observer
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $569
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $566
+JUMPV
+LABELV $567
+CNSTI4 1
+RETI4
+LABELV $566
+endproc AINode_Observer 4 8
+export AIEnter_Stand
+proc AIEnter_Stand 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $571
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $570
+endproc AIEnter_Stand 8 16
+export AINode_Stand
+proc AINode_Stand 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $573
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $577
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+LABELV $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 6568
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $580
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $578
+CNSTI4 1
+RETI4
+LABELV $572
+endproc AINode_Stand 4 12
+export AIEnter_Respawn
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 9
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+LABELV $581
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $588
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $590
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $588
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 6440
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6552
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $593
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6508
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $593
+LABELV $591
+LABELV $587
+CNSTI4 1
+RETI4
+LABELV $585
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 96 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $596
+CNSTI4 2
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $596
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $598
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $598
+CNSTI4 3
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $598
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $600
+CNSTI4 4
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $600
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $602
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $602
+CNSTI4 5
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $602
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5440
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $604
+ADDRFP4 0
+INDIRP4
+CNSTI4 5488
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $604
+CNSTI4 6
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $604
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5444
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $606
+ADDRFP4 0
+INDIRP4
+CNSTI4 5492
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $606
+CNSTI4 7
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $606
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $608
+CNSTI4 8
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $608
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $610
+CNSTI4 9
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $610
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $612
+CNSTI4 10
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $612
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $614
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $614
+CNSTI4 11
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $614
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $616
+CNSTI4 12
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $616
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LEI4 $618
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LEI4 $618
+CNSTI4 13
+RETI4
+ADDRGP4 $595
+JUMPV
+LABELV $618
+CNSTI4 -1
+RETI4
+LABELV $595
+endproc BotSelectActivateWeapon 96 0
+export BotClearPath
+proc BotClearPath 376 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+NEI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 264
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $632
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $632
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $634
+ADDRLP4 340
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $638
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 352
+CNSTP4 0
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $644
+ADDRLP4 276+52
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $640
+LABELV $644
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $640
+LABELV $638
+LABELV $636
+LABELV $634
+LABELV $623
+LABELV $621
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $647
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+NEI4 $647
+ADDRLP4 256
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 260
+CNSTI4 -1
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $652
+JUMPV
+LABELV $649
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 12+12+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+12+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+12+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 336
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+GEF4 $663
+ADDRLP4 256
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $663
+LABELV $650
+ADDRLP4 248
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $652
+ADDRLP4 248
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+INDIRI4
+LTI4 $649
+ADDRLP4 260
+INDIRI4
+CNSTI4 -1
+EQI4 $665
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 264
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 264+8
+ADDRLP4 264+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $674
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $676
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $678
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $679
+LABELV $677
+LABELV $675
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $680
+ADDRLP4 360
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $682
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $684
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $690
+ADDRLP4 276+52
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $686
+LABELV $690
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $686
+LABELV $684
+LABELV $682
+LABELV $680
+LABELV $665
+LABELV $647
+LABELV $620
+endproc BotClearPath 376 28
+export AIEnter_Wait
+proc AIEnter_Wait 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $692
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $693
+JUMPV
+LABELV $692
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $695
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Wait
+ASGNP4
+LABELV $691
+endproc AIEnter_Wait 212 16
+export AINode_Wait
+proc AINode_Wait 124 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $697
+JUMPV
+LABELV $698
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $701
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $697
+JUMPV
+LABELV $701
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $706
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $697
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $707
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $709
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $711
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 100
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $715
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $717
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $697
+JUMPV
+LABELV $715
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $717
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $697
+JUMPV
+LABELV $713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRLP4 64
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $718
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $724
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 12+24
+INDIRI4
+ASGNI4
+LABELV $724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $728
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $730
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $697
+JUMPV
+LABELV $728
+CNSTI4 1
+RETI4
+LABELV $697
+endproc AINode_Wait 124 12
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $732
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $731
+endproc AIEnter_Seek_ActivateEntity 8 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 344 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $736
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $734
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $737
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $739
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $742
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $743
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $745
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $745
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $747
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $749
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $747
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 308
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 308
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 312
+INDIRI4
+EQI4 $750
+ADDRLP4 76
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 320
+CNSTP4 0
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $756
+ADDRLP4 76+52
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $752
+LABELV $756
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $757
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 332
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 332
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRLP4 340
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $761
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $761
+LABELV $757
+LABELV $752
+LABELV $750
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $763
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+4
+INDIRI4
+CNSTI4 0
+NEI4 $765
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $768
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $765
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 132+16
+ARGP4
+ADDRLP4 316
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+NEI4 $769
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $769
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $772
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $774
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $776
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $778
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $778
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $780
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+LABELV $777
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $772
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $764
+JUMPV
+LABELV $763
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $786
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $786
+LABELV $784
+LABELV $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $792
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $792
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $780
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRLP4 260
+INDIRP4
+CALLV
+pop
+LABELV $791
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $794
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $794
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $796
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $764
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $798
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $800
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 320
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 320
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $800
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $807
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $811
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $811
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $807
+LABELV $798
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $814
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $818
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+CNSTI4 0
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 320
+INDIRI4
+EQI4 $819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRLP4 56
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 332
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $819
+JUMPV
+LABELV $818
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $827
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 264
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $829
+ADDRLP4 56
+ADDRLP4 264
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 264+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 264+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $830
+JUMPV
+LABELV $829
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $830
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 324
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $827
+LABELV $819
+LABELV $815
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $836
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $836
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 316
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $840
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $842
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $844
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $843
+JUMPV
+LABELV $842
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $844
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $843
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $733
+JUMPV
+LABELV $840
+CNSTI4 1
+RETI4
+LABELV $733
+endproc AINode_Seek_ActivateEntity 344 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $846
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $849
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $847
+JUMPV
+LABELV $846
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $849
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $847
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $845
+endproc AIEnter_Seek_NBG 212 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $854
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $855
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $857
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $855
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $858
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $860
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $858
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $861
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $863
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $863
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $865
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $865
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $869
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $870
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $872
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $872
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $870
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $875
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $877
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $877
+LABELV $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $879
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $881
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $882
+CNSTI4 0
+RETI4
+ADDRGP4 $850
+JUMPV
+LABELV $882
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $884
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $884
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $886
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $887
+JUMPV
+LABELV $886
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $890
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $891
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 200
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $891
+JUMPV
+LABELV $890
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $901
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 188
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $901
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+LABELV $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $909
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $910
+JUMPV
+LABELV $909
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $910
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $899
+LABELV $891
+LABELV $887
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $916
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $916
+CNSTI4 1
+RETI4
+LABELV $850
+endproc AINode_Seek_NBG 208 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $921
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $924
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $922
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $920
+endproc AIEnter_Seek_LTG 212 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 224 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $927
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $929
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $927
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $930
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $932
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $930
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $933
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $935
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $933
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $936
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $936
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $938
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $938
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $940
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $940
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $942
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $944
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $942
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 172
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $945
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $947
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $949
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $947
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $949
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $945
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckTeamScores
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $950
+CNSTI4 1
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $950
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWantsToCamp
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $952
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $954
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $957
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $958
+JUMPV
+LABELV $957
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $958
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $959
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $955
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $959
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $963
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $955
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $963
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $955
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $955
+ADDRLP4 108
+CNSTI4 80
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotNearbyGoalPickupRange_LTG
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 52+12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRLP4 196
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $972
+ADDRLP4 108
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $972
+LABELV $955
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $974
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $976
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $974
+LABELV $952
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $977
+CNSTI4 0
+RETI4
+ADDRGP4 $925
+JUMPV
+LABELV $977
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $981
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $982
+JUMPV
+LABELV $981
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $985
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $986
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $986
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $986
+JUMPV
+LABELV $985
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $994
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 116
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $996
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $997
+JUMPV
+LABELV $996
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 0
+EQF4 $1002
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1003
+JUMPV
+LABELV $1002
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $1006
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 220
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1006
+LABELV $1003
+LABELV $997
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 216
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $994
+LABELV $986
+LABELV $982
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1012
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1012
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1016
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+GEF4 $1018
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1020
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $1020
+LABELV $1018
+LABELV $1016
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_Random
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $925
+endproc AINode_Seek_LTG 224 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1023
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $1022
+endproc AIEnter_Battle_Fight 12 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1023
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $1024
+endproc AIEnter_Battle_SuicidalFight 12 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 328 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 240
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1027
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1029
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1027
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1032
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1030
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1033
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1033
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 276
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+CNSTI4 1
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1036
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+LTI4 $1040
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1038
+LABELV $1040
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1041
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1038
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 52+4
+INDIRI4
+CNSTI4 0
+NEI4 $1042
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1045
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1042
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1046
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $1050
+ADDRFP4 0
+INDIRP4
+CNSTI4 6448
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+NEI4 $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_Kill
+CALLI4
+pop
+LABELV $1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1054
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1046
+ADDRLP4 52
+ARGP4
+ADDRLP4 292
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1055
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1055
+LABELV $1047
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1057
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1057
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1059
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1059
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1061
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 244
+ADDRLP4 52+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1064
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1070
+ADDRLP4 308
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1066
+LABELV $1070
+ADDRLP4 244+8
+ADDRLP4 244+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1066
+LABELV $1064
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 244
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRLP4 312
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $1072
+LABELV $1061
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1074
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1078
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1078
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1074
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1081
+ADDRLP4 256
+CNSTI4 150
+ASGNI4
+ADDRGP4 $1082
+JUMPV
+LABELV $1081
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotNearbyGoalPickupRange_NoLTG
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 308
+INDIRI4
+ASGNI4
+LABELV $1082
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 184
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 256
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1086
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1084
+LABELV $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1087
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1087
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1089
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1089
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1092
+JUMPV
+LABELV $1091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+LABELV $1092
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1095
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1097
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1101
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1099
+LABELV $1097
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+LEI4 $1102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+pop
+LABELV $1102
+ADDRFP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+INDIRI4
+LEI4 $1104
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+pop
+LABELV $1104
+CNSTI4 1
+RETI4
+LABELV $1025
+endproc AINode_Battle_Fight 328 16
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $1106
+endproc AIEnter_Battle_Chase 8 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 372 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 236
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1112
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1115
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1118
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1121
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1119
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+LTI4 $1124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1122
+LABELV $1124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1125
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1122
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108+4
+INDIRI4
+CNSTI4 0
+NEI4 $1126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1129
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1126
+ADDRLP4 108
+ARGP4
+ADDRLP4 300
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1132
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1133
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1135
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1137
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $1137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1139
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1141
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1139
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1144
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1142
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1147
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1145
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1160
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 332
+INDIRF4
+CNSTF4 0
+EQF4 $1164
+ADDRLP4 332
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $1162
+LABELV $1164
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1165
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1162
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1166
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1168
+ADDRLP4 240
+CNSTI4 150
+ASGNI4
+ADDRGP4 $1169
+JUMPV
+LABELV $1168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotNearbyGoalPickupRange_NoLTG
+CALLI4
+ASGNI4
+ADDRLP4 240
+ADDRLP4 336
+INDIRI4
+ASGNI4
+LABELV $1169
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1171
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 240
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1173
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1171
+LABELV $1166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1174
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1174
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1176
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 19
+BANDI4
+CNSTI4 0
+EQI4 $1178
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1179
+JUMPV
+LABELV $1178
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $1182
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1184
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1186
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1185
+JUMPV
+LABELV $1186
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+ADDRGP4 $1185
+JUMPV
+LABELV $1184
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56+40+4
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 348
+INDIRF4
+CNSTF4 1110704128
+LEF4 $1192
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ADDRLP4 352
+INDIRP4
+INDIRF4
+CNSTF4 1110704128
+SUBF4
+ASGNF4
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56+40+4
+INDIRF4
+ARGF4
+ADDRLP4 352
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 352
+INDIRF4
+CNSTF4 3258187776
+GEF4 $1196
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+ADDRGP4 $1197
+JUMPV
+LABELV $1196
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ADDRLP4 56+40+4
+INDIRF4
+ASGNF4
+LABELV $1197
+LABELV $1193
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 360
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 56+40
+INDIRF4
+ASGNF4
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 364
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 368
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1189
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotChooseRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 BotRoamGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1203
+ADDRLP4 256
+ADDRLP4 244
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 244+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 244+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1204
+JUMPV
+LABELV $1203
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 244
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1209
+ADDRLP4 256
+ADDRLP4 244
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 244+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 244+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1210
+JUMPV
+LABELV $1209
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $1210
+LABELV $1204
+LABELV $1185
+ADDRLP4 348
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 348
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1182
+LABELV $1179
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $1216
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1221
+JUMPV
+LABELV $1220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1221
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+NEI4 $1223
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1227
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1225
+CNSTI4 1
+RETI4
+LABELV $1108
+endproc AINode_Battle_Chase 372 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1229
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $1228
+endproc AIEnter_Battle_Retreat 8 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 376 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 252
+ADDRGP4 bot_checktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1234
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1237
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1240
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1238
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1241
+CNSTI4 1
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1241
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+LTI4 $1245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1243
+LABELV $1245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1246
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1243
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108+4
+INDIRI4
+CNSTI4 0
+NEI4 $1247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1250
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1247
+ADDRLP4 108
+ARGP4
+ADDRLP4 308
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1253
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1254
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1256
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotAIWaiting
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1260
+ARGP4
+ADDRGP4 AIEnter_Wait
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1263
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 108+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1267
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1273
+ADDRLP4 336
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1269
+LABELV $1273
+ADDRLP4 240+8
+ADDRLP4 240+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1269
+LABELV $1267
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1275
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1275
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+LABELV $1275
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $1277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1279
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1277
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1280
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 336
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1284
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1282
+LABELV $1280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckTeamScores
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 340
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1285
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1287
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1285
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1288
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 bot_alt_pickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1290
+ADDRLP4 256
+CNSTI4 150
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1291
+ADDRLP4 256
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1291
+JUMPV
+LABELV $1293
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1291
+ADDRLP4 256
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1291
+JUMPV
+LABELV $1297
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1291
+ADDRLP4 256
+CNSTI4 80
+ASGNI4
+ADDRGP4 $1291
+JUMPV
+LABELV $1290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotNearbyGoalPickupRange_LTG
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 344
+INDIRI4
+ASGNI4
+LABELV $1291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1305
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 256
+INDIRI4
+CNSTI4 100
+DIVI4
+CVIF4 4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1307
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1305
+LABELV $1288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1308
+CNSTI4 0
+RETI4
+ADDRGP4 $1230
+JUMPV
+LABELV $1308
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1310
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+EQI4 $1312
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1313
+JUMPV
+LABELV $1312
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 356
+INDIRI4
+NEI4 $1316
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 356
+INDIRI4
+NEI4 $1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1319
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1320
+JUMPV
+LABELV $1321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+ADDRGP4 $1320
+JUMPV
+LABELV $1319
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1324
+ADDRLP4 264
+ADDRLP4 240
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264+4
+ADDRLP4 240+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264+8
+ADDRLP4 240+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1325
+JUMPV
+LABELV $1324
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $1325
+ADDRLP4 372
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 372
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 372
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1320
+LABELV $1316
+LABELV $1313
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1331
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1331
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1336
+JUMPV
+LABELV $1335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1336
+CNSTI4 1
+RETI4
+LABELV $1230
+endproc AINode_Battle_Retreat 376 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 212 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1339
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1342
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $1340
+JUMPV
+LABELV $1339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1342
+ARGP4
+ADDRGP4 $696
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $1340
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1338
+endproc AIEnter_Battle_NBG 212 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 364 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1344
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1346
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1344
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1349
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1350
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1352
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1350
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1353
+CNSTI4 1
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1353
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+LTI4 $1357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1355
+LABELV $1357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1358
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1355
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108+4
+INDIRI4
+CNSTI4 0
+NEI4 $1359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1362
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1359
+ADDRLP4 108
+ARGP4
+ADDRLP4 300
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1363
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1365
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1363
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1366
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 50331648
+BORI4
+ASGNI4
+LABELV $1366
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1368
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 1536
+BORI4
+ASGNI4
+LABELV $1368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1370
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $1370
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 108+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1375
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1381
+ADDRLP4 324
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1377
+LABELV $1381
+ADDRLP4 240+8
+ADDRLP4 240+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1377
+LABELV $1375
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1383
+ADDRLP4 328
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1383
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+LABELV $1383
+LABELV $1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1387
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1389
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1387
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1389
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1385
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $1390
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1391
+JUMPV
+LABELV $1390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1392
+LABELV $1391
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1394
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1396
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1398
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1396
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1398
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1399
+CNSTI4 0
+RETI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1399
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1401
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+EQI4 $1403
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1404
+JUMPV
+LABELV $1403
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1407
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1407
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 348
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1410
+ADDRGP4 bot_alt_aim+12
+INDIRI4
+CNSTI4 0
+NEI4 $1412
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1411
+JUMPV
+LABELV $1412
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy_New
+CALLV
+pop
+ADDRGP4 $1411
+JUMPV
+LABELV $1410
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1415
+ADDRLP4 256
+ADDRLP4 240
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 240+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 240+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRGP4 $1416
+JUMPV
+LABELV $1415
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+LABELV $1416
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 7068
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1411
+LABELV $1407
+LABELV $1404
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1422
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1422
+ADDRGP4 bot_alt_attack+12
+INDIRI4
+CNSTI4 0
+NEI4 $1426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRGP4 $1427
+JUMPV
+LABELV $1426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack_New
+CALLV
+pop
+LABELV $1427
+CNSTI4 1
+RETI4
+LABELV $1343
+endproc AINode_Battle_NBG 364 20
+bss
+export nodeswitch
+align 1
+LABELV nodeswitch
+skip 7344
+export numnodeswitches
+align 4
+LABELV numnodeswitches
+skip 4
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamFormationDist
+import BotSetTeamCampDist
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotDetermineVisibleTeammates
+import BotTeamAI
+import AIEnter_Seek_Camp
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import maxclients
+import mapname
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotGoHarvest
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotCheckBlockedTeammates
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack_New
+import BotCheckAttack
+import BotAimAtEnemy_New
+import BotAimAtEnemy
+import BotStartVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotChooseRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotCountVisibleEnemies
+import BotCountVisibleTeamMatesAndEnemies
+import BotCountAllTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotHasScout
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotOnlyPickupImportantItems
+import BotAIWaiting
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotCheckTeamScores
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotNearbyGoalPickupRange_LTG
+import BotNearbyGoalPickupRange_NoLTG
+import BotUpdateBattleInventory
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_alt_attack
+import bot_alt_aim
+import bot_alt_pickup
+import bot_alt_aggressive
+import bot_teamavoidpickup
+import bot_teamblock
+import bot_teamredstrategy
+import bot_teambluestrategy
+import bot_shownodechanges
+import bot_noaccerror
+import bot_nowalk
+import bot_noshoot
+import bot_equalizer_teambon
+import bot_equalizer_fembon
+import bot_equalizer_react
+import bot_equalizer_aim
+import bot_equalize
+import bot_predictobstacles
+import bot_blocktime
+import bot_checktime
+import bot_visualrange
+import bot_memorydump
+import bot_interbreedwrite
+import bot_interbreedcycle
+import bot_interbreedbots
+import bot_interbreedchar
+import bot_challenge
+import bot_rocketjump
+import bot_report
+import bot_pause
+import bot_nochat
+import bot_fastchat
+import bot_testclusters
+import bot_testsolid
+import bot_testrchat
+import bot_testichat
+import bot_reloadcharacters
+import bot_thinktime
+import bot_saveroutingcache
+import bot_aasoptimize
+import bot_forcewrite
+import bot_forcereachability
+import bot_forceclustering
+import bot_visualizejumppads
+import bot_reachability
+import bot_groundonly
+import bot_maxdebugpolys
+import bot_debug
+import bot_developer
+import bot_enable
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_TraceEntities
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceAtTime
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_ResetScoreboardBaseline
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import Svcmd_PmoveBench_f
+import Svcmd_PmoveRecord_f
+import G_PmoveRecordEnd
+import G_PmoveRecordBegin
+import G_StopPmoveRecord
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_EventForString
+import G_Script_ScriptEventNum
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateClientRank
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import G_UpdateEntityActivity
+import G_NextRunnableEntity
+import G_RemoveThinks
+import G_ActivateEntity
+import G_SetNextThink
+import G_AdvanceThinks
+import G_InitThinks
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_InitFreeEntities
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_SetScriptName
+import G_SetTargetname
+import G_SetClassname
+import G_UpdateEntityNames
+import G_InitEntityNames
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import G_InitConfigstringCaches
+import G_HashName
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1398
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1389
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1365
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1362
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1358
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1352
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1349
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1346
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1342
+byte 1 94
+byte 1 54
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1307
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1287
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1284
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1279
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1263
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $1260
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1253
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1250
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1246
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1240
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1237
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1234
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1229
+byte 1 94
+byte 1 51
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $1227
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1173
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1165
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1147
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 46
+byte 1 0
+align 1
+LABELV $1144
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $1141
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1132
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1129
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1125
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1121
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1118
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1115
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1112
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1107
+byte 1 94
+byte 1 53
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 0
+align 1
+LABELV $1101
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1086
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $1078
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1054
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1045
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1041
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $1035
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $1032
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $1029
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $1023
+byte 1 94
+byte 1 49
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 0
+align 1
+LABELV $976
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 98
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $949
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $944
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $935
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $932
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $929
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $924
+byte 1 94
+byte 1 50
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $881
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $874
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $869
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $860
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $857
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $854
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $849
+byte 1 94
+byte 1 50
+byte 1 83
+byte 1 69
+byte 1 69
+byte 1 75
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $844
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $781
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $780
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $768
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $749
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 46
+byte 1 0
+align 1
+LABELV $742
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $739
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $736
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $732
+byte 1 94
+byte 1 52
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 73
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 0
+align 1
+LABELV $730
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $717
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $706
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $703
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 0
+align 1
+LABELV $700
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $696
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $695
+byte 1 94
+byte 1 52
+byte 1 87
+byte 1 65
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $590
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $582
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $580
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $577
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 46
+byte 1 0
+align 1
+LABELV $571
+byte 1 83
+byte 1 84
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $569
+byte 1 79
+byte 1 66
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $565
+byte 1 79
+byte 1 66
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $563
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $555
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $554
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $553
+byte 1 97
+byte 1 105
+byte 1 78
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $521
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $518
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $508
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $439
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $438
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $401
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $400
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $366
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $365
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $358
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $345
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $344
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 0
+align 1
+LABELV $327
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $308
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $307
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $294
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $286
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $283
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $278
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $271
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $268
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $263
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $254
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $253
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $244
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $237
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $234
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 71
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 33
+byte 1 0
+align 1
+LABELV $214
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $190
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $163
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $82
+byte 1 94
+byte 1 50
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $81
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $77
+byte 1 0
+align 1
+LABELV $76
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $71
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
@@ -0,0 +1,46832 @@
+data
+align 4
+LABELV botVisibilityFrame
+byte 4 1
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $69
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $71
+CNSTI4 0
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $71
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $73
+CNSTI4 1
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $73
+ADDRFP4 0
+INDIRP4
+CNSTI4 5560
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $75
+CNSTI4 2
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $75
+CNSTI4 0
+RETI4
+LABELV $70
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+LTI4 $80
+ADDRLP4 1024
+INDIRI4
+CNSTI4 64
+LTI4 $78
+LABELV $80
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+CNSTI4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $84
+ADDRLP4 0
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $81
+LABELV $84
+CNSTI4 0
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $81
+CNSTI4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $87
+ADDRLP4 0
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+NEI4 $85
+LABELV $87
+CNSTI4 1
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $85
+CNSTI4 2
+RETI4
+LABELV $77
+endproc BotTeam 1044 12
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $92
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $93
+ADDRGP4 $89
+JUMPV
+LABELV $92
+CNSTI4 1
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $93
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $89
+CNSTI4 2
+RETI4
+LABELV $88
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $94
+JUMPV
+LABELV $95
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $94
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $98
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $97
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $101
+ADDRLP4 8
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $105
+ADDRLP4 8
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $101
+LABELV $105
+ADDRLP4 12
+CNSTI4 864
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $106
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $106
+CNSTI4 0
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $101
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $110
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+GEI4 $110
+ADDRLP4 0
+CNSTI4 864
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $113
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $115
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_GetEntityPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $117
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $117
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $119
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $119
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $121
+CNSTI4 1
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $121
+CNSTI4 0
+RETI4
+ADDRGP4 $100
+JUMPV
+LABELV $110
+CNSTI4 1
+RETI4
+LABELV $100
+endproc EntityIsDead 20 4
+proc EntityCarriesFlag 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $124
+CNSTI4 1
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $126
+CNSTI4 1
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $128
+CNSTI4 1
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $128
+CNSTI4 0
+RETI4
+LABELV $123
+endproc EntityCarriesFlag 0 0
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $131
+CNSTI4 1
+RETI4
+ADDRGP4 $130
+JUMPV
+LABELV $131
+CNSTI4 0
+RETI4
+LABELV $130
+endproc EntityIsShooting 0 0
+proc EntityIsAlreadyMined 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $134
+CNSTI4 1
+RETI4
+ADDRGP4 $133
+JUMPV
+LABELV $134
+CNSTI4 0
+RETI4
+LABELV $133
+endproc EntityIsAlreadyMined 0 0
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $137
+CNSTI4 1
+RETI4
+ADDRGP4 $136
+JUMPV
+LABELV $137
+CNSTI4 0
+RETI4
+LABELV $136
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $140
+CNSTI4 1
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $140
+CNSTI4 0
+RETI4
+LABELV $139
+endproc EntityHasQuad 0 0
+proc EntityHasKamikaze 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $143
+CNSTI4 1
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $143
+CNSTI4 0
+RETI4
+LABELV $142
+endproc EntityHasKamikaze 0 0
+proc EntityCarriesCubes 236 8
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $146
+CNSTI4 0
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $146
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+232
+INDIRI4
+CNSTI4 0
+LEI4 $148
+CNSTI4 1
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $148
+CNSTI4 0
+RETI4
+LABELV $145
+endproc EntityCarriesCubes 236 8
+export EntityIsInvisible
+proc EntityIsInvisible 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $152
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $154
+CNSTI4 0
+RETI4
+ADDRGP4 $151
+JUMPV
+LABELV $154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $156
+CNSTI4 0
+RETI4
+ADDRGP4 $151
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $158
+CNSTI4 0
+RETI4
+ADDRGP4 $151
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 EntityHasKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $160
+CNSTI4 0
+RETI4
+ADDRGP4 $151
+JUMPV
+LABELV $160
+CNSTI4 1
+RETI4
+ADDRGP4 $151
+JUMPV
+LABELV $152
+CNSTI4 0
+RETI4
+LABELV $151
+endproc EntityIsInvisible 16 4
+export Bot1FCTFCarryingFlag
+proc Bot1FCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+EQI4 $163
+CNSTI4 0
+RETI4
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 5564
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $165
+CNSTI4 1
+RETI4
+ADDRGP4 $162
+JUMPV
+LABELV $165
+CNSTI4 0
+RETI4
+LABELV $162
+endproc Bot1FCTFCarryingFlag 0 0
+export BotHarvesterCarryingCubes
+proc BotHarvesterCarryingCubes 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $168
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $170
+CNSTI4 1
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $172
+CNSTI4 1
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $172
+CNSTI4 0
+RETI4
+LABELV $167
+endproc BotHarvesterCarryingCubes 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRGP4 $174
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 7268
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7280
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7276
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $174
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 152 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+LTI4 $178
+ADDRLP4 132
+INDIRI4
+CNSTI4 13
+GTI4 $178
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $199-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $199
+address $181
+address $182
+address $183
+address $184
+address $185
+address $186
+address $179
+address $188
+address $197
+address $197
+address $198
+address $198
+address $198
+code
+LABELV $181
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $182
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $184
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $185
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRGP4 $179
+JUMPV
+LABELV $189
+ADDRLP4 140
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+EQI4 $196
+ADDRLP4 140
+INDIRI4
+CNSTI4 5
+NEI4 $195
+LABELV $196
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $194
+LABELV $195
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $192
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $192
+LABELV $194
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $192
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $197
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $198
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $179
+ADDRGP4 $202
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $177
+endproc BotSetTeamStatus 152 12
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $212
+LABELV $209
+LABELV $206
+LABELV $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7280
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7276
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $220
+LABELV $218
+LABELV $216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $214
+CNSTI4 0
+RETI4
+LABELV $203
+endproc BotSetLastOrderedTask 60 16
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $223
+ADDRGP4 $222
+JUMPV
+LABELV $223
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $225
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $227
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $225
+LABELV $222
+endproc BotRefuseOrder 8 12
+proc BotCTFSeekGoals 216 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $231
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $236
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $241
+ADDRGP4 $233
+JUMPV
+LABELV $236
+ADDRLP4 148
+ADDRGP4 ctf_blueflag
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $234
+JUMPV
+LABELV $241
+ADDRLP4 148
+ADDRGP4 ctf_redflag
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRGP4 ctf_redflag+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRLP4 188
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 148
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $234
+ADDRLP4 148
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1124073472
+GEF4 $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 7204
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $249
+ADDRGP4 $202
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $250
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $228
+JUMPV
+LABELV $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $254
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 168
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $259
+LABELV $257
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $261
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $271
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $228
+LABELV $271
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+LTI4 $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $228
+LABELV $274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 200
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $280
+LABELV $280
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+CNSTI4 6
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+CNSTI4 7
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+CNSTI4 8
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+CNSTI4 10
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+CNSTI4 11
+EQI4 $228
+ADDRLP4 176
+INDIRI4
+CNSTI4 12
+EQI4 $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $228
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 6
+EQI4 $228
+ADDRLP4 172
+INDIRI4
+CNSTI4 8
+EQI4 $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 188
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRGP4 $228
+JUMPV
+LABELV $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $296
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+NEI4 $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $298
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 4
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 5
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 6
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 7
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 8
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 10
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 11
+EQI4 $309
+ADDRLP4 184
+INDIRI4
+CNSTI4 12
+NEI4 $300
+LABELV $309
+ADDRGP4 $228
+JUMPV
+LABELV $300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRGP4 $228
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $312
+ADDRGP4 $228
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $314
+ADDRGP4 $228
+JUMPV
+LABELV $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 50
+GEI4 $316
+ADDRGP4 $228
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $320
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $321
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $319
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 196
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $322
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $322
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $326
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $326
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $327
+LABELV $323
+ADDRLP4 208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $228
+endproc BotCTFSeekGoals 216 12
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $335
+LABELV $333
+LABELV $332
+endproc BotCTFRetreatGoals 8 4
+proc Bot1FCTFSeekGoals 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $250
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $344
+LABELV $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $350
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 164
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $352
+LABELV $350
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 4
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 8
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 10
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 11
+EQI4 $363
+ADDRLP4 152
+INDIRI4
+CNSTI4 12
+NEI4 $354
+LABELV $363
+ADDRGP4 $337
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $372
+LABELV $372
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 7
+EQI4 $379
+ADDRLP4 156
+INDIRI4
+CNSTI4 8
+EQI4 $379
+ADDRLP4 156
+INDIRI4
+CNSTI4 10
+EQI4 $379
+ADDRLP4 156
+INDIRI4
+CNSTI4 11
+EQI4 $379
+ADDRLP4 156
+INDIRI4
+CNSTI4 12
+NEI4 $374
+LABELV $379
+ADDRGP4 $337
+JUMPV
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $384
+ADDRGP4 $337
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $386
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $386
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $388
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 6
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 7
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 8
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 10
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 11
+EQI4 $400
+ADDRLP4 164
+INDIRI4
+CNSTI4 12
+NEI4 $390
+LABELV $400
+ADDRGP4 $337
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRGP4 $337
+JUMPV
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $403
+ADDRGP4 $337
+JUMPV
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $405
+ADDRGP4 $337
+JUMPV
+LABELV $405
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 50
+GEI4 $407
+ADDRGP4 $337
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $411
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $412
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $410
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $413
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $413
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $416
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $416
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $417
+LABELV $414
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $337
+endproc Bot1FCTFSeekGoals 192 12
+proc Bot1FCTFRetreatGoals 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $425
+LABELV $423
+LABELV $422
+endproc Bot1FCTFRetreatGoals 12 8
+proc BotObeliskSeekGoals 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $430
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $430
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $439
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+EQI4 $439
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+EQI4 $439
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+EQI4 $439
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+EQI4 $439
+ADDRLP4 16
+INDIRI4
+CNSTI4 11
+EQI4 $439
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+NEI4 $432
+LABELV $439
+ADDRGP4 $427
+JUMPV
+LABELV $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRGP4 $427
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $442
+ADDRGP4 $427
+JUMPV
+LABELV $442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 50
+GEI4 $444
+ADDRGP4 $427
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $448
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $449
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $447
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $450
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $450
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $456
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $456
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $457
+LABELV $451
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $427
+endproc BotObeliskSeekGoals 48 12
+export BotGoHarvest
+proc BotGoHarvest 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6632
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $462
+endproc BotGoHarvest 4 12
+proc BotObeliskRetreatGoals 0 0
+LABELV $465
+endproc BotObeliskRetreatGoals 0 0
+proc BotHarvesterSeekGoals 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $466
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $471
+ADDRGP4 $466
+JUMPV
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $475
+LABELV $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 7272
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $477
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $477
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 2
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 3
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 4
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 5
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 7
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 8
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 10
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 11
+EQI4 $488
+ADDRLP4 156
+INDIRI4
+CNSTI4 12
+NEI4 $479
+LABELV $488
+ADDRGP4 $466
+JUMPV
+LABELV $479
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $466
+JUMPV
+LABELV $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $491
+ADDRGP4 $466
+JUMPV
+LABELV $491
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 50
+GEI4 $493
+ADDRGP4 $466
+JUMPV
+LABELV $493
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $495
+LABELV $495
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $499
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotSetTeamFormationDist
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $499
+LABELV $497
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $503
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $504
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $502
+ADDRLP4 172
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 172
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $505
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $505
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $509
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $509
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 180
+INDIRI4
+EQI4 $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $510
+LABELV $506
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $466
+endproc BotHarvesterSeekGoals 192 12
+proc BotHarvesterRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $515
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $516
+LABELV $515
+endproc BotHarvesterRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $525
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $525
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskRetreatGoals
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $527
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $522
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterRetreatGoals
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $532
+JUMPV
+LABELV $531
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskSeekGoals
+CALLV
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $537
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterSeekGoals
+CALLV
+pop
+LABELV $537
+LABELV $536
+LABELV $534
+LABELV $532
+LABELV $522
+ADDRFP4 0
+INDIRP4
+CNSTI4 7128
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $520
+endproc BotTeamGoals 0 4
+proc BotFirstReachabilityArea 124 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+LTI4 $540
+ADDRLP4 108
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $540
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 76+8
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRLP4 112
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 76
+ADDRLP4 112
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRLP4 112
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $541
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $544
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 botCheckedAreas
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+EQI4 $548
+ADDRGP4 $545
+JUMPV
+LABELV $548
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRGP4 botCheckedAreas
+ADDP4
+CNSTU1 1
+ASGNU1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $550
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_AreaCenter
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $552
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $554
+ADDRLP4 72
+ADDRLP4 72
+INDIRF4
+CNSTF4 1107296256
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $554
+ADDRLP4 72
+INDIRF4
+ADDRLP4 104
+INDIRF4
+GEF4 $553
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 16+4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $553
+ADDRLP4 16
+INDIRI4
+ADDRLP4 120
+INDIRI4
+NEI4 $553
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $553
+ADDRLP4 100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $546
+JUMPV
+LABELV $552
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4259841
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 16+4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $564
+ADDRLP4 16
+INDIRI4
+ADDRLP4 116
+INDIRI4
+NEI4 $564
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $564
+ADDRLP4 100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $546
+JUMPV
+LABELV $564
+LABELV $553
+LABELV $550
+LABELV $545
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $547
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $544
+LABELV $546
+ADDRLP4 100
+INDIRI4
+RETI4
+LABELV $539
+endproc BotFirstReachabilityArea 124 28
+export BotPointAreaNum
+proc BotPointAreaNum 344 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $569
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+852
+ADDP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $569
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+848
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $569
+ADDRGP4 botCheckedAreas
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 65536
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 280
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $573
+ADDRLP4 280
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $573
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $575
+ADDRLP4 252
+CNSTI4 0
+ASGNI4
+LABELV $575
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRLP4 32
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $579
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+852
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+848
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $579
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $577
+ADDRLP4 268
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 268+8
+ADDRLP4 268+8
+INDIRF4
+CNSTF4 1106247680
+SUBF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 312
+INDIRI4
+LTI4 $584
+ADDRLP4 316
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+ADDRLP4 312
+INDIRI4
+EQI4 $584
+ADDRLP4 316
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $584
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $584
+ADDRLP4 268
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 320
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $590
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 324
+INDIRI4
+ASGNI4
+LABELV $590
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $594
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+852
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+848
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $594
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $592
+ADDRLP4 324
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 240
+ADDRLP4 324
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 324
+INDIRF4
+ASGNF4
+ADDRLP4 240+8
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 256
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 240+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 240+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 240
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 240+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 240+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 240+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 240+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRLP4 240
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $608
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 340
+INDIRI4
+ASGNI4
+LABELV $608
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $610
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $612
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+852
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+848
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $612
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $610
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $616
+ADDRLP4 300
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+ADDRLP4 296
+INDIRI4
+EQI4 $616
+ADDRLP4 300
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $616
+ADDRLP4 304
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+ADDRGP4 g_entities+236+48
+ADDP4
+ARGP4
+ADDRLP4 304
+INDIRI4
+ADDRGP4 g_entities+236+60
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $624
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 312
+INDIRI4
+ASGNI4
+LABELV $624
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $626
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $628
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+852
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+848
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $628
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $626
+LABELV $616
+ADDRLP4 4
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $635
+JUMPV
+LABELV $632
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $638
+ADDRLP4 304
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+CNSTF4 1132462080
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $639
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $638
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $642
+ADDRLP4 304
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+CNSTF4 1132462080
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $643
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $642
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 304
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $646
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotFirstReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 308
+INDIRI4
+ASGNI4
+LABELV $646
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $648
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $650
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+852
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 864
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+848
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $650
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $648
+LABELV $633
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1055286886
+ADDF4
+ASGNF4
+LABELV $635
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $632
+ADDRLP4 32
+INDIRI4
+RETI4
+LABELV $568
+endproc BotPointAreaNum 344 20
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $657
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $655
+LABELV $657
+CNSTI4 3
+ARGI4
+ADDRGP4 $658
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $659
+RETP4
+ADDRGP4 $654
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $654
+endproc ClientSkin 1032 12
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $664
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $662
+LABELV $664
+CNSTI4 3
+ARGI4
+ADDRGP4 $665
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $659
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $661
+JUMPV
+LABELV $662
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $666
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $661
+endproc ClientName 1032 12
+export ClientFromName
+proc ClientFromName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $668
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $666
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $673
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $667
+JUMPV
+LABELV $673
+LABELV $669
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $671
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $668
+CNSTI4 -1
+RETI4
+LABELV $667
+endproc ClientFromName 1036 12
+export ClientOnSameTeamFromName
+proc ClientOnSameTeamFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $676
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRGP4 $677
+JUMPV
+LABELV $681
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $666
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $683
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $675
+JUMPV
+LABELV $683
+LABELV $677
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $676
+CNSTI4 -1
+RETI4
+LABELV $675
+endproc ClientOnSameTeamFromName 1040 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $692
+JUMPV
+LABELV $689
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $693
+ADDRGP4 $691
+JUMPV
+LABELV $693
+LABELV $690
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $692
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $695
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $689
+LABELV $695
+LABELV $691
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $696
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $685
+JUMPV
+LABELV $696
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $687
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $686
+CNSTP4 0
+RETP4
+LABELV $685
+endproc stristr 12 4
+lit
+align 1
+LABELV $699
+byte 1 0
+skip 127
+export EasyClientName
+code
+proc EasyClientName 196 12
+ADDRLP4 5
+ADDRGP4 $699
+INDIRB
+ASGNB 128
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $703
+JUMPV
+LABELV $700
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $701
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $703
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $700
+ADDRLP4 5
+ARGP4
+ADDRGP4 $708
+ARGP4
+ADDRLP4 148
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRGP4 $707
+JUMPV
+LABELV $704
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $705
+ADDRLP4 5
+ARGP4
+ADDRGP4 $708
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+LABELV $707
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $704
+ADDRLP4 5
+ARGP4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $710
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 164
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 164
+INDIRU4
+EQU4 $711
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 164
+INDIRU4
+EQU4 $711
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $713
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $714
+LABELV $711
+ADDRLP4 168
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 109
+EQI4 $721
+ADDRLP4 168
+INDIRI4
+CNSTI4 77
+NEI4 $715
+LABELV $721
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $724
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+EQI4 $724
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 115
+EQI4 $724
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 83
+NEI4 $715
+LABELV $724
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $715
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 65
+LTI4 $730
+ADDRLP4 172
+INDIRI4
+CNSTI4 90
+GTI4 $730
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $735
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $736
+LABELV $735
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $737
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $736
+LABELV $737
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $732
+LABELV $736
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $733
+JUMPV
+LABELV $732
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $738
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $738
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $739
+JUMPV
+LABELV $738
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $739
+LABELV $733
+LABELV $730
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $729
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $698
+endproc EasyClientName 196 12
+export BotSynonymContext
+proc BotSynonymContext 12 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRLP4 4
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $743
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $741
+LABELV $743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $744
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $744
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $748
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $748
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $750
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $752
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $753
+LABELV $750
+LABELV $747
+LABELV $742
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $740
+endproc BotSynonymContext 12 4
+proc BotUsesMidRangeWeapon 12 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $755
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $755
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 $759-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $759
+address $758
+address $758
+address $755
+address $755
+address $755
+address $755
+address $758
+address $758
+address $758
+address $758
+address $758
+address $758
+code
+LABELV $758
+CNSTI4 1
+RETI4
+ADDRGP4 $754
+JUMPV
+LABELV $755
+CNSTI4 0
+RETI4
+LABELV $754
+endproc BotUsesMidRangeWeapon 12 0
+proc BotUsesCloseCombatWeapon 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $765
+ADDRGP4 $762
+JUMPV
+LABELV $765
+CNSTI4 1
+RETI4
+ADDRGP4 $761
+JUMPV
+LABELV $762
+CNSTI4 0
+RETI4
+LABELV $761
+endproc BotUsesCloseCombatWeapon 4 0
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $769
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $767
+LABELV $769
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $770
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $770
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $768
+LABELV $766
+endproc BotChooseWeapon 20 8
+proc BotWantsToWalk 16 4
+ADDRGP4 bot_nowalk+12
+INDIRI4
+CNSTI4 0
+EQI4 $773
+CNSTI4 0
+RETI4
+ADDRGP4 $772
+JUMPV
+LABELV $773
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRF4
+CNSTF4 1036831949
+GEF4 $776
+CNSTI4 0
+RETI4
+ADDRGP4 $772
+JUMPV
+LABELV $776
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $779
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $779
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $794
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $794
+address $779
+address $779
+address $779
+address $779
+address $784
+address $787
+address $779
+address $791
+code
+LABELV $784
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $779
+CNSTI4 0
+RETI4
+ADDRGP4 $772
+JUMPV
+LABELV $787
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $779
+CNSTI4 0
+RETI4
+ADDRGP4 $772
+JUMPV
+LABELV $791
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $779
+CNSTI4 0
+RETI4
+ADDRGP4 $772
+JUMPV
+LABELV $779
+CNSTI4 1
+RETI4
+LABELV $772
+endproc BotWantsToWalk 16 4
+proc BotSetupForMovement 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+32
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 0+36
+CNSTI4 4
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $799
+ADDRLP4 0+36
+CNSTI4 2
+ASGNI4
+LABELV $800
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $803
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $803
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $806
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $809
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $809
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $809
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotHasScout
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $812
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $812
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 76
+INDIRI4
+EQI4 $815
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $815
+ADDRLP4 0+52
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $815
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $795
+endproc BotSetupForMovement 84 12
+proc BotCheckItemPickup 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+GEI4 $821
+ADDRGP4 $820
+JUMPV
+LABELV $821
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $823
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $823
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $823
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $825
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $827
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $827
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $827
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $829
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $829
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $831
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $831
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $831
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $833
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $833
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $833
+LABELV $825
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 7412
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $839
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $841
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $842
+JUMPV
+LABELV $841
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $844
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $847
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $847
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+EQI4 $847
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $851
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $849
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $849
+LABELV $851
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $849
+LABELV $852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $843
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $849
+LABELV $847
+LABELV $844
+LABELV $842
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $839
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $838
+JUMPV
+LABELV $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $855
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $857
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $856
+JUMPV
+LABELV $855
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $858
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $861
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $865
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $863
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $863
+LABELV $865
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $866
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $863
+LABELV $866
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $857
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $863
+LABELV $861
+LABELV $858
+LABELV $856
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $853
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7264
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $838
+LABELV $835
+LABELV $820
+endproc BotCheckItemPickup 28 12
+proc BotUpdateInventory 1292 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5408
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5420
+ADDP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1044
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 1052
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 1068
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 1076
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5440
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRLP4 1084
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5444
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 1092
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 1100
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1108
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 1116
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 1124
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 1132
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5492
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 34
+NEI4 $869
+ADDRLP4 1184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $870
+JUMPV
+LABELV $869
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $870
+ADDRFP4 0
+INDIRP4
+CNSTI4 5520
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 35
+NEI4 $872
+ADDRLP4 1192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+LABELV $873
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 380
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $875
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $878
+ADDRLP4 1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $879
+JUMPV
+LABELV $878
+ADDRLP4 1208
+CNSTI4 0
+ASGNI4
+LABELV $879
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $881
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $882
+JUMPV
+LABELV $881
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+LABELV $882
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 39
+NEI4 $884
+ADDRLP4 1224
+CNSTI4 1
+ASGNI4
+ADDRGP4 $885
+JUMPV
+LABELV $884
+ADDRLP4 1224
+CNSTI4 0
+ASGNI4
+LABELV $885
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+ADDRLP4 1224
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 40
+NEI4 $887
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRGP4 $888
+JUMPV
+LABELV $887
+ADDRLP4 1232
+CNSTI4 0
+ASGNI4
+LABELV $888
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 41
+NEI4 $890
+ADDRLP4 1240
+CNSTI4 1
+ASGNI4
+ADDRGP4 $891
+JUMPV
+LABELV $890
+ADDRLP4 1240
+CNSTI4 0
+ASGNI4
+LABELV $891
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+ADDRLP4 1240
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 42
+NEI4 $893
+ADDRLP4 1248
+CNSTI4 1
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 1248
+CNSTI4 0
+ASGNI4
+LABELV $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+ADDRLP4 1248
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $896
+ADDRLP4 1256
+CNSTI4 1
+ASGNI4
+ADDRGP4 $897
+JUMPV
+LABELV $896
+ADDRLP4 1256
+CNSTI4 0
+ASGNI4
+LABELV $897
+ADDRFP4 0
+INDIRP4
+CNSTI4 5556
+ADDP4
+ADDRLP4 1256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $899
+ADDRLP4 1264
+CNSTI4 1
+ASGNI4
+ADDRGP4 $900
+JUMPV
+LABELV $899
+ADDRLP4 1264
+CNSTI4 0
+ASGNI4
+LABELV $900
+ADDRFP4 0
+INDIRP4
+CNSTI4 5560
+ADDP4
+ADDRLP4 1264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRLP4 1272
+CNSTI4 1
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $902
+ADDRLP4 1272
+CNSTI4 0
+ASGNI4
+LABELV $903
+ADDRFP4 0
+INDIRP4
+CNSTI4 5564
+ADDP4
+ADDRLP4 1272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+EQI4 $904
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRFP4 0
+INDIRP4
+CNSTI4 5568
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5572
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $905
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1288
+ADDRGP4 BotOnlyPickupImportantItems
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5576
+ADDP4
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $867
+endproc BotUpdateInventory 1292 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $907
+ADDRGP4 $906
+JUMPV
+LABELV $907
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5592
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5588
+ADDP4
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 64
+LTI4 $925
+ADDRLP4 156
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $927
+ADDRLP4 156
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $925
+LABELV $927
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $926
+JUMPV
+LABELV $925
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $926
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $923
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $924
+JUMPV
+LABELV $923
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+LABELV $924
+ADDRFP4 0
+INDIRP4
+CNSTI4 5596
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $906
+endproc BotUpdateBattleInventory 160 8
+proc BotWantsToUseKamikaze 100 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $929
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $931
+CNSTI4 864
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $931
+CNSTI4 1
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $931
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $935
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $935
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $937
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $937
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $937
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LEI4 $939
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LEI4 $939
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $939
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $941
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $941
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $941
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $943
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $943
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $943
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5440
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LEI4 $945
+ADDRFP4 0
+INDIRP4
+CNSTI4 5488
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LEI4 $945
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $945
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5444
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $947
+ADDRFP4 0
+INDIRP4
+CNSTI4 5492
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $947
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $947
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $949
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $949
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $949
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $951
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $951
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $951
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $953
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $953
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $953
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $955
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $955
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $955
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $957
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $957
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $957
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LEI4 $930
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LEI4 $930
+CNSTI4 0
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $929
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $961
+CNSTI4 864
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $961
+CNSTI4 1
+RETI4
+ADDRGP4 $928
+JUMPV
+LABELV $961
+LABELV $930
+CNSTI4 0
+RETI4
+LABELV $928
+endproc BotWantsToUseKamikaze 100 0
+proc BotUseKamikaze 320 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $966
+ADDRGP4 $965
+JUMPV
+LABELV $966
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $968
+ADDRGP4 $965
+JUMPV
+LABELV $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRLP4 224
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+LTI4 $971
+ADDRLP4 224
+INDIRI4
+CNSTI4 7
+GTI4 $971
+ADDRLP4 224
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1076-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1076
+address $972
+address $971
+address $975
+address $978
+address $1005
+address $1032
+address $1049
+code
+LABELV $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleEnemies
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $975
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 232
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LEI4 $971
+ADDRLP4 232
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $978
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRGP4 $965
+JUMPV
+LABELV $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $981
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1233125376
+GEF4 $990
+ADDRGP4 $965
+JUMPV
+LABELV $990
+LABELV $981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $992
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $1001
+LABELV $992
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 252
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 2
+LEI4 $971
+ADDRLP4 252
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $1005
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRGP4 $965
+JUMPV
+LABELV $1006
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1008
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 272
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1017
+ADDRGP4 $965
+JUMPV
+LABELV $1017
+LABELV $1008
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1019
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $1028
+LABELV $1019
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 272
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LEI4 $971
+ADDRLP4 272
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $1032
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+ADDRGP4 $1033
+JUMPV
+LABELV $1036
+ADDRLP4 164
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1034
+JUMPV
+LABELV $1033
+ADDRLP4 164
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1034
+ADDRLP4 152
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 152
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 152+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 152+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+CNSTF4 1224401224
+GEF4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1048
+ADDRLP4 168+52
+INDIRI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $971
+LABELV $1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $1049
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1050
+ADDRGP4 $965
+JUMPV
+LABELV $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1052
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 312
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 312
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1061
+ADDRGP4 $965
+JUMPV
+LABELV $1061
+LABELV $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $1063
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 20+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 316
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+CNSTF4 1233125376
+GEF4 $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $1072
+LABELV $1063
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotCountVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 312
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+LEI4 $971
+ADDRLP4 312
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotWantsToUseKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $971
+LABELV $965
+endproc BotUseKamikaze 320 28
+proc BotBattleUseItems 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1079
+ADDRFP4 0
+INDIRP4
+CNSTI4 5520
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1081
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $1081
+LABELV $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseKamikaze
+CALLV
+pop
+LABELV $1078
+endproc BotBattleUseItems 0 4
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1084
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1084
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1083
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1088
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1088
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1089
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1086
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1091
+CNSTI4 1
+RETI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1091
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $1093
+CNSTI4 1
+RETI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1093
+CNSTI4 0
+RETI4
+LABELV $1090
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9156
+INDIRI4
+CNSTI4 0
+EQI4 $1096
+CNSTI4 1
+RETI4
+ADDRGP4 $1095
+JUMPV
+LABELV $1096
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $1102
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $1100
+LABELV $1102
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1101
+JUMPV
+LABELV $1100
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1101
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1095
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $1103
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $1106
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1107
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $1106
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $1107
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1108
+CNSTI4 2
+ARGI4
+ADDRGP4 $1110
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1105
+JUMPV
+LABELV $1108
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1105
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1115
+JUMPV
+LABELV $1112
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1116
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1111
+JUMPV
+LABELV $1116
+LABELV $1113
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1115
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1112
+CNSTP4 0
+RETP4
+LABELV $1111
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1122
+JUMPV
+LABELV $1119
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1120
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1122
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1119
+LABELV $1118
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1124
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $1125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $1124
+LABELV $1123
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $1131
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1132
+JUMPV
+LABELV $1131
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1132
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1129
+endproc TeamPlayIsOn 4 0
+export BotCanCamp
+proc BotCanCamp 172 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $1134
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+GEI4 $1134
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1134
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1136
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1136
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1138
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1140
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1140
+LABELV $1138
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1142
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1142
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1144
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1144
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1146
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1146
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1150
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $1148
+LABELV $1150
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1148
+LABELV $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1148
+LABELV $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $1148
+LABELV $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1148
+LABELV $1154
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $1157
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1157
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 128+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 200
+LEI4 $1168
+CNSTI4 0
+RETI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1168
+LABELV $1155
+CNSTI4 1
+RETI4
+LABELV $1133
+endproc BotCanCamp 172 8
+export BotAggression
+proc BotAggression 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 176
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRGP4 bot_alt_aggressive+12
+INDIRI4
+CNSTI4 0
+NEI4 $1171
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1174
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1174
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1176
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1176
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1178
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1178
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1180
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $1182
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1182
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 4+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 4+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 4+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 132+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 132+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1194
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 64
+LTI4 $1196
+ADDRLP4 188
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1200
+ADDRLP4 188
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1196
+LABELV $1200
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1196
+ADDRLP4 156
+INDIRI4
+CNSTI4 42
+LEI4 $1201
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1201
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1203
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1203
+ADDRLP4 152
+INDIRI4
+CNSTI4 40000
+GEI4 $1205
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1205
+ADDRLP4 148
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1207
+ADDRLP4 152
+INDIRI4
+CNSTI4 500
+GEI4 $1207
+ADDRLP4 132
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 4+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $1209
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1209
+LABELV $1207
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1194
+ADDRLP4 156
+INDIRI4
+CNSTI4 200
+LEI4 $1212
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1212
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 1
+NEI4 $1214
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1214
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1217
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1217
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1217
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 13
+NEI4 $1219
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1219
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 8
+NEI4 $1222
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1222
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 7
+NEI4 $1225
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1225
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 6
+NEI4 $1228
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1228
+ADDRLP4 4+112
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1231
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1231
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $1234
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1234
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1234
+LABELV $1180
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1236
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1236
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1238
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1240
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1240
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1242
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1242
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+GEF4 $1244
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1244
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+GEF4 $1246
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1248
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1248
+LABELV $1246
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1250
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1250
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1252
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1252
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1254
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1254
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1256
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1256
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1256
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1258
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1258
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1260
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1262
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1264
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1266
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1266
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1266
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1268
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1270
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1272
+CNSTI4 100
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1272
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1171
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1274
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1274
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1276
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1276
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1278
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1278
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1280
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $1282
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1282
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 4+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 4+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 4+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 132+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 132+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1294
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 64
+LTI4 $1296
+ADDRLP4 188
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1300
+ADDRLP4 188
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1296
+LABELV $1300
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1296
+ADDRLP4 156
+INDIRI4
+CNSTI4 42
+LEI4 $1301
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1301
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1303
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1303
+ADDRLP4 152
+INDIRI4
+CNSTI4 40000
+GEI4 $1305
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1305
+ADDRLP4 148
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1307
+ADDRLP4 152
+INDIRI4
+CNSTI4 500
+GEI4 $1307
+ADDRLP4 132
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 4+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $1309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1309
+LABELV $1307
+LABELV $1294
+ADDRLP4 156
+INDIRI4
+CNSTI4 200
+LEI4 $1312
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1312
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 1
+NEI4 $1314
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1314
+ADDRLP4 148
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1317
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1317
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1317
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 13
+NEI4 $1319
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1322
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $1323
+JUMPV
+LABELV $1322
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1323
+LABELV $1319
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 8
+NEI4 $1324
+ADDRLP4 152
+INDIRI4
+CNSTI4 200
+GEI4 $1327
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRGP4 $1328
+JUMPV
+LABELV $1327
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1328
+LABELV $1324
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 7
+NEI4 $1329
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1329
+ADDRLP4 4+116
+INDIRI4
+CNSTI4 6
+NEI4 $1332
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1332
+ADDRLP4 4+112
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1335
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1335
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $1338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1338
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1338
+LABELV $1280
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1340
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1340
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1342
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1342
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1344
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1346
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1346
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+GEF4 $1348
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1348
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1120403456
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+GEF4 $1350
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1352
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1352
+LABELV $1350
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1354
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1354
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1356
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+LABELV $1356
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1358
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1358
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1360
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1362
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1362
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1362
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1364
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1366
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1366
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1366
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1368
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1370
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1370
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+LABELV $1370
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1372
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1374
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1374
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1374
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1376
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1376
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1170
+endproc BotAggression 216 16
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1379
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1378
+JUMPV
+LABELV $1379
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1381
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1378
+JUMPV
+LABELV $1381
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1383
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1378
+JUMPV
+LABELV $1383
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1385
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1378
+JUMPV
+LABELV $1385
+CNSTF4 0
+RETF4
+LABELV $1378
+endproc BotFeelingBad 0 0
+proc BotTeammateNeedsNBG 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 396
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1391
+ADDRFP4 4
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1391
+ADDRFP4 4
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1388
+LABELV $1391
+CNSTI4 1
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1388
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1392
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+CNSTI4 50
+LTI4 $1392
+CNSTI4 0
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1392
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1394
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1394
+CNSTI4 0
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1394
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1396
+ADDRFP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1396
+CNSTI4 0
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1396
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 20
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1398
+ADDRFP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1398
+CNSTI4 0
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1398
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 24
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1400
+ADDRFP4 4
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 15
+LTI4 $1400
+CNSTI4 0
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1400
+ADDRFP4 4
+INDIRP4
+CNSTI4 1004
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_BitCheck
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1402
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 5
+LTI4 $1402
+CNSTI4 0
+RETI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1402
+CNSTI4 1
+RETI4
+LABELV $1387
+endproc BotTeammateNeedsNBG 32 8
+proc BotAvoidItemPickup 1260 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_teamavoidpickup+12
+INDIRI4
+CNSTI4 0
+NEI4 $1405
+CNSTI4 0
+RETI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1405
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $1408
+CNSTI4 0
+RETI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1410
+CNSTI4 0
+RETI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $1415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $1415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1224
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+EQI4 $1412
+LABELV $1415
+CNSTI4 0
+RETI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1412
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+652
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1416
+CNSTI4 0
+RETI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1416
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1228
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1212
+ADDRLP4 1228
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1422
+JUMPV
+LABELV $1419
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1424
+ADDRGP4 $1420
+JUMPV
+LABELV $1424
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRLP4 1232
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $1426
+ADDRGP4 $1420
+JUMPV
+LABELV $1426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1236
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $1428
+ADDRGP4 $1420
+JUMPV
+LABELV $1428
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $1430
+ADDRGP4 $1420
+JUMPV
+LABELV $1430
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1433
+ADDRGP4 $1420
+JUMPV
+LABELV $1433
+ADDRLP4 4
+ARGP4
+ADDRLP4 1240
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+EQI4 $1435
+ADDRGP4 $1420
+JUMPV
+LABELV $1435
+ADDRLP4 132
+CNSTI4 864
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 1244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1244
+INDIRF4
+CNSTF4 0
+GTF4 $1437
+ADDRGP4 $1420
+JUMPV
+LABELV $1437
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 4+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 4+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 4+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 1188
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 132
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $1446
+ADDRLP4 136
+ARGP4
+ADDRLP4 1252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1252
+INDIRF4
+CNSTF4 1143111680
+CNSTF4 1140457472
+ADDRLP4 1212
+INDIRF4
+MULF4
+SUBF4
+LEF4 $1448
+ADDRGP4 $1420
+JUMPV
+LABELV $1448
+ADDRLP4 4+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 1188
+ARGP4
+ADDRLP4 1256
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $1447
+ADDRGP4 $1420
+JUMPV
+LABELV $1446
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1453
+ADDRGP4 $1420
+JUMPV
+LABELV $1453
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1455
+ADDRGP4 $1420
+JUMPV
+LABELV $1455
+ADDRLP4 136
+ARGP4
+ADDRLP4 1252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 1252
+INDIRF4
+CNSTF4 1140457472
+CNSTF4 1137180672
+ADDRLP4 1212
+INDIRF4
+MULF4
+SUBF4
+LEF4 $1457
+ADDRGP4 $1420
+JUMPV
+LABELV $1457
+ADDRLP4 4+44
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 1188
+ARGP4
+ADDRLP4 1256
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $1459
+ADDRGP4 $1420
+JUMPV
+LABELV $1459
+LABELV $1447
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+652
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1462
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+LEI4 $1462
+ADDRGP4 $1420
+JUMPV
+LABELV $1462
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+652
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1465
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+LEI4 $1465
+ADDRGP4 $1420
+JUMPV
+LABELV $1465
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+652
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1468
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1468
+ADDRGP4 $1420
+JUMPV
+LABELV $1468
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+652
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1471
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1471
+ADDRGP4 $1420
+JUMPV
+LABELV $1471
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1252
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $1474
+ADDRLP4 136
+ARGP4
+ADDRLP4 1256
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1256
+INDIRF4
+CNSTF4 1193033728
+LEF4 $1475
+ADDRGP4 $1420
+JUMPV
+LABELV $1474
+ADDRLP4 132
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 1200
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 1200
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 1200+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 1200+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1478
+ADDRGP4 $1420
+JUMPV
+LABELV $1478
+LABELV $1475
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRLP4 1256
+ADDRGP4 BotTeammateNeedsNBG
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $1484
+CNSTI4 1
+RETI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1484
+LABELV $1420
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1422
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1419
+CNSTI4 0
+RETI4
+LABELV $1404
+endproc BotAvoidItemPickup 1260 16
+export BotAIWaiting
+proc BotAIWaiting 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1487
+CNSTI4 0
+RETI4
+ADDRGP4 $1486
+JUMPV
+LABELV $1487
+CNSTI4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $1489
+CNSTI4 0
+RETI4
+ADDRGP4 $1486
+JUMPV
+LABELV $1489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1492
+CNSTI4 0
+RETI4
+ADDRGP4 $1486
+JUMPV
+LABELV $1492
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1494
+CNSTI4 0
+RETI4
+ADDRGP4 $1486
+JUMPV
+LABELV $1494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotAvoidItemPickup
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1486
+JUMPV
+LABELV $1496
+CNSTI4 0
+RETI4
+LABELV $1486
+endproc BotAIWaiting 12 8
+proc BotHasEmergencyGoal 16 4
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1500
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $1500
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1525-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1525
+address $1501
+address $1518
+address $1500
+address $1522
+code
+LABELV $1501
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1502
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1504
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1505
+CNSTI4 1
+RETI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1504
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1508
+CNSTI4 1
+RETI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1508
+LABELV $1505
+LABELV $1502
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1512
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1500
+CNSTI4 1
+RETI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1512
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1500
+CNSTI4 1
+RETI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1518
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1500
+CNSTI4 1
+RETI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1522
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1500
+CNSTI4 1
+RETI4
+ADDRGP4 $1498
+JUMPV
+LABELV $1500
+CNSTI4 0
+RETI4
+LABELV $1498
+endproc BotHasEmergencyGoal 16 4
+export BotNearbyGoalPickupRange_NoLTG
+proc BotNearbyGoalPickupRange_NoLTG 220 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 51
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+EQI4 $1530
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1533
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 12+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 12+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 40000
+GEI4 $1543
+ADDRLP4 140
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 12+44
+ARGP4
+CNSTI4 180
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRLP4 184
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $1545
+CNSTI4 10
+RETI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1545
+LABELV $1543
+LABELV $1533
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $1548
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1548
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+SUBI4
+ASGNI4
+LABELV $1548
+LABELV $1530
+LABELV $1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1550
+CNSTI4 300
+RETI4
+ADDRGP4 $1527
+JUMPV
+LABELV $1550
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1552
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1552
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1554
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1556
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1556
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1558
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1558
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1560
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1560
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1560
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1562
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1562
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1562
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1564
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1564
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1564
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1566
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1566
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1566
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1568
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1568
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1568
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1570
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1570
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1570
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1572
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1572
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1572
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1574
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1574
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1574
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1576
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1576
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1576
+ADDRLP4 4
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1578
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1578
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1580
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $1580
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1582
+ADDRLP4 0
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1582
+LABELV $1580
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $1584
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1584
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1527
+endproc BotNearbyGoalPickupRange_NoLTG 220 16
+export BotNearbyGoalPickupRange_LTG
+proc BotNearbyGoalPickupRange_LTG 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 51
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 16
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotHasEmergencyGoal
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1587
+CNSTI4 50
+RETI4
+ADDRGP4 $1586
+JUMPV
+LABELV $1587
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1589
+CNSTI4 400
+RETI4
+ADDRGP4 $1586
+JUMPV
+LABELV $1589
+ADDRLP4 0
+CNSTI4 200
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1591
+CNSTI4 300
+RETI4
+ADDRGP4 $1586
+JUMPV
+LABELV $1591
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1593
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1593
+ADDRFP4 0
+INDIRP4
+CNSTI4 5532
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1595
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1595
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1597
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1597
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1599
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+LABELV $1599
+ADDRFP4 0
+INDIRP4
+CNSTI4 5424
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1601
+ADDRFP4 0
+INDIRP4
+CNSTI4 5472
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1601
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1601
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1603
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1603
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1603
+ADDRFP4 0
+INDIRP4
+CNSTI4 5432
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1605
+ADDRFP4 0
+INDIRP4
+CNSTI4 5480
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1605
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1605
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1607
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1607
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1607
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1609
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1609
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1609
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1611
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1611
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1611
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1613
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 3
+LEI4 $1613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $1613
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1615
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1617
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ASGNI4
+LABELV $1617
+ADDRLP4 4
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1619
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1619
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1621
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7260
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1623
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1623
+LABELV $1621
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $1625
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1625
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1586
+endproc BotNearbyGoalPickupRange_LTG 68 16
+export BotOnlyPickupImportantItems
+proc BotOnlyPickupImportantItems 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1628
+CNSTI4 1
+RETI4
+ADDRGP4 $1627
+JUMPV
+LABELV $1628
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1630
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $1632
+CNSTI4 1
+RETI4
+ADDRGP4 $1627
+JUMPV
+LABELV $1632
+LABELV $1630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotHasEmergencyGoal
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1634
+CNSTI4 1
+RETI4
+ADDRGP4 $1627
+JUMPV
+LABELV $1634
+CNSTI4 0
+RETI4
+LABELV $1627
+endproc BotOnlyPickupImportantItems 12 4
+export BotWantsToRetreat
+proc BotWantsToRetreat 164 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1637
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1637
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1639
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $1641
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1641
+LABELV $1639
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1643
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+LABELV $1643
+ADDRLP4 136
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 4
+LTI4 $1646
+ADDRLP4 136
+INDIRI4
+CNSTI4 7
+GTI4 $1646
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1675-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1675
+address $1647
+address $1654
+address $1661
+address $1670
+code
+LABELV $1647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1648
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1648
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1650
+CNSTI4 0
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1650
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1646
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1654
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1655
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1655
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1657
+CNSTI4 0
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1657
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1646
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1661
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1646
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1664
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1664
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+LTI4 $1666
+ADDRLP4 160
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1666
+ADDRLP4 160
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1666
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1666
+CNSTI4 0
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1670
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1671
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1671
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $1646
+CNSTI4 0
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1646
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 50
+GEI4 $1677
+CNSTI4 1
+RETI4
+ADDRGP4 $1636
+JUMPV
+LABELV $1677
+CNSTI4 0
+RETI4
+LABELV $1636
+endproc BotWantsToRetreat 164 8
+export BotWantsToChase
+proc BotWantsToChase 164 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1680
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1680
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1682
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1097859072
+SUBF4
+GEF4 $1684
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1684
+LABELV $1682
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1686
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+LABELV $1686
+ADDRLP4 136
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 4
+LTI4 $1689
+ADDRLP4 136
+INDIRI4
+CNSTI4 7
+GTI4 $1689
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1719-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1719
+address $1690
+address $1697
+address $1704
+address $1714
+code
+LABELV $1690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1691
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1691
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1693
+CNSTI4 1
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1693
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1689
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1697
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1698
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1698
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1700
+CNSTI4 1
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1700
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1689
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1704
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1689
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1707
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1707
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+LTI4 $1709
+ADDRLP4 160
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1713
+ADDRLP4 160
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1709
+LABELV $1713
+CNSTI4 1
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1709
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1715
+CNSTI4 0
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1715
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $1689
+CNSTI4 1
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1689
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 50
+LEI4 $1721
+CNSTI4 1
+RETI4
+ADDRGP4 $1679
+JUMPV
+LABELV $1721
+CNSTI4 0
+RETI4
+LABELV $1679
+endproc BotWantsToChase 164 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $1723
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $1725
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1725
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1728
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1728
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $1730
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1730
+ADDRFP4 0
+INDIRP4
+CNSTI4 5528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1732
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $1734
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 120
+GEI4 $1734
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1734
+LABELV $1732
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1736
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $1738
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 120
+GEI4 $1738
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1738
+LABELV $1736
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $1740
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1740
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1740
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 23
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1742
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1742
+CNSTI4 1
+RETI4
+LABELV $1724
+endproc BotCanAndWantsToRocketJump 12 16
+export BotHasScout
+proc BotHasScout 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1745
+CNSTI4 0
+RETI4
+ADDRGP4 $1744
+JUMPV
+LABELV $1745
+CNSTI4 1
+RETI4
+LABELV $1744
+endproc BotHasScout 0 0
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5552
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5544
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5548
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5540
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1748
+CNSTI4 0
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1750
+CNSTI4 0
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1750
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1752
+ADDRFP4 0
+INDIRP4
+CNSTI4 5416
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1754
+CNSTI4 0
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1754
+LABELV $1752
+ADDRFP4 0
+INDIRP4
+CNSTI4 5428
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1756
+ADDRFP4 0
+INDIRP4
+CNSTI4 5476
+ADDP4
+INDIRI4
+CNSTI4 60
+LEI4 $1756
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1756
+ADDRFP4 0
+INDIRP4
+CNSTI4 5436
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1758
+ADDRFP4 0
+INDIRP4
+CNSTI4 5484
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1758
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1758
+ADDRFP4 0
+INDIRP4
+CNSTI4 5448
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1760
+ADDRFP4 0
+INDIRP4
+CNSTI4 5496
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1760
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1760
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1762
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1762
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1762
+ADDRFP4 0
+INDIRP4
+CNSTI4 5456
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1764
+ADDRFP4 0
+INDIRP4
+CNSTI4 5504
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1764
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1764
+ADDRFP4 0
+INDIRP4
+CNSTI4 5460
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1766
+ADDRFP4 0
+INDIRP4
+CNSTI4 5508
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1766
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1766
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1768
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1768
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1768
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1770
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1770
+CNSTI4 1
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1770
+CNSTI4 0
+RETI4
+LABELV $1747
+endproc BotHasPersistantPowerupAndWeapon 40 0
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7124
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $1773
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $1774
+JUMPV
+LABELV $1773
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7256
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1774
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7252
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1772
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 160 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1776
+CNSTI4 0
+RETI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1776
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 6
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 11
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 12
+EQI4 $1791
+ADDRLP4 132
+INDIRI4
+CNSTI4 13
+NEI4 $1778
+LABELV $1791
+CNSTI4 0
+RETI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1778
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $1792
+CNSTI4 0
+RETI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1792
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $1794
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1794
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $1796
+CNSTI4 0
+RETI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1796
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $1801
+JUMPV
+LABELV $1798
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1803
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $1803
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1803
+LABELV $1799
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $1801
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1798
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $1805
+CNSTI4 0
+RETI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1805
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1775
+endproc BotWantsToCamp 160 16
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $1809
+JUMPV
+LABELV $1808
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $1809
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1808
+LABELV $1807
+endproc BotDontAvoid 68 12
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1813
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1814
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1815
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1812
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 232 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 360
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1817
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $1819
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+EQI4 $1819
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1202702336
+GEF4 $1819
+CNSTI4 0
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1819
+ADDRFP4 0
+INDIRP4
+CNSTI4 7084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1821
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $1823
+ADDRFP4 0
+INDIRP4
+CNSTI4 7088
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $1823
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7092
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1823
+CNSTI4 0
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1821
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+CNSTF4 1053609165
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 196
+CNSTI4 90
+ASGNI4
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+ADDRLP4 196
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 196
+INDIRI4
+GEI4 $1825
+ADDRLP4 152
+CNSTI4 90
+ASGNI4
+LABELV $1825
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1827
+ADDRLP4 96
+CNSTI4 864
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1832
+ADDRGP4 $1828
+JUMPV
+LABELV $1832
+ADDRLP4 96
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1834
+ADDRGP4 $1828
+JUMPV
+LABELV $1834
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $1836
+ADDRGP4 $1828
+JUMPV
+LABELV $1836
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 G_GetEntityEventSoundCoefficient
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $1838
+ADDRGP4 $1828
+JUMPV
+LABELV $1838
+ADDRLP4 108
+INDIRI4
+CNSTI4 10
+GEI4 $1840
+ADDRGP4 $1828
+JUMPV
+LABELV $1840
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 G_GetEntityPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1842
+ADDRLP4 84
+ADDRLP4 148
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $1843
+JUMPV
+LABELV $1842
+ADDRLP4 84
+ADDRLP4 96
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 96
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 96
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 84
+ADDRLP4 216
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 1056964608
+ADDRLP4 84+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1843
+ADDRLP4 0
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 108
+INDIRI4
+MULI4
+LEI4 $1854
+ADDRGP4 $1828
+JUMPV
+LABELV $1854
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 112
+ARGP4
+ADDRLP4 220
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $1856
+ADDRGP4 $1828
+JUMPV
+LABELV $1856
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+CNSTI4 864
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 g_entities+12+12
+ADDP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_InPVSIgnorePortals
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1858
+ADDRGP4 $1828
+JUMPV
+LABELV $1858
+ADDRLP4 136
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 156
+INDIRF4
+DIVF4
+GTF4 $1862
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 84
+INDIRB
+ASGNB 12
+LABELV $1862
+LABELV $1828
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1830
+ADDRLP4 80
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1827
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $1864
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1073741824
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7092
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7088
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1864
+ADDRFP4 0
+INDIRP4
+CNSTI4 7088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1866
+CNSTI4 0
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1866
+ADDRFP4 0
+INDIRP4
+CNSTI4 7104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1868
+CNSTI4 0
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1868
+LABELV $1817
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $1870
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1874
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1876
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1877
+JUMPV
+LABELV $1876
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1877
+LABELV $1874
+ADDRLP4 104
+INDIRF4
+CNSTF4 1061158912
+GEF4 $1878
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1880
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1881
+JUMPV
+LABELV $1880
+ADDRLP4 184
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 184
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1881
+LABELV $1878
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1892
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 112
+ARGP4
+ADDRLP4 196
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1894
+ADDRGP4 $1871
+JUMPV
+LABELV $1894
+LABELV $1892
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 1128792064
+LEF4 $1896
+ADDRLP4 204
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 212
+CNSTP4 0
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 212
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $1913
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1919
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1921
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CNSTF4 1073741824
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1921
+CNSTI4 1
+RETI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1919
+LABELV $1913
+LABELV $1896
+LABELV $1871
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 10
+LTI4 $1870
+ADDRLP4 144
+INDIRF4
+CNSTF4 1045220557
+LTF4 $1923
+ADDRFP4 0
+INDIRP4
+CNSTI4 7108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1924
+JUMPV
+LABELV $1923
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1924
+CNSTI4 0
+RETI4
+LABELV $1816
+endproc BotRoamGoal 232 28
+export BotChooseRoamGoal
+proc BotChooseRoamGoal 12 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1926
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+MULF4
+GEF4 $1928
+CNSTI4 1
+RETI4
+ADDRGP4 $1925
+JUMPV
+LABELV $1928
+CNSTI4 0
+RETI4
+ADDRGP4 $1925
+JUMPV
+LABELV $1926
+CNSTI4 1
+RETI4
+LABELV $1925
+endproc BotChooseRoamGoal 12 16
+lit
+align 4
+LABELV $1932
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $1933
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1934
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAttackMove
+code
+proc BotAttackMove 532 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $1932
+INDIRB
+ASGNB 12
+ADDRLP4 352
+ADDRGP4 $1933
+INDIRB
+ASGNB 12
+ADDRLP4 364
+ADDRGP4 $1934
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRFP4 4
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+GEI4 $1935
+ADDRLP4 60
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $1935
+ADDRFP4 4
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1937
+ADDRLP4 264+40
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 264+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRFP4 4
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 264+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 264+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 264+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 264+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 264+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 264+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $1937
+ADDRLP4 60
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 432
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 436
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 440
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 444
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $1951
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $1951
+ADDRLP4 260
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1953
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $1953
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+4
+INDIRI4
+CNSTI4 0
+NEI4 $1955
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $1955
+ADDRLP4 24
+ADDRLP4 132+16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 132+16+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 132+16+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 452
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 452
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 456
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 1036831949
+LEF4 $1969
+ADDRLP4 56
+INDIRF4
+CNSTF4 1166016512
+CNSTF4 1157627904
+ADDRLP4 456
+INDIRF4
+MULF4
+SUBF4
+LEF4 $1969
+ADDRLP4 328
+ADDRLP4 328
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRGP4 $1970
+JUMPV
+LABELV $1969
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 460
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+EQI4 $1971
+ADDRLP4 328
+CNSTF4 0
+ASGNF4
+LABELV $1971
+LABELV $1970
+ADDRLP4 464
+CNSTF4 1149239296
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 464
+INDIRF4
+ADDF4
+LEF4 $1973
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+LABELV $1973
+ADDRFP4 4
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $1975
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $1975
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1977
+ADDRLP4 472
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 332
+INDIRF4
+GEF4 $1979
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1980
+JUMPV
+LABELV $1979
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1981
+ADDRLP4 476
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 328
+INDIRF4
+GEF4 $1981
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1981
+LABELV $1980
+LABELV $1977
+ADDRFP4 4
+INDIRP4
+CNSTI4 6588
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1983
+ADDRLP4 340
+ADDRFP4 4
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 340+8
+ADDRLP4 340+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 376
+ARGP4
+ADDRLP4 340
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRLP4 364
+ARGP4
+ADDRLP4 132+16
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 376+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1991
+ADDRLP4 376+52
+INDIRI4
+ADDRLP4 320
+INDIRI4
+NEI4 $1987
+LABELV $1991
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+LABELV $1987
+LABELV $1983
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $1992
+ADDRFP4 4
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1994
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1995
+JUMPV
+LABELV $1994
+ADDRFP4 4
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1995
+LABELV $1992
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $2002
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 476
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 50
+GTI4 $2001
+LABELV $2002
+ADDRLP4 132+116
+INDIRI4
+CNSTI4 8
+EQI4 $2004
+ADDRLP4 132+116
+INDIRI4
+CNSTI4 9
+EQI4 $2004
+ADDRLP4 132+116
+INDIRI4
+CNSTI4 13
+NEI4 $1996
+LABELV $2004
+ADDRLP4 56
+INDIRF4
+CNSTF4 1128792064
+GEF4 $1996
+ADDRLP4 336
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1996
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+EQI4 $1996
+LABELV $2001
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1997
+JUMPV
+LABELV $1996
+ADDRLP4 480
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 480
+INDIRI4
+EQI4 $2008
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 480
+INDIRI4
+NEI4 $2005
+LABELV $2008
+ADDRLP4 124
+CNSTI4 4500
+ASGNI4
+ADDRLP4 128
+CNSTI4 250
+ASGNI4
+ADDRGP4 $2006
+JUMPV
+LABELV $2005
+ADDRLP4 484
+CNSTI4 7
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+EQI4 $2012
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 484
+INDIRI4
+NEI4 $2009
+LABELV $2012
+ADDRLP4 124
+CNSTI4 2000
+ASGNI4
+ADDRLP4 128
+CNSTI4 150
+ASGNI4
+ADDRGP4 $2010
+JUMPV
+LABELV $2009
+ADDRLP4 488
+CNSTI4 6
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 488
+INDIRI4
+EQI4 $2016
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 488
+INDIRI4
+NEI4 $2013
+LABELV $2016
+ADDRLP4 124
+CNSTI4 700
+ASGNI4
+ADDRLP4 128
+CNSTI4 100
+ASGNI4
+ADDRGP4 $2014
+JUMPV
+LABELV $2013
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2017
+ADDRLP4 124
+CNSTI4 576
+ASGNI4
+ADDRLP4 128
+CNSTI4 192
+ASGNI4
+ADDRGP4 $2018
+JUMPV
+LABELV $2017
+ADDRLP4 492
+CNSTI4 10
+ASGNI4
+ADDRLP4 132+116
+INDIRI4
+ADDRLP4 492
+INDIRI4
+NEI4 $2019
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ADDRLP4 492
+INDIRI4
+EQI4 $2019
+ADDRLP4 124
+CNSTI4 968
+ASGNI4
+ADDRLP4 128
+CNSTI4 100
+ASGNI4
+ADDRGP4 $2020
+JUMPV
+LABELV $2019
+ADDRLP4 496
+ADDRFP4 4
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 64
+LTI4 $2022
+ADDRLP4 496
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2026
+ADDRLP4 496
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2022
+LABELV $2026
+ADDRLP4 124
+CNSTI4 300
+ASGNI4
+ADDRLP4 128
+CNSTI4 150
+ASGNI4
+ADDRGP4 $2023
+JUMPV
+LABELV $2022
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 504
+INDIRI4
+ASGNI4
+LABELV $2023
+LABELV $2020
+LABELV $2018
+LABELV $2014
+LABELV $2010
+LABELV $2006
+LABELV $1997
+ADDRLP4 260
+INDIRF4
+CNSTF4 1053609165
+GTF4 $2027
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+ADDI4
+CVIF4 4
+LEF4 $2029
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $2031
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $2031
+LABELV $2029
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+SUBI4
+CVIF4 4
+GEF4 $2033
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+EQI4 $2035
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $2035
+LABELV $2033
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $2027
+ADDRLP4 504
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 5360
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 324
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 260
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 1060320051
+LEF4 $2037
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 324
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2037
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 512
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $2039
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 50
+LEI4 $2039
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2039
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+INDIRF4
+ADDRLP4 324
+INDIRF4
+LEF4 $2041
+ADDRLP4 520
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $2043
+ADDRLP4 524
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+ADDRLP4 524
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2043
+LABELV $2041
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $2045
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2052
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2052
+ADDRLP4 520
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $2058
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2059
+JUMPV
+LABELV $2058
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+ADDI4
+CVIF4 4
+LEF4 $2066
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $2067
+JUMPV
+LABELV $2066
+ADDRLP4 56
+INDIRF4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+SUBI4
+CVIF4 4
+GEF4 $2074
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2074
+LABELV $2067
+LABELV $2059
+ADDRFP4 4
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+EQI4 $2082
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+ADDRGP4 $1930
+JUMPV
+LABELV $2082
+ADDRLP4 528
+ADDRFP4 4
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+ADDRLP4 528
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6592
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2046
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $2045
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRB
+ASGNB 52
+LABELV $1930
+endproc BotAttackMove 532 28
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2087
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2085
+LABELV $2087
+CNSTI4 0
+RETI4
+ADDRGP4 $2084
+JUMPV
+LABELV $2085
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2090
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $2088
+LABELV $2090
+CNSTI4 0
+RETI4
+ADDRGP4 $2084
+JUMPV
+LABELV $2088
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $2091
+ADDRLP4 8
+CNSTI4 1376
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1156
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2093
+CNSTI4 1
+RETI4
+ADDRGP4 $2084
+JUMPV
+LABELV $2093
+LABELV $2091
+CNSTI4 0
+RETI4
+LABELV $2084
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $2100
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $2101
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $2101
+JUMPV
+LABELV $2100
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $2104
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $2104
+LABELV $2101
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $2106
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $2107
+CNSTI4 0
+RETI4
+ADDRGP4 $2095
+JUMPV
+LABELV $2106
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRI4
+NEGI4
+CVIF4 4
+MULF4
+GEF4 $2110
+CNSTI4 0
+RETI4
+ADDRGP4 $2095
+JUMPV
+LABELV $2110
+LABELV $2107
+LABELV $2097
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $2096
+CNSTI4 1
+RETI4
+LABELV $2095
+endproc InFieldOfVision 32 4
+export BotStartVisibilityFrame
+proc BotStartVisibilityFrame 4 0
+ADDRLP4 0
+ADDRGP4 botVisibilityFrame
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2112
+endproc BotStartVisibilityFrame 4 0
+proc BotEntityTraceVisible 244 28
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRLP4 72
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 108
+INDIRB
+ASGNB 12
+ADDRLP4 168
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 144
+ADDRLP4 168+4
+INDIRF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 144+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 136
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 196
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 200
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRLP4 204
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 204
+INDIRI4
+CNSTI4 48
+BANDI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 208
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 212
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 216
+INDIRI4
+CNSTI4 48
+BANDI4
+ASGNI4
+ADDRLP4 164
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 220
+INDIRI4
+NEI4 $2125
+ADDRLP4 188
+INDIRI4
+ADDRLP4 220
+INDIRI4
+EQI4 $2123
+LABELV $2125
+CNSTI4 0
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2123
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 224
+INDIRI4
+NEI4 $2128
+ADDRLP4 192
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $2126
+LABELV $2128
+ADDRLP4 164
+CNSTF4 1056964608
+ASGNF4
+LABELV $2126
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $2129
+ADDRLP4 96
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRLP4 72
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 228
+CNSTP4 0
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2137
+ADDRLP4 0+52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $2133
+LABELV $2137
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $2138
+ADDRLP4 160
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $2138
+ADDRLP4 108
+ADDRLP4 0+12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 236
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRGP4 $2139
+JUMPV
+LABELV $2138
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $2149
+ADDRLP4 96
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 108
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRGP4 $2150
+JUMPV
+LABELV $2149
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $2161
+ADDRLP4 84
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 108
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRGP4 $2162
+JUMPV
+LABELV $2161
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+LABELV $2162
+LABELV $2150
+LABELV $2139
+ADDRLP4 240
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDRLP4 240
+INDIRF4
+GEF4 $2174
+ADDRLP4 236
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2175
+JUMPV
+LABELV $2174
+ADDRLP4 236
+CNSTF4 981668463
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2175
+ADDRLP4 120
+ADDRLP4 240
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 120
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 128
+INDIRF4
+LEF4 $2176
+ADDRLP4 128
+ADDRLP4 120
+INDIRF4
+ASGNF4
+LABELV $2176
+ADDRLP4 128
+INDIRF4
+CNSTF4 1008981770
+LTF4 $2178
+CNSTI4 1
+RETI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2178
+LABELV $2133
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $2180
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $2181
+JUMPV
+LABELV $2180
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+NEI4 $2183
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $2184
+JUMPV
+LABELV $2183
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+NEI4 $2186
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 240
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 144+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2187
+JUMPV
+LABELV $2186
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+NEI4 $2195
+ADDRLP4 232
+CNSTF4 3221225472
+ASGNF4
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 240
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 3221225472
+ADDRFP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2195
+LABELV $2187
+LABELV $2184
+LABELV $2181
+LABELV $2130
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 5
+LTI4 $2129
+CNSTI4 0
+RETI4
+LABELV $2113
+endproc BotEntityTraceVisible 244 28
+export BotEntityVisible
+proc BotEntityVisible 256 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $2204
+CNSTI4 0
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2204
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $2206
+CNSTI4 0
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2206
+ADDRLP4 0
+ADDRLP4 12+56
+INDIRF4
+ADDRLP4 12+68
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+56+4
+INDIRF4
+ADDRLP4 12+68+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+56+8
+INDIRF4
+ADDRLP4 12+68+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 200
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 144+8
+ADDRLP4 144+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 0
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 144+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172
+ADDRGP4 bot_visualrange+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 156
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 172
+INDIRI4
+CVIF4 4
+LEF4 $2242
+CNSTI4 0
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2242
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 156
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 176
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 212
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $2244
+CNSTI4 0
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2244
+ADDRLP4 12
+ARGP4
+ADDRLP4 216
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 156
+ARGP4
+ADDRLP4 220
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+CNSTF4 1202702336
+LEF4 $2246
+CNSTI4 0
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2246
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 224
+CNSTI4 64
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 224
+INDIRI4
+GEI4 $2251
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+LTI4 $2251
+ADDRLP4 168
+INDIRI4
+ADDRLP4 224
+INDIRI4
+LTI4 $2248
+LABELV $2251
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotEntityTraceVisible
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+RETI4
+ADDRGP4 $2203
+JUMPV
+LABELV $2248
+ADDRLP4 140
+CNSTI4 56
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 3584
+ADDRLP4 168
+INDIRI4
+MULI4
+ADDRGP4 botVisibility
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+ADDRGP4 botVisibilityFrame
+INDIRI4
+NEI4 $2260
+ADDRLP4 140
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 236
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $2260
+ADDRLP4 140
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 12+16
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $2260
+ADDRLP4 140
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 12+56
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $2260
+ADDRLP4 140
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRLP4 12+68
+ARGP4
+ADDRLP4 248
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $2252
+LABELV $2260
+ADDRLP4 140
+INDIRP4
+ADDRGP4 botVisibilityFrame
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 BotEntityTraceVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 144
+INDIRB
+ASGNB 12
+ADDRLP4 140
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 12+16
+INDIRB
+ASGNB 12
+ADDRLP4 140
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 12+56
+INDIRB
+ASGNB 12
+ADDRLP4 140
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 12+68
+INDIRB
+ASGNB 12
+LABELV $2252
+ADDRLP4 140
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+RETI4
+LABELV $2203
+endproc BotEntityVisible 256 20
+bss
+align 1
+LABELV $2265
+skip 65536
+align 4
+LABELV $2266
+skip 262144
+code
+proc BotEntityIndirectlyVisible 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $2267
+CNSTI4 0
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2267
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2271
+ADDRFP4 4
+INDIRI4
+CNSTI4 1022
+LTI4 $2269
+LABELV $2271
+CNSTI4 0
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2269
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2272
+CNSTI4 0
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2272
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+LTI4 $2274
+ADDRLP4 24
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2278
+ADDRLP4 24
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2274
+LABELV $2278
+CNSTI4 0
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDetermineVisibleTeammates
+CALLV
+pop
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $2282
+JUMPV
+LABELV $2279
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7508
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2285
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2283
+LABELV $2285
+ADDRGP4 $2280
+JUMPV
+LABELV $2283
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LSHI4
+ADDRGP4 $2266
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $2286
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2280
+JUMPV
+LABELV $2286
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 $2265
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2289
+CNSTI4 1
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2289
+LABELV $2280
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2282
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7504
+ADDP4
+INDIRI4
+LTI4 $2279
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2291
+CNSTI4 0
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2291
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2296
+JUMPV
+LABELV $2293
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7508
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2299
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $2297
+LABELV $2299
+ADDRGP4 $2294
+JUMPV
+LABELV $2297
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LSHI4
+ADDRGP4 $2266
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+LEI4 $2300
+ADDRGP4 $2294
+JUMPV
+LABELV $2300
+ADDRLP4 8
+CNSTI4 864
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2303
+ADDRGP4 $2294
+JUMPV
+LABELV $2303
+ADDRLP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2305
+ADDRGP4 $2294
+JUMPV
+LABELV $2305
+ADDRLP4 8
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2307
+ADDRGP4 $2294
+JUMPV
+LABELV $2307
+ADDRLP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 1127481344
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $2310
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2311
+JUMPV
+LABELV $2310
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $2311
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 $2265
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LSHI4
+ADDRGP4 $2266
+ADDP4
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+ADDI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 2000
+MODI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2313
+CNSTI4 1
+RETI4
+ADDRGP4 $2264
+JUMPV
+LABELV $2313
+LABELV $2294
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2296
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7504
+ADDP4
+INDIRI4
+LTI4 $2293
+CNSTI4 0
+RETI4
+LABELV $2264
+endproc BotEntityIndirectlyVisible 48 12
+export BotFindEnemy
+proc BotFindEnemy 556 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 448
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 440
+ADDRLP4 448
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 452
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 452
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 456
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 444
+ADDRLP4 456
+INDIRF4
+ASGNF4
+CNSTI4 864
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1268
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 1000
+SUBI4
+LEI4 $2319
+ADDRLP4 460
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2320
+JUMPV
+LABELV $2319
+ADDRLP4 460
+CNSTI4 0
+ASGNI4
+LABELV $2320
+ADDRLP4 148
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6444
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 540
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $2323
+ADDRLP4 468
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $2324
+JUMPV
+LABELV $2323
+ADDRLP4 468
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $2324
+ADDRLP4 544
+CNSTI4 864
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2325
+ADDRLP4 544
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2325
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2325
+ADDRLP4 472
+ADDRLP4 468
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 472+8
+ADDRLP4 472+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 484
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 552
+CNSTP4 0
+ASGNP4
+ADDRLP4 552
+INDIRP4
+ARGP4
+ADDRLP4 552
+INDIRP4
+ARGP4
+ADDRLP4 472
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 484+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2334
+ADDRLP4 484+52
+INDIRI4
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $2330
+LABELV $2334
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+NEI4 $2335
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2335
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+ADDRLP4 468
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2330
+LABELV $2321
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2337
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 156+4
+INDIRI4
+CNSTI4 0
+NEI4 $2339
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2339
+ADDRLP4 156
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2342
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2342
+ADDRLP4 156
+ARGP4
+ADDRLP4 468
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $2344
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $2344
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2344
+ADDRLP4 156
+ARGP4
+ADDRLP4 476
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $2346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 480
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $2346
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2346
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $2348
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2348
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2348
+ADDRLP4 440
+INDIRF4
+CNSTF4 1045220557
+GEF4 $2350
+CNSTI4 0
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2350
+ADDRLP4 132
+ADDRLP4 156+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 156+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 156+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 492
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CNSTI4 0
+EQI4 $2359
+ADDRLP4 444
+INDIRF4
+CNSTF4 1056964608
+GEF4 $2359
+ADDRFP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2338
+JUMPV
+LABELV $2359
+ADDRLP4 132
+ARGP4
+ADDRLP4 496
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 496
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2338
+JUMPV
+LABELV $2337
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+LABELV $2338
+ADDRLP4 468
+CNSTI4 0
+ASGNI4
+ADDRLP4 292
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $2364
+JUMPV
+LABELV $2361
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2366
+ADDRGP4 $2362
+JUMPV
+LABELV $2366
+ADDRLP4 128
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2368
+ADDRGP4 $2362
+JUMPV
+LABELV $2368
+CNSTI4 864
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 g_entities+368
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2370
+ADDRGP4 $2362
+JUMPV
+LABELV $2370
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+EQI4 $2373
+ADDRGP4 $2362
+JUMPV
+LABELV $2373
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2375
+ADDRGP4 $2362
+JUMPV
+LABELV $2375
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2378
+ADDRGP4 $2362
+JUMPV
+LABELV $2378
+ADDRLP4 0
+ARGP4
+ADDRLP4 476
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+EQI4 $2380
+ADDRGP4 $2362
+JUMPV
+LABELV $2380
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2382
+ADDRLP4 0
+ARGP4
+ADDRLP4 480
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $2384
+ADDRLP4 0
+ARGP4
+ADDRLP4 484
+ADDRGP4 EntityIsAlreadyMined
+CALLI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $2382
+LABELV $2384
+ADDRGP4 $2362
+JUMPV
+LABELV $2382
+ADDRLP4 296
+INDIRF4
+CNSTF4 1056964608
+GEF4 $2385
+ADDRLP4 0
+ARGP4
+ADDRLP4 488
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+EQI4 $2385
+ADDRGP4 $2362
+JUMPV
+LABELV $2385
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $2387
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 492
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 492
+INDIRF4
+CNSTF4 1167663104
+GEF4 $2398
+ADDRGP4 $2362
+JUMPV
+LABELV $2398
+LABELV $2387
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 496
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 496
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 500
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $2407
+ADDRLP4 0
+ARGP4
+ADDRLP4 504
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+NEI4 $2407
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2409
+ADDRLP4 440
+INDIRF4
+CNSTF4 1058642330
+LEF4 $2411
+ADDRLP4 144
+INDIRI4
+CNSTI4 490000
+GEI4 $2411
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 508
+ADDRGP4 BotUsesMidRangeWeapon
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $2411
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 512
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $2411
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $2411
+ADDRLP4 520
+CNSTI4 864
+ASGNI4
+ADDRLP4 520
+INDIRI4
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 g_entities+568
+ADDP4
+INDIRI4
+ADDRLP4 520
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+568
+ADDP4
+INDIRI4
+CNSTI4 20
+ADDI4
+LEI4 $2413
+ADDRGP4 $2362
+JUMPV
+LABELV $2413
+ADDRLP4 440
+INDIRF4
+CNSTF4 1061997773
+LEF4 $2417
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 BotAggression
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 50
+LEI4 $2417
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2417
+ADDRLP4 0+16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRLP4 532
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 156+16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7136
+ADDP4
+ARGP4
+ADDRLP4 536
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+CNSTF4 1069547520
+ADDRLP4 532
+INDIRF4
+MULF4
+ADDRLP4 536
+INDIRF4
+LEF4 $2417
+ADDRGP4 $2362
+JUMPV
+LABELV $2417
+ADDRLP4 440
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2421
+ADDRLP4 540
+CNSTI4 864
+ASGNI4
+ADDRLP4 544
+CNSTI4 300
+ASGNI4
+ADDRLP4 548
+ADDRLP4 540
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+ADDRLP4 128
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 548
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $2421
+ADDRLP4 548
+INDIRI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+LEI4 $2421
+ADDRGP4 $2362
+JUMPV
+LABELV $2421
+LABELV $2411
+ADDRLP4 144
+INDIRI4
+ADDRLP4 288
+INDIRI4
+LEI4 $2426
+ADDRGP4 $2362
+JUMPV
+LABELV $2426
+LABELV $2409
+LABELV $2407
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 508
+INDIRI4
+GEI4 $2428
+ADDRLP4 148
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $2430
+ADDRLP4 0
+ARGP4
+ADDRLP4 512
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $2428
+LABELV $2430
+ADDRLP4 152
+CNSTI4 360
+ASGNI4
+ADDRGP4 $2429
+JUMPV
+LABELV $2428
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 360
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 516
+INDIRI4
+ASGNI4
+LABELV $2429
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $2431
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2433
+ADDRGP4 $2362
+JUMPV
+LABELV $2433
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2435
+ADDRGP4 $2362
+JUMPV
+LABELV $2435
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 520
+ADDRGP4 BotEntityIndirectlyVisible
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $2437
+ADDRGP4 $2362
+JUMPV
+LABELV $2437
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 524
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+GTI4 $2440
+ADDRGP4 $2362
+JUMPV
+LABELV $2440
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $2442
+ADDRGP4 $2362
+JUMPV
+LABELV $2442
+LABELV $2431
+ADDRLP4 520
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 520
+INDIRI4
+GEI4 $2444
+ADDRLP4 144
+INDIRI4
+CNSTI4 10000
+LEI4 $2444
+ADDRLP4 148
+INDIRI4
+ADDRLP4 520
+INDIRI4
+NEI4 $2444
+ADDRLP4 0
+ARGP4
+ADDRLP4 524
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $2444
+ADDRLP4 0
+ARGP4
+ADDRLP4 528
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $2444
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 300
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRLP4 532
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+EQI4 $2446
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2446
+ADDRGP4 $2362
+JUMPV
+LABELV $2446
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_ActivateEntity
+CVPU4 4
+NEU4 $2448
+ADDRGP4 $2362
+JUMPV
+LABELV $2448
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 0+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 0+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 428
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 0+44
+ARGP4
+CNSTI4 90
+ARGI4
+ADDRLP4 428
+ARGP4
+ADDRLP4 540
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 540
+INDIRI4
+CNSTI4 0
+NEI4 $2457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 544
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+EQI4 $2460
+ADDRGP4 $2362
+JUMPV
+LABELV $2460
+LABELV $2457
+LABELV $2444
+ADDRLP4 292
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 0
+INDIRB
+ASGNB 128
+LABELV $2362
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2364
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2361
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $2462
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+LTI4 $2466
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 476
+INDIRI4
+ARGI4
+ADDRLP4 480
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+EQI4 $2464
+LABELV $2466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2464
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 484
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+ADDRLP4 484
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2462
+CNSTI4 0
+RETI4
+LABELV $2315
+endproc BotFindEnemy 556 28
+export BotTeamCubeCarrierVisible
+proc BotTeamCubeCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2473
+JUMPV
+LABELV $2470
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2475
+ADDRGP4 $2471
+JUMPV
+LABELV $2475
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2477
+ADDRGP4 $2471
+JUMPV
+LABELV $2477
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2479
+ADDRGP4 $2471
+JUMPV
+LABELV $2479
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2482
+ADDRGP4 $2471
+JUMPV
+LABELV $2482
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2484
+ADDRGP4 $2471
+JUMPV
+LABELV $2484
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2486
+ADDRGP4 $2471
+JUMPV
+LABELV $2486
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2469
+JUMPV
+LABELV $2471
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2473
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2470
+CNSTI4 -1
+RETI4
+LABELV $2469
+endproc BotTeamCubeCarrierVisible 144 12
+export BotEnemyCubeCarrierVisible
+proc BotEnemyCubeCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2489
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2494
+ADDRGP4 $2490
+JUMPV
+LABELV $2494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2496
+ADDRGP4 $2490
+JUMPV
+LABELV $2496
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2498
+ADDRGP4 $2490
+JUMPV
+LABELV $2498
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2501
+ADDRGP4 $2490
+JUMPV
+LABELV $2501
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2503
+ADDRGP4 $2490
+JUMPV
+LABELV $2503
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2505
+ADDRGP4 $2490
+JUMPV
+LABELV $2505
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2488
+JUMPV
+LABELV $2490
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2492
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2489
+CNSTI4 -1
+RETI4
+LABELV $2488
+endproc BotEnemyCubeCarrierVisible 144 12
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2511
+JUMPV
+LABELV $2508
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2513
+ADDRGP4 $2509
+JUMPV
+LABELV $2513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2515
+ADDRGP4 $2509
+JUMPV
+LABELV $2515
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2517
+ADDRGP4 $2509
+JUMPV
+LABELV $2517
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2520
+ADDRGP4 $2509
+JUMPV
+LABELV $2520
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2522
+ADDRGP4 $2509
+JUMPV
+LABELV $2522
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2524
+ADDRGP4 $2509
+JUMPV
+LABELV $2524
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2507
+JUMPV
+LABELV $2509
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2511
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2508
+CNSTI4 -1
+RETI4
+LABELV $2507
+endproc BotTeamFlagCarrierVisible 144 12
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 140 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2530
+JUMPV
+LABELV $2527
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2532
+ADDRGP4 $2528
+JUMPV
+LABELV $2532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2534
+ADDRGP4 $2528
+JUMPV
+LABELV $2534
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2536
+ADDRGP4 $2528
+JUMPV
+LABELV $2536
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2539
+ADDRGP4 $2528
+JUMPV
+LABELV $2539
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2541
+ADDRGP4 $2528
+JUMPV
+LABELV $2541
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2526
+JUMPV
+LABELV $2528
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2530
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2527
+CNSTI4 -1
+RETI4
+LABELV $2526
+endproc BotTeamFlagCarrier 140 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2547
+JUMPV
+LABELV $2544
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2549
+ADDRGP4 $2545
+JUMPV
+LABELV $2549
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2551
+ADDRGP4 $2545
+JUMPV
+LABELV $2551
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+NEI4 $2553
+ADDRGP4 $2545
+JUMPV
+LABELV $2553
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2556
+ADDRGP4 $2545
+JUMPV
+LABELV $2556
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $2558
+ADDRGP4 $2545
+JUMPV
+LABELV $2558
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $2560
+ADDRGP4 $2545
+JUMPV
+LABELV $2560
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2543
+JUMPV
+LABELV $2545
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2547
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2544
+CNSTI4 -1
+RETI4
+LABELV $2543
+endproc BotEnemyFlagCarrierVisible 144 12
+export BotCountVisibleEnemies
+proc BotCountVisibleEnemies 164 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2563
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2563
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2568
+JUMPV
+LABELV $2565
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2570
+ADDRGP4 $2566
+JUMPV
+LABELV $2570
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2572
+ADDRGP4 $2566
+JUMPV
+LABELV $2572
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2575
+ADDRGP4 $2566
+JUMPV
+LABELV $2575
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+LEF4 $2584
+ADDRGP4 $2566
+JUMPV
+LABELV $2584
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $2586
+ADDRGP4 $2566
+JUMPV
+LABELV $2586
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2588
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2588
+LABELV $2566
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2568
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2565
+LABELV $2562
+endproc BotCountVisibleEnemies 164 12
+export BotCountVisibleTeamMatesAndEnemies
+proc BotCountVisibleTeamMatesAndEnemies 172 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2591
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2591
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2593
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2593
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2598
+JUMPV
+LABELV $2595
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2600
+ADDRGP4 $2596
+JUMPV
+LABELV $2600
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2602
+ADDRGP4 $2596
+JUMPV
+LABELV $2602
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2605
+ADDRGP4 $2596
+JUMPV
+LABELV $2605
+ADDRLP4 144
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 4
+EQI4 $2609
+ADDRLP4 144
+INDIRI4
+CNSTI4 5
+NEI4 $2607
+LABELV $2609
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2610
+ADDRGP4 $2596
+JUMPV
+LABELV $2610
+LABELV $2607
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $2619
+ADDRGP4 $2596
+JUMPV
+LABELV $2619
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $2621
+ADDRGP4 $2596
+JUMPV
+LABELV $2621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2623
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2624
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2624
+JUMPV
+LABELV $2623
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2627
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2627
+LABELV $2624
+LABELV $2596
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2598
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2595
+LABELV $2590
+endproc BotCountVisibleTeamMatesAndEnemies 172 12
+export BotCountAllTeamMates
+proc BotCountAllTeamMates 168 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $2630
+CNSTI4 0
+RETI4
+ADDRGP4 $2629
+JUMPV
+LABELV $2630
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $2635
+JUMPV
+LABELV $2632
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2637
+ADDRGP4 $2633
+JUMPV
+LABELV $2637
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2639
+ADDRGP4 $2633
+JUMPV
+LABELV $2639
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2642
+ADDRGP4 $2633
+JUMPV
+LABELV $2642
+ADDRLP4 132
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+LEF4 $2651
+ADDRGP4 $2633
+JUMPV
+LABELV $2651
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $2653
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2653
+LABELV $2633
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2635
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2632
+ADDRLP4 144
+INDIRI4
+RETI4
+LABELV $2629
+endproc BotCountAllTeamMates 168 8
+proc BotEqualizeTeamScore 4 0
+ADDRGP4 bot_equalize+12
+INDIRI4
+CNSTI4 0
+NEI4 $2656
+CNSTI4 0
+RETI4
+ADDRGP4 $2655
+JUMPV
+LABELV $2656
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+EQI4 $2659
+CNSTI4 0
+RETI4
+ADDRGP4 $2655
+JUMPV
+LABELV $2659
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 bot_equalizer_teambon+8
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+CVIF4 4
+GEF4 $2661
+CNSTI4 1
+RETI4
+ADDRGP4 $2655
+JUMPV
+LABELV $2661
+CNSTI4 0
+RETI4
+LABELV $2655
+endproc BotEqualizeTeamScore 4 0
+proc BotEqualizeWeakestHumanTeamScore 2320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_equalize+12
+INDIRI4
+CNSTI4 0
+NEI4 $2665
+CNSTI4 0
+RETI4
+ADDRGP4 $2664
+JUMPV
+LABELV $2665
+ADDRLP4 2280
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 2280
+INDIRI4
+CNSTI4 0
+NEI4 $2668
+CNSTI4 0
+RETI4
+ADDRGP4 $2664
+JUMPV
+LABELV $2668
+ADDRLP4 2284
+CNSTI4 0
+ASGNI4
+ADDRLP4 2272
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 2276
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 2268
+CNSTI4 999999
+ASGNI4
+ADDRLP4 2260
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 2264
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2284
+INDIRI4
+ASGNI4
+ADDRGP4 $2673
+JUMPV
+LABELV $2670
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2675
+ADDRGP4 $2671
+JUMPV
+LABELV $2675
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 2288
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 2288
+INDIRI4
+CNSTI4 0
+EQI4 $2677
+ADDRGP4 $2671
+JUMPV
+LABELV $2677
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1028+4
+INDIRI4
+CNSTI4 0
+NEI4 $2679
+ADDRGP4 $2671
+JUMPV
+LABELV $2679
+ADDRLP4 1028
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2682
+ADDRGP4 $2671
+JUMPV
+LABELV $2682
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2686
+ADDRLP4 4
+ARGP4
+ADDRGP4 $666
+ARGP4
+ADDRLP4 2292
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2292
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2684
+LABELV $2686
+ADDRGP4 $2671
+JUMPV
+LABELV $2684
+ADDRLP4 4
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 2296
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2296
+INDIRP4
+ARGP4
+ADDRLP4 2300
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2300
+INDIRI4
+CNSTI4 3
+NEI4 $2687
+ADDRGP4 $2671
+JUMPV
+LABELV $2687
+CNSTI4 864
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+236+8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2689
+ADDRGP4 $2671
+JUMPV
+LABELV $2689
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1220
+ARGP4
+ADDRLP4 2304
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 2304
+INDIRI4
+CNSTI4 0
+EQI4 $2693
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1156
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ClientSkin
+CALLP4
+pop
+ADDRLP4 1156
+ARGP4
+ADDRGP4 $2697
+ARGP4
+ADDRLP4 2308
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2308
+INDIRI4
+CNSTI4 0
+NEI4 $2695
+ADDRLP4 2268
+ADDRLP4 1220+300
+INDIRI4
+ASGNI4
+LABELV $2695
+ADDRLP4 1156
+ARGP4
+ADDRGP4 $2701
+ARGP4
+ADDRLP4 2312
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2312
+INDIRI4
+CNSTI4 0
+NEI4 $2699
+ADDRLP4 2272
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2260
+ADDRLP4 1220+300
+INDIRI4
+CVIF4 4
+ADDRGP4 bot_equalizer_fembon+8
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $2699
+ADDRLP4 1156
+ARGP4
+ADDRGP4 $2706
+ARGP4
+ADDRLP4 2316
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2316
+INDIRI4
+CNSTI4 0
+NEI4 $2704
+ADDRLP4 2276
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2264
+ADDRLP4 1220+300
+INDIRI4
+ASGNI4
+LABELV $2704
+LABELV $2693
+LABELV $2671
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2673
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $2670
+ADDRLP4 2268
+INDIRI4
+ADDRLP4 2264
+INDIRI4
+LEI4 $2710
+ADDRLP4 2268
+INDIRI4
+ADDRLP4 2260
+INDIRI4
+GTI4 $2708
+LABELV $2710
+CNSTI4 0
+RETI4
+ADDRGP4 $2664
+JUMPV
+LABELV $2708
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRLP4 2272
+INDIRI4
+NEI4 $2714
+ADDRLP4 2260
+INDIRI4
+ADDRLP4 2264
+INDIRI4
+LTI4 $2713
+LABELV $2714
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRLP4 2276
+INDIRI4
+NEI4 $2711
+ADDRLP4 2264
+INDIRI4
+ADDRLP4 2260
+INDIRI4
+GEI4 $2711
+LABELV $2713
+CNSTI4 1
+RETI4
+ADDRGP4 $2664
+JUMPV
+LABELV $2711
+CNSTI4 0
+RETI4
+LABELV $2664
+endproc BotEqualizeWeakestHumanTeamScore 2320 12
+export BotAimAtEnemy
+proc BotAimAtEnemy 2272 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2140
+INDIRI4
+CNSTI4 0
+LTI4 $2718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2140
+INDIRI4
+ARGI4
+ADDRLP4 2144
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+EQI4 $2716
+LABELV $2718
+ADDRGP4 $2715
+JUMPV
+LABELV $2716
+ADDRLP4 2148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+LEI4 $2721
+ADDRLP4 2148
+INDIRI4
+CNSTI4 14
+LTI4 $2719
+LABELV $2721
+ADDRGP4 $2715
+JUMPV
+LABELV $2719
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $2722
+ADDRGP4 $2715
+JUMPV
+LABELV $2722
+ADDRLP4 0
+ARGP4
+ADDRLP4 2152
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 2152
+INDIRI4
+CNSTI4 0
+EQI4 $2725
+ADDRGP4 $2715
+JUMPV
+LABELV $2725
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $2727
+ADDRLP4 832
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2734
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2730
+LABELV $2734
+ADDRLP4 832+8
+ADDRLP4 832+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $2730
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRGP4 $2715
+JUMPV
+LABELV $2727
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 2160
+ADDRLP4 144+4
+INDIRI4
+ASGNI4
+ADDRLP4 2164
+CNSTI4 2
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LTI4 $2740
+ADDRLP4 2160
+INDIRI4
+CNSTI4 13
+GTI4 $2740
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LSHI4
+ADDRGP4 $2755-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2755
+address $2743
+address $2744
+address $2745
+address $2746
+address $2747
+address $2748
+address $2749
+address $2750
+address $2751
+address $2752
+address $2753
+address $2754
+code
+LABELV $2743
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2172
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2744
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2176
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2176
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2180
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2745
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 39
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2188
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2188
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2746
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2196
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2196
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2747
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2200
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2200
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 41
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2748
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2208
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 42
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2212
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2212
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2749
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2216
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 43
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2220
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2750
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2224
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2224
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2228
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2228
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2751
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2232
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2236
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2752
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2244
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2244
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2753
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2248
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2248
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2252
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2252
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2754
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2256
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2256
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2260
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2260
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $2741
+JUMPV
+LABELV $2740
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2264
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2264
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2268
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2268
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+LABELV $2741
+ADDRLP4 732
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2168
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 732+4
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 732+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2776
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ADDRLP4 732
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+LABELV $2776
+ADDRLP4 828
+INDIRF4
+CNSTF4 1063675494
+GEF4 $2779
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 1158676480
+LEF4 $2788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRF4
+ADDRLP4 732
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+INDIRF4
+ADDRLP4 732+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6724
+ADDP4
+INDIRF4
+ADDRLP4 732+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $2790
+ADDRLP4 140
+CNSTF4 1060320051
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2790
+LABELV $2788
+LABELV $2779
+ADDRLP4 0
+ARGP4
+ADDRLP4 2172
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 2172
+INDIRI4
+CNSTI4 0
+EQI4 $2794
+ADDRLP4 2176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $2796
+ADDRLP4 140
+CNSTF4 1053609165
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2796
+LABELV $2794
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2798
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+LABELV $2798
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 0
+GTF4 $2800
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $2800
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ARGP4
+ADDRLP4 2180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 804
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+LEF4 $2802
+ADDRLP4 804
+CNSTF4 1128792064
+ASGNF4
+LABELV $2802
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1056964608
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 844
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRLP4 844
+INDIRF4
+CNSTF4 1071644672
+LEF4 $2804
+ADDRLP4 804
+ADDRGP4 floattime
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1073741824
+LEF4 $2806
+ADDRLP4 804
+CNSTF4 1073741824
+ASGNF4
+LABELV $2806
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 804
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2804
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2188
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2188
+INDIRI4
+CNSTI4 0
+NEI4 $2810
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2192
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2192
+INDIRI4
+CNSTI4 0
+EQI4 $2808
+LABELV $2810
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRGP4 bot_equalizer_aim+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2808
+ADDRLP4 140
+INDIRF4
+CNSTF4 0
+GTF4 $2812
+ADDRLP4 140
+CNSTF4 953267991
+ASGNF4
+LABELV $2812
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2814
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $2814
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2200
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 2200
+INDIRI4
+CNSTI4 0
+NEI4 $2816
+ADDRLP4 720
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 828
+INDIRF4
+CNSTF4 1056964608
+LEF4 $2819
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $2821
+ADDRLP4 880+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 880+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ARGP4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 832
+ARGP4
+ADDRLP4 2208
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $2836
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1176256512
+LEF4 $2842
+ADDRLP4 720
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2844
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $2844
+LABELV $2842
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $2836
+LABELV $2821
+LABELV $2819
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 50
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 948
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2849
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 2212
+CNSTP4 0
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ARGP4
+ADDRLP4 2212
+INDIRP4
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065185444
+GEF4 $2851
+ADDRGP4 $2715
+JUMPV
+LABELV $2851
+LABELV $2849
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRGP4 $2817
+JUMPV
+LABELV $2816
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 144+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ARGP4
+ADDRLP4 2208
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $2859
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 952+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $2859
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2867
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2867
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2876
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2876
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+LABELV $2876
+LABELV $2867
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $2881
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1176256512
+LEF4 $2897
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1149239296
+LTF4 $2895
+LABELV $2897
+ADDRLP4 828
+INDIRF4
+CNSTF4 1061997773
+LEF4 $2898
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2898
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2236
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 2016
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2016+8
+ADDRLP4 2016+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 2240
+CNSTF4 0
+ASGNF4
+ADDRLP4 2004+8
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004+4
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2032
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2016
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 2244
+CNSTI4 0
+ASGNI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2004
+ARGP4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 720
+ADDRLP4 2032
+INDIRB
+ASGNB 12
+ADDRGP4 $2899
+JUMPV
+LABELV $2898
+ADDRLP4 828
+INDIRF4
+CNSTF4 1053609165
+LEF4 $2931
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2236
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 2028
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 2244
+ADDRLP4 2028
+INDIRF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2028
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2931
+LABELV $2899
+LABELV $2895
+LABELV $2881
+ADDRLP4 828
+INDIRF4
+CNSTF4 1058642330
+LEF4 $2966
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2966
+ADDRLP4 144+344+196
+INDIRF4
+CNSTF4 1112014848
+LEF4 $2966
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $2972
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2212
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 2212
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $2972
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 1992
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 748+4
+INDIRI4
+CNSTI4 0
+EQI4 $2984
+ADDRLP4 1992+8
+ADDRLP4 0+16+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $2985
+JUMPV
+LABELV $2984
+ADDRLP4 1992+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $2985
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 1992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 2216
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1112014848
+GEF4 $2997
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 1992
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 1992+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2220
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2220
+INDIRF4
+CNSTF4 1163984896
+GEF4 $3011
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 808
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 808+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 808+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3022
+ADDRLP4 748+12+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 748+12
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3032
+ADDRLP4 720
+ADDRLP4 1992
+INDIRB
+ASGNB 12
+LABELV $3032
+LABELV $3022
+LABELV $3011
+LABELV $2997
+LABELV $2972
+LABELV $2966
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3035
+ADDRLP4 2212
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2212
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+4
+ADDRLP4 720+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 2220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3035
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 748+12
+INDIRB
+ASGNB 12
+LABELV $2817
+ADDRLP4 144+344+188
+INDIRF4
+CNSTF4 0
+EQF4 $3045
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 864
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 852
+ADDRLP4 808
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+4
+ADDRLP4 808+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 868
+ADDRLP4 852
+INDIRB
+ASGNB 12
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3065
+ADDRLP4 2220
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3066
+JUMPV
+LABELV $3065
+ADDRLP4 2220
+CNSTF4 0
+ASGNF4
+LABELV $3066
+ADDRLP4 868+8
+ADDRLP4 868+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2220
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3071
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3080
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3088
+ADDRLP4 2224
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3089
+JUMPV
+LABELV $3088
+ADDRLP4 2224
+CNSTF4 0
+ASGNF4
+LABELV $3089
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2224
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $3080
+LABELV $3071
+LABELV $3045
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3094
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+NEF4 $3097
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+LEF4 $3100
+ADDRLP4 820
+CNSTF4 1125515264
+ASGNF4
+LABELV $3100
+ADDRLP4 804
+CNSTF4 1053609165
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 804
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3097
+ADDRLP4 140
+INDIRF4
+CNSTF4 1061997773
+GEF4 $3102
+ADDRLP4 128
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+LABELV $3104
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRLP4 744
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 128
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3105
+ADDRLP4 744
+ADDRLP4 744
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 744
+INDIRI4
+CNSTI4 3
+LTI4 $3104
+LABELV $3102
+LABELV $3094
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2216
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2220
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRP4
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 2224
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2228
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2228
+INDIRP4
+ADDRLP4 2228
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2224
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2232
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2236
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2232
+INDIRP4
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 848
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 848
+INDIRF4
+CNSTF4 1063675494
+GTF4 $3113
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $3110
+LABELV $3113
+ADDRLP4 140
+INDIRF4
+CNSTF4 1063675494
+LEF4 $3114
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $3114
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $3116
+ADDRLP4 2244
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2244
+INDIRP4
+ADDRLP4 2244
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $3116
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $3114
+LABELV $3110
+LABELV $2715
+endproc BotAimAtEnemy 2272 56
+export BotAimAtEnemy_New
+proc BotAimAtEnemy_New 2272 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2140
+INDIRI4
+CNSTI4 0
+LTI4 $3121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2140
+INDIRI4
+ARGI4
+ADDRLP4 2144
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 2144
+INDIRI4
+CNSTI4 0
+EQI4 $3119
+LABELV $3121
+ADDRGP4 $3118
+JUMPV
+LABELV $3119
+ADDRLP4 2148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2148
+INDIRI4
+CNSTI4 0
+LEI4 $3124
+ADDRLP4 2148
+INDIRI4
+CNSTI4 14
+LTI4 $3122
+LABELV $3124
+ADDRGP4 $3118
+JUMPV
+LABELV $3122
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $3125
+ADDRGP4 $3118
+JUMPV
+LABELV $3125
+ADDRLP4 0
+ARGP4
+ADDRLP4 2152
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 2152
+INDIRI4
+CNSTI4 0
+EQI4 $3128
+ADDRGP4 $3118
+JUMPV
+LABELV $3128
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $3130
+ADDRLP4 832
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3137
+ADDRLP4 2156
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $3133
+LABELV $3137
+ADDRLP4 832+8
+ADDRLP4 832+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $3133
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRGP4 $3118
+JUMPV
+LABELV $3130
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 2160
+ADDRLP4 144+4
+INDIRI4
+ASGNI4
+ADDRLP4 2164
+CNSTI4 2
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LTI4 $3143
+ADDRLP4 2160
+INDIRI4
+CNSTI4 13
+GTI4 $3143
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 2164
+INDIRI4
+LSHI4
+ADDRGP4 $3158-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3158
+address $3146
+address $3147
+address $3148
+address $3149
+address $3150
+address $3151
+address $3152
+address $3153
+address $3154
+address $3155
+address $3156
+address $3157
+code
+LABELV $3146
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2168
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2172
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2172
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3147
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2176
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2176
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2180
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3148
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 39
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2188
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2188
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3149
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2192
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2196
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2196
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3150
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2200
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2200
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 41
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3151
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2208
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 42
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2212
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2212
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3152
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2216
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 43
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2220
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3153
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2224
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2224
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2228
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2228
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3154
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2232
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2236
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3155
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2244
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2244
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3156
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2248
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2248
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2252
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2252
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3157
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2256
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2256
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2260
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2260
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3144
+JUMPV
+LABELV $3143
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2264
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 828
+ADDRLP4 2264
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2268
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 2268
+INDIRF4
+ASGNF4
+ADDRLP4 824
+CNSTI4 100663297
+ASGNI4
+LABELV $3144
+ADDRLP4 732
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2168
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 732+4
+INDIRF4
+ADDRLP4 2168
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 732+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $3179
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ADDRLP4 732
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+LABELV $3179
+ADDRLP4 828
+INDIRF4
+CNSTF4 1063675494
+GEF4 $3182
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 1158676480
+LEF4 $3191
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+INDIRF4
+ADDRLP4 732
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6720
+ADDP4
+INDIRF4
+ADDRLP4 732+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6724
+ADDP4
+INDIRF4
+ADDRLP4 732+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $3193
+ADDRLP4 140
+CNSTF4 1060320051
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3193
+LABELV $3191
+LABELV $3182
+ADDRLP4 0
+ARGP4
+ADDRLP4 2172
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 2172
+INDIRI4
+CNSTI4 0
+EQI4 $3197
+ADDRLP4 2176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $3199
+ADDRLP4 140
+CNSTF4 1053609165
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3199
+LABELV $3197
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3201
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+LABELV $3201
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 2176
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2176
+INDIRF4
+CNSTF4 0
+GTF4 $3203
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $3203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6716
+ADDP4
+ARGP4
+ADDRLP4 2180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 804
+ADDRLP4 2180
+INDIRF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+LEF4 $3205
+ADDRLP4 804
+CNSTF4 1128792064
+ASGNF4
+LABELV $3205
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1056964608
+ADDRLP4 804
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 844
+ADDRLP4 2184
+INDIRF4
+ASGNF4
+ADDRLP4 844
+INDIRF4
+CNSTF4 1071644672
+LEF4 $3207
+ADDRLP4 804
+ADDRGP4 floattime
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 804
+INDIRF4
+CNSTF4 1073741824
+LEF4 $3209
+ADDRLP4 804
+CNSTF4 1073741824
+ASGNF4
+LABELV $3209
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 804
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3207
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2188
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2188
+INDIRI4
+CNSTI4 0
+NEI4 $3213
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2192
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 2192
+INDIRI4
+CNSTI4 0
+EQI4 $3211
+LABELV $3213
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRGP4 bot_equalizer_aim+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3211
+ADDRLP4 140
+INDIRF4
+CNSTF4 0
+GTF4 $3215
+ADDRLP4 140
+CNSTF4 953267991
+ASGNF4
+LABELV $3215
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $3217
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $3217
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2200
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 2200
+INDIRI4
+CNSTI4 0
+NEI4 $3219
+ADDRLP4 720
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 828
+INDIRF4
+CNSTF4 1056964608
+LEF4 $3222
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $3224
+ADDRLP4 880+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 880
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 880+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 880+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 880+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7032
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7028
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 880
+ARGP4
+CNSTI4 75751934
+ARGI4
+ADDRLP4 832
+ARGP4
+ADDRLP4 2208
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $3239
+ADDRLP4 128
+ADDRLP4 832
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 832+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 832+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3245
+ADDRLP4 720
+ADDRLP4 832
+INDIRB
+ASGNB 12
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3247
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $3247
+LABELV $3245
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $3239
+LABELV $3224
+LABELV $3222
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 50
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2204
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 2204
+INDIRF4
+ASGNF4
+ADDRLP4 948
+INDIRF4
+CNSTF4 1063675494
+LEF4 $3252
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065185444
+GEF4 $3258
+ADDRGP4 $3118
+JUMPV
+LABELV $3258
+LABELV $3252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRGP4 $3220
+JUMPV
+LABELV $3219
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 144+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ARGP4
+ADDRLP4 2208
+ADDRGP4 BotAI_GetClientState
+CALLI4
+ASGNI4
+ADDRLP4 2208
+INDIRI4
+CNSTI4 0
+EQI4 $3266
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 952+176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $3266
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3274
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3274
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3283
+ADDRLP4 748+52
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $3283
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+LABELV $3283
+LABELV $3274
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+EQF4 $3288
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2216
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2216
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6728
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3304
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1149239296
+LTF4 $3302
+LABELV $3304
+ADDRLP4 828
+INDIRF4
+CNSTF4 1061997773
+LEF4 $3305
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3305
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 2236
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 2016
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 2016+8
+ADDRLP4 2016+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 2240
+CNSTF4 0
+ASGNF4
+ADDRLP4 2004+8
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004+4
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2004
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 2032
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2016
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 2244
+CNSTI4 0
+ASGNI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2004
+ARGP4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRLP4 2244
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 720
+ADDRLP4 2032
+INDIRB
+ASGNB 12
+ADDRGP4 $3306
+JUMPV
+LABELV $3305
+ADDRLP4 828
+INDIRF4
+CNSTF4 1053609165
+LEF4 $3338
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2232
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2232
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2236
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 2028
+ADDRLP4 2236
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 2244
+ADDRLP4 2028
+INDIRF4
+ASGNF4
+ADDRLP4 720
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2244
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 2028
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3338
+LABELV $3306
+LABELV $3302
+LABELV $3288
+ADDRLP4 828
+INDIRF4
+CNSTF4 1058642330
+LEF4 $3373
+ADDRLP4 144+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3373
+ADDRLP4 144+344+196
+INDIRF4
+CNSTF4 1112014848
+LEF4 $3373
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $3379
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2212
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 2212
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $3379
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 1992
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 748+4
+INDIRI4
+CNSTI4 0
+EQI4 $3391
+ADDRLP4 1992+8
+ADDRLP4 0+16+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $3392
+JUMPV
+LABELV $3391
+ADDRLP4 1992+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $3392
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 1992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 2216
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRF4
+CNSTF4 1112014848
+GEF4 $3404
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 1992
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 1992+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 1992+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2220
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2220
+INDIRF4
+CNSTF4 1163984896
+GEF4 $3418
+ADDRLP4 128
+ADDRLP4 748+12
+INDIRF4
+ADDRLP4 808
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 748+12+4
+INDIRF4
+ADDRLP4 808+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 748+12+8
+INDIRF4
+ADDRLP4 808+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2224
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 2224
+INDIRF4
+CNSTF4 1176256512
+LEF4 $3429
+ADDRLP4 748+12+8
+ADDRLP4 748+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 748+12
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3439
+ADDRLP4 720
+ADDRLP4 1992
+INDIRB
+ASGNB 12
+LABELV $3439
+LABELV $3429
+LABELV $3418
+LABELV $3404
+LABELV $3379
+LABELV $3373
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3442
+ADDRLP4 2212
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720
+ADDRLP4 720
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2212
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+4
+ADDRLP4 720+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 2216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 2220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3442
+ADDRLP4 748
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ADDRLP4 748+12
+INDIRB
+ASGNB 12
+LABELV $3220
+ADDRLP4 144+344+188
+INDIRF4
+CNSTF4 0
+EQF4 $3452
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 864
+ADDRLP4 128+8
+INDIRF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 808+8
+ADDRLP4 808+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 852
+ADDRLP4 808
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+4
+ADDRLP4 808+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 2216
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 852+8
+ADDRLP4 808+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 820
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 868
+ADDRLP4 852
+INDIRB
+ASGNB 12
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3472
+ADDRLP4 2220
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3473
+JUMPV
+LABELV $3472
+ADDRLP4 2220
+CNSTF4 0
+ASGNF4
+LABELV $3473
+ADDRLP4 868+8
+ADDRLP4 868+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2220
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3478
+ADDRLP4 936
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRLP4 936+8
+ADDRLP4 936+8
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 748
+ARGP4
+ADDRLP4 868
+ARGP4
+ADDRLP4 144+344+160
+ARGP4
+ADDRLP4 144+344+172
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 824
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 748+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $3487
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3495
+ADDRLP4 2224
+CNSTF4 1036831949
+ADDRLP4 864
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $3496
+JUMPV
+LABELV $3495
+ADDRLP4 2224
+CNSTF4 0
+ASGNF4
+LABELV $3496
+ADDRLP4 720+8
+ADDRLP4 720+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDRLP4 144+272
+INDIRF4
+DIVF4
+ADDRLP4 144+344+188
+INDIRF4
+MULF4
+ADDRLP4 2224
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $3487
+LABELV $3478
+LABELV $3452
+ADDRLP4 128
+ADDRLP4 720
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 720+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 720+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 bot_noaccerror+12
+INDIRI4
+CNSTI4 0
+NEI4 $3501
+ADDRLP4 144+272
+INDIRF4
+CNSTF4 0
+NEF4 $3504
+ADDRLP4 128
+ARGP4
+ADDRLP4 2208
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 2208
+INDIRF4
+ASGNF4
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+LEF4 $3507
+ADDRLP4 820
+CNSTF4 1125515264
+ASGNF4
+LABELV $3507
+ADDRLP4 804
+CNSTF4 1053609165
+ADDRLP4 820
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 804
+INDIRF4
+MULF4
+ASGNF4
+LABELV $3504
+ADDRLP4 140
+INDIRF4
+CNSTF4 1061997773
+GEF4 $3509
+ADDRLP4 128
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+LABELV $3511
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRLP4 744
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 128
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $3512
+ADDRLP4 744
+ADDRLP4 744
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 744
+INDIRI4
+CNSTI4 3
+LTI4 $3511
+LABELV $3509
+LABELV $3501
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 2208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2212
+INDIRP4
+ADDRLP4 2212
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2216
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2216
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2220
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2216
+INDIRP4
+ADDRLP4 2220
+INDIRF4
+ASGNF4
+ADDRLP4 2224
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 2228
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2228
+INDIRP4
+ADDRLP4 2228
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 144+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 2224
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 2232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 2232
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 2236
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 2232
+INDIRP4
+ADDRLP4 2236
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 2240
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 848
+ADDRLP4 2240
+INDIRF4
+ASGNF4
+ADDRLP4 848
+INDIRF4
+CNSTF4 1063675494
+GTF4 $3520
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $3517
+LABELV $3520
+ADDRLP4 140
+INDIRF4
+CNSTF4 1063675494
+LEF4 $3521
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $3521
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $3523
+ADDRLP4 2244
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 2244
+INDIRP4
+ADDRLP4 2244
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $3523
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $3521
+LABELV $3517
+LABELV $3118
+endproc BotAimAtEnemy_New 2272 56
+proc BotMayRadiusDamageTeamMate 4184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $3526
+CNSTI4 0
+RETI4
+ADDRGP4 $3525
+JUMPV
+LABELV $3526
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+NEI4 $3529
+CNSTI4 0
+RETI4
+ADDRGP4 $3525
+JUMPV
+LABELV $3529
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3532
+ADDRFP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $3532
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3534
+ADDRLP4 4160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4160
+INDIRI4
+ADDRLP4 4132
+ADDP4
+ADDRLP4 4160
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4164
+INDIRI4
+ADDRLP4 4144
+ADDP4
+ADDRLP4 4164
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3535
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3534
+ADDRLP4 4132
+ARGP4
+ADDRLP4 4144
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4160
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4160
+INDIRI4
+ASGNI4
+ADDRLP4 4156
+CNSTI4 864
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+348
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4168
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 4128
+ADDRLP4 4168
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3542
+JUMPV
+LABELV $3539
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $3543
+ADDRGP4 $3540
+JUMPV
+LABELV $3543
+ADDRLP4 4
+CNSTI4 864
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3545
+ADDRGP4 $3540
+JUMPV
+LABELV $3545
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3547
+ADDRGP4 $3540
+JUMPV
+LABELV $3547
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+ADDRLP4 4156
+INDIRI4
+EQI4 $3549
+ADDRGP4 $3540
+JUMPV
+LABELV $3549
+ADDRLP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3551
+ADDRGP4 $3540
+JUMPV
+LABELV $3551
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3553
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $3557
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3558
+JUMPV
+LABELV $3557
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $3559
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $3560
+JUMPV
+LABELV $3559
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3560
+LABELV $3558
+LABELV $3554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $3553
+ADDRLP4 8
+ARGP4
+ADDRLP4 4172
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4172
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 8
+INDIRF4
+MULF4
+ADDRLP4 4128
+INDIRF4
+MULF4
+LTF4 $3561
+ADDRGP4 $3540
+JUMPV
+LABELV $3561
+CNSTI4 1
+RETI4
+ADDRGP4 $3525
+JUMPV
+LABELV $3540
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3542
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $3539
+CNSTI4 0
+RETI4
+LABELV $3525
+endproc BotMayRadiusDamageTeamMate 4184 16
+export BotCheckAttack
+proc BotCheckAttack 992 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+GEI4 $3564
+ADDRGP4 $3563
+JUMPV
+LABELV $3564
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+LEI4 $3568
+ADDRLP4 868
+INDIRI4
+CNSTI4 14
+LTI4 $3566
+LABELV $3568
+ADDRGP4 $3563
+JUMPV
+LABELV $3566
+ADDRLP4 828
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 876
+CNSTI4 2
+ASGNI4
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LTI4 $3569
+ADDRLP4 828
+INDIRI4
+CNSTI4 13
+GTI4 $3569
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3569
+ADDRGP4 $3563
+JUMPV
+LABELV $3569
+ADDRLP4 656
+INDIRI4
+ARGI4
+ADDRLP4 660
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 660+4
+INDIRI4
+CNSTI4 0
+NEI4 $3571
+ADDRGP4 $3563
+JUMPV
+LABELV $3571
+ADDRLP4 660
+ARGP4
+ADDRLP4 880
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 880
+INDIRI4
+CNSTI4 0
+EQI4 $3574
+ADDRGP4 $3563
+JUMPV
+LABELV $3574
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3576
+ADDRLP4 884
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRLP4 884
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3580
+ADDRLP4 884
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $3576
+LABELV $3580
+ADDRLP4 888
+CNSTI4 864
+ADDRLP4 660
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3581
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3581
+ADDRGP4 $3563
+JUMPV
+LABELV $3581
+LABELV $3576
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 888
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 856
+ADDRLP4 888
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 892
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 800
+ADDRLP4 892
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ARGP4
+ADDRLP4 896
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 896
+INDIRI4
+CNSTI4 0
+EQI4 $3585
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+CNSTF4 1069547520
+ADDF4
+ASGNF4
+ADDRLP4 800
+INDIRF4
+CNSTF4 1075838976
+LEF4 $3587
+ADDRLP4 800
+CNSTF4 1075838976
+ASGNF4
+LABELV $3587
+LABELV $3585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 900
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+CNSTI4 0
+NEI4 $3591
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 904
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 904
+INDIRI4
+CNSTI4 0
+EQI4 $3589
+LABELV $3591
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+ADDRGP4 bot_equalizer_react+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3589
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3593
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $3563
+JUMPV
+LABELV $3593
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3595
+ADDRGP4 $3563
+JUMPV
+LABELV $3595
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3597
+ADDRGP4 $3563
+JUMPV
+LABELV $3597
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $3599
+ADDRGP4 $3563
+JUMPV
+LABELV $3599
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 49
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 908
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 908
+INDIRF4
+ASGNF4
+ADDRLP4 912
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 912
+INDIRI4
+CNSTI4 64
+LTI4 $3606
+ADDRLP4 912
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3605
+ADDRLP4 912
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $3605
+LABELV $3606
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $3601
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 920
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 920
+INDIRI4
+CNSTI4 0
+EQI4 $3601
+LABELV $3605
+ADDRLP4 836
+CNSTF4 0
+ASGNF4
+LABELV $3601
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $3607
+ADDRLP4 924
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 924
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 836
+INDIRF4
+LEF4 $3609
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 836
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3610
+JUMPV
+LABELV $3609
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 836
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3610
+LABELV $3607
+ADDRLP4 788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6708
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6712
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 932
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 0
+EQI4 $3613
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 936
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 936
+INDIRI4
+CNSTI4 0
+EQI4 $3613
+ADDRLP4 788
+ARGP4
+ADDRLP4 940
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 940
+INDIRF4
+CNSTF4 1163984896
+LEF4 $3613
+ADDRGP4 $3563
+JUMPV
+LABELV $3613
+ADDRLP4 944
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 944
+INDIRI4
+CNSTI4 1
+LTI4 $3615
+ADDRLP4 944
+INDIRI4
+CNSTI4 13
+GTI4 $3615
+ADDRLP4 944
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3629-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3629
+address $3618
+address $3619
+address $3620
+address $3621
+address $3622
+address $3623
+address $3623
+address $3624
+address $3624
+address $3625
+address $3626
+address $3627
+address $3628
+code
+LABELV $3618
+ADDRLP4 860
+CNSTI4 90
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3619
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3620
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3621
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3622
+ADDRLP4 860
+CNSTI4 40
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3623
+ADDRLP4 860
+CNSTI4 120
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3624
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3625
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3626
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3627
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3628
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3616
+JUMPV
+LABELV $3615
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+LABELV $3616
+ADDRLP4 788
+ARGP4
+ADDRLP4 952
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 952
+INDIRF4
+CNSTF4 1176256512
+GEF4 $3631
+ADDRLP4 840
+CNSTI4 120
+ASGNI4
+ADDRGP4 $3632
+JUMPV
+LABELV $3631
+ADDRLP4 840
+ADDRLP4 860
+INDIRI4
+ASGNI4
+LABELV $3632
+ADDRLP4 788
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 856
+INDIRF4
+CNSTF4 1058642330
+LEF4 $3633
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 840
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 844
+ARGP4
+ADDRLP4 956
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $3635
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $3635
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $3637
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3637
+ADDRGP4 $3563
+JUMPV
+LABELV $3637
+LABELV $3633
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 840
+INDIRI4
+ARGI4
+ADDRLP4 844
+ARGP4
+ADDRLP4 956
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $3639
+ADDRGP4 $3563
+JUMPV
+LABELV $3639
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRGP4 AngleVectorsForwardRight
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+4
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 588+8
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+8
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3238002688
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 972
+CNSTP4 0
+ASGNP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3665
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3665
+ADDRGP4 $3563
+JUMPV
+LABELV $3665
+ADDRLP4 980
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 816
+ADDRLP4 0
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+344+160
+ARGP4
+ADDRLP4 12+344+172
+ARGP4
+ADDRLP4 816
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 0
+LTI4 $3679
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 64
+GEI4 $3679
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3683
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+52
+INDIRI4
+ARGI4
+ADDRLP4 984
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $3686
+ADDRGP4 $3563
+JUMPV
+LABELV $3686
+LABELV $3683
+LABELV $3679
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+NEI4 $3692
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3689
+LABELV $3692
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3693
+CNSTF4 1148846080
+ADDRLP4 600+8
+INDIRF4
+MULF4
+ADDRLP4 12+344+196
+INDIRF4
+GEF4 $3697
+ADDRLP4 988
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 864
+ADDRLP4 988
+INDIRF4
+ADDRLP4 12+344+192
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 988
+INDIRF4
+ADDRLP4 600+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3705
+ADDRGP4 $3563
+JUMPV
+LABELV $3705
+LABELV $3697
+LABELV $3693
+LABELV $3689
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+12
+ARGP4
+ADDRLP4 12+344+196
+INDIRF4
+ARGF4
+ADDRLP4 988
+ADDRGP4 BotMayRadiusDamageTeamMate
+CALLI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $3711
+ADDRGP4 $3563
+JUMPV
+LABELV $3711
+LABELV $3707
+ADDRGP4 bot_noshoot+12
+INDIRI4
+CNSTI4 0
+EQI4 $3716
+ADDRGP4 $3563
+JUMPV
+LABELV $3716
+ADDRLP4 12+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3719
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3720
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $3720
+JUMPV
+LABELV $3719
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $3720
+ADDRLP4 988
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $3563
+endproc BotCheckAttack 992 28
+export BotCheckAttack_New
+proc BotCheckAttack_New 992 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+GEI4 $3725
+ADDRGP4 $3724
+JUMPV
+LABELV $3725
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+LEI4 $3729
+ADDRLP4 868
+INDIRI4
+CNSTI4 14
+LTI4 $3727
+LABELV $3729
+ADDRGP4 $3724
+JUMPV
+LABELV $3727
+ADDRLP4 828
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 876
+CNSTI4 2
+ASGNI4
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LTI4 $3730
+ADDRLP4 828
+INDIRI4
+CNSTI4 13
+GTI4 $3730
+ADDRLP4 828
+INDIRI4
+ADDRLP4 876
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3730
+ADDRGP4 $3724
+JUMPV
+LABELV $3730
+ADDRLP4 656
+INDIRI4
+ARGI4
+ADDRLP4 660
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 660+4
+INDIRI4
+CNSTI4 0
+NEI4 $3732
+ADDRGP4 $3724
+JUMPV
+LABELV $3732
+ADDRLP4 660
+ARGP4
+ADDRLP4 880
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 880
+INDIRI4
+CNSTI4 0
+EQI4 $3735
+ADDRGP4 $3724
+JUMPV
+LABELV $3735
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3737
+ADDRLP4 884
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRLP4 884
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3741
+ADDRLP4 884
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $3737
+LABELV $3741
+ADDRLP4 888
+CNSTI4 864
+ADDRLP4 660
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3742
+ADDRLP4 888
+INDIRI4
+ADDRGP4 g_entities+608
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $3742
+ADDRGP4 $3724
+JUMPV
+LABELV $3742
+LABELV $3737
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 888
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 888
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 892
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 800
+ADDRLP4 892
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ARGP4
+ADDRLP4 896
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 896
+INDIRI4
+CNSTI4 0
+EQI4 $3746
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+CNSTF4 1069547520
+ADDF4
+ASGNF4
+ADDRLP4 800
+INDIRF4
+CNSTF4 1075838976
+LEF4 $3748
+ADDRLP4 800
+CNSTF4 1075838976
+ASGNF4
+LABELV $3748
+LABELV $3746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 900
+ADDRGP4 BotEqualizeWeakestHumanTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 900
+INDIRI4
+CNSTI4 0
+NEI4 $3752
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 904
+ADDRGP4 BotEqualizeTeamScore
+CALLI4
+ASGNI4
+ADDRLP4 904
+INDIRI4
+CNSTI4 0
+EQI4 $3750
+LABELV $3752
+ADDRLP4 800
+ADDRLP4 800
+INDIRF4
+ADDRGP4 bot_equalizer_react+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3750
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3754
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $3724
+JUMPV
+LABELV $3754
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 800
+INDIRF4
+SUBF4
+LEF4 $3756
+ADDRGP4 $3724
+JUMPV
+LABELV $3756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3758
+ADDRGP4 $3724
+JUMPV
+LABELV $3758
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $3760
+ADDRGP4 $3724
+JUMPV
+LABELV $3760
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 49
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 908
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 908
+INDIRF4
+ASGNF4
+ADDRLP4 912
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 912
+INDIRI4
+CNSTI4 64
+LTI4 $3767
+ADDRLP4 912
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $3766
+ADDRLP4 912
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $3766
+LABELV $3767
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $3762
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 920
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 920
+INDIRI4
+CNSTI4 0
+EQI4 $3762
+LABELV $3766
+ADDRLP4 840
+CNSTF4 0
+ASGNF4
+LABELV $3762
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $3768
+ADDRLP4 924
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 924
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 840
+INDIRF4
+LEF4 $3770
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $3771
+JUMPV
+LABELV $3770
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 840
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $3771
+LABELV $3768
+ADDRFP4 0
+INDIRP4
+CNSTI4 7020
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 12+272
+INDIRF4
+CNSTF4 0
+NEF4 $3772
+ADDRLP4 836
+INDIRF4
+CNSTF4 1045220557
+LEF4 $3775
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 932
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 0
+NEI4 $3775
+ADDRGP4 $3724
+JUMPV
+LABELV $3775
+LABELV $3772
+ADDRLP4 788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6708
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 788+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6712
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 936
+ADDRGP4 BotUsesCloseCombatWeapon
+CALLI4
+ASGNI4
+ADDRLP4 936
+INDIRI4
+CNSTI4 0
+EQI4 $3779
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 940
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 940
+INDIRI4
+CNSTI4 0
+EQI4 $3779
+ADDRLP4 788
+ARGP4
+ADDRLP4 944
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 944
+INDIRF4
+CNSTF4 1163984896
+LEF4 $3779
+ADDRGP4 $3724
+JUMPV
+LABELV $3779
+ADDRLP4 948
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 1
+LTI4 $3781
+ADDRLP4 948
+INDIRI4
+CNSTI4 13
+GTI4 $3781
+ADDRLP4 948
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3795-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3795
+address $3784
+address $3785
+address $3786
+address $3787
+address $3788
+address $3789
+address $3789
+address $3790
+address $3790
+address $3791
+address $3792
+address $3793
+address $3794
+code
+LABELV $3784
+ADDRLP4 860
+CNSTI4 90
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3785
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3786
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3787
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3788
+ADDRLP4 860
+CNSTI4 40
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3789
+ADDRLP4 860
+CNSTI4 120
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3790
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3791
+ADDRLP4 860
+CNSTI4 80
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3792
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3793
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3794
+ADDRLP4 860
+CNSTI4 20
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+ADDRGP4 $3782
+JUMPV
+LABELV $3781
+ADDRLP4 860
+CNSTI4 50
+ASGNI4
+ADDRLP4 832
+CNSTI4 100663297
+ASGNI4
+LABELV $3782
+ADDRLP4 788
+ARGP4
+ADDRLP4 956
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 956
+INDIRF4
+CNSTF4 1176256512
+GEF4 $3797
+ADDRLP4 844
+CNSTI4 120
+ASGNI4
+ADDRGP4 $3798
+JUMPV
+LABELV $3797
+ADDRLP4 844
+ADDRLP4 860
+INDIRI4
+ASGNI4
+LABELV $3798
+ADDRLP4 788
+ARGP4
+ADDRLP4 848
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 836
+INDIRF4
+CNSTF4 1058642330
+LEF4 $3799
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 844
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 848
+ARGP4
+ADDRLP4 960
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $3801
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $3801
+ADDRFP4 0
+INDIRP4
+CNSTI4 7044
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $3803
+ADDRFP4 0
+INDIRP4
+CNSTI4 6700
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $3803
+ADDRGP4 $3724
+JUMPV
+LABELV $3803
+LABELV $3799
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 844
+INDIRI4
+ARGI4
+ADDRLP4 848
+ARGP4
+ADDRLP4 960
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $3805
+ADDRGP4 $3724
+JUMPV
+LABELV $3805
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+ADDRLP4 588
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRGP4 AngleVectorsForwardRight
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+4
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 588+8
+INDIRF4
+ADDRLP4 12+292
+INDIRF4
+MULF4
+ADDRLP4 804+8
+INDIRF4
+ADDRLP4 12+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3238002688
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 972
+CNSTP4 0
+ASGNP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $3831
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3831
+ADDRGP4 $3724
+JUMPV
+LABELV $3831
+ADDRLP4 980
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 816
+ADDRLP4 0
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 980
+INDIRF4
+ADDRLP4 588+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 816+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 588+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 600
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+344+160
+ARGP4
+ADDRLP4 12+344+172
+ARGP4
+ADDRLP4 816
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 0
+LTI4 $3845
+ADDRLP4 600+52
+INDIRI4
+CNSTI4 64
+GEI4 $3845
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+EQI4 $3849
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+52
+INDIRI4
+ARGI4
+ADDRLP4 984
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $3852
+ADDRGP4 $3724
+JUMPV
+LABELV $3852
+LABELV $3849
+LABELV $3845
+ADDRLP4 600+52
+INDIRI4
+ADDRLP4 656
+INDIRI4
+NEI4 $3858
+ADDRLP4 656
+INDIRI4
+CNSTI4 64
+LTI4 $3855
+LABELV $3858
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3859
+CNSTF4 1148846080
+ADDRLP4 600+8
+INDIRF4
+MULF4
+ADDRLP4 12+344+196
+INDIRF4
+GEF4 $3863
+ADDRLP4 988
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 864
+ADDRLP4 988
+INDIRF4
+ADDRLP4 12+344+192
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 988
+INDIRF4
+ADDRLP4 600+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 864
+INDIRF4
+CNSTF4 0
+LEF4 $3871
+ADDRGP4 $3724
+JUMPV
+LABELV $3871
+LABELV $3863
+LABELV $3859
+LABELV $3855
+ADDRLP4 12+344+204
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 600+12
+ARGP4
+ADDRLP4 12+344+196
+INDIRF4
+ARGF4
+ADDRLP4 988
+ADDRGP4 BotMayRadiusDamageTeamMate
+CALLI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $3877
+ADDRGP4 $3724
+JUMPV
+LABELV $3877
+LABELV $3873
+ADDRGP4 bot_noshoot+12
+INDIRI4
+CNSTI4 0
+EQI4 $3882
+ADDRGP4 $3724
+JUMPV
+LABELV $3882
+ADDRLP4 12+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $3885
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $3886
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $3886
+JUMPV
+LABELV $3885
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $3886
+ADDRLP4 988
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $3724
+endproc BotCheckAttack_New 992 28
+lit
+align 4
+LABELV $3898
+byte 4 1143832576
+byte 4 1128792064
+byte 4 1139802112
+align 4
+LABELV $3899
+byte 4 1148321792
+byte 4 1139539968
+byte 4 1143603200
+align 4
+LABELV $3900
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 268 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3893
+ARGP4
+ADDRLP4 152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $3897
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3894
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $3897
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3895
+ARGP4
+ADDRLP4 160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $3891
+LABELV $3897
+ADDRLP4 164
+ADDRGP4 $3898
+INDIRB
+ASGNB 12
+ADDRLP4 176
+ADDRGP4 $3899
+INDIRB
+ASGNB 12
+ADDRLP4 188
+ADDRGP4 $3900
+INDIRB
+ASGNB 12
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3895
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $3901
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $3901
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $3905
+ADDRLP4 208
+INDIRF4
+ADDRLP4 176
+INDIRF4
+GEF4 $3905
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+LEF4 $3907
+ADDRLP4 212
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+GEF4 $3907
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 216
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+LEF4 $3911
+ADDRLP4 216
+INDIRF4
+ADDRLP4 176+8
+INDIRF4
+GEF4 $3911
+ADDRGP4 $3890
+JUMPV
+LABELV $3911
+LABELV $3907
+LABELV $3905
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $3918
+JUMPV
+LABELV $3915
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $3920
+ADDRGP4 $3916
+JUMPV
+LABELV $3920
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $3922
+ADDRGP4 $3916
+JUMPV
+LABELV $3922
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $3925
+ADDRGP4 $3916
+JUMPV
+LABELV $3925
+ADDRLP4 0
+ARGP4
+ADDRLP4 216
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $3927
+ADDRGP4 $3916
+JUMPV
+LABELV $3927
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $3929
+ADDRLP4 0+16
+INDIRF4
+ADDRLP4 176
+INDIRF4
+GEF4 $3929
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+LEF4 $3933
+ADDRLP4 0+16+4
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+GEF4 $3933
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+LEF4 $3941
+ADDRLP4 0+16+8
+INDIRF4
+ADDRLP4 176+8
+INDIRF4
+GEF4 $3941
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $3949
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3917
+JUMPV
+LABELV $3949
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $3951
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+LABELV $3951
+LABELV $3941
+LABELV $3933
+LABELV $3929
+LABELV $3916
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3918
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $3915
+LABELV $3917
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $3892
+ADDRLP4 216
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 188
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 188+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5396
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 188+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5400
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 224
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 232
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 228
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 148
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 240
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 244
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ADDRLP4 248
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 244
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 148
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 252
+ADDRFP4 0
+INDIRP4
+CNSTI4 7064
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 256
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7048
+ADDP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $3892
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $3892
+JUMPV
+LABELV $3891
+ADDRGP4 mapname
+ARGP4
+ADDRGP4 $3895
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $3961
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $3961
+LABELV $3892
+LABELV $3890
+endproc BotMapScripts 268 16
+proc BotModelMinsMaxs 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3967
+JUMPV
+LABELV $3964
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3969
+ADDRGP4 $3965
+JUMPV
+LABELV $3969
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3971
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $3971
+ADDRGP4 $3965
+JUMPV
+LABELV $3971
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $3973
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $3973
+ADDRGP4 $3965
+JUMPV
+LABELV $3973
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3975
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3977
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3977
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3979
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $3979
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $3963
+JUMPV
+LABELV $3975
+LABELV $3965
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+ASGNP4
+LABELV $3967
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3964
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3981
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $3981
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3983
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $3983
+CNSTI4 0
+RETI4
+LABELV $3963
+endproc BotModelMinsMaxs 28 0
+lit
+align 4
+LABELV $3986
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $3987
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+code
+proc BotFuncButtonActivateGoal 600 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRGP4 $3986
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRGP4 $3987
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 536
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3988
+CNSTI4 0
+RETI4
+ADDRGP4 $3985
+JUMPV
+LABELV $3988
+ADDRLP4 148+1
+ARGP4
+ADDRLP4 540
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $3991
+CNSTI4 0
+RETI4
+ADDRGP4 $3985
+JUMPV
+LABELV $3991
+ADDRLP4 292
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 544
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3993
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 288
+INDIRF4
+CNSTF4 0
+NEF4 $3994
+ADDRLP4 288
+CNSTF4 1082130432
+ASGNF4
+LABELV $3994
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3996
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 276+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 SetMovedir
+CALLV
+pop
+ADDRLP4 100
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 548
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 552
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 556
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 560
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 552
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 560
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4019
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $4020
+ADDRLP4 564
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 568
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 568
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 572
+CNSTP4 0
+ASGNP4
+ADDRLP4 572
+INDIRP4
+ARGP4
+ADDRLP4 572
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 568
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4032
+ADDRLP4 356+52
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $4028
+LABELV $4032
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $3985
+JUMPV
+LABELV $4028
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4033
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4037
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4038
+JUMPV
+LABELV $4037
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4038
+LABELV $4034
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4033
+ADDRLP4 576
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 412
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $4050
+JUMPV
+LABELV $4047
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 0
+EQI4 $4051
+ADDRGP4 $4049
+JUMPV
+LABELV $4051
+LABELV $4048
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $4050
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4047
+LABELV $4049
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4053
+LABELV $4053
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4055
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 412
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4057
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4061
+ADDRLP4 584
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 596
+ADDRLP4 584
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+ADDRLP4 596
+INDIRP4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4062
+JUMPV
+LABELV $4061
+ADDRLP4 584
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 596
+ADDRLP4 584
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+ADDRLP4 596
+INDIRP4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4062
+LABELV $4058
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4057
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $3985
+JUMPV
+LABELV $4055
+CNSTI4 0
+RETI4
+ADDRGP4 $3985
+JUMPV
+LABELV $4020
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4063
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4067
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 564
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 568
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 564
+INDIRF4
+ADDRLP4 568
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4068
+JUMPV
+LABELV $4067
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 564
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 568
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 564
+INDIRF4
+ADDRLP4 568
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4068
+LABELV $4064
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4063
+ADDRLP4 564
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 564
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 568
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4080
+JUMPV
+LABELV $4077
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+EQI4 $4081
+ADDRGP4 $4079
+JUMPV
+LABELV $4081
+LABELV $4078
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4080
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $4077
+LABELV $4079
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $4083
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4093
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $4097
+ADDRLP4 572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 572
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ADDRLP4 584
+INDIRP4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $4098
+JUMPV
+LABELV $4097
+ADDRLP4 572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 572
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ADDRLP4 584
+INDIRP4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $4098
+LABELV $4094
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $4093
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $3985
+JUMPV
+LABELV $4083
+CNSTI4 0
+RETI4
+LABELV $3985
+endproc BotFuncButtonActivateGoal 600 28
+proc BotFuncDoorActivateGoal 1080 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4100
+CNSTI4 0
+RETI4
+ADDRGP4 $4099
+JUMPV
+LABELV $4100
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $4103
+CNSTI4 0
+RETI4
+ADDRGP4 $4099
+JUMPV
+LABELV $4103
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1076
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $4099
+endproc BotFuncDoorActivateGoal 1080 20
+proc BotTriggerMultipleActivateGoal 284 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4116
+CNSTI4 0
+RETI4
+ADDRGP4 $4115
+JUMPV
+LABELV $4116
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $4119
+CNSTI4 0
+RETI4
+ADDRGP4 $4115
+JUMPV
+LABELV $4119
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4136
+JUMPV
+LABELV $4133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $4137
+ADDRGP4 $4135
+JUMPV
+LABELV $4137
+LABELV $4134
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4136
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $4133
+LABELV $4135
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $4139
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $4115
+JUMPV
+LABELV $4139
+CNSTI4 0
+RETI4
+LABELV $4115
+endproc BotTriggerMultipleActivateGoal 284 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4150
+CNSTI4 0
+RETI4
+ADDRGP4 $4149
+JUMPV
+LABELV $4150
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $4149
+endproc BotPopFromActivateGoalStack 4 8
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4153
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4157
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $4159
+ADDRLP4 4
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $4159
+LABELV $4157
+LABELV $4154
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $4153
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $4161
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 248
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 244
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $4152
+JUMPV
+LABELV $4161
+CNSTI4 0
+RETI4
+LABELV $4152
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $4165
+JUMPV
+LABELV $4164
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $4165
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4164
+LABELV $4163
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4171
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4172
+JUMPV
+LABELV $4171
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4172
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $4168
+ADDRGP4 $4167
+JUMPV
+LABELV $4168
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4176
+JUMPV
+LABELV $4173
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $4174
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4176
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $4173
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4178
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4179
+JUMPV
+LABELV $4178
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $4179
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4167
+endproc BotEnableActivateGoalAreas 12 8
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $4184
+JUMPV
+LABELV $4181
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $4185
+ADDRGP4 $4182
+JUMPV
+LABELV $4185
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4187
+CNSTI4 1
+RETI4
+ADDRGP4 $4180
+JUMPV
+LABELV $4187
+LABELV $4182
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $4184
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4181
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4189
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4193
+ADDRGP4 $4190
+JUMPV
+LABELV $4193
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4195
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7680
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $4197
+CNSTI4 1
+RETI4
+ADDRGP4 $4180
+JUMPV
+LABELV $4197
+LABELV $4195
+LABELV $4190
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $4189
+CNSTI4 0
+RETI4
+LABELV $4180
+endproc BotIsGoingToActivateEntity 8 0
+proc BotGetActivateGoal 3296 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 248
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3048
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 3048+4
+INDIRI4
+CNSTI4 0
+NEI4 $4200
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4200
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $4203
+ARGP4
+ADDRLP4 3048+92
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3228
+INDIRI4
+ASGNI4
+ADDRGP4 $4208
+JUMPV
+LABELV $4205
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3232
+INDIRI4
+CNSTI4 0
+NEI4 $4209
+ADDRGP4 $4206
+JUMPV
+LABELV $4209
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $4211
+ADDRGP4 $4207
+JUMPV
+LABELV $4211
+LABELV $4206
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3232
+INDIRI4
+ASGNI4
+LABELV $4208
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4205
+LABELV $4207
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4213
+CNSTI4 3
+ARGI4
+ADDRGP4 $4215
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4213
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4216
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4217
+CNSTI4 3
+ARGI4
+ADDRGP4 $4219
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4217
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $4220
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4019
+ARGP4
+ADDRLP4 3196
+ARGP4
+ADDRLP4 3240
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+EQI4 $4223
+ADDRLP4 3196
+INDIRF4
+CNSTF4 0
+EQF4 $4225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4225
+LABELV $4223
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4227
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3192
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $4228
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4228
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4232
+ARGP4
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $4230
+ADDRLP4 3248
+CNSTF4 0
+ASGNF4
+ADDRLP4 3180+8
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180+4
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+LABELV $4230
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3048+16
+ARGP4
+ADDRLP4 3248
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3248
+INDIRI4
+CNSTI4 0
+NEI4 $4235
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4235
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4238
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3200
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRLP4 3200
+INDIRI4
+CNSTI4 0
+EQI4 $4241
+ADDRLP4 3200
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3176
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4246
+JUMPV
+LABELV $4243
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $4247
+ADDRGP4 $4245
+JUMPV
+LABELV $4247
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $4249
+ADDRGP4 $4244
+JUMPV
+LABELV $4249
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $4251
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4251
+LABELV $4244
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4246
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3176
+INDIRI4
+LTI4 $4243
+LABELV $4245
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4256
+JUMPV
+LABELV $4253
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $4257
+ADDRGP4 $4255
+JUMPV
+LABELV $4257
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+EQI4 $4259
+ADDRGP4 $4254
+JUMPV
+LABELV $4259
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $4261
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $4261
+LABELV $4254
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4256
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3176
+INDIRI4
+LTI4 $4253
+LABELV $4255
+LABELV $4241
+LABELV $4238
+LABELV $4220
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4265
+ARGP4
+ADDRLP4 3240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+NEI4 $4263
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4263
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4268
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $4266
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $4269
+CNSTI4 3
+ARGI4
+ADDRGP4 $4272
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4269
+CNSTI4 0
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4266
+CNSTI4 0
+ARGI4
+ADDRLP4 3248
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3248
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4276
+JUMPV
+LABELV $4273
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $4280
+JUMPV
+LABELV $4277
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4283
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3252
+INDIRI4
+CNSTI4 0
+NEI4 $4281
+ADDRGP4 $4278
+JUMPV
+LABELV $4281
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $4284
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3260
+INDIRI4
+ASGNI4
+ADDRGP4 $4279
+JUMPV
+LABELV $4284
+LABELV $4278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+LABELV $4280
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4277
+LABELV $4279
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4286
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $4288
+CNSTI4 3
+ARGI4
+ADDRGP4 $4291
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4288
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $4274
+JUMPV
+LABELV $4286
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4216
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $4292
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $4274
+CNSTI4 3
+ARGI4
+ADDRGP4 $4297
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4274
+JUMPV
+LABELV $4292
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4265
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $4298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3264
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $4300
+ADDRGP4 $4274
+JUMPV
+LABELV $4300
+ADDRLP4 3268
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4302
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4302
+ADDRLP4 3272
+CNSTI4 44
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $4302
+ADDRLP4 3276
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3268
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+LEF4 $4302
+ADDRLP4 3268
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $4302
+ADDRGP4 $4274
+JUMPV
+LABELV $4302
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $4304
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3288
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $4306
+ADDRGP4 $4274
+JUMPV
+LABELV $4306
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $4304
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4298
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4310
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $4308
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3268
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $4311
+ADDRGP4 $4274
+JUMPV
+LABELV $4311
+ADDRLP4 3272
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4313
+ADDRLP4 3272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $4313
+ADDRLP4 3276
+CNSTI4 44
+ASGNI4
+ADDRLP4 3272
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $4313
+ADDRLP4 3280
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3272
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+LEF4 $4313
+ADDRLP4 3272
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $4313
+ADDRGP4 $4274
+JUMPV
+LABELV $4313
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+EQI4 $4315
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3292
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3292
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $4317
+ADDRGP4 $4274
+JUMPV
+LABELV $4317
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $4315
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4199
+JUMPV
+LABELV $4308
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4321
+ARGP4
+ADDRLP4 3268
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $4319
+ADDRGP4 $4274
+JUMPV
+LABELV $4319
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4324
+ARGP4
+ADDRLP4 3272
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+EQI4 $4326
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $4325
+ARGP4
+ADDRLP4 3276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $4322
+LABELV $4326
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4268
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $4327
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+LABELV $4327
+LABELV $4322
+LABELV $4274
+LABELV $4276
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $4330
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $4273
+LABELV $4330
+CNSTI4 0
+RETI4
+LABELV $4199
+endproc BotGetActivateGoal 3296 20
+proc BotGoForActivateGoal 132 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $4332
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $4332
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $4334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4337
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $4331
+JUMPV
+LABELV $4334
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $4339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4341
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $4331
+JUMPV
+LABELV $4339
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $4331
+endproc BotGoForActivateGoal 132 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $4216
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4343
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $4345
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4344
+JUMPV
+LABELV $4343
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $4346
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4344
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $4342
+endproc BotPrintActivateGoalInfo 296 36
+proc BotRandomMove 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $4350
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $4354
+ADDRGP4 $4352
+JUMPV
+LABELV $4354
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CVFI4 4
+CNSTI4 45
+ADDI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+LABELV $4351
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+LTI4 $4350
+LABELV $4352
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $4359
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4360
+JUMPV
+LABELV $4359
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $4360
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+LABELV $4347
+endproc BotRandomMove 36 16
+lit
+align 4
+LABELV $4362
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotObstacleAvoidanceMoveExt
+code
+proc BotObstacleAvoidanceMoveExt 504 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 124
+ADDRGP4 $4362
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 6
+ASGNI4
+ADDRLP4 172
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 172
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 172
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1036831949
+GEF4 $4365
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1135869952
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+LABELV $4365
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $4369
+ADDRLP4 0
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 52
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 0
+LEF4 $4372
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1112014848
+LEF4 $4374
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+ADDRGP4 $4375
+JUMPV
+LABELV $4374
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $4375
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $4373
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $4373
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 5
+ASGNI4
+ADDRGP4 $4373
+JUMPV
+LABELV $4372
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 136+8
+ADDRLP4 136+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRLP4 400
+ADDRGP4 VectorToYaw
+CALLF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 404
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 408
+ADDRLP4 404
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 412
+ADDRLP4 404
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 408
+INDIRF4
+MULF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 412
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 416
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 420
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 420
+INDIRF4
+MULF4
+ADDRLP4 112+4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 424
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 416
+INDIRF4
+ADDRLP4 424
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 216
+ADDRLP4 260+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216+4
+ADDRLP4 260+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216+8
+ADDRLP4 260+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRLP4 432
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 228
+INDIRF4
+GTF4 $4403
+ADDRLP4 436
+CNSTF4 1124532224
+ASGNF4
+ADDRGP4 $4404
+JUMPV
+LABELV $4403
+ADDRLP4 436
+CNSTF4 1119092736
+ADDRLP4 228
+INDIRF4
+ADDRLP4 188
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $4404
+ADDRLP4 256
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRLP4 440
+CNSTF4 0
+ASGNF4
+ADDRLP4 204+8
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 440
+INDIRF4
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 444
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 444
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRLP4 452
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 232+4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 232+8
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 460
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 460
+INDIRI4
+NEI4 $4412
+ADDRLP4 56+4
+INDIRI4
+ADDRLP4 460
+INDIRI4
+NEI4 $4412
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4415
+ADDRLP4 148
+ADDRLP4 232
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $4415
+ADDRLP4 388
+ADDRLP4 56+8
+INDIRF4
+ASGNF4
+ADDRGP4 $4413
+JUMPV
+LABELV $4412
+ADDRLP4 388
+CNSTF4 0
+ASGNF4
+LABELV $4413
+ADDRLP4 256
+CNSTF4 3212836864
+ADDRLP4 256
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 464
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 464
+INDIRF4
+ASGNF4
+ADDRLP4 204
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRLP4 472
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 472
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 472
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 480
+INDIRI4
+NEI4 $4424
+ADDRLP4 56+4
+INDIRI4
+ADDRLP4 480
+INDIRI4
+NEI4 $4424
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4427
+ADDRLP4 160
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+LABELV $4427
+ADDRLP4 392
+ADDRLP4 56+8
+INDIRF4
+ASGNF4
+ADDRGP4 $4425
+JUMPV
+LABELV $4424
+ADDRLP4 392
+CNSTF4 0
+ASGNF4
+LABELV $4425
+ADDRLP4 484
+CNSTF4 0
+ASGNF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 484
+INDIRF4
+NEF4 $4431
+ADDRLP4 388
+INDIRF4
+ADDRLP4 484
+INDIRF4
+NEF4 $4431
+LABELV $4431
+ADDRLP4 488
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ADDRLP4 492
+INDIRF4
+GEF4 $4435
+ADDRLP4 392
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ADDRLP4 492
+INDIRF4
+LTF4 $4433
+LABELV $4435
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+LTF4 $4436
+ADDRLP4 148
+ADDRLP4 232
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4437
+JUMPV
+LABELV $4436
+ADDRLP4 160
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+LABELV $4437
+LABELV $4433
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $4438
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $4440
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 5
+ASGNI4
+LABELV $4440
+LABELV $4438
+LABELV $4373
+LABELV $4369
+ADDRGP4 $202
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4442
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $4361
+endproc BotObstacleAvoidanceMoveExt 504 28
+lit
+align 4
+LABELV $4444
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc BotObstacleAvoidanceMove 76 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 $4444
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1036831949
+GEF4 $4447
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36+4
+CNSTF4 1135869952
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+LABELV $4447
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1112014848
+GTF4 $4458
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $4452
+LABELV $4458
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $4452
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $4463
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+LABELV $4463
+LABELV $4443
+endproc BotObstacleAvoidanceMove 76 16
+proc BotObstacleAvoidanceMoveFast 36 16
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1036831949
+GEF4 $4468
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+CNSTF4 1135869952
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+LABELV $4468
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $4465
+endproc BotObstacleAvoidanceMoveFast 36 16
+export BotAIBlocked
+proc BotAIBlocked 568 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRGP4 bot_blocktime+8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4474
+ADDRFP4 0
+INDIRP4
+CNSTI4 6672
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $202
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4442
+ARGP4
+ADDRLP4 516
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRGP4 $4472
+JUMPV
+LABELV $4474
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $4476
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4477
+JUMPV
+LABELV $4476
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $4478
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4479
+JUMPV
+LABELV $4478
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $4480
+ADDRLP4 152
+CNSTI4 3
+ASGNI4
+ADDRGP4 $4481
+JUMPV
+LABELV $4480
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $4482
+ADDRLP4 152
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4483
+JUMPV
+LABELV $4482
+ADDRLP4 152
+CNSTI4 6
+ASGNI4
+LABELV $4483
+LABELV $4481
+LABELV $4479
+LABELV $4477
+ADDRGP4 $202
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4442
+ARGP4
+ADDRLP4 516
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $4484
+ADDRLP4 148
+CNSTI4 400
+ASGNI4
+ADDRGP4 $4485
+JUMPV
+LABELV $4484
+ADDRLP4 148
+CNSTI4 200
+ASGNI4
+LABELV $4485
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $4486
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4487
+JUMPV
+LABELV $4486
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $4488
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRGP4 $4489
+JUMPV
+LABELV $4488
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+LABELV $4489
+LABELV $4487
+ADDRLP4 524
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 524
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 524
+INDIRI4
+NEI4 $4490
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $4472
+JUMPV
+LABELV $4490
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $4492
+ADDRGP4 $4472
+JUMPV
+LABELV $4492
+ADDRLP4 0
+ADDRLP4 12+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 864
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4502
+ADDRLP4 532
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 64
+LTI4 $4504
+ADDRLP4 532
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $4508
+ADDRLP4 532
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $4504
+LABELV $4508
+CNSTI4 2
+ARGI4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 540
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 540
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 540
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_TraceEntities
+CALLV
+pop
+ADDRLP4 208+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4513
+ADDRGP4 $4472
+JUMPV
+LABELV $4513
+LABELV $4504
+ADDRLP4 12+92
+INDIRI4
+CNSTI4 0
+LEI4 $4503
+ADDRLP4 12+92
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $4503
+ADDRLP4 140
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $4222
+ARGP4
+ADDRLP4 536
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 540
+CNSTI4 0
+ASGNI4
+ADDRLP4 536
+INDIRI4
+ADDRLP4 540
+INDIRI4
+NEI4 $4520
+ADDRLP4 140
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ADDRLP4 540
+INDIRI4
+NEI4 $4520
+ADDRLP4 140
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4522
+ADDRLP4 140
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4522
+ADDRGP4 $4472
+JUMPV
+LABELV $4522
+LABELV $4520
+ADDRLP4 140
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $4265
+ARGP4
+ADDRLP4 544
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 548
+CNSTI4 0
+ASGNI4
+ADDRLP4 544
+INDIRI4
+ADDRLP4 548
+INDIRI4
+NEI4 $4524
+ADDRLP4 140
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ADDRLP4 548
+INDIRI4
+NEI4 $4524
+ADDRGP4 $4472
+JUMPV
+LABELV $4524
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+EQI4 $4528
+ADDRLP4 556
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4530
+ADDRLP4 556
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4530
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $4530
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264+4+40
+INDIRI4
+ARGI4
+ADDRLP4 560
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+NEI4 $4532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $4532
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $4503
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 564
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+EQI4 $4503
+ADDRGP4 $4472
+JUMPV
+LABELV $4528
+ADDRLP4 264
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 BotObstacleAvoidanceMoveFast
+CALLV
+pop
+ADDRGP4 $4472
+JUMPV
+LABELV $4502
+ADDRFP4 0
+INDIRP4
+CNSTI4 7112
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $4538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+EQI4 $4538
+ADDRLP4 0
+ARGP4
+ADDRLP4 540
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 544
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 540
+INDIRF4
+CNSTF4 1067450368
+ADDRLP4 544
+INDIRF4
+ADDRLP4 544
+INDIRF4
+MULF4
+MULF4
+LEF4 $4538
+ADDRGP4 $4472
+JUMPV
+LABELV $4538
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 156
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GTF4 $4546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $4540
+LABELV $4546
+CNSTI4 2
+ARGI4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 556
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_TraceEntities
+CALLV
+pop
+ADDRLP4 208+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $4551
+ADDRGP4 $4472
+JUMPV
+LABELV $4551
+LABELV $4540
+LABELV $4503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 BotObstacleAvoidanceMove
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4554
+ADDRFP4 0
+INDIRP4
+CNSTI4 6672
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+GEF4 $4556
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $4558
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $4559
+JUMPV
+LABELV $4558
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $4560
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $4560
+LABELV $4559
+LABELV $4556
+LABELV $4554
+LABELV $4472
+endproc BotAIBlocked 568 28
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 332 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $4563
+CNSTI4 0
+RETI4
+ADDRGP4 $4562
+JUMPV
+LABELV $4563
+ADDRFP4 0
+INDIRP4
+CNSTI4 6696
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $4566
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+LEF4 $4566
+CNSTI4 0
+RETI4
+ADDRGP4 $4562
+JUMPV
+LABELV $4566
+ADDRFP4 0
+INDIRP4
+CNSTI4 6696
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 304
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 304
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 304
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+CNSTI4 262144
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $4568
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $4569
+ADDRLP4 308
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 308
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 308
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $4569
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 312
+CNSTP4 0
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $4569
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $4569
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4581
+ADDRLP4 324
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4581
+ADDRFP4 0
+INDIRP4
+CNSTI4 7676
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $4581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $4583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $4562
+JUMPV
+LABELV $4583
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $4569
+JUMPV
+LABELV $4568
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $4587
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $4590
+LABELV $4590
+LABELV $4587
+LABELV $4569
+CNSTI4 0
+RETI4
+LABELV $4562
+endproc BotAIPredictObstacles 332 44
+proc BotCheckConsoleMessages 1004 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $4595
+JUMPV
+LABELV $4594
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 trap_BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 10
+GEI4 $4597
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $4599
+ADDRLP4 952
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 952
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $4599
+ADDRGP4 $4596
+JUMPV
+LABELV $4599
+LABELV $4597
+ADDRLP4 276
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $4604
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 952
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $4607
+ADDRLP4 276
+ADDRLP4 288+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $4607
+LABELV $4604
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 trap_BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $4613
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $4616
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $4616
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 960
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $4620
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4595
+JUMPV
+LABELV $4620
+ADDRLP4 288+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $4623
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4595
+JUMPV
+LABELV $4623
+ADDRLP4 288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 872
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 616
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 872
+ARGP4
+ADDRLP4 964
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 964
+INDIRI4
+NEI4 $4626
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4595
+JUMPV
+LABELV $4626
+ADDRLP4 616
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $4628
+ADDRGP4 $4631
+ARGP4
+ADDRGP4 $4632
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 968
+CNSTP4 0
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $4633
+CNSTI4 1
+ARGI4
+ADDRGP4 $4635
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4629
+JUMPV
+LABELV $4633
+CNSTI4 1
+ARGI4
+ADDRGP4 $4636
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4629
+JUMPV
+LABELV $4628
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $4637
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $4637
+ADDRLP4 976
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $4637
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 63
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 944
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 988
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $4639
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 944
+INDIRF4
+GEF4 $4639
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 996
+CNSTP4 0
+ASGNP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 0
+EQI4 $4641
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $4596
+JUMPV
+LABELV $4641
+LABELV $4639
+LABELV $4637
+LABELV $4629
+LABELV $4616
+LABELV $4613
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $4595
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+NEI4 $4594
+LABELV $4596
+LABELV $4593
+endproc BotCheckConsoleMessages 1004 48
+lit
+align 4
+LABELV $4644
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotCheckBlockedTeammates
+code
+proc BotCheckBlockedTeammates 500 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRGP4 $4644
+INDIRB
+ASGNB 12
+ADDRGP4 bot_teamblock+12
+INDIRI4
+CNSTI4 0
+NEI4 $4645
+ADDRGP4 $4643
+JUMPV
+LABELV $4645
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $4648
+ADDRGP4 $4643
+JUMPV
+LABELV $4648
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 396
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $4650
+ADDRGP4 $4643
+JUMPV
+LABELV $4650
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 400
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $4652
+ADDRGP4 $4643
+JUMPV
+LABELV $4652
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 404
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+EQI4 $4654
+ADDRGP4 $4643
+JUMPV
+LABELV $4654
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 408
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4659
+JUMPV
+LABELV $4656
+ADDRLP4 152
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4661
+ADDRGP4 $4657
+JUMPV
+LABELV $4661
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $4663
+ADDRGP4 $4657
+JUMPV
+LABELV $4663
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $4665
+ADDRGP4 $4657
+JUMPV
+LABELV $4665
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4668
+ADDRGP4 $4657
+JUMPV
+LABELV $4668
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+EQI4 $4670
+ADDRGP4 $4657
+JUMPV
+LABELV $4670
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+CNSTI4 0
+NEI4 $4672
+ADDRGP4 $4657
+JUMPV
+LABELV $4672
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 0+16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 0+16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 428
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 256
+ADDRLP4 428
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 240
+CNSTI4 864
+ADDRLP4 152
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 432
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 432
+INDIRF4
+CNSTF4 1193033728
+GEF4 $4681
+ADDRLP4 0
+ARGP4
+ADDRLP4 436
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+NEI4 $4681
+ADDRLP4 0
+ARGP4
+ADDRLP4 440
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 444
+CNSTI4 0
+ASGNI4
+ADDRLP4 440
+INDIRI4
+ADDRLP4 444
+INDIRI4
+NEI4 $4681
+ADDRLP4 0+80
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 444
+INDIRI4
+NEI4 $4681
+ADDRLP4 256
+INDIRI4
+CNSTI4 16384
+LEI4 $4684
+ADDRGP4 $4657
+JUMPV
+LABELV $4684
+ADDRLP4 240
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $4689
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTF4 1114636288
+ARGF4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 BotEntityVisible
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+EQI4 $4686
+ADDRLP4 0+44
+ARGP4
+CNSTI4 60
+ARGI4
+ADDRLP4 288
+ARGP4
+ADDRLP4 452
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+EQI4 $4686
+LABELV $4689
+ADDRLP4 156
+CNSTI4 42
+ASGNI4
+ADDRGP4 $4687
+JUMPV
+LABELV $4686
+ADDRLP4 156
+CNSTI4 8
+ASGNI4
+LABELV $4687
+ADDRLP4 284
+CNSTI4 200
+ASGNI4
+ADDRGP4 $4682
+JUMPV
+LABELV $4681
+ADDRLP4 256
+INDIRI4
+CNSTI4 65536
+LEI4 $4690
+ADDRGP4 $4657
+JUMPV
+LABELV $4690
+ADDRLP4 156
+CNSTF4 1132462080
+CNSTF4 1124073472
+ADDRLP4 304
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 284
+CNSTI4 400
+ASGNI4
+LABELV $4682
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+INDIRF4
+LTF4 $4692
+ADDRFP4 0
+INDIRP4
+CNSTI4 7668
+ADDP4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $4692
+ADDRLP4 128+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0+16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 0+16+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 0+16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 456
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 456
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5368
+ADDP4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 456
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 5372
+ADDP4
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 104923137
+ARGI4
+ADDRGP4 BotAI_TraceEntities
+CALLV
+pop
+ADDRLP4 184+52
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $4706
+ADDRLP4 184+4
+INDIRI4
+CNSTI4 0
+NEI4 $4711
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $4706
+LABELV $4711
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7060
+ADDP4
+ARGP4
+ADDRGP4 VectorToAngles
+CALLV
+pop
+ADDRLP4 308
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 244+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 240
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 244
+ADDRLP4 240
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 244
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 244+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 3259498496
+LEF4 $4713
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $4713
+ADDRLP4 464
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 464
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 128+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $4729
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $4735
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+CNSTI4 0
+NEI4 $4737
+ADDRLP4 484
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 484
+INDIRF4
+ADDRLP4 484
+INDIRF4
+MULF4
+ADDRLP4 488
+INDIRF4
+ADDRLP4 488
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 492
+INDIRF4
+ADDRLP4 492
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+GEF4 $4739
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 496
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 332+4
+CNSTF4 1135869952
+ADDRLP4 496
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 332+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 332
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 AngleVectorsForward
+CALLV
+pop
+ADDRGP4 $4740
+JUMPV
+LABELV $4739
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $4740
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 496
+INDIRI4
+CNSTI4 0
+NEI4 $4743
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6684
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $4744
+JUMPV
+LABELV $4743
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+ADDRLP4 320
+INDIRB
+ASGNB 12
+LABELV $4744
+LABELV $4737
+LABELV $4735
+LABELV $4729
+LABELV $4706
+LABELV $4657
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4659
+ADDRLP4 152
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $4656
+LABELV $4643
+endproc BotCheckBlockedTeammates 500 28
+proc BotCheckForGrenades 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4748
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $4746
+LABELV $4748
+ADDRGP4 $4745
+JUMPV
+LABELV $4746
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $4745
+endproc BotCheckForGrenades 4 16
+proc BotCheckForProxMines 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $4752
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $4750
+LABELV $4752
+ADDRGP4 $4749
+JUMPV
+LABELV $4750
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LEI4 $4753
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $4753
+ADDRGP4 $4749
+JUMPV
+LABELV $4753
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5464
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $4757
+ADDRFP4 0
+INDIRP4
+CNSTI4 5512
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $4755
+LABELV $4757
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5452
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $4758
+ADDRFP4 0
+INDIRP4
+CNSTI4 5500
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $4755
+LABELV $4758
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5468
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $4759
+ADDRFP4 0
+INDIRP4
+CNSTI4 5516
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $4755
+LABELV $4759
+ADDRGP4 $4749
+JUMPV
+LABELV $4755
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $4760
+ADDRGP4 $4749
+JUMPV
+LABELV $4760
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4749
+endproc BotCheckForProxMines 40 16
+proc BotCheckForKamikazeBody 0 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $4763
+ADDRGP4 $4762
+JUMPV
+LABELV $4763
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $4765
+ADDRGP4 $4762
+JUMPV
+LABELV $4765
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $4762
+endproc BotCheckForKamikazeBody 0 0
+proc BotCheckEvents 312 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 864
+ADDRLP4 260
+INDIRI4
+MULI4
+ADDRGP4 g_entities+384
+ADDP4
+INDIRI4
+NEI4 $4768
+ADDRGP4 $4767
+JUMPV
+LABELV $4768
+ADDRLP4 264
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ADDP4
+CNSTI4 864
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 g_entities+384
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $4772
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 15
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $4773
+JUMPV
+LABELV $4772
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $4773
+ADDRLP4 268
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 15
+LTI4 $4877
+ADDRLP4 268
+INDIRI4
+CNSTI4 36
+GTI4 $4878
+ADDRLP4 268
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4879-60
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4879
+address $4776
+address $4788
+address $4800
+address $4774
+address $4774
+address $4774
+address $4774
+address $4838
+address $4774
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4876
+address $4774
+address $4775
+address $4775
+code
+LABELV $4877
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $4775
+ADDRGP4 $4774
+JUMPV
+LABELV $4878
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 83
+LTI4 $4774
+ADDRLP4 272
+INDIRI4
+CNSTI4 120
+GTI4 $4774
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4881-332
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4881
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4774
+address $4774
+address $4774
+address $4774
+address $4774
+address $4774
+address $4775
+address $4775
+address $4775
+address $4775
+address $4774
+address $4774
+address $4775
+address $4775
+address $4774
+address $4774
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+address $4775
+code
+LABELV $4776
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4775
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4781
+ADDRLP4 276
+INDIRI4
+CNSTI4 256
+LTI4 $4779
+LABELV $4781
+CNSTI4 3
+ARGI4
+ADDRGP4 $4782
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4775
+JUMPV
+LABELV $4779
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $4785
+ARGP4
+ADDRLP4 280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $4775
+ADDRFP4 0
+INDIRP4
+CNSTI4 5524
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $4775
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $4775
+JUMPV
+LABELV $4788
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4791
+ADDRLP4 276
+INDIRI4
+CNSTI4 256
+LTI4 $4789
+LABELV $4791
+CNSTI4 3
+ARGI4
+ADDRGP4 $4792
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $4775
+JUMPV
+LABELV $4789
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $4795
+ARGP4
+ADDRLP4 280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $4793
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4796
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRGP4 $4775
+JUMPV
+LABELV $4793
+ADDRLP4 4
+ARGP4
+ADDRGP4 $4799
+ARGP4
+ADDRLP4 284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $4775
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $4775
+JUMPV
+LABELV $4800
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $4801
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4775
+ADDRLP4 276
+INDIRI4
+CNSTI4 5
+GTI4 $4775
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4812
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4812
+address $4806
+address $4807
+address $4808
+address $4809
+address $4810
+address $4811
+code
+LABELV $4806
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4807
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4808
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4809
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4810
+ADDRFP4 0
+INDIRP4
+CNSTI4 7476
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4811
+ADDRFP4 0
+INDIRP4
+CNSTI4 7472
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4801
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $4813
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $4775
+ADDRLP4 276
+INDIRI4
+CNSTI4 5
+GTI4 $4775
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4830
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4830
+address $4818
+address $4819
+address $4820
+address $4821
+address $4822
+address $4826
+code
+LABELV $4818
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4819
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4820
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4821
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4822
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $4824
+ADDRLP4 284
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4825
+JUMPV
+LABELV $4824
+ADDRLP4 284
+CNSTI4 1
+ASGNI4
+LABELV $4825
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4826
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $4828
+ADDRLP4 296
+CNSTI4 2
+ASGNI4
+ADDRGP4 $4829
+JUMPV
+LABELV $4828
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+LABELV $4829
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4813
+ADDRLP4 276
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 6
+EQI4 $4833
+ADDRLP4 276
+INDIRI4
+CNSTI4 7
+NEI4 $4775
+LABELV $4833
+ADDRLP4 280
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $4837
+ADDRLP4 280
+INDIRI4
+CNSTI4 1
+EQI4 $4837
+ADDRGP4 $4775
+JUMPV
+LABELV $4837
+ADDRFP4 0
+INDIRP4
+CNSTI4 7464
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $4775
+JUMPV
+LABELV $4838
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+104
+INDIRI4
+CNSTI4 3
+GEI4 $4839
+ADDRLP4 288
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4840
+JUMPV
+LABELV $4839
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 300
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 300
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 292
+INDIRF4
+GEF4 $4843
+ADDRLP4 304
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4844
+JUMPV
+LABELV $4843
+ADDRLP4 304
+CNSTI4 0
+ASGNI4
+LABELV $4844
+ADDRLP4 288
+ADDRLP4 304
+INDIRI4
+ASGNI4
+LABELV $4840
+ADDRLP4 276
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4845
+ADDRFP4 0
+INDIRP4
+CNSTI4 6456
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6452
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 280
+INDIRI4
+EQI4 $4850
+ADDRLP4 300
+INDIRI4
+CNSTI4 1023
+EQI4 $4850
+ADDRLP4 300
+INDIRI4
+CNSTI4 1022
+NEI4 $4847
+LABELV $4850
+ADDRFP4 0
+INDIRP4
+CNSTI4 6464
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4848
+JUMPV
+LABELV $4847
+ADDRFP4 0
+INDIRP4
+CNSTI4 6464
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4848
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6484
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6464
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4846
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $4853
+ADDRLP4 280
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+EQI4 $4855
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4855
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4846
+JUMPV
+LABELV $4853
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4846
+JUMPV
+LABELV $4845
+ADDRLP4 280
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $4857
+ADDRFP4 0
+INDIRP4
+CNSTI4 6460
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6448
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6488
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+INDIRI4
+NEI4 $4858
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $4861
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $4862
+JUMPV
+LABELV $4861
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4862
+ADDRFP4 0
+INDIRP4
+CNSTI4 6496
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $4858
+ADDRFP4 0
+INDIRP4
+CNSTI4 6492
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4858
+JUMPV
+LABELV $4857
+ADDRLP4 300
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7024
+ADDP4
+INDIRI4
+NEI4 $4865
+ADDRLP4 276
+INDIRI4
+ADDRLP4 300
+INDIRI4
+NEI4 $4865
+ADDRFP4 0
+INDIRP4
+CNSTI4 6468
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4865
+LABELV $4858
+LABELV $4846
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $4775
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+112
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $4775
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $4775
+ADDRFP4 0
+INDIRP4
+CNSTI4 7480
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7484
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4775
+JUMPV
+LABELV $4876
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $4774
+LABELV $4775
+LABELV $4767
+endproc BotCheckEvents 312 16
+proc BotCheckSnapshot 244 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7000
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4885
+JUMPV
+LABELV $4884
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForProxMines
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForKamikazeBody
+CALLV
+pop
+LABELV $4885
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 -1
+NEI4 $4884
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+188
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+192
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $4883
+endproc BotCheckSnapshot 244 16
+export BotCheckTeamScores
+proc BotCheckTeamScores 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4893
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $4897
+ADDRGP4 $4889
+JUMPV
+LABELV $4893
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 level+68+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRGP4 $4891
+JUMPV
+LABELV $4897
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+ADDRGP4 level+68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ADDRGP4 level+68+4
+INDIRI4
+ASGNI4
+LABELV $4891
+LABELV $4889
+endproc BotCheckTeamScores 8 0
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5536
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $4902
+ADDRFP4 0
+INDIRP4
+CNSTI4 5392
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $4904
+ADDRGP4 $4901
+JUMPV
+LABELV $4904
+LABELV $4902
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $4901
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4907
+ADDRFP4 0
+INDIRP4
+CNSTI4 7248
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $4909
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $4906
+JUMPV
+LABELV $4909
+ADDRFP4 0
+INDIRP4
+CNSTI4 5404
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5364
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7204
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $4911
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $4911
+ADDRFP4 0
+INDIRP4
+CNSTI4 7248
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $4911
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7192
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7192
+ADDP4
+RETP4
+ADDRGP4 $4906
+JUMPV
+LABELV $4907
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $4906
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4914
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $4915
+JUMPV
+LABELV $4914
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $4915
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4916
+CNSTI4 0
+RETI4
+ADDRGP4 $4913
+JUMPV
+LABELV $4916
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $4918
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $4918
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7192
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7248
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $4913
+endproc BotGetAlternateRouteGoal 28 0
+proc BotSetupAlternativeRouteGoals 12 32
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $4921
+ADDRGP4 $4920
+JUMPV
+LABELV $4921
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $4923
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4927
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4925
+CNSTI4 2
+ARGI4
+ADDRGP4 $4928
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4925
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $4924
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4924
+JUMPV
+LABELV $4923
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $4936
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4940
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4938
+CNSTI4 2
+ARGI4
+ADDRGP4 $4941
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4938
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4937
+JUMPV
+LABELV $4936
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $4946
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4940
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4948
+CNSTI4 2
+ARGI4
+ADDRGP4 $4950
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4948
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4947
+JUMPV
+LABELV $4946
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $4955
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4940
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $4957
+CNSTI4 2
+ARGI4
+ADDRGP4 $4959
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4957
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 75751934
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $4955
+LABELV $4947
+LABELV $4937
+LABELV $4924
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $4920
+endproc BotSetupAlternativeRouteGoals 12 32
+export BotDeathmatchAI
+proc BotDeathmatchAI 1340 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $4965
+ADDRLP4 1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $4967
+ADDRGP4 $4964
+JUMPV
+LABELV $4967
+ADDRFP4 0
+INDIRP4
+CNSTI4 7004
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $4969
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $4970
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $4971
+JUMPV
+LABELV $4970
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $4972
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $4973
+JUMPV
+LABELV $4972
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $4973
+LABELV $4971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $4965
+ADDRLP4 1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6436
+ADDP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ADDRLP4 1316
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1320
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $4974
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $4974
+ADDRFP4 0
+INDIRP4
+CNSTI4 6432
+ADDP4
+CNSTI4 75751934
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $4974
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4978
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $4976
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 5324
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+EQI4 $4983
+ADDRGP4 $4981
+JUMPV
+LABELV $4983
+LABELV $4980
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $4979
+LABELV $4981
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $4985
+ADDRGP4 $4964
+JUMPV
+LABELV $4985
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $4987
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $4989
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $4987
+ADDRFP4 0
+INDIRP4
+CNSTI4 6500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6504
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4990
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $4990
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnterGame
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6480
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $4990
+LABELV $4964
+endproc BotDeathmatchAI 1340 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4996
+JUMPV
+LABELV $4993
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $4998
+ADDRGP4 $4994
+JUMPV
+LABELV $4998
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $5000
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $5000
+ADDRGP4 $4994
+JUMPV
+LABELV $5000
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $5002
+ADDRGP4 $4994
+JUMPV
+LABELV $5002
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $5006
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $4992
+JUMPV
+LABELV $5006
+LABELV $4994
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+ASGNP4
+LABELV $4996
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $4993
+LABELV $4992
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5012
+JUMPV
+LABELV $5009
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $5014
+ADDRGP4 $5010
+JUMPV
+LABELV $5014
+ADDRLP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $5016
+ADDRGP4 $5010
+JUMPV
+LABELV $5016
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $5020
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $5008
+JUMPV
+LABELV $5020
+LABELV $5010
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+ASGNP4
+LABELV $5012
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $5009
+LABELV $5008
+endproc BotSetEntityNumForGoal 36 8
+proc BotSetEntityNumForGoalWithActivator 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5026
+JUMPV
+LABELV $5023
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $5030
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $5028
+LABELV $5030
+ADDRGP4 $5024
+JUMPV
+LABELV $5028
+ADDRLP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $5031
+ADDRGP4 $5024
+JUMPV
+LABELV $5031
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1120403456
+GEF4 $5035
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $5022
+JUMPV
+LABELV $5035
+LABELV $5024
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 864
+ADDP4
+ASGNP4
+LABELV $5026
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $5023
+LABELV $5022
+endproc BotSetEntityNumForGoalWithActivator 40 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $5041
+JUMPV
+LABELV $5038
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4216
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $5042
+ADDRGP4 $5039
+JUMPV
+LABELV $5042
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $5044
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $4232
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $5046
+CNSTI4 0
+RETI4
+ADDRGP4 $5037
+JUMPV
+LABELV $5046
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $5050
+CNSTI4 0
+RETI4
+ADDRGP4 $5037
+JUMPV
+LABELV $5050
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $5037
+JUMPV
+LABELV $5044
+LABELV $5039
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $5041
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5038
+CNSTI4 0
+RETI4
+LABELV $5037
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 156 16
+ADDRGP4 $5053
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $5054
+ARGP4
+ADDRGP4 $5055
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $5056
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5060
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5058
+CNSTI4 2
+ARGI4
+ADDRGP4 $5061
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5058
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5064
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5057
+CNSTI4 2
+ARGI4
+ADDRGP4 $5065
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $5057
+JUMPV
+LABELV $5056
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $5066
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4927
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5068
+CNSTI4 2
+ARGI4
+ADDRGP4 $5070
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5068
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5060
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5071
+CNSTI4 2
+ARGI4
+ADDRGP4 $5073
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5071
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5064
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $5067
+CNSTI4 2
+ARGI4
+ADDRGP4 $5076
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $5067
+JUMPV
+LABELV $5066
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $5077
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5081
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5079
+CNSTI4 2
+ARGI4
+ADDRGP4 $5082
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5079
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $5083
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5086
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5084
+CNSTI4 2
+ARGI4
+ADDRGP4 $5087
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5084
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $5088
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+ADDRGP4 $5078
+JUMPV
+LABELV $5077
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $5089
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5081
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $5091
+CNSTI4 2
+ARGI4
+ADDRGP4 $5093
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5091
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $5083
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $5086
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $5094
+CNSTI4 2
+ARGI4
+ADDRGP4 $5096
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5094
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $5088
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $4940
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $5097
+CNSTI4 2
+ARGI4
+ADDRGP4 $4959
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $5097
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 $5099
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+LABELV $5089
+LABELV $5078
+LABELV $5067
+LABELV $5057
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $5103
+JUMPV
+LABELV $5100
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $5104
+ADDRGP4 $5101
+JUMPV
+LABELV $5104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $5106
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $5109
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $5109
+LABELV $5106
+LABELV $5101
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $5103
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5100
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $5052
+endproc BotSetupDeathmatchAI 156 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $5111
+endproc BotShutdownDeathmatchAI 0 0
+bss
+align 4
+LABELV botVisibility
+skip 229376
+export botCheckedAreas
+align 1
+LABELV botCheckedAreas
+skip 65536
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamFormationDist
+import BotSetTeamCampDist
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotDetermineVisibleTeammates
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Wait
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Wait
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export neutralobelisk
+align 4
+LABELV neutralobelisk
+skip 56
+export blueobelisk
+align 4
+LABELV blueobelisk
+skip 56
+export redobelisk
+align 4
+LABELV redobelisk
+skip 56
+export ctf_neutralflag
+align 4
+LABELV ctf_neutralflag
+skip 56
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+import maxclients
+import mapname
+export gametype
+align 4
+LABELV gametype
+skip 4
+import bot_alt_attack
+import bot_alt_aim
+import bot_alt_pickup
+import bot_alt_aggressive
+import bot_teamavoidpickup
+import bot_teamblock
+import bot_teamredstrategy
+import bot_teambluestrategy
+import bot_shownodechanges
+import bot_noaccerror
+import bot_nowalk
+import bot_noshoot
+import bot_equalizer_teambon
+import bot_equalizer_fembon
+import bot_equalizer_react
+import bot_equalizer_aim
+import bot_equalize
+import bot_predictobstacles
+import bot_blocktime
+import bot_checktime
+import bot_visualrange
+import bot_memorydump
+import bot_interbreedwrite
+import bot_interbreedcycle
+import bot_interbreedbots
+import bot_interbreedchar
+import bot_challenge
+import bot_rocketjump
+import bot_report
+import bot_pause
+import bot_nochat
+import bot_fastchat
+import bot_testclusters
+import bot_testsolid
+import bot_testrchat
+import bot_testichat
+import bot_reloadcharacters
+import bot_thinktime
+import bot_saveroutingcache
+import bot_aasoptimize
+import bot_forcewrite
+import bot_forcereachability
+import bot_forceclustering
+import bot_visualizejumppads
+import bot_reachability
+import bot_groundonly
+import bot_maxdebugpolys
+import bot_debug
+import bot_developer
+import bot_enable
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_TraceEntities
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceAtTime
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_ResetScoreboardBaseline
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import Svcmd_PmoveBench_f
+import Svcmd_PmoveRecord_f
+import G_PmoveRecordEnd
+import G_PmoveRecordBegin
+import G_StopPmoveRecord
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_EventForString
+import G_Script_ScriptEventNum
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateClientRank
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import G_UpdateEntityActivity
+import G_NextRunnableEntity
+import G_RemoveThinks
+import G_ActivateEntity
+import G_SetNextThink
+import G_AdvanceThinks
+import G_InitThinks
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_InitFreeEntities
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_SetScriptName
+import G_SetTargetname
+import G_SetClassname
+import G_UpdateEntityNames
+import G_InitEntityNames
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import G_InitConfigstringCaches
+import G_HashName
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $5099
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5096
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5093
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5088
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5087
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5086
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5083
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5082
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $5081
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $5076
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5073
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5070
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5065
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5064
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $5061
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $5060
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $5055
+byte 1 50
+byte 1 0
+align 1
+LABELV $5054
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5053
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4989
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4978
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $4969
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $4959
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $4950
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $4941
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $4940
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $4928
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $4927
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $4799
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $4796
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $4795
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $4792
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4785
+byte 1 42
+byte 1 102
+byte 1 118
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $4782
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4636
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $4635
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $4632
+byte 1 49
+byte 1 0
+align 1
+LABELV $4631
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $4442
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $4346
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4345
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4341
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $4337
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $4325
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $4324
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $4321
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $4310
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4297
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4291
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $4283
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $4272
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4268
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4265
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $4232
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4227
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $4222
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $4219
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $4216
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4215
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4203
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4019
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $3996
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3993
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $3895
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $3894
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $3893
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2706
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2701
+byte 1 109
+byte 1 121
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $2697
+byte 1 114
+byte 1 97
+byte 1 122
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1815
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1814
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1813
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1110
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $857
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $843
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $710
+byte 1 93
+byte 1 0
+align 1
+LABELV $709
+byte 1 91
+byte 1 0
+align 1
+LABELV $708
+byte 1 32
+byte 1 0
+align 1
+LABELV $666
+byte 1 110
+byte 1 0
+align 1
+LABELV $665
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $660
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $659
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $658
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $275
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $250
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $227
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $202
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $201
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $83
+byte 1 116
+byte 1 0
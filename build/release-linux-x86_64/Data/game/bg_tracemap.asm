@@ -0,0 +1,5361 @@
+code
+proc BG_TraceTracemapPoint 164 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 56+8
+ADDRLP4 84+12+8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 128
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $79
+ADDRFP4 12
+INDIRP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRLP4 68+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $82
+ADDRLP4 68+8
+CNSTF4 3347054336
+ASGNF4
+LABELV $82
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $86
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $90
+ADDRFP4 12
+INDIRP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $78
+JUMPV
+LABELV $90
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0+44
+INDIRI4
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $87
+LABELV $77
+ADDRGP4 $76
+JUMPV
+LABELV $78
+ADDRLP4 56+8
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 3347054592
+NEF4 $102
+ADDRFP4 20
+INDIRP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $99
+JUMPV
+LABELV $101
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $104
+ADDRFP4 20
+INDIRP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRLP4 68+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $107
+ADDRLP4 68+8
+CNSTF4 1199570688
+ASGNF4
+LABELV $107
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRLP4 156
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+44
+INDIRI4
+ADDRLP4 156
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $114
+ADDRLP4 0+12
+ARGP4
+CNSTI4 1023
+ARGI4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+NEI4 $114
+ADDRFP4 20
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $114
+ADDRLP4 56+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $123
+ADDRFP4 20
+INDIRP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $123
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $126
+ADDRFP4 20
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $126
+ADDRLP4 56+8
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $112
+LABELV $102
+ADDRGP4 $101
+JUMPV
+LABELV $103
+LABELV $99
+ADDRFP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $134
+ADDRFP4 12
+INDIRP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $134
+ADDRLP4 84+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $136
+ADDRFP4 24
+INDIRP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRFP4 24
+INDIRP4
+ADDRLP4 84+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRFP4 24
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $135
+ADDRLP4 80
+INDIRI4
+RETI4
+LABELV $68
+endproc BG_TraceTracemapPoint 164 28
+data
+align 4
+LABELV $142
+byte 4 0
+align 4
+LABELV $143
+byte 4 0
+export BG_GenerateTracemap
+code
+proc BG_GenerateTracemap 1232 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 124
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 124
+ARGP4
+ADDRLP4 1148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $145
+ADDRGP4 $147
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $141
+JUMPV
+LABELV $145
+ADDRLP4 1160
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1160
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+EQF4 $148
+ADDRGP4 $150
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $141
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $151
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 tracemap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 786460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1164
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 52
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRLP4 1168
+CNSTI4 65536
+ASGNI4
+ADDRLP4 20
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRLP4 1180
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 1180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1184
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1184
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1184
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 1180
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $152
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $156
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 1192
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 1200
+ADDRLP4 1192
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1204
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+ADDRLP4 1204
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 1200
+INDIRI4
+ADDRLP4 1204
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1200
+INDIRI4
+ADDRLP4 1204
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 BG_TraceTracemapPoint
+CALLI4
+ASGNI4
+ADDRLP4 1212
+ADDRGP4 $143
+ASGNP4
+ADDRLP4 1212
+INDIRP4
+ADDRLP4 1212
+INDIRP4
+INDIRI4
+ADDRLP4 1208
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $163
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+LEF4 $165
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $165
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+GEF4 $169
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $169
+LABELV $163
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $173
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+LEF4 $176
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $176
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+GEF4 $180
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $180
+LABELV $173
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $184
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+LEF4 $187
+ADDRLP4 56
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $187
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+GEF4 $191
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $191
+LABELV $184
+ADDRLP4 1216
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRLP4 1220
+ADDRGP4 $142
+INDIRI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $197
+ADDRLP4 1220
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $195
+LABELV $197
+ADDRGP4 $142
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $198
+ARGP4
+ADDRLP4 1228
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1228
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $143
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $195
+LABELV $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $156
+LABELV $153
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $152
+ADDRGP4 $198
+ARGP4
+ADDRLP4 1188
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1188
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $143
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 32
+CNSTF4 1132331008
+ADDRLP4 52
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $199
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+LABELV $199
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $205
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+LTF4 $209
+ADDRLP4 1192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $209
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $218
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $218
+LABELV $215
+LABELV $206
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $205
+LABELV $202
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $201
+ADDRLP4 32
+CNSTF4 1132331008
+ADDRLP4 56
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $222
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+LABELV $222
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $224
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $228
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+LTF4 $232
+ADDRLP4 1192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $237
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $241
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $241
+LABELV $238
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $228
+LABELV $225
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $224
+ADDRLP4 48
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $245
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRLP4 32
+CNSTF4 1132331008
+ADDRLP4 48
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $246
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $247
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $251
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $255
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 1192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1196
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ADDRLP4 1196
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 32
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $256
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $261
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $265
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $265
+LABELV $262
+LABELV $252
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $251
+LABELV $248
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $247
+ADDRLP4 60
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 1192
+INDIRP4
+ARGP4
+ADDRLP4 1196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1196
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 2
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 1
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 1
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 32
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $270
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $288
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $288
+address $282
+address $283
+address $284
+address $285
+address $286
+address $287
+code
+LABELV $282
+ADDRLP4 20
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $283
+ADDRLP4 52
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $284
+ADDRLP4 24
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $285
+ADDRLP4 56
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $286
+ADDRLP4 36
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $287
+ADDRLP4 48
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $278
+ADDRLP4 1204
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1208
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1204
+INDIRF4
+ADDRLP4 1208
+INDIRF4
+LTF4 $291
+ADDRLP4 1200
+ADDRLP4 1204
+INDIRF4
+ADDRLP4 1208
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRLP4 1200
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $292
+ADDRLP4 8
+ADDRLP4 1200
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $293
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 1216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1220
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+LTF4 $298
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $299
+ADDRLP4 8
+ADDRLP4 1212
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $300
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 1216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1220
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+LTF4 $305
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+ADDRLP4 1220
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 1212
+ADDRLP4 1216
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $306
+ADDRLP4 8
+ADDRLP4 1212
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $301
+LABELV $275
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $274
+LABELV $271
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $270
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $307
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_LoadTraceMapFile
+CALLI4
+pop
+LABELV $141
+endproc BG_GenerateTracemap 1232 28
+proc BG_TraceMapBSPChecksum 260 12
+ADDRGP4 $309
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CVIU4 4
+RETU4
+LABELV $308
+endproc BG_TraceMapBSPChecksum 260 12
+bss
+align 4
+LABELV $311
+skip 16384
+code
+proc BG_TraceMapTGAChecksum 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 2166136261
+BXORU4
+ASGNU4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+LEI4 $315
+ADDRLP4 8
+CNSTI4 16384
+ASGNI4
+LABELV $315
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 4
+DIVI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $311
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $317
+ADDRLP4 4
+CNSTU4 16777619
+ADDRLP4 4
+INDIRU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $311
+ADDP4
+INDIRI4
+CVIU4 4
+BXORU4
+MULU4
+ASGNU4
+LABELV $318
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $320
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 4
+DIVI4
+LTI4 $317
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $313
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $312
+ADDRLP4 4
+INDIRU4
+RETU4
+LABELV $310
+endproc BG_TraceMapTGAChecksum 12 12
+proc BG_ReadTraceMapCache 52 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $322
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $323
+CNSTI4 0
+RETI4
+ADDRGP4 $321
+JUMPV
+LABELV $323
+ADDRLP4 36
+INDIRI4
+CVIU4 4
+CNSTU4 786464
+EQU4 $325
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $321
+JUMPV
+LABELV $325
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+NEI4 $341
+ADDRLP4 0+4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $341
+ADDRLP4 0+8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $341
+ADDRLP4 0+12
+INDIRU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRU4
+NEU4 $341
+ADDRLP4 0+16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+NEI4 $341
+ADDRLP4 0+20
+INDIRU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU4
+EQU4 $330
+LABELV $341
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $321
+JUMPV
+LABELV $330
+ADDRGP4 tracemap+4
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRGP4 tracemap+262148
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRGP4 tracemap+524292
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0+28
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $321
+endproc BG_ReadTraceMapCache 52 12
+proc BG_WriteTraceMapCache 16 12
+ADDRGP4 $322
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $353
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $351
+LABELV $353
+ADDRGP4 $350
+JUMPV
+LABELV $351
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 tracemap+4
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 tracemap+262148
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 tracemap+524292
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $350
+endproc BG_WriteTraceMapCache 16 12
+proc BG_ReadTraceMapTGA 1124 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 1088
+CNSTI4 8
+ASGNI4
+ADDRLP4 1092
+CNSTI4 256
+ASGNI4
+ADDRLP4 1060+12
+INDIRU1
+CVUI4 1
+ADDRLP4 1060+13
+INDIRU1
+CVUI4 1
+ADDRLP4 1088
+INDIRI4
+LSHI4
+BORI4
+ADDRLP4 1092
+INDIRI4
+NEI4 $367
+ADDRLP4 1060+14
+INDIRU1
+CVUI4 1
+ADDRLP4 1060+15
+INDIRU1
+CVUI4 1
+ADDRLP4 1088
+INDIRI4
+LSHI4
+BORI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $361
+LABELV $367
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $368
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $372
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $376
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $376
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $404
+address $380
+address $384
+address $388
+address $392
+address $396
+address $400
+code
+LABELV $380
+ADDRLP4 1100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $384
+ADDRLP4 1104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $388
+ADDRLP4 1108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $392
+ADDRLP4 1112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1112
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $396
+ADDRLP4 1116
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $400
+ADDRLP4 1120
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $378
+LABELV $379
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $373
+JUMPV
+LABELV $376
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $409
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $409
+ADDRLP4 1100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $415
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $415
+ADDRLP4 1104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1104
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $421
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $421
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $425
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $425
+LABELV $373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $372
+LABELV $369
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $368
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $430
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $431
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $436
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $440
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $440
+LABELV $437
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $436
+LABELV $433
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $432
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $445
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $446
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $455
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $455
+LABELV $452
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $451
+LABELV $448
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $447
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $460
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $461
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $462
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $466
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $470
+ADDRLP4 1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $470
+LABELV $467
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $466
+LABELV $463
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $462
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $360
+endproc BG_ReadTraceMapTGA 1124 12
+proc BG_LoadTraceMapFile 148 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1346456916
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+8
+CNSTI4 256
+ASGNI4
+ADDRLP4 100
+ADDRGP4 BG_TraceMapBSPChecksum
+CALLU4
+ASGNU4
+ADDRLP4 0+12
+ADDRLP4 100
+INDIRU4
+ASGNU4
+ADDRLP4 32
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 112
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0+16
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 0
+GEI4 $480
+ADDRGP4 $269
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $483
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+RETI4
+ADDRGP4 $475
+JUMPV
+LABELV $480
+ADDRLP4 0+12
+INDIRU4
+CNSTU4 0
+NEU4 $484
+ADDRFP4 12
+CNSTI4 0
+ASGNI4
+LABELV $484
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 BG_TraceMapTGAChecksum
+CALLU4
+ASGNU4
+ADDRLP4 0+20
+ADDRLP4 116
+INDIRU4
+ASGNU4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $491
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ADDRGP4 BG_ReadTraceMapCache
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $489
+LABELV $491
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $269
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+GEI4 $492
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+RETI4
+ADDRGP4 $475
+JUMPV
+LABELV $492
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 132
+ADDRGP4 BG_ReadTraceMapTGA
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $494
+ADDRGP4 $269
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $498
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 140
+CNSTI4 256
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+RETI4
+ADDRGP4 $475
+JUMPV
+LABELV $494
+ADDRLP4 0+12
+INDIRU4
+CNSTU4 0
+EQU4 $499
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_WriteTraceMapCache
+CALLV
+pop
+LABELV $499
+LABELV $489
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 tracemap+786436
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786436+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 124
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 128
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor
+ADDRLP4 124
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRLP4 128
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor+4
+ADDRLP4 124
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRLP4 128
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 tracemap+786452
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+ADDRGP4 tracemap+786456
+ADDRLP4 0+28
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+RETI4
+LABELV $475
+endproc BG_LoadTraceMapFile 148 16
+export BG_LoadTraceMap
+proc BG_LoadTraceMap 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 BG_LoadTraceMapFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $519
+endproc BG_LoadTraceMap 4 16
+proc BG_ClampPointToTracemapExtends 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+GEF4 $521
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786436
+INDIRF4
+ASGNF4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+LEF4 $525
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786444
+INDIRF4
+ASGNF4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $526
+LABELV $522
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+GEF4 $529
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ASGNF4
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+LEF4 $535
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+ASGNF4
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $536
+LABELV $530
+LABELV $520
+endproc BG_ClampPointToTracemapExtends 4 0
+export BG_GetSkyHeightAtPoint
+proc BG_GetSkyHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $542
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $541
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $541
+endproc BG_GetSkyHeightAtPoint 16 8
+export BG_GetSkyGroundHeightAtPoint
+proc BG_GetSkyGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $551
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $550
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $550
+endproc BG_GetSkyGroundHeightAtPoint 16 8
+export BG_GetGroundHeightAtPoint
+proc BG_GetGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $560
+CNSTF4 3347054592
+RETF4
+ADDRGP4 $559
+JUMPV
+LABELV $560
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $559
+endproc BG_GetGroundHeightAtPoint 16 8
+export BG_GetTracemapGroundFloor
+proc BG_GetTracemapGroundFloor 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $569
+CNSTI4 -65536
+RETI4
+ADDRGP4 $568
+JUMPV
+LABELV $569
+ADDRGP4 tracemap+786452
+INDIRI4
+RETI4
+LABELV $568
+endproc BG_GetTracemapGroundFloor 0 0
+export BG_GetTracemapGroundCeil
+proc BG_GetTracemapGroundCeil 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $573
+CNSTI4 65536
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $573
+ADDRGP4 tracemap+786456
+INDIRI4
+RETI4
+LABELV $572
+endproc BG_GetTracemapGroundCeil 0 0
+export FinalizeTracemapClamp
+proc FinalizeTracemapClamp 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $579
+LABELV $578
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $581
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $583
+ADDRFP4 4
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $583
+LABELV $582
+LABELV $576
+endproc FinalizeTracemapClamp 0 0
+bss
+align 4
+LABELV one_over_mapgrid_factor
+skip 8
+align 4
+LABELV tracemap
+skip 786460
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceAtTime
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_ResetScoreboardBaseline
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import Svcmd_PmoveBench_f
+import Svcmd_PmoveRecord_f
+import G_PmoveRecordEnd
+import G_PmoveRecordBegin
+import G_StopPmoveRecord
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_EventForString
+import G_Script_ScriptEventNum
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateClientRank
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import G_UpdateEntityActivity
+import G_NextRunnableEntity
+import G_RemoveThinks
+import G_ActivateEntity
+import G_SetNextThink
+import G_AdvanceThinks
+import G_InitThinks
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_InitFreeEntities
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_SetScriptName
+import G_SetTargetname
+import G_SetClassname
+import G_UpdateEntityNames
+import G_InitEntityNames
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import G_InitConfigstringCaches
+import G_HashName
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $498
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 120
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $483
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $322
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $309
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $307
+byte 1 84
+byte 1 82
+byte 1 85
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 45
+byte 1 88
+byte 1 70
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 0
+byte 1 0
+align 1
+LABELV $269
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $198
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $151
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $150
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $147
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $144
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
@@ -0,0 +1,2249 @@
+data
+align 4
+LABELV pmoveRecordClient
+byte 4 -1
+code
+proc G_PlayerStateHash 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 2166136261
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $70
+ADDRLP4 4
+CNSTU4 16777619
+ADDRLP4 4
+INDIRU4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+BXORU4
+MULU4
+ASGNU4
+LABELV $71
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1040
+LTI4 $70
+ADDRLP4 4
+INDIRU4
+RETU4
+LABELV $69
+endproc G_PlayerStateHash 12 0
+export G_StopPmoveRecord
+proc G_StopPmoveRecord 12 8
+ADDRLP4 0
+ADDRGP4 pmoveRecordClient
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $77
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $75
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $75
+LABELV $77
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRGP4 pmoveRecordFile
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $78
+ARGP4
+ADDRGP4 pmoveRecordCount
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 pmoveRecordFile
+CNSTI4 0
+ASGNI4
+ADDRGP4 pmoveRecordClient
+CNSTI4 -1
+ASGNI4
+LABELV $74
+endproc G_StopPmoveRecord 12 8
+export G_PmoveRecordBegin
+proc G_PmoveRecordBegin 4 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1376
+DIVI4
+ADDRGP4 pmoveRecordClient
+INDIRI4
+EQI4 $80
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRGP4 pmoveRecord
+ADDRFP4 4
+INDIRP4
+INDIRP4
+INDIRB
+ASGNB 1040
+ADDRGP4 pmoveRecord+1040
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRGP4 pmoveRecord+1064
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pmoveRecord+1068
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pmoveRecord+1072
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pmoveRecord+1076
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $79
+endproc G_PmoveRecordBegin 4 0
+export G_PmoveRecordEnd
+proc G_PmoveRecordEnd 8 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1376
+DIVI4
+ADDRGP4 pmoveRecordClient
+INDIRI4
+EQI4 $88
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 G_PlayerStateHash
+CALLU4
+ASGNU4
+ADDRGP4 pmoveRecord+1080
+ADDRLP4 0
+INDIRU4
+ASGNU4
+ADDRGP4 pmoveRecord
+ARGP4
+CNSTI4 1084
+ARGI4
+ADDRGP4 pmoveRecordFile
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pmoveRecordCount
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $87
+endproc G_PmoveRecordEnd 8 12
+export Svcmd_PmoveRecord_f
+proc Svcmd_PmoveRecord_f 1188 12
+ADDRLP4 1164
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 2
+NEI4 $92
+CNSTI4 1
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 136
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $94
+CNSTI4 -1
+ARGI4
+ADDRGP4 G_StopPmoveRecord
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $94
+LABELV $92
+ADDRLP4 1168
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 3
+EQI4 $97
+ADDRGP4 $99
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $97
+CNSTI4 1
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 1172
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 1160
+ADDRLP4 1172
+INDIRP4
+ASGNP4
+ADDRLP4 1160
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $100
+ADDRGP4 $91
+JUMPV
+LABELV $100
+CNSTI4 -1
+ARGI4
+ADDRGP4 G_StopPmoveRecord
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $102
+ARGP4
+ADDRGP4 COM_DefaultExtension
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRGP4 pmoveRecordFile
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1176
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1180
+CNSTI4 0
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 1180
+INDIRI4
+LTI4 $105
+ADDRGP4 pmoveRecordFile
+INDIRI4
+ADDRLP4 1180
+INDIRI4
+NEI4 $103
+LABELV $105
+ADDRGP4 $106
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $103
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 72
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1448037712
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0+8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 72
+ARGI4
+ADDRGP4 pmoveRecordFile
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 pmoveRecordClient
+ADDRLP4 1160
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1376
+DIVI4
+ASGNI4
+ADDRGP4 pmoveRecordCount
+CNSTI4 0
+ASGNI4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 1160
+INDIRP4
+CNSTI4 1084
+ADDP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $91
+endproc Svcmd_PmoveRecord_f 1188 12
+export Svcmd_PmoveBench_f
+proc Svcmd_PmoveBench_f 1540 20
+ADDRLP4 1508
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1508
+INDIRI4
+CNSTI4 2
+GEI4 $113
+ADDRGP4 $115
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $113
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 352
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $102
+ARGP4
+ADDRGP4 COM_DefaultExtension
+CALLV
+pop
+ADDRLP4 252
+CNSTI4 1
+ASGNI4
+ADDRLP4 1512
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 2
+LEI4 $116
+CNSTI4 2
+ARGI4
+ADDRLP4 484
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 484
+ARGP4
+ADDRLP4 1516
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 1516
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 1
+GEI4 $118
+ADDRLP4 252
+CNSTI4 1
+ASGNI4
+LABELV $118
+LABELV $116
+ADDRLP4 352
+ARGP4
+ADDRLP4 272
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1516
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 416
+ADDRLP4 1516
+INDIRI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+GEI4 $120
+ADDRGP4 $122
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $120
+ADDRLP4 416
+INDIRI4
+CNSTI4 72
+GEI4 $123
+ADDRGP4 $125
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $123
+ADDRLP4 280
+ARGP4
+CNSTI4 72
+ARGI4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 280
+INDIRI4
+CNSTI4 1448037712
+NEI4 $129
+ADDRLP4 280+4
+INDIRI4
+CNSTI4 1
+EQI4 $126
+LABELV $129
+ADDRGP4 $130
+ARGP4
+ADDRLP4 352
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $126
+ADDRLP4 280+8+63
+CNSTI1 0
+ASGNI1
+ADDRGP4 $108
+ARGP4
+ADDRLP4 420
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 280+8
+ARGP4
+ADDRLP4 420
+ARGP4
+ADDRLP4 1520
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRGP4 $137
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRLP4 280+8
+ARGP4
+ADDRLP4 420
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $134
+ADDRLP4 264
+ADDRLP4 416
+INDIRI4
+CNSTI4 72
+SUBI4
+CNSTI4 1084
+DIVI4
+ASGNI4
+ADDRLP4 1524
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 1524
+INDIRI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 1524
+INDIRI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 1524
+INDIRI4
+ASGNI4
+ADDRLP4 248
+CNSTU4 2166136261
+ASGNU4
+ADDRLP4 240
+CNSTU4 0
+ASGNU4
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 236
+ADDRLP4 264
+INDIRI4
+ADDRLP4 260
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 256
+LEI4 $142
+ADDRLP4 236
+CNSTI4 256
+ASGNI4
+LABELV $142
+ADDRGP4 pmoveBenchRecords
+ARGP4
+CNSTU4 1084
+ADDRLP4 236
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 1528
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1528
+INDIRI4
+ASGNI4
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRGP4 $147
+JUMPV
+LABELV $144
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRLP4 228
+ADDRGP4 pmoveBenchRecords
+ASGNP4
+ADDRGP4 $151
+JUMPV
+LABELV $148
+CNSTI4 1040
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 pmoveBenchResults
+ADDP4
+ADDRLP4 228
+INDIRP4
+INDIRB
+ASGNB 1040
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1532
+CNSTI4 1040
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1532
+INDIRI4
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 pmoveBenchResults
+ADDP4
+ASGNP4
+ADDRLP4 0+4
+ADDRLP4 228
+INDIRP4
+ADDRLP4 1532
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 0+28
+ADDRLP4 228
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+36
+ADDRLP4 228
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+212
+ADDRLP4 228
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+216
+ADDRLP4 228
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+220
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 0+224
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+LABELV $149
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 228
+ADDRLP4 228
+INDIRP4
+CNSTI4 1084
+ADDP4
+ASGNP4
+LABELV $151
+ADDRLP4 232
+INDIRI4
+ADDRLP4 236
+INDIRI4
+LTI4 $148
+LABELV $145
+ADDRLP4 244
+ADDRLP4 244
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $147
+ADDRLP4 244
+INDIRI4
+ADDRLP4 252
+INDIRI4
+LTI4 $144
+ADDRLP4 1532
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+ADDRLP4 1532
+INDIRI4
+ADDRLP4 268
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRLP4 228
+ADDRGP4 pmoveBenchRecords
+ASGNP4
+ADDRGP4 $162
+JUMPV
+LABELV $159
+CNSTI4 1040
+ADDRLP4 232
+INDIRI4
+MULI4
+ADDRGP4 pmoveBenchResults
+ADDP4
+ARGP4
+ADDRLP4 1536
+ADDRGP4 G_PlayerStateHash
+CALLU4
+ASGNU4
+ADDRLP4 240
+ADDRLP4 1536
+INDIRU4
+ASGNU4
+ADDRLP4 240
+INDIRU4
+ADDRLP4 228
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRU4
+EQU4 $163
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRGP4 $167
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 232
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 228
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $165
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $163
+ADDRLP4 248
+CNSTU4 16777619
+ADDRLP4 248
+INDIRU4
+ADDRLP4 240
+INDIRU4
+BXORU4
+MULU4
+ASGNU4
+LABELV $160
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 228
+ADDRLP4 228
+INDIRP4
+CNSTI4 1084
+ADDP4
+ASGNP4
+LABELV $162
+ADDRLP4 232
+INDIRI4
+ADDRLP4 236
+INDIRI4
+LTI4 $159
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+ADDRLP4 236
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $140
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $139
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRGP4 $170
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $168
+ADDRGP4 $171
+ARGP4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 276
+INDIRI4
+ARGI4
+CNSTF4 1232348160
+ADDRLP4 276
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 264
+INDIRI4
+CVIF4 4
+ADDRLP4 252
+INDIRI4
+CVIF4 4
+MULF4
+DIVF4
+ARGF4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $172
+ARGP4
+ADDRLP4 248
+INDIRU4
+ARGU4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $112
+endproc Svcmd_PmoveBench_f 1540 20
+bss
+align 4
+LABELV pmoveBenchResults
+skip 266240
+align 4
+LABELV pmoveBenchRecords
+skip 277504
+align 4
+LABELV pmoveRecord
+skip 1084
+align 4
+LABELV pmoveRecordCount
+skip 4
+align 4
+LABELV pmoveRecordFile
+skip 4
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceAtTime
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_ResetScoreboardBaseline
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_EventForString
+import G_Script_ScriptEventNum
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateClientRank
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import G_UpdateEntityActivity
+import G_NextRunnableEntity
+import G_RemoveThinks
+import G_ActivateEntity
+import G_SetNextThink
+import G_AdvanceThinks
+import G_InitThinks
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_InitFreeEntities
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_SetScriptName
+import G_SetTargetname
+import G_SetClassname
+import G_UpdateEntityNames
+import G_InitEntityNames
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import G_InitConfigstringCaches
+import G_HashName
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $172
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 56
+byte 1 120
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $171
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $167
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 40
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $137
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $130
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $125
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $122
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $115
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 98
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $111
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 46
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $99
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $96
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $78
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
@@ -0,0 +1,6231 @@
+data
+export gScriptActions
+align 4
+LABELV gScriptActions
+address $67
+address G_ScriptAction_GotoMarker
+skip 8
+address $68
+address G_ScriptAction_PlaySound
+skip 8
+address $69
+address G_ScriptAction_PlayAnim
+skip 8
+address $70
+address G_ScriptAction_Wait
+address G_ScriptCompile_Wait
+address G_ScriptAction_WaitCompiled
+address $71
+address G_ScriptAction_Trigger
+address G_ScriptCompile_Trigger
+address G_ScriptAction_TriggerCompiled
+address $72
+address G_ScriptAction_AlertEntity
+skip 8
+address $73
+address G_ScriptAction_RemoveEntity
+skip 8
+address $74
+address G_ScriptAction_Accum
+address G_ScriptCompile_Accum
+address G_ScriptAction_AccumCompiled
+address $75
+address G_ScriptAction_MissionFailed
+skip 8
+address $76
+address G_ScriptAction_MissionSuccess
+skip 8
+address $77
+address G_ScriptAction_Print
+skip 8
+address $78
+address G_ScriptAction_FaceAngles
+skip 8
+address $79
+address G_ScriptAction_ResetScript
+skip 8
+address $80
+address G_ScriptAction_TagConnect
+skip 8
+address $81
+address G_ScriptAction_Halt
+skip 8
+address $82
+address G_ScriptAction_StopSound
+skip 8
+address $83
+address G_ScriptAction_StartCam
+skip 8
+address $84
+address G_ScriptAction_StartCamBlack
+skip 8
+address $85
+address G_ScriptAction_EntityScriptName
+skip 8
+address $86
+address G_ScriptAction_AIScriptName
+skip 8
+address $87
+address G_ScriptAction_ObjectiveMet
+skip 8
+address $88
+address G_ScriptAction_MapDescription
+skip 8
+address $89
+address G_ScriptAction_BlueRespawntime
+skip 8
+address $90
+address G_ScriptAction_RedRespawntime
+skip 8
+address $91
+address G_ScriptAction_NumberofObjectives
+skip 8
+address $92
+address G_ScriptAction_ObjectiveBlueDesc
+skip 8
+address $93
+address G_ScriptAction_ObjectiveShortBlueDesc
+skip 8
+address $94
+address G_ScriptAction_ObjectiveRedDesc
+skip 8
+address $95
+address G_ScriptAction_ObjectiveShortRedDesc
+skip 8
+address $96
+address G_ScriptAction_ObjectiveImage
+skip 8
+address $97
+address G_ScriptAction_SetWinner
+skip 8
+address $98
+address G_ScriptAction_SetObjectiveStatus
+skip 8
+address $99
+address G_ScriptAction_SetDefendingTeam
+skip 8
+address $100
+address G_ScriptAction_Announce
+skip 8
+address $101
+address G_ScriptAction_SetRoundTimelimit
+skip 8
+address $102
+address G_ScriptAction_OverviewImage
+skip 8
+address $103
+address G_ScriptAction_BackupScript
+skip 8
+address $104
+address G_ScriptAction_RestoreScript
+skip 8
+address $105
+address G_ScriptAction_SetHealth
+skip 8
+address $106
+address G_ScriptAction_MusicStart
+skip 8
+address $107
+address G_ScriptAction_MusicPlay
+skip 8
+address $108
+address G_ScriptAction_MusicStop
+skip 8
+address $109
+address G_ScriptAction_MusicFade
+skip 8
+address $110
+address G_ScriptAction_MusicQueue
+skip 8
+address $111
+address G_ScriptAction_ObjectivesNeeded
+skip 8
+address $112
+address G_ScriptAction_NumSecrets
+skip 8
+byte 4 0
+byte 4 0
+skip 8
+export gScriptEvents
+align 4
+LABELV gScriptEvents
+address $113
+byte 4 0
+address $71
+address G_Script_EventMatch_StringEqual
+address $114
+address G_Script_EventMatch_IntInRange
+address $115
+byte 4 0
+address $116
+address G_Script_EventMatch_StringEqual
+address $117
+byte 4 0
+byte 4 0
+byte 4 0
+export G_Script_EventMatch_StringEqual
+code
+proc G_Script_EventMatch_StringEqual 12 8
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $119
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+NEU4 $119
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $119
+CNSTI4 1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $119
+CNSTI4 0
+RETI4
+LABELV $118
+endproc G_Script_EventMatch_StringEqual 12 8
+export G_Script_EventMatch_IntInRange
+proc G_Script_EventMatch_IntInRange 40 8
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $122
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $122
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $122
+CNSTI4 1
+RETI4
+ADDRGP4 $121
+JUMPV
+LABELV $122
+CNSTI4 0
+RETI4
+LABELV $121
+endproc G_Script_EventMatch_IntInRange 40 8
+export G_Script_EventForString
+proc G_Script_EventForString 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $128
+JUMPV
+LABELV $125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptEvents
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $129
+LABELV $126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $128
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 gScriptEvents
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $125
+CNSTI4 -1
+RETI4
+LABELV $124
+endproc G_Script_EventForString 8 8
+export G_Script_ActionForString
+proc G_Script_ActionForString 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $132
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 gScriptActions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 gScriptActions
+ADDP4
+RETP4
+ADDRGP4 $131
+JUMPV
+LABELV $136
+LABELV $133
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 gScriptActions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $132
+CNSTP4 0
+RETP4
+LABELV $131
+endproc G_Script_ActionForString 8 8
+export G_Script_ScriptLoad
+proc G_Script_ScriptLoad 356 16
+ADDRGP4 g_scriptDebug
+ARGP4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 $140
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 level+9476
+CNSTP4 0
+ASGNP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 344
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 344
+INDIRU4
+CNSTU4 0
+EQU4 $143
+ADDRLP4 72
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 $145
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 72
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 $145
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $144
+ADDRLP4 0
+ARGP4
+ADDRGP4 $147
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $149
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+GEI4 $150
+ADDRGP4 $138
+JUMPV
+LABELV $150
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 level+9476
+ADDRLP4 352
+INDIRP4
+ASGNP4
+ADDRGP4 level+9476
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $138
+endproc G_Script_ScriptLoad 356 16
+proc G_Script_CompileItem 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $158
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $157
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 40
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 G_HashName
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 52
+INDIRU4
+ASGNU4
+LABELV $163
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $162
+LABELV $160
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $166
+LABELV $154
+endproc G_Script_CompileItem 56 8
+export G_Script_ScriptParse
+proc G_Script_ScriptParse 1140 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $169
+ADDRGP4 $168
+JUMPV
+LABELV $169
+ADDRGP4 level+9476
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $171
+ADDRGP4 $168
+JUMPV
+LABELV $171
+ADDRLP4 1072
+CNSTI4 1
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRGP4 level+9476
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRGP4 $175
+ARGP4
+ADDRGP4 COM_BeginParseSession
+CALLV
+pop
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRGP4 g_temp_events
+ARGP4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+CNSTU4 1536
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1080
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $179
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $178
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $184
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $186
+ADDRGP4 $178
+JUMPV
+LABELV $186
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $188
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $191
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_strcasecmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $198
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $260
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 G_Script_EventForString
+CALLI4
+ASGNI4
+ADDRLP4 1068
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+GEI4 $202
+ADDRLP4 1088
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 1088
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $202
+ADDRLP4 1060
+INDIRI4
+CNSTI4 64
+LTI4 $205
+ADDRLP4 1088
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 1088
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $205
+ADDRLP4 1048
+CNSTI4 24
+ADDRLP4 1060
+INDIRI4
+MULI4
+ADDRGP4 g_temp_events
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $211
+ADDRLP4 1088
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 1088
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $211
+ADDRLP4 4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1088
+INDIRU4
+CNSTU4 0
+EQU4 $213
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $213
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $209
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1088
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $216
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $208
+LABELV $216
+ADDRLP4 4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1092
+INDIRU4
+CNSTU4 0
+EQU4 $217
+ADDRLP4 4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1096
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 G_HashName
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 1112
+INDIRU4
+ASGNU4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+LABELV $217
+ADDRGP4 g_temp_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2304
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $222
+ADDRLP4 1096
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $222
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 G_Script_ActionForString
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $224
+ADDRLP4 1100
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $224
+ADDRLP4 1044
+CNSTI4 36
+ADDRLP4 1048
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_temp_items
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1036
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1100
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRGP4 $230
+JUMPV
+LABELV $227
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1104
+INDIRU4
+CNSTU4 0
+EQU4 $231
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $231
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $233
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $235
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SoundIndex
+CALLI4
+pop
+LABELV $235
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $106
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRLP4 1028
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $237
+LABELV $242
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1132
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1132
+INDIRU4
+CNSTU4 0
+EQU4 $243
+ADDRGP4 $245
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $243
+LABELV $237
+LABELV $233
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1108
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $246
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $248
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $246
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1112
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 1112
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $249
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $248
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $249
+ADDRLP4 1036
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1116
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+LABELV $228
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $230
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1104
+INDIRU4
+CNSTU4 0
+EQU4 $251
+ADDRLP4 4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1108
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1116
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $251
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 G_Script_CompileItem
+CALLV
+pop
+ADDRLP4 1108
+ADDRLP4 1048
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $253
+ADDRLP4 1112
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $255
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $253
+LABELV $220
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1096
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $256
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $219
+LABELV $256
+ADDRLP4 1048
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $257
+CNSTU4 36
+ADDRLP4 1048
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 g_temp_items
+ARGP4
+CNSTU4 36
+ADDRLP4 1048
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $257
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $259
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $262
+ADDRLP4 1084
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $264
+ADDRLP4 1064
+ADDRLP4 1064
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $266
+ADDRLP4 1084
+ADDRLP4 1064
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $268
+ADDRGP4 $261
+JUMPV
+LABELV $268
+LABELV $266
+LABELV $265
+LABELV $263
+LABELV $260
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1084
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $259
+LABELV $261
+LABELV $201
+LABELV $197
+LABELV $192
+LABELV $185
+LABELV $177
+ADDRGP4 $176
+JUMPV
+LABELV $178
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+LEI4 $270
+CNSTU4 24
+ADDRLP4 1060
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRLP4 1080
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 g_temp_events
+ARGP4
+CNSTU4 24
+ADDRLP4 1060
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+LABELV $270
+LABELV $168
+endproc G_Script_ScriptParse 1140 12
+export G_Script_ScriptChange
+proc G_Script_ScriptChange 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRLP4 0+12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_Script_ScriptRun
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $275
+LABELV $272
+endproc G_Script_ScriptChange 28 12
+export G_Script_ScriptEvent
+proc G_Script_ScriptEvent 16 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_Script_EventForString
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $278
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRGP4 $283
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $278
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $285
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_HashName
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+ASGNU4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRU4
+ARGU4
+ADDRGP4 G_Script_ScriptEventNum
+CALLV
+pop
+LABELV $277
+endproc G_Script_ScriptEvent 16 16
+export G_Script_ScriptEventNum
+proc G_Script_ScriptEventNum 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRU4
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $288
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $292
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $299
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 gScriptEvents+4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $299
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ADDRGP4 gScriptEvents+4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $294
+LABELV $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_Script_ScriptChange
+CALLV
+pop
+ADDRGP4 $290
+JUMPV
+LABELV $294
+LABELV $292
+LABELV $289
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $291
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+LTI4 $288
+LABELV $290
+LABELV $287
+endproc G_Script_ScriptEventNum 20 12
+export G_Script_ScriptRun
+proc G_Script_ScriptRun 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_missionStats+16
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTU4 1
+LEU4 $301
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $301
+ADDRGP4 g_scriptDebug
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $304
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 G_ScriptAction_GotoMarker
+CALLI4
+pop
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $308
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_ScriptAction_PlayAnim
+CALLI4
+pop
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $310
+CNSTI4 1
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $310
+ADDRLP4 4
+CNSTI4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $312
+ADDRGP4 g_scriptDebug+12
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+NEI4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $326
+ADDRGP4 $320
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTI4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $323
+ADDRLP4 16
+CNSTI4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 16
+ADDRGP4 $145
+ASGNP4
+LABELV $324
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRLP4 0
+CNSTI4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $328
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $329
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $328
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $332
+CNSTI4 0
+RETI4
+ADDRGP4 $300
+JUMPV
+LABELV $332
+LABELV $329
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRGP4 level+56
+INDIRI4
+ASGNI4
+ADDRGP4 g_scriptDebug+12
+INDIRI4
+CNSTI4 0
+EQI4 $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $338
+ADDRGP4 $320
+ARGP4
+ADDRGP4 level+56
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+CNSTI4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $342
+ADDRLP4 32
+CNSTI4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 32
+ADDRGP4 $145
+ASGNP4
+LABELV $343
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $338
+LABELV $335
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $300
+endproc G_Script_ScriptRun 44 20
+export script_linkentity
+proc script_linkentity 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $344
+endproc script_linkentity 0 4
+export script_mover_die
+proc script_mover_die 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $346
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $349
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $348
+LABELV $351
+ADDRLP4 8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 15
+EQI4 $349
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $349
+ADDRGP4 $348
+JUMPV
+LABELV $348
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $349
+LABELV $346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $115
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRGP4 G_Script_ScriptEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $345
+endproc script_mover_die 16 12
+export script_mover_pain
+proc script_mover_pain 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $353
+ARGP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Script_ScriptEvent
+CALLV
+pop
+LABELV $352
+endproc script_mover_pain 8 12
+export script_mover_spawn
+proc script_mover_spawn 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_linkentity
+CALLV
+pop
+LABELV $354
+endproc script_mover_spawn 4 4
+export script_mover_use
+proc script_mover_use 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_mover_spawn
+CALLV
+pop
+LABELV $357
+endproc script_mover_use 0 4
+export script_mover_blocked
+proc script_mover_blocked 8 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $359
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 99
+ARGI4
+ADDRGP4 G_TempEntity
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $358
+JUMPV
+LABELV $359
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 9999
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $358
+endproc script_mover_blocked 8 32
+lit
+align 4
+LABELV $362
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export SP_script_mover
+code
+proc SP_script_mover 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $362
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $363
+ADDRGP4 $365
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $366
+ADDRGP4 $368
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRGP4 script_mover_blocked
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 script_mover_use
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRGP4 $361
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 G_SetAngle
+CALLV
+pop
+ADDRGP4 $371
+ARGP4
+ADDRGP4 $140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ADDRGP4 script_mover_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 script_mover_pain
+ASGNP4
+ADDRGP4 $376
+ARGP4
+ADDRGP4 $377
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_SpawnFloat
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRLP4 44
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $374
+ADDRGP4 $382
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ADDRGP4 G_SpawnVector
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $380
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $380
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEF4 $389
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+NEF4 $389
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 48
+INDIRF4
+EQF4 $384
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_mover_spawn
+CALLV
+pop
+LABELV $361
+endproc SP_script_mover 52 12
+export script_model_med_spawn
+proc script_model_med_spawn 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $390
+endproc script_model_med_spawn 12 4
+export script_model_med_use
+proc script_model_med_use 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_model_med_spawn
+CALLV
+pop
+LABELV $393
+endproc script_model_med_use 0 4
+export SP_script_model_med
+proc SP_script_model_med 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $395
+ADDRGP4 $397
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $398
+ADDRGP4 $400
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $398
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRGP4 script_model_med_use
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRGP4 $394
+JUMPV
+LABELV $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 script_model_med_spawn
+CALLV
+pop
+LABELV $394
+endproc SP_script_model_med 12 8
+export SP_script_camera
+proc SP_script_camera 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $404
+ADDRGP4 $406
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $404
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $403
+endproc SP_script_camera 16 8
+export SP_script_multiplayer
+proc SP_script_multiplayer 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $408
+ADDRGP4 $406
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRGP4 $413
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $407
+endproc SP_script_multiplayer 8 8
+bss
+export g_temp_items
+align 4
+LABELV g_temp_items
+skip 2304
+export g_temp_events
+align 4
+LABELV g_temp_events
+skip 1536
+import G_ScriptAction_AccumCompiled
+import G_ScriptCompile_Accum
+import G_ScriptAction_TriggerCompiled
+import G_ScriptCompile_Trigger
+import G_ScriptAction_WaitCompiled
+import G_ScriptCompile_Wait
+import G_ScriptAction_NumSecrets
+import G_ScriptAction_ObjectivesNeeded
+import G_ScriptAction_MusicQueue
+import G_ScriptAction_MusicFade
+import G_ScriptAction_MusicStop
+import G_ScriptAction_MusicPlay
+import G_ScriptAction_MusicStart
+import G_ScriptAction_SetHealth
+import G_ScriptAction_RestoreScript
+import G_ScriptAction_BackupScript
+import G_ScriptAction_OverviewImage
+import G_ScriptAction_SetRoundTimelimit
+import G_ScriptAction_Announce
+import G_ScriptAction_SetDefendingTeam
+import G_ScriptAction_SetObjectiveStatus
+import G_ScriptAction_SetWinner
+import G_ScriptAction_ObjectiveImage
+import G_ScriptAction_ObjectiveShortRedDesc
+import G_ScriptAction_ObjectiveRedDesc
+import G_ScriptAction_ObjectiveShortBlueDesc
+import G_ScriptAction_ObjectiveBlueDesc
+import G_ScriptAction_ObjectiveMet
+import G_ScriptAction_NumberofObjectives
+import G_ScriptAction_RedRespawntime
+import G_ScriptAction_BlueRespawntime
+import G_ScriptAction_MapDescription
+import G_ScriptAction_AIScriptName
+import G_ScriptAction_EntityScriptName
+import G_ScriptAction_StartCamBlack
+import G_ScriptAction_StartCam
+import G_ScriptAction_StopSound
+import G_ScriptAction_Halt
+import G_ScriptAction_TagConnect
+import G_ScriptAction_ResetScript
+import G_ScriptAction_FaceAngles
+import G_ScriptAction_Print
+import G_ScriptAction_MissionSuccess
+import G_ScriptAction_MissionFailed
+import G_ScriptAction_Accum
+import G_ScriptAction_RemoveEntity
+import G_ScriptAction_AlertEntity
+import G_ScriptAction_PlayAnim
+import G_ScriptAction_PlaySound
+import G_ScriptAction_Trigger
+import G_ScriptAction_Wait
+import G_ScriptAction_GotoMarker
+export g_scriptDebug
+align 4
+LABELV g_scriptDebug
+skip 272
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceAtTime
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_ResetScoreboardBaseline
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import Svcmd_PmoveBench_f
+import Svcmd_PmoveRecord_f
+import G_PmoveRecordEnd
+import G_PmoveRecordBegin
+import G_StopPmoveRecord
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateClientRank
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import G_UpdateEntityActivity
+import G_NextRunnableEntity
+import G_RemoveThinks
+import G_ActivateEntity
+import G_SetNextThink
+import G_AdvanceThinks
+import G_InitThinks
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_InitFreeEntities
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_SetScriptName
+import G_SetTargetname
+import G_SetClassname
+import G_UpdateEntityNames
+import G_InitEntityNames
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import G_InitConfigstringCaches
+import G_HashName
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $413
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 39
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 39
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $412
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $406
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $400
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $397
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $383
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $382
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $377
+byte 1 49
+byte 1 0
+align 1
+LABELV $376
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $371
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $368
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $365
+byte 1 83
+byte 1 80
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 34
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 34
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $353
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $320
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 71
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $283
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $255
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 82
+byte 1 73
+byte 1 80
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $248
+byte 1 34
+byte 1 0
+align 1
+LABELV $245
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 84
+byte 1 111
+byte 1 66
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $226
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $215
+byte 1 32
+byte 1 0
+align 1
+LABELV $207
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 82
+byte 1 73
+byte 1 80
+byte 1 84
+byte 1 95
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $204
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 123
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 125
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 40
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 125
+byte 1 39
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $149
+byte 1 46
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $146
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $145
+byte 1 0
+align 1
+LABELV $142
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 48
+byte 1 0
+align 1
+LABELV $139
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $116
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $114
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $112
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $111
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $110
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $106
+byte 1 109
+byte 1 117
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $105
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $103
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $102
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $100
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $99
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $98
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $97
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $96
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $95
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $94
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $93
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $92
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $91
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $90
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $89
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $88
+byte 1 119
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $87
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $86
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $85
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $83
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $82
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $81
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $80
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $79
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $78
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $77
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $76
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $75
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $74
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $73
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $72
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $71
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $70
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $69
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $68
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $67
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
@@ -0,0 +1,1729 @@
+code
+proc G_LinkThink 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $68
+ADDRFP4 4
+INDIRP4
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $68
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $67
+endproc G_LinkThink 0 0
+proc G_UnlinkThink 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $71
+ADDRGP4 $70
+JUMPV
+LABELV $71
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $73
+ADDRLP4 4
+CNSTI4 520
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $74
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $75
+ADDRLP4 4
+CNSTI4 524
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $75
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $70
+endproc G_UnlinkThink 8 0
+proc G_InsertThink 8 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRGP4 thinkTick
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $78
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 thinkPending
+ARGP4
+ADDRGP4 G_LinkThink
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+GTI4 $80
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 255
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 thinkWheel0
+ADDP4
+ARGP4
+ADDRGP4 G_LinkThink
+CALLV
+pop
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+GTI4 $82
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 thinkWheel1
+ADDP4
+ARGP4
+ADDRGP4 G_LinkThink
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 1048576
+GTI4 $84
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 14
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 thinkWheel2
+ADDP4
+ARGP4
+ADDRGP4 G_LinkThink
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 thinkOverflow
+ARGP4
+ADDRGP4 G_LinkThink
+CALLV
+pop
+LABELV $85
+LABELV $83
+LABELV $81
+LABELV $79
+LABELV $77
+endproc G_InsertThink 8 8
+proc G_ReinsertThinks 28 4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $90
+JUMPV
+LABELV $87
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+LEI4 $91
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InsertThink
+CALLV
+pop
+ADDRGP4 $88
+JUMPV
+LABELV $91
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 864
+DIVI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dueEntities
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BORU4
+ASGNU4
+LABELV $88
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $90
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $87
+LABELV $86
+endproc G_ReinsertThinks 28 4
+export G_InitThinks
+proc G_InitThinks 16 12
+ADDRGP4 thinkWheel0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 thinkWheel1
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 thinkWheel2
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 activeEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 dueEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 thinkOverflow
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 thinkPending
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 thinkTick
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $95
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BORU4
+ASGNU4
+LABELV $96
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $95
+LABELV $94
+endproc G_InitThinks 16 12
+export G_AdvanceThinks
+proc G_AdvanceThinks 12 4
+ADDRGP4 thinkPending
+ARGP4
+ADDRGP4 G_ReinsertThinks
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 level+56
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRLP4 0
+ADDRGP4 thinkTick
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+BANDI4
+CNSTI4 0
+NEI4 $104
+ADDRLP4 0
+INDIRI4
+CNSTI4 16383
+BANDI4
+CNSTI4 0
+NEI4 $106
+ADDRLP4 0
+INDIRI4
+CNSTI4 1048575
+BANDI4
+CNSTI4 0
+NEI4 $108
+ADDRGP4 thinkOverflow
+ARGP4
+ADDRGP4 G_ReinsertThinks
+CALLV
+pop
+LABELV $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 thinkWheel2
+ADDP4
+ARGP4
+ADDRGP4 G_ReinsertThinks
+CALLV
+pop
+LABELV $106
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 63
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 thinkWheel1
+ADDP4
+ARGP4
+ADDRGP4 G_ReinsertThinks
+CALLV
+pop
+LABELV $104
+ADDRGP4 thinkTick
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 thinkWheel0
+ADDP4
+ARGP4
+ADDRGP4 G_ReinsertThinks
+CALLV
+pop
+LABELV $102
+ADDRGP4 thinkTick
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $101
+LABELV $99
+endproc G_AdvanceThinks 12 4
+export G_SetNextThink
+proc G_SetNextThink 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UnlinkThink
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $111
+ADDRGP4 $110
+JUMPV
+LABELV $111
+ADDRFP4 4
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+LEI4 $113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_InsertThink
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $113
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 864
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dueEntities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BORU4
+ASGNU4
+LABELV $110
+endproc G_SetNextThink 12 4
+export G_ActivateEntity
+proc G_ActivateEntity 12 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 864
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BORU4
+ASGNU4
+LABELV $116
+endproc G_ActivateEntity 12 0
+export G_RemoveThinks
+proc G_RemoveThinks 20 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UnlinkThink
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 864
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dueEntities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BCOMU4
+BANDU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $118
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BCOMU4
+BANDU4
+ASGNU4
+LABELV $118
+LABELV $117
+endproc G_RemoveThinks 20 4
+export G_NextRunnableEntity
+proc G_NextRunnableEntity 24 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $121
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRGP4 activeEntities
+ADDP4
+INDIRU4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 dueEntities
+ADDP4
+INDIRU4
+BORU4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+RSHU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 0
+NEU4 $129
+ADDRGP4 $122
+JUMPV
+LABELV $128
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+ADDRLP4 16
+INDIRI4
+RSHU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $129
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $128
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $131
+ADDRGP4 $123
+JUMPV
+LABELV $131
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dueEntities
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BCOMU4
+BANDU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $120
+JUMPV
+LABELV $122
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BORI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $121
+LABELV $123
+ADDRGP4 level+12
+INDIRI4
+RETI4
+LABELV $120
+endproc G_NextRunnableEntity 24 0
+export G_UpdateEntityActivity
+proc G_UpdateEntityActivity 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 864
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $136
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 396
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $140
+LABELV $145
+ADDRGP4 $135
+JUMPV
+LABELV $140
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $149
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $149
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+NEI4 $146
+LABELV $149
+ADDRGP4 $135
+JUMPV
+LABELV $146
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $150
+ADDRLP4 20
+INDIRI4
+ADDRGP4 level+56
+INDIRI4
+GTI4 $150
+ADDRGP4 $135
+JUMPV
+LABELV $150
+LABELV $138
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 activeEntities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHU4
+BCOMU4
+BANDU4
+ASGNU4
+LABELV $135
+endproc G_UpdateEntityActivity 24 0
+bss
+align 4
+LABELV dueEntities
+skip 128
+align 4
+LABELV activeEntities
+skip 128
+align 4
+LABELV thinkTick
+skip 4
+align 4
+LABELV thinkPending
+skip 4
+align 4
+LABELV thinkOverflow
+skip 4
+align 4
+LABELV thinkWheel2
+skip 256
+align 4
+LABELV thinkWheel1
+skip 256
+align 4
+LABELV thinkWheel0
+skip 1024
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_SetAASBlockingEntity
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_AreaCenter
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_AAS_SetCurrentWorld
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceAtTime
+import trap_TraceEntities
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import g_userBlueRespawnTime
+import g_userRedRespawnTime
+import g_bluelimbotime
+import g_redlimbotime
+import g_scriptName
+import ai_scriptName
+import g_missionStats
+import g_airespawn
+import g_proxMineTimeout
+import g_singlePlayer
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_limbotime
+import g_gametype
+import g_camEnt
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadClientSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import ObeliskPain
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import G_ResetScoreboardBaseline
+import DeathmatchScoreboardMessage
+import ConcatArgs
+import G_StartKamikaze
+import FireWeapon
+import Svcmd_PmoveBench_f
+import Svcmd_PmoveRecord_f
+import G_PmoveRecordEnd
+import G_PmoveRecordBegin
+import G_StopPmoveRecord
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import G_UnregisterCommands
+import G_RegisterCommands
+import G_ConsoleCommand
+import G_Script_ScriptLoad
+import G_Script_EventForString
+import G_Script_ScriptEventNum
+import G_Script_ScriptEvent
+import G_Script_ScriptRun
+import G_Script_ScriptParse
+import G_ScriptPreprocess
+import G_ProcessTagConnect
+import G_IsClientOnTeam
+import SpotWouldTelefrag
+import CalculateClientRank
+import CalculateRanks
+import AddScore
+import PlayerDie
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import Touch_TeleporterTrigger
+import Touch_DoorTrigger
+import SetMoverState
+import InitMover
+import G_RunMover
+import fire_bfg
+import fire_plasma
+import fire_rocket
+import fire_napalm
+import fire_grenade
+import fire_prox
+import fire_nail
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import BodyDie
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import GetFirstValidBluePlayer
+import GetFirstValidPlayer
+import ScriptEventForPlayer
+import IsPlayerEnt
+import G_SetAngle
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import VectorToYaw
+import VectorToString
+import TempVector
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_GetEntityPlayerState
+import G_GetEntityEventSoundCoefficient
+import G_InitGentity
+import G_InitFreeEntities
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_SetScriptName
+import G_SetTargetname
+import G_SetClassname
+import G_UpdateEntityNames
+import G_InitEntityNames
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import G_InitConfigstringCaches
+import G_HashName
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import FinishSpawningItem
+import G_SpawnItem
+import Launch_Item
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
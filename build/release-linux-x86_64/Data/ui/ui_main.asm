@@ -0,0 +1,42397 @@
+data
+align 4
+LABELV MonthAbbrev
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+align 4
+LABELV skillLevels
+address $98
+address $99
+address $100
+address $101
+address $102
+lit
+align 4
+LABELV numSkillLevels
+byte 4 5
+data
+align 4
+LABELV netSources
+address $103
+address $104
+address $105
+address $106
+address $107
+address $108
+address $109
+address $110
+lit
+align 4
+LABELV numNetSources
+byte 4 8
+data
+align 4
+LABELV teamArenaGameTypes
+address $111
+address $112
+address $113
+address $114
+address $115
+address $116
+address $117
+address $118
+address $119
+lit
+align 4
+LABELV numTeamArenaGameTypes
+byte 4 9
+data
+align 4
+LABELV netnames
+address $120
+address $121
+address $122
+align 4
+LABELV gamecodetoui
+byte 4 8
+byte 4 4
+byte 4 6
+byte 4 0
+byte 4 10
+byte 4 2
+byte 4 12
+byte 4 1
+byte 4 3
+byte 4 5
+byte 4 7
+byte 4 9
+byte 4 11
+align 4
+LABELV uitogamecode
+byte 4 4
+byte 4 8
+byte 4 6
+byte 4 9
+byte 4 2
+byte 4 10
+byte 4 3
+byte 4 11
+byte 4 1
+byte 4 12
+byte 4 5
+byte 4 13
+byte 4 7
+export vmMain
+code
+proc vmMain 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+GTI4 $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $136
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $136
+address $126
+address $127
+address $128
+address $129
+address $130
+address $131
+address $132
+address $133
+address $134
+address $135
+code
+LABELV $126
+CNSTI4 7
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $127
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 _UI_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $128
+ADDRGP4 _UI_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $129
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 _UI_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $130
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 _UI_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $131
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 _UI_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $132
+ADDRLP4 4
+ADDRGP4 _UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $133
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 _UI_SetActiveMenu
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $134
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $135
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $124
+CNSTI4 -1
+RETI4
+LABELV $123
+endproc vmMain 12 8
+proc UI_AssetCache 108 8
+ADDRGP4 $140
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61684
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61792
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+28
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+32
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+40
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61796+48
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61704
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61692
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61688
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61696
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61700
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61708
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61724
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61728
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $219
+ADDRGP4 $225
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+240+61848
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $220
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $219
+ADDRGP4 $227
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+146140
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $137
+endproc UI_AssetCache 108 8
+export _UI_DrawSides
+proc _UI_DrawSides 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 uiInfo+212
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+98024
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+98024
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $228
+endproc _UI_DrawSides 12 36
+export _UI_DrawTopBottom
+proc _UI_DrawTopBottom 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 uiInfo+208
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+98024
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+98024
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $232
+endproc _UI_DrawTopBottom 12 36
+export _UI_DrawRect
+proc _UI_DrawRect 0 20
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 _UI_DrawTopBottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 _UI_DrawSides
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $236
+endproc _UI_DrawRect 0 20
+export Text_Width
+proc Text_Width 48 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 uiInfo+240+12
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $240
+ADDRLP4 12
+ADDRGP4 uiInfo+240+20568
+ASGNP4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $245
+ADDRLP4 12
+ADDRGP4 uiInfo+240+41124
+ASGNP4
+LABELV $245
+LABELV $241
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $252
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $252
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $252
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $257
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $255
+JUMPV
+LABELV $257
+ADDRLP4 16
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $255
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $260
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $260
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $254
+LABELV $260
+LABELV $250
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $237
+endproc Text_Width 48 4
+export Text_Height
+proc Text_Height 44 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 uiInfo+240+12
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $264
+ADDRLP4 20
+ADDRGP4 uiInfo+240+20568
+ASGNP4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $269
+ADDRLP4 20
+ADDRGP4 uiInfo+240+41124
+ASGNP4
+LABELV $269
+LABELV $265
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $274
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $276
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $276
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $276
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $279
+JUMPV
+LABELV $281
+ADDRLP4 12
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+GEF4 $283
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $283
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $279
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $286
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $286
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $278
+LABELV $286
+LABELV $274
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $261
+endproc Text_Height 44 4
+export Text_PaintChar
+proc Text_PaintChar 12 36
+ADDRLP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $287
+endproc Text_PaintChar 12 36
+export Text_Paint
+proc Text_Paint 80 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 uiInfo+240+12
+ASGNP4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $291
+ADDRLP4 28
+ADDRGP4 uiInfo+240+20568
+ASGNP4
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $296
+ADDRLP4 28
+ADDRGP4 uiInfo+240+41124
+ASGNP4
+LABELV $296
+LABELV $292
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $301
+ADDRLP4 36
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32
+ADDRLP4 40
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LEI4 $303
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $303
+ADDRLP4 32
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $303
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $308
+ADDRLP4 56
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $313
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $311
+LABELV $313
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $315
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+LABELV $316
+ADDRLP4 64
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 colorBlack+12
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $311
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $306
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $321
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $321
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $305
+LABELV $321
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $301
+LABELV $288
+endproc Text_Paint 80 40
+export Text_PaintWithCursor
+proc Text_PaintWithCursor 84 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 uiInfo+240+12
+ASGNP4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $325
+ADDRLP4 36
+ADDRGP4 uiInfo+240+20568
+ASGNP4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $330
+ADDRLP4 36
+ADDRGP4 uiInfo+240+41124
+ASGNP4
+LABELV $330
+LABELV $326
+ADDRLP4 4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $335
+ADDRLP4 44
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 40
+ADDRLP4 48
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LEI4 $337
+ADDRLP4 40
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $337
+ADDRLP4 40
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $337
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ADDRFP4 24
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $340
+JUMPV
+LABELV $342
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 32
+INDIRI4
+CNSTI4 3
+EQI4 $347
+ADDRFP4 32
+INDIRI4
+CNSTI4 6
+NEI4 $345
+LABELV $347
+ADDRFP4 32
+INDIRI4
+CNSTI4 3
+NEI4 $349
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+LABELV $350
+ADDRLP4 68
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 colorBlack+12
+ADDRLP4 12+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 76
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $345
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEI4 $354
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $354
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+LABELV $354
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $340
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $358
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $358
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $339
+LABELV $358
+ADDRFP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $359
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $359
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+LABELV $359
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $335
+LABELV $322
+endproc Text_PaintWithCursor 84 40
+proc Text_Paint_Limit 76 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $363
+ADDRLP4 28
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 uiInfo+240+12
+ASGNP4
+ADDRFP4 12
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $367
+ADDRLP4 36
+ADDRGP4 uiInfo+240+20568
+ASGNP4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRFP4 12
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LEF4 $372
+ADDRLP4 36
+ADDRGP4 uiInfo+240+41124
+ASGNP4
+LABELV $372
+LABELV $368
+ADDRLP4 32
+ADDRFP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+ADDRLP4 44
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $377
+ADDRLP4 24
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $377
+ADDRLP4 24
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $377
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_IsColorString
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $382
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $380
+JUMPV
+LABELV $382
+ADDRLP4 60
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+LEF4 $385
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $381
+JUMPV
+LABELV $385
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $380
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $388
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $388
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $379
+LABELV $388
+LABELV $381
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $363
+LABELV $362
+endproc Text_Paint_Limit 76 40
+export UI_ShowPostGame
+proc UI_ShowPostGame 0 8
+ADDRGP4 $390
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $391
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+98060
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRGP4 _UI_SetActiveMenu
+CALLV
+pop
+LABELV $389
+endproc UI_ShowPostGame 0 8
+export UI_DrawCenteredPic
+proc UI_DrawCenteredPic 20 20
+ADDRLP4 8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CNSTI4 640
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CNSTI4 480
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+LABELV $393
+endproc UI_DrawCenteredPic 20 20
+data
+export frameCount
+align 4
+LABELV frameCount
+byte 4 0
+bss
+align 4
+LABELV $395
+skip 4
+align 4
+LABELV $396
+skip 16
+code
+proc _UI_Refresh 32 20
+ADDRGP4 uiInfo+224
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uiInfo+220
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $395
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $396
+ADDP4
+ADDRGP4 uiInfo+224
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 $395
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $401
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $403
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $396
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $404
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $403
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $407
+ADDRGP4 uiInfo+98036
+CNSTF4 1165623296
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $401
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $410
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 UI_DoServerRefresh
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildFindPlayerList
+CALLV
+pop
+LABELV $410
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $412
+ADDRLP4 20
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRGP4 uiInfo+228
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 uiInfo+232
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+240+61680
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+LABELV $412
+ADDRGP4 uiInfo+236
+INDIRI4
+CNSTI4 0
+EQI4 $418
+LABELV $418
+LABELV $394
+endproc _UI_Refresh 32 20
+proc _UI_Shutdown 0 0
+ADDRGP4 trap_LAN_SaveCachedServers
+CALLV
+pop
+LABELV $421
+endproc _UI_Shutdown 0 0
+data
+export defaultMenu
+align 4
+LABELV defaultMenu
+byte 4 0
+bss
+align 1
+LABELV $423
+skip 32768
+code
+proc UI_GetMenuBuffer 16 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRGP4 $426
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 defaultMenu
+INDIRP4
+RETP4
+ADDRGP4 $422
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 32768
+LTI4 $427
+ADDRGP4 $429
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 defaultMenu
+INDIRP4
+RETP4
+ADDRGP4 $422
+JUMPV
+LABELV $427
+ADDRGP4 $423
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $423
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $423
+RETP4
+LABELV $422
+endproc UI_GetMenuBuffer 16 16
+export UI_Asset_Parse
+proc UI_Asset_Parse 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $431
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $431
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $437
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $440
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $440
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $442
+CNSTI4 1
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $442
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $449
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $446
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $452
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $450
+LABELV $452
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $450
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 uiInfo+240+12
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 uiInfo+240+61788
+CNSTI4 1
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $446
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $460
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $457
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $461
+LABELV $463
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $461
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 uiInfo+240+20568
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $438
+JUMPV
+LABELV $457
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $466
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $472
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $470
+LABELV $472
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $470
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 uiInfo+240+41124
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $438
+JUMPV
+LABELV $466
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $478
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $479
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $479
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61684
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $475
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $486
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $487
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $487
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61732
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $483
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $491
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $495
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $495
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61736
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $491
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $499
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $503
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $503
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61744
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $499
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $507
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $511
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $511
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61740
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $507
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $515
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $519
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $519
+ADDRGP4 uiInfo+240+4
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+240+61680
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $515
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $527
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+61748
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $527
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $538
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $535
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+61752
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $535
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $546
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $543
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+61756
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $543
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+61760
+ARGP4
+ADDRLP4 1116
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $551
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $562
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $559
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+61764
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $559
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+240+61768
+ARGP4
+ADDRLP4 1124
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $571
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $571
+ADDRGP4 uiInfo+240+61784
+ADDRGP4 uiInfo+240+61768+12
+INDIRF4
+ASGNF4
+LABELV $567
+LABELV $438
+ADDRGP4 $437
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $430
+endproc UI_Asset_Parse 1128 20
+export Font_Report
+proc Font_Report 8 12
+ADDRGP4 $581
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $582
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+LABELV $583
+ADDRGP4 $587
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+240+12+44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $584
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 96
+LTI4 $583
+LABELV $580
+endproc Font_Report 8 12
+export UI_Report
+proc UI_Report 0 0
+ADDRGP4 String_Report
+CALLV
+pop
+LABELV $591
+endproc UI_Report 0 0
+proc UI_ParseMenu 1060 12
+ADDRGP4 $593
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $597
+ADDRGP4 $592
+JUMPV
+LABELV $596
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $599
+ADDRGP4 $598
+JUMPV
+LABELV $599
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $601
+ADDRGP4 $598
+JUMPV
+LABELV $601
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $604
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 UI_Asset_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRGP4 $597
+JUMPV
+LABELV $604
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $613
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $610
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Menu_New
+CALLV
+pop
+LABELV $610
+LABELV $597
+ADDRGP4 $596
+JUMPV
+LABELV $598
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $592
+endproc UI_ParseMenu 1060 12
+proc UI_Load_Menu 1048 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $615
+CNSTI4 0
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $615
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $621
+CNSTI4 0
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $620
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $623
+CNSTI4 0
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $623
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $625
+CNSTI4 0
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $625
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $628
+CNSTI4 1
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $628
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 UI_ParseMenu
+CALLV
+pop
+LABELV $621
+ADDRGP4 $620
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $614
+endproc UI_Load_Menu 1048 8
+proc UI_LoadMenus 1068 8
+ADDRLP4 1048
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $633
+ADDRGP4 $635
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $636
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $637
+ADDRGP4 $639
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $637
+LABELV $633
+ADDRGP4 ui_new+12
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $644
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $646
+ADDRGP4 $645
+JUMPV
+LABELV $646
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $648
+ADDRGP4 $645
+JUMPV
+LABELV $648
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $651
+ADDRGP4 $645
+JUMPV
+LABELV $651
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $654
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 UI_Load_Menu
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $645
+LABELV $654
+LABELV $644
+ADDRGP4 $643
+JUMPV
+LABELV $645
+ADDRLP4 1056
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $632
+endproc UI_LoadMenus 1068 8
+export UI_Load
+proc UI_Load 1052 12
+ADDRLP4 1032
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 1036
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 1044
+INDIRU4
+EQU4 $663
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 1044
+INDIRU4
+EQU4 $663
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $663
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $667
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $665
+LABELV $667
+ADDRLP4 0
+ADDRGP4 $636
+ASGNP4
+LABELV $665
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 $668
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $661
+endproc UI_Load 1052 12
+proc UI_SourceForLAN 4 0
+ADDRLP4 0
+ADDRGP4 ui_netSource+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $670
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $670
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $676
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $676
+address $673
+address $674
+address $674
+address $674
+address $674
+address $674
+address $674
+address $675
+code
+LABELV $670
+LABELV $673
+CNSTI4 0
+RETI4
+ADDRGP4 $669
+JUMPV
+LABELV $674
+CNSTI4 1
+RETI4
+ADDRGP4 $669
+JUMPV
+LABELV $675
+CNSTI4 2
+RETI4
+LABELV $669
+endproc UI_SourceForLAN 4 0
+proc UI_FilterDescription 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $681
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+122836
+INDIRI4
+LEI4 $678
+LABELV $681
+ADDRGP4 $682
+RETP4
+ADDRGP4 $677
+JUMPV
+LABELV $678
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324-8+4
+ADDP4
+INDIRP4
+RETP4
+LABELV $677
+endproc UI_FilterDescription 4 0
+proc UI_FilterDir 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $690
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+122836
+INDIRI4
+LEI4 $687
+LABELV $690
+ADDRGP4 $691
+RETP4
+ADDRGP4 $686
+JUMPV
+LABELV $687
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324-8
+ADDP4
+INDIRP4
+RETP4
+LABELV $686
+endproc UI_FilterDir 4 0
+proc UI_DrawClanName 8 32
+ADDRGP4 $695
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $694
+endproc UI_DrawClanName 8 32
+proc UI_SetCapFragLimits 20 8
+ADDRLP4 8
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $697
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+GTI4 $697
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $709-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $709
+address $703
+address $703
+address $703
+address $704
+address $705
+address $706
+address $707
+address $708
+code
+LABELV $697
+LABELV $703
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $704
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $705
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $706
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $707
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $708
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $698
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRGP4 $713
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $714
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $711
+ADDRGP4 $715
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $716
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $712
+LABELV $696
+endproc UI_SetCapFragLimits 20 8
+proc UI_DrawGameType 4 32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $717
+endproc UI_DrawGameType 4 32
+proc UI_DrawNetGameType 4 32
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $726
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+103200
+INDIRI4
+LEI4 $721
+LABELV $726
+ADDRGP4 $727
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $728
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $721
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $720
+endproc UI_DrawNetGameType 4 32
+proc UI_DrawJoinGameType 4 32
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $737
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRGP4 uiInfo+103332
+INDIRI4
+LEI4 $732
+LABELV $737
+ADDRGP4 $738
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $732
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103336
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $731
+endproc UI_DrawJoinGameType 4 32
+proc UI_TeamIndexFromName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $742
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $742
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $744
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $741
+JUMPV
+LABELV $749
+LABELV $745
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $747
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $744
+LABELV $742
+CNSTI4 0
+RETI4
+LABELV $741
+endproc UI_TeamIndexFromName 12 8
+proc UI_DrawClanLogo 48 20
+ADDRGP4 $695
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $753
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+GEI4 $753
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $756
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 24
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 36
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $756
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $753
+LABELV $752
+endproc UI_DrawClanLogo 48 20
+proc UI_DrawClanCinematic 32 24
+ADDRGP4 $695
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $777
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+GEI4 $777
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+CNSTI4 -2
+LTI4 $780
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $784
+ADDRGP4 $790
+ARGP4
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $784
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $793
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $781
+JUMPV
+LABELV $793
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $781
+LABELV $777
+LABELV $776
+endproc UI_DrawClanCinematic 32 24
+proc UI_DrawPreviewCinematic 16 24
+ADDRGP4 uiInfo+125932
+INDIRI4
+CNSTI4 -2
+LEI4 $808
+ADDRGP4 $790
+ARGP4
+ADDRGP4 uiInfo+125928
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+124900
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+125932
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125932
+INDIRI4
+CNSTI4 0
+LTI4 $814
+ADDRGP4 uiInfo+125932
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+125932
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRGP4 uiInfo+125932
+CNSTI4 -2
+ASGNI4
+LABELV $815
+LABELV $808
+LABELV $807
+endproc UI_DrawPreviewCinematic 16 24
+proc UI_DrawSkill 16 32
+ADDRGP4 $821
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $824
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $822
+LABELV $824
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $822
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $820
+endproc UI_DrawSkill 16 32
+proc UI_DrawTeamName 32 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $830
+ADDRLP4 4
+ADDRGP4 $827
+ASGNP4
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 4
+ADDRGP4 $828
+ASGNP4
+LABELV $831
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $832
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+GEI4 $832
+ADDRGP4 $835
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $840
+ADDRLP4 20
+ADDRGP4 $836
+ASGNP4
+ADDRGP4 $841
+JUMPV
+LABELV $840
+ADDRLP4 20
+ADDRGP4 $837
+ASGNP4
+LABELV $841
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $832
+LABELV $826
+endproc UI_DrawTeamName 32 32
+proc UI_DrawTeamMember 20 32
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $843
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $849
+ADDRLP4 8
+ADDRGP4 $846
+ASGNP4
+ADDRGP4 $850
+JUMPV
+LABELV $849
+ADDRLP4 8
+ADDRGP4 $847
+ASGNP4
+LABELV $850
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $844
+JUMPV
+LABELV $843
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $854
+ADDRLP4 8
+ADDRGP4 $851
+ASGNP4
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 8
+ADDRGP4 $852
+ASGNP4
+LABELV $855
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $844
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $856
+ADDRLP4 4
+ADDRGP4 $858
+ASGNP4
+ADDRGP4 $857
+JUMPV
+LABELV $856
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $859
+ADDRLP4 4
+ADDRGP4 $861
+ASGNP4
+ADDRGP4 $860
+JUMPV
+LABELV $859
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $862
+ADDRLP4 4
+ADDRGP4 $864
+ASGNP4
+ADDRGP4 $863
+JUMPV
+LABELV $862
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+LTI4 $865
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $865
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $863
+LABELV $860
+LABELV $857
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $842
+endproc UI_DrawTeamMember 20 32
+proc UI_DrawNotTeamMember 24 32
+ADDRGP4 $870
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $871
+ADDRLP4 4
+ADDRGP4 $858
+ASGNP4
+ADDRGP4 $872
+JUMPV
+LABELV $871
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $873
+ADDRLP4 4
+ADDRGP4 $861
+ASGNP4
+ADDRGP4 $874
+JUMPV
+LABELV $873
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $875
+ADDRLP4 4
+ADDRGP4 $864
+ASGNP4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $877
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $877
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $876
+LABELV $874
+LABELV $872
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $869
+endproc UI_DrawNotTeamMember 24 32
+proc UI_DrawEffects 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1096810496
+SUBF4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 uiInfo+240+61792
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 uiInfo+163560
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+240+61796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $885
+ADDRLP4 0
+ADDRGP4 uiInfo+240+61796+48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $890
+ADDRLP4 0
+ADDRGP4 uiInfo+98024
+INDIRI4
+ASGNI4
+LABELV $890
+ADDRGP4 uiInfo+163560
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uitogamecode
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_ColorFromIndex
+CALLV
+pop
+ADDRLP4 12+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $885
+ADDRLP4 4
+CNSTF4 1091717413
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+163560
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 20
+CNSTF4 1098907648
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $879
+endproc UI_DrawEffects 28 20
+proc UI_DrawMapPreview 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $900
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $901
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $905
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LEI4 $902
+LABELV $905
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $906
+ADDRGP4 ui_currentNetMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $909
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $907
+JUMPV
+LABELV $906
+ADDRGP4 ui_currentMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $911
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $907
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $902
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $912
+ADDRLP4 12
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+107852+8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $912
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $920
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+ADDRGP4 $921
+JUMPV
+LABELV $920
+ADDRGP4 $926
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+LABELV $921
+LABELV $896
+endproc UI_DrawMapPreview 20 20
+proc UI_DrawMapTimeToBeat 28 32
+ADDRGP4 ui_currentMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $933
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LEI4 $928
+LABELV $933
+ADDRGP4 ui_currentMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $911
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $928
+ADDRLP4 0
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+28
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $941
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $927
+endproc UI_DrawMapTimeToBeat 28 32
+proc UI_DrawMapCinematic 28 24
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $946
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $946
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $947
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $951
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LEI4 $948
+LABELV $951
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRGP4 ui_currentNetMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $909
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $953
+JUMPV
+LABELV $952
+ADDRGP4 ui_currentMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $911
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $953
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $948
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+CNSTI4 -1
+LTI4 $956
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $960
+ADDRGP4 $790
+ARGP4
+ADDRLP4 12
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $960
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $968
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $957
+JUMPV
+LABELV $968
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMapPreview
+CALLV
+pop
+LABELV $957
+LABELV $942
+endproc UI_DrawMapCinematic 28 24
+data
+align 4
+LABELV updateModel
+byte 4 1
+align 4
+LABELV q3Model
+byte 4 0
+align 4
+LABELV updateModelColor
+byte 4 1
+bss
+align 4
+LABELV $979
+skip 5692
+code
+proc UI_DrawPlayerModel 604 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $982
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 588
+INDIRF4
+CNSTF4 0
+EQF4 $980
+ADDRGP4 $983
+ARGP4
+ADDRLP4 592
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 592
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $984
+ARGP4
+ADDRLP4 596
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 596
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+NEI4 $985
+ADDRLP4 600
+CNSTI4 1
+ASGNI4
+ADDRGP4 q3Model
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 600
+INDIRI4
+ASGNI4
+LABELV $985
+ADDRLP4 320
+CNSTI1 0
+ASGNI1
+ADDRGP4 $981
+JUMPV
+LABELV $980
+ADDRGP4 $695
+ARGP4
+ADDRLP4 592
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 592
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $987
+ARGP4
+ADDRLP4 596
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 596
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $988
+ARGP4
+ADDRLP4 600
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 600
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+EQI4 $989
+ADDRGP4 q3Model
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+LABELV $989
+LABELV $981
+ADDRGP4 updateModel
+INDIRI4
+CNSTI4 0
+EQI4 $991
+ADDRGP4 $979
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5692
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 576+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 592
+CNSTF4 0
+ASGNF4
+ADDRLP4 576
+ADDRLP4 592
+INDIRF4
+ASGNF4
+ADDRLP4 576+8
+ADDRLP4 592
+INDIRF4
+ASGNF4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $979
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 576
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 updateModelColor
+ADDRLP4 596
+INDIRI4
+ASGNI4
+LABELV $991
+ADDRGP4 updateModelColor
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRGP4 $979
+ARGP4
+ADDRGP4 UI_PlayerInfo_UpdateColor
+CALLV
+pop
+ADDRGP4 updateModelColor
+CNSTI4 0
+ASGNI4
+LABELV $995
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $979
+ARGP4
+CNSTF4 1056964608
+ADDRGP4 uiInfo+220
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $978
+endproc UI_DrawPlayerModel 604 28
+proc UI_DrawNetSource 8 32
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+LTI4 $1003
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $999
+LABELV $1003
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+LABELV $999
+ADDRGP4 $1005
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $998
+endproc UI_DrawNetSource 8 32
+proc UI_DrawNetMapPreview 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+125936+10428
+INDIRI4
+CNSTI4 0
+LEI4 $1008
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+125936+10428
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRGP4 $926
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+LABELV $1009
+LABELV $1007
+endproc UI_DrawNetMapPreview 8 20
+proc UI_DrawNetMapCinematic 4 20
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $1020
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LEI4 $1015
+LABELV $1020
+ADDRGP4 ui_currentNetMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $909
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1015
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+CNSTI4 0
+LTI4 $1022
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $1023
+JUMPV
+LABELV $1022
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapPreview
+CALLV
+pop
+LABELV $1023
+LABELV $1014
+endproc UI_DrawNetMapCinematic 4 20
+proc UI_DrawNetFilter 12 32
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 UI_FilterDescription
+CALLP4
+ASGNP4
+ADDRGP4 $1031
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1030
+endproc UI_DrawNetFilter 12 32
+proc UI_DrawTier 20 32
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1038
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+121676
+INDIRI4
+LTI4 $1035
+LABELV $1038
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1035
+ADDRGP4 $1039
+ARGP4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+121680
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1033
+endproc UI_DrawTier 20 32
+proc UI_DrawTierMap 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1045
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+121676
+INDIRI4
+LTI4 $1042
+LABELV $1045
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1042
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+121680+28
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1046
+ADDRGP4 $1052
+ARGP4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+121680+4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+121680+28
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1046
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+121680+28
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+LABELV $1041
+endproc UI_DrawTierMap 28 20
+proc UI_EnglishMapName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1061
+JUMPV
+LABELV $1058
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1063
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1057
+JUMPV
+LABELV $1063
+LABELV $1059
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1061
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LTI4 $1058
+ADDRGP4 $691
+RETP4
+LABELV $1057
+endproc UI_EnglishMapName 8 8
+proc UI_DrawTierMapName 32 32
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1072
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+121676
+INDIRI4
+LTI4 $1069
+LABELV $1072
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1069
+ADDRGP4 $911
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1075
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $1073
+LABELV $1075
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1073
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+121680+4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_EnglishMapName
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1068
+endproc UI_DrawTierMapName 32 32
+proc UI_DrawTierGameType 28 32
+ADDRGP4 $1034
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1082
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+121676
+INDIRI4
+LTI4 $1079
+LABELV $1082
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1079
+ADDRGP4 $911
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1085
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $1083
+LABELV $1085
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1083
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+121680+16
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1078
+endproc UI_DrawTierGameType 28 32
+proc UI_AIFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1090
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1095
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612+4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1089
+JUMPV
+LABELV $1095
+LABELV $1091
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1093
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+LTI4 $1090
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1103
+JUMPV
+LABELV $1100
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1105
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1089
+JUMPV
+LABELV $1105
+LABELV $1101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1103
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+LTI4 $1100
+ADDRGP4 $1109
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $1089
+endproc UI_AIFromName 8 8
+data
+align 4
+LABELV updateOpponentModel
+byte 4 1
+bss
+align 4
+LABELV $1111
+skip 5692
+code
+proc UI_DrawOpponent 408 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 updateOpponentModel
+INDIRI4
+CNSTI4 0
+EQI4 $1112
+ADDRGP4 $1114
+ARGP4
+ADDRLP4 396
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1114
+ARGP4
+ADDRLP4 400
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 400
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 140
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1111
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5692
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 128+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 404
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ADDRLP4 404
+INDIRF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 404
+INDIRF4
+ASGNF4
+ADDRGP4 $1111
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1111
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 $1111
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 0
+ASGNI4
+LABELV $1112
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1111
+ARGP4
+CNSTF4 1056964608
+ADDRGP4 uiInfo+220
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $1110
+endproc UI_DrawOpponent 408 28
+proc UI_NextOpponent 24 8
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $1120
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1120
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $1125
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1125
+LABELV $1123
+ADDRGP4 $1119
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1118
+endproc UI_NextOpponent 24 8
+proc UI_PriorOpponent 24 8
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1130
+ADDRLP4 0
+ADDRGP4 uiInfo+100380
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1130
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1133
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1135
+ADDRLP4 0
+ADDRGP4 uiInfo+100380
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1135
+LABELV $1133
+ADDRGP4 $1119
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1129
+endproc UI_PriorOpponent 24 8
+proc UI_DrawPlayerLogo 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1140
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1140
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1139
+endproc UI_DrawPlayerLogo 44 20
+proc UI_DrawPlayerLogoMetal 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1159
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1159
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1158
+endproc UI_DrawPlayerLogoMetal 44 20
+proc UI_DrawPlayerLogoName 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $695
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1178
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1178
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1177
+endproc UI_DrawPlayerLogoName 44 20
+proc UI_DrawOpponentLogo 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1197
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1197
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1196
+endproc UI_DrawOpponentLogo 44 20
+proc UI_DrawOpponentLogoMetal 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1216
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1216
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1215
+endproc UI_DrawOpponentLogoMetal 44 20
+proc UI_DrawOpponentLogoName 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1235
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1235
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1234
+endproc UI_DrawOpponentLogoName 44 20
+proc UI_DrawAllMapsSelection 16 32
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1257
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1258
+JUMPV
+LABELV $1257
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $1258
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1259
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+GEI4 $1259
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1259
+LABELV $1253
+endproc UI_DrawAllMapsSelection 16 32
+proc UI_DrawOpponentName 8 32
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1263
+endproc UI_DrawOpponentName 8 32
+proc UI_OwnerDrawWidth 100 12
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 203
+LTI4 $1266
+ADDRLP4 16
+INDIRI4
+CNSTI4 268
+GTI4 $1266
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1343-812
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1343
+address $1267
+address $1266
+address $1268
+address $1266
+address $1271
+address $1276
+address $1281
+address $1286
+address $1286
+address $1286
+address $1286
+address $1286
+address $1286
+address $1286
+address $1299
+address $1299
+address $1299
+address $1299
+address $1299
+address $1299
+address $1299
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1311
+address $1320
+address $1266
+address $1328
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1266
+address $1340
+address $1266
+address $1266
+address $1335
+code
+LABELV $1267
+ADDRGP4 $695
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1268
+ADDRLP4 0
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1271
+ADDRGP4 $821
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $1274
+ADDRLP4 28
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $1272
+LABELV $1274
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $1272
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1276
+ADDRGP4 $827
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $1266
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+GEI4 $1266
+ADDRGP4 $835
+ARGP4
+ADDRGP4 $836
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1281
+ADDRGP4 $828
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $1266
+ADDRLP4 52
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+GEI4 $1266
+ADDRGP4 $835
+ARGP4
+ADDRGP4 $837
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1286
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $1287
+ADDRGP4 $846
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1288
+JUMPV
+LABELV $1287
+ADDRGP4 $851
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1288
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1290
+ADDRLP4 12
+ADDRGP4 $858
+ASGNP4
+ADDRGP4 $1291
+JUMPV
+LABELV $1290
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1292
+ADDRLP4 12
+ADDRGP4 $861
+ASGNP4
+ADDRGP4 $1293
+JUMPV
+LABELV $1292
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+LTI4 $1294
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1294
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1293
+LABELV $1291
+ADDRGP4 $1298
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1299
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $1300
+ADDRGP4 $847
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 217
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1301
+JUMPV
+LABELV $1300
+ADDRGP4 $852
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 217
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1301
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1303
+ADDRLP4 12
+ADDRGP4 $858
+ASGNP4
+ADDRGP4 $1304
+JUMPV
+LABELV $1303
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1305
+ADDRLP4 12
+ADDRGP4 $861
+ASGNP4
+ADDRGP4 $1306
+JUMPV
+LABELV $1305
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+LTI4 $1307
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1307
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1306
+LABELV $1304
+ADDRGP4 $1298
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 217
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1311
+ADDRGP4 $870
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 224
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1312
+ADDRLP4 12
+ADDRGP4 $858
+ASGNP4
+ADDRGP4 $1313
+JUMPV
+LABELV $1312
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1314
+ADDRLP4 12
+ADDRGP4 $861
+ASGNP4
+ADDRGP4 $1315
+JUMPV
+LABELV $1314
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+LTI4 $1316
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1316
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1315
+LABELV $1313
+ADDRGP4 $1298
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 224
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1320
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+LTI4 $1325
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $1321
+LABELV $1325
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+LABELV $1321
+ADDRGP4 $1005
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1328
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 UI_FilterDescription
+CALLP4
+ASGNP4
+ADDRGP4 $1031
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1335
+ADDRLP4 88
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $1336
+ADDRLP4 0
+ADDRGP4 $1338
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1336
+ADDRLP4 0
+ADDRGP4 $1339
+ASGNP4
+ADDRGP4 $1266
+JUMPV
+LABELV $1340
+ADDRGP4 $1341
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+LABELV $1266
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1345
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1264
+JUMPV
+LABELV $1345
+CNSTI4 0
+RETI4
+LABELV $1264
+endproc UI_OwnerDrawWidth 100 12
+proc UI_DrawBotName 20 32
+ADDRLP4 4
+ADDRGP4 uiInfo+98068
+INDIRI4
+ASGNI4
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 $691
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1350
+ADDRLP4 0
+ADDRGP4 $864
+ASGNP4
+ADDRGP4 $1351
+JUMPV
+LABELV $1350
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LEI4 $1352
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072-24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1353
+JUMPV
+LABELV $1352
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $1353
+LABELV $1351
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1347
+endproc UI_DrawBotName 20 32
+proc UI_DrawBotSkill 4 32
+ADDRGP4 uiInfo+122320
+INDIRI4
+CNSTI4 0
+LTI4 $1357
+ADDRGP4 uiInfo+122320
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+GEI4 $1357
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+122320
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1357
+LABELV $1356
+endproc UI_DrawBotSkill 4 32
+proc UI_DrawRedBlue 8 32
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+103464
+INDIRI4
+CNSTI4 0
+NEI4 $1365
+ADDRLP4 0
+ADDRGP4 $837
+ASGNP4
+ADDRGP4 $1366
+JUMPV
+LABELV $1365
+ADDRLP4 0
+ADDRGP4 $836
+ASGNP4
+LABELV $1366
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1362
+endproc UI_DrawRedBlue 8 32
+proc UI_DrawCrosshair 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+146132
+INDIRI4
+CNSTI4 0
+NEI4 $1368
+ADDRGP4 $1367
+JUMPV
+LABELV $1368
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+146132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+240+61848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1367
+endproc UI_DrawCrosshair 8 20
+proc UI_BuildPlayerList 4180 12
+ADDRLP4 1040
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 1040+8
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRGP4 uiInfo+103488
+ADDRLP4 1040+8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1379
+ARGP4
+ADDRLP4 4128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4128
+INDIRP4
+ARGP4
+ADDRLP4 4132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+103492
+ADDRLP4 4132
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1380
+ARGP4
+ADDRLP4 4136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4136
+INDIRP4
+ARGP4
+ADDRLP4 4140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1381
+ARGP4
+ADDRLP4 4144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4144
+INDIRP4
+ARGP4
+ADDRLP4 4148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 4148
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+103468
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+103472
+CNSTI4 0
+ASGNI4
+ADDRLP4 4152
+CNSTI4 0
+ASGNI4
+ADDRLP4 4124
+ADDRLP4 4152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4152
+INDIRI4
+ASGNI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1384
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1388
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1392
+ARGP4
+ADDRLP4 4156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+103468
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+103496
+ADDP4
+ARGP4
+ADDRLP4 4156
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+103468
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+103496
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4160
+ADDRGP4 uiInfo+103468
+ASGNP4
+ADDRLP4 4160
+INDIRP4
+ADDRLP4 4160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1380
+ARGP4
+ADDRLP4 4164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4164
+INDIRP4
+ARGP4
+ADDRLP4 4168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 4168
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+NEI4 $1396
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1392
+ARGP4
+ADDRLP4 4172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+103472
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+105544
+ADDP4
+ARGP4
+ADDRLP4 4172
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+103472
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+105544
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+103472
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+103488
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1404
+ADDRLP4 4124
+ADDRGP4 uiInfo+103472
+INDIRI4
+ASGNI4
+LABELV $1404
+ADDRLP4 4176
+ADDRGP4 uiInfo+103472
+ASGNP4
+ADDRLP4 4176
+INDIRP4
+ADDRLP4 4176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1396
+LABELV $1388
+LABELV $1385
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1387
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1384
+ADDRGP4 uiInfo+103492
+INDIRI4
+CNSTI4 0
+NEI4 $1409
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 4124
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1409
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 4156
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4156
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1416
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+LEI4 $1413
+LABELV $1416
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1413
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $1417
+ADDRGP4 $1420
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+105544
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1417
+LABELV $1374
+endproc UI_BuildPlayerList 4180 12
+proc UI_DrawSelectedPlayer 16 32
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRGP4 uiInfo+103480
+INDIRI4
+LEI4 $1423
+ADDRGP4 uiInfo+103480
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $1423
+ADDRGP4 uiInfo+103492
+INDIRI4
+CNSTI4 0
+EQI4 $1432
+ADDRGP4 $1420
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1433
+JUMPV
+LABELV $1432
+ADDRGP4 $1430
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $1433
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1422
+endproc UI_DrawSelectedPlayer 16 32
+proc UI_DrawServerRefreshDate 124 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+125936+2212
+INDIRI4
+CNSTI4 0
+EQI4 $1435
+ADDRLP4 96
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 64
+ADDRLP4 96
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1061997773
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+12
+CNSTF4 1061997773
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+220
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 104
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRLP4 108
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 $1443
+ARGP4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 80
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $1436
+JUMPV
+LABELV $1435
+ADDRGP4 $1341
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1445
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1436
+LABELV $1434
+endproc UI_DrawServerRefreshDate 124 32
+proc UI_DrawServerMOTD 56 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 uiInfo+125936+10444
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+LEF4 $1450
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1451
+JUMPV
+LABELV $1450
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1451
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 uiInfo+220
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+125936+10440
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+125936+10436
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRGP4 uiInfo+125936+10436
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 UI_ClearClipRegion
+CALLV
+pop
+ADDRLP4 48
+ADDRGP4 uiInfo+125936+10436
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1462
+JUMPV
+LABELV $1461
+ADDRLP4 52
+ADDRGP4 uiInfo+125936+10436
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1462
+ADDRGP4 uiInfo+125936+10436
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $1461
+ADDRGP4 uiInfo+125936+10440
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1446
+endproc UI_DrawServerMOTD 56 32
+proc UI_DrawKeyBindStatus 8 32
+ADDRLP4 0
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1471
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1338
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $1472
+JUMPV
+LABELV $1471
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1339
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1472
+LABELV $1470
+endproc UI_DrawKeyBindStatus 8 32
+proc UI_DrawGLInfo 1336 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1474
+ARGP4
+ADDRGP4 uiInfo+62108+1024
+ARGP4
+ADDRLP4 1296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $1477
+ARGP4
+ADDRGP4 uiInfo+62108+2048
+ARGP4
+ADDRGP4 uiInfo+62108
+ARGP4
+ADDRLP4 1304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $1481
+ARGP4
+ADDRGP4 uiInfo+62108+35848
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+62108+35852
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+62108+35856
+INDIRI4
+ARGI4
+ADDRLP4 1312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 uiInfo+62108+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 272
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1491
+JUMPV
+LABELV $1493
+ADDRLP4 1320
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1320
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1494
+ADDRLP4 1320
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+EQI4 $1496
+ADDRLP4 1320
+INDIRI4
+CNSTI4 32
+EQI4 $1493
+LABELV $1496
+ADDRLP4 1324
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+EQI4 $1500
+ADDRLP4 1324
+INDIRI4
+CNSTI4 32
+EQI4 $1500
+ADDRLP4 1328
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1328
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1500
+JUMPV
+LABELV $1499
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1500
+ADDRLP4 1328
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+EQI4 $1502
+ADDRLP4 1328
+INDIRI4
+CNSTI4 32
+NEI4 $1499
+LABELV $1502
+LABELV $1491
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $1503
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1494
+LABELV $1503
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1505
+JUMPV
+LABELV $1504
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1324
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $1507
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1328
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1507
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1093664768
+SUBF4
+LEF4 $1509
+ADDRGP4 $1506
+JUMPV
+LABELV $1509
+LABELV $1505
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1504
+LABELV $1506
+LABELV $1473
+endproc UI_DrawGLInfo 1336 32
+proc UI_OwnerDraw 24 24
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 201
+LTI4 $1516
+ADDRLP4 16
+INDIRI4
+CNSTI4 274
+GTI4 $1516
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1565-804
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1565
+address $1517
+address $1518
+address $1519
+address $1520
+address $1523
+address $1526
+address $1530
+address $1531
+address $1532
+address $1533
+address $1533
+address $1533
+address $1533
+address $1533
+address $1533
+address $1533
+address $1534
+address $1534
+address $1534
+address $1534
+address $1534
+address $1534
+address $1534
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1535
+address $1536
+address $1537
+address $1539
+address $1540
+address $1541
+address $1542
+address $1543
+address $1544
+address $1545
+address $1548
+address $1546
+address $1549
+address $1547
+address $1550
+address $1551
+address $1552
+address $1553
+address $1555
+address $1516
+address $1556
+address $1557
+address $1558
+address $1559
+address $1560
+address $1528
+address $1524
+address $1538
+address $1561
+address $1562
+address $1563
+address $1564
+address $1521
+address $1527
+address $1525
+address $1522
+address $1529
+address $1554
+code
+LABELV $1517
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawEffects
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1518
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawPlayerModel
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1519
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawClanName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1520
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawClanLogo
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1521
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawClanCinematic
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1522
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPreviewCinematic
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1523
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawGameType
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1524
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetGameType
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1525
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawJoinGameType
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1526
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawMapPreview
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1527
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMapTimeToBeat
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1528
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawMapCinematic
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1529
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawMapCinematic
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1530
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawSkill
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1531
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1532
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1533
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 210
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamMember
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1534
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 217
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamMember
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1535
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+CNSTI4 224
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNotTeamMember
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1536
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetSource
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1537
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapPreview
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1538
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapCinematic
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1539
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetFilter
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1540
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTier
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1541
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawOpponent
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1542
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1543
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1544
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1545
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogo
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1546
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogoMetal
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1547
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogoName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1548
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogo
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1549
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogoMetal
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1550
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogoName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1551
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTierMapName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1552
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTierGameType
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1553
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawAllMapsSelection
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1554
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawAllMapsSelection
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1555
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawOpponentName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1556
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBotName
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1557
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBotSkill
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1558
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawRedBlue
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1559
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawCrosshair
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1560
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawSelectedPlayer
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1561
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawServerRefreshDate
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1562
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawServerMOTD
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1563
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawGLInfo
+CALLV
+pop
+ADDRGP4 $1516
+JUMPV
+LABELV $1564
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawKeyBindStatus
+CALLV
+pop
+LABELV $1516
+LABELV $1511
+endproc UI_OwnerDraw 24 24
+proc UI_OwnerDrawVisible 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1569
+JUMPV
+LABELV $1568
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1571
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1573
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1573
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $1571
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1575
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1577
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1577
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $1575
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1579
+ADDRGP4 uiInfo+103492
+INDIRI4
+CNSTI4 0
+NEI4 $1581
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1582
+JUMPV
+LABELV $1581
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $1584
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+103488
+INDIRI4
+NEI4 $1584
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1584
+LABELV $1582
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $1579
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1591
+ADDRGP4 uiInfo+103492
+INDIRI4
+CNSTI4 0
+EQI4 $1593
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $1603
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+103488
+INDIRI4
+EQI4 $1596
+LABELV $1603
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1596
+LABELV $1593
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $1591
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1604
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+EQI4 $1606
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1606
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+LABELV $1604
+ADDRFP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1609
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $1611
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1611
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $1609
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1614
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+CNSTI4 4
+GEI4 $1616
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1616
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $1614
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1621
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $1623
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1623
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+LABELV $1621
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1628
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+CNSTI4 4
+GEI4 $1630
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1630
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+LABELV $1628
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1635
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $1637
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1637
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+LABELV $1635
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1642
+ADDRGP4 uiInfo+98040
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+GEI4 $1644
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1645
+JUMPV
+LABELV $1644
+ADDRGP4 uiInfo+98060
+INDIRI4
+CNSTI4 0
+EQI4 $1648
+ADDRGP4 $1653
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $1651
+ADDRGP4 uiInfo+146140
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 uiInfo+98060
+CNSTI4 0
+ASGNI4
+LABELV $1651
+LABELV $1648
+LABELV $1645
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $1642
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1656
+ADDRGP4 uiInfo+98044
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+GEI4 $1658
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1658
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $1656
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1662
+ADDRGP4 uiInfo+98056
+INDIRI4
+CNSTI4 0
+NEI4 $1664
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1664
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $1663
+JUMPV
+LABELV $1662
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1663
+LABELV $1569
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1568
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1567
+endproc UI_OwnerDrawVisible 8 8
+proc UI_Effects_HandleKey 16 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1668
+ADDRLP4 8
+ADDRGP4 uiInfo+163560
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+163560
+INDIRI4
+CNSTI4 12
+LEI4 $1671
+ADDRGP4 uiInfo+163560
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+ADDRGP4 uiInfo+163560
+INDIRI4
+CNSTI4 0
+GEI4 $1675
+ADDRGP4 uiInfo+163560
+CNSTI4 12
+ASGNI4
+LABELV $1675
+LABELV $1672
+ADDRGP4 $1679
+ARGP4
+ADDRGP4 uiInfo+163560
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uitogamecode
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 updateModelColor
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1667
+JUMPV
+LABELV $1668
+CNSTI4 0
+RETI4
+LABELV $1667
+endproc UI_Effects_HandleKey 16 8
+proc UI_ClanName_HandleKey 24 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1682
+ADDRGP4 $695
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1684
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1684
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $1692
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1693
+JUMPV
+LABELV $1692
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1695
+ADDRLP4 8
+ADDRGP4 uiInfo+100380
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1695
+LABELV $1693
+ADDRGP4 $695
+ARGP4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_HeadCountByTeam
+CALLI4
+pop
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1681
+JUMPV
+LABELV $1682
+CNSTI4 0
+RETI4
+LABELV $1681
+endproc UI_ClanName_HandleKey 24 8
+proc UI_GameType_HandleKey 24 16
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1700
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1702
+ADDRLP4 16
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 2
+NEI4 $1705
+ADDRGP4 ui_gameType+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1703
+JUMPV
+LABELV $1705
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 2
+GEI4 $1703
+ADDRGP4 ui_gameType+12
+ADDRGP4 uiInfo+103200
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1703
+JUMPV
+LABELV $1702
+ADDRLP4 16
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRGP4 uiInfo+103200
+INDIRI4
+LTI4 $1715
+ADDRGP4 ui_gameType+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1716
+JUMPV
+LABELV $1715
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 2
+NEI4 $1720
+ADDRGP4 ui_gameType+12
+CNSTI4 3
+ASGNI4
+LABELV $1720
+LABELV $1716
+LABELV $1703
+ADDRLP4 16
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1724
+ADDRGP4 $982
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1725
+JUMPV
+LABELV $1724
+ADDRGP4 $982
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1725
+ADDRGP4 $1729
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1737
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1737
+ADDRGP4 $911
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $1737
+CNSTI4 1
+RETI4
+ADDRGP4 $1699
+JUMPV
+LABELV $1700
+CNSTI4 0
+RETI4
+LABELV $1699
+endproc UI_GameType_HandleKey 24 16
+proc UI_NetGameType_HandleKey 12 16
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1740
+ADDRLP4 8
+ADDRGP4 ui_netGameType+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $1743
+ADDRGP4 ui_netGameType+12
+ADDRGP4 uiInfo+103200
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1744
+JUMPV
+LABELV $1743
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+103200
+INDIRI4
+LTI4 $1748
+ADDRGP4 ui_netGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $1748
+LABELV $1744
+ADDRGP4 $727
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1754
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $909
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1739
+JUMPV
+LABELV $1740
+CNSTI4 0
+RETI4
+LABELV $1739
+endproc UI_NetGameType_HandleKey 12 16
+proc UI_JoinGameType_HandleKey 12 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1759
+ADDRLP4 8
+ADDRGP4 ui_joinGameType+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $1762
+ADDRGP4 ui_joinGameType+12
+ADDRGP4 uiInfo+103332
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1763
+JUMPV
+LABELV $1762
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRGP4 uiInfo+103332
+INDIRI4
+LTI4 $1767
+ADDRGP4 ui_joinGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $1767
+LABELV $1763
+ADDRGP4 $738
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1758
+JUMPV
+LABELV $1759
+CNSTI4 0
+RETI4
+LABELV $1758
+endproc UI_JoinGameType_HandleKey 12 8
+proc UI_Skill_HandleKey 16 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1774
+ADDRGP4 $821
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+GEI4 $1776
+ADDRLP4 0
+ADDRGP4 numSkillLevels
+INDIRI4
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1776
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $1778
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1778
+LABELV $1777
+ADDRGP4 $821
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1773
+JUMPV
+LABELV $1774
+CNSTI4 0
+RETI4
+LABELV $1773
+endproc UI_Skill_HandleKey 16 8
+proc UI_TeamName_HandleKey 28 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1781
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1784
+ADDRLP4 12
+ADDRGP4 $827
+ASGNP4
+ADDRGP4 $1785
+JUMPV
+LABELV $1784
+ADDRLP4 12
+ADDRGP4 $828
+ASGNP4
+LABELV $1785
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $1786
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1787
+JUMPV
+LABELV $1786
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1789
+ADDRLP4 0
+ADDRGP4 uiInfo+100380
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1789
+LABELV $1787
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1794
+ADDRLP4 24
+ADDRGP4 $827
+ASGNP4
+ADDRGP4 $1795
+JUMPV
+LABELV $1794
+ADDRLP4 24
+ADDRGP4 $828
+ASGNP4
+LABELV $1795
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1780
+JUMPV
+LABELV $1781
+CNSTI4 0
+RETI4
+LABELV $1780
+endproc UI_TeamName_HandleKey 28 8
+proc UI_TeamMember_HandleKey 24 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1797
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $1799
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1803
+ADDRLP4 16
+ADDRGP4 $846
+ASGNP4
+ADDRGP4 $1804
+JUMPV
+LABELV $1803
+ADDRLP4 16
+ADDRGP4 $847
+ASGNP4
+LABELV $1804
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $1800
+JUMPV
+LABELV $1799
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1806
+ADDRLP4 16
+ADDRGP4 $851
+ASGNP4
+ADDRGP4 $1807
+JUMPV
+LABELV $1806
+ADDRLP4 16
+ADDRGP4 $852
+ASGNP4
+LABELV $1807
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $1800
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $1808
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1809
+JUMPV
+LABELV $1808
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1811
+ADDRLP4 0
+ADDRGP4 uiInfo+98064
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1811
+LABELV $1809
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1796
+JUMPV
+LABELV $1797
+CNSTI4 0
+RETI4
+LABELV $1796
+endproc UI_TeamMember_HandleKey 24 8
+proc UI_NotTeamMember_HandleKey 32 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1815
+ADDRGP4 $870
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $1817
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1818
+JUMPV
+LABELV $1817
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1819
+ADDRLP4 28
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1819
+LABELV $1818
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1814
+JUMPV
+LABELV $1815
+CNSTI4 0
+RETI4
+LABELV $1814
+endproc UI_NotTeamMember_HandleKey 32 8
+proc UI_NetSource_HandleKey 32 16
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1823
+ADDRLP4 24
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LTI4 $1826
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+GTI4 $1826
+ADDRGP4 $1831
+JUMPV
+LABELV $1830
+ADDRLP4 2
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $1835
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 2
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1837
+ADDRGP4 $1832
+JUMPV
+LABELV $1837
+ADDRLP4 28
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1831
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LTI4 $1840
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+LEI4 $1830
+LABELV $1840
+LABELV $1832
+LABELV $1826
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $1841
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1842
+JUMPV
+LABELV $1841
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+GEI4 $1845
+ADDRGP4 ui_netSource+12
+ADDRGP4 numNetSources
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1845
+LABELV $1842
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRGP4 $1849
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1821
+JUMPV
+LABELV $1823
+CNSTI4 0
+RETI4
+LABELV $1821
+endproc UI_NetSource_HandleKey 32 16
+proc UI_NetFilter_HandleKey 12 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1852
+ADDRLP4 8
+ADDRGP4 ui_serverFilterType+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ADDRGP4 uiInfo+122836
+INDIRI4
+LEI4 $1855
+ADDRGP4 ui_serverFilterType+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1856
+JUMPV
+LABELV $1855
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+GEI4 $1860
+ADDRGP4 ui_serverFilterType+12
+ADDRGP4 uiInfo+122836
+INDIRI4
+ASGNI4
+LABELV $1860
+LABELV $1856
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1851
+JUMPV
+LABELV $1852
+CNSTI4 0
+RETI4
+LABELV $1851
+endproc UI_NetFilter_HandleKey 12 4
+proc UI_OpponentName_HandleKey 8 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1866
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1868
+ADDRGP4 UI_PriorOpponent
+CALLV
+pop
+ADDRGP4 $1869
+JUMPV
+LABELV $1868
+ADDRGP4 UI_NextOpponent
+CALLV
+pop
+LABELV $1869
+CNSTI4 1
+RETI4
+ADDRGP4 $1865
+JUMPV
+LABELV $1866
+CNSTI4 0
+RETI4
+LABELV $1865
+endproc UI_OpponentName_HandleKey 8 4
+proc UI_BotName_HandleKey 32 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1871
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiInfo+98068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LEI4 $1874
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $1876
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1875
+JUMPV
+LABELV $1876
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1875
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiInfo+98064
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1875
+JUMPV
+LABELV $1874
+ADDRLP4 20
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $1882
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1883
+JUMPV
+LABELV $1882
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1884
+ADDRLP4 24
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1884
+LABELV $1883
+LABELV $1875
+ADDRGP4 uiInfo+98068
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1870
+JUMPV
+LABELV $1871
+CNSTI4 0
+RETI4
+LABELV $1870
+endproc UI_BotName_HandleKey 32 4
+proc UI_BotSkill_HandleKey 12 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1888
+ADDRLP4 8
+ADDRGP4 uiInfo+122320
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+122320
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LTI4 $1891
+ADDRGP4 uiInfo+122320
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1892
+JUMPV
+LABELV $1891
+ADDRGP4 uiInfo+122320
+INDIRI4
+CNSTI4 0
+GEI4 $1895
+ADDRGP4 uiInfo+122320
+ADDRGP4 numSkillLevels
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1895
+LABELV $1892
+CNSTI4 1
+RETI4
+ADDRGP4 $1887
+JUMPV
+LABELV $1888
+CNSTI4 0
+RETI4
+LABELV $1887
+endproc UI_BotSkill_HandleKey 12 4
+proc UI_RedBlue_HandleKey 12 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1900
+ADDRLP4 8
+ADDRGP4 uiInfo+103464
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1899
+JUMPV
+LABELV $1900
+CNSTI4 0
+RETI4
+LABELV $1899
+endproc UI_RedBlue_HandleKey 12 4
+proc UI_Crosshair_HandleKey 12 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1904
+ADDRLP4 8
+ADDRGP4 uiInfo+146132
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+146132
+INDIRI4
+CNSTI4 5
+LTI4 $1907
+ADDRGP4 uiInfo+146132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1908
+JUMPV
+LABELV $1907
+ADDRGP4 uiInfo+146132
+INDIRI4
+CNSTI4 0
+GEI4 $1911
+ADDRGP4 uiInfo+146132
+CNSTI4 4
+ASGNI4
+LABELV $1911
+LABELV $1908
+ADDRGP4 $1915
+ARGP4
+ADDRGP4 uiInfo+146132
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1903
+JUMPV
+LABELV $1904
+CNSTI4 0
+RETI4
+LABELV $1903
+endproc UI_Crosshair_HandleKey 12 8
+proc UI_SelectedPlayer_HandleKey 16 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1918
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+ADDRGP4 uiInfo+103492
+INDIRI4
+CNSTI4 0
+NEI4 $1920
+CNSTI4 0
+RETI4
+ADDRGP4 $1917
+JUMPV
+LABELV $1920
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+LEI4 $1923
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1924
+JUMPV
+LABELV $1923
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1926
+ADDRLP4 0
+ADDRGP4 uiInfo+103472
+INDIRI4
+ASGNI4
+LABELV $1926
+LABELV $1924
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+NEI4 $1929
+ADDRGP4 $1420
+ARGP4
+ADDRGP4 $1932
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1930
+JUMPV
+LABELV $1929
+ADDRGP4 $1420
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+105544
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1930
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1918
+CNSTI4 0
+RETI4
+LABELV $1917
+endproc UI_SelectedPlayer_HandleKey 16 8
+proc UI_OwnerDrawHandleKey 48 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 201
+LTI4 $1936
+ADDRLP4 0
+INDIRI4
+CNSTI4 271
+GTI4 $1936
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1956-804
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1956
+address $1937
+address $1936
+address $1938
+address $1936
+address $1939
+address $1936
+address $1942
+address $1943
+address $1944
+address $1945
+address $1945
+address $1945
+address $1945
+address $1945
+address $1945
+address $1945
+address $1946
+address $1946
+address $1946
+address $1946
+address $1946
+address $1946
+address $1946
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1947
+address $1948
+address $1936
+address $1949
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1950
+address $1936
+address $1951
+address $1952
+address $1953
+address $1954
+address $1955
+address $1936
+address $1940
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1936
+address $1941
+code
+LABELV $1937
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Effects_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1938
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_ClanName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1939
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1940
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_NetGameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1941
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_JoinGameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1942
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_Skill_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1943
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_TeamName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1944
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_TeamName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1945
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 UI_TeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1946
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 217
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 UI_TeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1947
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 224
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 UI_NotTeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1948
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_NetSource_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1949
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_NetFilter_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1950
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_OpponentName_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1951
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 UI_BotName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1952
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_BotSkill_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1953
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_RedBlue_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1954
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Crosshair_HandleKey
+CALLI4
+pop
+ADDRGP4 $1936
+JUMPV
+LABELV $1955
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_SelectedPlayer_HandleKey
+CALLI4
+pop
+LABELV $1936
+CNSTI4 0
+RETI4
+LABELV $1934
+endproc UI_OwnerDrawHandleKey 48 20
+proc UI_GetValue 0 0
+CNSTF4 0
+RETF4
+LABELV $1958
+endproc UI_GetValue 0 0
+proc UI_ServersQsortCompare 8 20
+ADDRLP4 0
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2200
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2204
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_CompareServers
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1959
+endproc UI_ServersQsortCompare 8 20
+proc UI_ServersSort 0 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1965
+ADDRGP4 uiInfo+125936+2200
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1967
+ADDRGP4 $1964
+JUMPV
+LABELV $1967
+LABELV $1965
+ADDRGP4 uiInfo+125936+2200
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125936+2220
+ARGP4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 UI_ServersQsortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $1964
+endproc UI_ServersSort 0 16
+proc UI_LoadMods 2096 16
+ADDRGP4 uiInfo+122836
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1981
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 2068
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 2068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1985
+JUMPV
+LABELV $1982
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 2072
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2080
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+122836
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+122836
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324+4
+ADDP4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 2088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 2088
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2092
+ADDRGP4 uiInfo+122836
+ASGNP4
+ADDRLP4 2092
+INDIRP4
+ADDRLP4 2092
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+122836
+INDIRI4
+CNSTI4 64
+LTI4 $1992
+ADDRGP4 $1984
+JUMPV
+LABELV $1992
+LABELV $1983
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1985
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1982
+LABELV $1984
+LABELV $1979
+endproc UI_LoadMods 2096 16
+proc UI_LoadTeams 4120 16
+ADDRGP4 $691
+ARGP4
+ADDRGP4 $1996
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4112
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4112
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1997
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2002
+JUMPV
+LABELV $1999
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 4116
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_ParseTeamInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $2000
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2002
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1999
+LABELV $1997
+LABELV $1995
+endproc UI_LoadTeams 4120 16
+proc UI_LoadMovies 4124 16
+ADDRGP4 $2005
+ARGP4
+ADDRGP4 $2006
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4108
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+125924
+ADDRLP4 4108
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125924
+INDIRI4
+CNSTI4 0
+EQI4 $2007
+ADDRGP4 uiInfo+125924
+INDIRI4
+CNSTI4 256
+LEI4 $2010
+ADDRGP4 uiInfo+125924
+CNSTI4 256
+ASGNI4
+LABELV $2010
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2017
+JUMPV
+LABELV $2014
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4112
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 4112
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI4 -4
+ADDP4
+ARGP4
+ADDRGP4 $2021
+ARGP4
+ADDRLP4 4116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4116
+INDIRI4
+CNSTI4 0
+NEI4 $2019
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $2019
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4120
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+124900
+ADDP4
+ADDRLP4 4120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $2015
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2017
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+125924
+INDIRI4
+LTI4 $2014
+LABELV $2007
+LABELV $2003
+endproc UI_LoadMovies 4124 16
+proc UI_LoadDemos 16456 20
+ADDRGP4 $2024
+ARGP4
+ADDRLP4 16436
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16400
+ADDRLP4 16436
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16400
+INDIRI4
+CNSTI4 0
+NEI4 $2025
+ADDRGP4 $2027
+ARGP4
+ADDRLP4 16440
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16400
+ADDRLP4 16440
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2025
+ADDRLP4 16404
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2028
+ARGP4
+ADDRGP4 $2029
+ARGP4
+ADDRLP4 16400
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2031
+ARGP4
+ADDRLP4 16404
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16440
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+124892
+ADDRLP4 16440
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 16444
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16444
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16444
+INDIRI4
+ASGNI4
+LABELV $2032
+ADDRGP4 uiInfo+124892
+INDIRI4
+CNSTI4 512
+LEI4 $2043
+ADDRGP4 uiInfo+124892
+CNSTI4 512
+ASGNI4
+ADDRGP4 $2043
+JUMPV
+LABELV $2040
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16448
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16448
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16452
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+122844
+ADDP4
+ADDRLP4 16452
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $2041
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2043
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+124892
+INDIRI4
+LTI4 $2040
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2046
+ADDRGP4 $2034
+JUMPV
+LABELV $2046
+LABELV $2033
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $2032
+LABELV $2034
+LABELV $2023
+endproc UI_LoadDemos 16456 20
+proc UI_SetNextMap 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2052
+JUMPV
+LABELV $2049
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+96
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2054
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 $2058
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2048
+JUMPV
+LABELV $2054
+LABELV $2050
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2052
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LTI4 $2049
+CNSTI4 0
+RETI4
+LABELV $2048
+endproc UI_SetNextMap 8 16
+proc UI_StartSkirmish 1132 32
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2060
+ADDRGP4 $2062
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1056
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 UI_SetNextMap
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $2063
+ADDRGP4 $2064
+JUMPV
+LABELV $2063
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 178
+ARGI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $2058
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $2064
+LABELV $2060
+ADDRLP4 1040
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2068
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $821
+ARGP4
+ADDRLP4 1060
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1060
+INDIRF4
+ASGNF4
+ADDRGP4 $2072
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 $2075
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $715
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1072
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2076
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $716
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1076
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2077
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+ADDRGP4 $2078
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1080
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2079
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2080
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1084
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2081
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2082
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1088
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2083
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 1092
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1092
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2085
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2086
+ARGP4
+ADDRLP4 1096
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1096
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2087
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2088
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1100
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2089
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $390
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $391
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2078
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2080
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2086
+ARGP4
+CNSTF4 1092616192
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2088
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 1104
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2090
+ARGP4
+ADDRLP4 1104
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $695
+ARGP4
+ADDRLP4 1108
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2091
+ARGP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2094
+ARGP4
+ADDRLP4 1112
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1112
+INDIRF4
+CNSTF4 0
+EQF4 $2092
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2095
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2099
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2092
+ADDRLP4 1032
+CNSTI4 500
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 2
+NEI4 $2100
+ADDRGP4 $2084
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2102
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2101
+JUMPV
+LABELV $2100
+ADDRLP4 1036
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+16
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2112
+JUMPV
+LABELV $2109
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 UI_AIFromName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2116
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+NEI4 $2122
+ADDRLP4 1116
+ADDRGP4 $691
+ASGNP4
+ADDRGP4 $2123
+JUMPV
+LABELV $2122
+ADDRLP4 1116
+ADDRGP4 $837
+ASGNP4
+LABELV $2123
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2110
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2112
+ADDRLP4 0
+INDIRI4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+16
+ADDP4
+INDIRI4
+LTI4 $2109
+ADDRGP4 $695
+ARGP4
+ADDRLP4 1116
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2127
+JUMPV
+LABELV $2124
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 UI_AIFromName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2116
+ARGP4
+ADDRLP4 1128
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+NEI4 $2136
+ADDRLP4 1124
+ADDRGP4 $691
+ASGNP4
+ADDRGP4 $2137
+JUMPV
+LABELV $2136
+ADDRLP4 1124
+ADDRGP4 $836
+ASGNP4
+LABELV $2137
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2127
+ADDRLP4 0
+INDIRI4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+16
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2124
+LABELV $2101
+ADDRLP4 1040
+INDIRI4
+CNSTI4 2
+LEI4 $2138
+CNSTI4 2
+ARGI4
+ADDRGP4 $2140
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2138
+LABELV $2059
+endproc UI_StartSkirmish 1132 32
+proc UI_Update 40 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2144
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2142
+ADDRGP4 $2145
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1430
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2143
+JUMPV
+LABELV $2142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2148
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2146
+ADDRGP4 $2149
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1167867904
+LTF4 $2150
+ADDRGP4 $2152
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2153
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2150
+ADDRLP4 4
+INDIRF4
+CNSTF4 1165623296
+LTF4 $2154
+ADDRGP4 $2152
+ARGP4
+CNSTF4 1097859072
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2153
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2154
+ADDRGP4 $2152
+ARGP4
+CNSTF4 1097859072
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2153
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2147
+JUMPV
+LABELV $2146
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2158
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2156
+ADDRGP4 $1430
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2145
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2157
+JUMPV
+LABELV $2156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2161
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2159
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2167
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $2170
+LABELV $2169
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2164
+ADDRGP4 $2160
+JUMPV
+LABELV $2170
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+EQI4 $2168
+ADDRGP4 $2160
+JUMPV
+LABELV $2164
+ADDRGP4 $2165
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $2160
+JUMPV
+LABELV $2167
+ADDRGP4 $2165
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2160
+JUMPV
+LABELV $2168
+ADDRGP4 $2165
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2160
+JUMPV
+LABELV $2159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2173
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2171
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2176
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+EQI4 $2178
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+EQI4 $2179
+ADDRGP4 $2172
+JUMPV
+LABELV $2176
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2172
+JUMPV
+LABELV $2178
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2172
+JUMPV
+LABELV $2179
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2172
+JUMPV
+LABELV $2171
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2182
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2180
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $2181
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+GTI4 $2181
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2204
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2204
+address $2185
+address $2199
+address $2201
+address $2203
+code
+LABELV $2185
+ADDRGP4 $2186
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2187
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2173
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2161
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2165
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2188
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2189
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2190
+ARGP4
+ADDRGP4 $2191
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2192
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2193
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2194
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2195
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2196
+ARGP4
+CNSTF4 1159479296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2197
+ARGP4
+ADDRGP4 $2198
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2181
+JUMPV
+LABELV $2199
+ADDRGP4 $2186
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2187
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2173
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2161
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2165
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $2188
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2189
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2190
+ARGP4
+ADDRGP4 $2200
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2192
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2193
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2194
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2196
+ARGP4
+CNSTF4 1159479296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2197
+ARGP4
+ADDRGP4 $2198
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2195
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2181
+JUMPV
+LABELV $2201
+ADDRGP4 $2186
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2187
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2173
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2161
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2165
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $2188
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2189
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2190
+ARGP4
+ADDRGP4 $2200
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2192
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2195
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2193
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2194
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2196
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2197
+ARGP4
+ADDRGP4 $2202
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2181
+JUMPV
+LABELV $2203
+ADDRGP4 $2186
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2177
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2187
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2173
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2161
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2165
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2166
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2189
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2190
+ARGP4
+ADDRGP4 $2200
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2188
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2192
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2195
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2196
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2193
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2194
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2197
+ARGP4
+ADDRGP4 $2202
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2181
+JUMPV
+LABELV $2180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2207
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $2205
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2208
+ADDRGP4 $2210
+ARGP4
+CNSTF4 1018444120
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2209
+JUMPV
+LABELV $2208
+ADDRGP4 $2210
+ARGP4
+CNSTF4 3165927768
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2209
+LABELV $2205
+LABELV $2181
+LABELV $2172
+LABELV $2160
+LABELV $2157
+LABELV $2147
+LABELV $2143
+LABELV $2141
+endproc UI_Update 40 8
+proc UI_RunMenuScript 1368 28
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1168
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+EQI4 $2212
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2216
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $2214
+ADDRGP4 $391
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $390
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2075
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 ui_dedicated+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1176
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $2217
+ARGP4
+ADDRLP4 1176
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1180
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 1180
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 1184
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2090
+ARGP4
+ADDRLP4 1184
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $695
+ARGP4
+ADDRLP4 1188
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2091
+ARGP4
+ADDRLP4 1188
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2068
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1192
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 1196
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1196
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 2
+LEI4 $2225
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2228
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2232
+ADDRGP4 $847
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2233
+JUMPV
+LABELV $2232
+ADDRGP4 $852
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2233
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2235
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2235
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2237
+ADDRGP4 $846
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2238
+JUMPV
+LABELV $2237
+ADDRGP4 $851
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2238
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2240
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2240
+LABELV $2229
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LTI4 $2228
+ADDRGP4 $2226
+JUMPV
+LABELV $2225
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2242
+ADDRGP4 $870
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2246
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2246
+LABELV $2243
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 14
+LTI4 $2242
+LABELV $2226
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $2248
+ADDRLP4 1036
+CNSTI4 8
+ASGNI4
+LABELV $2248
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LEI4 $2250
+ADDRLP4 1036
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+LABELV $2250
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $821
+ARGP4
+ADDRLP4 1200
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1040
+ADDRLP4 1200
+INDIRF4
+ASGNF4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 2
+LEI4 $2252
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2255
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2259
+ADDRGP4 $847
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1204
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1208
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2260
+JUMPV
+LABELV $2259
+ADDRGP4 $852
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1204
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1208
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2260
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $2262
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2264
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2265
+JUMPV
+LABELV $2264
+ADDRLP4 1032
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072-72
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2265
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2269
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRF4
+ARGF4
+ADDRGP4 $837
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2262
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2270
+ADDRGP4 $846
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1204
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1208
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2271
+JUMPV
+LABELV $2270
+ADDRGP4 $851
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1204
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1208
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2271
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $2273
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2275
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2276
+JUMPV
+LABELV $2275
+ADDRLP4 1032
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072-72
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2276
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2269
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRF4
+ARGF4
+ADDRGP4 $836
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2273
+LABELV $2256
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LTI4 $2255
+ADDRGP4 $2253
+JUMPV
+LABELV $2252
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2279
+ADDRGP4 $870
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1204
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1208
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $2283
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2285
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2286
+JUMPV
+LABELV $2285
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+ARGI4
+ADDRLP4 1212
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1212
+INDIRP4
+ASGNP4
+LABELV $2286
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2287
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2283
+LABELV $2280
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 14
+LTI4 $2279
+LABELV $2253
+ADDRGP4 $2288
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1204
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 108
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+100
+ADDP4
+INDIRI4
+EQI4 $2289
+ADDRGP4 $2294
+ARGP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2290
+JUMPV
+LABELV $2289
+ADDRGP4 $2294
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2290
+ADDRGP4 $2295
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1208
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 108
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+104
+ADDP4
+INDIRI4
+EQI4 $2296
+ADDRGP4 $2301
+ARGP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2215
+JUMPV
+LABELV $2296
+ADDRGP4 $2301
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2215
+JUMPV
+LABELV $2214
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2304
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $2302
+ADDRGP4 $391
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $390
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2075
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 ui_dedicated+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1200
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $2217
+ARGP4
+ADDRLP4 1200
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1204
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 1204
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 1208
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2090
+ARGP4
+ADDRLP4 1208
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $695
+ARGP4
+ADDRLP4 1212
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2091
+ARGP4
+ADDRLP4 1212
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2309
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1216
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2313
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 1220
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1196
+ADDRLP4 1220
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1188
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 2
+LEI4 $2314
+ADDRLP4 1180
+CNSTI4 0
+ASGNI4
+LABELV $2317
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2321
+ADDRGP4 $847
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2321
+ADDRGP4 $852
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2322
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2324
+ADDRLP4 1188
+ADDRLP4 1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2324
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2326
+ADDRGP4 $846
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2327
+JUMPV
+LABELV $2326
+ADDRGP4 $851
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2327
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2329
+ADDRLP4 1188
+ADDRLP4 1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2329
+LABELV $2318
+ADDRLP4 1180
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 7
+LTI4 $2317
+ADDRGP4 $2315
+JUMPV
+LABELV $2314
+ADDRLP4 1180
+CNSTI4 0
+ASGNI4
+LABELV $2331
+ADDRGP4 $870
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2335
+ADDRLP4 1188
+ADDRLP4 1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2335
+LABELV $2332
+ADDRLP4 1180
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 14
+LTI4 $2331
+LABELV $2315
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $2337
+ADDRLP4 1188
+CNSTI4 8
+ASGNI4
+LABELV $2337
+ADDRLP4 1196
+INDIRI4
+ADDRLP4 1188
+INDIRI4
+LEI4 $2339
+ADDRLP4 1188
+ADDRLP4 1196
+INDIRI4
+ASGNI4
+LABELV $2339
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 1188
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $821
+ARGP4
+ADDRLP4 1224
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1192
+ADDRLP4 1224
+INDIRF4
+ASGNF4
+ADDRLP4 1184
+CNSTI4 500
+ASGNI4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 2
+LEI4 $2341
+ADDRLP4 1180
+CNSTI4 0
+ASGNI4
+LABELV $2344
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2348
+ADDRGP4 $847
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1232
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2349
+JUMPV
+LABELV $2348
+ADDRGP4 $852
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1232
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2349
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $2351
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2353
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2354
+JUMPV
+LABELV $2353
+ADDRLP4 1032
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072-72
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2354
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2357
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1192
+INDIRF4
+ARGF4
+ADDRGP4 $837
+ARGP4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1184
+ADDRLP4 1184
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2351
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LEI4 $2358
+ADDRGP4 $846
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1232
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2359
+JUMPV
+LABELV $2358
+ADDRGP4 $851
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1232
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2359
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $2361
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2363
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2364
+JUMPV
+LABELV $2363
+ADDRLP4 1032
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072-72
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2364
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2357
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1192
+INDIRF4
+ARGF4
+ADDRGP4 $836
+ARGP4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1184
+ADDRLP4 1184
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2361
+LABELV $2345
+ADDRLP4 1180
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 7
+LTI4 $2344
+ADDRGP4 $2342
+JUMPV
+LABELV $2341
+ADDRLP4 1180
+CNSTI4 0
+ASGNI4
+LABELV $2367
+ADDRGP4 $870
+ARGP4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1232
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $2371
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2373
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2374
+JUMPV
+LABELV $2373
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+ARGI4
+ADDRLP4 1236
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1236
+INDIRP4
+ASGNP4
+LABELV $2374
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2375
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 1192
+INDIRF4
+ARGF4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1184
+ADDRLP4 1184
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2371
+LABELV $2368
+ADDRLP4 1180
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 14
+LTI4 $2367
+LABELV $2342
+ADDRGP4 $2288
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 108
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+100
+ADDP4
+INDIRI4
+EQI4 $2376
+ADDRGP4 $2294
+ARGP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2377
+JUMPV
+LABELV $2376
+ADDRGP4 $2294
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2377
+ADDRGP4 $2295
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1232
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 108
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+104
+ADDP4
+INDIRI4
+EQI4 $2381
+ADDRGP4 $2301
+ARGP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2382
+JUMPV
+LABELV $2381
+ADDRGP4 $2301
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2382
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRGP4 $2303
+JUMPV
+LABELV $2302
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2388
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $2386
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ARGI4
+ADDRLP4 1184
+ADDRGP4 UI_GetIndexFromSelection
+CALLI4
+ASGNI4
+ADDRGP4 ui_mapIndex+12
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRGP4 $2062
+ARGP4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+ARGI4
+ADDRGP4 $2058
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRLP4 1188
+CNSTI4 0
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 178
+ARGI4
+ADDRLP4 1188
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 179
+ARGI4
+ADDRLP4 1192
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRGP4 $2387
+JUMPV
+LABELV $2386
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2395
+ARGP4
+ADDRLP4 1184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $2393
+CNSTI4 2
+ARGI4
+ADDRGP4 $2396
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2397
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 $2398
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2399
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2394
+JUMPV
+LABELV $2393
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2402
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $2400
+ADDRGP4 UI_LoadArenasIntoMapList
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $2403
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2401
+JUMPV
+LABELV $2400
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2406
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $2404
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $2405
+JUMPV
+LABELV $2404
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2409
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $2407
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 $2408
+JUMPV
+LABELV $2407
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2412
+ARGP4
+ADDRLP4 1200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $2410
+ADDRGP4 $2413
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2411
+JUMPV
+LABELV $2410
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2416
+ARGP4
+ADDRLP4 1204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $2414
+ADDRGP4 $668
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 $2415
+JUMPV
+LABELV $2414
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2425
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $2423
+ADDRGP4 UI_ClearScores
+CALLV
+pop
+ADDRGP4 $2424
+JUMPV
+LABELV $2423
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2428
+ARGP4
+ADDRLP4 1212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $2426
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+ARGI4
+ADDRLP4 1216
+INDIRI4
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2427
+JUMPV
+LABELV $2426
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2431
+ARGP4
+ADDRLP4 1216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $2429
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2430
+JUMPV
+LABELV $2429
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2434
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $2432
+ADDRGP4 uiInfo+98056
+INDIRI4
+CNSTI4 0
+EQI4 $2433
+ADDRGP4 $2438
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2433
+JUMPV
+LABELV $2432
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2447
+ARGP4
+ADDRLP4 1224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $2445
+ADDRGP4 UI_LoadDemos
+CALLV
+pop
+ADDRGP4 $2446
+JUMPV
+LABELV $2445
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2450
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $2448
+ADDRGP4 UI_LoadMovies
+CALLV
+pop
+ADDRGP4 $2449
+JUMPV
+LABELV $2448
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2453
+ARGP4
+ADDRLP4 1232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $2451
+ADDRGP4 UI_LoadMods
+CALLV
+pop
+ADDRGP4 $2452
+JUMPV
+LABELV $2451
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2456
+ARGP4
+ADDRLP4 1236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $2454
+ADDRGP4 uiInfo+125932
+INDIRI4
+CNSTI4 0
+LTI4 $2457
+ADDRGP4 uiInfo+125932
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $2457
+ADDRGP4 $2461
+ARGP4
+ADDRGP4 uiInfo+125928
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+124900
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1240
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1240
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2455
+JUMPV
+LABELV $2454
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2466
+ARGP4
+ADDRLP4 1240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $2464
+ADDRGP4 $2467
+ARGP4
+ADDRGP4 uiInfo+122840
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2470
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2465
+JUMPV
+LABELV $2464
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2473
+ARGP4
+ADDRLP4 1244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 0
+NEI4 $2471
+ADDRGP4 $2474
+ARGP4
+ADDRGP4 uiInfo+124896
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+122844
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1248
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1248
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2472
+JUMPV
+LABELV $2471
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2479
+ARGP4
+ADDRLP4 1248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $2477
+ADDRGP4 $2467
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2470
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2478
+JUMPV
+LABELV $2477
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2482
+ARGP4
+ADDRLP4 1252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $2480
+ADDRGP4 uiInfo+125936+2212
+INDIRI4
+CNSTI4 0
+EQI4 $2483
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+125936+10420
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+140800
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+146128
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2481
+JUMPV
+LABELV $2483
+ADDRGP4 $2491
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $2492
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $2481
+JUMPV
+LABELV $2480
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2495
+ARGP4
+ADDRLP4 1256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $2493
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+125936+10420
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+140800
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+146128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2494
+JUMPV
+LABELV $2493
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2502
+ARGP4
+ADDRLP4 1260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+NEI4 $2500
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTF4 1073741824
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+ADDRGP4 UI_LoadMods
+CALLV
+pop
+ADDRGP4 $2501
+JUMPV
+LABELV $2500
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2505
+ARGP4
+ADDRLP4 1264
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $2503
+ADDRLP4 1268
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+137404
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $2504
+JUMPV
+LABELV $2503
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2514
+ARGP4
+ADDRLP4 1268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+CNSTI4 0
+NEI4 $2512
+ADDRGP4 uiInfo+137404
+ARGP4
+ADDRGP4 uiInfo+146120
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+144072
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 14
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2513
+JUMPV
+LABELV $2512
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2521
+ARGP4
+ADDRLP4 1272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 0
+NEI4 $2519
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildFindPlayerList
+CALLV
+pop
+ADDRGP4 uiInfo+137468+3328
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 14
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2520
+JUMPV
+LABELV $2519
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2526
+ARGP4
+ADDRLP4 1276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+CNSTI4 0
+NEI4 $2524
+ADDRGP4 $391
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $390
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2075
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+CNSTI4 0
+LTI4 $2525
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+GEI4 $2525
+ADDRLP4 1280
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+ADDRGP4 $2539
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1284
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1284
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2525
+JUMPV
+LABELV $2524
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2542
+ARGP4
+ADDRLP4 1280
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+NEI4 $2540
+ADDRGP4 $2075
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+146120
+INDIRI4
+CNSTI4 0
+LTI4 $2541
+ADDRGP4 uiInfo+146120
+INDIRI4
+ADDRGP4 uiInfo+146124
+INDIRI4
+GEI4 $2541
+ADDRGP4 $2539
+ARGP4
+ADDRGP4 uiInfo+146120
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+144072
+ADDP4
+ARGP4
+ADDRLP4 1284
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1284
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2541
+JUMPV
+LABELV $2540
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2552
+ARGP4
+ADDRLP4 1284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+CNSTI4 0
+NEI4 $2550
+ADDRGP4 $2075
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $2553
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2551
+JUMPV
+LABELV $2550
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2556
+ARGP4
+ADDRLP4 1288
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+CNSTI4 0
+NEI4 $2554
+ADDRGP4 $2557
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2558
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2555
+JUMPV
+LABELV $2554
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2561
+ARGP4
+ADDRLP4 1292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+CNSTI4 0
+NEI4 $2559
+CNSTI4 2
+ARGI4
+ADDRGP4 $2562
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 ui_singlePlayerActive+12
+INDIRI4
+CNSTI4 0
+EQI4 $2563
+ADDRGP4 $2076
+ARGP4
+ADDRLP4 1296
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 1296
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2077
+ARGP4
+ADDRLP4 1300
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $716
+ARGP4
+ADDRLP4 1300
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2079
+ARGP4
+ADDRLP4 1304
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $2078
+ARGP4
+ADDRLP4 1304
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2081
+ARGP4
+ADDRLP4 1308
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $2080
+ARGP4
+ADDRLP4 1308
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2087
+ARGP4
+ADDRLP4 1312
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $2566
+ARGP4
+ADDRLP4 1312
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2089
+ARGP4
+ADDRLP4 1316
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $2088
+ARGP4
+ADDRLP4 1316
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2083
+ARGP4
+ADDRLP4 1320
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $2082
+ARGP4
+ADDRLP4 1320
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2563
+ADDRGP4 $2492
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2560
+JUMPV
+LABELV $2559
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2569
+ARGP4
+ADDRLP4 1296
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+NEI4 $2567
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 0
+EQI4 $2568
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 uiInfo+125936+2200
+INDIRI4
+NEI4 $2572
+ADDRGP4 uiInfo+125936+2204
+INDIRI4
+CNSTI4 0
+NEI4 $2581
+ADDRLP4 1304
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2582
+JUMPV
+LABELV $2581
+ADDRLP4 1304
+CNSTI4 0
+ASGNI4
+LABELV $2582
+ADDRGP4 uiInfo+125936+2204
+ADDRLP4 1304
+INDIRI4
+ASGNI4
+LABELV $2572
+ADDRLP4 1052
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_ServersSort
+CALLV
+pop
+ADDRGP4 $2568
+JUMPV
+LABELV $2567
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2585
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 0
+NEI4 $2583
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2584
+JUMPV
+LABELV $2583
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2588
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 0
+NEI4 $2586
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2587
+JUMPV
+LABELV $2586
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2591
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 0
+NEI4 $2589
+ADDRLP4 1312
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2590
+JUMPV
+LABELV $2589
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2594
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 0
+NEI4 $2592
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $2593
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+GEI4 $2593
+ADDRGP4 $2600
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1316
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2593
+JUMPV
+LABELV $2592
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2606
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+NEI4 $2604
+ADDRGP4 uiInfo+103484
+INDIRI4
+CNSTI4 0
+LTI4 $2605
+ADDRGP4 uiInfo+103484
+INDIRI4
+ADDRGP4 uiInfo+103468
+INDIRI4
+GEI4 $2605
+ADDRGP4 $2612
+ARGP4
+ADDRGP4 uiInfo+103484
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+103496
+ADDP4
+ARGP4
+ADDRLP4 1320
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2605
+JUMPV
+LABELV $2604
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2617
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $2615
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $2616
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+103200
+INDIRI4
+GEI4 $2616
+ADDRGP4 $2623
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1324
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2616
+JUMPV
+LABELV $2615
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2629
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $2627
+ADDRGP4 uiInfo+103476
+INDIRI4
+CNSTI4 0
+LTI4 $2628
+ADDRGP4 uiInfo+103476
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $2628
+ADDRGP4 $2635
+ARGP4
+ADDRGP4 uiInfo+103476
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+105544
+ADDP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2628
+JUMPV
+LABELV $2627
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2640
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $2638
+ADDRGP4 uiInfo+98068
+INDIRI4
+CNSTI4 0
+NEI4 $2641
+ADDRLP4 1032
+ADDRGP4 $2266
+ASGNP4
+ADDRGP4 $2642
+JUMPV
+LABELV $2641
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 1332
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1332
+INDIRF4
+CNSTF4 1073741824
+LEF4 $2644
+ADDRLP4 1032
+CNSTI4 24
+ADDRGP4 uiInfo+98068
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072-24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2645
+JUMPV
+LABELV $2644
+ADDRGP4 uiInfo+98068
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1336
+INDIRP4
+ASGNP4
+LABELV $2645
+LABELV $2642
+ADDRGP4 $2650
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+122320
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 uiInfo+103464
+INDIRI4
+CNSTI4 0
+NEI4 $2654
+ADDRLP4 1336
+ADDRGP4 $837
+ASGNP4
+ADDRGP4 $2655
+JUMPV
+LABELV $2654
+ADDRLP4 1336
+ADDRGP4 $836
+ASGNP4
+LABELV $2655
+ADDRLP4 1336
+INDIRP4
+ARGP4
+ADDRLP4 1340
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1340
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2639
+JUMPV
+LABELV $2638
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2658
+ARGP4
+ADDRLP4 1332
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+NEI4 $2656
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+EQI4 $2657
+ADDRLP4 1336
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1340
+CNSTI1 0
+ASGNI1
+ADDRLP4 1120
+ADDRLP4 1340
+INDIRI1
+ASGNI1
+ADDRLP4 1056
+ADDRLP4 1340
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRGP4 $2666
+ARGP4
+ADDRLP4 1344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $2667
+ARGP4
+ADDRLP4 1348
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1348
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1352
+INDIRU4
+CNSTU4 0
+EQU4 $2657
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1356
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1356
+INDIRU4
+CNSTU4 0
+EQU4 $2657
+CNSTI4 2
+ARGI4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1360
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1152
+ADDRLP4 1360
+INDIRI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $2670
+ADDRGP4 $2672
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2657
+JUMPV
+LABELV $2670
+ADDRLP4 1152
+INDIRI4
+CNSTI4 -1
+NEI4 $2673
+ADDRGP4 $2675
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2657
+JUMPV
+LABELV $2673
+ADDRGP4 $2676
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2657
+JUMPV
+LABELV $2656
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2679
+ARGP4
+ADDRLP4 1336
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+NEI4 $2677
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $2678
+ADDRLP4 1340
+CNSTI4 2
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+ADDRLP4 1340
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1056
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRGP4 $2667
+ARGP4
+ADDRLP4 1344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1348
+INDIRU4
+CNSTU4 0
+EQU4 $2678
+CNSTI4 2
+ARGI4
+ADDRLP4 1056
+ARGP4
+ADDRGP4 trap_LAN_RemoveServer
+CALLV
+pop
+ADDRGP4 $2678
+JUMPV
+LABELV $2677
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2691
+ARGP4
+ADDRLP4 1340
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+NEI4 $2689
+ADDRLP4 1344
+CNSTI1 0
+ASGNI1
+ADDRLP4 1120
+ADDRLP4 1344
+INDIRI1
+ASGNI1
+ADDRLP4 1056
+ADDRLP4 1344
+INDIRI1
+ASGNI1
+ADDRGP4 $2692
+ARGP4
+ADDRLP4 1348
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1348
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2693
+ARGP4
+ADDRLP4 1352
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1352
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1356
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1356
+INDIRU4
+CNSTU4 0
+EQU4 $2690
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1360
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1360
+INDIRU4
+CNSTU4 0
+EQU4 $2690
+CNSTI4 2
+ARGI4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1364
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1152
+ADDRLP4 1364
+INDIRI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $2696
+ADDRGP4 $2672
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2690
+JUMPV
+LABELV $2696
+ADDRLP4 1152
+INDIRI4
+CNSTI4 -1
+NEI4 $2698
+ADDRGP4 $2675
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2690
+JUMPV
+LABELV $2698
+ADDRGP4 $2676
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2690
+JUMPV
+LABELV $2689
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2702
+ARGP4
+ADDRLP4 1344
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 0
+NEI4 $2700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ARGP4
+ADDRLP4 1348
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+EQI4 $2701
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 1352
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1160
+ADDRLP4 1352
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $2705
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2709
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2706
+JUMPV
+LABELV $2705
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2713
+JUMPV
+LABELV $2710
+ADDRGP4 uiInfo+103488
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+INDIRI4
+NEI4 $2715
+ADDRGP4 $2711
+JUMPV
+LABELV $2715
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2709
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2711
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2713
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+LTI4 $2710
+LABELV $2706
+ADDRLP4 1356
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2701
+JUMPV
+LABELV $2700
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2722
+ARGP4
+ADDRLP4 1348
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $2720
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ARGP4
+ADDRLP4 1352
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+EQI4 $2721
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 1356
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1160
+ADDRLP4 1356
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+NEI4 $2725
+CNSTI4 2
+ARGI4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2709
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2725
+ADDRLP4 1360
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2721
+JUMPV
+LABELV $2720
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2730
+ARGP4
+ADDRLP4 1352
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+NEI4 $2728
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ARGP4
+ADDRLP4 1356
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+EQI4 $2729
+ADDRGP4 $1412
+ARGP4
+ADDRLP4 1360
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1160
+ADDRLP4 1360
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $2733
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+107592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2709
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2733
+ADDRLP4 1364
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2729
+JUMPV
+LABELV $2728
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2739
+ARGP4
+ADDRLP4 1356
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+NEI4 $2737
+ADDRGP4 $2182
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2738
+JUMPV
+LABELV $2737
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $2742
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $2740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 1364
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+EQI4 $2741
+ADDRLP4 1164
+INDIRP4
+ARGP4
+ADDRGP4 UI_Update
+CALLV
+pop
+ADDRGP4 $2741
+JUMPV
+LABELV $2740
+ADDRGP4 $2745
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2741
+LABELV $2738
+LABELV $2729
+LABELV $2721
+LABELV $2701
+LABELV $2690
+LABELV $2678
+LABELV $2657
+LABELV $2639
+LABELV $2628
+LABELV $2616
+LABELV $2605
+LABELV $2593
+LABELV $2590
+LABELV $2587
+LABELV $2584
+LABELV $2568
+LABELV $2560
+LABELV $2555
+LABELV $2551
+LABELV $2541
+LABELV $2525
+LABELV $2520
+LABELV $2513
+LABELV $2504
+LABELV $2501
+LABELV $2494
+LABELV $2481
+LABELV $2478
+LABELV $2472
+LABELV $2465
+LABELV $2455
+LABELV $2452
+LABELV $2449
+LABELV $2446
+LABELV $2433
+LABELV $2430
+LABELV $2427
+LABELV $2424
+LABELV $2415
+LABELV $2411
+LABELV $2408
+LABELV $2405
+LABELV $2401
+LABELV $2394
+LABELV $2387
+LABELV $2303
+LABELV $2215
+LABELV $2212
+LABELV $2211
+endproc UI_RunMenuScript 1368 28
+proc UI_GetTeamColor 0 0
+LABELV $2746
+endproc UI_GetTeamColor 0 0
+proc UI_MapCountByGameType 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2755
+ADDRLP4 12
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2756
+JUMPV
+LABELV $2755
+ADDRLP4 12
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2756
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2757
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2757
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $2759
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $2759
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2764
+JUMPV
+LABELV $2761
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+96
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2768
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2772
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2774
+ADDRGP4 $2762
+JUMPV
+LABELV $2774
+LABELV $2772
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+96
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $2768
+LABELV $2762
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2764
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LTI4 $2761
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $2747
+endproc UI_MapCountByGameType 24 0
+proc UI_hasSkinForBase 72 20
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2781
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $2782
+CNSTI4 1
+RETI4
+ADDRGP4 $2780
+JUMPV
+LABELV $2782
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2784
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $2785
+CNSTI4 1
+RETI4
+ADDRGP4 $2780
+JUMPV
+LABELV $2785
+CNSTI4 0
+RETI4
+LABELV $2780
+endproc UI_hasSkinForBase 72 20
+bss
+align 4
+LABELV $2788
+skip 4
+code
+proc UI_HeadCountByTeam 48 8
+ADDRLP4 20
+ADDRGP4 $2788
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $2789
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2794
+JUMPV
+LABELV $2791
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2801
+JUMPV
+LABELV $2798
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 UI_hasSkinForBase
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2803
+ADDRLP4 32
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+20
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 8
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $2803
+LABELV $2799
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2801
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $2798
+LABELV $2792
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2794
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+LTI4 $2791
+ADDRGP4 $2788
+CNSTI4 1
+ASGNI4
+LABELV $2789
+ADDRGP4 $695
+ARGP4
+ADDRLP4 28
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2813
+JUMPV
+LABELV $2810
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2817
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2821
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2825
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2819
+JUMPV
+LABELV $2825
+LABELV $2821
+LABELV $2818
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $2817
+LABELV $2819
+LABELV $2811
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2813
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+LTI4 $2810
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2831
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2838
+JUMPV
+LABELV $2835
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2840
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $2843
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2848
+ADDRLP4 40
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+98072+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2853
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+98072+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2853
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $2853
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2850
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2850
+JUMPV
+LABELV $2853
+LABELV $2849
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2851
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+LTI4 $2848
+LABELV $2850
+LABELV $2843
+LABELV $2840
+LABELV $2836
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2838
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+LTI4 $2835
+LABELV $2832
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $2831
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $2787
+endproc UI_HeadCountByTeam 48 8
+proc UI_InsertServerIntoDisplayList 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2873
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+LEI4 $2869
+LABELV $2873
+ADDRGP4 $2868
+JUMPV
+LABELV $2869
+ADDRLP4 8
+ADDRGP4 uiInfo+125936+10412
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+ASGNI4
+ADDRGP4 $2879
+JUMPV
+LABELV $2876
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+125936+2220-4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2877
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2879
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $2876
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+NEI4 $2889
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $2889
+LABELV $2868
+endproc UI_InsertServerIntoDisplayList 16 8
+proc UI_RemoveServerFromDisplayList 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2899
+JUMPV
+LABELV $2896
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2902
+ADDRLP4 8
+ADDRGP4 uiInfo+125936+10412
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2911
+JUMPV
+LABELV $2908
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+125936+2220+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2909
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2911
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+LTI4 $2908
+ADDRGP4 $2895
+JUMPV
+LABELV $2902
+LABELV $2897
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2899
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+LTI4 $2896
+LABELV $2895
+endproc UI_RemoveServerFromDisplayList 16 0
+proc UI_BinaryServerInsertion 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2923
+JUMPV
+LABELV $2922
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2200
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+2204
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_LAN_CompareServers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2931
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 UI_InsertServerIntoDisplayList
+CALLV
+pop
+ADDRGP4 $2919
+JUMPV
+LABELV $2931
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2933
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $2934
+JUMPV
+LABELV $2933
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $2934
+LABELV $2923
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $2922
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2935
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2935
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_InsertServerIntoDisplayList
+CALLV
+pop
+LABELV $2919
+endproc UI_BinaryServerInsertion 32 20
+bss
+align 4
+LABELV $2938
+skip 4
+code
+proc UI_BuildServerDisplayList 1112 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2939
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRGP4 uiInfo+125936+10420
+INDIRI4
+GTI4 $2939
+ADDRGP4 $2937
+JUMPV
+LABELV $2939
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2944
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2944
+ADDRGP4 $2946
+ARGP4
+ADDRGP4 uiInfo+125936+10444
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 uiInfo+125936+10444
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1056
+ADDRLP4 1060
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2953
+ADDRGP4 uiInfo+125936+10444
+ARGP4
+ADDRGP4 $2957
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $2953
+ADDRLP4 1064
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2958
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2938
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125936+10412
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125936+10416
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+LABELV $2958
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+EQI4 $2967
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+NEI4 $2964
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+NEI4 $2964
+LABELV $2967
+ADDRGP4 uiInfo+125936+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+125936+10416
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+125936+10420
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 $2937
+JUMPV
+LABELV $2964
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $2978
+JUMPV
+LABELV $2975
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_LAN_ServerIsVisible
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $2979
+ADDRGP4 $2976
+JUMPV
+LABELV $2979
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_LAN_GetServerPing
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $2984
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $2981
+LABELV $2984
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $2985
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_RemoveServerFromDisplayList
+CALLV
+pop
+LABELV $2985
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $2988
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CNSTI4 0
+NEI4 $2989
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2992
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2976
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2976
+JUMPV
+LABELV $2992
+LABELV $2989
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CNSTI4 0
+NEI4 $2996
+ADDRLP4 12
+ARGP4
+ADDRGP4 $1381
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+NEI4 $2999
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2976
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2976
+JUMPV
+LABELV $2999
+LABELV $2996
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103336+4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $3003
+ADDRLP4 12
+ARGP4
+ADDRGP4 $3008
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103336+4
+ADDP4
+INDIRI4
+EQI4 $3009
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2976
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2976
+JUMPV
+LABELV $3009
+LABELV $3003
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+LEI4 $3016
+ADDRLP4 12
+ARGP4
+ADDRGP4 $3021
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 UI_FilterDir
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRLP4 1104
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+EQI4 $3019
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2976
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2976
+JUMPV
+LABELV $3019
+LABELV $3016
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_BinaryServerInsertion
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $3025
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRLP4 1100
+ADDRGP4 uiInfo+125936+10416
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1100
+INDIRP4
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 $2938
+ASGNP4
+ADDRLP4 1104
+INDIRP4
+ADDRLP4 1104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3025
+LABELV $2981
+LABELV $2976
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2978
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LTI4 $2975
+ADDRGP4 uiInfo+125936+2192
+ADDRGP4 uiInfo+220
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $3032
+LABELV $3032
+LABELV $2937
+endproc UI_BuildServerDisplayList 1112 16
+data
+export serverStatusCvars
+align 4
+LABELV serverStatusCvars
+address $3035
+address $3036
+address $3037
+address $691
+address $3038
+address $3039
+address $1349
+address $3040
+address $3041
+address $3042
+address $3043
+address $691
+address $2027
+address $691
+address $3044
+address $691
+address $716
+address $691
+address $715
+address $691
+byte 4 0
+byte 4 0
+code
+proc UI_SortServerStatusInfo 64 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $3049
+JUMPV
+LABELV $3046
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3053
+JUMPV
+LABELV $3050
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3056
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3054
+LABELV $3056
+ADDRGP4 $3051
+JUMPV
+LABELV $3054
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3057
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+INDIRU4
+CNSTU4 0
+EQU4 $3059
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars+4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3059
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3057
+LABELV $3051
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3053
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+LTI4 $3050
+LABELV $3047
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3049
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3046
+LABELV $3045
+endproc UI_SortServerStatusInfo 64 8
+proc UI_GetServerStatusInfo 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3064
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3332
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $3064
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3066
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3066
+CNSTI4 0
+RETI4
+ADDRGP4 $3063
+JUMPV
+LABELV $3066
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3068
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3063
+JUMPV
+LABELV $3068
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2112
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $3070
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 2112
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $3037
+ASGNP4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3073
+JUMPV
+LABELV $3072
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 60
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3075
+ADDRGP4 $3074
+JUMPV
+LABELV $3075
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $3077
+ADDRGP4 $3074
+JUMPV
+LABELV $3077
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 84
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3079
+ADDRGP4 $3074
+JUMPV
+LABELV $3079
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $3081
+ADDRGP4 $3074
+JUMPV
+LABELV $3081
+LABELV $3073
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3083
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3072
+LABELV $3083
+LABELV $3074
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 125
+GEI4 $3084
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $691
+ASGNP4
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $3086
+ASGNP4
+ADDRLP4 96
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDRGP4 $3087
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $3088
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1430
+ASGNP4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 $3090
+JUMPV
+LABELV $3089
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $3092
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $3092
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 120
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3094
+ADDRGP4 $3091
+JUMPV
+LABELV $3094
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 124
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 132
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3096
+ADDRGP4 $3091
+JUMPV
+LABELV $3096
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 192
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $3098
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 152
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 160
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $3099
+ADDRGP4 $3091
+JUMPV
+LABELV $3099
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 176
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3101
+ADDRGP4 $3091
+JUMPV
+LABELV $3101
+ADDRLP4 180
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3090
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3103
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3089
+LABELV $3103
+LABELV $3091
+LABELV $3084
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_SortServerStatusInfo
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $3063
+JUMPV
+LABELV $3070
+CNSTI4 0
+RETI4
+LABELV $3063
+endproc UI_GetServerStatusInfo 184 16
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $3106
+JUMPV
+LABELV $3105
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3111
+JUMPV
+LABELV $3108
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $3112
+ADDRGP4 $3110
+JUMPV
+LABELV $3112
+LABELV $3109
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3111
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $3114
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $3108
+LABELV $3114
+LABELV $3110
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3115
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $3104
+JUMPV
+LABELV $3115
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $3106
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3105
+CNSTP4 0
+RETP4
+LABELV $3104
+endproc stristr 12 4
+bss
+align 4
+LABELV $3118
+skip 4
+align 4
+LABELV $3119
+skip 4
+code
+proc UI_BuildFindPlayerList 4428 24
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3120
+ADDRGP4 uiInfo+146128
+INDIRI4
+CNSTI4 0
+EQI4 $3127
+ADDRGP4 uiInfo+146128
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+LEI4 $3121
+LABELV $3127
+ADDRGP4 $3117
+JUMPV
+LABELV $3120
+ADDRGP4 uiInfo+140804
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2244
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 uiInfo+146124
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+146120
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3132
+ARGP4
+ADDRGP4 uiInfo+143048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 uiInfo+143048
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+143048
+ARGP4
+ADDRLP4 4408
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4408
+INDIRU4
+CNSTU4 0
+NEU4 $3136
+ADDRGP4 uiInfo+146128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3117
+JUMPV
+LABELV $3136
+ADDRLP4 4404
+CNSTF4 1056964608
+ADDRGP4 ui_serverStatusTimeOut+12
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1092616192
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4404
+INDIRI4
+CNSTI4 50
+GEI4 $3141
+ADDRLP4 4404
+CNSTI4 50
+ASGNI4
+LABELV $3141
+ADDRGP4 $3143
+ARGP4
+ADDRLP4 4404
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+ADDRGP4 uiInfo+146124
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+145096-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3151
+ARGP4
+ADDRGP4 uiInfo+140804
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3118
+CNSTI4 0
+ASGNI4
+ADDRLP4 4412
+ADDRGP4 $3119
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3121
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3153
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3157
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4408
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+ASGNI4
+ADDRLP4 4408
+INDIRI4
+CNSTI4 0
+EQI4 $3162
+ADDRLP4 4412
+ADDRGP4 $3118
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3169
+JUMPV
+LABELV $3166
+ADDRLP4 4416
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4416
+INDIRI4
+ADDRLP4 8+64+8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3177
+ADDRLP4 4416
+INDIRI4
+ADDRLP4 8+64+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3171
+LABELV $3177
+ADDRGP4 $3167
+JUMPV
+LABELV $3171
+ADDRLP4 3340
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 8+64+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3340
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 3340
+ARGP4
+ADDRGP4 uiInfo+143048
+ARGP4
+ADDRLP4 4420
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 4420
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3180
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 15
+GEI4 $3183
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+144072-64
+ADDP4
+ARGP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+145096-64
+ADDP4
+ARGP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4424
+ADDRGP4 uiInfo+146124
+ASGNP4
+ADDRLP4 4424
+INDIRP4
+ADDRLP4 4424
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3184
+JUMPV
+LABELV $3183
+ADDRGP4 uiInfo+140804
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+ASGNI4
+LABELV $3184
+LABELV $3180
+LABELV $3167
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3169
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8+3328
+INDIRI4
+LTI4 $3166
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+145096-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3209
+ARGP4
+ADDRGP4 uiInfo+140804
+INDIRI4
+ARGI4
+ADDRGP4 $3118
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3162
+LABELV $3157
+ADDRLP4 4408
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4408
+INDIRI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3224
+ADDRLP4 4408
+INDIRI4
+ADDRGP4 uiInfo+140804+4+128
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRGP4 ui_serverStatusTimeOut+12
+INDIRI4
+SUBI4
+GEI4 $3214
+LABELV $3224
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3225
+ADDRLP4 4412
+ADDRGP4 $3119
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3225
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+140804
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+GEI4 $3235
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+128
+ADDP4
+ADDRGP4 uiInfo+220
+INDIRI4
+ASGNI4
+ADDRLP4 4412
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 3376
+ADDRLP4 4412
+INDIRI4
+ASGNI4
+ADDRLP4 3376
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+140804
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+ADDRLP4 3376
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+140804
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3380
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 3380
+ARGP4
+ADDRGP4 $2666
+ARGP4
+ADDRLP4 4416
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+64
+ADDP4
+ARGP4
+ADDRLP4 4416
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4420
+ADDRGP4 uiInfo+140804
+ASGNP4
+ADDRLP4 4420
+INDIRP4
+ADDRLP4 4420
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+145096-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3209
+ARGP4
+ADDRGP4 uiInfo+140804
+INDIRI4
+ARGI4
+ADDRGP4 $3118
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3235
+LABELV $3214
+LABELV $3154
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3153
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3271
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+140804+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3275
+ADDRGP4 $3273
+JUMPV
+LABELV $3275
+LABELV $3272
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3271
+LABELV $3273
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+GEI4 $3280
+ADDRGP4 uiInfo+146128
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRGP4 $3281
+JUMPV
+LABELV $3280
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 0
+NEI4 $3284
+ADDRGP4 uiInfo+145096
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3289
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3285
+JUMPV
+LABELV $3284
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+145096-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3294
+ARGP4
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 2
+NEI4 $3300
+ADDRLP4 4408
+ADDRGP4 $691
+ASGNP4
+ADDRGP4 $3301
+JUMPV
+LABELV $3300
+ADDRLP4 4408
+ADDRGP4 $3297
+ASGNP4
+LABELV $3301
+ADDRLP4 4408
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+143048
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3285
+ADDRGP4 uiInfo+146128
+CNSTI4 0
+ASGNI4
+CNSTF4 1096810496
+ARGF4
+ADDRGP4 uiInfo+146120
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $3281
+LABELV $3117
+endproc UI_BuildFindPlayerList 4428 24
+proc UI_BuildServerStatus 8 16
+ADDRGP4 uiInfo+146128
+INDIRI4
+CNSTI4 0
+EQI4 $3305
+ADDRGP4 $3304
+JUMPV
+LABELV $3305
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3308
+ADDRGP4 uiInfo+140800
+INDIRI4
+CNSTI4 0
+EQI4 $3315
+ADDRGP4 uiInfo+140800
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+LEI4 $3309
+LABELV $3315
+ADDRGP4 $3304
+JUMPV
+LABELV $3308
+CNSTP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 uiInfo+137468+3328
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+LABELV $3309
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $3329
+ADDRGP4 uiInfo+125936+2216
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+GTI4 $3329
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $3318
+LABELV $3329
+ADDRGP4 $3304
+JUMPV
+LABELV $3318
+ADDRGP4 uiInfo+137404
+ARGP4
+ADDRGP4 uiInfo+137468
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3330
+ADDRGP4 uiInfo+140800
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+137404
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+pop
+ADDRGP4 $3331
+JUMPV
+LABELV $3330
+ADDRGP4 uiInfo+140800
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $3331
+LABELV $3304
+endproc UI_BuildServerStatus 8 16
+proc UI_FeederCount 12 4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3339
+ADDRLP4 0
+ADDRGP4 UI_HeadCountByTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3339
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3341
+ADDRGP4 uiInfo+146144
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3341
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $3344
+ADDRGP4 uiInfo+125924
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3344
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3349
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3347
+LABELV $3349
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3351
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3352
+JUMPV
+LABELV $3351
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $3352
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3347
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3353
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3353
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $3357
+ADDRGP4 uiInfo+137468+3328
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3357
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $3361
+ADDRGP4 uiInfo+146124
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3361
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3364
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRGP4 uiInfo+103480
+INDIRI4
+LEI4 $3366
+ADDRGP4 uiInfo+103480
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $3366
+ADDRGP4 uiInfo+103468
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3364
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3373
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRGP4 uiInfo+103480
+INDIRI4
+LEI4 $3375
+ADDRGP4 uiInfo+103480
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $3375
+ADDRGP4 uiInfo+103472
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3373
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3382
+ADDRGP4 uiInfo+122836
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3382
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3385
+ADDRGP4 uiInfo+124892
+INDIRI4
+RETI4
+ADDRGP4 $3338
+JUMPV
+LABELV $3385
+CNSTI4 0
+RETI4
+LABELV $3338
+endproc UI_FeederCount 12 4
+proc UI_SelectedMap 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3392
+JUMPV
+LABELV $3389
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+96
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3394
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3398
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3388
+JUMPV
+LABELV $3398
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3394
+LABELV $3390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3392
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LTI4 $3389
+ADDRGP4 $691
+RETP4
+LABELV $3388
+endproc UI_SelectedMap 12 0
+proc UI_SelectedHead 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3405
+JUMPV
+LABELV $3402
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3407
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3411
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3401
+JUMPV
+LABELV $3411
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3407
+LABELV $3403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3405
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+LTI4 $3402
+ADDRGP4 $691
+RETP4
+LABELV $3401
+endproc UI_SelectedHead 12 0
+proc UI_GetIndexFromSelection 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3418
+JUMPV
+LABELV $3415
+CNSTI4 108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+96
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3420
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3424
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $3414
+JUMPV
+LABELV $3424
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3420
+LABELV $3416
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3418
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+LTI4 $3415
+CNSTI4 0
+RETI4
+LABELV $3414
+endproc UI_GetIndexFromSelection 12 0
+proc UI_UpdatePendingPings 4 4
+ADDRLP4 0
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ResetPings
+CALLV
+pop
+ADDRGP4 uiInfo+125936+2212
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+125936+2192
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $3426
+endproc UI_UpdatePendingPings 4 4
+bss
+align 1
+LABELV $3433
+skip 1024
+align 1
+LABELV $3434
+skip 1024
+align 1
+LABELV $3435
+skip 32
+align 4
+LABELV $3436
+skip 4
+align 4
+LABELV $3437
+skip 4
+code
+proc UI_FeederItemText 64 20
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3436
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3437
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3438
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_SelectedHead
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3438
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3440
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $3441
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+146144
+INDIRI4
+GEI4 $3441
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+146148
+ADDP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3440
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3448
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3446
+LABELV $3448
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_SelectedMap
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3446
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3449
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3450
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+GEI4 $3450
+ADDRGP4 $3436
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $3458
+ADDRGP4 $3437
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 5000
+ADDI4
+LEI4 $3455
+LABELV $3458
+ADDRLP4 24
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $3433
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $3436
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3437
+ADDRGP4 uiInfo+220
+INDIRI4
+ASGNI4
+LABELV $3455
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $3088
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $3462
+LABELV $3462
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $3450
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+GTI4 $3450
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3489
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3489
+address $3466
+address $3478
+address $3479
+address $3481
+address $3485
+code
+LABELV $3466
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $3467
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $2667
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3467
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $3469
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $3472
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $3475
+ADDRLP4 44
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $3473
+LABELV $3475
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $3473
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $2666
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3434
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3476
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3434
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3469
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $2666
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3434
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3477
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3434
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3478
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $3041
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3479
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $2988
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $1381
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3435
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $3480
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3435
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3481
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $3008
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $3482
+ADDRLP4 56
+INDIRI4
+ADDRGP4 numTeamArenaGameTypes
+INDIRI4
+GEI4 $3482
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamArenaGameTypes
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3482
+ADDRGP4 $3484
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3485
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $3486
+ADDRGP4 $3488
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3486
+ADDRGP4 $3433
+ARGP4
+ADDRGP4 $3088
+ARGP4
+ADDRLP4 60
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3449
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $3490
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3491
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+137468+3328
+INDIRI4
+GEI4 $3491
+ADDRLP4 24
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $3491
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+GEI4 $3491
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 uiInfo+137468+64
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3490
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $3500
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3501
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+146124
+INDIRI4
+GEI4 $3501
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+145096
+ADDP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3500
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3506
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3507
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+103468
+INDIRI4
+GEI4 $3507
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+103496
+ADDP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3506
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3512
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3513
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+103472
+INDIRI4
+GEI4 $3513
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+105544
+ADDP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3512
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3518
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3519
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+122836
+INDIRI4
+GEI4 $3519
+ADDRLP4 24
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+122324+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3523
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+122324+4
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3523
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324+4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3523
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+122324
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3518
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $3532
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3533
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+125924
+INDIRI4
+GEI4 $3533
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+124900
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3532
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3538
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3540
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+124892
+INDIRI4
+GEI4 $3540
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+122844
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3432
+JUMPV
+LABELV $3540
+LABELV $3538
+LABELV $3533
+LABELV $3519
+LABELV $3513
+LABELV $3507
+LABELV $3501
+LABELV $3491
+LABELV $3450
+LABELV $3441
+ADDRGP4 $691
+RETP4
+LABELV $3432
+endproc UI_FeederItemText 64 20
+proc UI_FeederItemImage 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3545
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedHead
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3546
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+GEI4 $3546
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $3550
+ADDRLP4 8
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+98072+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+98072+8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $3550
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+8
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $3544
+JUMPV
+LABELV $3545
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3560
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3561
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+146144
+INDIRI4
+GEI4 $3561
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+162532
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $3544
+JUMPV
+LABELV $3560
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1082130432
+EQF4 $3568
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3566
+LABELV $3568
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3569
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+GEI4 $3569
+CNSTI4 108
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $3572
+ADDRLP4 12
+CNSTI4 108
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+107852+8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $3572
+CNSTI4 108
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $3544
+JUMPV
+LABELV $3569
+LABELV $3566
+LABELV $3561
+LABELV $3546
+CNSTI4 0
+RETI4
+LABELV $3544
+endproc UI_FeederItemImage 20 8
+bss
+align 1
+LABELV $3583
+skip 1024
+code
+proc UI_FeederSelection 52 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3584
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedHead
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3585
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+GEI4 $3585
+ADDRGP4 $987
+ARGP4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3591
+ARGP4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $988
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3585
+JUMPV
+LABELV $3584
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3593
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3594
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+146144
+INDIRI4
+GEI4 $3594
+ADDRGP4 $983
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+146148
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $984
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+146148
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3594
+JUMPV
+LABELV $3593
+ADDRLP4 12
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3602
+ADDRLP4 12
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3600
+LABELV $3602
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3606
+ADDRLP4 16
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $3607
+JUMPV
+LABELV $3606
+ADDRLP4 16
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $3607
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 108
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $3608
+CNSTI4 108
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 108
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $3608
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRGP4 $2062
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 ui_mapIndex+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3617
+ADDRGP4 ui_currentMap+12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $911
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $790
+ARGP4
+ADDRLP4 20
+CNSTI4 108
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 $1114
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3098
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+100
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2288
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3098
+ARGP4
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+104
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2295
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3601
+JUMPV
+LABELV $3617
+ADDRGP4 ui_currentNetMap+12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $909
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $790
+ARGP4
+ADDRLP4 20
+CNSTI4 108
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $3601
+JUMPV
+LABELV $3600
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3648
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 uiInfo+125936+2216
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+125936+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $3583
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $3583
+ARGP4
+ADDRGP4 $3041
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $1052
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+125936+10428
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+CNSTI4 0
+LTI4 $3656
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+125936+10432
+CNSTI4 -1
+ASGNI4
+LABELV $3656
+ADDRGP4 $3583
+ARGP4
+ADDRGP4 $3041
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3649
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3649
+ADDRGP4 $790
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+125936+10432
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $3649
+JUMPV
+LABELV $3648
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $3668
+ADDRGP4 $3669
+JUMPV
+LABELV $3668
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $3670
+ADDRGP4 uiInfo+146120
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+146124
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $3671
+ADDRGP4 uiInfo+137404
+ARGP4
+ADDRGP4 uiInfo+146120
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+144072
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $3671
+JUMPV
+LABELV $3670
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3680
+ADDRGP4 uiInfo+103484
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3681
+JUMPV
+LABELV $3680
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3683
+ADDRGP4 uiInfo+103476
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3684
+JUMPV
+LABELV $3683
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3686
+ADDRGP4 uiInfo+122840
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3687
+JUMPV
+LABELV $3686
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $3689
+ADDRGP4 uiInfo+125928
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125932
+INDIRI4
+CNSTI4 0
+LTI4 $3692
+ADDRGP4 uiInfo+125932
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $3692
+ADDRGP4 uiInfo+125932
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3690
+JUMPV
+LABELV $3689
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3697
+ADDRGP4 uiInfo+124896
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $3697
+LABELV $3690
+LABELV $3687
+LABELV $3684
+LABELV $3681
+LABELV $3671
+LABELV $3669
+LABELV $3649
+LABELV $3601
+LABELV $3594
+LABELV $3585
+LABELV $3582
+endproc UI_FeederSelection 52 24
+proc Team_Parse 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3704
+CNSTI4 0
+RETI4
+ADDRGP4 $3700
+JUMPV
+LABELV $3703
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3706
+CNSTI4 1
+RETI4
+ADDRGP4 $3700
+JUMPV
+LABELV $3706
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3708
+CNSTI4 0
+RETI4
+ADDRGP4 $3700
+JUMPV
+LABELV $3708
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3710
+ADDRGP4 uiInfo+100380
+INDIRI4
+CNSTI4 64
+NEI4 $3712
+ADDRLP4 24
+ADDRGP4 uiInfo+100380
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3716
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3712
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $3721
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3717
+LABELV $3721
+CNSTI4 0
+RETI4
+ADDRGP4 $3700
+JUMPV
+LABELV $3717
+CNSTI4 44
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 44
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+28
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 40
+CNSTI4 44
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+32
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 52
+CNSTI4 44
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+36
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3746
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $3753
+CNSTI4 0
+RETI4
+ADDRGP4 $3700
+JUMPV
+LABELV $3753
+LABELV $3747
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $3746
+ADDRGP4 $3758
+ARGP4
+CNSTI4 44
+ADDRGP4 uiInfo+100380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 64
+ADDRGP4 uiInfo+100380
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3762
+CNSTI4 0
+RETI4
+ADDRGP4 $3700
+JUMPV
+LABELV $3762
+LABELV $3710
+LABELV $3704
+ADDRGP4 $3703
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3700
+endproc Team_Parse 72 12
+proc Character_Parse 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3768
+CNSTI4 0
+RETI4
+ADDRGP4 $3764
+JUMPV
+LABELV $3767
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $3770
+CNSTI4 1
+RETI4
+ADDRGP4 $3764
+JUMPV
+LABELV $3770
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3772
+CNSTI4 0
+RETI4
+ADDRGP4 $3764
+JUMPV
+LABELV $3772
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3774
+ADDRGP4 uiInfo+98064
+INDIRI4
+CNSTI4 64
+NEI4 $3776
+ADDRLP4 20
+ADDRGP4 uiInfo+98064
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3780
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3776
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 24
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3785
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3781
+LABELV $3785
+CNSTI4 0
+RETI4
+ADDRGP4 $3764
+JUMPV
+LABELV $3781
+CNSTI4 24
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+8
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3792
+ARGP4
+ADDRLP4 28
+CNSTI4 24
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+4
+ADDP4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3795
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $3797
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $3795
+ADDRGP4 $3801
+ARGP4
+ADDRLP4 48
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+12
+ADDP4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $3796
+JUMPV
+LABELV $3795
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3802
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $3804
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $3802
+ADDRGP4 $3808
+ARGP4
+ADDRLP4 56
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+12
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $3803
+JUMPV
+LABELV $3802
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+12
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $3803
+LABELV $3796
+ADDRGP4 $3812
+ARGP4
+ADDRLP4 56
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uiInfo+98064
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+98072
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 60
+ADDRGP4 uiInfo+98064
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3819
+CNSTI4 0
+RETI4
+ADDRGP4 $3764
+JUMPV
+LABELV $3819
+LABELV $3774
+LABELV $3768
+ADDRGP4 $3767
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3764
+endproc Character_Parse 68 12
+proc Alias_Parse 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3825
+CNSTI4 0
+RETI4
+ADDRGP4 $3821
+JUMPV
+LABELV $3824
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3827
+CNSTI4 1
+RETI4
+ADDRGP4 $3821
+JUMPV
+LABELV $3827
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3829
+CNSTI4 0
+RETI4
+ADDRGP4 $3821
+JUMPV
+LABELV $3829
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3831
+ADDRGP4 uiInfo+99608
+INDIRI4
+CNSTI4 64
+NEI4 $3833
+ADDRLP4 16
+ADDRGP4 uiInfo+99608
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3837
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3833
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+99608
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3849
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+99608
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3849
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+99608
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612+8
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3838
+LABELV $3849
+CNSTI4 0
+RETI4
+ADDRGP4 $3821
+JUMPV
+LABELV $3838
+ADDRGP4 $3850
+ARGP4
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+99608
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+99612+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 uiInfo+99608
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3857
+CNSTI4 0
+RETI4
+ADDRGP4 $3821
+JUMPV
+LABELV $3857
+LABELV $3831
+LABELV $3825
+ADDRGP4 $3824
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3821
+endproc Alias_Parse 40 12
+proc UI_ParseTeamInfo 40 8
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_GetMenuBuffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3860
+ADDRGP4 $3859
+JUMPV
+LABELV $3860
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $3863
+JUMPV
+LABELV $3862
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3867
+ADDRLP4 20
+INDIRI4
+CNSTI4 125
+NEI4 $3865
+LABELV $3867
+ADDRGP4 $3864
+JUMPV
+LABELV $3865
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3868
+ADDRGP4 $3864
+JUMPV
+LABELV $3868
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3872
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3870
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Team_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $3864
+ADDRGP4 $3863
+JUMPV
+LABELV $3870
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3877
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3875
+ADDRLP4 4
+ARGP4
+ADDRGP4 Character_Parse
+CALLI4
+pop
+LABELV $3875
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3880
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3878
+ADDRLP4 4
+ARGP4
+ADDRGP4 Alias_Parse
+CALLI4
+pop
+LABELV $3878
+LABELV $3863
+ADDRGP4 $3862
+JUMPV
+LABELV $3864
+LABELV $3859
+endproc UI_ParseTeamInfo 40 8
+proc UI_ValidateTeams 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3885
+JUMPV
+LABELV $3882
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3887
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 UI_AIFromName
+CALLP4
+pop
+LABELV $3888
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $3887
+LABELV $3883
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3885
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+LTI4 $3882
+LABELV $3881
+endproc UI_ValidateTeams 8 4
+proc GameType_Parse 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3894
+CNSTI4 0
+RETI4
+ADDRGP4 $3893
+JUMPV
+LABELV $3894
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3896
+ADDRGP4 uiInfo+103332
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3901
+JUMPV
+LABELV $3896
+ADDRGP4 uiInfo+103200
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3901
+JUMPV
+LABELV $3900
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3903
+CNSTI4 1
+RETI4
+ADDRGP4 $3893
+JUMPV
+LABELV $3903
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3905
+CNSTI4 0
+RETI4
+ADDRGP4 $3893
+JUMPV
+LABELV $3905
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3907
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3909
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+103332
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103336
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3918
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+103332
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103336+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3910
+LABELV $3918
+CNSTI4 0
+RETI4
+ADDRGP4 $3893
+JUMPV
+LABELV $3909
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+103200
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3926
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+103200
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3919
+LABELV $3926
+CNSTI4 0
+RETI4
+ADDRGP4 $3893
+JUMPV
+LABELV $3919
+LABELV $3910
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3927
+ADDRGP4 uiInfo+103332
+INDIRI4
+CNSTI4 16
+GEI4 $3929
+ADDRLP4 16
+ADDRGP4 uiInfo+103332
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3928
+JUMPV
+LABELV $3929
+ADDRGP4 $3933
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3928
+JUMPV
+LABELV $3927
+ADDRGP4 uiInfo+103200
+INDIRI4
+CNSTI4 16
+GEI4 $3934
+ADDRLP4 16
+ADDRGP4 uiInfo+103200
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3935
+JUMPV
+LABELV $3934
+ADDRGP4 $3938
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3935
+LABELV $3928
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3939
+CNSTI4 0
+RETI4
+ADDRGP4 $3893
+JUMPV
+LABELV $3939
+LABELV $3907
+LABELV $3901
+ADDRGP4 $3900
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3893
+endproc GameType_Parse 24 8
+proc MapList_Parse 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3942
+CNSTI4 0
+RETI4
+ADDRGP4 $3941
+JUMPV
+LABELV $3942
+ADDRGP4 uiInfo+107848
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3946
+JUMPV
+LABELV $3945
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3948
+CNSTI4 1
+RETI4
+ADDRGP4 $3941
+JUMPV
+LABELV $3948
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3950
+CNSTI4 0
+RETI4
+ADDRGP4 $3941
+JUMPV
+LABELV $3950
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3952
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3965
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3965
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+16
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3954
+LABELV $3965
+CNSTI4 0
+RETI4
+ADDRGP4 $3941
+JUMPV
+LABELV $3954
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+12
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3966
+CNSTI4 0
+RETI4
+ADDRGP4 $3941
+JUMPV
+LABELV $3966
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3975
+JUMPV
+LABELV $3974
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $3976
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $3976
+ADDRLP4 40
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+20
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 2
+LSHI4
+CNSTI4 192
+SUBI4
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+28
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $3978
+CNSTI4 0
+RETI4
+ADDRGP4 $3941
+JUMPV
+LABELV $3978
+LABELV $3975
+ADDRGP4 $3974
+JUMPV
+LABELV $3976
+CNSTI4 108
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3993
+ARGP4
+ADDRLP4 32
+CNSTI4 108
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+92
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+107848
+INDIRI4
+CNSTI4 128
+GEI4 $3997
+ADDRLP4 44
+ADDRGP4 uiInfo+107848
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3998
+JUMPV
+LABELV $3997
+ADDRGP4 $4001
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3998
+LABELV $3952
+LABELV $3946
+ADDRGP4 $3945
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3941
+endproc MapList_Parse 48 8
+proc UI_ParseGameInfo 40 8
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_GetMenuBuffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4003
+ADDRGP4 $4002
+JUMPV
+LABELV $4003
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $4006
+JUMPV
+LABELV $4005
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4010
+ADDRLP4 20
+INDIRI4
+CNSTI4 125
+NEI4 $4008
+LABELV $4010
+ADDRGP4 $4007
+JUMPV
+LABELV $4008
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $4011
+ADDRGP4 $4007
+JUMPV
+LABELV $4011
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4015
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4013
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 GameType_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $4007
+ADDRGP4 $4006
+JUMPV
+LABELV $4013
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4020
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4018
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 GameType_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $4007
+ADDRGP4 $4006
+JUMPV
+LABELV $4018
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4025
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $4023
+ADDRLP4 4
+ARGP4
+ADDRGP4 MapList_Parse
+CALLI4
+pop
+LABELV $4023
+LABELV $4006
+ADDRGP4 $4005
+JUMPV
+LABELV $4007
+LABELV $4002
+endproc UI_ParseGameInfo 40 8
+proc UI_Pause 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4027
+ADDRGP4 $2557
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $4028
+JUMPV
+LABELV $4027
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $4028
+LABELV $4026
+endproc UI_Pause 4 8
+proc UI_PlayCinematic 4 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $4029
+endproc UI_PlayCinematic 4 24
+proc UI_StopCinematic 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4031
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 $4032
+JUMPV
+LABELV $4031
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 262
+NEI4 $4033
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $4034
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+24
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4034
+JUMPV
+LABELV $4033
+ADDRFP4 0
+INDIRI4
+CNSTI4 264
+NEI4 $4046
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+CNSTI4 0
+LTI4 $4047
+ADDRGP4 uiInfo+125936+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+125936+10432
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4047
+JUMPV
+LABELV $4046
+ADDRFP4 0
+INDIRI4
+CNSTI4 269
+NEI4 $4056
+ADDRGP4 $695
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $4058
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+100380
+INDIRI4
+GEI4 $4058
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $4061
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+100384+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $4061
+LABELV $4058
+LABELV $4056
+LABELV $4047
+LABELV $4034
+LABELV $4032
+LABELV $4030
+endproc UI_StopCinematic 20 4
+proc UI_DrawCinematic 8 20
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 1142947840
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 uiInfo+62108+35880
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 uiInfo+62108+35880
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1139802112
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 uiInfo+62108+35884
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 uiInfo+62108+35884
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+LABELV $4069
+endproc UI_DrawCinematic 8 20
+proc UI_RunCinematicFrame 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+LABELV $4078
+endproc UI_RunCinematicFrame 0 4
+proc UI_BuildModel_List 4524 20
+ADDRGP4 uiInfo+146144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4081
+ARGP4
+ADDRGP4 $4082
+ARGP4
+ADDRLP4 2408
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4456
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 2404
+ADDRLP4 4456
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 2408
+ASGNP4
+ADDRLP4 2400
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4086
+JUMPV
+LABELV $4083
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 4460
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 348
+ADDRLP4 4460
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $4088
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $4088
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $4088
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 $4092
+ARGP4
+ADDRLP4 4468
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4468
+INDIRI4
+CNSTI4 0
+EQI4 $4094
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 $4093
+ARGP4
+ADDRLP4 4472
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4472
+INDIRI4
+CNSTI4 0
+NEI4 $4090
+LABELV $4094
+ADDRGP4 $4084
+JUMPV
+LABELV $4090
+ADDRGP4 $4095
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 4476
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4476
+INDIRP4
+ARGP4
+ADDRGP4 $4096
+ARGP4
+ADDRLP4 352
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4480
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 4480
+INDIRI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 352
+ASGNP4
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4100
+JUMPV
+LABELV $4097
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 4484
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 336
+ADDRLP4 4484
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4104
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4488
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4488
+INDIRI4
+CNSTI4 0
+NEI4 $4102
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4105
+ARGP4
+ADDRLP4 4492
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4492
+INDIRI4
+CNSTI4 0
+EQI4 $4102
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4106
+ARGP4
+ADDRLP4 4496
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4496
+INDIRI4
+CNSTI4 0
+EQI4 $4102
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4109
+ARGP4
+ADDRLP4 4500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4500
+INDIRI4
+CNSTI4 0
+NEI4 $4107
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $3477
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4108
+JUMPV
+LABELV $4107
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $4110
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260+5
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4108
+ADDRLP4 4504
+CNSTI4 0
+ASGNI4
+ADDRLP4 324
+ADDRLP4 4504
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4504
+INDIRI4
+ASGNI4
+ADDRGP4 $4115
+JUMPV
+LABELV $4112
+ADDRLP4 4
+ARGP4
+ADDRGP4 uiInfo+146144
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+146148
+ADDP4
+ARGP4
+ADDRLP4 4508
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 0
+NEI4 $4117
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4114
+JUMPV
+LABELV $4117
+LABELV $4113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4115
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+146144
+INDIRI4
+LTI4 $4112
+LABELV $4114
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $4121
+ADDRGP4 uiInfo+146144
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+146148
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3477
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4512
+ADDRGP4 uiInfo+146144
+ASGNP4
+ADDRLP4 4508
+ADDRLP4 4512
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4512
+INDIRP4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4129
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 4516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4516
+INDIRP4
+ARGP4
+ADDRLP4 4520
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+162532
+ADDP4
+ADDRLP4 4520
+INDIRI4
+ASGNI4
+LABELV $4121
+LABELV $4102
+LABELV $4098
+ADDRLP4 4484
+CNSTI4 1
+ASGNI4
+ADDRLP4 332
+ADDRLP4 332
+INDIRI4
+ADDRLP4 4484
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 336
+INDIRI4
+ADDRLP4 4484
+INDIRI4
+ADDI4
+ADDRLP4 328
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $4100
+ADDRLP4 332
+INDIRI4
+ADDRLP4 344
+INDIRI4
+GEI4 $4130
+ADDRGP4 uiInfo+146144
+INDIRI4
+CNSTI4 256
+LTI4 $4097
+LABELV $4130
+LABELV $4084
+ADDRLP4 4460
+CNSTI4 1
+ASGNI4
+ADDRLP4 2400
+ADDRLP4 2400
+INDIRI4
+ADDRLP4 4460
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 348
+INDIRI4
+ADDRLP4 4460
+INDIRI4
+ADDI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $4086
+ADDRLP4 2400
+INDIRI4
+ADDRLP4 2404
+INDIRI4
+GEI4 $4131
+ADDRGP4 uiInfo+146144
+INDIRI4
+CNSTI4 256
+LTI4 $4083
+LABELV $4131
+LABELV $4079
+endproc UI_BuildModel_List 4524 20
+proc _UI_Init 44 16
+ADDRGP4 UI_RegisterCvars
+CALLV
+pop
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 uiInfo+62108
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 $4134
+ARGP4
+ADDRGP4 uiInfo+62108+35880
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+62108+35884
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2190
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uiInfo+208
+CNSTF4 990414985
+ADDRGP4 uiInfo+62108+35884
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+212
+CNSTF4 986500301
+ADDRGP4 uiInfo+62108+35880
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTI4 480
+ADDRGP4 uiInfo+62108+35880
+INDIRI4
+MULI4
+CNSTI4 640
+ADDRGP4 uiInfo+62108+35884
+INDIRI4
+MULI4
+LEI4 $4145
+ADDRGP4 uiInfo+216
+CNSTF4 1056964608
+ADDRGP4 uiInfo+62108+35880
+INDIRI4
+CVIF4 4
+CNSTF4 1068149419
+ADDRGP4 uiInfo+62108+35884
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+212
+ADDRGP4 uiInfo+208
+INDIRF4
+ASGNF4
+ADDRGP4 $4146
+JUMPV
+LABELV $4145
+ADDRGP4 uiInfo+216
+CNSTF4 0
+ASGNF4
+LABELV $4146
+ADDRGP4 uiInfo
+ADDRGP4 trap_R_RegisterShaderNoMip
+ASGNP4
+ADDRGP4 uiInfo+4
+ADDRGP4 trap_R_SetColor
+ASGNP4
+ADDRGP4 uiInfo+8
+ADDRGP4 UI_DrawPic
+ASGNP4
+ADDRGP4 uiInfo+12
+ADDRGP4 trap_R_DrawStretchPic
+ASGNP4
+ADDRGP4 uiInfo+16
+ADDRGP4 Text_Paint
+ASGNP4
+ADDRGP4 uiInfo+20
+ADDRGP4 Text_Width
+ASGNP4
+ADDRGP4 uiInfo+24
+ADDRGP4 Text_Height
+ASGNP4
+ADDRGP4 uiInfo+28
+ADDRGP4 trap_R_RegisterModel
+ASGNP4
+ADDRGP4 uiInfo+32
+ADDRGP4 trap_R_ModelBounds
+ASGNP4
+ADDRGP4 uiInfo+36
+ADDRGP4 UI_FillRect
+ASGNP4
+ADDRGP4 uiInfo+40
+ADDRGP4 _UI_DrawRect
+ASGNP4
+ADDRGP4 uiInfo+44
+ADDRGP4 _UI_DrawSides
+ASGNP4
+ADDRGP4 uiInfo+48
+ADDRGP4 _UI_DrawTopBottom
+ASGNP4
+ADDRGP4 uiInfo+52
+ADDRGP4 trap_R_ClearScene
+ASGNP4
+ADDRGP4 uiInfo+56
+ADDRGP4 trap_R_AddRefEntityToScene
+ASGNP4
+ADDRGP4 uiInfo+60
+ADDRGP4 trap_R_RenderScene
+ASGNP4
+ADDRGP4 uiInfo+64
+ADDRGP4 trap_R_RegisterFont
+ASGNP4
+ADDRGP4 uiInfo+68
+ADDRGP4 UI_OwnerDraw
+ASGNP4
+ADDRGP4 uiInfo+72
+ADDRGP4 UI_GetValue
+ASGNP4
+ADDRGP4 uiInfo+76
+ADDRGP4 UI_OwnerDrawVisible
+ASGNP4
+ADDRGP4 uiInfo+80
+ADDRGP4 UI_RunMenuScript
+ASGNP4
+ADDRGP4 uiInfo+84
+ADDRGP4 UI_GetTeamColor
+ASGNP4
+ADDRGP4 uiInfo+96
+ADDRGP4 trap_Cvar_Set
+ASGNP4
+ADDRGP4 uiInfo+88
+ADDRGP4 trap_Cvar_VariableStringBuffer
+ASGNP4
+ADDRGP4 uiInfo+92
+ADDRGP4 trap_Cvar_VariableValue
+ASGNP4
+ADDRGP4 uiInfo+100
+ADDRGP4 Text_PaintWithCursor
+ASGNP4
+ADDRGP4 uiInfo+104
+ADDRGP4 trap_Key_SetOverstrikeMode
+ASGNP4
+ADDRGP4 uiInfo+108
+ADDRGP4 trap_Key_GetOverstrikeMode
+ASGNP4
+ADDRGP4 uiInfo+112
+ADDRGP4 trap_S_StartLocalSound
+ASGNP4
+ADDRGP4 uiInfo+116
+ADDRGP4 UI_OwnerDrawHandleKey
+ASGNP4
+ADDRGP4 uiInfo+120
+ADDRGP4 UI_FeederCount
+ASGNP4
+ADDRGP4 uiInfo+128
+ADDRGP4 UI_FeederItemImage
+ASGNP4
+ADDRGP4 uiInfo+124
+ADDRGP4 UI_FeederItemText
+ASGNP4
+ADDRGP4 uiInfo+132
+ADDRGP4 UI_FeederSelection
+ASGNP4
+ADDRGP4 uiInfo+144
+ADDRGP4 trap_Key_SetBinding
+ASGNP4
+ADDRGP4 uiInfo+140
+ADDRGP4 trap_Key_GetBindingBuf
+ASGNP4
+ADDRGP4 uiInfo+136
+ADDRGP4 trap_Key_KeynumToStringBuf
+ASGNP4
+ADDRGP4 uiInfo+148
+ADDRGP4 trap_Cmd_ExecuteText
+ASGNP4
+ADDRGP4 uiInfo+152
+ADDRGP4 Com_Error
+ASGNP4
+ADDRGP4 uiInfo+156
+ADDRGP4 Com_Printf
+ASGNP4
+ADDRGP4 uiInfo+160
+ADDRGP4 UI_Pause
+ASGNP4
+ADDRGP4 uiInfo+164
+ADDRGP4 UI_OwnerDrawWidth
+ASGNP4
+ADDRGP4 uiInfo+168
+ADDRGP4 trap_S_RegisterSound
+ASGNP4
+ADDRGP4 uiInfo+172
+ADDRGP4 trap_S_StartBackgroundTrack
+ASGNP4
+ADDRGP4 uiInfo+176
+ADDRGP4 trap_S_StopBackgroundTrack
+ASGNP4
+ADDRGP4 uiInfo+180
+ADDRGP4 UI_PlayCinematic
+ASGNP4
+ADDRGP4 uiInfo+184
+ADDRGP4 UI_StopCinematic
+ASGNP4
+ADDRGP4 uiInfo+188
+ADDRGP4 UI_DrawCinematic
+ASGNP4
+ADDRGP4 uiInfo+192
+ADDRGP4 UI_RunCinematicFrame
+ASGNP4
+ADDRGP4 uiInfo+196
+ADDRGP4 UI_AdjustFrom640
+ASGNP4
+ADDRGP4 uiInfo+200
+CNSTP4 0
+ASGNP4
+ADDRGP4 uiInfo+204
+CNSTP4 0
+ASGNP4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 $4211
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+98032
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4213
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+98024
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 UI_AssetCache
+CALLV
+pop
+ADDRGP4 uiInfo+100380
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+98064
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+99608
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4217
+ARGP4
+ADDRGP4 UI_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 UI_LoadTeams
+CALLV
+pop
+ADDRGP4 $668
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRGP4 UI_ValidateTeams
+CALLV
+pop
+ADDRGP4 $662
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4220
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4218
+LABELV $4220
+ADDRLP4 0
+ADDRGP4 $636
+ASGNP4
+LABELV $4218
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 $4221
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 trap_LAN_LoadCachedServers
+CALLV
+pop
+CNSTI4 108
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+107852+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+103204+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 UI_BuildModel_List
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 $1679
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+163560
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamecodetoui-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1915
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+146132
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CNSTI4 5
+MODI4
+ASGNI4
+ADDRGP4 uiInfo+146132
+INDIRI4
+CNSTI4 0
+GEI4 $4231
+ADDRGP4 uiInfo+146132
+CNSTI4 0
+ASGNI4
+LABELV $4231
+ADDRGP4 $2210
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+LTF4 $4236
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4237
+JUMPV
+LABELV $4236
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $4237
+ADDRGP4 $2207
+ARGP4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+125936+10432
+CNSTI4 -1
+ASGNI4
+ADDRGP4 uiInfo+125932
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4243
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+NEF4 $4241
+ADDRGP4 $4244
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $4245
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $4243
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $4241
+CNSTP4 0
+ARGP4
+ADDRGP4 $4246
+ARGP4
+ADDRGP4 $691
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $728
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $4132
+endproc _UI_Init 44 16
+proc _UI_KeyEvent 16 12
+ADDRLP4 0
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4249
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4251
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $4253
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4253
+ADDRLP4 12
+ADDRGP4 Menus_AnyFullScreenVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4253
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4253
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+ADDRGP4 $4252
+JUMPV
+LABELV $4251
+ADDRLP4 12
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $4252
+LABELV $4249
+LABELV $4248
+endproc _UI_KeyEvent 16 12
+proc _UI_MouseEvent 16 12
+ADDRLP4 0
+ADDRGP4 uiInfo+216
+INDIRF4
+ADDRGP4 uiInfo+212
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 uiInfo+228
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+228
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEGI4
+GEI4 $4259
+ADDRGP4 uiInfo+228
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $4260
+JUMPV
+LABELV $4259
+ADDRGP4 uiInfo+228
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 640
+ADDI4
+LEI4 $4263
+ADDRGP4 uiInfo+228
+ADDRLP4 0
+INDIRI4
+CNSTI4 640
+ADDI4
+ASGNI4
+LABELV $4263
+LABELV $4260
+ADDRLP4 8
+ADDRGP4 uiInfo+232
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+232
+INDIRI4
+CNSTI4 0
+GEI4 $4268
+ADDRGP4 uiInfo+232
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4269
+JUMPV
+LABELV $4268
+ADDRGP4 uiInfo+232
+INDIRI4
+CNSTI4 480
+LEI4 $4272
+ADDRGP4 uiInfo+232
+CNSTI4 480
+ASGNI4
+LABELV $4272
+LABELV $4269
+ADDRLP4 12
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $4276
+CNSTP4 0
+ARGP4
+ADDRGP4 uiInfo+228
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $4276
+LABELV $4255
+endproc _UI_MouseEvent 16 12
+proc UI_LoadNonIngame 12 8
+ADDRGP4 $662
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4283
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4281
+LABELV $4283
+ADDRLP4 0
+ADDRGP4 $636
+ASGNP4
+LABELV $4281
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 uiInfo+163564
+CNSTI4 0
+ASGNI4
+LABELV $4280
+endproc UI_LoadNonIngame 12 8
+export _UI_SetActiveMenu
+proc _UI_SetActiveMenu 276 12
+ADDRLP4 256
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+GTI4 $4286
+ADDRGP4 $4285
+JUMPV
+LABELV $4286
+ADDRLP4 260
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+LTI4 $4288
+ADDRLP4 260
+INDIRI4
+CNSTI4 4
+GTI4 $4288
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4311
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4311
+address $4291
+address $4292
+address $4308
+address $4302
+address $4303
+code
+LABELV $4291
+ADDRLP4 268
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $2557
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4285
+JUMPV
+LABELV $4292
+ADDRGP4 $1653
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uiInfo+163564
+INDIRI4
+CNSTI4 0
+EQI4 $4293
+ADDRGP4 UI_LoadNonIngame
+CALLV
+pop
+LABELV $4293
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2492
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2413
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 272
+INDIRU4
+CNSTU4 0
+EQU4 $4285
+ADDRGP4 ui_singlePlayerActive+12
+INDIRI4
+CNSTI4 0
+NEI4 $4298
+ADDRGP4 $4301
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4285
+JUMPV
+LABELV $4298
+ADDRGP4 $2413
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $4285
+JUMPV
+LABELV $4302
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1996
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4285
+JUMPV
+LABELV $4303
+ADDRGP4 $1653
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uiInfo+163564
+INDIRI4
+CNSTI4 0
+EQI4 $4304
+ADDRGP4 UI_LoadNonIngame
+CALLV
+pop
+LABELV $4304
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4307
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4285
+JUMPV
+LABELV $4308
+ADDRGP4 $2557
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4309
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4285
+JUMPV
+LABELV $4288
+ADDRGP4 $4310
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4285
+endproc _UI_SetActiveMenu 276 12
+proc _UI_IsFullscreen 4 0
+ADDRLP4 0
+ADDRGP4 Menus_AnyFullScreenVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $4312
+endproc _UI_IsFullscreen 4 0
+proc UI_ReadableSize 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1073741824
+LEI4 $4314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3098
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1073741824
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 8
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $4316
+ARGP4
+ADDRLP4 12
+CNSTI4 1073741824
+ASGNI4
+CNSTI4 100
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4315
+JUMPV
+LABELV $4314
+ADDRFP4 8
+INDIRI4
+CNSTI4 1048576
+LEI4 $4317
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $3098
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1048576
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 8
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $4319
+ARGP4
+ADDRLP4 12
+CNSTI4 1048576
+ASGNI4
+CNSTI4 100
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4318
+JUMPV
+LABELV $4317
+ADDRFP4 8
+INDIRI4
+CNSTI4 1024
+LEI4 $4320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4322
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1024
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4321
+JUMPV
+LABELV $4320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4323
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4321
+LABELV $4318
+LABELV $4315
+LABELV $4313
+endproc UI_ReadableSize 16 16
+proc UI_PrintTime 8 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 3600
+LEI4 $4325
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4327
+ARGP4
+ADDRLP4 4
+CNSTI4 3600
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+CNSTI4 60
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4326
+JUMPV
+LABELV $4325
+ADDRFP4 8
+INDIRI4
+CNSTI4 60
+LEI4 $4328
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4330
+ARGP4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4329
+JUMPV
+LABELV $4328
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4331
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4329
+LABELV $4326
+LABELV $4324
+endproc UI_PrintTime 8 20
+export Text_PaintCenter
+proc Text_PaintCenter 8 32
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $4332
+endproc Text_PaintCenter 8 32
+export Text_PaintCenter_AutoWrapped
+proc Text_PaintCenter_AutoWrapped 1064 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4336
+ADDRFP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4334
+LABELV $4336
+ADDRGP4 $4333
+JUMPV
+LABELV $4334
+ADDRLP4 20
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $4338
+JUMPV
+LABELV $4337
+LABELV $4340
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $4341
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $4343
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $4340
+LABELV $4343
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+LEF4 $4344
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $4346
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $4346
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4348
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4339
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4339
+JUMPV
+LABELV $4348
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $4345
+JUMPV
+LABELV $4344
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4352
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4339
+JUMPV
+LABELV $4352
+LABELV $4345
+LABELV $4338
+ADDRGP4 $4337
+JUMPV
+LABELV $4339
+LABELV $4333
+endproc Text_PaintCenter_AutoWrapped 1064 24
+lit
+align 1
+LABELV $4355
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $4356
+byte 1 69
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $4357
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+code
+proc UI_DisplayDownloadInfo 316 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $4358
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 284
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $4359
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $4360
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+ASGNI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1121976320
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4355
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1128267776
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4356
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1131937792
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4357
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4361
+ADDRGP4 $4363
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRGP4 $4362
+JUMPV
+LABELV $4361
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $4362
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1124597760
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 4096
+LTI4 $4366
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $4364
+LABELV $4366
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4367
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4368
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4365
+JUMPV
+LABELV $4364
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 0
+EQI4 $4369
+ADDRLP4 144
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+DIVI4
+ASGNI4
+ADDRGP4 $4370
+JUMPV
+LABELV $4369
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $4370
+ADDRLP4 152
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+EQI4 $4373
+ADDRLP4 144
+INDIRI4
+ADDRLP4 296
+INDIRI4
+EQI4 $4373
+ADDRLP4 216
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 220
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 304
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 308
+CNSTI4 1024
+ASGNI4
+CNSTI4 1000
+ADDRLP4 304
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 308
+INDIRI4
+DIVI4
+ADDRLP4 304
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 308
+INDIRI4
+DIVI4
+DIVI4
+SUBI4
+MULI4
+ARGI4
+ADDRGP4 UI_PrintTime
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 220
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4368
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4374
+JUMPV
+LABELV $4373
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4367
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4375
+ADDRGP4 $4368
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4376
+JUMPV
+LABELV $4375
+ADDRGP4 $4377
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $4376
+LABELV $4374
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $4378
+ADDRGP4 $4380
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 300
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1132986368
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $4378
+LABELV $4365
+LABELV $4354
+endproc UI_DisplayDownloadInfo 316 24
+export UI_DrawConnectScreen
+proc UI_DrawConnectScreen 5448 32
+ADDRGP4 $4382
+ARGP4
+ADDRLP4 5408
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 4120
+ADDRLP4 5408
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4383
+ADDRLP4 4120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4383
+ADDRLP4 4120
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $4383
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4381
+ADDRLP4 3084
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 4116
+CNSTF4 1124204544
+ASGNF4
+ADDRLP4 3088
+CNSTF4 1056964608
+ASGNF4
+LABELV $4386
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 3092
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+ARGI4
+ADDRLP4 3092
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 5412
+ADDRGP4 trap_GetConfigString
+CALLI4
+ASGNI4
+ADDRLP4 5412
+INDIRI4
+CNSTI4 0
+EQI4 $4387
+ADDRLP4 3092
+ARGP4
+ADDRGP4 $3041
+ARGP4
+ADDRLP4 5416
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $4389
+ARGP4
+ADDRLP4 5416
+INDIRP4
+ARGP4
+ADDRLP4 5420
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 4116
+INDIRF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 5420
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $4387
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 $4393
+ARGP4
+ADDRLP4 5416
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5416
+INDIRI4
+CNSTI4 0
+NEI4 $4390
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 4116
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4394
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4391
+JUMPV
+LABELV $4390
+ADDRLP4 4124
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $4395
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 4116
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4124
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $4391
+ADDRLP4 0+1036
+ARGP4
+ADDRGP4 $4398
+ARGP4
+ADDRLP4 5420
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+CNSTF4 1142292480
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 5420
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $4399
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 4116
+INDIRF4
+CNSTF4 1127219200
+ADDF4
+ARGF4
+CNSTF4 1142784000
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0+2060
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter_AutoWrapped
+CALLV
+pop
+LABELV $4399
+ADDRGP4 lastConnState
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $4402
+ADDRGP4 lastLoadingText
+CNSTI1 0
+ASGNI1
+LABELV $4402
+ADDRLP4 5428
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 lastConnState
+ADDRLP4 5428
+INDIRI4
+ASGNI4
+ADDRLP4 5424
+ADDRLP4 5428
+INDIRI4
+ASGNI4
+ADDRLP4 5436
+CNSTI4 2
+ASGNI4
+ADDRLP4 5424
+INDIRI4
+ADDRLP4 5436
+INDIRI4
+LTI4 $4381
+ADDRLP4 5424
+INDIRI4
+CNSTI4 6
+GTI4 $4381
+ADDRLP4 5424
+INDIRI4
+ADDRLP4 5436
+INDIRI4
+LSHI4
+ADDRGP4 $4420-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4420
+address $4407
+address $4410
+address $4413
+address $4381
+address $4381
+code
+LABELV $4407
+ADDRGP4 $4408
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 5440
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4380
+ADDRLP4 5440
+INDIRP4
+ASGNP4
+ADDRGP4 $4405
+JUMPV
+LABELV $4410
+ADDRGP4 $4411
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 5444
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4380
+ADDRLP4 5444
+INDIRP4
+ASGNP4
+ADDRGP4 $4405
+JUMPV
+LABELV $4413
+ADDRGP4 $4414
+ARGP4
+ADDRLP4 4384
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4384
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4415
+ADDRLP4 4384
+ARGP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 4116
+INDIRF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 UI_DisplayDownloadInfo
+CALLV
+pop
+ADDRGP4 $4381
+JUMPV
+LABELV $4415
+ADDRLP4 4380
+ADDRGP4 $4417
+ASGNP4
+LABELV $4405
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 $4393
+ARGP4
+ADDRLP4 5440
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5440
+INDIRI4
+CNSTI4 0
+EQI4 $4422
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 4116
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4380
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $4422
+LABELV $4381
+endproc UI_DrawConnectScreen 5448 32
+lit
+align 4
+LABELV uiCvarTable
+address ui_arenasFile
+address $4426
+address $691
+byte 4 80
+address ui_botsFile
+address $4427
+address $691
+byte 4 80
+address ui_spSkill
+address $821
+address $4428
+byte 4 1
+address ui_browserShowFull
+address $4429
+address $4430
+byte 4 1
+address ui_browserShowEmpty
+address $4431
+address $4430
+byte 4 1
+address ui_brassTime
+address $2196
+address $4432
+byte 4 1
+address ui_drawCrosshair
+address $1915
+address $4430
+byte 4 1
+address ui_drawCrosshairNames
+address $4433
+address $4434
+byte 4 1
+address ui_marks
+address $4435
+address $4430
+byte 4 1
+address ui_new
+address $4436
+address $4434
+byte 4 256
+address ui_debug
+address $4437
+address $4434
+byte 4 256
+address ui_initialized
+address $4438
+address $4434
+byte 4 256
+address ui_opponentName
+address $1119
+address $4439
+byte 4 1
+address ui_teamName
+address $695
+address $4440
+byte 4 1
+address ui_redteam
+address $4441
+address $4439
+byte 4 1
+address ui_blueteam
+address $4442
+address $4440
+byte 4 1
+address ui_dedicated
+address $4443
+address $4434
+byte 4 1
+address ui_gameType
+address $4444
+address $4428
+byte 4 1
+address ui_joinGameType
+address $4445
+address $4434
+byte 4 1
+address ui_netGameType
+address $4446
+address $4428
+byte 4 1
+address ui_actualNetGameType
+address $4447
+address $4428
+byte 4 1
+address ui_redteamctf1
+address $4448
+address $4434
+byte 4 1
+address ui_redteamctf2
+address $4449
+address $4434
+byte 4 1
+address ui_redteamctf3
+address $4450
+address $4434
+byte 4 1
+address ui_redteamctf4
+address $4451
+address $4434
+byte 4 1
+address ui_redteamctf5
+address $4452
+address $4434
+byte 4 1
+address ui_redteamctf6
+address $4453
+address $4434
+byte 4 1
+address ui_redteamctf7
+address $4454
+address $4434
+byte 4 1
+address ui_blueteamctf1
+address $4455
+address $4434
+byte 4 1
+address ui_blueteamctf2
+address $4456
+address $4434
+byte 4 1
+address ui_blueteamctf3
+address $4457
+address $4434
+byte 4 1
+address ui_blueteamctf4
+address $4458
+address $4434
+byte 4 1
+address ui_blueteamctf5
+address $4459
+address $4434
+byte 4 1
+address ui_blueteamctf6
+address $4460
+address $4434
+byte 4 1
+address ui_blueteamctf7
+address $4461
+address $4434
+byte 4 1
+address ui_redteamtdm1
+address $4462
+address $4434
+byte 4 1
+address ui_redteamtdm2
+address $4463
+address $4434
+byte 4 1
+address ui_redteamtdm3
+address $4464
+address $4434
+byte 4 1
+address ui_redteamtdm4
+address $4465
+address $4434
+byte 4 1
+address ui_redteamtdm5
+address $4466
+address $4434
+byte 4 1
+address ui_redteamtdm6
+address $4467
+address $4434
+byte 4 1
+address ui_redteamtdm7
+address $4468
+address $4434
+byte 4 1
+address ui_blueteamtdm1
+address $4469
+address $4434
+byte 4 1
+address ui_blueteamtdm2
+address $4470
+address $4434
+byte 4 1
+address ui_blueteamtdm3
+address $4471
+address $4434
+byte 4 1
+address ui_blueteamtdm4
+address $4472
+address $4434
+byte 4 1
+address ui_blueteamtdm5
+address $4473
+address $4434
+byte 4 1
+address ui_blueteamtdm6
+address $4474
+address $4434
+byte 4 1
+address ui_blueteamtdm7
+address $4475
+address $4434
+byte 4 1
+address ui_notteam1
+address $4476
+address $4434
+byte 4 1
+address ui_notteam2
+address $4477
+address $4434
+byte 4 1
+address ui_notteam3
+address $4478
+address $4434
+byte 4 1
+address ui_notteam4
+address $4479
+address $4434
+byte 4 1
+address ui_notteam5
+address $4480
+address $4434
+byte 4 1
+address ui_notteam6
+address $4481
+address $4434
+byte 4 1
+address ui_notteam7
+address $4482
+address $4434
+byte 4 1
+address ui_notteam8
+address $4483
+address $4434
+byte 4 1
+address ui_notteam9
+address $4484
+address $4434
+byte 4 1
+address ui_notteam10
+address $4485
+address $4434
+byte 4 1
+address ui_notteam11
+address $4486
+address $4434
+byte 4 1
+address ui_notteam12
+address $4487
+address $4434
+byte 4 1
+address ui_notteam13
+address $4488
+address $4434
+byte 4 1
+address ui_notteam14
+address $4489
+address $4434
+byte 4 1
+address ui_netSource
+address $1849
+address $4434
+byte 4 1
+address ui_menuFiles
+address $662
+address $636
+byte 4 1
+address ui_currentTier
+address $1034
+address $4434
+byte 4 1
+address ui_currentMap
+address $911
+address $4434
+byte 4 1
+address ui_currentNetMap
+address $909
+address $4434
+byte 4 1
+address ui_mapIndex
+address $2062
+address $4434
+byte 4 1
+address ui_currentOpponent
+address $4490
+address $4434
+byte 4 1
+address ui_selectedPlayer
+address $1412
+address $4434
+byte 4 1
+address ui_selectedPlayerName
+address $1420
+address $691
+byte 4 1
+address ui_lastServerRefresh_0
+address $4491
+address $691
+byte 4 1
+address ui_lastServerRefresh_1
+address $4492
+address $691
+byte 4 1
+address ui_lastServerRefresh_2
+address $4493
+address $691
+byte 4 1
+address ui_lastServerRefresh_3
+address $4494
+address $691
+byte 4 1
+address ui_lastServerRefresh_4
+address $4495
+address $691
+byte 4 1
+address ui_lastServerRefresh_5
+address $4496
+address $691
+byte 4 1
+address ui_lastServerRefresh_6
+address $4497
+address $691
+byte 4 1
+address ui_singlePlayerActive
+address $2075
+address $4434
+byte 4 72
+address ui_scoreAccuracy
+address $4498
+address $4434
+byte 4 1
+address ui_scoreImpressives
+address $4499
+address $4434
+byte 4 1
+address ui_scoreExcellents
+address $4500
+address $4434
+byte 4 1
+address ui_scoreCaptures
+address $4501
+address $4434
+byte 4 1
+address ui_scoreDefends
+address $4502
+address $4434
+byte 4 1
+address ui_scoreAssists
+address $4503
+address $4434
+byte 4 1
+address ui_scoreGauntlets
+address $4504
+address $4434
+byte 4 1
+address ui_scoreScore
+address $4505
+address $4434
+byte 4 1
+address ui_scorePerfect
+address $4506
+address $4434
+byte 4 1
+address ui_scoreTeam
+address $4507
+address $4508
+byte 4 1
+address ui_scoreBase
+address $4509
+address $4434
+byte 4 1
+address ui_scoreTime
+address $4510
+address $4511
+byte 4 1
+address ui_scoreTimeBonus
+address $4512
+address $4434
+byte 4 1
+address ui_scoreSkillBonus
+address $4513
+address $4434
+byte 4 1
+address ui_scoreShutoutBonus
+address $4514
+address $4434
+byte 4 1
+address ui_fragLimit
+address $714
+address $4434
+byte 4 0
+address ui_captureLimit
+address $713
+address $4515
+byte 4 0
+address ui_smallFont
+address $4516
+address $4517
+byte 4 1
+address ui_bigFont
+address $4518
+address $4519
+byte 4 1
+address ui_findPlayer
+address $3132
+address $4520
+byte 4 1
+address ui_Q3Model
+address $4521
+address $4434
+byte 4 1
+address ui_hudFiles
+address $4522
+address $4523
+byte 4 1
+address ui_recordSPDemo
+address $2094
+address $4434
+byte 4 1
+address ui_userRedRespawnTime
+address $2288
+address $4434
+byte 4 0
+address ui_userBlueRespawnTime
+address $2295
+address $4434
+byte 4 0
+address ui_teamArenaFirstRun
+address $4524
+address $4434
+byte 4 1
+address ui_serverStatusTimeOut
+address $4525
+address $4526
+byte 4 1
+byte 4 0
+address $2082
+address $4430
+byte 4 1
+byte 4 0
+address $4527
+address $4430
+byte 4 1
+byte 4 0
+address $4528
+address $4430
+byte 4 1
+byte 4 0
+address $4529
+address $4430
+byte 4 1
+byte 4 0
+address $2086
+address $4530
+byte 4 1
+byte 4 0
+address $3044
+address $4531
+byte 4 1029
+byte 4 0
+address $716
+address $4434
+byte 4 1029
+byte 4 0
+address $715
+address $4515
+byte 4 1029
+byte 4 0
+address $2190
+address $691
+byte 4 64
+export UI_RegisterCvars
+code
+proc UI_RegisterCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiCvarTable
+ASGNP4
+ADDRGP4 $4536
+JUMPV
+LABELV $4533
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $4534
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $4536
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 116
+LTU4 $4533
+LABELV $4532
+endproc UI_RegisterCvars 12 16
+export UI_UpdateCvars
+proc UI_UpdateCvars 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiCvarTable
+ASGNP4
+ADDRGP4 $4541
+JUMPV
+LABELV $4538
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4542
+ADDRGP4 $4539
+JUMPV
+LABELV $4542
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $4539
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $4541
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 116
+LTU4 $4538
+LABELV $4537
+endproc UI_UpdateCvars 8 4
+proc UI_StopServerRefresh 16 12
+ADDRGP4 uiInfo+125936+2212
+INDIRI4
+CNSTI4 0
+NEI4 $4545
+ADDRGP4 $4544
+JUMPV
+LABELV $4545
+ADDRGP4 uiInfo+125936+2212
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4551
+ARGP4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+125936+10416
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+SUBI4
+CNSTI4 0
+LEI4 $4556
+ADDRGP4 $4563
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $4560
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+125936+10412
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4556
+LABELV $4544
+endproc UI_StopServerRefresh 16 12
+proc UI_DoServerRefresh 16 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+125936+2212
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $4565
+ADDRGP4 $4564
+JUMPV
+LABELV $4565
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+EQI4 $4569
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4572
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $4573
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4573
+JUMPV
+LABELV $4572
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $4577
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $4577
+LABELV $4573
+LABELV $4569
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRGP4 uiInfo+125936+2192
+INDIRI4
+GEI4 $4579
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4584
+ADDRGP4 $4564
+JUMPV
+LABELV $4584
+LABELV $4579
+ADDRLP4 8
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_LAN_UpdateVisiblePings
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $4586
+ADDRGP4 uiInfo+125936+2192
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $4587
+JUMPV
+LABELV $4586
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4591
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 $4592
+JUMPV
+LABELV $4591
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4593
+CNSTI4 0
+ARGI4
+ADDRGP4 $4596
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 uiInfo+125936+2192
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+LABELV $4593
+LABELV $4592
+LABELV $4587
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+LABELV $4564
+endproc UI_DoServerRefresh 16 8
+proc UI_StartServerRefresh 72 24
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4601
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+LTI4 $4601
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+GTI4 $4601
+ADDRLP4 44
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $4605
+ADDRGP4 $4600
+JUMPV
+LABELV $4605
+LABELV $4601
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 $1341
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $4608
+ARGP4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 MonthAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4614
+ADDRGP4 UI_UpdatePendingPings
+CALLV
+pop
+ADDRGP4 $4600
+JUMPV
+LABELV $4614
+ADDRGP4 uiInfo+125936+2212
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+125936+10420
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+125936+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+125936+10416
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ResetPings
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4625
+CNSTI4 0
+ARGI4
+ADDRGP4 $4596
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 uiInfo+125936+2192
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 $4600
+JUMPV
+LABELV $4625
+ADDRGP4 uiInfo+125936+2192
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+LTI4 $4634
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+GTI4 $4634
+ADDRGP4 $4246
+ARGP4
+ADDRLP4 56
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+INDIRU4
+CNSTU4 0
+EQU4 $4638
+ADDRGP4 $4640
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $4639
+JUMPV
+LABELV $4638
+ADDRGP4 $2027
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $4642
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $4639
+LABELV $4634
+LABELV $4600
+endproc UI_StartServerRefresh 72 24
+bss
+export ui_userBlueRespawnTime
+align 4
+LABELV ui_userBlueRespawnTime
+skip 272
+export ui_userRedRespawnTime
+align 4
+LABELV ui_userRedRespawnTime
+skip 272
+export ui_recordSPDemo
+align 4
+LABELV ui_recordSPDemo
+skip 272
+export ui_hudFiles
+align 4
+LABELV ui_hudFiles
+skip 272
+export ui_Q3Model
+align 4
+LABELV ui_Q3Model
+skip 272
+export ui_findPlayer
+align 4
+LABELV ui_findPlayer
+skip 272
+export ui_scoreCaptures
+align 4
+LABELV ui_scoreCaptures
+skip 272
+export ui_lastServerRefresh_6
+align 4
+LABELV ui_lastServerRefresh_6
+skip 272
+export ui_lastServerRefresh_5
+align 4
+LABELV ui_lastServerRefresh_5
+skip 272
+export ui_lastServerRefresh_4
+align 4
+LABELV ui_lastServerRefresh_4
+skip 272
+export ui_teamName
+align 4
+LABELV ui_teamName
+skip 272
+export ui_notteam14
+align 4
+LABELV ui_notteam14
+skip 272
+export ui_notteam13
+align 4
+LABELV ui_notteam13
+skip 272
+export ui_notteam12
+align 4
+LABELV ui_notteam12
+skip 272
+export ui_notteam11
+align 4
+LABELV ui_notteam11
+skip 272
+export ui_notteam10
+align 4
+LABELV ui_notteam10
+skip 272
+export ui_notteam9
+align 4
+LABELV ui_notteam9
+skip 272
+export ui_notteam8
+align 4
+LABELV ui_notteam8
+skip 272
+export ui_notteam7
+align 4
+LABELV ui_notteam7
+skip 272
+export ui_notteam6
+align 4
+LABELV ui_notteam6
+skip 272
+export ui_notteam5
+align 4
+LABELV ui_notteam5
+skip 272
+export ui_notteam4
+align 4
+LABELV ui_notteam4
+skip 272
+export ui_notteam3
+align 4
+LABELV ui_notteam3
+skip 272
+export ui_notteam2
+align 4
+LABELV ui_notteam2
+skip 272
+export ui_notteam1
+align 4
+LABELV ui_notteam1
+skip 272
+export ui_blueteamtdm7
+align 4
+LABELV ui_blueteamtdm7
+skip 272
+export ui_blueteamtdm6
+align 4
+LABELV ui_blueteamtdm6
+skip 272
+export ui_blueteamtdm5
+align 4
+LABELV ui_blueteamtdm5
+skip 272
+export ui_blueteamtdm4
+align 4
+LABELV ui_blueteamtdm4
+skip 272
+export ui_blueteamtdm3
+align 4
+LABELV ui_blueteamtdm3
+skip 272
+export ui_blueteamtdm2
+align 4
+LABELV ui_blueteamtdm2
+skip 272
+export ui_blueteamtdm1
+align 4
+LABELV ui_blueteamtdm1
+skip 272
+export ui_redteamtdm7
+align 4
+LABELV ui_redteamtdm7
+skip 272
+export ui_redteamtdm6
+align 4
+LABELV ui_redteamtdm6
+skip 272
+export ui_redteamtdm5
+align 4
+LABELV ui_redteamtdm5
+skip 272
+export ui_redteamtdm4
+align 4
+LABELV ui_redteamtdm4
+skip 272
+export ui_redteamtdm3
+align 4
+LABELV ui_redteamtdm3
+skip 272
+export ui_redteamtdm2
+align 4
+LABELV ui_redteamtdm2
+skip 272
+export ui_redteamtdm1
+align 4
+LABELV ui_redteamtdm1
+skip 272
+export ui_blueteamctf7
+align 4
+LABELV ui_blueteamctf7
+skip 272
+export ui_blueteamctf6
+align 4
+LABELV ui_blueteamctf6
+skip 272
+export ui_blueteamctf5
+align 4
+LABELV ui_blueteamctf5
+skip 272
+export ui_blueteamctf4
+align 4
+LABELV ui_blueteamctf4
+skip 272
+export ui_blueteamctf3
+align 4
+LABELV ui_blueteamctf3
+skip 272
+export ui_blueteamctf2
+align 4
+LABELV ui_blueteamctf2
+skip 272
+export ui_blueteamctf1
+align 4
+LABELV ui_blueteamctf1
+skip 272
+export ui_redteamctf7
+align 4
+LABELV ui_redteamctf7
+skip 272
+export ui_redteamctf6
+align 4
+LABELV ui_redteamctf6
+skip 272
+export ui_redteamctf5
+align 4
+LABELV ui_redteamctf5
+skip 272
+export ui_redteamctf4
+align 4
+LABELV ui_redteamctf4
+skip 272
+export ui_redteamctf3
+align 4
+LABELV ui_redteamctf3
+skip 272
+export ui_redteamctf2
+align 4
+LABELV ui_redteamctf2
+skip 272
+export ui_redteamctf1
+align 4
+LABELV ui_redteamctf1
+skip 272
+export ui_blueteam
+align 4
+LABELV ui_blueteam
+skip 272
+export ui_redteam
+align 4
+LABELV ui_redteam
+skip 272
+align 1
+LABELV lastLoadingText
+skip 1024
+align 4
+LABELV lastConnState
+skip 4
+export startTime
+align 4
+LABELV startTime
+skip 4
+export ui_teamArenaFirstRun
+align 4
+LABELV ui_teamArenaFirstRun
+skip 272
+export ui_initialized
+align 4
+LABELV ui_initialized
+skip 272
+export ui_debug
+align 4
+LABELV ui_debug
+skip 272
+export ui_new
+align 4
+LABELV ui_new
+skip 272
+import trap_R_RemapShader
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_MemoryRemaining
+import trap_LAN_CompareServers
+import trap_LAN_ServerStatus
+import trap_LAN_ResetPings
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_SetClipRegion
+import trap_UpdateScreen
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_LightForPoint
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_SetColor
+import trap_R_ClearScene
+import trap_R_RenderScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_Cvar_Reset
+import UI_AddSkinToFrame
+import UI_GetBotNameByNumber
+import UI_LoadBots
+import UI_GetNumBots
+import UI_LoadBestScores
+import UI_ClearClipRegion
+import UI_SetClipRegion
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_SetActiveMenu
+import UI_AdjustFrom640
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_DrawSides
+import UI_DrawTopBottom
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawPic
+import UI_ConsoleCommand
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+export uiInfo
+align 4
+LABELV uiInfo
+skip 163568
+import UI_RegisterClientModelname
+import UI_PlayerInfo_UpdateColor
+import UI_ColorFromIndex
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_LoadArenasIntoMapList
+import UI_LoadArenas
+import UI_ClearScores
+import UI_AdjustTimeByGame
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+export ui_serverStatusTimeOut
+align 4
+LABELV ui_serverStatusTimeOut
+skip 272
+export ui_bigFont
+align 4
+LABELV ui_bigFont
+skip 272
+export ui_smallFont
+align 4
+LABELV ui_smallFont
+skip 272
+export ui_scoreTime
+align 4
+LABELV ui_scoreTime
+skip 272
+export ui_scoreShutoutBonus
+align 4
+LABELV ui_scoreShutoutBonus
+skip 272
+export ui_scoreSkillBonus
+align 4
+LABELV ui_scoreSkillBonus
+skip 272
+export ui_scoreTimeBonus
+align 4
+LABELV ui_scoreTimeBonus
+skip 272
+export ui_scoreBase
+align 4
+LABELV ui_scoreBase
+skip 272
+export ui_scoreTeam
+align 4
+LABELV ui_scoreTeam
+skip 272
+export ui_scorePerfect
+align 4
+LABELV ui_scorePerfect
+skip 272
+export ui_scoreScore
+align 4
+LABELV ui_scoreScore
+skip 272
+export ui_scoreGauntlets
+align 4
+LABELV ui_scoreGauntlets
+skip 272
+export ui_scoreAssists
+align 4
+LABELV ui_scoreAssists
+skip 272
+export ui_scoreDefends
+align 4
+LABELV ui_scoreDefends
+skip 272
+export ui_scoreExcellents
+align 4
+LABELV ui_scoreExcellents
+skip 272
+export ui_scoreImpressives
+align 4
+LABELV ui_scoreImpressives
+skip 272
+export ui_scoreAccuracy
+align 4
+LABELV ui_scoreAccuracy
+skip 272
+export ui_singlePlayerActive
+align 4
+LABELV ui_singlePlayerActive
+skip 272
+export ui_lastServerRefresh_3
+align 4
+LABELV ui_lastServerRefresh_3
+skip 272
+export ui_lastServerRefresh_2
+align 4
+LABELV ui_lastServerRefresh_2
+skip 272
+export ui_lastServerRefresh_1
+align 4
+LABELV ui_lastServerRefresh_1
+skip 272
+export ui_lastServerRefresh_0
+align 4
+LABELV ui_lastServerRefresh_0
+skip 272
+export ui_selectedPlayerName
+align 4
+LABELV ui_selectedPlayerName
+skip 272
+export ui_selectedPlayer
+align 4
+LABELV ui_selectedPlayer
+skip 272
+export ui_currentOpponent
+align 4
+LABELV ui_currentOpponent
+skip 272
+export ui_mapIndex
+align 4
+LABELV ui_mapIndex
+skip 272
+export ui_currentNetMap
+align 4
+LABELV ui_currentNetMap
+skip 272
+export ui_currentMap
+align 4
+LABELV ui_currentMap
+skip 272
+export ui_currentTier
+align 4
+LABELV ui_currentTier
+skip 272
+export ui_menuFiles
+align 4
+LABELV ui_menuFiles
+skip 272
+export ui_opponentName
+align 4
+LABELV ui_opponentName
+skip 272
+export ui_dedicated
+align 4
+LABELV ui_dedicated
+skip 272
+export ui_serverFilterType
+align 4
+LABELV ui_serverFilterType
+skip 272
+export ui_netSource
+align 4
+LABELV ui_netSource
+skip 272
+export ui_joinGameType
+align 4
+LABELV ui_joinGameType
+skip 272
+export ui_actualNetGameType
+align 4
+LABELV ui_actualNetGameType
+skip 272
+export ui_netGameType
+align 4
+LABELV ui_netGameType
+skip 272
+export ui_gameType
+align 4
+LABELV ui_gameType
+skip 272
+export ui_fragLimit
+align 4
+LABELV ui_fragLimit
+skip 272
+export ui_captureLimit
+align 4
+LABELV ui_captureLimit
+skip 272
+export ui_marks
+align 4
+LABELV ui_marks
+skip 272
+export ui_drawCrosshairNames
+align 4
+LABELV ui_drawCrosshairNames
+skip 272
+export ui_drawCrosshair
+align 4
+LABELV ui_drawCrosshair
+skip 272
+export ui_brassTime
+align 4
+LABELV ui_brassTime
+skip 272
+export ui_browserShowEmpty
+align 4
+LABELV ui_browserShowEmpty
+skip 272
+export ui_browserShowFull
+align 4
+LABELV ui_browserShowFull
+skip 272
+export ui_spSkill
+align 4
+LABELV ui_spSkill
+skip 272
+export ui_botsFile
+align 4
+LABELV ui_botsFile
+skip 272
+export ui_arenasFile
+align 4
+LABELV ui_arenasFile
+skip 272
+import trap_PC_FreeSource
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Menu_FindItemByName
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_R_RegisterFont
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import cmdcmp
+import SnapVectorTowards
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_strcasecmp
+import Q_strncasecmp
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_BitClear
+import COM_BitSet
+import COM_BitCheck
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectorsForward
+import AngleVectorsForwardRight
+import AngleVectorsRightUp
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import AngleDifference
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import SetMovedir
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import VectorToAngles
+import local_crandom
+import local_random
+import DeriveLocalSeed
+import LocallySeededRandom
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorMiddle
+import VectorBetweenVectors
+import VectorDistance
+import VectorDistanceSquared
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import Q_IsColorString
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $4642
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $4640
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $4608
+byte 1 37
+byte 1 115
+byte 1 45
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $4596
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4563
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $4560
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4551
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $4531
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $4530
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $4529
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $4528
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4527
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $4526
+byte 1 55
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4525
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $4524
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $4523
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $4522
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4521
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $4520
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $4519
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $4518
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4517
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $4516
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4515
+byte 1 56
+byte 1 0
+align 1
+LABELV $4514
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4513
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4512
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4511
+byte 1 48
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4510
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4509
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $4508
+byte 1 48
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $4507
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $4506
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4505
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4504
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4503
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4502
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $4501
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4500
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4499
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4498
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $4497
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 54
+byte 1 0
+align 1
+LABELV $4496
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 53
+byte 1 0
+align 1
+LABELV $4495
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 52
+byte 1 0
+align 1
+LABELV $4494
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 51
+byte 1 0
+align 1
+LABELV $4493
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 50
+byte 1 0
+align 1
+LABELV $4492
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $4491
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $4490
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4489
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $4488
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $4487
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $4486
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $4485
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $4484
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 57
+byte 1 0
+align 1
+LABELV $4483
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 56
+byte 1 0
+align 1
+LABELV $4482
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 55
+byte 1 0
+align 1
+LABELV $4481
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 54
+byte 1 0
+align 1
+LABELV $4480
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $4479
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $4478
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $4477
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $4476
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $4475
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 55
+byte 1 0
+align 1
+LABELV $4474
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 54
+byte 1 0
+align 1
+LABELV $4473
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $4472
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $4471
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $4470
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $4469
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $4468
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 55
+byte 1 0
+align 1
+LABELV $4467
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 54
+byte 1 0
+align 1
+LABELV $4466
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $4465
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $4464
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $4463
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $4462
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $4461
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 55
+byte 1 0
+align 1
+LABELV $4460
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 54
+byte 1 0
+align 1
+LABELV $4459
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 53
+byte 1 0
+align 1
+LABELV $4458
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 52
+byte 1 0
+align 1
+LABELV $4457
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 51
+byte 1 0
+align 1
+LABELV $4456
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 50
+byte 1 0
+align 1
+LABELV $4455
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 49
+byte 1 0
+align 1
+LABELV $4454
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 55
+byte 1 0
+align 1
+LABELV $4453
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 54
+byte 1 0
+align 1
+LABELV $4452
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 53
+byte 1 0
+align 1
+LABELV $4451
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 52
+byte 1 0
+align 1
+LABELV $4450
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 51
+byte 1 0
+align 1
+LABELV $4449
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 50
+byte 1 0
+align 1
+LABELV $4448
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 49
+byte 1 0
+align 1
+LABELV $4447
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4446
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4445
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4444
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4443
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4442
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $4441
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $4440
+byte 1 80
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $4439
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $4438
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4437
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $4436
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $4435
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $4434
+byte 1 48
+byte 1 0
+align 1
+LABELV $4433
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4432
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4431
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $4430
+byte 1 49
+byte 1 0
+align 1
+LABELV $4429
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $4428
+byte 1 51
+byte 1 0
+align 1
+LABELV $4427
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4426
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4417
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4414
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4411
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $4408
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $4398
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $4395
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4394
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4393
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $4389
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4382
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4380
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $4377
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $4368
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $4367
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $4363
+byte 1 37
+byte 1 115
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 0
+align 1
+LABELV $4360
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4359
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4358
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $4331
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $4330
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $4327
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4323
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4322
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 0
+align 1
+LABELV $4319
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 77
+byte 1 66
+byte 1 0
+align 1
+LABELV $4316
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 71
+byte 1 66
+byte 1 0
+align 1
+LABELV $4310
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4309
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4307
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4301
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $4246
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $4245
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4244
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4243
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $4221
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $4217
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $4213
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $4211
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $4134
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $4129
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4110
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4109
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $4106
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4105
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $4104
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 0
+align 1
+LABELV $4096
+byte 1 36
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4095
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4093
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4092
+byte 1 46
+byte 1 0
+align 1
+LABELV $4082
+byte 1 47
+byte 1 0
+align 1
+LABELV $4081
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $4025
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $4020
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4015
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4001
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3993
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3938
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3933
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3880
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3877
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3872
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $3850
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3837
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3812
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3808
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3804
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3801
+byte 1 106
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $3797
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3792
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3780
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3758
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3716
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3591
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3488
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3484
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $3480
+byte 1 37
+byte 1 115
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $3477
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3476
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 93
+byte 1 0
+align 1
+LABELV $3472
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3297
+byte 1 115
+byte 1 0
+align 1
+LABELV $3294
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3289
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3209
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3151
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3143
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3132
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3098
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $3088
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3087
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $3086
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $3044
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3043
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3042
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $3041
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3040
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3039
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3038
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3037
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $3036
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3035
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3021
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3008
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2988
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2957
+byte 1 87
+byte 1 101
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 33
+byte 1 0
+align 1
+LABELV $2946
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2784
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2781
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2745
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2742
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2739
+byte 1 103
+byte 1 108
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2730
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2722
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2709
+byte 1 10
+byte 1 0
+align 1
+LABELV $2702
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2693
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $2692
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2691
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2679
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2676
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2675
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $2672
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2667
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $2666
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2658
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2650
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2640
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $2635
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2629
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2623
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2617
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2612
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2606
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 75
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2600
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2594
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2591
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2588
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2585
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $2569
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2566
+byte 1 103
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2562
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2561
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $2558
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $2557
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2556
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2553
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2552
+byte 1 81
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2542
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2539
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2526
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2521
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2514
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2505
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2502
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2495
+byte 1 83
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $2492
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2491
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2482
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2479
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $2474
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2473
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2470
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 59
+byte 1 0
+align 1
+LABELV $2467
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2466
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $2461
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 32
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $2456
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $2453
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $2450
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2447
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $2438
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2434
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2431
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2428
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2425
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2416
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $2413
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2412
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2409
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2406
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2403
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2402
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $2399
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2398
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2397
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2396
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2395
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2388
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 80
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $2375
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2357
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2313
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2309
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2304
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2301
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2295
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2294
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2288
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2287
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2269
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2266
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2217
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2216
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2210
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2207
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2202
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $2200
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2198
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $2197
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2196
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $2194
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 0
+align 1
+LABELV $2193
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 121
+byte 1 0
+align 1
+LABELV $2192
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2191
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2190
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2189
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2188
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2187
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2186
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2182
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2177
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2173
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 98
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $2166
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2165
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2161
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2158
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2153
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 100
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2152
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2149
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2148
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2145
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2144
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2140
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2116
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2102
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2099
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2095
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2094
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2091
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2090
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2089
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2088
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2087
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2086
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2085
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2084
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2083
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2082
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2081
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2080
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2079
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2078
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2077
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2076
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2075
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $2072
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2068
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2062
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2058
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $2031
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $2029
+byte 1 100
+byte 1 109
+byte 1 95
+byte 1 0
+align 1
+LABELV $2028
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2027
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $2024
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $2021
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $2006
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $2005
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 0
+align 1
+LABELV $1996
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1981
+byte 1 36
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1932
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1915
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1849
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1835
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1822
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $1754
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1729
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1679
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $1653
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1481
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $1477
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1474
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1445
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1443
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 41
+byte 1 0
+align 1
+LABELV $1430
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1420
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1412
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1392
+byte 1 110
+byte 1 0
+align 1
+LABELV $1381
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1380
+byte 1 116
+byte 1 0
+align 1
+LABELV $1379
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $1349
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1341
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1339
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1338
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1298
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1119
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1114
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1109
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1052
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1039
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1034
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1031
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1005
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $988
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $987
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $984
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $983
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $982
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 81
+byte 1 51
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $941
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $926
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $911
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $909
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $870
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $864
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $861
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $858
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $852
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $851
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $847
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $846
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $837
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $836
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $835
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $828
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $827
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $821
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $790
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $771
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $766
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $738
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $728
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $727
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $716
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $715
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $714
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $713
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $695
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $691
+byte 1 0
+align 1
+LABELV $682
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $668
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $662
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $660
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $657
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $639
+byte 1 94
+byte 1 49
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $636
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $635
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $613
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $607
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $593
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $587
+byte 1 71
+byte 1 108
+byte 1 121
+byte 1 112
+byte 1 104
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $582
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $581
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $562
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 89
+byte 1 0
+align 1
+LABELV $554
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 88
+byte 1 0
+align 1
+LABELV $546
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $538
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $530
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $518
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $510
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $502
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $494
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $486
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $478
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $469
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $460
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $449
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $445
+byte 1 125
+byte 1 0
+align 1
+LABELV $436
+byte 1 123
+byte 1 0
+align 1
+LABELV $429
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $426
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $391
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $390
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $227
+byte 1 115
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 118
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $225
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $218
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $215
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $212
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $209
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $206
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $203
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $200
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 100
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $197
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $194
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $190
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $186
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $182
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $178
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $174
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $166
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $158
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $150
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $143
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $122
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $121
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 0
+align 1
+LABELV $120
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $119
+byte 1 67
+byte 1 65
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 71
+byte 1 78
+byte 1 0
+align 1
+LABELV $118
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $117
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 76
+byte 1 79
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $116
+byte 1 49
+byte 1 70
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $115
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $114
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $113
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $112
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $111
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $110
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $108
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $107
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $106
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $105
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $104
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $103
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $102
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $100
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $99
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $97
+byte 1 68
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $96
+byte 1 78
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $95
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $93
+byte 1 65
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $92
+byte 1 74
+byte 1 117
+byte 1 108
+byte 1 0
+align 1
+LABELV $91
+byte 1 74
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $90
+byte 1 77
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $89
+byte 1 65
+byte 1 112
+byte 1 114
+byte 1 0
+align 1
+LABELV $88
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $87
+byte 1 70
+byte 1 101
+byte 1 98
+byte 1 0
+align 1
+LABELV $86
+byte 1 74
+byte 1 97
+byte 1 110
+byte 1 0
@@ -60,6 +60,11 @@ typedef struct aas_entity_s {
 	aas_link_t *areas;
 	// links into the BSP leaves
 	bsp_link_t *leaves;
+	// origin the entity was linked at and the distance it can move from there without changing the areas it is linked to
+	vec3_t linkorigin;
+	float linkmargin;
+	// set when the entity is in the list with active entities
+	qboolean active;
 } aas_entity_t;
 
 typedef struct aas_settings_s {
@@ -212,6 +217,9 @@ typedef struct aas_s {
 	int maxentities;
 	int maxclients;
 	aas_entity_t *entities;
+	// entities that are valid or still linked
+	int *activeentities;
+	int numactiveentities;
 	// index to retrieve travel flag for a travel type
 	int travelflagfortype[MAX_TRAVELTYPES];
 	// travel flags for each area based on contents
@@ -221,6 +229,8 @@ typedef struct aas_s {
 	aas_routingupdate_t *portalupdate;
 	// number of routing updates during a frame (reset every frame)
 	int frameroutingupdates;
+	// number of area visibility rows calculated during a frame (reset every frame)
+	int framevisupdates;
 	// reversed reachability links
 	aas_reversedreachability_t *reversedreachability;
 	// travel times within the areas
@@ -236,6 +246,10 @@ typedef struct aas_s {
 	// areas the reachabilities go through
 	int *reachabilityareaindex;
 	aas_reachabilityareas_t *reachabilityareas;
+	// compressed area visibility, calculated on demand for each source area
+	byte **areavisibility;
+	byte *decompressedvis;
+	int decompressedvisarea;
 } aas_t;
 
 #define AASINTERN
@@ -42,6 +42,8 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 // always use the default world for entities
 extern aas_t aasworlds[MAX_AAS_WORLDS];
 aas_t *defaultaasworld = aasworlds;
+// distance kept from the margin to make up for floating point inaccuracies
+#define LINKMARGIN_EPSILON 0.25f
 
 /*
 =======================================================================================================================================
@@ -49,7 +51,7 @@ AAS_UpdateEntity
 =======================================================================================================================================
 */
 int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
-	int relink;
+	int relink, moved;
 	aas_entity_t *ent;
 	vec3_t absmins, absmaxs;
 
@@ -68,8 +70,14 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
 
 		ent->areas = NULL;
 		ent->leaves = NULL;
+		ent->linkmargin = 0;
 		return BLERR_NOERROR;
 	}
+	// add the entity to the active entities
+	if (!ent->active) {
+		ent->active = qtrue;
+		(*defaultaasworld).activeentities[(*defaultaasworld).numactiveentities++] = entnum;
+	}
 	// number of the entity
 	ent->i.number = entnum;
 	// updated so set valid flag
@@ -107,12 +115,17 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
 		VectorCopy(state->angles, ent->i.angles);
 	}
 	// if the origin changed
-	if (!VectorCompare(state->origin, ent->i.origin)) {
+	moved = !VectorCompare(state->origin, ent->i.origin);
+
+	if (moved) {
 		VectorCopy(state->origin, ent->i.origin);
-		relink = qtrue;
+		// only relink when the entity moved far enough to possibly change the areas it is linked to
+		if (Distance(ent->i.origin, ent->linkorigin) >= ent->linkmargin - LINKMARGIN_EPSILON) {
+			relink = qtrue;
+		}
 	}
-	// if the entity should be relinked
-	if (relink) {
+	// if the entity should be relinked, or was unlinked and didn't move far enough to notice
+	if (relink || !ent->areas) {
 		// don't link the world model
 		if (entnum != ENTITYNUM_WORLD) {
 			// absolute mins and maxs
@@ -121,7 +134,9 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state) {
 			// unlink the entity
 			AAS_UnlinkFromAreas(ent->areas);
 			// relink the entity to the AAS areas (use the larges bbox)
-			ent->areas = AAS_LinkEntityClientBBox(absmins, absmaxs, entnum, PRESENCE_NORMAL);
+			ent->areas = AAS_LinkEntityClientBBoxMargin(absmins, absmaxs, entnum, PRESENCE_NORMAL, &ent->linkmargin);
+
+			VectorCopy(ent->i.origin, ent->linkorigin);
 			// unlink the entity from the BSP leaves
 			AAS_UnlinkFromBSPLeaves(ent->leaves);
 			// link the entity to the world BSP tree
@@ -289,6 +304,7 @@ void AAS_ResetEntityLinks(void) {
 	for (i = 0; i < (*defaultaasworld).maxentities; i++) {
 		(*defaultaasworld).entities[i].areas = NULL;
 		(*defaultaasworld).entities[i].leaves = NULL;
+		(*defaultaasworld).entities[i].linkmargin = 0;
 	}
 }
 
@@ -303,28 +319,43 @@ void AAS_InvalidateEntities(void) {
 	for (i = 0; i < (*defaultaasworld).maxentities; i++) {
 		(*defaultaasworld).entities[i].i.number = i;
 		(*defaultaasworld).entities[i].i.valid = qfalse;
+		(*defaultaasworld).entities[i].active = qfalse;
 	}
+
+	(*defaultaasworld).numactiveentities = 0;
 }
 
 /*
 =======================================================================================================================================
 AAS_UnlinkInvalidEntities
+
+Unlinks the entities that were not updated last frame and invalidates the others. Only the active entities can be valid or linked.
 =======================================================================================================================================
 */
 void AAS_UnlinkInvalidEntities(void) {
-	int i;
+	int i, numactive;
 	aas_entity_t *ent;
 
-	for (i = 0; i < (*defaultaasworld).maxentities; i++) {
-		ent = &(*defaultaasworld).entities[i];
+	numactive = 0;
+
+	for (i = 0; i < (*defaultaasworld).numactiveentities; i++) {
+		ent = &(*defaultaasworld).entities[(*defaultaasworld).activeentities[i]];
 
 		if (!ent->i.valid) {
 			AAS_UnlinkFromAreas(ent->areas);
 			ent->areas = NULL;
 			AAS_UnlinkFromBSPLeaves(ent->leaves);
 			ent->leaves = NULL;
+			ent->linkmargin = 0;
+			ent->active = qfalse;
+			continue;
 		}
+
+		ent->i.valid = qfalse;
+		(*defaultaasworld).activeentities[numactive++] = (*defaultaasworld).activeentities[i];
 	}
+
+	(*defaultaasworld).numactiveentities = numactive;
 }
 
 /*
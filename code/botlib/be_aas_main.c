@@ -146,19 +146,19 @@ Called at the start of every frame.
 int AAS_StartFrame(float time) {
 	int i;
 
+	// unlink all entities that were not updated last frame and invalidate the others, the entities are only stored in the default
+	// world so do this once and not for each of the aasworlds
+	AAS_UnlinkInvalidEntities();
 	// do each of the aasworlds
 	for (i = 0; i < MAX_AAS_WORLDS; i++) {
 		AAS_SetCurrentWorld(i);
 
 		(*aasworld).time = time;
-		// unlink all entities that were not updated last frame
-		AAS_UnlinkInvalidEntities();
-		// invalidate the entities
-		AAS_InvalidateEntities();
 		// initialize AAS
 		AAS_ContinueInit(time);
 
 		(*aasworld).frameroutingupdates = 0;
+		(*aasworld).framevisupdates = 0;
 
 		if (botDeveloper) {
 			if (LibVarGetValue("showcacheupdates")) {
@@ -325,6 +325,12 @@ int AAS_Setup(void) {
 	}
 
 	(*aasworld).entities = (aas_entity_t *)GetClearedHunkMemory((*aasworld).maxentities * sizeof(aas_entity_t));
+	// allocate memory for the list with active entities
+	if ((*aasworld).activeentities) {
+		FreeMemory((*aasworld).activeentities);
+	}
+
+	(*aasworld).activeentities = (int *)GetClearedHunkMemory((*aasworld).maxentities * sizeof(int));
 	// invalidate all the entities
 	AAS_InvalidateEntities();
 	// force some recalculations
@@ -378,6 +384,10 @@ void AAS_Shutdown(void) {
 			if ((*aasworld).entities) {
 				FreeMemory((*aasworld).entities);
 			}
+
+			if ((*aasworld).activeentities) {
+				FreeMemory((*aasworld).activeentities);
+			}
 		}
 		// clear the (*aasworld) structure
 		Com_Memset(&(*aasworld), 0, sizeof(aas_t));
@@ -53,6 +53,8 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #define CACHE_REFRESHTIME 15.0f // 15 seconds refresh time
 // maximum number of routing updates each frame
 #define MAX_FRAMEROUTINGUPDATES 10
+// maximum number of area visibility rows calculated each frame
+#define MAX_FRAMEVISUPDATES 2
 /*
   area routing cache:
   stores the distances within one cluster to a specific goal area
@@ -73,6 +75,12 @@ int numportalcacheupdates;
 #endif // ROUTING_DEBUG
 int routingcachesize;
 int max_routingcachesize;
+// the routing caches of each AAS world are allocated from their own arena
+memoryarena_t routingarenas[MAX_AAS_WORLDS] = {{"routing 0"}, {"routing 1"}};
+
+extern aas_t aasworlds[MAX_AAS_WORLDS];
+
+#define ROUTINGARENA (&routingarenas[aasworld - aasworlds])
 #ifdef ROUTING_DEBUG
 /*
 =======================================================================================================================================
@@ -784,7 +792,7 @@ aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes) {
 
 	size = sizeof(aas_routingcache_t) + numtraveltimes * sizeof(unsigned short int) + numtraveltimes * sizeof(unsigned char);
 	routingcachesize += size;
-	cache = (aas_routingcache_t *)GetClearedMemory(size);
+	cache = (aas_routingcache_t *)GetClearedArenaMemory(ROUTINGARENA, size);
 	cache->reachabilities = (unsigned char *)cache + sizeof(aas_routingcache_t) + numtraveltimes * sizeof(unsigned short int);
 	cache->size = size;
 	return cache;
@@ -948,6 +956,212 @@ void AAS_CreateAllRoutingCache(void) {
 	(*aasworld).initialized = qfalse;
 }
 
+/*
+=======================================================================================================================================
+AAS_CompressVis
+
+Run length encodes the zero bytes of the visibility bits, returns the size of the compressed data.
+=======================================================================================================================================
+*/
+int AAS_CompressVis(byte *vis, int numareas, byte *dest) {
+	int i, rep, numbytes;
+	byte *dest_p;
+
+	dest_p = dest;
+	numbytes = (numareas + 7) >> 3;
+
+	for (i = 0; i < numbytes; i++) {
+		*dest_p++ = vis[i];
+
+		if (vis[i]) {
+			continue;
+		}
+
+		for (rep = 1; i + rep < numbytes && rep < 255; rep++) {
+			if (vis[i + rep]) {
+				break;
+			}
+		}
+
+		*dest_p++ = rep;
+		i += rep - 1;
+	}
+
+	return dest_p - dest;
+}
+
+/*
+=======================================================================================================================================
+AAS_DecompressVis
+=======================================================================================================================================
+*/
+void AAS_DecompressVis(byte *in, int numareas, byte *decompressed) {
+	int c, numbytes;
+	byte *out;
+
+	out = decompressed;
+	numbytes = (numareas + 7) >> 3;
+
+	while (out - decompressed < numbytes) {
+		if (*in) {
+			*out++ = *in++;
+			continue;
+		}
+
+		c = in[1];
+		in += 2;
+
+		while (c-- > 0 && out - decompressed < numbytes) {
+			*out++ = 0;
+		}
+	}
+}
+
+#define MAX_VISSAMPLES 5
+/*
+=======================================================================================================================================
+AAS_AreaVisibilitySamples
+
+Returns the points in the area used to test visibility, the area center and the corners of the area bounds pulled halfway towards the
+center.
+=======================================================================================================================================
+*/
+static int AAS_AreaVisibilitySamples(int areanum, vec3_t *points) {
+	int i, numpoints;
+	aas_area_t *area;
+	vec3_t corner;
+
+	area = &(*aasworld).areas[areanum];
+
+	VectorCopy(area->center, points[0]);
+
+	numpoints = 1;
+
+	for (i = 0; i < 4; i++) {
+		corner[0] = (i & 1) ? area->maxs[0] : area->mins[0];
+		corner[1] = (i & 2) ? area->maxs[1] : area->mins[1];
+		corner[2] = area->center[2];
+
+		VectorAdd(corner, area->center, points[numpoints]);
+		VectorScale(points[numpoints], 0.5f, points[numpoints]);
+		// only use points that are inside the area
+		if (AAS_PointAreaNum(points[numpoints]) != areanum) {
+			continue;
+		}
+
+		numpoints++;
+	}
+
+	return numpoints;
+}
+
+/*
+=======================================================================================================================================
+AAS_CalculateAreaVisibility
+
+Calculates the areas visible from the given area. Two areas are visible if any sample point of one area can see any sample point of
+the other area.
+=======================================================================================================================================
+*/
+void AAS_CalculateAreaVisibility(int srcarea) {
+	int i, j, k, numsrcpoints, numdestpoints, numbytes, size;
+	vec3_t srcpoints[MAX_VISSAMPLES], destpoints[MAX_VISSAMPLES];
+	byte *vis, *compressed;
+	bsp_trace_t trace;
+
+	numbytes = ((*aasworld).numareas + 7) >> 3;
+	vis = (*aasworld).decompressedvis;
+	// the worst case compressed size is two bytes for every zero byte
+	compressed = (byte *)GetMemory(numbytes * 2);
+
+	Com_Memset(vis, 0, numbytes);
+
+	numsrcpoints = AAS_AreaVisibilitySamples(srcarea, srcpoints);
+
+	for (i = 1; i < (*aasworld).numareas; i++) {
+		if (i == srcarea) {
+			vis[i >> 3] |= 1 << (i & 7);
+			continue;
+		}
+		// visibility is symmetric so reuse the rows that were already calculated
+		if ((*aasworld).areavisibility[i]) {
+			AAS_DecompressVis((*aasworld).areavisibility[i], (*aasworld).numareas, compressed);
+
+			if (compressed[srcarea >> 3] & (1 << (srcarea & 7))) {
+				vis[i >> 3] |= 1 << (i & 7);
+			}
+
+			continue;
+		}
+
+		numdestpoints = AAS_AreaVisibilitySamples(i, destpoints);
+
+		for (j = 0; j < numsrcpoints; j++) {
+			for (k = 0; k < numdestpoints; k++) {
+				// the PVS check is a lot cheaper than the trace
+				if (!AAS_inPVS(srcpoints[j], destpoints[k])) {
+					continue;
+				}
+
+				trace = AAS_Trace(srcpoints[j], NULL, NULL, destpoints[k], -1, CONTENTS_SOLID);
+
+				if (trace.fraction >= 1) {
+					break;
+				}
+			}
+
+			if (k < numdestpoints) {
+				vis[i >> 3] |= 1 << (i & 7);
+				break;
+			}
+		}
+	}
+
+	size = AAS_CompressVis(vis, (*aasworld).numareas, compressed);
+
+	(*aasworld).areavisibility[srcarea] = (byte *)GetArenaMemory(ROUTINGARENA, size);
+
+	Com_Memcpy((*aasworld).areavisibility[srcarea], compressed, size);
+	FreeMemory(compressed);
+
+	(*aasworld).decompressedvisarea = srcarea;
+}
+
+/*
+=======================================================================================================================================
+AAS_InitAreaVisibility
+=======================================================================================================================================
+*/
+void AAS_InitAreaVisibility(void) {
+
+	(*aasworld).areavisibility = (byte **)GetClearedMemory((*aasworld).numareas * sizeof(byte *));
+	(*aasworld).decompressedvis = (byte *)GetClearedMemory(((*aasworld).numareas + 7) >> 3);
+	(*aasworld).decompressedvisarea = 0;
+}
+
+/*
+=======================================================================================================================================
+AAS_CreateAllAreaVisibility
+=======================================================================================================================================
+*/
+int AAS_CreateAllAreaVisibility(void) {
+	int i, numcreated;
+
+	numcreated = 0;
+
+	for (i = 1; i < (*aasworld).numareas; i++) {
+		if ((*aasworld).areavisibility[i]) {
+			continue;
+		}
+
+		AAS_CalculateAreaVisibility(i);
+
+		numcreated++;
+	}
+
+	return numcreated;
+}
+
 // the route cache header
 // this header is followed by numportalcache + numareacache aas_routingcache_t
 // structures that store routing cache
@@ -963,10 +1177,7 @@ typedef struct routecacheheader_s {
 } routecacheheader_t;
 
 #define RCID (('C' << 24) + ('R' << 16) + ('E' << 8) + 'M')
-#define RCVERSION 2
-
-//void AAS_DecompressVis(byte *in, int numareas, byte *decompressed);
-//int AAS_CompressVis(byte *vis, int numareas, byte *dest);
+#define RCVERSION 3
 
 /*
 =======================================================================================================================================
@@ -974,8 +1185,9 @@ AAS_WriteRouteCache
 =======================================================================================================================================
 */
 void AAS_WriteRouteCache(void) {
-	int i, j, numportalcache, numareacache, totalsize;
+	int i, j, numportalcache, numareacache, totalsize, size;
 	aas_routingcache_t *cache;
+	byte *compressedvis;
 	aas_cluster_t *cluster;
 	fileHandle_t fp;
 	char filename[MAX_QPATH];
@@ -1009,6 +1221,8 @@ void AAS_WriteRouteCache(void) {
 		AAS_Error("Unable to open file: %s\n", filename);
 		return;
 	}
+
+	compressedvis = (byte *)GetMemory((((*aasworld).numareas + 7) >> 3) * 2);
 	// create the header
 	routecacheheader.ident = RCID;
 	routecacheheader.version = RCVERSION;
@@ -1040,8 +1254,7 @@ void AAS_WriteRouteCache(void) {
 			}
 		}
 	}
-	// write the visareas
-	/*
+	// write the visareas, areas for which the visibility wasn't calculated yet are written with size zero
 	for (i = 0; i < (*aasworld).numareas; i++) {
 		if (!(*aasworld).areavisibility[i]) {
 			size = 0;
@@ -1051,12 +1264,15 @@ void AAS_WriteRouteCache(void) {
 
 		AAS_DecompressVis((*aasworld).areavisibility[i], (*aasworld).numareas, (*aasworld).decompressedvis);
 
-		size = AAS_CompressVis((*aasworld).decompressedvis, (*aasworld).numareas, (*aasworld).decompressedvis);
+		size = AAS_CompressVis((*aasworld).decompressedvis, (*aasworld).numareas, compressedvis);
 
 		botimport.FS_Write(&size, sizeof(int), fp);
-		botimport.FS_Write((*aasworld).decompressedvis, size, fp);
+		botimport.FS_Write(compressedvis, size, fp);
 	}
-	*/
+
+	FreeMemory(compressedvis);
+	// the decompressed vis buffer was overwritten
+	(*aasworld).decompressedvisarea = 0;
 	botimport.FS_FCloseFile(fp);
 	botimport.Print(PRT_MESSAGE, "\nroute cache written to %s\n", filename);
 	botimport.Print(PRT_MESSAGE, "written %d bytes of routing cache\n", totalsize);
@@ -1072,7 +1288,7 @@ aas_routingcache_t *AAS_ReadCache(fileHandle_t fp) {
 	aas_routingcache_t *cache;
 
 	botimport.FS_Read(&size, sizeof(size), fp);
-	cache = (aas_routingcache_t *)GetMemory(size);
+	cache = (aas_routingcache_t *)GetArenaMemory(ROUTINGARENA, size);
 	cache->size = size;
 	botimport.FS_Read((unsigned char *)cache + sizeof(size), size - sizeof(size), fp);
 	cache->reachabilities = (unsigned char *)cache + sizeof(aas_routingcache_t) - sizeof(unsigned short) + (size - sizeof(aas_routingcache_t) + sizeof(unsigned short)) / 3 * 2;
@@ -1085,7 +1301,7 @@ AAS_ReadRouteCache
 =======================================================================================================================================
 */
 int AAS_ReadRouteCache(void) {
-	int i, clusterareanum; //size
+	int i, clusterareanum, size;
 	fileHandle_t fp;
 	char filename[MAX_QPATH];
 	routecacheheader_t routecacheheader;
@@ -1155,19 +1371,14 @@ int AAS_ReadRouteCache(void) {
 		(*aasworld).clusterareacache[cache->cluster][clusterareanum] = cache;
 	}
 	// read the visareas
-	/*
-	(*aasworld).areavisibility = (byte **)GetClearedMemory((*aasworld).numareas * sizeof(byte *));
-	(*aasworld).decompressedvis = (byte *)GetClearedMemory((*aasworld).numareas * sizeof(byte));
-
 	for (i = 0; i < (*aasworld).numareas; i++) {
 		botimport.FS_Read(&size, sizeof(size), fp);
 
 		if (size) {
-			(*aasworld).areavisibility[i] = (byte *)GetMemory(size);
+			(*aasworld).areavisibility[i] = (byte *)GetArenaMemory(ROUTINGARENA, size);
 			botimport.FS_Read((*aasworld).areavisibility[i], size, fp);
 		}
 	}
-	*/
 	botimport.FS_FCloseFile(fp);
 	return qtrue;
 }
@@ -1292,6 +1503,8 @@ void AAS_InitRouting(void) {
 	AAS_InitPortalMaxTravelTimes();
 	// get the areas reachabilities go through
 	AAS_InitReachabilityAreas();
+	// initialize the area visibility
+	AAS_InitAreaVisibility();
 #ifdef ROUTING_DEBUG
 	numareacacheupdates = 0;
 	numportalcacheupdates = 0;
@@ -1300,6 +1513,12 @@ void AAS_InitRouting(void) {
 	max_routingcachesize = 1024 * (int)LibVarValue("max_routingcache", "4096");
 	// read any routing cache if available
 	AAS_ReadRouteCache();
+	// calculate the visibility between all areas up front and store it with the route cache
+	if ((int)LibVarValue("precomputevis", "0")) {
+		if (AAS_CreateAllAreaVisibility()) {
+			AAS_WriteRouteCache();
+		}
+	}
 }
 
 /*
@@ -1361,6 +1580,20 @@ void AAS_FreeRoutingCaches(void) {
 	}
 
 	(*aasworld).areacontentstravelflags = NULL;
+	// free the area visibility, the compressed rows are released with the routing cache memory
+	if ((*aasworld).areavisibility) {
+		FreeMemory((*aasworld).areavisibility);
+	}
+
+	(*aasworld).areavisibility = NULL;
+
+	if ((*aasworld).decompressedvis) {
+		FreeMemory((*aasworld).decompressedvis);
+	}
+
+	(*aasworld).decompressedvis = NULL;
+	// release all the routing cache memory at once
+	FreeMemoryArena(ROUTINGARENA);
 }
 
 /*
@@ -2213,10 +2446,40 @@ int AAS_RandomGoalArea(int areanum, int travelflags, int *goalareanum, vec3_t go
 /*
 =======================================================================================================================================
 AAS_AreaVisible
+
+Rows are calculated on first use, at most MAX_FRAMEVISUPDATES each frame. Until its row exists an area counts as not visible, set the
+"precomputevis" libvar to calculate all rows at load time instead.
 =======================================================================================================================================
 */
 int AAS_AreaVisible(int srcarea, int destarea) {
-	return qfalse;
+
+	if (srcarea <= 0 || srcarea >= (*aasworld).numareas || destarea <= 0 || destarea >= (*aasworld).numareas) {
+		return qfalse;
+	}
+
+	if (srcarea == destarea) {
+		return qtrue;
+	}
+
+	if (!(*aasworld).areavisibility) {
+		return qfalse;
+	}
+
+	if (!(*aasworld).areavisibility[srcarea]) {
+		// a row traces against every other area, don't let a burst of queries stall the frame
+		if ((*aasworld).framevisupdates >= MAX_FRAMEVISUPDATES) {
+			return qfalse;
+		}
+
+		(*aasworld).framevisupdates++;
+
+		AAS_CalculateAreaVisibility(srcarea);
+	} else if ((*aasworld).decompressedvisarea != srcarea) {
+		AAS_DecompressVis((*aasworld).areavisibility[srcarea], (*aasworld).numareas, (*aasworld).decompressedvis);
+		(*aasworld).decompressedvisarea = srcarea;
+	}
+
+	return ((*aasworld).decompressedvis[destarea >> 3] & (1 << (destarea & 7))) != 0;
 }
 
 /*
@@ -32,6 +32,8 @@ unsigned short int AAS_AreaTravelTime(int areanum, vec3_t start, vec3_t end);
 void AAS_CreateAllRoutingCache(void);
 void AAS_WriteRouteCache(void);
 void AAS_RoutingInfo(void);
+// calculates the visibility of all areas that don't have it yet, returns the number of areas calculated
+int AAS_CreateAllAreaVisibility(void);
 #endif // AASINTERN
 // returns the travel flag for the given travel type
 int AAS_TravelFlagForType(int traveltype);
@@ -53,5 +55,7 @@ int AAS_AreaTravelTimeToGoalArea(int areanum, vec3_t origin, int goalareanum, in
 int AAS_AreaTravelTimeToGoalAreaCheckLoop(int areanum, vec3_t origin, int goalareanum, int travelflags, int loopareanum);
 // predict a route up to a stop event
 int AAS_PredictRoute(struct aas_predictroute_s *route, int areanum, vec3_t origin, int goalareanum, int travelflags, int maxareas, int maxtime, int stopevent, int stopcontents, int stoptfl, int stopareanum);
+// returns qtrue if the destination area is visible from the source area
+int AAS_AreaVisible(int srcarea, int destarea);
 // route to goal area
 int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime, int *reachnum);
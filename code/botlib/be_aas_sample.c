@@ -1268,13 +1268,59 @@ typedef struct {
 
 /*
 =======================================================================================================================================
-AAS_AASLinkEntity
+AAS_BoxOnPlaneSideMargin
+
+Same as AAS_BoxOnPlaneSide2 but also lowers the margin to the distance the box can move before the returned sides change.
+=======================================================================================================================================
+*/
+static int AAS_BoxOnPlaneSideMargin(vec3_t absmins, vec3_t absmaxs, aas_plane_t *p, float *margin) {
+	int i, sides;
+	float dist1, dist2;
+	vec3_t corners[2];
+
+	for (i = 0; i < 3; i++) {
+		if (p->normal[i] < 0) {
+			corners[0][i] = absmins[i];
+			corners[1][i] = absmaxs[i];
+		} else {
+			corners[1][i] = absmins[i];
+			corners[0][i] = absmaxs[i];
+		}
+	}
+
+	dist1 = DotProduct(p->normal, corners[0]) - p->dist;
+	dist2 = DotProduct(p->normal, corners[1]) - p->dist;
+	sides = 0;
+
+	if (dist1 >= 0) {
+		sides = 1;
+	}
+
+	if (dist2 < 0) {
+		sides |= 2;
+	}
+
+	if (fabsf(dist1) < *margin) {
+		*margin = fabsf(dist1);
+	}
+
+	if (fabsf(dist2) < *margin) {
+		*margin = fabsf(dist2);
+	}
+
+	return sides;
+}
+
+/*
+=======================================================================================================================================
+AAS_LinkEntityAreas
 
 Link the entity to the areas the bounding box is totally or partly situated in.
 This is done with recursion down the tree using the bounding box to test for plane sides.
+When margin is not NULL it is set to the distance the box can move without changing the areas it is linked to.
 =======================================================================================================================================
 */
-aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
+static aas_link_t *AAS_LinkEntityAreas(vec3_t absmins, vec3_t absmaxs, int entnum, float *margin) {
 	int side, nodenum;
 	aas_linkstack_t linkstack[128];
 	aas_linkstack_t *lstack_p;
@@ -1288,6 +1334,11 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
 	}
 
 	areas = NULL;
+
+	if (margin) {
+		*margin = 99999;
+	}
+
 	lstack_p = linkstack;
 	// we start with the whole line on the stack
 	// start with node 1 because node zero is a dummy used for solid leafs
@@ -1319,6 +1370,10 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
 			link = AAS_AllocAASLink();
 
 			if (!link) {
+				if (margin) {
+					*margin = 0;
+				}
+
 				return areas;
 			}
 
@@ -1353,7 +1408,11 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
 		// the current node plane
 		plane = &(*aasworld).planes[aasnode->planenum];
 		// get the side(s) the box is situated relative to the plane
-		side = AAS_BoxOnPlaneSide2(absmins, absmaxs, plane);
+		if (margin) {
+			side = AAS_BoxOnPlaneSideMargin(absmins, absmaxs, plane, margin);
+		} else {
+			side = AAS_BoxOnPlaneSide2(absmins, absmaxs, plane);
+		}
 		// if on the front side of the node
 		if (side & 1) {
 			lstack_p->nodenum = aasnode->children[0];
@@ -1362,6 +1421,11 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
 
 		if (lstack_p >= &linkstack[127]) {
 			botimport.Print(PRT_ERROR, "AAS_LinkEntity: stack overflow\n");
+
+			if (margin) {
+				*margin = 0;
+			}
+
 			break;
 		}
 		// if on the back side of the node
@@ -1372,6 +1436,11 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
 
 		if (lstack_p >= &linkstack[127]) {
 			botimport.Print(PRT_ERROR, "AAS_LinkEntity: stack overflow\n");
+
+			if (margin) {
+				*margin = 0;
+			}
+
 			break;
 		}
 	}
@@ -1379,12 +1448,32 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
 	return areas;
 }
 
+/*
+=======================================================================================================================================
+AAS_AASLinkEntity
+=======================================================================================================================================
+*/
+aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum) {
+	return AAS_LinkEntityAreas(absmins, absmaxs, entnum, NULL);
+}
+
 /*
 =======================================================================================================================================
 AAS_LinkEntityClientBBox
 =======================================================================================================================================
 */
 aas_link_t *AAS_LinkEntityClientBBox(vec3_t absmins, vec3_t absmaxs, int entnum, int presencetype) {
+	return AAS_LinkEntityClientBBoxMargin(absmins, absmaxs, entnum, presencetype, NULL);
+}
+
+/*
+=======================================================================================================================================
+AAS_LinkEntityClientBBoxMargin
+
+When margin is not NULL it is set to the distance the entity can move without changing the areas it is linked to.
+=======================================================================================================================================
+*/
+aas_link_t *AAS_LinkEntityClientBBoxMargin(vec3_t absmins, vec3_t absmaxs, int entnum, int presencetype, float *margin) {
 	vec3_t mins, maxs;
 	vec3_t newabsmins, newabsmaxs;
 
@@ -1392,7 +1481,7 @@ aas_link_t *AAS_LinkEntityClientBBox(vec3_t absmins, vec3_t absmaxs, int entnum,
 	VectorSubtract(absmins, maxs, newabsmins);
 	VectorSubtract(absmaxs, mins, newabsmaxs);
 	// relink the entity
-	return AAS_AASLinkEntity(newabsmins, newabsmaxs, entnum);
+	return AAS_LinkEntityAreas(newabsmins, newabsmaxs, entnum, margin);
 }
 
 /*
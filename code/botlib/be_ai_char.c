@@ -34,6 +34,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include "l_precomp.h"
 #include "l_struct.h"
 #include "l_libvar.h"
+#include "l_cache.h"
 #include "aasfile.h"
 #include "botlib.h"
 #include "be_aas.h"
@@ -270,6 +271,137 @@ void BotDefaultCharacteristics(bot_character_t *ch, bot_character_t *defaultch)
 	}
 }
 
+/*
+=======================================================================================================================================
+BotWriteCharacterCache
+=======================================================================================================================================
+*/
+static void BotWriteCharacterCache(char *charfile, int skill, bot_character_t *ch) {
+	botcache_t *cache;
+	char variant[32];
+	int i, numcharacteristics;
+
+	Com_sprintf(variant, sizeof(variant), "skill%d", skill);
+
+	cache = Cache_OpenWrite(CACHE_CHARACTER, charfile, variant);
+
+	if (!cache) {
+		return;
+	}
+	// also cache a missing skill so the file isn't parsed again to find out
+	Cache_WriteInt(cache, ch != NULL);
+
+	if (ch) {
+		Cache_WriteFloat(cache, ch->skill);
+
+		numcharacteristics = 0;
+
+		for (i = 0; i < MAX_CHARACTERISTICS; i++) {
+			if (ch->c[i].type) {
+				numcharacteristics++;
+			}
+		}
+
+		Cache_WriteInt(cache, numcharacteristics);
+
+		for (i = 0; i < MAX_CHARACTERISTICS; i++) {
+			if (!ch->c[i].type) {
+				continue;
+			}
+
+			Cache_WriteInt(cache, i);
+			Cache_WriteInt(cache, ch->c[i].type);
+
+			switch (ch->c[i].type) {
+				case CT_INTEGER:
+					Cache_WriteInt(cache, ch->c[i].value.integer);
+					break;
+				case CT_FLOAT:
+					Cache_WriteFloat(cache, ch->c[i].value._float);
+					break;
+				case CT_STRING:
+					Cache_WriteString(cache, ch->c[i].value.string);
+					break;
+			}
+		}
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+BotReadCharacterCache
+
+Returns qtrue if the character was found in the cache, ch is set to NULL when the cache says the file doesn't have the skill.
+=======================================================================================================================================
+*/
+static qboolean BotReadCharacterCache(char *charfile, int skill, bot_character_t **ch) {
+	botcache_t *cache;
+	char variant[32], *string;
+	int i, numcharacteristics, index, type;
+
+	Com_sprintf(variant, sizeof(variant), "skill%d", skill);
+
+	cache = Cache_OpenRead(CACHE_CHARACTER, charfile, variant);
+
+	if (!cache) {
+		return qfalse;
+	}
+
+	*ch = NULL;
+
+	if (!Cache_ReadInt(cache)) {
+		Cache_Close(cache);
+		return qtrue;
+	}
+
+	*ch = (bot_character_t *)GetClearedMemory(sizeof(bot_character_t));
+
+	Q_strncpyz((*ch)->filename, charfile, sizeof((*ch)->filename));
+
+	(*ch)->skill = Cache_ReadFloat(cache);
+	numcharacteristics = Cache_ReadInt(cache);
+
+	for (i = 0; i < numcharacteristics && Cache_ReadValid(cache); i++) {
+		index = Cache_ReadInt(cache);
+		type = Cache_ReadInt(cache);
+
+		if (index < 0 || index >= MAX_CHARACTERISTICS || (*ch)->c[index].type) {
+			break;
+		}
+
+		switch (type) {
+			case CT_INTEGER:
+				(*ch)->c[index].value.integer = Cache_ReadInt(cache);
+				break;
+			case CT_FLOAT:
+				(*ch)->c[index].value._float = Cache_ReadFloat(cache);
+				break;
+			case CT_STRING:
+				string = Cache_ReadString(cache);
+				(*ch)->c[index].value.string = GetMemory(strlen(string) + 1);
+				strcpy((*ch)->c[index].value.string, string);
+				break;
+			default:
+				continue;
+		}
+
+		(*ch)->c[index].type = type;
+	}
+
+	if (i < numcharacteristics || !Cache_ReadValid(cache)) {
+		BotFreeCharacterStrings(*ch);
+		FreeMemory(*ch);
+		*ch = NULL;
+		Cache_Close(cache);
+		return qfalse;
+	}
+
+	Cache_Close(cache);
+	return qtrue;
+}
+
 /*
 =======================================================================================================================================
 BotLoadCharacterFromFile
@@ -281,7 +413,14 @@ bot_character_t *BotLoadCharacterFromFile(char *charfile, int skill) {
 	source_t *source;
 	token_t token;
 
+	// try to restore the character from the bot file cache
+	if (BotReadCharacterCache(charfile, skill, &ch)) {
+		return ch;
+	}
+
 	foundcharacter = qfalse;
+
+	Cache_BeginDependencies();
 	// a bot character is parsed in two phases
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
 
@@ -412,9 +551,11 @@ bot_character_t *BotLoadCharacterFromFile(char *charfile, int skill) {
 	if (!foundcharacter) {
 		BotFreeCharacterStrings(ch);
 		FreeMemory(ch);
+		BotWriteCharacterCache(charfile, skill, NULL);
 		return NULL;
 	}
-
+	// store the character in the bot file cache
+	BotWriteCharacterCache(charfile, skill, ch);
 	return ch;
 }
 
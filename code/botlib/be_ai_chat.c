@@ -34,6 +34,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include "l_struct.h"
 #include "l_utils.h"
 #include "l_log.h"
+#include "l_cache.h"
 #include "aasfile.h"
 #include "botlib.h"
 #include "be_aas.h"
@@ -47,6 +48,8 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 // becomes:
 // "hi _rpeople_ _v0_ entered the game"
 
+// maximum number of words in a match filter
+#define MAX_FILTERWORDS 64
 // match piece types
 #define MT_VARIABLE	1 // variable match piece
 #define MT_STRING	2 // string match piece
@@ -104,6 +107,18 @@ typedef struct bot_synonymlist_s {
 	bot_synonym_t *firstsynonym;
 	struct bot_synonymlist_s *next;
 } bot_synonymlist_t;
+// interned word of the match templates and reply chats
+typedef struct bot_chatword_s {
+	char *string;
+	int stamp;							// set when the word is present in the current message
+	struct bot_chatword_s *hashnext;
+} bot_chatword_t;
+// at least one of the words must be present in a message for a match
+typedef struct bot_matchfilter_s {
+	int numwords;
+	bot_chatword_t **words;
+	struct bot_matchfilter_s *next;
+} bot_matchfilter_t;
 // fixed match string
 typedef struct bot_matchstring_s {
 	char *string;
@@ -122,6 +137,7 @@ typedef struct bot_matchtemplate_s {
 	int type;
 	int subtype;
 	bot_matchpiece_t *first;
+	bot_matchfilter_t *filter;
 	struct bot_matchtemplate_s *next;
 } bot_matchtemplate_t;
 // reply chat key
@@ -137,6 +153,7 @@ typedef struct bot_replychat_s {
 	float priority;
 	int numchatmessages;
 	bot_chatmessage_t *firstchatmessage;
+	bot_matchfilter_t *filter;
 	struct bot_replychat_s *next;
 } bot_replychat_t;
 // string list
@@ -168,6 +185,12 @@ typedef struct {
 
 bot_ichatdata_t *ichatdata[MAX_CLIENTS];
 bot_chatstate_t *botchatstates[MAX_CLIENTS + 1];
+// chat states and initial chats are allocated from their own arena
+memoryarena_t chatarena = {"chat"};
+// interned words of the match templates and reply chats
+#define CHATWORD_HASHSIZE 1024
+bot_chatword_t *chatwordhash[CHATWORD_HASHSIZE];
+int chatwordstamp;
 // console message heap
 bot_consolemessage_t *consolemessageheap = NULL;
 bot_consolemessage_t *freeconsolemessages = NULL;
@@ -616,6 +639,149 @@ void BotDumpSynonymList(bot_synonymlist_t *synlist) {
 	}
 }
 
+/*
+=======================================================================================================================================
+BotWriteSynonymsCache
+=======================================================================================================================================
+*/
+static void BotWriteSynonymsCache(const char *filename, bot_synonymlist_t *synlist) {
+	botcache_t *cache;
+	bot_synonymlist_t *syn;
+	bot_synonym_t *synonym;
+	int size, numlists, numsynonyms;
+
+	cache = Cache_OpenWrite(CACHE_SYNONYMS, filename, NULL);
+
+	if (!cache) {
+		return;
+	}
+
+	size = 0;
+	numlists = 0;
+
+	for (syn = synlist; syn; syn = syn->next) {
+		size += sizeof(bot_synonymlist_t);
+		numlists++;
+
+		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next) {
+			size += sizeof(bot_synonym_t) + PAD(strlen(synonym->string) + 1, sizeof(long));
+		}
+	}
+
+	Cache_WriteInt(cache, size);
+	Cache_WriteInt(cache, numlists);
+
+	for (syn = synlist; syn; syn = syn->next) {
+		numsynonyms = 0;
+
+		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next) {
+			numsynonyms++;
+		}
+
+		Cache_WriteInt(cache, (int)syn->context);
+		Cache_WriteInt(cache, numsynonyms);
+
+		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next) {
+			Cache_WriteString(cache, synonym->string);
+			Cache_WriteFloat(cache, synonym->weight);
+		}
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+BotReadSynonymsCache
+=======================================================================================================================================
+*/
+static bot_synonymlist_t *BotReadSynonymsCache(const char *filename) {
+	botcache_t *cache;
+	bot_synonymlist_t *synlist, *lastsyn, *syn;
+	bot_synonym_t *synonym, *lastsynonym;
+	char *block, *ptr, *end, *string;
+	int size, numlists, numsynonyms, i, j;
+	size_t len;
+
+	cache = Cache_OpenRead(CACHE_SYNONYMS, filename, NULL);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	size = Cache_ReadInt(cache);
+	numlists = Cache_ReadInt(cache);
+
+	if (size <= 0 || numlists <= 0 || !Cache_ReadValid(cache)) {
+		Cache_Close(cache);
+		return NULL;
+	}
+	// the synonyms are stored in one block just like when parsed
+	block = (char *)GetClearedHunkMemory(size);
+	ptr = block;
+	end = block + size;
+	synlist = NULL;
+	lastsyn = NULL;
+
+	for (i = 0; i < numlists && Cache_ReadValid(cache); i++) {
+		if (ptr + sizeof(bot_synonymlist_t) > end) {
+			break;
+		}
+
+		syn = (bot_synonymlist_t *)ptr;
+		ptr += sizeof(bot_synonymlist_t);
+		syn->context = (unsigned int)Cache_ReadInt(cache);
+
+		if (lastsyn) {
+			lastsyn->next = syn;
+		} else {
+			synlist = syn;
+		}
+
+		lastsyn = syn;
+		lastsynonym = NULL;
+		numsynonyms = Cache_ReadInt(cache);
+
+		for (j = 0; j < numsynonyms && Cache_ReadValid(cache); j++) {
+			string = Cache_ReadString(cache);
+			len = PAD(strlen(string) + 1, sizeof(long));
+
+			if (ptr + sizeof(bot_synonym_t) + len > end) {
+				break;
+			}
+
+			synonym = (bot_synonym_t *)ptr;
+			ptr += sizeof(bot_synonym_t);
+			synonym->string = ptr;
+			ptr += len;
+			strcpy(synonym->string, string);
+			synonym->weight = Cache_ReadFloat(cache);
+			syn->totalweight += synonym->weight;
+
+			if (lastsynonym) {
+				lastsynonym->next = synonym;
+			} else {
+				syn->firstsynonym = synonym;
+			}
+
+			lastsynonym = synonym;
+		}
+
+		if (j < numsynonyms) {
+			break;
+		}
+	}
+
+	if (i < numlists || !Cache_ReadValid(cache)) {
+		FreeMemory(block);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return synlist;
+}
+
 /*
 =======================================================================================================================================
 BotLoadSynonyms
@@ -630,6 +796,16 @@ bot_synonymlist_t *BotLoadSynonyms(const char *filename) {
 	bot_synonymlist_t *synlist, *lastsyn, *syn;
 	bot_synonym_t *synonym, *lastsynonym;
 
+	// try to restore the synonyms from the bot file cache
+	synlist = BotReadSynonymsCache(filename);
+
+	if (synlist) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from cache\n", filename);
+		return synlist;
+	}
+
+	Cache_BeginDependencies();
+
 	size = 0;
 	synlist = NULL; // make compiler happy
 	syn = NULL; // make compiler happy
@@ -783,6 +959,8 @@ bot_synonymlist_t *BotLoadSynonyms(const char *filename) {
 			return NULL;
 		}
 	}
+	// store the synonyms in the bot file cache
+	BotWriteSynonymsCache(filename, synlist);
 
 	botimport.Print(PRT_MESSAGE, "loaded %s\n", filename);
 
@@ -1010,6 +1188,146 @@ void BotDumpRandomStringList(bot_randomlist_t *randomlist) {
 	}
 }
 
+/*
+=======================================================================================================================================
+BotWriteRandomStringsCache
+=======================================================================================================================================
+*/
+static void BotWriteRandomStringsCache(const char *filename, bot_randomlist_t *randomlist) {
+	botcache_t *cache;
+	bot_randomlist_t *random;
+	bot_randomstring_t *rs;
+	int size, numlists;
+
+	cache = Cache_OpenWrite(CACHE_RANDOMSTRINGS, filename, NULL);
+
+	if (!cache) {
+		return;
+	}
+
+	size = 0;
+	numlists = 0;
+
+	for (random = randomlist; random; random = random->next) {
+		size += sizeof(bot_randomlist_t) + PAD(strlen(random->string) + 1, sizeof(long));
+		numlists++;
+
+		for (rs = random->firstrandomstring; rs; rs = rs->next) {
+			size += sizeof(bot_randomstring_t) + PAD(strlen(rs->string) + 1, sizeof(long));
+		}
+	}
+
+	Cache_WriteInt(cache, size);
+	Cache_WriteInt(cache, numlists);
+
+	for (random = randomlist; random; random = random->next) {
+		Cache_WriteString(cache, random->string);
+		Cache_WriteInt(cache, random->numstrings);
+
+		for (rs = random->firstrandomstring; rs; rs = rs->next) {
+			Cache_WriteString(cache, rs->string);
+		}
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+BotReadRandomStringsCache
+=======================================================================================================================================
+*/
+static bot_randomlist_t *BotReadRandomStringsCache(const char *filename) {
+	botcache_t *cache;
+	bot_randomlist_t *randomlist, *lastrandom, *random;
+	bot_randomstring_t *randomstring, *lastrandomstring;
+	char *block, *ptr, *end, *string;
+	int size, numlists, numstrings, i, j;
+	size_t len;
+
+	cache = Cache_OpenRead(CACHE_RANDOMSTRINGS, filename, NULL);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	size = Cache_ReadInt(cache);
+	numlists = Cache_ReadInt(cache);
+
+	if (size <= 0 || numlists <= 0 || !Cache_ReadValid(cache)) {
+		Cache_Close(cache);
+		return NULL;
+	}
+	// the random strings are stored in one block just like when parsed
+	block = (char *)GetClearedHunkMemory(size);
+	ptr = block;
+	end = block + size;
+	randomlist = NULL;
+	lastrandom = NULL;
+
+	for (i = 0; i < numlists && Cache_ReadValid(cache); i++) {
+		string = Cache_ReadString(cache);
+		len = PAD(strlen(string) + 1, sizeof(long));
+
+		if (ptr + sizeof(bot_randomlist_t) + len > end) {
+			break;
+		}
+
+		random = (bot_randomlist_t *)ptr;
+		ptr += sizeof(bot_randomlist_t);
+		random->string = ptr;
+		ptr += len;
+		strcpy(random->string, string);
+
+		if (lastrandom) {
+			lastrandom->next = random;
+		} else {
+			randomlist = random;
+		}
+
+		lastrandom = random;
+		lastrandomstring = NULL;
+		numstrings = Cache_ReadInt(cache);
+
+		for (j = 0; j < numstrings && Cache_ReadValid(cache); j++) {
+			string = Cache_ReadString(cache);
+			len = PAD(strlen(string) + 1, sizeof(long));
+
+			if (ptr + sizeof(bot_randomstring_t) + len > end) {
+				break;
+			}
+
+			randomstring = (bot_randomstring_t *)ptr;
+			ptr += sizeof(bot_randomstring_t);
+			randomstring->string = ptr;
+			ptr += len;
+			strcpy(randomstring->string, string);
+
+			if (lastrandomstring) {
+				lastrandomstring->next = randomstring;
+			} else {
+				random->firstrandomstring = randomstring;
+			}
+
+			lastrandomstring = randomstring;
+			random->numstrings++;
+		}
+
+		if (j < numstrings) {
+			break;
+		}
+	}
+
+	if (i < numlists || !Cache_ReadValid(cache)) {
+		FreeMemory(block);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return randomlist;
+}
+
 /*
 =======================================================================================================================================
 BotLoadRandomStrings
@@ -1026,6 +1344,16 @@ bot_randomlist_t *BotLoadRandomStrings(const char *filename) {
 #ifdef DEBUG
 	int starttime = botimport.MilliSeconds();
 #endif // DEBUG
+	// try to restore the random strings from the bot file cache
+	randomlist = BotReadRandomStringsCache(filename);
+
+	if (randomlist) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from cache\n", filename);
+		return randomlist;
+	}
+
+	Cache_BeginDependencies();
+
 	size = 0;
 	randomlist = NULL;
 	random = NULL;
@@ -1108,6 +1436,8 @@ bot_randomlist_t *BotLoadRandomStrings(const char *filename) {
 		// free the source after one pass
 		FreeSource(source);
 	}
+	// store the random strings in the bot file cache
+	BotWriteRandomStringsCache(filename, randomlist);
 
 	botimport.Print(PRT_MESSAGE, "loaded %s\n", filename);
 #ifdef DEBUG
@@ -1343,6 +1673,181 @@ void BotFreeMatchTemplates(bot_matchtemplate_t *mt) {
 	}
 }
 
+/*
+=======================================================================================================================================
+BotWriteMatchPiecesCache
+=======================================================================================================================================
+*/
+static void BotWriteMatchPiecesCache(botcache_t *cache, bot_matchpiece_t *matchpieces) {
+	bot_matchpiece_t *mp;
+	bot_matchstring_t *ms;
+	int num;
+
+	num = 0;
+
+	for (mp = matchpieces; mp; mp = mp->next) {
+		num++;
+	}
+
+	Cache_WriteInt(cache, num);
+
+	for (mp = matchpieces; mp; mp = mp->next) {
+		Cache_WriteInt(cache, mp->type);
+		Cache_WriteInt(cache, mp->variable);
+
+		if (mp->type != MT_STRING) {
+			continue;
+		}
+
+		num = 0;
+
+		for (ms = mp->firststring; ms; ms = ms->next) {
+			num++;
+		}
+
+		Cache_WriteInt(cache, num);
+
+		for (ms = mp->firststring; ms; ms = ms->next) {
+			Cache_WriteString(cache, ms->string);
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+BotReadMatchPiecesCache
+=======================================================================================================================================
+*/
+static bot_matchpiece_t *BotReadMatchPiecesCache(botcache_t *cache) {
+	bot_matchpiece_t *matchpiece, *firstpiece, *lastpiece;
+	bot_matchstring_t *matchstring, *lastmatchstring;
+	char *string;
+	int numpieces, numstrings, i, j;
+
+	firstpiece = NULL;
+	lastpiece = NULL;
+	numpieces = Cache_ReadInt(cache);
+
+	for (i = 0; i < numpieces && Cache_ReadValid(cache); i++) {
+		matchpiece = (bot_matchpiece_t *)GetClearedHunkMemory(sizeof(bot_matchpiece_t));
+		matchpiece->type = Cache_ReadInt(cache);
+		matchpiece->variable = Cache_ReadInt(cache);
+
+		if (lastpiece) {
+			lastpiece->next = matchpiece;
+		} else {
+			firstpiece = matchpiece;
+		}
+
+		lastpiece = matchpiece;
+
+		if (matchpiece->type != MT_STRING) {
+			continue;
+		}
+
+		lastmatchstring = NULL;
+		numstrings = Cache_ReadInt(cache);
+
+		for (j = 0; j < numstrings && Cache_ReadValid(cache); j++) {
+			string = Cache_ReadString(cache);
+			matchstring = (bot_matchstring_t *)GetClearedHunkMemory(sizeof(bot_matchstring_t) + strlen(string) + 1);
+			matchstring->string = (char *)matchstring + sizeof(bot_matchstring_t);
+
+			strcpy(matchstring->string, string);
+
+			if (lastmatchstring) {
+				lastmatchstring->next = matchstring;
+			} else {
+				matchpiece->firststring = matchstring;
+			}
+
+			lastmatchstring = matchstring;
+		}
+	}
+
+	return firstpiece;
+}
+
+/*
+=======================================================================================================================================
+BotWriteMatchTemplatesCache
+=======================================================================================================================================
+*/
+static void BotWriteMatchTemplatesCache(const char *matchfile, bot_matchtemplate_t *matches) {
+	botcache_t *cache;
+	bot_matchtemplate_t *mt;
+	int num;
+
+	cache = Cache_OpenWrite(CACHE_MATCHTEMPLATES, matchfile, NULL);
+
+	if (!cache) {
+		return;
+	}
+
+	num = 0;
+
+	for (mt = matches; mt; mt = mt->next) {
+		num++;
+	}
+
+	Cache_WriteInt(cache, num);
+
+	for (mt = matches; mt; mt = mt->next) {
+		Cache_WriteInt(cache, (int)mt->context);
+		Cache_WriteInt(cache, mt->type);
+		Cache_WriteInt(cache, mt->subtype);
+		BotWriteMatchPiecesCache(cache, mt->first);
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+BotReadMatchTemplatesCache
+=======================================================================================================================================
+*/
+static bot_matchtemplate_t *BotReadMatchTemplatesCache(const char *matchfile) {
+	botcache_t *cache;
+	bot_matchtemplate_t *matchtemplate, *matches, *lastmatch;
+	int num, i;
+
+	cache = Cache_OpenRead(CACHE_MATCHTEMPLATES, matchfile, NULL);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	matches = NULL;
+	lastmatch = NULL;
+	num = Cache_ReadInt(cache);
+
+	for (i = 0; i < num && Cache_ReadValid(cache); i++) {
+		matchtemplate = (bot_matchtemplate_t *)GetClearedHunkMemory(sizeof(bot_matchtemplate_t));
+		matchtemplate->context = (unsigned int)Cache_ReadInt(cache);
+		matchtemplate->type = Cache_ReadInt(cache);
+		matchtemplate->subtype = Cache_ReadInt(cache);
+
+		if (lastmatch) {
+			lastmatch->next = matchtemplate;
+		} else {
+			matches = matchtemplate;
+		}
+
+		lastmatch = matchtemplate;
+		matchtemplate->first = BotReadMatchPiecesCache(cache);
+	}
+
+	if (!matches || !Cache_ReadValid(cache)) {
+		BotFreeMatchTemplates(matches);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return matches;
+}
+
 /*
 =======================================================================================================================================
 BotLoadMatchTemplates
@@ -1354,91 +1859,422 @@ bot_matchtemplate_t *BotLoadMatchTemplates(const char *matchfile) {
 	bot_matchtemplate_t *matchtemplate, *matches, *lastmatch;
 	unsigned long int context;
 
+	// try to restore the match templates from the bot file cache
+	matches = BotReadMatchTemplatesCache(matchfile);
+
+	if (matches) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from cache\n", matchfile);
+		return matches;
+	}
+
+	Cache_BeginDependencies();
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
 
-	source = LoadSourceFile(matchfile);
+	source = LoadSourceFile(matchfile);
+
+	if (!source) {
+		botimport.Print(PRT_ERROR, "counldn't load %s\n", matchfile);
+		return NULL;
+	}
+
+	matches = NULL; // list with matches
+	lastmatch = NULL; // last match in the list
+
+	while (PC_ReadToken(source, &token)) {
+		if (token.type != TT_NUMBER || !(token.subtype & TT_INTEGER)) {
+			SourceError(source, "expected integer, found %s", token.string);
+			BotFreeMatchTemplates(matches);
+			FreeSource(source);
+			return NULL;
+		}
+		// the context
+		context = token.intvalue;
+
+		if (!PC_ExpectTokenString(source, "{")) {
+			BotFreeMatchTemplates(matches);
+			FreeSource(source);
+			return NULL;
+		}
+
+		while (PC_ReadToken(source, &token)) {
+			if (!strcmp(token.string, "}")) {
+				break;
+			}
+
+			PC_UnreadLastToken(source);
+
+			matchtemplate = (bot_matchtemplate_t *)GetClearedHunkMemory(sizeof(bot_matchtemplate_t));
+			matchtemplate->context = context;
+			matchtemplate->next = NULL;
+			// add the match template to the list
+			if (lastmatch) {
+				lastmatch->next = matchtemplate;
+			} else {
+				matches = matchtemplate;
+			}
+
+			lastmatch = matchtemplate;
+			// load the match template
+			matchtemplate->first = BotLoadMatchPieces(source, "=");
+
+			if (!matchtemplate->first) {
+				BotFreeMatchTemplates(matches);
+				return NULL;
+			}
+			// read the match type
+			if (!PC_ExpectTokenString(source, "(") || !PC_ExpectTokenType(source, TT_NUMBER, TT_INTEGER, &token)) {
+				BotFreeMatchTemplates(matches);
+				FreeSource(source);
+				return NULL;
+			}
+
+			matchtemplate->type = token.intvalue;
+			// read the match subtype
+			if (!PC_ExpectTokenString(source, ",") || !PC_ExpectTokenType(source, TT_NUMBER, TT_INTEGER, &token)) {
+				BotFreeMatchTemplates(matches);
+				FreeSource(source);
+				return NULL;
+			}
+
+			matchtemplate->subtype = token.intvalue;
+			// read trailing punctuations
+			if (!PC_ExpectTokenString(source, ")") || !PC_ExpectTokenString(source, ";")) {
+				BotFreeMatchTemplates(matches);
+				FreeSource(source);
+				return NULL;
+			}
+		}
+	}
+	// free the source
+	FreeSource(source);
+	// store the match templates in the bot file cache
+	BotWriteMatchTemplatesCache(matchfile, matches);
+
+	botimport.Print(PRT_MESSAGE, "loaded %s\n", matchfile);
+
+	//BotDumpMatchTemplates(matches);
+
+	return matches;
+}
+
+#define IsChatWordChar(c) (isalnum((unsigned char)(c)) || (unsigned char)(c) >= 128)
+/*
+=======================================================================================================================================
+BotChatWordHash
+=======================================================================================================================================
+*/
+static int BotChatWordHash(const char *word, int length) {
+	int i, hash;
+
+	hash = 0;
+
+	for (i = 0; i < length; i++) {
+		hash += toupper(word[i]) * (119 + i);
+	}
+
+	hash = (hash ^ (hash >> 10) ^ (hash >> 20));
+	hash &= (CHATWORD_HASHSIZE - 1);
+	return hash;
+}
+
+/*
+=======================================================================================================================================
+BotFindChatWord
+
+Returns the interned word, the compare is case insensitive just like StringContains.
+=======================================================================================================================================
+*/
+static bot_chatword_t *BotFindChatWord(const char *word, int length) {
+	bot_chatword_t *w;
+	int i;
+
+	for (w = chatwordhash[BotChatWordHash(word, length)]; w; w = w->hashnext) {
+		for (i = 0; i < length; i++) {
+			if (toupper(w->string[i]) != toupper(word[i])) {
+				break;
+			}
+		}
+
+		if (i >= length && !w->string[i]) {
+			return w;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+=======================================================================================================================================
+BotInternChatWord
+=======================================================================================================================================
+*/
+static bot_chatword_t *BotInternChatWord(const char *word, int length) {
+	bot_chatword_t *w;
+	int hash;
+
+	w = BotFindChatWord(word, length);
+
+	if (w) {
+		return w;
+	}
+
+	w = (bot_chatword_t *)GetClearedArenaMemory(&chatarena, sizeof(bot_chatword_t) + length + 1);
+	w->string = (char *)w + sizeof(bot_chatword_t);
+
+	Com_Memcpy(w->string, word, length);
+
+	w->string[length] = '\0';
+	hash = BotChatWordHash(word, length);
+	w->hashnext = chatwordhash[hash];
+	chatwordhash[hash] = w;
+	return w;
+}
+
+/*
+=======================================================================================================================================
+BotLongestChatWord
+
+Returns the longest word in the string. With interior set only words with a non word character on both sides within the string are
+returned, those words are guaranteed to be a whole word in any message that contains the string.
+=======================================================================================================================================
+*/
+static bot_chatword_t *BotLongestChatWord(const char *string, qboolean interior) {
+	const char *ptr, *start, *best;
+	int bestlength;
+
+	best = NULL;
+	bestlength = 0;
+
+	for (ptr = string; *ptr;) {
+		if (!IsChatWordChar(*ptr)) {
+			ptr++;
+			continue;
+		}
+
+		start = ptr;
+
+		while (IsChatWordChar(*ptr)) {
+			ptr++;
+		}
+
+		if (interior && (start == string || !*ptr)) {
+			continue;
+		}
+
+		if (ptr - start > bestlength) {
+			best = start;
+			bestlength = ptr - start;
+		}
+	}
+
+	if (!best) {
+		return NULL;
+	}
+
+	return BotInternChatWord(best, bestlength);
+}
+
+/*
+=======================================================================================================================================
+BotAllocMatchFilter
+=======================================================================================================================================
+*/
+static bot_matchfilter_t *BotAllocMatchFilter(bot_chatword_t **words, int numwords, bot_matchfilter_t *next) {
+	bot_matchfilter_t *filter;
+
+	filter = (bot_matchfilter_t *)GetClearedArenaMemory(&chatarena, sizeof(bot_matchfilter_t) + numwords * sizeof(bot_chatword_t *));
+	filter->numwords = numwords;
+	filter->words = (bot_chatword_t **)((char *)filter + sizeof(bot_matchfilter_t));
+
+	Com_Memcpy(filter->words, words, numwords * sizeof(bot_chatword_t *));
+
+	filter->next = next;
+	return filter;
+}
+
+/*
+=======================================================================================================================================
+BotMatchTemplateFilter
+
+Every string piece of a match template has to be found in the message. When each of the alternative strings of a piece contains a
+whole word then at least one of those words must be present in the message.
+=======================================================================================================================================
+*/
+static bot_matchfilter_t *BotMatchTemplateFilter(bot_matchtemplate_t *mt) {
+	bot_matchpiece_t *mp;
+	bot_matchstring_t *ms;
+	bot_matchfilter_t *filter;
+	bot_chatword_t *words[MAX_FILTERWORDS];
+	int numwords;
+
+	filter = NULL;
+
+	for (mp = mt->first; mp; mp = mp->next) {
+		if (mp->type != MT_STRING) {
+			continue;
+		}
+
+		numwords = 0;
+
+		for (ms = mp->firststring; ms; ms = ms->next) {
+			if (numwords >= MAX_FILTERWORDS) {
+				break;
+			}
+
+			words[numwords] = BotLongestChatWord(ms->string, qtrue);
+
+			if (!words[numwords]) {
+				break;
+			}
+
+			numwords++;
+		}
+		// if not all the strings contain a whole word
+		if (ms) {
+			continue;
+		}
+
+		filter = BotAllocMatchFilter(words, numwords, filter);
+	}
+
+	return filter;
+}
+
+/*
+=======================================================================================================================================
+BotReplyChatFilter
+
+Every word of a reply chat key string must be a whole word in the message. Keys that must be present only filter when they are
+evaluated before any variable keys, those have side effects on the match. The other keys only filter when all of them are strings.
+=======================================================================================================================================
+*/
+static bot_matchfilter_t *BotReplyChatFilter(bot_replychat_t *rchat) {
+	bot_replychatkey_t *key;
+	bot_matchfilter_t *filter;
+	bot_chatword_t *words[MAX_FILTERWORDS];
+	int numwords, stringkey, variables, orfilter;
+
+	filter = NULL;
+	numwords = 0;
+	variables = qfalse;
+	orfilter = qtrue;
+
+	for (key = rchat->keys; key; key = key->next) {
+		stringkey = !(key->flags & (RCKFL_NAME|RCKFL_BOTNAMES|RCKFL_GENDERFEMALE|RCKFL_GENDERMALE|RCKFL_GENDERLESS|RCKFL_VARIABLES)) && (key->flags & RCKFL_STRING);
+
+		if (key->flags & RCKFL_VARIABLES) {
+			variables = qtrue;
+		}
+
+		if (key->flags & RCKFL_AND) {
+			if (stringkey && !variables) {
+				words[0] = BotLongestChatWord(key->string, qfalse);
+
+				if (words[0]) {
+					filter = BotAllocMatchFilter(words, 1, filter);
+				}
+			}
+		} else if (!(key->flags & RCKFL_NOT)) {
+			if (!stringkey || numwords >= MAX_FILTERWORDS) {
+				orfilter = qfalse;
+				continue;
+			}
+
+			words[numwords] = BotLongestChatWord(key->string, qfalse);
+
+			if (!words[numwords]) {
+				orfilter = qfalse;
+				continue;
+			}
+
+			numwords++;
+		}
+	}
+
+	if (orfilter && !variables && numwords) {
+		filter = BotAllocMatchFilter(words, numwords, filter);
+	}
+
+	return filter;
+}
+
+/*
+=======================================================================================================================================
+BotIndexChatWords
+
+Interns the words of the match templates and reply chats and builds the filters used to skip templates and reply chats that can't
+match a message.
+=======================================================================================================================================
+*/
+static void BotIndexChatWords(void) {
+	bot_matchtemplate_t *mt;
+	bot_replychat_t *rchat;
+
+	for (mt = matchtemplates; mt; mt = mt->next) {
+		mt->filter = BotMatchTemplateFilter(mt);
+	}
 
-	if (!source) {
-		botimport.Print(PRT_ERROR, "counldn't load %s\n", matchfile);
-		return NULL;
+	for (rchat = replychats; rchat; rchat = rchat->next) {
+		rchat->filter = BotReplyChatFilter(rchat);
 	}
+}
 
-	matches = NULL; // list with matches
-	lastmatch = NULL; // last match in the list
+/*
+=======================================================================================================================================
+BotMarkChatWords
 
-	while (PC_ReadToken(source, &token)) {
-		if (token.type != TT_NUMBER || !(token.subtype & TT_INTEGER)) {
-			SourceError(source, "expected integer, found %s", token.string);
-			BotFreeMatchTemplates(matches);
-			FreeSource(source);
-			return NULL;
-		}
-		// the context
-		context = token.intvalue;
+Marks the interned words that are present in the message.
+=======================================================================================================================================
+*/
+static void BotMarkChatWords(const char *message) {
+	const char *start;
+	bot_chatword_t *w;
 
-		if (!PC_ExpectTokenString(source, "{")) {
-			BotFreeMatchTemplates(matches);
-			FreeSource(source);
-			return NULL;
+	chatwordstamp++;
+
+	while (*message) {
+		if (!IsChatWordChar(*message)) {
+			message++;
+			continue;
 		}
 
-		while (PC_ReadToken(source, &token)) {
-			if (!strcmp(token.string, "}")) {
-				break;
-			}
+		start = message;
 
-			PC_UnreadLastToken(source);
+		while (IsChatWordChar(*message)) {
+			message++;
+		}
 
-			matchtemplate = (bot_matchtemplate_t *)GetClearedHunkMemory(sizeof(bot_matchtemplate_t));
-			matchtemplate->context = context;
-			matchtemplate->next = NULL;
-			// add the match template to the list
-			if (lastmatch) {
-				lastmatch->next = matchtemplate;
-			} else {
-				matches = matchtemplate;
-			}
+		w = BotFindChatWord(start, message - start);
 
-			lastmatch = matchtemplate;
-			// load the match template
-			matchtemplate->first = BotLoadMatchPieces(source, "=");
+		if (w) {
+			w->stamp = chatwordstamp;
+		}
+	}
+}
 
-			if (!matchtemplate->first) {
-				BotFreeMatchTemplates(matches);
-				return NULL;
-			}
-			// read the match type
-			if (!PC_ExpectTokenString(source, "(") || !PC_ExpectTokenType(source, TT_NUMBER, TT_INTEGER, &token)) {
-				BotFreeMatchTemplates(matches);
-				FreeSource(source);
-				return NULL;
-			}
+/*
+=======================================================================================================================================
+BotMatchFilterPasses
 
-			matchtemplate->type = token.intvalue;
-			// read the match subtype
-			if (!PC_ExpectTokenString(source, ",") || !PC_ExpectTokenType(source, TT_NUMBER, TT_INTEGER, &token)) {
-				BotFreeMatchTemplates(matches);
-				FreeSource(source);
-				return NULL;
-			}
+Returns qfalse when the marked message can't match.
+=======================================================================================================================================
+*/
+static int BotMatchFilterPasses(bot_matchfilter_t *filter) {
+	int i;
 
-			matchtemplate->subtype = token.intvalue;
-			// read trailing punctuations
-			if (!PC_ExpectTokenString(source, ")") || !PC_ExpectTokenString(source, ";")) {
-				BotFreeMatchTemplates(matches);
-				FreeSource(source);
-				return NULL;
+	for (; filter; filter = filter->next) {
+		for (i = 0; i < filter->numwords; i++) {
+			if (filter->words[i]->stamp == chatwordstamp) {
+				break;
 			}
 		}
-	}
-	// free the source
-	FreeSource(source);
-
-	botimport.Print(PRT_MESSAGE, "loaded %s\n", matchfile);
 
-	//BotDumpMatchTemplates(matches);
+		if (i >= filter->numwords) {
+			return qfalse;
+		}
+	}
 
-	return matches;
+	return qtrue;
 }
 
 /*
@@ -1529,6 +2365,8 @@ int BotFindMatch(char *str, bot_match_t *match, unsigned long int context) {
 	while (strlen(match->string) && match->string[strlen(match->string) - 1] == '\n') {
 		match->string[strlen(match->string) - 1] = '\0';
 	}
+	// mark the words in the string to skip the match templates that can't match
+	BotMarkChatWords(match->string);
 	// compare the string with all the match strings
 	for (ms = matchtemplates; ms; ms = ms->next) {
 		if (!(ms->context & context)) {
@@ -1539,6 +2377,10 @@ int BotFindMatch(char *str, bot_match_t *match, unsigned long int context) {
 			match->variables[i].offset = -1;
 		}
 
+		if (!BotMatchFilterPasses(ms->filter)) {
+			continue;
+		}
+
 		if (StringsMatch(ms->first, match)) {
 			match->type = ms->type;
 			match->subtype = ms->subtype;
@@ -1642,7 +2484,7 @@ bot_stringlist_t *BotCheckChatMessageIntegrety(char *message, bot_stringlist_t *
 					if (!RandomString(temp)) {
 						if (!BotFindStringInList(stringlist, temp)) {
 							Log_Write("%s = {\"%s\"} // MISSING RANDOM\r\n", temp, temp);
-							s = GetClearedMemory(sizeof(bot_stringlist_t) + strlen(temp) + 1);
+							s = GetClearedArenaMemory(&chatarena, sizeof(bot_stringlist_t) + strlen(temp) + 1);
 							s->string = (char *)s + sizeof(bot_stringlist_t);
 							strcpy(s->string, temp);
 							s->next = stringlist;
@@ -1925,6 +2767,153 @@ void BotCheckValidReplyChatKeySet(source_t *source, bot_replychatkey_t *keys) {
 	}
 }
 
+/*
+=======================================================================================================================================
+BotWriteReplyChatCache
+=======================================================================================================================================
+*/
+static void BotWriteReplyChatCache(const char *filename, bot_replychat_t *replychatlist) {
+	botcache_t *cache;
+	bot_replychat_t *rp;
+	bot_replychatkey_t *key;
+	bot_chatmessage_t *cm;
+	int num;
+
+	cache = Cache_OpenWrite(CACHE_REPLYCHAT, filename, NULL);
+
+	if (!cache) {
+		return;
+	}
+
+	num = 0;
+
+	for (rp = replychatlist; rp; rp = rp->next) {
+		num++;
+	}
+
+	Cache_WriteInt(cache, num);
+
+	for (rp = replychatlist; rp; rp = rp->next) {
+		num = 0;
+
+		for (key = rp->keys; key; key = key->next) {
+			num++;
+		}
+
+		Cache_WriteInt(cache, num);
+
+		for (key = rp->keys; key; key = key->next) {
+			Cache_WriteInt(cache, key->flags);
+			Cache_WriteString(cache, key->string ? key->string : "");
+			Cache_WriteInt(cache, key->match != NULL);
+
+			if (key->match) {
+				BotWriteMatchPiecesCache(cache, key->match);
+			}
+		}
+
+		Cache_WriteFloat(cache, rp->priority);
+		Cache_WriteInt(cache, rp->numchatmessages);
+
+		for (cm = rp->firstchatmessage; cm; cm = cm->next) {
+			Cache_WriteString(cache, cm->chatmessage);
+		}
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+BotReadReplyChatCache
+=======================================================================================================================================
+*/
+static bot_replychat_t *BotReadReplyChatCache(const char *filename) {
+	botcache_t *cache;
+	bot_replychat_t *replychat, *replychatlist, *lastreplychat;
+	bot_replychatkey_t *key, *lastkey;
+	bot_chatmessage_t *chatmessage, *lastchatmessage;
+	char *string;
+	int numreplychats, numkeys, nummessages, i, j;
+
+	cache = Cache_OpenRead(CACHE_REPLYCHAT, filename, NULL);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	replychatlist = NULL;
+	lastreplychat = NULL;
+	numreplychats = Cache_ReadInt(cache);
+
+	for (i = 0; i < numreplychats && Cache_ReadValid(cache); i++) {
+		replychat = (bot_replychat_t *)GetClearedHunkMemory(sizeof(bot_replychat_t));
+
+		if (lastreplychat) {
+			lastreplychat->next = replychat;
+		} else {
+			replychatlist = replychat;
+		}
+
+		lastreplychat = replychat;
+		lastkey = NULL;
+		numkeys = Cache_ReadInt(cache);
+
+		for (j = 0; j < numkeys && Cache_ReadValid(cache); j++) {
+			key = (bot_replychatkey_t *)GetClearedHunkMemory(sizeof(bot_replychatkey_t));
+
+			if (lastkey) {
+				lastkey->next = key;
+			} else {
+				replychat->keys = key;
+			}
+
+			lastkey = key;
+			key->flags = Cache_ReadInt(cache);
+			string = Cache_ReadString(cache);
+
+			if (key->flags & (RCKFL_STRING|RCKFL_BOTNAMES)) {
+				key->string = (char *)GetClearedHunkMemory(strlen(string) + 1);
+				strcpy(key->string, string);
+			}
+
+			if (Cache_ReadInt(cache)) {
+				key->match = BotReadMatchPiecesCache(cache);
+			}
+		}
+
+		replychat->priority = Cache_ReadFloat(cache);
+		lastchatmessage = NULL;
+		nummessages = Cache_ReadInt(cache);
+
+		for (j = 0; j < nummessages && Cache_ReadValid(cache); j++) {
+			string = Cache_ReadString(cache);
+			chatmessage = (bot_chatmessage_t *)GetClearedHunkMemory(sizeof(bot_chatmessage_t) + strlen(string) + 1);
+			chatmessage->chatmessage = (char *)chatmessage + sizeof(bot_chatmessage_t);
+			strcpy(chatmessage->chatmessage, string);
+			chatmessage->time = -2 * CHATMESSAGE_RECENTTIME;
+
+			if (lastchatmessage) {
+				lastchatmessage->next = chatmessage;
+			} else {
+				replychat->firstchatmessage = chatmessage;
+			}
+
+			lastchatmessage = chatmessage;
+			replychat->numchatmessages++;
+		}
+	}
+
+	if (!replychatlist || !Cache_ReadValid(cache)) {
+		BotFreeReplyChat(replychatlist);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return replychatlist;
+}
+
 /*
 =======================================================================================================================================
 BotLoadReplyChat
@@ -1939,6 +2928,20 @@ bot_replychat_t *BotLoadReplyChat(const char *filename) {
 	bot_replychat_t *replychat, *replychatlist;
 	bot_replychatkey_t *key;
 
+	// try to restore the reply chats from the bot file cache
+	replychatlist = BotReadReplyChatCache(filename);
+
+	if (replychatlist) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from cache\n", filename);
+
+		if (botDeveloper) {
+			BotCheckReplyChatIntegrety(replychatlist);
+		}
+
+		return replychatlist;
+	}
+
+	Cache_BeginDependencies();
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
 
 	source = LoadSourceFile(filename);
@@ -2080,6 +3083,8 @@ bot_replychat_t *BotLoadReplyChat(const char *filename) {
 	}
 
 	FreeSource(source);
+	// store the reply chats in the bot file cache
+	BotWriteReplyChatCache(filename, replychatlist);
 
 	botimport.Print(PRT_MESSAGE, "loaded %s\n", filename);
 
@@ -2122,6 +3127,144 @@ void BotDumpInitialChat(bot_chat_t *chat) {
 	Log_Write("}");
 }
 
+/*
+=======================================================================================================================================
+BotWriteInitialChatCache
+=======================================================================================================================================
+*/
+static void BotWriteInitialChatCache(char *chatfile, char *chatname, bot_chat_t *chat) {
+	botcache_t *cache;
+	bot_chattype_t *t;
+	bot_chatmessage_t *m;
+	int size, numtypes;
+
+	cache = Cache_OpenWrite(CACHE_INITIALCHAT, chatfile, chatname);
+
+	if (!cache) {
+		return;
+	}
+
+	size = sizeof(bot_chat_t);
+	numtypes = 0;
+
+	for (t = chat->types; t; t = t->next) {
+		size += sizeof(bot_chattype_t);
+		numtypes++;
+
+		for (m = t->firstchatmessage; m; m = m->next) {
+			size += sizeof(bot_chatmessage_t) + PAD(strlen(m->chatmessage) + 1, sizeof(long));
+		}
+	}
+
+	Cache_WriteInt(cache, size);
+	Cache_WriteInt(cache, numtypes);
+
+	for (t = chat->types; t; t = t->next) {
+		Cache_WriteString(cache, t->name);
+		Cache_WriteInt(cache, t->numchatmessages);
+
+		for (m = t->firstchatmessage; m; m = m->next) {
+			Cache_WriteString(cache, m->chatmessage);
+		}
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+BotReadInitialChatCache
+=======================================================================================================================================
+*/
+static bot_chat_t *BotReadInitialChatCache(char *chatfile, char *chatname) {
+	botcache_t *cache;
+	bot_chat_t *chat;
+	bot_chattype_t *chattype, *lastchattype;
+	bot_chatmessage_t *chatmessage, *lastchatmessage;
+	char *ptr, *end, *string;
+	int size, numtypes, nummessages, i, j;
+	size_t len;
+
+	cache = Cache_OpenRead(CACHE_INITIALCHAT, chatfile, chatname);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	size = Cache_ReadInt(cache);
+	numtypes = Cache_ReadInt(cache);
+
+	if (size < (int)sizeof(bot_chat_t) || numtypes < 0 || !Cache_ReadValid(cache)) {
+		Cache_Close(cache);
+		return NULL;
+	}
+	// the chat is stored in one block just like when parsed
+	ptr = (char *)GetClearedArenaMemory(&chatarena, size);
+	end = ptr + size;
+	chat = (bot_chat_t *)ptr;
+	ptr += sizeof(bot_chat_t);
+	lastchattype = NULL;
+
+	for (i = 0; i < numtypes && Cache_ReadValid(cache); i++) {
+		if (ptr + sizeof(bot_chattype_t) > end) {
+			break;
+		}
+
+		chattype = (bot_chattype_t *)ptr;
+		ptr += sizeof(bot_chattype_t);
+
+		Q_strncpyz(chattype->name, Cache_ReadString(cache), sizeof(chattype->name));
+
+		if (lastchattype) {
+			lastchattype->next = chattype;
+		} else {
+			chat->types = chattype;
+		}
+
+		lastchattype = chattype;
+		lastchatmessage = NULL;
+		nummessages = Cache_ReadInt(cache);
+
+		for (j = 0; j < nummessages && Cache_ReadValid(cache); j++) {
+			string = Cache_ReadString(cache);
+			len = PAD(strlen(string) + 1, sizeof(long));
+
+			if (ptr + sizeof(bot_chatmessage_t) + len > end) {
+				break;
+			}
+
+			chatmessage = (bot_chatmessage_t *)ptr;
+			ptr += sizeof(bot_chatmessage_t);
+			chatmessage->chatmessage = ptr;
+			ptr += len;
+			strcpy(chatmessage->chatmessage, string);
+			chatmessage->time = -2 * CHATMESSAGE_RECENTTIME;
+
+			if (lastchatmessage) {
+				lastchatmessage->next = chatmessage;
+			} else {
+				chattype->firstchatmessage = chatmessage;
+			}
+
+			lastchatmessage = chatmessage;
+			chattype->numchatmessages++;
+		}
+
+		if (j < nummessages) {
+			break;
+		}
+	}
+
+	if (i < numtypes || !Cache_ReadValid(cache)) {
+		FreeMemory(chat);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return chat;
+}
+
 /*
 =======================================================================================================================================
 BotLoadInitialChat
@@ -2141,13 +3284,23 @@ bot_chat_t *BotLoadInitialChat(char *chatfile, char *chatname) {
 
 	starttime = botimport.MilliSeconds();
 #endif // DEBUG
+	// try to restore the chat from the bot file cache
+	chat = BotReadInitialChatCache(chatfile, chatname);
+
+	if (chat) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from %s (cached)\n", chatname, chatfile);
+		return chat;
+	}
+
+	Cache_BeginDependencies();
+
 	size = 0;
 	foundchat = qfalse;
 	// a bot chat is parsed in two phases
 	for (pass = 0; pass < 2; pass++) {
 		// allocate memory
 		if (pass && size) {
-			ptr = (char *)GetClearedMemory(size);
+			ptr = (char *)GetClearedArenaMemory(&chatarena, size);
 		}
 		// load the source file
 		PC_SetBaseFolder(BOTFILESBASEFOLDER);
@@ -2278,6 +3431,9 @@ bot_chat_t *BotLoadInitialChat(char *chatfile, char *chatname) {
 		}
 	}
 
+	// store the chat in the bot file cache
+	BotWriteInitialChatCache(chatfile, chatname, chat);
+
 	botimport.Print(PRT_MESSAGE, "loaded %s from %s\n", chatname, chatfile);
 
 	//BotDumpInitialChat(chat);
@@ -2369,7 +3525,7 @@ int BotLoadChatFile(int chatstate, char *chatfile, char *chatname) {
 	}
 
 	if (!LibVarGetValue("bot_reloadcharacters")) {
-		ichatdata[avail] = GetClearedMemory(sizeof(bot_ichatdata_t));
+		ichatdata[avail] = GetClearedArenaMemory(&chatarena, sizeof(bot_ichatdata_t));
 		ichatdata[avail]->chat = cs->chat;
 		Q_strncpyz(ichatdata[avail]->chatname, chatname, sizeof(ichatdata[avail]->chatname));
 		Q_strncpyz(ichatdata[avail]->filename, chatfile, sizeof(ichatdata[avail]->filename));
@@ -2795,8 +3951,14 @@ int BotReplyChat(int chatstate, char *message, int mcontext, int vcontext, char
 	bestpriority = -1;
 	bestchatmessage = NULL;
 	bestrchat = NULL;
+	// mark the words in the message to skip the reply chats that can't match
+	BotMarkChatWords(message);
 	// go through all the reply chats
 	for (rchat = replychats; rchat; rchat = rchat->next) {
+		if (!BotMatchFilterPasses(rchat->filter)) {
+			continue;
+		}
+
 		found = qfalse;
 
 		for (key = rchat->keys; key; key = key->next) {
@@ -3072,7 +4234,7 @@ int BotAllocChatState(void) {
 
 	for (i = 1; i <= MAX_CLIENTS; i++) {
 		if (!botchatstates[i]) {
-			botchatstates[i] = GetClearedMemory(sizeof(bot_chatstate_t));
+			botchatstates[i] = GetClearedArenaMemory(&chatarena, sizeof(bot_chatstate_t));
 			return i;
 		}
 	}
@@ -3135,6 +4297,7 @@ int BotSetupChatAI(void) {
 		replychats = BotLoadReplyChat(file);
 	}
 
+	BotIndexChatWords();
 	InitConsoleMessageHeap();
 #ifdef DEBUG
 	botimport.Print(PRT_MESSAGE, "setup chat AI %d msec\n", botimport.MilliSeconds() - starttime);
@@ -3194,4 +4357,7 @@ void BotShutdownChatAI(void) {
 	}
 
 	replychats = NULL;
+	Com_Memset(chatwordhash, 0, sizeof(chatwordhash));
+	// free all remaining chat memory at once
+	FreeMemoryArena(&chatarena);
 }
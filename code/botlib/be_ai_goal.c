@@ -34,6 +34,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include "l_script.h"
 #include "l_precomp.h"
 #include "l_struct.h"
+#include "l_cache.h"
 #include "aasfile.h"
 #include "botlib.h"
 #include "be_aas.h"
@@ -231,6 +232,102 @@ void BotMutateGoalFuzzyLogic(int goalstate, float range) {
 	EvolveWeightConfig(gs->itemweightconfig);
 }
 
+/*
+=======================================================================================================================================
+WriteItemConfigCache
+=======================================================================================================================================
+*/
+static void WriteItemConfigCache(const char *filename, itemconfig_t *ic) {
+	botcache_t *cache;
+	iteminfo_t *ii;
+	int i, j;
+
+	cache = Cache_OpenWrite(CACHE_ITEMCONFIG, filename, NULL);
+
+	if (!cache) {
+		return;
+	}
+
+	Cache_WriteInt(cache, ic->numiteminfo);
+
+	for (i = 0; i < ic->numiteminfo; i++) {
+		ii = &ic->iteminfo[i];
+
+		Cache_WriteString(cache, ii->classname);
+		Cache_WriteString(cache, ii->name);
+		Cache_WriteString(cache, ii->model);
+		Cache_WriteInt(cache, ii->modelindex);
+		Cache_WriteInt(cache, ii->type);
+		Cache_WriteInt(cache, ii->index);
+		Cache_WriteFloat(cache, ii->respawntime);
+
+		for (j = 0; j < 3; j++) {
+			Cache_WriteFloat(cache, ii->mins[j]);
+			Cache_WriteFloat(cache, ii->maxs[j]);
+		}
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+ReadItemConfigCache
+=======================================================================================================================================
+*/
+static itemconfig_t *ReadItemConfigCache(const char *filename, int max_iteminfo) {
+	botcache_t *cache;
+	itemconfig_t *ic;
+	iteminfo_t *ii;
+	int numiteminfo, i, j;
+
+	cache = Cache_OpenRead(CACHE_ITEMCONFIG, filename, NULL);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	numiteminfo = Cache_ReadInt(cache);
+
+	if (numiteminfo < 0 || numiteminfo > max_iteminfo) {
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	ic = (itemconfig_t *)GetClearedHunkMemory(sizeof(itemconfig_t) + max_iteminfo * sizeof(iteminfo_t));
+	ic->iteminfo = (iteminfo_t *)((char *)ic + sizeof(itemconfig_t));
+	ic->numiteminfo = numiteminfo;
+
+	for (i = 0; i < numiteminfo; i++) {
+		ii = &ic->iteminfo[i];
+
+		Q_strncpyz(ii->classname, Cache_ReadString(cache), sizeof(ii->classname));
+		Q_strncpyz(ii->name, Cache_ReadString(cache), sizeof(ii->name));
+		Q_strncpyz(ii->model, Cache_ReadString(cache), sizeof(ii->model));
+
+		ii->modelindex = Cache_ReadInt(cache);
+		ii->type = Cache_ReadInt(cache);
+		ii->index = Cache_ReadInt(cache);
+		ii->respawntime = Cache_ReadFloat(cache);
+
+		for (j = 0; j < 3; j++) {
+			ii->mins[j] = Cache_ReadFloat(cache);
+			ii->maxs[j] = Cache_ReadFloat(cache);
+		}
+
+		ii->number = i;
+	}
+
+	if (!Cache_ReadValid(cache)) {
+		FreeMemory(ic);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return ic;
+}
+
 /*
 =======================================================================================================================================
 LoadItemConfig
@@ -253,6 +350,15 @@ itemconfig_t *LoadItemConfig(const char *filename) {
 	}
 
 	Q_strncpyz(path, filename, sizeof(path));
+	// try to restore the item config from the bot file cache
+	ic = ReadItemConfigCache(path, max_iteminfo);
+
+	if (ic) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from cache\n", path);
+		return ic;
+	}
+
+	Cache_BeginDependencies();
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
 
 	source = LoadSourceFile(path);
@@ -309,6 +415,8 @@ itemconfig_t *LoadItemConfig(const char *filename) {
 	if (!ic->numiteminfo) {
 		botimport.Print(PRT_WARNING, "no item info loaded\n");
 	}
+	// store the item config in the bot file cache
+	WriteItemConfigCache(path, ic);
 
 	botimport.Print(PRT_MESSAGE, "loaded %s\n", path);
 	return ic;
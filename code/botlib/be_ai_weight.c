@@ -34,6 +34,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include "l_precomp.h"
 #include "l_struct.h"
 #include "l_libvar.h"
+#include "l_cache.h"
 #include "aasfile.h"
 #include "botlib.h"
 #include "be_aas.h"
@@ -46,6 +47,8 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #define MAX_WEIGHT_FILES 128
 
 weightconfig_t *weightFileList[MAX_WEIGHT_FILES];
+// fuzzy weights and seperators are allocated from their own arena
+memoryarena_t weightarena = {"weights"};
 
 /*
 =======================================================================================================================================
@@ -227,7 +230,7 @@ fuzzyseperator_t *ReadFuzzySeperators_r(source_t *source) {
 		def = !strcmp(token.string, "default");
 
 		if (def || !strcmp(token.string, "case")) {
-			fs = (fuzzyseperator_t *)GetClearedMemory(sizeof(fuzzyseperator_t));
+			fs = (fuzzyseperator_t *)GetClearedArenaMemory(&weightarena, sizeof(fuzzyseperator_t));
 			fs->index = index;
 
 			if (lastfs) {
@@ -310,7 +313,7 @@ fuzzyseperator_t *ReadFuzzySeperators_r(source_t *source) {
 	if (!founddefault) {
 		SourceWarning(source, "switch without default");
 
-		fs = (fuzzyseperator_t *)GetClearedMemory(sizeof(fuzzyseperator_t));
+		fs = (fuzzyseperator_t *)GetClearedArenaMemory(&weightarena, sizeof(fuzzyseperator_t));
 		fs->index = index;
 		fs->value = MAX_INVENTORYVALUE;
 		fs->weight = 0;
@@ -327,6 +330,145 @@ fuzzyseperator_t *ReadFuzzySeperators_r(source_t *source) {
 	return firstfs;
 }
 
+/*
+=======================================================================================================================================
+WriteFuzzySeperatorsCache_r
+=======================================================================================================================================
+*/
+static void WriteFuzzySeperatorsCache_r(botcache_t *cache, fuzzyseperator_t *firstfs) {
+	fuzzyseperator_t *fs;
+	int numfs;
+
+	numfs = 0;
+
+	for (fs = firstfs; fs; fs = fs->next) {
+		numfs++;
+	}
+
+	Cache_WriteInt(cache, numfs);
+
+	for (fs = firstfs; fs; fs = fs->next) {
+		Cache_WriteInt(cache, fs->index);
+		Cache_WriteInt(cache, fs->value);
+		Cache_WriteInt(cache, fs->type);
+		Cache_WriteFloat(cache, fs->weight);
+		Cache_WriteFloat(cache, fs->minweight);
+		Cache_WriteFloat(cache, fs->maxweight);
+
+		WriteFuzzySeperatorsCache_r(cache, fs->child);
+	}
+}
+
+/*
+=======================================================================================================================================
+WriteWeightConfigCache
+=======================================================================================================================================
+*/
+static void WriteWeightConfigCache(char *filename, weightconfig_t *config) {
+	botcache_t *cache;
+	int i;
+
+	cache = Cache_OpenWrite(CACHE_WEIGHTCONFIG, filename, NULL);
+
+	if (!cache) {
+		return;
+	}
+
+	Cache_WriteInt(cache, config->numweights);
+
+	for (i = 0; i < config->numweights; i++) {
+		Cache_WriteString(cache, config->weights[i].name);
+		WriteFuzzySeperatorsCache_r(cache, config->weights[i].firstseperator);
+	}
+
+	Cache_Close(cache);
+}
+
+/*
+=======================================================================================================================================
+ReadFuzzySeperatorsCache_r
+=======================================================================================================================================
+*/
+static fuzzyseperator_t *ReadFuzzySeperatorsCache_r(botcache_t *cache) {
+	int numfs, i;
+	fuzzyseperator_t *fs, *lastfs, *firstfs;
+
+	firstfs = NULL;
+	lastfs = NULL;
+	numfs = Cache_ReadInt(cache);
+
+	for (i = 0; i < numfs && Cache_ReadValid(cache); i++) {
+		fs = (fuzzyseperator_t *)GetClearedArenaMemory(&weightarena, sizeof(fuzzyseperator_t));
+
+		if (lastfs) {
+			lastfs->next = fs;
+		} else {
+			firstfs = fs;
+		}
+
+		lastfs = fs;
+
+		fs->index = Cache_ReadInt(cache);
+		fs->value = Cache_ReadInt(cache);
+		fs->type = Cache_ReadInt(cache);
+		fs->weight = Cache_ReadFloat(cache);
+		fs->minweight = Cache_ReadFloat(cache);
+		fs->maxweight = Cache_ReadFloat(cache);
+		fs->child = ReadFuzzySeperatorsCache_r(cache);
+	}
+
+	return firstfs;
+}
+
+/*
+=======================================================================================================================================
+ReadWeightConfigCache
+=======================================================================================================================================
+*/
+static weightconfig_t *ReadWeightConfigCache(char *filename) {
+	botcache_t *cache;
+	weightconfig_t *config;
+	char *name;
+	int i;
+
+	cache = Cache_OpenRead(CACHE_WEIGHTCONFIG, filename, NULL);
+
+	if (!cache) {
+		return NULL;
+	}
+
+	config = (weightconfig_t *)GetClearedArenaMemory(&weightarena, sizeof(weightconfig_t));
+	config->numweights = Cache_ReadInt(cache);
+
+	Q_strncpyz(config->filename, filename, sizeof(config->filename));
+
+	if (config->numweights < 0 || config->numweights > MAX_WEIGHTS) {
+		config->numweights = 0;
+		FreeWeightConfig2(config);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	for (i = 0; i < config->numweights; i++) {
+		name = Cache_ReadString(cache);
+
+		config->weights[i].name = (char *)GetClearedArenaMemory(&weightarena, strlen(name) + 1);
+
+		strcpy(config->weights[i].name, name);
+
+		config->weights[i].firstseperator = ReadFuzzySeperatorsCache_r(cache);
+	}
+
+	if (!Cache_ReadValid(cache)) {
+		FreeWeightConfig2(config);
+		Cache_Close(cache);
+		return NULL;
+	}
+
+	Cache_Close(cache);
+	return config;
+}
+
 /*
 =======================================================================================================================================
 ReadWeightConfig
@@ -369,7 +511,22 @@ weightconfig_t *ReadWeightConfig(char *filename) {
 		}
 	}
 
+	// try to restore the weight configuration from the bot file cache
+	config = ReadWeightConfigCache(filename);
+
+	if (config) {
+		botimport.Print(PRT_MESSAGE, "loaded %s from cache\n", filename);
+
+		if (!LibVarGetValue("bot_reloadcharacters")) {
+			weightFileList[avail] = config;
+		}
+
+		return config;
+	}
+
+	Cache_BeginDependencies();
 	PC_SetBaseFolder(BOTFILESBASEFOLDER);
+
 	source = LoadSourceFile(filename);
 
 	if (!source) {
@@ -377,7 +534,7 @@ weightconfig_t *ReadWeightConfig(char *filename) {
 		return NULL;
 	}
 
-	config = (weightconfig_t *)GetClearedMemory(sizeof(weightconfig_t));
+	config = (weightconfig_t *)GetClearedArenaMemory(&weightarena, sizeof(weightconfig_t));
 	config->numweights = 0;
 
 	Q_strncpyz(config->filename, filename, sizeof(config->filename));
@@ -397,7 +554,7 @@ weightconfig_t *ReadWeightConfig(char *filename) {
 
 			StripDoubleQuotes(token.string);
 
-			config->weights[config->numweights].name = (char *)GetClearedMemory(strlen(token.string) + 1);
+			config->weights[config->numweights].name = (char *)GetClearedArenaMemory(&weightarena, strlen(token.string) + 1);
 
 			strcpy(config->weights[config->numweights].name, token.string);
 
@@ -430,7 +587,7 @@ weightconfig_t *ReadWeightConfig(char *filename) {
 
 				config->weights[config->numweights].firstseperator = fs;
 			} else if (!strcmp(token.string, "return")) {
-				fs = (fuzzyseperator_t *)GetClearedMemory(sizeof(fuzzyseperator_t));
+				fs = (fuzzyseperator_t *)GetClearedArenaMemory(&weightarena, sizeof(fuzzyseperator_t));
 				fs->index = 0;
 				fs->value = MAX_INVENTORYVALUE;
 				fs->next = NULL;
@@ -469,6 +626,8 @@ weightconfig_t *ReadWeightConfig(char *filename) {
 	}
 	// free the source at the end of a pass
 	FreeSource(source);
+	// store the weight configuration in the bot file cache
+	WriteWeightConfigCache(filename, config);
 	// if the file was located in a pak file
 	botimport.Print(PRT_MESSAGE, "loaded %s\n", filename);
 #ifdef DEBUG
@@ -1070,4 +1229,6 @@ void BotShutdownWeights(void) {
 			weightFileList[i] = NULL;
 		}
 	}
+	// free all remaining weight memory at once
+	FreeMemoryArena(&weightarena);
 }
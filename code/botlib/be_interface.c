@@ -197,6 +197,8 @@ int Export_BotLibShutdown(void) {
 	botlibglobals.botlibsetup = qfalse;
 	// print any files still open
 	PC_CheckOpenSourceHandles();
+	// free the script and precompiler memory
+	PC_FreeScriptMemory();
 	return BLERR_NOERROR;
 }
 
@@ -0,0 +1,467 @@
+/*
+=======================================================================================================================================
+Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+
+This file is part of Spearmint Source Code.
+
+Spearmint Source Code is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License, or (at your option) any later version.
+
+Spearmint Source Code is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Spearmint Source Code.
+If not, see <http://www.gnu.org/licenses/>.
+
+In addition, Spearmint Source Code is also subject to certain additional terms. You should have received a copy of these additional
+terms immediately following the terms and conditions of the GNU General Public License. If not, please request a copy in writing from
+id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o
+ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+=======================================================================================================================================
+*/
+
+/**************************************************************************************************************************************
+ Binary cache for parsed bot files.
+
+ Bot character, chat, weight and item files are run through the pre compiler every time they are loaded. The parsed structures are
+ stored in a cache file which is keyed by the size and the CRC of every script file that was loaded while parsing (the file itself and
+ all included files). As long as none of these files changed the structures are restored from the cache with a single file read.
+**************************************************************************************************************************************/
+
+#include "../qcommon/q_shared.h"
+#include "l_memory.h"
+#include "l_script.h"
+#include "l_precomp.h"
+#include "l_libvar.h"
+#include "l_crc.h"
+#include "l_cache.h"
+#include "aasfile.h"
+#include "botlib.h"
+#include "be_aas.h"
+#include "be_interface.h"
+
+#define MAX_CACHEDEPENDENCIES 32
+#define CACHE_HEADERINTS 6
+// script file a cache depends on
+typedef struct cachedependency_s {
+	char filename[MAX_QPATH];
+	int length;
+	int crc;
+} cachedependency_t;
+
+cachedependency_t cachedependencies[MAX_CACHEDEPENDENCIES];
+int numcachedependencies;
+qboolean cachedependencyoverflow;
+qboolean cacherecording;
+
+/*
+=======================================================================================================================================
+Cache_Enabled
+=======================================================================================================================================
+*/
+static qboolean Cache_Enabled(void) {
+
+	if (!LibVarValue("bot_filecache", "1")) {
+		return qfalse;
+	}
+	// global defines change the outcome of parsing without changing any of the files
+	if (PC_NumGlobalDefines()) {
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+Cache_FileName
+=======================================================================================================================================
+*/
+static void Cache_FileName(char *cachename, int size, const char *filename, const char *variant) {
+	char *ptr;
+
+	if (variant && *variant) {
+		Com_sprintf(cachename, size, "%s/%s_%s.bc", BOTCACHEBASEFOLDER, filename, variant);
+	} else {
+		Com_sprintf(cachename, size, "%s/%s.bc", BOTCACHEBASEFOLDER, filename);
+	}
+	// keep the cache file inside the cache folder
+	for (ptr = cachename; *ptr; ptr++) {
+		if (*ptr == '\\' || *ptr == ':') {
+			*ptr = '/';
+		} else if (*ptr == ' ') {
+			*ptr = '_';
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+Cache_BeginDependencies
+=======================================================================================================================================
+*/
+void Cache_BeginDependencies(void) {
+
+	numcachedependencies = 0;
+	cachedependencyoverflow = qfalse;
+	cacherecording = qtrue;
+}
+
+/*
+=======================================================================================================================================
+Cache_AddDependency
+=======================================================================================================================================
+*/
+void Cache_AddDependency(const char *filename, const char *buffer, int length) {
+	int i;
+
+	if (!cacherecording) {
+		return;
+	}
+	// files parsed in multiple passes are only stored once
+	for (i = 0; i < numcachedependencies; i++) {
+		if (!Q_stricmp(cachedependencies[i].filename, filename)) {
+			return;
+		}
+	}
+
+	if (numcachedependencies >= MAX_CACHEDEPENDENCIES) {
+		cachedependencyoverflow = qtrue;
+		return;
+	}
+
+	Q_strncpyz(cachedependencies[numcachedependencies].filename, filename, sizeof(cachedependencies[numcachedependencies].filename));
+
+	cachedependencies[numcachedependencies].length = length;
+	cachedependencies[numcachedependencies].crc = CRC_ProcessString((unsigned char *)buffer, length);
+
+	numcachedependencies++;
+}
+
+/*
+=======================================================================================================================================
+Cache_DependencyValid
+=======================================================================================================================================
+*/
+static qboolean Cache_DependencyValid(const char *filename, int length, int crc) {
+	fileHandle_t fp;
+	unsigned char *buffer;
+	int filelength, filecrc;
+
+	filelength = botimport.FS_FOpenFile(filename, &fp, FS_READ);
+
+	if (!fp) {
+		return qfalse;
+	}
+
+	if (filelength != length) {
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	}
+
+	buffer = (unsigned char *)GetMemory(filelength + 1);
+
+	botimport.FS_Read(buffer, filelength, fp);
+	botimport.FS_FCloseFile(fp);
+
+	filecrc = CRC_ProcessString(buffer, filelength);
+
+	FreeMemory(buffer);
+	return filecrc == crc;
+}
+
+/*
+=======================================================================================================================================
+Cache_OpenRead
+=======================================================================================================================================
+*/
+botcache_t *Cache_OpenRead(int type, const char *filename, const char *variant) {
+	fileHandle_t fp;
+	botcache_t *cache;
+	int length, header[CACHE_HEADERINTS], i, numdependencies, deplength, depcrc;
+	char *depname;
+
+	if (!Cache_Enabled()) {
+		return NULL;
+	}
+
+	cache = (botcache_t *)GetClearedMemory(sizeof(botcache_t));
+	cache->type = type;
+
+	Cache_FileName(cache->filename, sizeof(cache->filename), filename, variant);
+
+	length = botimport.FS_FOpenFile(cache->filename, &fp, FS_READ);
+
+	if (!fp) {
+		FreeMemory(cache);
+		return NULL;
+	}
+
+	if (length < (int)sizeof(header)) {
+		botimport.FS_FCloseFile(fp);
+		FreeMemory(cache);
+		return NULL;
+	}
+	// read the whole cache in one go
+	cache->buffer = (char *)GetMemory(length);
+	cache->size = length;
+
+	botimport.FS_Read(cache->buffer, length, fp);
+	botimport.FS_FCloseFile(fp);
+	// check the header
+	Cache_ReadData(cache, header, sizeof(header));
+
+	for (i = 0; i < CACHE_HEADERINTS; i++) {
+		header[i] = LittleLong(header[i]);
+	}
+
+	if (header[0] != BOTCACHEID || header[1] != BOTCACHEVERSION || header[2] != type) {
+		Cache_Close(cache);
+		return NULL;
+	}
+	// check the data integrity
+	if (header[4] != length - (int)sizeof(header) || header[5] != CRC_ProcessString((unsigned char *)cache->buffer + sizeof(header), header[4])) {
+		botimport.Print(PRT_WARNING, "bot cache %s is corrupt\n", cache->filename);
+		Cache_Close(cache);
+		return NULL;
+	}
+	// check if any of the script files changed since the cache was written
+	numdependencies = header[3];
+
+	for (i = 0; i < numdependencies; i++) {
+		depname = Cache_ReadString(cache);
+		deplength = Cache_ReadInt(cache);
+		depcrc = Cache_ReadInt(cache);
+
+		if (!Cache_ReadValid(cache) || !Cache_DependencyValid(depname, deplength, depcrc)) {
+			Cache_Close(cache);
+			return NULL;
+		}
+	}
+
+	return cache;
+}
+
+/*
+=======================================================================================================================================
+Cache_OpenWrite
+=======================================================================================================================================
+*/
+botcache_t *Cache_OpenWrite(int type, const char *filename, const char *variant) {
+	botcache_t *cache;
+	int i;
+
+	cacherecording = qfalse;
+
+	if (!Cache_Enabled()) {
+		return NULL;
+	}
+	// without a complete list of dependencies the cache can't be validated
+	if (cachedependencyoverflow || !numcachedependencies) {
+		return NULL;
+	}
+
+	cache = (botcache_t *)GetClearedMemory(sizeof(botcache_t));
+	cache->type = type;
+	cache->write = qtrue;
+
+	Cache_FileName(cache->filename, sizeof(cache->filename), filename, variant);
+
+	for (i = 0; i < numcachedependencies; i++) {
+		Cache_WriteString(cache, cachedependencies[i].filename);
+		Cache_WriteInt(cache, cachedependencies[i].length);
+		Cache_WriteInt(cache, cachedependencies[i].crc);
+	}
+
+	return cache;
+}
+
+/*
+=======================================================================================================================================
+Cache_Close
+=======================================================================================================================================
+*/
+void Cache_Close(botcache_t *cache) {
+	fileHandle_t fp;
+	int header[CACHE_HEADERINTS], i;
+
+	if (!cache) {
+		return;
+	}
+
+	if (cache->write) {
+		header[0] = BOTCACHEID;
+		header[1] = BOTCACHEVERSION;
+		header[2] = cache->type;
+		header[3] = numcachedependencies;
+		header[4] = cache->offset;
+		header[5] = CRC_ProcessString((unsigned char *)cache->buffer, cache->offset);
+
+		for (i = 0; i < CACHE_HEADERINTS; i++) {
+			header[i] = LittleLong(header[i]);
+		}
+
+		botimport.FS_FOpenFile(cache->filename, &fp, FS_WRITE);
+
+		if (fp) {
+			botimport.FS_Write(header, sizeof(header), fp);
+			botimport.FS_Write(cache->buffer, cache->offset, fp);
+			botimport.FS_FCloseFile(fp);
+		} else {
+			botimport.Print(PRT_WARNING, "couldn't write bot cache %s\n", cache->filename);
+		}
+	}
+
+	if (cache->buffer) {
+		FreeMemory(cache->buffer);
+	}
+
+	FreeMemory(cache);
+}
+
+/*
+=======================================================================================================================================
+Cache_ReadData
+=======================================================================================================================================
+*/
+void Cache_ReadData(botcache_t *cache, void *data, int size) {
+
+	if (cache->error || size < 0 || cache->offset + size > cache->size) {
+		cache->error = qtrue;
+		Com_Memset(data, 0, size > 0 ? size : 0);
+		return;
+	}
+
+	Com_Memcpy(data, cache->buffer + cache->offset, size);
+	cache->offset += size;
+}
+
+/*
+=======================================================================================================================================
+Cache_ReadInt
+=======================================================================================================================================
+*/
+int Cache_ReadInt(botcache_t *cache) {
+	int value;
+
+	Cache_ReadData(cache, &value, sizeof(value));
+	return LittleLong(value);
+}
+
+/*
+=======================================================================================================================================
+Cache_ReadFloat
+=======================================================================================================================================
+*/
+float Cache_ReadFloat(botcache_t *cache) {
+	float value;
+
+	Cache_ReadData(cache, &value, sizeof(value));
+	return LittleFloat(value);
+}
+
+/*
+=======================================================================================================================================
+Cache_ReadString
+
+The returned string points into the cache data and stays valid until the cache is closed.
+=======================================================================================================================================
+*/
+char *Cache_ReadString(botcache_t *cache) {
+	char *string;
+	int length;
+
+	length = Cache_ReadInt(cache);
+
+	if (cache->error || length < 1 || cache->offset + length > cache->size || cache->buffer[cache->offset + length - 1] != '\0') {
+		cache->error = qtrue;
+		return "";
+	}
+
+	string = cache->buffer + cache->offset;
+	cache->offset += length;
+
+	return string;
+}
+
+/*
+=======================================================================================================================================
+Cache_ReadValid
+=======================================================================================================================================
+*/
+qboolean Cache_ReadValid(botcache_t *cache) {
+	return !cache->error;
+}
+
+/*
+=======================================================================================================================================
+Cache_WriteData
+=======================================================================================================================================
+*/
+void Cache_WriteData(botcache_t *cache, const void *data, int size) {
+	char *buffer;
+	int newsize;
+
+	if (cache->offset + size > cache->size) {
+		newsize = cache->size * 2;
+
+		if (newsize < 4096) {
+			newsize = 4096;
+		}
+
+		while (newsize < cache->offset + size) {
+			newsize *= 2;
+		}
+
+		buffer = (char *)GetMemory(newsize);
+
+		if (cache->buffer) {
+			Com_Memcpy(buffer, cache->buffer, cache->offset);
+			FreeMemory(cache->buffer);
+		}
+
+		cache->buffer = buffer;
+		cache->size = newsize;
+	}
+
+	Com_Memcpy(cache->buffer + cache->offset, data, size);
+	cache->offset += size;
+}
+
+/*
+=======================================================================================================================================
+Cache_WriteInt
+=======================================================================================================================================
+*/
+void Cache_WriteInt(botcache_t *cache, int value) {
+
+	value = LittleLong(value);
+	Cache_WriteData(cache, &value, sizeof(value));
+}
+
+/*
+=======================================================================================================================================
+Cache_WriteFloat
+=======================================================================================================================================
+*/
+void Cache_WriteFloat(botcache_t *cache, float value) {
+
+	value = LittleFloat(value);
+	Cache_WriteData(cache, &value, sizeof(value));
+}
+
+/*
+=======================================================================================================================================
+Cache_WriteString
+=======================================================================================================================================
+*/
+void Cache_WriteString(botcache_t *cache, const char *string) {
+	int length;
+
+	length = strlen(string) + 1;
+
+	Cache_WriteInt(cache, length);
+	Cache_WriteData(cache, string, length);
+}
@@ -0,0 +1,73 @@
+/*
+=======================================================================================================================================
+Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+
+This file is part of Spearmint Source Code.
+
+Spearmint Source Code is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License, or (at your option) any later version.
+
+Spearmint Source Code is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Spearmint Source Code.
+If not, see <http://www.gnu.org/licenses/>.
+
+In addition, Spearmint Source Code is also subject to certain additional terms. You should have received a copy of these additional
+terms immediately following the terms and conditions of the GNU General Public License. If not, please request a copy in writing from
+id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o
+ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+=======================================================================================================================================
+*/
+
+/**************************************************************************************************************************************
+ Binary cache for parsed bot files.
+**************************************************************************************************************************************/
+
+#define BOTCACHEID (('C' << 24) + ('T' << 16) + ('O' << 8) + 'B') // little endian "BOTC"
+#define BOTCACHEVERSION 1
+// folder the cache files are written to
+#define BOTCACHEBASEFOLDER "botcache"
+// cache types
+#define CACHE_WEIGHTCONFIG		1
+#define CACHE_CHARACTER			2
+#define CACHE_INITIALCHAT		3
+#define CACHE_ITEMCONFIG		4
+#define CACHE_SYNONYMS			5
+#define CACHE_RANDOMSTRINGS		6
+#define CACHE_MATCHTEMPLATES	7
+#define CACHE_REPLYCHAT			8
+// cache file being read or written
+typedef struct botcache_s {
+	char filename[MAX_QPATH];	// name of the cache file
+	int type;					// cache type
+	qboolean write;				// true if the cache is being written
+	qboolean error;				// set when reading past the end of the data
+	char *buffer;				// cache data
+	int size;					// size of the cache data
+	int offset;					// read or write offset in the cache data
+} botcache_t;
+// starts recording the script files loaded while parsing a bot file
+void Cache_BeginDependencies(void);
+// records a script file loaded while parsing a bot file
+void Cache_AddDependency(const char *filename, const char *buffer, int length);
+// opens the cache of the given bot file for reading, returns NULL if there's no cache or the cache is out of date
+botcache_t *Cache_OpenRead(int type, const char *filename, const char *variant);
+// opens the cache of the given bot file for writing, the script files recorded since Cache_BeginDependencies become the dependencies
+botcache_t *Cache_OpenWrite(int type, const char *filename, const char *variant);
+// writes the cache to file if it was opened for writing and frees the cache
+void Cache_Close(botcache_t *cache);
+// read from the cache
+int Cache_ReadInt(botcache_t *cache);
+float Cache_ReadFloat(botcache_t *cache);
+char *Cache_ReadString(botcache_t *cache);
+void Cache_ReadData(botcache_t *cache, void *data, int size);
+// returns true if the data read so far was valid
+qboolean Cache_ReadValid(botcache_t *cache);
+// write to the cache
+void Cache_WriteInt(botcache_t *cache, int value);
+void Cache_WriteFloat(botcache_t *cache, float value);
+void Cache_WriteString(botcache_t *cache, const char *string);
+void Cache_WriteData(botcache_t *cache, const void *data, int size);
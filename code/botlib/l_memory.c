@@ -42,6 +42,270 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 int allocatedmemory;
 int totalmemorysize;
 int numblocks;
+
+/*
+=======================================================================================================================================
+
+	MEMORY ARENAS
+
+	Subsystems that allocate many small short lived blocks (precompiler tokens and defines, routing caches, fuzzy weights, chat
+	messages) allocate from their own arena instead of the zone. Small blocks are bump allocated from large chunks and recycled through
+	per size class free lists, large blocks are allocated separately but are still tracked by the arena. All memory of an arena is
+	released at once with FreeMemoryArena.
+
+=======================================================================================================================================
+*/
+
+#define ARENA_ID 0x13572468l
+
+typedef struct arenablock_s {
+	memoryarena_t *arena;	// arena the block was allocated from
+	int size;				// size of the block including the header
+	unsigned long int id;	// ARENA_ID, directly in front of the memory like the memory id of regular blocks
+} arenablock_t;
+
+typedef struct arenalargeblock_s {
+	struct arenalargeblock_s *prev, *next;
+	arenablock_t block;
+} arenalargeblock_t;
+
+typedef struct arenachunk_s {
+	struct arenachunk_s *next;
+	int size;
+	int used;
+} arenachunk_t;
+
+#define ARENA_CHUNKHEADERSIZE ((sizeof(arenachunk_t) + ARENA_GRANULARITY - 1) & ~(ARENA_GRANULARITY - 1))
+
+memoryarena_t *memoryarenas;
+
+/*
+=======================================================================================================================================
+LinkMemoryArena
+=======================================================================================================================================
+*/
+static void LinkMemoryArena(memoryarena_t *arena) {
+
+	if (arena->linked) {
+		return;
+	}
+
+	arena->next = memoryarenas;
+	memoryarenas = arena;
+	arena->linked = qtrue;
+}
+
+/*
+=======================================================================================================================================
+UnlinkMemoryArena
+=======================================================================================================================================
+*/
+static void UnlinkMemoryArena(memoryarena_t *arena) {
+	memoryarena_t **prev;
+
+	for (prev = &memoryarenas; *prev; prev = &(*prev)->next) {
+		if (*prev == arena) {
+			*prev = arena->next;
+			break;
+		}
+	}
+
+	arena->next = NULL;
+	arena->linked = qfalse;
+}
+
+/*
+=======================================================================================================================================
+GetArenaMemory
+=======================================================================================================================================
+*/
+void *GetArenaMemory(memoryarena_t *arena, unsigned long size) {
+	arenablock_t *block;
+	arenachunk_t *chunk;
+	arenalargeblock_t *large;
+	int blocksize, sizeclass;
+
+	blocksize = (sizeof(arenablock_t) + size + ARENA_GRANULARITY - 1) & ~(ARENA_GRANULARITY - 1);
+
+	if (blocksize > ARENA_MAXBLOCKSIZE) {
+		large = (arenalargeblock_t *)botimport.GetMemory(sizeof(arenalargeblock_t) + size);
+
+		if (!large) {
+			return NULL;
+		}
+
+		large->prev = NULL;
+		large->next = arena->largeblocks;
+
+		if (arena->largeblocks) {
+			arena->largeblocks->prev = large;
+		}
+
+		arena->largeblocks = large;
+		arena->totalmemorysize += sizeof(arenalargeblock_t) + size;
+
+		block = &large->block;
+		blocksize = sizeof(arenablock_t) + size;
+	} else {
+		sizeclass = blocksize / ARENA_GRANULARITY - 1;
+		block = (arenablock_t *)arena->freeblocks[sizeclass];
+
+		if (block) {
+			// reuse a previously freed block of the same size class
+			arena->freeblocks[sizeclass] = *(void **)((char *)block + sizeof(arenablock_t));
+		} else {
+			chunk = arena->chunks;
+
+			if (!chunk || chunk->used + blocksize > chunk->size) {
+				chunk = (arenachunk_t *)botimport.GetMemory(ARENA_CHUNKHEADERSIZE + ARENA_CHUNKSIZE);
+
+				if (!chunk) {
+					return NULL;
+				}
+
+				chunk->next = arena->chunks;
+				chunk->size = ARENA_CHUNKSIZE;
+				chunk->used = 0;
+				arena->chunks = chunk;
+				arena->numchunks++;
+				arena->totalmemorysize += ARENA_CHUNKHEADERSIZE + ARENA_CHUNKSIZE;
+			}
+
+			block = (arenablock_t *)((char *)chunk + ARENA_CHUNKHEADERSIZE + chunk->used);
+			chunk->used += blocksize;
+		}
+	}
+
+	block->arena = arena;
+	block->size = blocksize;
+	block->id = ARENA_ID;
+
+	arena->allocatedmemory += blocksize;
+	arena->numblocks++;
+
+	if (arena->allocatedmemory > arena->peakmemory) {
+		arena->peakmemory = arena->allocatedmemory;
+	}
+
+	LinkMemoryArena(arena);
+	return (char *)block + sizeof(arenablock_t);
+}
+
+/*
+=======================================================================================================================================
+GetClearedArenaMemory
+=======================================================================================================================================
+*/
+void *GetClearedArenaMemory(memoryarena_t *arena, unsigned long size) {
+	void *ptr;
+
+	ptr = GetArenaMemory(arena, size);
+
+	if (ptr) {
+		Com_Memset(ptr, 0, size);
+	}
+
+	return ptr;
+}
+
+/*
+=======================================================================================================================================
+IsArenaMemory
+=======================================================================================================================================
+*/
+static qboolean IsArenaMemory(void *ptr) {
+	return ptr && *(unsigned long int *)((char *)ptr - sizeof(unsigned long int)) == ARENA_ID;
+}
+
+/*
+=======================================================================================================================================
+FreeArenaBlock
+=======================================================================================================================================
+*/
+static void FreeArenaBlock(void *ptr) {
+	arenablock_t *block;
+	arenalargeblock_t *large;
+	memoryarena_t *arena;
+	int sizeclass;
+
+	block = (arenablock_t *)((char *)ptr - sizeof(arenablock_t));
+	arena = block->arena;
+
+	arena->allocatedmemory -= block->size;
+	arena->numblocks--;
+
+	if (block->size > ARENA_MAXBLOCKSIZE) {
+		large = (arenalargeblock_t *)((char *)block - (sizeof(arenalargeblock_t) - sizeof(arenablock_t)));
+
+		if (large->prev) {
+			large->prev->next = large->next;
+		} else {
+			arena->largeblocks = large->next;
+		}
+
+		if (large->next) {
+			large->next->prev = large->prev;
+		}
+
+		arena->totalmemorysize -= block->size + sizeof(arenalargeblock_t) - sizeof(arenablock_t);
+		block->id = 0;
+		botimport.FreeMemory(large);
+		return;
+	}
+	// the free list link is stored in the memory of the block, the header stays intact
+	sizeclass = block->size / ARENA_GRANULARITY - 1;
+	*(void **)ptr = arena->freeblocks[sizeclass];
+	arena->freeblocks[sizeclass] = block;
+}
+
+/*
+=======================================================================================================================================
+FreeMemoryArena
+
+Frees all memory allocated from the arena at once.
+=======================================================================================================================================
+*/
+void FreeMemoryArena(memoryarena_t *arena) {
+	arenachunk_t *chunk, *nextchunk;
+	arenalargeblock_t *large, *nextlarge;
+
+	for (chunk = arena->chunks; chunk; chunk = nextchunk) {
+		nextchunk = chunk->next;
+		botimport.FreeMemory(chunk);
+	}
+
+	for (large = arena->largeblocks; large; large = nextlarge) {
+		nextlarge = large->next;
+		large->block.id = 0;
+		botimport.FreeMemory(large);
+	}
+
+	arena->chunks = NULL;
+	arena->largeblocks = NULL;
+
+	Com_Memset(arena->freeblocks, 0, sizeof(arena->freeblocks));
+
+	arena->allocatedmemory = 0;
+	arena->totalmemorysize = 0;
+	arena->numblocks = 0;
+	arena->numchunks = 0;
+
+	UnlinkMemoryArena(arena);
+}
+
+/*
+=======================================================================================================================================
+PrintArenaMemorySize
+=======================================================================================================================================
+*/
+static void PrintArenaMemorySize(void) {
+	memoryarena_t *arena;
+
+	for (arena = memoryarenas; arena; arena = arena->next) {
+		botimport.Print(PRT_MESSAGE, "%-16s arena: %6d KB used, %6d KB peak, %6d KB allocated, %6d blocks, %4d chunks\n", arena->name, arena->allocatedmemory >> 10, arena->peakmemory >> 10, arena->totalmemorysize >> 10, arena->numblocks, arena->numchunks);
+	}
+}
+
 #ifdef MEMORYMANEGER
 typedef struct memoryblock_s {
 	unsigned long int id;
@@ -240,6 +504,11 @@ FreeMemory
 void FreeMemory(void *ptr) {
 	memoryblock_t *block;
 
+	if (IsArenaMemory(ptr)) {
+		FreeArenaBlock(ptr);
+		return;
+	}
+
 	block = BlockFromPointer(ptr, "FreeMemory");
 
 	if (!block) {
@@ -274,6 +543,10 @@ MemoryByteSize
 int MemoryByteSize(void *ptr) {
 	memoryblock_t *block;
 
+	if (IsArenaMemory(ptr)) {
+		return ((arenablock_t *)((char *)ptr - sizeof(arenablock_t)))->size - sizeof(arenablock_t);
+	}
+
 	block = BlockFromPointer(ptr, "MemoryByteSize");
 
 	if (!block) {
@@ -292,6 +565,8 @@ void PrintUsedMemorySize(void) {
 	botimport.Print(PRT_MESSAGE, "total allocated memory: %d KB\n", allocatedmemory >> 10);
 	botimport.Print(PRT_MESSAGE, "total botlib memory: %d KB\n", totalmemorysize >> 10);
 	botimport.Print(PRT_MESSAGE, "total memory blocks: %d\n", numblocks);
+
+	PrintArenaMemorySize();
 }
 
 /*
@@ -438,6 +713,11 @@ FreeMemory
 void FreeMemory(void *ptr) {
 	unsigned long int *memid;
 
+	if (IsArenaMemory(ptr)) {
+		FreeArenaBlock(ptr);
+		return;
+	}
+
 	memid = (unsigned long int *)((char *)ptr - sizeof(unsigned long int));
 
 	if (*memid == MEM_ID) {
@@ -460,7 +740,7 @@ PrintUsedMemorySize
 =======================================================================================================================================
 */
 void PrintUsedMemorySize(void) {
-
+	PrintArenaMemorySize();
 }
 
 /*
@@ -469,6 +749,6 @@ PrintMemoryLabels
 =======================================================================================================================================
 */
 void PrintMemoryLabels(void) {
-
+	PrintUsedMemorySize();
 }
 #endif
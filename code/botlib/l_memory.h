@@ -67,3 +67,29 @@ void PrintMemoryLabels(void);
 int MemoryByteSize(void *ptr);
 // free all allocated memory
 void DumpMemory(void);
+
+#ifndef ARENA_GRANULARITY
+#define ARENA_GRANULARITY 16
+#define ARENA_MAXBLOCKSIZE 2048
+#define ARENA_CHUNKSIZE 0x10000
+// memory arena, blocks from an arena are freed with FreeMemory or all at once with FreeMemoryArena
+typedef struct memoryarena_s {
+	char *name;
+	struct arenachunk_s *chunks;
+	struct arenalargeblock_s *largeblocks;
+	void *freeblocks[ARENA_MAXBLOCKSIZE / ARENA_GRANULARITY];
+	int allocatedmemory;
+	int peakmemory;
+	int totalmemorysize;
+	int numblocks;
+	int numchunks;
+	int linked;
+	struct memoryarena_s *next;
+} memoryarena_t;
+// allocate a memory block of the given size from the arena
+void *GetArenaMemory(memoryarena_t *arena, unsigned long size);
+// allocate a memory block of the given size from the arena and clear it
+void *GetClearedArenaMemory(memoryarena_t *arena, unsigned long size);
+// free all memory allocated from the arena
+void FreeMemoryArena(memoryarena_t *arena);
+#endif
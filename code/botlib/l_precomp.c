@@ -56,6 +56,14 @@ typedef enum {
 #include "l_script.h"
 #include "l_precomp.h"
 #include "l_log.h"
+
+extern memoryarena_t scriptarena;
+
+#define GetScriptMemory(size) GetArenaMemory(&scriptarena, size)
+#define GetClearedScriptMemory(size) GetClearedArenaMemory(&scriptarena, size)
+#else
+#define GetScriptMemory GetMemory
+#define GetClearedScriptMemory GetClearedMemory
 #endif // BOTLIB
 #ifdef BSPC
 // include files for usage in the BSP Converter
@@ -133,7 +141,7 @@ PC_PushIndent
 void PC_PushIndent(source_t *source, int type, int skip) {
 	indent_t *indent;
 
-	indent = (indent_t *)GetMemory(sizeof(indent_t));
+	indent = (indent_t *)GetScriptMemory(sizeof(indent_t));
 	indent->type = type;
 	indent->script = source->scriptstack;
 	indent->skip = (skip != 0);
@@ -224,7 +232,7 @@ token_t *PC_CopyToken(token_t *token) {
 	token_t *t;
 
 	//t = (token_t *)malloc(sizeof(token_t));
-	t = (token_t *)GetMemory(sizeof(token_t));
+	t = (token_t *)GetScriptMemory(sizeof(token_t));
 	//t = freetokens;
 
 	if (!t) {
@@ -656,11 +664,11 @@ void PC_AddBuiltinDefines(source_t *source) {
 	};
 
 	for (i = 0; builtin[i].string; i++) {
-		define = (define_t *)GetMemory(sizeof(define_t));
+		define = (define_t *)GetScriptMemory(sizeof(define_t));
 
 		Com_Memset(define, 0, sizeof(define_t));
 
-		define->name = (char *)GetMemory(strlen(builtin[i].string) + 1);
+		define->name = (char *)GetScriptMemory(strlen(builtin[i].string) + 1);
 
 		strcpy(define->name, builtin[i].string);
 
@@ -1185,11 +1193,11 @@ int PC_Directive_define(source_t *source) {
 		}
 	}
 	// allocate define
-	define = (define_t *)GetMemory(sizeof(define_t));
+	define = (define_t *)GetScriptMemory(sizeof(define_t));
 
 	Com_Memset(define, 0, sizeof(define_t));
 
-	define->name = (char *)GetMemory(strlen(token.string) + 1);
+	define->name = (char *)GetScriptMemory(strlen(token.string) + 1);
 
 	strcpy(define->name, token.string);
 	// add the define to the source
@@ -1317,7 +1325,7 @@ define_t *PC_DefineFromString(const char *string) {
 
 	src.scriptstack = script;
 #if DEFINEHASHING
-	src.definehash = GetClearedMemory(DEFINEHASHSIZE * sizeof(define_t *));
+	src.definehash = GetClearedScriptMemory(DEFINEHASHSIZE * sizeof(define_t *));
 #endif // DEFINEHASHING
 	// create a define from the source
 	res = PC_Directive_define(&src);
@@ -1433,6 +1441,26 @@ void PC_RemoveAllGlobalDefines(void) {
 	}
 }
 
+/*
+=======================================================================================================================================
+PC_NumGlobalDefines
+
+Returns the number of global defines.
+=======================================================================================================================================
+*/
+int PC_NumGlobalDefines(void) {
+	define_t *define;
+	int num;
+
+	num = 0;
+
+	for (define = globaldefines; define; define = define->next) {
+		num++;
+	}
+
+	return num;
+}
+
 /*
 =======================================================================================================================================
 PC_CopyDefine
@@ -1442,9 +1470,9 @@ define_t *PC_CopyDefine(source_t *source, const define_t *define) {
 	define_t *newdefine;
 	token_t *token, *newtoken, *lasttoken;
 
-	newdefine = (define_t *)GetMemory(sizeof(define_t));
+	newdefine = (define_t *)GetScriptMemory(sizeof(define_t));
 	// copy the define name
-	newdefine->name = (char *)GetMemory(strlen(define->name) + 1);
+	newdefine->name = (char *)GetScriptMemory(strlen(define->name) + 1);
 
 	strcpy(newdefine->name, define->name);
 
@@ -3131,7 +3159,7 @@ source_t *LoadSourceFile(const char *filename) {
 	}
 
 	script->next = NULL;
-	source = (source_t *)GetMemory(sizeof(source_t));
+	source = (source_t *)GetScriptMemory(sizeof(source_t));
 
 	Com_Memset(source, 0, sizeof(source_t));
 
@@ -3143,7 +3171,7 @@ source_t *LoadSourceFile(const char *filename) {
 	source->indentstack = NULL;
 	source->skip = 0;
 #if DEFINEHASHING
-	source->definehash = GetClearedMemory(DEFINEHASHSIZE * sizeof(define_t *));
+	source->definehash = GetClearedScriptMemory(DEFINEHASHSIZE * sizeof(define_t *));
 #endif // DEFINEHASHING
 	PC_AddGlobalDefinesToSource(source);
 	return source;
@@ -3167,7 +3195,7 @@ source_t *LoadSourceMemory(const char *ptr, int length, const char *name) {
 	}
 
 	script->next = NULL;
-	source = (source_t *)GetMemory(sizeof(source_t));
+	source = (source_t *)GetScriptMemory(sizeof(source_t));
 
 	Com_Memset(source, 0, sizeof(source_t));
 
@@ -3179,7 +3207,7 @@ source_t *LoadSourceMemory(const char *ptr, int length, const char *name) {
 	source->indentstack = NULL;
 	source->skip = 0;
 #if DEFINEHASHING
-	source->definehash = GetClearedMemory(DEFINEHASHSIZE * sizeof(define_t *));
+	source->definehash = GetClearedScriptMemory(DEFINEHASHSIZE * sizeof(define_t *));
 #endif // DEFINEHASHING
 	PC_AddGlobalDefinesToSource(source);
 	return source;
@@ -3385,3 +3413,20 @@ void PC_CheckOpenSourceHandles(void) {
 		}
 	}
 }
+#ifdef BOTLIB
+/*
+=======================================================================================================================================
+PC_FreeScriptMemory
+
+Frees all script and precompiler memory at once, but only when no sources, scripts or global defines are left.
+=======================================================================================================================================
+*/
+void PC_FreeScriptMemory(void) {
+
+	if (scriptarena.numblocks) {
+		return;
+	}
+
+	FreeMemoryArena(&scriptarena);
+}
+#endif // BOTLIB
@@ -119,6 +119,8 @@ int PC_AddGlobalDefine(const char *string);
 int PC_RemoveGlobalDefine(char *name);
 // remove all globals defines
 void PC_RemoveAllGlobalDefines(void);
+// returns the number of global defines
+int PC_NumGlobalDefines(void);
 // add builtin defines
 void PC_AddBuiltinDefines(source_t *source);
 // set the source include path
@@ -142,3 +144,4 @@ int PC_FreeSourceHandle(int handle);
 int PC_ReadTokenHandle(int handle, pc_token_t *pc_token);
 int PC_SourceFileAndLine(int handle, char *filename, int *line);
 void PC_CheckOpenSourceHandles(void);
+void PC_FreeScriptMemory(void);
@@ -54,6 +54,15 @@ typedef enum {
 #include "l_memory.h"
 #include "l_log.h"
 #include "l_libvar.h"
+#include "l_cache.h"
+// the script and precompiler memory is allocated from its own arena
+memoryarena_t scriptarena = {"script"};
+
+#define GetScriptMemory(size) GetArenaMemory(&scriptarena, size)
+#define GetClearedScriptMemory(size) GetClearedArenaMemory(&scriptarena, size)
+#else
+#define GetScriptMemory GetMemory
+#define GetClearedScriptMemory GetClearedMemory
 #endif // BOTLIB
 #ifdef BSPC
 // include files for usage in the BSP Converter
@@ -152,7 +161,7 @@ void PS_CreatePunctuationTable(script_t *script, punctuation_t *punctuations) {
 
 	// get memory for the table
 	if (!script->punctuationtable) {
-		script->punctuationtable = (punctuation_t **)GetMemory(256 * sizeof(punctuation_t *));
+		script->punctuationtable = (punctuation_t **)GetScriptMemory(256 * sizeof(punctuation_t *));
 	}
 
 	Com_Memset(script->punctuationtable, 0, 256 * sizeof(punctuation_t *));
@@ -1423,7 +1432,7 @@ script_t *LoadScriptFile(const char *filename) {
 
 	length = FileLength(fp);
 #endif
-	buffer = GetClearedMemory(sizeof(script_t) + length + 1);
+	buffer = GetClearedScriptMemory(sizeof(script_t) + length + 1);
 	script = (script_t *)buffer;
 
 	Com_Memset(script, 0, sizeof(script_t));
@@ -1448,6 +1457,8 @@ script_t *LoadScriptFile(const char *filename) {
 #ifdef BOTLIB
 	botimport.FS_Read(script->buffer, length, fp);
 	botimport.FS_FCloseFile(fp);
+	// the bot file cache depends on every script file loaded while parsing
+	Cache_AddDependency(pathname, script->buffer, length);
 #else
 	if (fread(script->buffer, length, 1, fp) != 1) {
 		FreeMemory(buffer);
@@ -1468,7 +1479,7 @@ script_t *LoadScriptMemory(const char *ptr, int length, const char *name) {
 	void *buffer;
 	script_t *script;
 
-	buffer = GetClearedMemory(sizeof(script_t) + length + 1);
+	buffer = GetClearedScriptMemory(sizeof(script_t) + length + 1);
 	script = (script_t *)buffer;
 
 	Com_Memset(script, 0, sizeof(script_t));
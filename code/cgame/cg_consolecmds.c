@@ -98,11 +98,16 @@ static void CG_ScoresDown_f(void) {
 		// the scores are more than two seconds out of data, so request new ones
 		cg.scoresRequestTime = cg.time;
 
-		trap_SendClientCommand("score");
+		// ask for the whole scoreboard if there is nothing to apply a delta to
+		trap_SendClientCommand(cg.scoresValid ? "score" : "score full");
 		// leave the current scores up if they were already displayed, but if this is the first hit, clear them out
+		// unless deltas will update them, the server doesn't send anything if nothing changed
 		if (!cg.showScores) {
 			cg.showScores = qtrue;
-			cg.numScores = 0;
+
+			if (!cg.scoresValid) {
+				cg.numScores = 0;
+			}
 		}
 	} else {
 		// show the cached contents even if they just pressed if it is within two seconds
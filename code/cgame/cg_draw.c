@@ -2066,7 +2066,6 @@ static void CG_DrawCrosshair3D(void) {
 	int ca;
 	trace_t trace;
 	vec3_t endpos;
-	char rendererinfos[128];
 	refEntity_t ent;
 
 	if (!cg_drawCrosshair.integer) {
@@ -2092,13 +2091,8 @@ static void CG_DrawCrosshair3D(void) {
 	// use a different method rendering the crosshair so players don't see two of them when focusing their eyes at distant objects with
 	// high stereo separation. We are going to trace to the next shootable object and place the crosshair in front of it
 	// first get all the important renderer information
-	trap_Cvar_VariableStringBuffer("r_zProj", rendererinfos, sizeof(rendererinfos));
-
-	zProj = atof(rendererinfos);
-
-	trap_Cvar_VariableStringBuffer("r_stereoSeparation", rendererinfos, sizeof(rendererinfos));
-
-	stereoSep = zProj / atof(rendererinfos);
+	zProj = cg_zProj.value;
+	stereoSep = zProj / cg_stereoSeparation.value;
 	xmax = zProj * tan(cg.refdef.fov_x * M_PI / 360.0f);
 	// let the trace run through until a change in stereo separation of the crosshair becomes less than one pixel
 	maxdist = cgs.glconfig.vidWidth * stereoSep * zProj / (2 * xmax);
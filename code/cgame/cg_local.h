@@ -546,6 +546,8 @@ typedef struct {
 	int selectedScore;
 	int teamScores[2];
 	score_t scores[MAX_CLIENTS];
+	qboolean scoresValid; // a full scoreboard was received, so deltas can be applied
+	int scoresFullRequestTime;
 	qboolean showScores;
 	qboolean scoreBoardShowing;
 	int scoreFadeTime;
@@ -1083,6 +1085,8 @@ extern vmCvar_t cg_forceModel;
 extern vmCvar_t cg_buildScript;
 extern vmCvar_t cg_paused;
 extern vmCvar_t cg_blood;
+extern vmCvar_t cg_zProj;
+extern vmCvar_t cg_stereoSeparation;
 extern vmCvar_t cg_predictItems;
 extern vmCvar_t cg_deferPlayers;
 extern vmCvar_t cg_drawFriend;
@@ -1344,6 +1348,7 @@ void CG_InitConsoleCommands(void);
 // cg_servercmds.c
 void CG_ExecuteNewServerCommands(int latestSequence);
 void CG_ParseServerinfo(void);
+void CG_RequestFullScores(void);
 void CG_SetConfigValues(void);
 void CG_ShaderStateChanged(void);
 void CG_LoadVoiceChats(void);
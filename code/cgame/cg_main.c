@@ -165,6 +165,8 @@ vmCvar_t cg_buildScript;
 vmCvar_t cg_forceModel;
 vmCvar_t cg_paused;
 vmCvar_t cg_blood;
+vmCvar_t cg_zProj;
+vmCvar_t cg_stereoSeparation;
 vmCvar_t cg_predictItems;
 vmCvar_t cg_deferPlayers;
 vmCvar_t cg_drawTeamOverlay;
@@ -298,6 +300,8 @@ static const cvarTable_t cgameCvarTable[] = {
 	{&cg_buildScript, "com_buildScript", "0", 0}, // force loading of all possible data amd error on failures
 	{&cg_paused, "cl_paused", "0", CVAR_ROM},
 	{&cg_blood, "com_blood", "1", CVAR_ARCHIVE},
+	{&cg_zProj, "r_zproj", "64", CVAR_ARCHIVE},
+	{&cg_stereoSeparation, "r_stereoSeparation", "64", CVAR_ARCHIVE},
 	{&cg_synchronousClients, "g_synchronousClients", "0", CVAR_SYSTEMINFO},
 	{&cg_enableDust, "cg_enableDust", "1", 0},
 	{&cg_enableBreath, "cg_enableBreath", "1", 0},
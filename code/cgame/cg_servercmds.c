@@ -66,13 +66,117 @@ static int CG_ValidOrder(const char *p) {
 	return -1;
 }
 
+/*
+=======================================================================================================================================
+CG_SetScoreField
+
+Sets field number field of a scoreboard row, in the order the server sends them.
+=======================================================================================================================================
+*/
+static void CG_SetScoreField(score_t *score, int field, int value) {
+
+	switch (field) {
+		case 0:
+			if (value < 0 || value >= MAX_CLIENTS) {
+				value = 0;
+			}
+
+			score->client = value;
+			break;
+		case 1:
+			score->score = value;
+			break;
+		case 2:
+			score->ping = value;
+			break;
+		case 3:
+			score->time = value;
+			break;
+		case 4:
+			score->scoreFlags = value;
+			break;
+		case 5:
+			cgs.clientinfo[score->client].powerups = value;
+			break;
+		case 6:
+			score->accuracy = value;
+			break;
+		case 7:
+			score->excellentCount = value;
+			break;
+		case 8:
+			score->impressiveCount = value;
+			break;
+		case 9:
+			score->gauntletCount = value;
+			break;
+		case 10:
+			score->captures = value;
+			break;
+		case 11:
+			score->defendCount = value;
+			break;
+		case 12:
+			score->assistCount = value;
+			break;
+		case 13:
+			score->perfect = value;
+			break;
+		default:
+			break;
+	}
+}
+
+/*
+=======================================================================================================================================
+CG_ParseScore
+
+Parses a single scoreboard row starting at argument arg.
+=======================================================================================================================================
+*/
+static void CG_ParseScore(score_t *score, int arg) {
+	int i;
+
+	memset(score, 0, sizeof(*score));
+
+	for (i = 0; i < SCOREBOARD_ROW_FIELDS; i++) {
+		CG_SetScoreField(score, i, atoi(CG_Argv(arg + i)));
+	}
+
+	cgs.clientinfo[score->client].score = score->score;
+	score->team = cgs.clientinfo[score->client].team;
+}
+
+/*
+=======================================================================================================================================
+CG_RequestFullScores
+
+Asks the server for the whole scoreboard, deltas can't be applied until it arrives. Demos can't ask, they have to wait for the next full
+scoreboard in the recording.
+=======================================================================================================================================
+*/
+void CG_RequestFullScores(void) {
+
+	if (cg.demoPlayback) {
+		return;
+	}
+	// one request is enough until it could have been answered
+	if (cg.scoresFullRequestTime && cg.time - cg.scoresFullRequestTime < 1000) {
+		return;
+	}
+
+	cg.scoresFullRequestTime = cg.time;
+
+	trap_SendClientCommand("score full");
+}
+
 /*
 =======================================================================================================================================
 CG_ParseScores
 =======================================================================================================================================
 */
 static void CG_ParseScores(void) {
-	int i, powerups;
+	int i;
 
 	cg.numScores = atoi(CG_Argv(1));
 
@@ -86,27 +190,70 @@ static void CG_ParseScores(void) {
 	memset(cg.scores, 0, sizeof(cg.scores));
 
 	for (i = 0; i < cg.numScores; i++) {
-		cg.scores[i].client = atoi(CG_Argv(i * 14 + 4));
-		cg.scores[i].score = atoi(CG_Argv(i * 14 + 5));
-		cg.scores[i].ping = atoi(CG_Argv(i * 14 + 6));
-		cg.scores[i].time = atoi(CG_Argv(i * 14 + 7));
-		cg.scores[i].scoreFlags = atoi(CG_Argv(i * 14 + 8));
-		powerups = atoi(CG_Argv(i * 14 + 9));
-		cg.scores[i].accuracy = atoi(CG_Argv(i * 14 + 10));
-		cg.scores[i].excellentCount = atoi(CG_Argv(i * 14 + 11));
-		cg.scores[i].impressiveCount = atoi(CG_Argv(i * 14 + 12));
-		cg.scores[i].gauntletCount = atoi(CG_Argv(i * 14 + 13));
-		cg.scores[i].captures = atoi(CG_Argv(i * 14 + 14));
-		cg.scores[i].defendCount = atoi(CG_Argv(i * 14 + 15));
-		cg.scores[i].assistCount = atoi(CG_Argv(i * 14 + 16));
-		cg.scores[i].perfect = atoi(CG_Argv(i * 14 + 17));
-
-		if (cg.scores[i].client < 0 || cg.scores[i].client >= MAX_CLIENTS) {
-			cg.scores[i].client = 0;
+		CG_ParseScore(&cg.scores[i], i * SCOREBOARD_ROW_FIELDS + 4);
+	}
+
+	cg.scoresValid = qtrue;
+
+	CG_SetScoreSelection(NULL);
+}
+
+/*
+=======================================================================================================================================
+CG_ParseScoresDelta
+
+Format: "scoresdelta" numScores redScore blueScore numRows, followed by numRows times the row index, a bit mask of the changed fields
+and the values of those fields. Whatever isn't sent didn't change since the last scoreboard.
+=======================================================================================================================================
+*/
+static void CG_ParseScoresDelta(void) {
+	score_t *score;
+	int i, field, index, changes, numRows, arg;
+
+	// nothing to apply the delta to, ask for the whole scoreboard
+	if (!cg.scoresValid) {
+		CG_RequestFullScores();
+		return;
+	}
+
+	cg.numScores = atoi(CG_Argv(1));
+
+	if (cg.numScores > MAX_CLIENTS) {
+		cg.numScores = MAX_CLIENTS;
+	}
+
+	cg.teamScores[0] = atoi(CG_Argv(2));
+	cg.teamScores[1] = atoi(CG_Argv(3));
+
+	numRows = atoi(CG_Argv(4));
+	arg = 5;
+
+	for (i = 0; i < numRows; i++) {
+		index = atoi(CG_Argv(arg++));
+		changes = atoi(CG_Argv(arg++));
+		// still step over the values of a bad row
+		if (index < 0 || index >= cg.numScores) {
+			for (field = 0; field < SCOREBOARD_ROW_FIELDS; field++) {
+				if (changes & (1 << field)) {
+					arg++;
+				}
+			}
+
+			continue;
+		}
+
+		score = &cg.scores[index];
+
+		for (field = 0; field < SCOREBOARD_ROW_FIELDS; field++) {
+			if (changes & (1 << field)) {
+				CG_SetScoreField(score, field, atoi(CG_Argv(arg++)));
+			}
 		}
 
-		cgs.clientinfo[cg.scores[i].client].score = cg.scores[i].score;
-		cgs.clientinfo[cg.scores[i].client].powerups = powerups;
+		cgs.clientinfo[score->client].score = score->score;
+	}
+	// teams can change without the row itself changing
+	for (i = 0; i < cg.numScores; i++) {
 		cg.scores[i].team = cgs.clientinfo[cg.scores[i].client].team;
 	}
 
@@ -1094,6 +1241,11 @@ static void CG_ServerCommand(void) {
 		return;
 	}
 
+	if (!strcmp(cmd, "scoresdelta")) {
+		CG_ParseScoresDelta();
+		return;
+	}
+
 	if (!strcmp(cmd, "tinfo")) {
 		CG_ParseTeamInfo();
 		return;
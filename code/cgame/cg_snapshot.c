@@ -89,6 +89,10 @@ void CG_SetInitialSnapshot(snapshot_t *snap) {
 	// sort out solid entities
 	CG_BuildSolidList();
 	CG_ExecuteNewServerCommands(snap->serverCommandSequence);
+	// the server may still have a scoreboard baseline from before a vid_restart
+	if (!cg.scoresValid) {
+		CG_RequestFullScores();
+	}
 	// set our local weapon selection pointer to what the server has indicated the current weapon is
 	CG_Respawn();
 
@@ -370,13 +370,18 @@ rescan:
 =======================================================================================================================================
 CL_CM_LoadMap
 
-Just adds default parameters that cgame doesn't need to know about.
+Just adds default parameters that cgame doesn't need to know about, and publishes the checksum in cl_mapChecksum.
 =======================================================================================================================================
 */
 void CL_CM_LoadMap(const char *mapname) {
+	hunkSubsystem_t previous;
 	int checksum;
 
+	previous = Hunk_SetSubsystem(HUNK_CM);
 	CM_LoadMap(mapname, qtrue, &checksum);
+	Hunk_SetSubsystem(previous);
+	// lets cgame key its map caches on the collision data
+	Cvar_Set("cl_mapChecksum", va("%i", checksum));
 }
 
 /*
@@ -748,6 +753,44 @@ intptr_t CL_CgameSystemCalls(intptr_t *args) {
 	return 0;
 }
 
+/*
+=======================================================================================================================================
+CL_PrefetchMapFiles
+
+The engine doesn't know which configstrings hold models and the like, so every configstring that looks like a file path is handed to
+the prefetch threads along with the map, except sounds. Strings that aren't files are skipped by FS_PrefetchFiles.
+=======================================================================================================================================
+*/
+static void CL_PrefetchMapFiles(void) {
+	const char *files[MAX_CONFIGSTRINGS + 1];
+	const char *s, *slash;
+	int i, numFiles;
+
+	numFiles = 0;
+	files[numFiles++] = cl.mapname;
+
+	for (i = 0; i < MAX_CONFIGSTRINGS; i++) {
+		if (!cl.gameState.stringOffsets[i]) {
+			continue;
+		}
+
+		s = cl.gameState.stringData + cl.gameState.stringOffsets[i];
+		slash = strrchr(s, '/');
+
+		if (!slash || !strchr(slash, '.') || strchr(s, '\\') || strchr(s, '\n')) {
+			continue;
+		}
+		// sounds are loaded by the sound system's own reader and never claim a prefetched copy
+		if (COM_CompareExtension(s, ".wav") || COM_CompareExtension(s, ".ogg") || COM_CompareExtension(s, ".opus") || COM_CompareExtension(s, ".mp3")) {
+			continue;
+		}
+
+		files[numFiles++] = s;
+	}
+
+	FS_PrefetchFiles(files, numFiles);
+}
+
 /*
 =======================================================================================================================================
 CL_InitCGame
@@ -769,6 +812,8 @@ void CL_InitCGame(void) {
 	mapname = Info_ValueForKey(info, "mapname");
 
 	Com_sprintf(cl.mapname, sizeof(cl.mapname), "maps/%s.bsp", mapname);
+	// start reading the map and the models while the cgame is loaded
+	CL_PrefetchMapFiles();
 	// load the dll or bytecode
 	interpret = Cvar_VariableValue("vm_cgame");
 
@@ -800,6 +845,8 @@ void CL_InitCGame(void) {
 	Com_Printf("CL_InitCGame: %5.2f seconds\n", (t2 - t1) / 1000.0);
 	// have the renderer touch all its images, so they are present on the card even if the driver does deferred loading
 	re.EndRegistration();
+	// whatever the cgame didn't load isn't going to be read
+	FS_ClearPrefetch();
 	// make sure everything is paged in
 	if (!Sys_LowPhysicalMemory()) {
 		Com_TouchMemory();
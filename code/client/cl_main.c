@@ -2778,6 +2778,31 @@ void *CL_RefMalloc(int size) {
 	return Z_TagMalloc(size, TAG_RENDERER);
 }
 
+/*
+=======================================================================================================================================
+CL_RefHunkAlloc
+
+Charges the renderer's hunk allocations to it for hunk_stats.
+=======================================================================================================================================
+*/
+#ifdef HUNK_DEBUG
+static void *CL_RefHunkAllocDebug(int size, ha_pref preference, char *label, char *file, int line) {
+#else
+static void *CL_RefHunkAlloc(int size, ha_pref preference) {
+#endif
+	hunkSubsystem_t previous;
+	void *buf;
+
+	previous = Hunk_SetSubsystem(HUNK_RENDERER);
+#ifdef HUNK_DEBUG
+	buf = Hunk_AllocDebug(size, preference, label, file, line);
+#else
+	buf = Hunk_Alloc(size, preference);
+#endif
+	Hunk_SetSubsystem(previous);
+	return buf;
+}
+
 /*
 =======================================================================================================================================
 CL_ScaledMilliseconds
@@ -2834,9 +2859,9 @@ void CL_InitRef(void) {
 	ri.Malloc = CL_RefMalloc;
 	ri.Free = Z_Free;
 #ifdef HUNK_DEBUG
-	ri.Hunk_AllocDebug = Hunk_AllocDebug;
+	ri.Hunk_AllocDebug = CL_RefHunkAllocDebug;
 #else
-	ri.Hunk_Alloc = Hunk_Alloc;
+	ri.Hunk_Alloc = CL_RefHunkAlloc;
 #endif
 	ri.Hunk_AllocateTempMemory = Hunk_AllocateTempMemory;
 	ri.Hunk_FreeTempMemory = Hunk_FreeTempMemory;
@@ -2849,6 +2874,8 @@ void CL_InitRef(void) {
 	ri.FS_ListFiles = FS_ListFiles;
 	ri.FS_FileIsInPAK = FS_FileIsInPAK;
 	ri.FS_FileExists = FS_FileExists;
+	ri.FS_MapFile = FS_MapFile;
+	ri.FS_FreeMappedFile = FS_FreeMappedFile;
 	ri.Cvar_Get = Cvar_Get;
 	ri.Cvar_Set = Cvar_Set;
 	ri.Cvar_SetValue = Cvar_SetValue;
@@ -3150,6 +3177,7 @@ void CL_Init(void) {
 	Cvar_CheckRange(j_side_axis, 0, MAX_JOYSTICK_AXIS - 1, qtrue);
 	Cvar_CheckRange(j_up_axis, 0, MAX_JOYSTICK_AXIS - 1, qtrue);
 	cl_motdString = Cvar_Get("cl_motdString", "", CVAR_ROM);
+	Cvar_Get("cl_mapChecksum", "", CVAR_ROM);
 	Cvar_Get("cl_maxPing", "800", CVAR_ARCHIVE);
 	cl_lanForcePackets = Cvar_Get("cl_lanForcePackets", "1", CVAR_ARCHIVE);
 	cl_guidServerUniq = Cvar_Get("cl_guidServerUniq", "1", CVAR_ARCHIVE);
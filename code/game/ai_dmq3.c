@@ -77,6 +77,16 @@ aas_altroutegoal_t blue_altroutegoals[MAX_ALTROUTEGOALS];
 int blue_numaltroutegoals;
 
 byte botCheckedAreas[65536];
+// client to client visibility, shared by all bots during a frame
+typedef struct botVisibility_s {
+	int frame;
+	qboolean visible;
+	vec3_t eye;
+	vec3_t origin, mins, maxs;
+} botVisibility_t;
+
+static botVisibility_t botVisibility[MAX_CLIENTS][MAX_CLIENTS];
+static int botVisibilityFrame = 1;
 
 /*
 =======================================================================================================================================
@@ -5012,54 +5022,31 @@ qboolean InFieldOfVision(vec3_t viewangles, int fov, vec3_t angles) {
 
 /*
 =======================================================================================================================================
-BotEntityVisible
+BotStartVisibilityFrame
 
-Returns visibility in the range [0, 1] taking fog and water surfaces into account.
+Invalidates the visibility traces shared by the bots during the previous frame.
 =======================================================================================================================================
 */
-qboolean BotEntityVisible(playerState_t *ps, float fov, int ent) {
-	int viewer, visdist, i, contents_mask, passent, hitent, infog, inlava, inwater, otherinfog, otherinlava, otherinwater;
-	float squaredfogdist, waterfactor, vis, bestvis;
-	bsp_trace_t trace;
-	aas_entityinfo_t entinfo;
-	vec3_t viewangles, eye, dir, vec, right, entangles, start, end, middle;
+void BotStartVisibilityFrame(void) {
+	botVisibilityFrame++;
+}
 
-	if (ent < 0) {
-		return qfalse;
-	}
-	// get the entity information
-	BotEntityInfo(ent, &entinfo);
-	// if the entity information is valid
-	if (!entinfo.valid) {
-		return qfalse;
-	}
-	// calculate middle of bounding box
-	VectorAdd(entinfo.mins, entinfo.maxs, middle);
-	VectorScale(middle, 0.5, middle);
-	VectorAdd(entinfo.origin, middle, middle);
-	// calculate eye position
-	VectorCopy(ps->origin, eye);
+/*
+=======================================================================================================================================
+BotEntityTraceVisible
 
-	eye[2] += ps->viewheight;
+Traces from the eye of the viewer to the middle, bottom, top and sides of the entity, taking fog and water surfaces into account.
+=======================================================================================================================================
+*/
+static qboolean BotEntityTraceVisible(int viewer, vec3_t eyeOrigin, int ent, aas_entityinfo_t *entinfo, vec3_t middleOrigin) {
+	int i, contents_mask, passent, hitent, infog, inlava, inwater, otherinfog, otherinlava, otherinwater;
+	float squaredfogdist, waterfactor, vis, bestvis;
+	bsp_trace_t trace;
+	vec3_t eye, dir, vec, right, start, end, middle;
 
+	VectorCopy(eyeOrigin, eye);
+	VectorCopy(middleOrigin, middle);
 	VectorSubtract(middle, eye, dir);
-
-	visdist = bot_visualrange.value;
-
-	if (VectorLength(dir) > visdist) {
-		return qfalse;
-	}
-	// check if entity is within field of vision
-	VectorCopy(ps->viewangles, viewangles);
-	VectorToAngles(dir, entangles);
-
-	if (!InFieldOfVision(viewangles, fov, entangles)) {
-		return qfalse;
-	}
-
-	if (EntityIsInvisible(&entinfo) && VectorLengthSquared(dir) > 90000) {
-		return qfalse;
-	}
 	// set the right vector
 	VectorCopy(dir, vec);
 	VectorNormalize(vec);
@@ -5068,7 +5055,6 @@ qboolean BotEntityVisible(playerState_t *ps, float fov, int ent) {
 	right[1] = vec[0];
 	right[2] = 0;
 
-	viewer = ps->clientNum;
 	passent = viewer;
 	hitent = ent;
 	contents_mask = CONTENTS_SOLID;
@@ -5130,20 +5116,92 @@ qboolean BotEntityVisible(playerState_t *ps, float fov, int ent) {
 		}
 		// check bottom and top of bounding box as well
 		if (i == 0) {
-			middle[2] -= (entinfo.maxs[2] - entinfo.mins[2]) * 0.5;
+			middle[2] -= (entinfo->maxs[2] - entinfo->mins[2]) * 0.5;
 		} else if (i == 1) {
-			middle[2] += entinfo.maxs[2] - entinfo.mins[2];
+			middle[2] += entinfo->maxs[2] - entinfo->mins[2];
 		} else if (i == 2) { // right side
-			middle[2] -= (entinfo.maxs[2] - entinfo.mins[2]) * 0.5;
-			VectorMA(eye, entinfo.maxs[0] - 0.5, right, eye);
+			middle[2] -= (entinfo->maxs[2] - entinfo->mins[2]) * 0.5;
+			VectorMA(eye, entinfo->maxs[0] - 0.5, right, eye);
 		} else if (i == 3) { // left side
-			VectorMA(eye, -2.0 * (entinfo.maxs[0] - 0.5), right, eye);
+			VectorMA(eye, -2.0 * (entinfo->maxs[0] - 0.5), right, eye);
 		}
 	}
 
 	return qfalse;
 }
 
+/*
+=======================================================================================================================================
+BotEntityVisible
+
+Returns visibility in the range [0, 1] taking fog and water surfaces into account. The traces between two clients are shared by all
+bots for the rest of the frame, as long as neither of them moved.
+=======================================================================================================================================
+*/
+qboolean BotEntityVisible(playerState_t *ps, float fov, int ent) {
+	int viewer, visdist;
+	aas_entityinfo_t entinfo;
+	botVisibility_t *cache;
+	vec3_t viewangles, eye, dir, entangles, middle;
+
+	if (ent < 0) {
+		return qfalse;
+	}
+	// get the entity information
+	BotEntityInfo(ent, &entinfo);
+	// if the entity information is valid
+	if (!entinfo.valid) {
+		return qfalse;
+	}
+	// calculate middle of bounding box
+	VectorAdd(entinfo.mins, entinfo.maxs, middle);
+	VectorScale(middle, 0.5, middle);
+	VectorAdd(entinfo.origin, middle, middle);
+	// calculate eye position
+	VectorCopy(ps->origin, eye);
+
+	eye[2] += ps->viewheight;
+
+	VectorSubtract(middle, eye, dir);
+
+	visdist = bot_visualrange.value;
+
+	if (VectorLength(dir) > visdist) {
+		return qfalse;
+	}
+	// check if entity is within field of vision
+	VectorCopy(ps->viewangles, viewangles);
+	VectorToAngles(dir, entangles);
+
+	if (!InFieldOfVision(viewangles, fov, entangles)) {
+		return qfalse;
+	}
+
+	if (EntityIsInvisible(&entinfo) && VectorLengthSquared(dir) > 90000) {
+		return qfalse;
+	}
+
+	viewer = ps->clientNum;
+	// only the traces between clients are shared
+	if (ent >= MAX_CLIENTS || viewer < 0 || viewer >= MAX_CLIENTS) {
+		return BotEntityTraceVisible(viewer, eye, ent, &entinfo, middle);
+	}
+
+	cache = &botVisibility[viewer][ent];
+
+	if (cache->frame != botVisibilityFrame || !VectorCompare(cache->eye, eye) || !VectorCompare(cache->origin, entinfo.origin) || !VectorCompare(cache->mins, entinfo.mins) || !VectorCompare(cache->maxs, entinfo.maxs)) {
+		cache->frame = botVisibilityFrame;
+		cache->visible = BotEntityTraceVisible(viewer, eye, ent, &entinfo, middle);
+
+		VectorCopy(eye, cache->eye);
+		VectorCopy(entinfo.origin, cache->origin);
+		VectorCopy(entinfo.mins, cache->mins);
+		VectorCopy(entinfo.maxs, cache->maxs);
+	}
+
+	return cache->visible;
+}
+
 /*
 =======================================================================================================================================
 BotEntityIndirectlyVisible
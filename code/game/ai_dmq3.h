@@ -118,6 +118,8 @@ qboolean BotChooseRoamGoal(bot_state_t *bs);
 qboolean BotRoamGoal(bot_state_t *bs, vec3_t goal, qboolean dynamicOnly);
 // returns entity visibility in the range [0, 1]
 qboolean BotEntityVisible(playerState_t *ps, float fov, int ent);
+// invalidates the client to client visibility shared by the bots
+void BotStartVisibilityFrame(void);
 // the bot will aim at the current enemy
 void BotAimAtEnemy(bot_state_t *bs);
 void BotAimAtEnemy_New(bot_state_t *bs); // Tobias DEBUG
@@ -1731,6 +1731,8 @@ int BotAIStartFrame(int time) {
 	}
 
 	floattime = trap_AAS_Time();
+	// the visibility between clients is shared by all bots thinking this frame
+	BotStartVisibilityFrame();
 	// execute scheduled bot AI
 	for (i = 0; i < level.maxclients; i++) {
 		if (!botstates[i] || !botstates[i]->inuse) {
@@ -1925,6 +1927,12 @@ int BotInitLibrary(void) {
 	}
 
 	trap_BotLibVarSet("bot_reloadcharacters", buf);
+	// binary cache of parsed bot files
+	trap_Cvar_VariableStringBuffer("bot_filecache", buf, sizeof(buf));
+
+	if (strlen(buf)) {
+		trap_BotLibVarSet("bot_filecache", buf);
+	}
 	// setup the bot library
 	return trap_BotLibSetup();
 }
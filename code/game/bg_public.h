@@ -41,6 +41,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #define ITEM_RADIUS 15 // item sizes are needed for client side pickup detection
 #define BEAMGUN_RANGE 768
 #define SCORE_NOT_PRESENT -9999 // for the CS_SCORES[12] when only one player is present
+#define SCOREBOARD_ROW_FIELDS 14 // values per client in the "scores" and "scoresdelta" server commands
 #define VOTE_TIME 30000 // 30 seconds before vote times out
 #define MINS_Z -24
 #define DEFAULT_VIEWHEIGHT 40 // increased from 26 to 40 factor: ~1.54
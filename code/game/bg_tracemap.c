@@ -34,8 +34,14 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #define myftol(x) ((int)(x))
 #define MAX_WORLD_HEIGHT MAX_MAP_SIZE // maximum world height
 #define MIN_WORLD_HEIGHT -MAX_MAP_SIZE // minimum world height
-//#define TRACEMAP_SIZE 1024
+// can be raised at build time, the decoded cache keeps the load time flat
+#ifndef TRACEMAP_SIZE
 #define TRACEMAP_SIZE 256
+#endif
+// decoded tracemap cache, written to the home path in host byte order and never shipped
+#define TRACEMAP_CACHE_IDENT (('P' << 24) + ('A' << 16) + ('M' << 8) + 'T') // little-endian "TMAP"
+#define TRACEMAP_CACHE_VERSION 3
+#define TRACEMAP_CHECKSUM_CHUNK 4096
 
 typedef struct tracemap_s {
 	qboolean loaded;
@@ -46,10 +52,124 @@ typedef struct tracemap_s {
 	int groundfloor, groundceil;
 } tracemap_t;
 
+typedef struct {
+	int ident;
+	int version;
+	int size;
+	unsigned int bspChecksum;
+	int tgaLength;
+	unsigned int tgaChecksum;
+	int groundfloor, groundceil;
+} tracemapCacheHeader_t;
+
 static tracemap_t tracemap;
 static vec2_t one_over_mapgrid_factor;
+static qboolean BG_LoadTraceMapFile(const char *mapname, vec2_t world_mins, vec2_t world_maxs, qboolean useCache);
 void FinalizeTracemapClamp(int *x, int *y);
 
+/*
+=======================================================================================================================================
+BG_TraceTracemapPoint
+
+Traces a single gridpoint. Every gridpoint is independent of its neighbours.
+=======================================================================================================================================
+*/
+static int BG_TraceTracemapPoint(bgGenTracemap_t *gen, float x, float y, float *ground, int *groundSurfaceFlags, float *sky, float *skyground) {
+	trace_t tr, ceiling;
+	vec3_t start, end;
+	int traces;
+
+	start[0] = end[0] = x;
+	start[1] = end[1] = y;
+	start[2] = MAX_WORLD_HEIGHT;
+	end[2] = MIN_WORLD_HEIGHT;
+	// find the ceiling, this is also the sky ground where the ground has no sky above it
+	gen->trace(&ceiling, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID|MASK_WATER);
+	start[2] = ceiling.endpos[2] - 1;
+	traces = 1;
+	*groundSurfaceFlags = SURF_NODRAW;
+	// find ground
+	while (1) {
+		// perform traces up to the sky, repeating at a higher start height if we start inside a solid
+		if (start[2] <= MIN_WORLD_HEIGHT) {
+			*ground = MIN_WORLD_HEIGHT;
+			break;
+		}
+
+		if (end[2] <= MIN_WORLD_HEIGHT) {
+			end[2] = MIN_WORLD_HEIGHT + 1;
+		}
+
+		gen->trace(&tr, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID|MASK_WATER);
+		traces++;
+
+		if (tr.startsolid) { // stuck in something, skip over it.
+			start[2] -= 64;
+		} else if (tr.fraction == 1) { // didn't hit anything, we're (probably) outside the world
+			*ground = MIN_WORLD_HEIGHT;
+			break;
+		} else {
+			*ground = tr.endpos[2];
+			*groundSurfaceFlags = tr.surfaceFlags;
+			break;
+		}
+	}
+	// find sky
+	start[2] = *ground;
+	end[2] = MAX_WORLD_HEIGHT;
+
+	if (start[2] == MIN_WORLD_HEIGHT) {
+		// we got a hole here, no need to trace
+		*sky = MAX_WORLD_HEIGHT;
+	} else {
+		while (1) {
+			// perform traces up to the sky, repeating at a higher start height if we start inside a solid
+			if (start[2] >= MAX_WORLD_HEIGHT) {
+				*sky = MAX_WORLD_HEIGHT;
+				break;
+			}
+
+			if (end[2] >= MAX_WORLD_HEIGHT) {
+				end[2] = MAX_WORLD_HEIGHT - 1;
+			}
+
+			gen->trace(&tr, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID);
+			traces++;
+
+			if (tr.startsolid) { // stuck in something, skip over it
+				// can happen, tr.endpos still is valid even if we're starting in a solid but trace out of it hitting the next surface
+				if ((tr.surfaceFlags & SURF_SKY) && !(gen->pointcontents(tr.endpos, ENTITYNUM_NONE) & (MASK_SOLID|MASK_WATER))) {
+					*sky = tr.endpos[2];
+					break;
+				}
+				// skip over it
+				start[2] = tr.endpos[2] + 1;
+			} else if (tr.fraction == 1) { // didn't hit anything, we're (probably) outside the world
+				*sky = MAX_WORLD_HEIGHT;
+				break;
+			} else if (tr.surfaceFlags & SURF_SKY) { // hit sky, this is where we start.
+				*sky = tr.endpos[2];
+				break;
+			} else {
+				// hit something else, skip over it
+				start[2] = tr.endpos[2] + 64;
+			}
+		}
+	}
+	// find ceilings for areas where we don't have sky, the ceiling trace above already did the work
+	if (*sky == MAX_WORLD_HEIGHT && *ground != MIN_WORLD_HEIGHT) {
+		if (ceiling.fraction == 1) { // didn't hit anything, we're (probably) outside the world
+			*skyground = MIN_WORLD_HEIGHT;
+		} else {
+			*skyground = ceiling.endpos[2];
+		}
+	} else {
+		*skyground = *ground;
+	}
+
+	return traces;
+}
+
 /*
 =======================================================================================================================================
 BG_GenerateTracemap
@@ -58,8 +178,6 @@ Currently only used by CGAME.
 =======================================================================================================================================
 */
 void BG_GenerateTracemap(const char *mapname, vec3_t mapcoordsMins, vec3_t mapcoordsMaxs, bgGenTracemap_t *gen) {
-	trace_t tr;
-	vec3_t start, end;
 	int i, j;
 	float x_step, y_step;
 	int topdownmin, topdownmax;
@@ -70,7 +188,7 @@ void BG_GenerateTracemap(const char *mapname, vec3_t mapcoordsMins, vec3_t mapco
 	byte data;
 	static int lastDraw = 0;
 	static int tracecount = 0;
-	int ms;
+	int ms, surfaceFlags;
 	char rawmapname[MAX_QPATH];
 	char dev[MAX_TOKEN_CHARS];
 
@@ -87,198 +205,44 @@ void BG_GenerateTracemap(const char *mapname, vec3_t mapcoordsMins, vec3_t mapco
 	}
 
 	COM_StripExtension(mapname, rawmapname, sizeof(rawmapname));
-	// topdown tracing
-	Com_Printf("Generating level heightmap and level mask...\n");
+	// topdown, sky and sky ground tracing in a single sweep
+	Com_Printf("Generating level heightmap, sky heightmap and sky groundmap...\n");
 
 	memset(&tracemap, 0, sizeof(tracemap));
 
 	topdownmax = MIN_WORLD_HEIGHT;
 	topdownmin = MAX_WORLD_HEIGHT;
+	skygroundmin = MAX_WORLD_HEIGHT;
+	skygroundmax = MIN_WORLD_HEIGHT;
+	max = MIN_WORLD_HEIGHT;
+	min = MAX_WORLD_HEIGHT;
 	// calculate the size of the level
 	// ok, i'm lazy. Hijack commandmap extends for now and default to a TRACEMAP_SIZE by TRACEMAP_SIZE datablock
 	x_step = (mapcoordsMaxs[0] - mapcoordsMins[0]) / (float)TRACEMAP_SIZE;
 	y_step = (mapcoordsMaxs[1] - mapcoordsMins[1]) / (float)TRACEMAP_SIZE;
 
 	for (i = 0; i < TRACEMAP_SIZE; i++) {
-		start[0] = end[0] = mapcoordsMins[0] + i * x_step;
-
 		for (j = 0; j < TRACEMAP_SIZE; j++) {
-			start[1] = end[1] = mapcoordsMins[1] + j * y_step;
-			start[2] = MAX_WORLD_HEIGHT;
-			end[2] = MIN_WORLD_HEIGHT;
-			// find the ceiling
-			gen->trace(&tr, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID|MASK_WATER);
-			start[2] = tr.endpos[2] - 1;
-			tracecount++;
-			// find ground
-			while (1) {
-				// perform traces up to the sky, repeating at a higher start height if we start inside a solid
-				if (start[2] <= MIN_WORLD_HEIGHT) {
-					tracemap.ground[j][i] = MIN_WORLD_HEIGHT;
-					break;
-				}
+			tracecount += BG_TraceTracemapPoint(gen, mapcoordsMins[0] + i * x_step, mapcoordsMins[1] + j * y_step, &tracemap.ground[j][i], &surfaceFlags, &tracemap.sky[j][i], &tracemap.skyground[j][i]);
 
-				if (end[2] <= MIN_WORLD_HEIGHT) {
-					end[2] = MIN_WORLD_HEIGHT + 1;
+			if (!(surfaceFlags & SURF_NODRAW)) {
+				if (tracemap.ground[j][i] > topdownmax) {
+					topdownmax = tracemap.ground[j][i];
 				}
 
-				gen->trace(&tr, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID|MASK_WATER);
-				tracecount++;
-
-				if (tr.startsolid) { // stuck in something, skip over it.
-					start[2] -= 64;
-				} else if (tr.fraction == 1) { // didn't hit anything, we're (probably) outside the world
-					tracemap.ground[j][i] = MIN_WORLD_HEIGHT;
-					break;
-				} else {
-					tracemap.ground[j][i] = tr.endpos[2];
-
-					if (!(tr.surfaceFlags & SURF_NODRAW)) {
-						if (tracemap.ground[j][i] > topdownmax) {
-							topdownmax = tracemap.ground[j][i];
-						}
-
-						if (tracemap.ground[j][i] < topdownmin) {
-							topdownmin = tracemap.ground[j][i];
-						}
-					}
-
-					break;
+				if (tracemap.ground[j][i] < topdownmin) {
+					topdownmin = tracemap.ground[j][i];
 				}
 			}
-			// bit hacky, get some console output going
-			ms = trap_Milliseconds();
-
-			if (!((lastDraw <= ms) && (lastDraw > ms - 500))) {
-				lastDraw = ms;
-
-				Com_Printf("%i of %i gridpoints calculated (%.2f%%), %i total traces\n", i * TRACEMAP_SIZE + j, TRACEMAP_SIZE * TRACEMAP_SIZE, ((i * TRACEMAP_SIZE + j) / (float)(TRACEMAP_SIZE * TRACEMAP_SIZE)) * 100.f, tracecount);
-				//trap_UpdateScreen();
-			}
-		}
-	}
-
-	Com_Printf("%i of %i gridpoints calculated (%.2f%%), %i total traces\n", i * TRACEMAP_SIZE, TRACEMAP_SIZE * TRACEMAP_SIZE, ((i * TRACEMAP_SIZE) / (float)(TRACEMAP_SIZE * TRACEMAP_SIZE)) * 100.f, tracecount);
-	//trap_UpdateScreen();
-
-	// sky tracing
-	Com_Printf("Generating sky heightmap and sky mask...\n");
-
-	max = MIN_WORLD_HEIGHT;
-	min = MAX_WORLD_HEIGHT;
 
-	for (i = 0; i < TRACEMAP_SIZE; i++) {
-		start[0] = end[0] = mapcoordsMins[0] + i * x_step;
-
-		for (j = 0; j < TRACEMAP_SIZE; j++) {
-			start[1] = end[1] = mapcoordsMins[1] + j * y_step;
-			//start[2] = MIN_WORLD_HEIGHT;
-			start[2] = tracemap.ground[j][i];
-			end[2] = MAX_WORLD_HEIGHT;
-
-			if (start[2] == MIN_WORLD_HEIGHT) {
-				// we got a hole here, no need to trace
-				tracemap.sky[j][i] = MAX_WORLD_HEIGHT;
-			} else {
-				// find sky
-				while (1) {
-					// perform traces up to the sky, repeating at a higher start height if we start inside a solid
-					if (start[2] >= MAX_WORLD_HEIGHT) {
-						tracemap.sky[j][i] = MAX_WORLD_HEIGHT;
-						break;
-					}
-
-					if (end[2] >= MAX_WORLD_HEIGHT) {
-						end[2] = MAX_WORLD_HEIGHT - 1;
-					}
-
-					gen->trace(&tr, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID);
-					tracecount++;
-
-					if (tr.startsolid) { // stuck in something, skip over it
-						// can happen, tr.endpos still is valid even if we're starting in a solid but trace out of it hitting the next surface
-						if (tr.surfaceFlags & SURF_SKY) {
-							// are we in a solid?
-							if (!(gen->pointcontents(tr.endpos, ENTITYNUM_NONE) & (MASK_SOLID|MASK_WATER))) {
-								tracemap.sky[j][i] = tr.endpos[2];
-
-								if (tracemap.sky[j][i] > max) {
-									max = tracemap.sky[j][i];
-								}
-
-								if (tracemap.sky[j][i] < min) {
-									min = tracemap.sky[j][i];
-								}
-
-								break;
-							} else {
-								// skip over it
-								start[2] = tr.endpos[2] + 1;
-							}
-						} else {
-							start[2] = tr.endpos[2] + 1;
-						}
-					} else if (tr.fraction == 1) { // didn't hit anything, we're (probably) outside the world
-						tracemap.sky[j][i] = MAX_WORLD_HEIGHT;
-						break;
-					} else if (tr.surfaceFlags & SURF_SKY) { // hit sky, this is where we start.
-						tracemap.sky[j][i] = tr.endpos[2];
-
-						if (tracemap.sky[j][i] > max) {
-							max = tracemap.sky[j][i];
-						}
-
-						if (tracemap.sky[j][i] < min) {
-							min = tracemap.sky[j][i];
-						}
-
-						break;
-					} else {
-						// hit something else, skip over it
-						start[2] = tr.endpos[2] + 64;
-					}
+			if (tracemap.sky[j][i] != MAX_WORLD_HEIGHT) {
+				if (tracemap.sky[j][i] > max) {
+					max = tracemap.sky[j][i];
 				}
-			}
-			// bit hacky, get some console output going
-			ms = trap_Milliseconds();
-
-			if (!((lastDraw <= ms) && (lastDraw > ms - 500))) {
-				lastDraw = ms;
-
-				Com_Printf("%i of %i gridpoints calculated (%.2f%%), %i total traces\n", i * TRACEMAP_SIZE + j, TRACEMAP_SIZE * TRACEMAP_SIZE, ((i * TRACEMAP_SIZE + j) / (float)(TRACEMAP_SIZE * TRACEMAP_SIZE)) * 100.f, tracecount);
-				//trap_UpdateScreen();
-			}
-		}
-	}
 
-	Com_Printf("%i of %i gridpoints calculated (%.2f%%), %i total traces\n", i * TRACEMAP_SIZE, TRACEMAP_SIZE * TRACEMAP_SIZE, ((i * TRACEMAP_SIZE) / (float)(TRACEMAP_SIZE * TRACEMAP_SIZE)) * 100.f, tracecount);
-	//trap_UpdateScreen();
-	// more groundtrace, find ceilings for areas where we don't have ground
-	Com_Printf("Generating sky groundmap...\n");
-
-	skygroundmin = MAX_WORLD_HEIGHT;
-	skygroundmax = MIN_WORLD_HEIGHT;
-
-	for (i = 0; i < TRACEMAP_SIZE; i++) {
-		start[0] = end[0] = mapcoordsMins[0] + i * x_step;
-
-		for (j = 0; j < TRACEMAP_SIZE; j++) {
-			start[1] = end[1] = mapcoordsMins[1] + j * y_step;
-			start[2] = MAX_WORLD_HEIGHT;
-			end[2] = MIN_WORLD_HEIGHT;
-
-			if (tracemap.sky[j][i] == MAX_WORLD_HEIGHT && tracemap.ground[j][i] != MIN_WORLD_HEIGHT) {
-				// find the ceiling
-				gen->trace(&tr, start, NULL, NULL, end, ENTITYNUM_NONE, MASK_SOLID|MASK_WATER);
-				tracecount++;
-
-				if (tr.fraction == 1) { // didn't hit anything, we're (probably) outside the world
-					tracemap.skyground[j][i] = MIN_WORLD_HEIGHT;
-				} else {
-					tracemap.skyground[j][i] = tr.endpos[2];
+				if (tracemap.sky[j][i] < min) {
+					min = tracemap.sky[j][i];
 				}
-			} else {
-				tracemap.skyground[j][i] = tracemap.ground[j][i];
 			}
 
 			if (tracemap.skyground[j][i] != MIN_WORLD_HEIGHT) {
@@ -505,205 +469,367 @@ void BG_GenerateTracemap(const char *mapname, vec3_t mapcoordsMins, vec3_t mapco
 	trap_FS_Write(&i, sizeof(i), f); // developer directory offset, 4 bytes
 	trap_FS_Write("TRUEVISION-XFILE.\0", 18, f);
 	trap_FS_FCloseFile(f);
+	// refresh the decoded cache from the tga we just wrote
+	BG_LoadTraceMapFile(rawmapname, mapcoordsMins, mapcoordsMaxs, qfalse);
 }
 
 /*
 =======================================================================================================================================
-BG_LoadTraceMap
+BG_TraceMapBSPChecksum
+
+The engine's checksum of the loaded bsp, so a recompiled map never picks up a stale tracemap cache. Returns 0 if it isn't known.
 =======================================================================================================================================
 */
-qboolean BG_LoadTraceMap(char *mapname, vec2_t world_mins, vec2_t world_maxs) {
-	int i, j;
+static unsigned int BG_TraceMapBSPChecksum(void) {
+	char buf[MAX_CVAR_VALUE_STRING];
+
+#ifdef CGAME
+	trap_Cvar_VariableStringBuffer("cl_mapChecksum", buf, sizeof(buf));
+#else
+	trap_Cvar_VariableStringBuffer("sv_mapChecksum", buf, sizeof(buf));
+#endif
+	return (unsigned int)atoi(buf);
+}
+
+/*
+=======================================================================================================================================
+BG_TraceMapTGAChecksum
+
+Hashes the tga a word at a time, every tracemap tga has the same length so a regenerated one is only told apart by its contents. Reads
+the file to its end.
+=======================================================================================================================================
+*/
+static unsigned int BG_TraceMapTGAChecksum(fileHandle_t f, int length) {
+	static int buffer[TRACEMAP_CHECKSUM_CHUNK];
+	unsigned int checksum;
+	int chunk, i;
+
+	checksum = 2166136261u ^ length;
+
+	while (length > 0) {
+		chunk = length;
+
+		if (chunk > (int)sizeof(buffer)) {
+			chunk = sizeof(buffer);
+		}
+		// pad the tail so the last partial word hashes the same every time
+		buffer[(chunk - 1) / 4] = 0;
+
+		trap_FS_Read(buffer, chunk, f);
+
+		for (i = 0; i < (chunk + 3) / 4; i++) {
+			checksum = (checksum ^ buffer[i]) * 16777619u;
+		}
+
+		length -= chunk;
+	}
+
+	return checksum;
+}
+
+/*
+=======================================================================================================================================
+BG_ReadTraceMapCache
+=======================================================================================================================================
+*/
+static qboolean BG_ReadTraceMapCache(const char *rawmapname, tracemapCacheHeader_t *key) {
+	tracemapCacheHeader_t header;
+	fileHandle_t f;
+	int length;
+
+	length = trap_FS_FOpenFile(va("%s_tracemap.dat", rawmapname), &f, FS_READ);
+
+	if (length < 0) {
+		return qfalse;
+	}
+
+	if (length != sizeof(header) + sizeof(tracemap.sky) + sizeof(tracemap.skyground) + sizeof(tracemap.ground)) {
+		trap_FS_FCloseFile(f);
+		return qfalse;
+	}
+
+	trap_FS_Read(&header, sizeof(header), f);
+
+	if (header.ident != key->ident || header.version != key->version || header.size != key->size || header.bspChecksum != key->bspChecksum || header.tgaLength != key->tgaLength || header.tgaChecksum != key->tgaChecksum) {
+		trap_FS_FCloseFile(f);
+		return qfalse;
+	}
+
+	trap_FS_Read(tracemap.sky, sizeof(tracemap.sky), f);
+	trap_FS_Read(tracemap.skyground, sizeof(tracemap.skyground), f);
+	trap_FS_Read(tracemap.ground, sizeof(tracemap.ground), f);
+	trap_FS_FCloseFile(f);
+
+	key->groundfloor = header.groundfloor;
+	key->groundceil = header.groundceil;
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+BG_WriteTraceMapCache
+=======================================================================================================================================
+*/
+static void BG_WriteTraceMapCache(const char *rawmapname, const tracemapCacheHeader_t *key) {
 	fileHandle_t f;
-	byte data, datablock[TRACEMAP_SIZE][4];
+
+	if (trap_FS_FOpenFile(va("%s_tracemap.dat", rawmapname), &f, FS_WRITE) < 0 || !f) {
+		return;
+	}
+
+	trap_FS_Write(key, sizeof(*key), f);
+	trap_FS_Write(tracemap.sky, sizeof(tracemap.sky), f);
+	trap_FS_Write(tracemap.skyground, sizeof(tracemap.skyground), f);
+	trap_FS_Write(tracemap.ground, sizeof(tracemap.ground), f);
+	trap_FS_FCloseFile(f);
+}
+
+/*
+=======================================================================================================================================
+BG_ReadTraceMapTGA
+=======================================================================================================================================
+*/
+static qboolean BG_ReadTraceMapTGA(fileHandle_t f, int *groundfloor, int *groundceil) {
+	int i, j;
+	byte header[18], datablock[TRACEMAP_SIZE][4];
 	int sky_min, sky_max;
 	int ground_min, ground_max;
 	int skyground_min, skyground_max;
 	float scalefactor;
-	char rawmapname[MAX_QPATH];
-	//int startTime = trap_Milliseconds();
 
 	ground_min = ground_max = MIN_WORLD_HEIGHT;
 	skyground_min = skyground_max = MAX_WORLD_HEIGHT;
 	sky_min = sky_max = MAX_WORLD_HEIGHT;
+	trap_FS_Read(header, sizeof(header), f);
 
-	COM_StripExtension(mapname, rawmapname, sizeof(rawmapname));
+	if ((header[12]|(header[13] << 8)) != TRACEMAP_SIZE || (header[14]|(header[15] << 8)) != TRACEMAP_SIZE) {
+		return qfalse;
+	}
 
-	if (trap_FS_FOpenFile(va("%s_tracemap.tga", Q_strlwr(rawmapname)), &f, FS_READ) >= 0) {
-		// skip over header
-		for (i = 0; i < 18; i++) {
-			trap_FS_Read(&data, 1, f);
-		}
+	for (i = 0; i < TRACEMAP_SIZE; i++) {
+		trap_FS_Read(&datablock, sizeof(datablock), f); // TRACEMAP_SIZE * {b g r a}
 
-		for (i = 0; i < TRACEMAP_SIZE; i++) {
-			trap_FS_Read(&datablock, sizeof(datablock), f); // TRACEMAP_SIZE * {b g r a}
-
-			for (j = 0; j < TRACEMAP_SIZE; j++) {
-				if (i == 0 && j < 6) {
-					// abuse first six pixels for our extended data
-					switch (j) {
-						case 0:
-							ground_min = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
-							break;
-						case 1:
-							ground_max = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
-							break;
-						case 2:
-							skyground_min = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
-							break;
-						case 3:
-							skyground_max = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
-							break;
-						case 4:
-							sky_min = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
-							break;
-						case 5:
-							sky_max = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
-							break;
-					}
-
-					tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-					tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-					tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
-					continue;
+		for (j = 0; j < TRACEMAP_SIZE; j++) {
+			if (i == 0 && j < 6) {
+				// abuse first six pixels for our extended data
+				switch (j) {
+					case 0:
+						ground_min = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
+						break;
+					case 1:
+						ground_max = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
+						break;
+					case 2:
+						skyground_min = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
+						break;
+					case 3:
+						skyground_max = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
+						break;
+					case 4:
+						sky_min = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
+						break;
+					case 5:
+						sky_max = datablock[j][0]|(datablock[j][1] << 8)|(datablock[j][2] << 16)|(datablock[j][3] << 24);
+						break;
 				}
 
-				tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[j][0]; // FIXME: swap
+				tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
+				continue;
+			}
 
-				if (tracemap.sky[TRACEMAP_SIZE - 1 - i][j] == 0) {
-					tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-				}
+			tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[j][0]; // FIXME: swap
 
-				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[j][1]; // FIXME: swap
+			if (tracemap.sky[TRACEMAP_SIZE - 1 - i][j] == 0) {
+				tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+			}
 
-				if (tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] == 0) {
-					tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-				}
+			tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[j][1]; // FIXME: swap
 
-				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[j][2]; // FIXME: swap
+			if (tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] == 0) {
+				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+			}
 
-				if (tracemap.ground[TRACEMAP_SIZE - 1 - i][j] == 0) {
-					tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
-				}
+			tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[j][2]; // FIXME: swap
 
-				if (datablock[j][3] == 0) {
-					// just in case
-					tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-					tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
-				}
+			if (tracemap.ground[TRACEMAP_SIZE - 1 - i][j] == 0) {
+				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
+			}
+
+			if (datablock[j][3] == 0) {
+				// just in case
+				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
 			}
-			/*
-			for (j = 0; j < TRACEMAP_SIZE; j++) {
-				if (i == 0 && j < 6) {
-					// abuse first six pixels for our extended data
-					switch (j) {
-						case 0:
-							trap_FS_Read(&ground_min, sizeof(ground_min), f);
-							break;
-						case 1:
-							trap_FS_Read(&ground_max, sizeof(ground_max), f);
-							break;
-						case 2:
-							trap_FS_Read(&skyground_min, sizeof(skyground_min), f);
-							break;
-						case 3:
-							trap_FS_Read(&skyground_max, sizeof(skyground_max), f);
-							break;
-						case 4:
-							trap_FS_Read(&sky_min, sizeof(sky_min), f);
-							break;
-						case 5:
-							trap_FS_Read(&sky_max, sizeof(sky_max), f);
-							break;
-					}
-
-					tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-					tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-					tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
-					continue;
+		}
+		/*
+		for (j = 0; j < TRACEMAP_SIZE; j++) {
+			if (i == 0 && j < 6) {
+				// abuse first six pixels for our extended data
+				switch (j) {
+					case 0:
+						trap_FS_Read(&ground_min, sizeof(ground_min), f);
+						break;
+					case 1:
+						trap_FS_Read(&ground_max, sizeof(ground_max), f);
+						break;
+					case 2:
+						trap_FS_Read(&skyground_min, sizeof(skyground_min), f);
+						break;
+					case 3:
+						trap_FS_Read(&skyground_max, sizeof(skyground_max), f);
+						break;
+					case 4:
+						trap_FS_Read(&sky_min, sizeof(sky_min), f);
+						break;
+					case 5:
+						trap_FS_Read(&sky_max, sizeof(sky_max), f);
+						break;
 				}
 
-				trap_FS_Read(&datablock, sizeof(datablock), f); // b g r a
-				tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[0]; // FIXME: swap
+				tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
+				continue;
+			}
 
-				if (tracemap.sky[TRACEMAP_SIZE - 1 - i][j] == 0) {
-					tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-				}
+			trap_FS_Read(&datablock, sizeof(datablock), f); // b g r a
+			tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[0]; // FIXME: swap
 
-				//trap_FS_Read(&data, 1, f); // g
-				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[1]; // FIXME: swap
+			if (tracemap.sky[TRACEMAP_SIZE - 1 - i][j] == 0) {
+				tracemap.sky[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+			}
 
-				if (tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] == 0) {
-					tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-				}
+			//trap_FS_Read(&data, 1, f); // g
+			tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[1]; // FIXME: swap
 
-				//trap_FS_Read(&data, sizeof(data), f); // r
-				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[2]; // FIXME: swap
+			if (tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] == 0) {
+				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+			}
 
-				if (tracemap.ground[TRACEMAP_SIZE - 1 - i][j] == 0) {
-					tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
-				}
+			//trap_FS_Read(&data, sizeof(data), f); // r
+			tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = (float)datablock[2]; // FIXME: swap
 
-				//trap_FS_Read(&data, sizeof(data), f); // a
-				if (datablock[3] == 0) {
-					// just in case
-					tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
-					tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
-				}
+			if (tracemap.ground[TRACEMAP_SIZE - 1 - i][j] == 0) {
+				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
 			}
-			*/
-		}
 
-		trap_FS_FCloseFile(f);
-		// Ground: calculate scalefactor
-		if (ground_max - ground_min == 0) {
-			scalefactor = 1.f;
-		} else {
-			// scalefactor 254 to compensate for broken etmain behavior
-			scalefactor = 254.f / (ground_max - ground_min);
-		}
-		// scale properly
-		for (i = 0; i < TRACEMAP_SIZE; i++) {
-			for (j = 0; j < TRACEMAP_SIZE; j++) {
-				if (tracemap.ground[i][j] != MIN_WORLD_HEIGHT) {
-					tracemap.ground[i][j] = ground_min + (tracemap.ground[i][j] / scalefactor);
-				}
+			//trap_FS_Read(&data, sizeof(data), f); // a
+			if (datablock[3] == 0) {
+				// just in case
+				tracemap.skyground[TRACEMAP_SIZE - 1 - i][j] = MAX_WORLD_HEIGHT;
+				tracemap.ground[TRACEMAP_SIZE - 1 - i][j] = MIN_WORLD_HEIGHT;
 			}
 		}
-		// SkyGround: calculate scalefactor
-		if (skyground_max - skyground_min == 0) {
-			scalefactor = 1.f;
-		} else {
-			// scalefactor 254 to compensate for broken etmain behavior
-			scalefactor = 254.f / (skyground_max - skyground_min);
-		}
-		// scale properly
-		for (i = 0; i < TRACEMAP_SIZE; i++) {
-			for (j = 0; j < TRACEMAP_SIZE; j++) {
-				if (tracemap.skyground[i][j] != MAX_WORLD_HEIGHT) {
-					tracemap.skyground[i][j] = skyground_min + (tracemap.skyground[i][j] / scalefactor);
-				}
+		*/
+	}
+
+	// Ground: calculate scalefactor
+	if (ground_max - ground_min == 0) {
+		scalefactor = 1.f;
+	} else {
+		// scalefactor 254 to compensate for broken etmain behavior
+		scalefactor = 254.f / (ground_max - ground_min);
+	}
+	// scale properly
+	for (i = 0; i < TRACEMAP_SIZE; i++) {
+		for (j = 0; j < TRACEMAP_SIZE; j++) {
+			if (tracemap.ground[i][j] != MIN_WORLD_HEIGHT) {
+				tracemap.ground[i][j] = ground_min + (tracemap.ground[i][j] / scalefactor);
 			}
 		}
-		// Sky: calculate scalefactor
-		if (sky_max - sky_min == 0) {
-			scalefactor = 1.f;
-		} else {
-			// scalefactor 254 to compensate for broken etmain behavior
-			scalefactor = 254.f / (sky_max - sky_min);
-		}
-		// scale properly
-		for (i = 0; i < TRACEMAP_SIZE; i++) {
-			for (j = 0; j < TRACEMAP_SIZE; j++) {
-				if (tracemap.sky[i][j] != MAX_WORLD_HEIGHT) {
-					tracemap.sky[i][j] = sky_min + (tracemap.sky[i][j] / scalefactor);
-				}
+	}
+	// SkyGround: calculate scalefactor
+	if (skyground_max - skyground_min == 0) {
+		scalefactor = 1.f;
+	} else {
+		// scalefactor 254 to compensate for broken etmain behavior
+		scalefactor = 254.f / (skyground_max - skyground_min);
+	}
+	// scale properly
+	for (i = 0; i < TRACEMAP_SIZE; i++) {
+		for (j = 0; j < TRACEMAP_SIZE; j++) {
+			if (tracemap.skyground[i][j] != MAX_WORLD_HEIGHT) {
+				tracemap.skyground[i][j] = skyground_min + (tracemap.skyground[i][j] / scalefactor);
 			}
 		}
+	}
+	// Sky: calculate scalefactor
+	if (sky_max - sky_min == 0) {
+		scalefactor = 1.f;
 	} else {
-		Com_Printf("DEBUG: Failed to open tracemap %s\n", va("%s_tracemap.tga", Q_strlwr(rawmapname)));
+		// scalefactor 254 to compensate for broken etmain behavior
+		scalefactor = 254.f / (sky_max - sky_min);
+	}
+	// scale properly
+	for (i = 0; i < TRACEMAP_SIZE; i++) {
+		for (j = 0; j < TRACEMAP_SIZE; j++) {
+			if (tracemap.sky[i][j] != MAX_WORLD_HEIGHT) {
+				tracemap.sky[i][j] = sky_min + (tracemap.sky[i][j] / scalefactor);
+			}
+		}
+	}
+
+	*groundfloor = ground_min;
+	*groundceil = ground_max;
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+BG_LoadTraceMapFile
+
+Loads the decoded cache when it still matches the bsp and the tga, otherwise decodes the tga and refreshes the cache.
+=======================================================================================================================================
+*/
+static qboolean BG_LoadTraceMapFile(const char *mapname, vec2_t world_mins, vec2_t world_maxs, qboolean useCache) {
+	tracemapCacheHeader_t key;
+	fileHandle_t f;
+	char rawmapname[MAX_QPATH];
+	//int startTime = trap_Milliseconds();
+
+	COM_StripExtension(mapname, rawmapname, sizeof(rawmapname));
+
+	memset(&key, 0, sizeof(key));
+
+	key.ident = TRACEMAP_CACHE_IDENT;
+	key.version = TRACEMAP_CACHE_VERSION;
+	key.size = TRACEMAP_SIZE;
+	key.bspChecksum = BG_TraceMapBSPChecksum();
+	key.tgaLength = trap_FS_FOpenFile(va("%s_tracemap.tga", Q_strlwr(rawmapname)), &f, FS_READ);
+
+	if (key.tgaLength < 0) {
+		Com_Printf("DEBUG: Failed to open tracemap %s\n", va("%s_tracemap.tga", rawmapname));
 		return (tracemap.loaded = qfalse);
 	}
+	// without a checksum a stale cache can't be told apart
+	if (!key.bspChecksum) {
+		useCache = qfalse;
+	}
+
+	key.tgaChecksum = BG_TraceMapTGAChecksum(f, key.tgaLength);
+
+	if (!useCache || !BG_ReadTraceMapCache(rawmapname, &key)) {
+		// the checksum read the whole file, start over for decoding
+		trap_FS_FCloseFile(f);
+
+		if (trap_FS_FOpenFile(va("%s_tracemap.tga", rawmapname), &f, FS_READ) < 0) {
+			return (tracemap.loaded = qfalse);
+		}
+
+		if (!BG_ReadTraceMapTGA(f, &key.groundfloor, &key.groundceil)) {
+			Com_Printf("Tracemap %s is not %ix%i.\n", va("%s_tracemap.tga", rawmapname), TRACEMAP_SIZE, TRACEMAP_SIZE);
+			trap_FS_FCloseFile(f);
+			return (tracemap.loaded = qfalse);
+		}
+
+		if (key.bspChecksum) {
+			BG_WriteTraceMapCache(rawmapname, &key);
+		}
+	}
+
+	trap_FS_FCloseFile(f);
 
 	tracemap.world_mins[0] = world_mins[0];
 	tracemap.world_mins[1] = world_mins[1];
@@ -713,14 +839,23 @@ qboolean BG_LoadTraceMap(char *mapname, vec2_t world_mins, vec2_t world_maxs) {
 	one_over_mapgrid_factor[0] = 1.f / ((tracemap.world_maxs[0] - tracemap.world_mins[0]) / (float)TRACEMAP_SIZE);
 	one_over_mapgrid_factor[1] = 1.f / ((tracemap.world_maxs[1] - tracemap.world_mins[1]) / (float)TRACEMAP_SIZE);
 
-	tracemap.groundfloor = ground_min;
-	tracemap.groundceil = ground_max;
+	tracemap.groundfloor = key.groundfloor;
+	tracemap.groundceil = key.groundceil;
 
 	//Com_Printf("^8Loaded tracemap in %i msec\n", trap_Milliseconds() - startTime);
 
 	return (tracemap.loaded = qtrue);
 }
 
+/*
+=======================================================================================================================================
+BG_LoadTraceMap
+=======================================================================================================================================
+*/
+qboolean BG_LoadTraceMap(char *mapname, vec2_t world_mins, vec2_t world_maxs) {
+	return BG_LoadTraceMapFile(mapname, world_mins, world_maxs, qtrue);
+}
+
 /*
 =======================================================================================================================================
 BG_ClampPointToTracemapExtends
@@ -836,7 +836,9 @@ void ClientThink_Real(gentity_t *ent) {
 		}
 	}
 
+	G_PmoveRecordBegin(client, &pm);
 	Pmove(&pm);
+	G_PmoveRecordEnd(client, &pm);
 // Tobias HACK: find a better, more natural-looking solution
 	// prevent players from standing ontop of each other
 	if (ent->client->ps.groundEntityNum >= 0 && ent->client->ps.groundEntityNum < MAX_CLIENTS && VectorLengthSquared(ent->client->ps.velocity) < 40000) {
@@ -143,7 +143,7 @@ static gentity_t *SpawnModelOnVictoryPad(gentity_t *pad, vec3_t offset, gentity_
 		return NULL;
 	}
 
-	body->classname = ent->client->pers.netname;
+	G_SetClassname(body, ent->client->pers.netname);
 	body->client = ent->client;
 	body->s = ent->s;
 	body->s.eType = ET_PLAYER; // could be ET_INVISIBLE
@@ -224,7 +224,7 @@ CelebrateStart
 static void CelebrateStart(gentity_t *player) {
 
 	player->s.torsoAnim = ((player->s.torsoAnim & ANIM_TOGGLEBIT) ^ ANIM_TOGGLEBIT)|TORSO_GESTURE;
-	player->nextthink = level.time + TIMER_GESTURE;
+	G_SetNextThink(player, level.time + TIMER_GESTURE);
 	player->think = CelebrateStop;
 	/*
 	player->client->ps.events[player->client->ps.eventSequence & (MAX_PS_EVENTS - 1)] = EV_TAUNT;
@@ -247,7 +247,7 @@ static void PodiumPlacementThink(gentity_t *podium) {
 	vec3_t origin;
 	vec3_t f, r, u;
 
-	podium->nextthink = level.time + 100;
+	G_SetNextThink(podium, level.time + 100);
 
 	AngleVectorsForward(level.intermission_angle, vec);
 	VectorMA(level.intermission_origin, trap_Cvar_VariableIntegerValue("g_podiumDist"), vec, origin);
@@ -315,7 +315,7 @@ static gentity_t *SpawnPodium(void) {
 		return NULL;
 	}
 
-	podium->classname = "podium";
+	G_SetClassname(podium, "podium");
 	podium->s.eType = ET_GENERAL;
 	podium->s.number = podium - g_entities;
 	podium->clipmask = CONTENTS_SOLID;
@@ -336,7 +336,7 @@ static gentity_t *SpawnPodium(void) {
 	trap_LinkEntity(podium);
 
 	podium->think = PodiumPlacementThink;
-	podium->nextthink = level.time + 100;
+	G_SetNextThink(podium, level.time + 100);
 	return podium;
 }
 
@@ -358,7 +358,7 @@ void SpawnModelsOnVictoryPads(void) {
 	player = SpawnModelOnVictoryPad(podium, offsetFirst, &g_entities[level.sortedClients[0]], level.clients[level.sortedClients[0]].ps.persistant[PERS_RANK] & ~RANK_TIED_FLAG);
 
 	if (player) {
-		player->nextthink = level.time + 2000;
+		G_SetNextThink(player, level.time + 2000);
 		player->think = CelebrateStart;
 		podium1 = player;
 	}
@@ -390,7 +390,7 @@ void Svcmd_AbortPodium_f(void) {
 	}
 
 	if (podium1) {
-		podium1->nextthink = level.time;
+		G_SetNextThink(podium1, level.time);
 		podium1->think = CelebrateStop;
 	}
 }
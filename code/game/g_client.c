@@ -61,7 +61,7 @@ equivalent to info_player_deathmatch
 */
 void SP_info_player_start(gentity_t *ent) {
 
-	ent->classname = "info_player_deathmatch";
+	G_SetClassname(ent, "info_player_deathmatch");
 	SP_info_player_deathmatch(ent);
 }
 
@@ -369,7 +369,7 @@ void InitBodyQue(void) {
 
 	for (i = 0; i < BODY_QUEUE_SIZE; i++) {
 		ent = G_Spawn();
-		ent->classname = "bodyque";
+		G_SetClassname(ent, "bodyque");
 		ent->neverFree = qtrue;
 		level.bodyQue[i] = ent;
 	}
@@ -391,7 +391,7 @@ void BodySink(gentity_t *ent) {
 		return;
 	}
 
-	ent->nextthink = level.time + 100;
+	G_SetNextThink(ent, level.time + 100);
 	ent->s.pos.trBase[2] -= 1;
 }
 
@@ -452,6 +452,8 @@ void CopyToBodyQue(gentity_t *ent) {
 	body->physicsObject = qtrue;
 	body->physicsBounce = 0; // don't bounce
 
+	G_ActivateEntity(body);
+
 	if (body->s.groundEntityNum == ENTITYNUM_NONE) {
 		body->s.pos.trType = TR_GRAVITY;
 
@@ -489,7 +491,7 @@ void CopyToBodyQue(gentity_t *ent) {
 	body->clipmask = CONTENTS_SOLID|CONTENTS_PLAYERCLIP;
 	body->r.contents = CONTENTS_CORPSE;
 	body->r.ownerNum = ent->s.number;
-	body->nextthink = level.time + 5000;
+	G_SetNextThink(body, level.time + 5000);
 	body->think = BodySink;
 	body->die = BodyDie;
 	// don't take more damage if already gibbed
@@ -837,6 +839,8 @@ const char *ClientConnect(int clientNum, qboolean firstTime, qboolean isBot) {
 	//areabits = client->areabits;
 
 	memset(client, 0, sizeof(*client));
+	// a new cgame has no scoreboard to apply deltas to
+	G_ResetScoreboardBaseline(clientNum);
 
 	client->pers.connected = CON_CONNECTING;
 	// check for local client
@@ -1026,7 +1030,7 @@ void ClientSpawn(gentity_t *ent) {
 	ent->client = &level.clients[index];
 	ent->takedamage = qtrue;
 	ent->inuse = qtrue;
-	ent->classname = "player";
+	G_SetClassname(ent, "player");
 	ent->r.contents = CONTENTS_BODY;
 	ent->clipmask = MASK_PLAYERSOLID;
 	ent->die = PlayerDie;
@@ -1132,6 +1136,8 @@ void ClientDisconnect(int clientNum) {
 	if (!ent->client || ent->client->pers.connected == CON_DISCONNECTED) {
 		return;
 	}
+
+	G_StopPmoveRecord(clientNum);
 	// stop any following clients
 	for (i = 0; i < level.maxclients; i++) {
 		if (level.clients[i].sess.sessionTeam == TEAM_SPECTATOR && level.clients[i].sess.spectatorState == SPECTATOR_FOLLOW && level.clients[i].sess.spectatorClient == clientNum) {
@@ -1169,7 +1175,7 @@ void ClientDisconnect(int clientNum) {
 
 	ent->s.modelindex = 0;
 	ent->inuse = qfalse;
-	ent->classname = "disconnected";
+	G_SetClassname(ent, "disconnected");
 	ent->client->pers.connected = CON_DISCONNECTED;
 	ent->client->ps.persistant[PERS_TEAM] = TEAM_FREE;
 	ent->client->sess.sessionTeam = TEAM_FREE;
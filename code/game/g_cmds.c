@@ -25,51 +25,230 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include "g_local.h"
 #include "../../ui/menudef.h" // for the voice chats
 
+#define SCOREBOARD_PING_FIELD 2
+#define SCOREBOARD_PING_STEP 10 // ping changes smaller than this aren't sent in deltas
+#define SCOREBOARD_FULL_INTERVAL 8 // resend the whole scoreboard after this many deltas so demos and restarted cgames catch up
+
+typedef struct {
+	qboolean valid;
+	int numDeltas;
+	int numScores;
+	int teamScores[2];
+	int rows[MAX_CLIENTS][SCOREBOARD_ROW_FIELDS];
+} scoreboardBaseline_t;
+
+// the last scoreboard each client was sent, deltas are built against it
+static scoreboardBaseline_t scoreboardBaselines[MAX_CLIENTS];
+static int scoreboardRows[MAX_CLIENTS][SCOREBOARD_ROW_FIELDS];
+
+/*
+=======================================================================================================================================
+G_ResetScoreboardBaseline
+
+The next scoreboard message sent to the client will be a full one.
+=======================================================================================================================================
+*/
+void G_ResetScoreboardBaseline(int clientNum) {
+	scoreboardBaselines[clientNum].valid = qfalse;
+}
+
+/*
+=======================================================================================================================================
+ScoreboardRow
+=======================================================================================================================================
+*/
+static void ScoreboardRow(int clientNum, int *row) {
+	gclient_t *cl;
+	int ping, accuracy, perfect;
+
+	cl = &level.clients[clientNum];
+
+	if (cl->pers.connected == CON_CONNECTING) {
+		ping = -1;
+	} else {
+		ping = cl->ps.ping < 999 ? cl->ps.ping : 999;
+	}
+
+	if (cl->accuracy_shots) {
+		accuracy = cl->accuracy_hits * 100 / cl->accuracy_shots;
+	} else {
+		accuracy = 0;
+	}
+
+	perfect = (cl->ps.persistant[PERS_RANK] == 0 && cl->ps.persistant[PERS_KILLED] == 0) ? 1 : 0;
+
+	row[0] = clientNum;
+	row[1] = cl->ps.persistant[PERS_SCORE];
+	row[2] = ping;
+	row[3] = (level.time - cl->pers.enterTime) / 60000;
+	row[4] = 0; // scoreFlags
+	row[5] = g_entities[clientNum].s.powerups;
+	row[6] = accuracy;
+	row[7] = cl->ps.persistant[PERS_EXCELLENT_COUNT];
+	row[8] = cl->ps.persistant[PERS_IMPRESSIVE_COUNT];
+	row[9] = cl->ps.persistant[PERS_GAUNTLET_FRAG_COUNT];
+	row[10] = cl->ps.persistant[PERS_CAPTURES];
+	row[11] = cl->ps.persistant[PERS_DEFEND_COUNT];
+	row[12] = cl->ps.persistant[PERS_ASSIST_COUNT];
+	row[13] = perfect;
+}
+
+/*
+=======================================================================================================================================
+ScoreboardRowString
+=======================================================================================================================================
+*/
+static int ScoreboardRowString(char *entry, int size, const int *row) {
+
+	Com_sprintf(entry, size, " %i %i %i %i %i %i %i %i %i %i %i %i %i %i", row[0], row[1], row[2], row[3], row[4], row[5], row[6], row[7], row[8], row[9], row[10], row[11], row[12], row[13]);
+	return strlen(entry);
+}
+
+/*
+=======================================================================================================================================
+ScoreboardRowChanges
+
+Returns a bit for each field of the row that has to be sent again.
+=======================================================================================================================================
+*/
+static int ScoreboardRowChanges(const int *row, const int *old) {
+	int i, changes;
+
+	// another client moved into this place
+	if (row[0] != old[0]) {
+		return (1 << SCOREBOARD_ROW_FIELDS) - 1;
+	}
+
+	changes = 0;
+
+	for (i = 1; i < SCOREBOARD_ROW_FIELDS; i++) {
+		// ping jitters every frame, only resend it when it moved noticeably
+		if (i == SCOREBOARD_PING_FIELD) {
+			if (abs(row[i] - old[i]) < SCOREBOARD_PING_STEP) {
+				continue;
+			}
+		} else if (row[i] == old[i]) {
+			continue;
+		}
+
+		changes |= 1 << i;
+	}
+
+	return changes;
+}
+
+/*
+=======================================================================================================================================
+ScoreboardDeltaMessage
+
+Sends only the fields that changed since the last scoreboard the client was sent. Each changed row is sent as its index, a bit mask of
+the changed fields and their values. Returns qfalse if the changes don't fit in a single command, in which case a full scoreboard has
+to be sent instead.
+=======================================================================================================================================
+*/
+static qboolean ScoreboardDeltaMessage(int clientNum, int numSorted) {
+	scoreboardBaseline_t *baseline;
+	char entry[1024];
+	char string[1000];
+	int changes[MAX_CLIENTS];
+	int stringlength;
+	int i, j, k, numChanged;
+
+	baseline = &scoreboardBaselines[clientNum];
+	string[0] = 0;
+	stringlength = 0;
+	numChanged = 0;
+
+	for (i = 0; i < numSorted; i++) {
+		if (i < baseline->numScores) {
+			changes[i] = ScoreboardRowChanges(scoreboardRows[i], baseline->rows[i]);
+		} else {
+			changes[i] = (1 << SCOREBOARD_ROW_FIELDS) - 1;
+		}
+
+		if (!changes[i]) {
+			continue;
+		}
+
+		Com_sprintf(entry, sizeof(entry), " %i %i", i, changes[i]);
+
+		j = strlen(entry);
+
+		for (k = 0; k < SCOREBOARD_ROW_FIELDS; k++) {
+			if (changes[i] & (1 << k)) {
+				Com_sprintf(entry + j, sizeof(entry) - j, " %i", scoreboardRows[i][k]);
+				j += strlen(entry + j);
+			}
+		}
+
+		if (stringlength + j >= sizeof(string)) {
+			return qfalse;
+		}
+
+		strcpy(string + stringlength, entry);
+
+		stringlength += j;
+		numChanged++;
+	}
+	// nothing to tell the client
+	if (!numChanged && numSorted == baseline->numScores && level.teamScores[TEAM_RED] == baseline->teamScores[0] && level.teamScores[TEAM_BLUE] == baseline->teamScores[1]) {
+		return qtrue;
+	}
+
+	trap_SendServerCommand(clientNum, va("scoresdelta %i %i %i %i%s", numSorted, level.teamScores[TEAM_RED], level.teamScores[TEAM_BLUE], numChanged, string));
+	// the client only has what was sent, so a slowly drifting ping is still resent eventually
+	for (i = 0; i < numSorted; i++) {
+		for (k = 0; k < SCOREBOARD_ROW_FIELDS; k++) {
+			if (changes[i] & (1 << k)) {
+				baseline->rows[i][k] = scoreboardRows[i][k];
+			}
+		}
+	}
+
+	baseline->numScores = numSorted;
+	baseline->teamScores[0] = level.teamScores[TEAM_RED];
+	baseline->teamScores[1] = level.teamScores[TEAM_BLUE];
+	baseline->numDeltas++;
+	return qtrue;
+}
+
 /*
 =======================================================================================================================================
 DeathmatchScoreboardMessage
 =======================================================================================================================================
 */
 void DeathmatchScoreboardMessage(gentity_t *ent) {
+	scoreboardBaseline_t *baseline;
 	char entry[1024];
 	char string[1000];
 	int stringlength;
-	int i, j, ping;
-	gclient_t *cl;
-	int numSorted, scoreFlags, accuracy, perfect;
+	int i, j, clientNum;
+	int numSorted;
 
 	// don't send scores to bots, they don't parse it
 	if (ent->r.svFlags & SVF_BOT) {
 		return;
 	}
-	// send the latest information on all clients
-	string[0] = 0;
-	stringlength = 0;
-	scoreFlags = 0;
 
+	clientNum = ent - g_entities;
+	baseline = &scoreboardBaselines[clientNum];
 	numSorted = level.numConnectedClients;
 
 	for (i = 0; i < numSorted; i++) {
-		cl = &level.clients[level.sortedClients[i]];
-
-		if (cl->pers.connected == CON_CONNECTING) {
-			ping = -1;
-		} else {
-			ping = cl->ps.ping < 999 ? cl->ps.ping : 999;
-		}
-
-		if (cl->accuracy_shots) {
-			accuracy = cl->accuracy_hits * 100 / cl->accuracy_shots;
-		} else {
-			accuracy = 0;
+		ScoreboardRow(level.sortedClients[i], scoreboardRows[i]);
+	}
+	// only send what changed if the client has a recent enough scoreboard
+	if (baseline->valid && baseline->numDeltas < SCOREBOARD_FULL_INTERVAL) {
+		if (ScoreboardDeltaMessage(clientNum, numSorted)) {
+			return;
 		}
+	}
+	// send the latest information on all clients
+	string[0] = 0;
+	stringlength = 0;
 
-		perfect = (cl->ps.persistant[PERS_RANK] == 0 && cl->ps.persistant[PERS_KILLED] == 0) ? 1 : 0;
-
-		Com_sprintf(entry, sizeof(entry), " %i %i %i %i %i %i %i %i %i %i %i %i %i %i", level.sortedClients[i], cl->ps.persistant[PERS_SCORE], ping, (level.time - cl->pers.enterTime) / 60000, scoreFlags, g_entities[level.sortedClients[i]].s.powerups, accuracy,
-			cl->ps.persistant[PERS_EXCELLENT_COUNT], cl->ps.persistant[PERS_IMPRESSIVE_COUNT], cl->ps.persistant[PERS_GAUNTLET_FRAG_COUNT], cl->ps.persistant[PERS_CAPTURES], cl->ps.persistant[PERS_DEFEND_COUNT], cl->ps.persistant[PERS_ASSIST_COUNT], perfect);
-
-		j = strlen(entry);
+	for (i = 0; i < numSorted; i++) {
+		j = ScoreboardRowString(entry, sizeof(entry), scoreboardRows[i]);
 
 		if (stringlength + j >= sizeof(string)) {
 			break;
@@ -80,17 +259,39 @@ void DeathmatchScoreboardMessage(gentity_t *ent) {
 		stringlength += j;
 	}
 
-	trap_SendServerCommand(ent - g_entities, va("scores %i %i %i%s", i, level.teamScores[TEAM_RED], level.teamScores[TEAM_BLUE], string));
+	trap_SendServerCommand(clientNum, va("scores %i %i %i%s", i, level.teamScores[TEAM_RED], level.teamScores[TEAM_BLUE], string));
+
+	numSorted = i;
+
+	for (i = 0; i < numSorted; i++) {
+		memcpy(baseline->rows[i], scoreboardRows[i], sizeof(baseline->rows[i]));
+	}
+
+	baseline->valid = qtrue;
+	baseline->numDeltas = 0;
+	baseline->numScores = numSorted;
+	baseline->teamScores[0] = level.teamScores[TEAM_RED];
+	baseline->teamScores[1] = level.teamScores[TEAM_BLUE];
 }
 
 /*
 =======================================================================================================================================
 Cmd_Score_f
 
-Request current scoreboard information.
+Request current scoreboard information. "score full" asks for the whole scoreboard instead of a delta.
 =======================================================================================================================================
 */
 void Cmd_Score_f(gentity_t *ent) {
+	char arg[MAX_TOKEN_CHARS];
+
+	if (trap_Argc() > 1) {
+		trap_Argv(1, arg, sizeof(arg));
+
+		if (!Q_stricmp(arg, "full")) {
+			G_ResetScoreboardBaseline(ent - g_entities);
+		}
+	}
+
 	DeathmatchScoreboardMessage(ent);
 }
 
@@ -322,7 +523,7 @@ void Cmd_Give_f(gentity_t *ent) {
 
 		VectorCopy(ent->r.currentOrigin, it_ent->s.origin);
 
-		it_ent->classname = it->classname;
+		G_SetClassname(it_ent, it->classname);
 
 		G_SpawnItem(it_ent, it);
 		FinishSpawningItem(it_ent);
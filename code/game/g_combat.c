@@ -65,7 +65,7 @@ void AddScore(gentity_t *ent, vec3_t origin, int score) {
 		AddTeamScore(origin, ent->client->ps.persistant[PERS_TEAM], score);
 	}
 
-	CalculateRanks();
+	CalculateClientRank(ent->s.number);
 }
 
 /*
@@ -169,7 +169,7 @@ void TossClientCubes(gentity_t *self) {
 	}
 
 	drop = Launch_Item(item, origin, velocity);
-	drop->nextthink = level.time + g_cubeTimeout.integer * 1000;
+	G_SetNextThink(drop, level.time + g_cubeTimeout.integer * 1000);
 	drop->think = G_FreeEntity;
 	drop->s.team = self->client->sess.sessionTeam;
 }
@@ -333,13 +333,13 @@ void Kamikaze_DeathTimer(gentity_t *self) {
 	gentity_t *ent;
 
 	ent = G_Spawn();
-	ent->classname = "kamikaze timer";
+	G_SetClassname(ent, "kamikaze timer");
 
 	VectorCopy(self->s.pos.trBase, ent->s.pos.trBase);
 
 	ent->r.svFlags |= SVF_NOCLIENT;
 	ent->think = Kamikaze_DeathActivate;
-	ent->nextthink = level.time + 5 * 1000;
+	G_SetNextThink(ent, level.time + 5 * 1000);
 	ent->activator = self;
 }
 
@@ -455,7 +455,7 @@ void PlayerDie(gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int d
 	if ((self->client->ps.eFlags & EF_TICKING) && self->activator) {
 		self->client->ps.eFlags &= ~EF_TICKING;
 		self->activator->think = G_FreeEntity;
-		self->activator->nextthink = level.time;
+		G_SetNextThink(self->activator, level.time);
 	}
 
 	self->client->ps.pm_type = PM_DEAD;
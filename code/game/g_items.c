@@ -342,7 +342,7 @@ void RespawnItem(gentity_t *ent) {
 	// play the normal respawn sound only to nearby clients
 	G_AddEvent(ent, EV_ITEM_RESPAWN, 0);
 
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 /*
@@ -463,10 +463,10 @@ void Touch_Item(gentity_t *ent, gentity_t *other, trace_t *trace) {
 	// a negative respawn times means to never respawn this item (but don't delete it)
 	// this is used by items that are respawned by third party events such as ctf flags
 	if (respawn <= 0) {
-		ent->nextthink = 0;
+		G_SetNextThink(ent, 0);
 		ent->think = 0;
 	} else {
-		ent->nextthink = level.time + respawn * 1000;
+		G_SetNextThink(ent, level.time + respawn * 1000);
 		ent->think = RespawnItem;
 	}
 
@@ -487,7 +487,7 @@ gentity_t *Launch_Item(gitem_t *item, vec3_t origin, vec3_t velocity) {
 	dropped->s.eType = ET_ITEM;
 	dropped->s.modelindex = item - bg_itemlist; // store item number in modelindex
 	dropped->s.modelindex2 = 1; // this is non-zero is it's a dropped item
-	dropped->classname = item->classname;
+	G_SetClassname(dropped, item->classname);
 	dropped->item = item;
 
 	VectorSet(dropped->r.mins, -ITEM_RADIUS, -ITEM_RADIUS, -ITEM_RADIUS);
@@ -507,11 +507,11 @@ gentity_t *Launch_Item(gitem_t *item, vec3_t origin, vec3_t velocity) {
 
 	if ((g_gametype.integer == GT_CTF || g_gametype.integer == GT_1FCTF) && item->giType == IT_TEAM) { // special case for CTF flags
 		dropped->think = Team_DroppedFlagThink;
-		dropped->nextthink = level.time + 30000;
+		G_SetNextThink(dropped, level.time + 30000);
 		Team_CheckDroppedItem(dropped);
 	} else { // auto-remove after 30 seconds
 		dropped->think = G_FreeEntity;
-		dropped->nextthink = level.time + 30000;
+		G_SetNextThink(dropped, level.time + 30000);
 	}
 
 	dropped->flags = FL_DROPPED_ITEM;
@@ -610,7 +610,7 @@ void FinishSpawningItem(gentity_t *ent) {
 
 		ent->s.eFlags |= EF_NODRAW;
 		ent->r.contents = 0;
-		ent->nextthink = level.time + respawn * 1000;
+		G_SetNextThink(ent, level.time + respawn * 1000);
 		ent->think = RespawnItem;
 		return;
 	}
@@ -810,7 +810,7 @@ void G_SpawnItem(gentity_t *ent, gitem_t *item) {
 
 	ent->item = item;
 	// some movers spawn on the second frame, so delay item spawns until the third frame so they can ride trains
-	ent->nextthink = level.time + FRAMETIME * 2;
+	G_SetNextThink(ent, level.time + FRAMETIME * 2);
 	ent->think = FinishSpawningItem;
 	ent->physicsBounce = 0.50; // items are bouncy
 
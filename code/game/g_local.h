@@ -59,33 +59,49 @@ typedef enum {
 typedef struct gentity_s gentity_t;
 typedef struct gclient_s gclient_t;
 // scripting
+typedef struct g_script_stack_item_s g_script_stack_item_t;
+
 typedef struct {
 	char *actionString;
 	qboolean (*actionFunc)(gentity_t *ent, char *params);
+	// optional compiled form, used for the items compileFunc accepted
+	void (*compileFunc)(g_script_stack_item_t *item);
+	qboolean (*compiledFunc)(gentity_t *ent, g_script_stack_item_t *item);
 } g_script_stack_action_t;
 
-typedef struct {
+struct g_script_stack_item_s {
 	// set during script parsing
 	g_script_stack_action_t *action; // points to an action to perform
 	char *params;
-} g_script_stack_item_t;
+	// compiled from params during script parsing
+	int numArgs;
+	char **args;			// params split into tokens
+	int *values;			// args converted to integers
+	unsigned int *keys;		// G_HashName of the args
+	int op;					// set by the compileFunc of the action, -1 runs actionFunc with the params instead
+	// filled in when the item runs
+	gentity_t *target;		// entity the action last resolved its name argument to
+	const char *targetName;	// the name pointer the target had at that time, to notice when the entity changed
+};
 
 #define G_MAX_SCRIPT_STACK_ITEMS 64
 
 typedef struct {
-	g_script_stack_item_t items[G_MAX_SCRIPT_STACK_ITEMS];
+	g_script_stack_item_t *items;
 	int numItems;
 } g_script_stack_t;
 
 typedef struct {
 	int eventNum;	// index in scriptEvents[]
 	char *params;	// trigger targetname, etc.
+	unsigned int paramsKey;	// G_HashName of params
+	int paramsValue;		// params converted to an integer
 	g_script_stack_t stack;
 } g_script_event_t;
 
 typedef struct {
 	char *eventStr;
-	qboolean (*eventMatch)(g_script_event_t *event, char *eventParm);
+	qboolean (*eventMatch)(g_script_event_t *event, char *eventParm, unsigned int eventParmKey);
 } g_script_event_define_t;
 // script flags
 #define SCFL_GOING_TO_MARKER	0x00000001
@@ -111,7 +127,7 @@ struct gentity_s {
 	//=================================================================================================================================
 	struct gclient_s *client;				// NULL if not a client
 	qboolean inuse;
-	const char *classname;					// set in QuakeEd
+	const char *classname;					// set in QuakeEd, only set through G_SetClassname
 	int spawnflags;							// set in QuakeEd
 	qboolean neverFree;						// if true, FreeEntity will only unlink, bodyque uses this
 	int flags;								// FL_* variables
@@ -138,14 +154,17 @@ struct gentity_s {
 	char *message;
 	int timestamp;							// body queue sinking, etc.
 	const char *target;
-	const char *targetname;
+	const char *targetname;					// only set through G_SetTargetname
 	const char *team;
 	const char *targetShaderName;
 	const char *targetShaderNewName;
 	gentity_t *target_ent;
 	float speed;
 	vec3_t movedir;
-	int nextthink;
+	int nextthink;							// only set through G_SetNextThink
+	gentity_t *thinkNext;					// think wheel slot links
+	gentity_t *thinkPrev;
+	gentity_t **thinkList;
 	void (*think)(gentity_t *self);
 	void (*reached)(gentity_t *self);		// movers call this when hitting endpoint
 	void (*blocked)(gentity_t *self, gentity_t *other);
@@ -193,7 +212,7 @@ struct gentity_s {
 	char *aiSkin;
 	char *aihSkin;
 	// entity scripting system
-	char *scriptName;
+	char *scriptName;						// only set through G_SetScriptName
 	int numScriptEvents;
 	g_script_event_t *scriptEvents;			// contains a list of actions to perform for each event type
 	g_script_status_t scriptStatus;			// current status of scripting
@@ -402,15 +421,23 @@ void ClearRegisteredItems(void);
 void RegisterItem(gitem_t *item);
 void SaveRegisteredItems(void);
 // g_utils.c
+unsigned int G_HashName(const char *name);
+void G_InitConfigstringCaches(void);
 int G_FindConfigstringIndex(const char *name, int start, int max, qboolean create);
 int G_ModelIndex(const char *name);
 int G_SoundIndex(const char *name);
 void G_TeamCommand(team_t team, const char *cmd);
 void G_KillBox(gentity_t *ent);
+void G_InitEntityNames(void);
+void G_UpdateEntityNames(gentity_t *ent);
+void G_SetClassname(gentity_t *ent, const char *classname);
+void G_SetTargetname(gentity_t *ent, const char *targetname);
+void G_SetScriptName(gentity_t *ent, char *scriptName);
 gentity_t *G_Find(gentity_t *from, int fieldofs, const char *match);
 gentity_t *G_PickTarget(const char *targetname);
 void G_UseTargets(gentity_t *ent, gentity_t *activator);
 void G_SetMovedir(vec3_t angles, vec3_t movedir);
+void G_InitFreeEntities(void);
 void G_InitGentity(gentity_t *e);
 int G_GetEntityEventSoundCoefficient(const gentity_t *ent); // get the distance how far an entity event is audible
 playerState_t *G_GetEntityPlayerState(const gentity_t *ent);
@@ -433,6 +460,14 @@ qboolean IsPlayerEnt(gentity_t *ent);
 qboolean ScriptEventForPlayer(gentity_t *activator, char *eventStr, char *params);
 gentity_t *GetFirstValidPlayer(qboolean checkHealth);
 gentity_t *GetFirstValidBluePlayer(qboolean checkHealth);
+// g_think.c
+void G_InitThinks(int levelTime);
+void G_AdvanceThinks(void);
+void G_SetNextThink(gentity_t *ent, int time);
+void G_ActivateEntity(gentity_t *ent);
+void G_RemoveThinks(gentity_t *ent);
+int G_NextRunnableEntity(int start);
+void G_UpdateEntityActivity(gentity_t *ent);
 // g_combat.c
 qboolean CanDamage(gentity_t *targ, vec3_t origin);
 void G_Damage(gentity_t *targ, gentity_t *inflictor, gentity_t *attacker, vec3_t dir, vec3_t point, int damage, int dflags, int meansOfDeath);
@@ -483,6 +518,7 @@ void ClientSpawn(gentity_t *ent);
 void PlayerDie(gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int damage, int meansOfDeath);
 void AddScore(gentity_t *ent, vec3_t origin, int score);
 void CalculateRanks(void);
+void CalculateClientRank(int clientNum);
 qboolean SpotWouldTelefrag(gentity_t *spot);
 qboolean G_IsClientOnTeam(gentity_t *entity, team_t team);
 // g_script.c
@@ -491,6 +527,8 @@ void G_ScriptPreprocess(char *script);
 void G_Script_ScriptParse(gentity_t *ent);
 qboolean G_Script_ScriptRun(gentity_t *ent);
 void G_Script_ScriptEvent(gentity_t *ent, char *eventStr, char *params);
+void G_Script_ScriptEventNum(gentity_t *ent, int eventNum, char *params, unsigned int paramsKey);
+int G_Script_EventForString(char *string);
 void G_Script_ScriptLoad(void);
 // g_svcmds.c
 qboolean G_ConsoleCommand(void);
@@ -498,12 +536,20 @@ void G_RegisterCommands(void);
 void G_UnregisterCommands(void);
 void G_ProcessIPBans(void);
 qboolean G_FilterPacket(char *from);
+gclient_t *ClientForString(const char *s);
+// g_pmovebench.c
+void G_StopPmoveRecord(int clientNum);
+void G_PmoveRecordBegin(gclient_t *client, pmove_t *pm);
+void G_PmoveRecordEnd(gclient_t *client, pmove_t *pm);
+void Svcmd_PmoveRecord_f(void);
+void Svcmd_PmoveBench_f(void);
 // g_weapon.c
 void FireWeapon(gentity_t *ent);
 void G_StartKamikaze(gentity_t *ent);
 // g_cmds.c
 char *ConcatArgs(int start);
 void DeathmatchScoreboardMessage(gentity_t *ent);
+void G_ResetScoreboardBaseline(int clientNum);
 // g_main.c
 void MoveClientToIntermission(gentity_t *ent);
 void FindIntermissionPoint(void);
@@ -646,6 +692,7 @@ void trap_GetServerinfo(char *buffer, int bufferSize);
 void trap_SetBrushModel(gentity_t *ent, const char *name);
 void trap_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask);
 void trap_TraceEntities(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask);
+void trap_TraceAtTime(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int time);
 int trap_PointContents(const vec3_t point, int passEntityNum);
 qboolean trap_InPVS(const vec3_t p1, const vec3_t p2);
 qboolean trap_InPVSIgnorePortals(const vec3_t p1, const vec3_t p2);
@@ -305,8 +305,8 @@ void G_FindTeams(void) {
 				e2->flags |= FL_TEAMSLAVE;
 				// make sure that targets only point at the master
 				if (e2->targetname) {
-					e->targetname = e2->targetname;
-					e2->targetname = NULL;
+					G_SetTargetname(e, e2->targetname);
+					G_SetTargetname(e2, NULL);
 				}
 			}
 		}
@@ -426,7 +426,7 @@ void G_SpawnScriptCamera(void) {
 	}
 
 	g_camEnt = G_Spawn();
-	g_camEnt->scriptName = "scriptcamera";
+	G_SetScriptName(g_camEnt, "scriptcamera");
 	g_camEnt->s.eType = ET_CAMERA;
 	g_camEnt->s.apos.trType = TR_STATIONARY;
 	g_camEnt->s.apos.trTime = 0;
@@ -472,6 +472,7 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 	G_RegisterCvars();
 	G_ProcessIPBans();
 	G_InitMemory();
+	G_InitConfigstringCaches();
 	// set some level globals
 	memset(&level, 0, sizeof(level));
 
@@ -503,6 +504,7 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 	G_RegisterCommands();
 	// initialize all entities for this game
 	memset(g_entities, 0, MAX_GENTITIES * sizeof(g_entities[0]));
+	G_InitEntityNames();
 
 	level.gentities = g_entities;
 	// initialize all clients for this game
@@ -519,7 +521,7 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 	level.num_entities = MAX_CLIENTS;
 
 	for (i = 0; i < MAX_CLIENTS; i++) {
-		g_entities[i].classname = "clientslot";
+		G_SetClassname(&g_entities[i], "clientslot");
 	}
 	// let the server system know where the entites are
 	trap_LocateGameData(level.gentities, level.num_entities, sizeof(gentity_t), &level.clients[0].ps, sizeof(level.clients[0]));
@@ -550,6 +552,8 @@ static void G_InitGame(int levelTime, int randomSeed, int restart) {
 		G_Printf("WARNING: g_limbotime <= (1000 / sv_fps), forcing to 1000 (one second).\n");
 	}
 
+	G_InitFreeEntities();
+	G_InitThinks(levelTime);
 	G_Script_ScriptLoad();
 	// reserve some spots for dead player bodies
 	InitBodyQue();
@@ -598,6 +602,7 @@ static void G_ShutdownGame(int restart) {
 
 		level.logFile = 0;
 	}
+	G_StopPmoveRecord(-1);
 	// write all the client session data so we can get it back
 	G_WriteSessionData();
 
@@ -865,61 +870,18 @@ static int QDECL SortRanks(const void *a, const void *b) {
 
 /*
 =======================================================================================================================================
-CalculateRanks
+SetClientRanks
 
-Recalculates the score ranks of all players. This will be called on every client connect, begin, disconnect, death, and team change.
+Sets PERS_RANK and the score configstrings from the sorted client list.
 =======================================================================================================================================
 */
-void CalculateRanks(void) {
+static void SetClientRanks(void) {
 	int i;
 	int rank;
 	int score;
 	int newScore;
 	gclient_t *cl;
 
-	level.follow1 = -1;
-	level.follow2 = -1;
-	level.numConnectedClients = 0;
-	level.numNonSpectatorClients = 0;
-	level.numPlayingClients = 0;
-	level.numVotingClients = 0; // don't count bots
-
-	for (i = 0; i < ARRAY_LEN(level.numteamVotingClients); i++) {
-		level.numteamVotingClients[i] = 0;
-	}
-
-	for (i = 0; i < level.maxclients; i++) {
-		if (level.clients[i].pers.connected != CON_DISCONNECTED) {
-			level.sortedClients[level.numConnectedClients] = i;
-			level.numConnectedClients++;
-
-			if (level.clients[i].sess.sessionTeam != TEAM_SPECTATOR) {
-				level.numNonSpectatorClients++;
-				// decide if this should be auto-followed
-				if (level.clients[i].pers.connected == CON_CONNECTED) {
-					level.numPlayingClients++;
-
-					if (!(g_entities[i].r.svFlags & SVF_BOT)) {
-						level.numVotingClients++;
-
-						if (level.clients[i].sess.sessionTeam == TEAM_RED) {
-							level.numteamVotingClients[0]++;
-						} else if (level.clients[i].sess.sessionTeam == TEAM_BLUE) {
-							level.numteamVotingClients[1]++;
-						}
-					}
-
-					if (level.follow1 == -1) {
-						level.follow1 = i;
-					} else if (level.follow2 == -1) {
-						level.follow2 = i;
-					}
-				}
-			}
-		}
-	}
-
-	qsort(level.sortedClients, level.numConnectedClients, sizeof(level.sortedClients[0]), SortRanks);
 	// set the rank value for all clients that are connected and not spectators
 	if (g_gametype.integer > GT_TOURNAMENT) {
 		// in team games, rank is just the order of the teams, 0 = red, 1 = blue, 2 = tied
@@ -983,6 +945,102 @@ void CalculateRanks(void) {
 	}
 }
 
+/*
+=======================================================================================================================================
+CalculateRanks
+
+Recalculates the score ranks of all players. This will be called on every client connect, begin, disconnect, death, and team change.
+=======================================================================================================================================
+*/
+void CalculateRanks(void) {
+	int i;
+
+	level.follow1 = -1;
+	level.follow2 = -1;
+	level.numConnectedClients = 0;
+	level.numNonSpectatorClients = 0;
+	level.numPlayingClients = 0;
+	level.numVotingClients = 0; // don't count bots
+
+	for (i = 0; i < ARRAY_LEN(level.numteamVotingClients); i++) {
+		level.numteamVotingClients[i] = 0;
+	}
+
+	for (i = 0; i < level.maxclients; i++) {
+		if (level.clients[i].pers.connected != CON_DISCONNECTED) {
+			level.sortedClients[level.numConnectedClients] = i;
+			level.numConnectedClients++;
+
+			if (level.clients[i].sess.sessionTeam != TEAM_SPECTATOR) {
+				level.numNonSpectatorClients++;
+				// decide if this should be auto-followed
+				if (level.clients[i].pers.connected == CON_CONNECTED) {
+					level.numPlayingClients++;
+
+					if (!(g_entities[i].r.svFlags & SVF_BOT)) {
+						level.numVotingClients++;
+
+						if (level.clients[i].sess.sessionTeam == TEAM_RED) {
+							level.numteamVotingClients[0]++;
+						} else if (level.clients[i].sess.sessionTeam == TEAM_BLUE) {
+							level.numteamVotingClients[1]++;
+						}
+					}
+
+					if (level.follow1 == -1) {
+						level.follow1 = i;
+					} else if (level.follow2 == -1) {
+						level.follow2 = i;
+					}
+				}
+			}
+		}
+	}
+
+	qsort(level.sortedClients, level.numConnectedClients, sizeof(level.sortedClients[0]), SortRanks);
+
+	SetClientRanks();
+}
+
+/*
+=======================================================================================================================================
+CalculateClientRank
+
+Called when only the score of a single client changed. The rest of sortedClients is still in order, so the client is just moved up or
+down to its new place instead of sorting everyone again.
+=======================================================================================================================================
+*/
+void CalculateClientRank(int clientNum) {
+	int i, temp;
+
+	for (i = 0; i < level.numConnectedClients; i++) {
+		if (level.sortedClients[i] == clientNum) {
+			break;
+		}
+	}
+	// not in the list, the client set itself changed
+	if (i == level.numConnectedClients) {
+		CalculateRanks();
+		return;
+	}
+
+	while (i > 0 && SortRanks(&level.sortedClients[i - 1], &level.sortedClients[i]) > 0) {
+		temp = level.sortedClients[i - 1];
+		level.sortedClients[i - 1] = level.sortedClients[i];
+		level.sortedClients[i] = temp;
+		i--;
+	}
+
+	while (i < level.numConnectedClients - 1 && SortRanks(&level.sortedClients[i], &level.sortedClients[i + 1]) > 0) {
+		temp = level.sortedClients[i + 1];
+		level.sortedClients[i + 1] = level.sortedClients[i];
+		level.sortedClients[i] = temp;
+		i++;
+	}
+
+	SetClientRanks();
+}
+
 /*
 =======================================================================================================================================
 
@@ -1093,6 +1151,10 @@ void BeginIntermission(void) {
 		trap_Cvar_SetValue("ui_singlePlayerActive", 0);
 		UpdateTournamentInfo();
 	}
+	// the intermission scoreboard must not depend on a delta the cgame may not be able to apply
+	for (i = 0; i < level.maxclients; i++) {
+		G_ResetScoreboardBaseline(i);
+	}
 	// send the current scoring to all clients
 	SendScoreboardMessageToAllClients();
 }
@@ -1840,7 +1902,7 @@ void G_RunThink(gentity_t *ent) {
 		return;
 	}
 
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 
 	if (!ent->think) {
 		G_Error("NULL ent->think");
@@ -1849,6 +1911,71 @@ void G_RunThink(gentity_t *ent) {
 	ent->think(ent);
 }
 
+/*
+=======================================================================================================================================
+G_RunEntity
+=======================================================================================================================================
+*/
+static void G_RunEntity(gentity_t *ent) {
+
+	if (!ent->inuse) {
+		return;
+	}
+	// clear events that are too old
+	if (level.time - ent->eventTime > EVENT_VALID_MSEC) {
+		if (ent->s.event) {
+			ent->s.event = 0; // &= EV_EVENT_BITS;
+
+			if (ent->client) {
+				ent->client->ps.externalEvent = 0;
+				// predicted events should never be set to zero
+				//ent->client->ps.events[0] = 0;
+				//ent->client->ps.events[1] = 0;
+			}
+		}
+
+		if (ent->freeAfterEvent) {
+			// tempEntities or dropped items completely go away after their event
+			G_FreeEntity(ent);
+			return;
+		} else if (ent->unlinkAfterEvent) {
+			// items that will respawn will hide themselves after their pickup event
+			ent->unlinkAfterEvent = qfalse;
+			trap_UnlinkEntity(ent);
+		}
+	}
+	// temporary entities don't think
+	if (ent->freeAfterEvent) {
+		return;
+	}
+
+	if (!ent->r.linked && ent->neverFree) {
+		return;
+	}
+
+	if (ent->s.eType == ET_MISSILE) {
+		G_RunMissile(ent);
+		return;
+	}
+
+	if (ent->s.eType == ET_ITEM || ent->physicsObject) {
+		G_RunItem(ent);
+		return;
+	}
+
+	if (ent->s.eType == ET_MOVER) {
+		G_RunMover(ent);
+		return;
+	}
+
+	if (ent - g_entities < MAX_CLIENTS) {
+		G_RunClient(ent);
+		return;
+	}
+
+	G_RunThink(ent);
+}
+
 /*
 =======================================================================================================================================
 G_RunFrame
@@ -1870,66 +1997,14 @@ static void G_RunFrame(int levelTime) {
 	level.time = levelTime;
 	// get any cvar changes
 	G_UpdateCvars();
-	// go through all allocated objects
-	ent = &g_entities[0];
-
-	for (i = 0; i < level.num_entities; i++, ent++) {
-		if (!ent->inuse) {
-			continue;
-		}
-		// clear events that are too old
-		if (level.time - ent->eventTime > EVENT_VALID_MSEC) {
-			if (ent->s.event) {
-				ent->s.event = 0; // &= EV_EVENT_BITS;
-
-				if (ent->client) {
-					ent->client->ps.externalEvent = 0;
-					// predicted events should never be set to zero
-					//ent->client->ps.events[0] = 0;
-					//ent->client->ps.events[1] = 0;
-				}
-			}
-
-			if (ent->freeAfterEvent) {
-				// tempEntities or dropped items completely go away after their event
-				G_FreeEntity(ent);
-				continue;
-			} else if (ent->unlinkAfterEvent) {
-				// items that will respawn will hide themselves after their pickup event
-				ent->unlinkAfterEvent = qfalse;
-				trap_UnlinkEntity(ent);
-			}
-		}
-		// temporary entities don't think
-		if (ent->freeAfterEvent) {
-			continue;
-		}
-
-		if (!ent->r.linked && ent->neverFree) {
-			continue;
-		}
+	// go through all allocated objects that are active or have a think due, in entity number order
+	G_AdvanceThinks();
 
-		if (ent->s.eType == ET_MISSILE) {
-			G_RunMissile(ent);
-			continue;
-		}
-
-		if (ent->s.eType == ET_ITEM || ent->physicsObject) {
-			G_RunItem(ent);
-			continue;
-		}
-
-		if (ent->s.eType == ET_MOVER) {
-			G_RunMover(ent);
-			continue;
-		}
-
-		if (i < MAX_CLIENTS) {
-			G_RunClient(ent);
-			continue;
-		}
+	for (i = G_NextRunnableEntity(0); i < level.num_entities; i = G_NextRunnableEntity(i + 1)) {
+		ent = &g_entities[i];
 
-		G_RunThink(ent);
+		G_RunEntity(ent);
+		G_UpdateEntityActivity(ent);
 	}
 	// perform final fixups on the players
 	ent = &g_entities[0];
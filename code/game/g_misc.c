@@ -235,7 +235,7 @@ void SP_misc_vis_dummy(gentity_t *ent) {
 	trap_LinkEntity(ent);
 
 	ent->think = LocateMaster;
-	ent->nextthink = level.time + 1000;
+	G_SetNextThink(ent, level.time + 1000);
 }
 
 /*QUAKED misc_vis_dummy_multiple (1 .5 0) (-8 -8 -8) (8 8 8)
@@ -331,7 +331,7 @@ void SP_misc_portal_surface(gentity_t *ent) {
 		VectorCopy(ent->s.origin, ent->s.origin2);
 	} else {
 		ent->think = LocateCamera;
-		ent->nextthink = level.time + 100;
+		G_SetNextThink(ent, level.time + 100);
 	}
 }
 
@@ -412,7 +412,7 @@ static void InitShooter_Finish(gentity_t *ent) {
 
 	ent->enemy = G_PickTarget(ent->target);
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 /*
@@ -436,7 +436,7 @@ void InitShooter(gentity_t *ent, int weapon) {
 	// target might be a moving object, so we can't set movedir for it
 	if (ent->target) {
 		ent->think = InitShooter_Finish;
-		ent->nextthink = level.time + 500;
+		G_SetNextThink(ent, level.time + 500);
 	}
 
 	trap_LinkEntity(ent);
@@ -601,7 +601,7 @@ void shutoff_dlight(gentity_t *ent) {
 	trap_UnlinkEntity(ent);
 
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 /*
@@ -618,7 +618,7 @@ void use_dlight(gentity_t *ent, gentity_t *other, gentity_t *activator) {
 
 		if (ent->spawnflags & 4) { // ONETIME
 			ent->think = shutoff_dlight;
-			ent->nextthink = level.time + (strlen(ent->dl_stylestring) * 100) - 100;
+			G_SetNextThink(ent, level.time + (strlen(ent->dl_stylestring) * 100) - 100);
 		}
 	}
 }
@@ -668,7 +668,7 @@ void SP_dlight(gentity_t *ent) {
 		dlightstarttime = level.time + 100;
 	}
 
-	ent->nextthink = dlightstarttime;
+	G_SetNextThink(ent, dlightstarttime);
 	// if it's black or has no color assigned, make it white
 	if (ent->dl_color[0] <= 0 && ent->dl_color[1] <= 0 && ent->dl_color[2] <= 0) {
 		ent->dl_color[0] = ent->dl_color[1] = ent->dl_color[2] = 1.0f;
@@ -128,7 +128,7 @@ ProximityMine_Die
 static void ProximityMine_Die(gentity_t *ent, gentity_t *inflictor, gentity_t *attacker, int damage, int mod) {
 
 	ent->think = ProximityMine_Explode;
-	ent->nextthink = level.time + 1;
+	G_SetNextThink(ent, level.time + 1);
 }
 
 /*
@@ -166,7 +166,7 @@ void ProximityMine_Trigger(gentity_t *trigger, gentity_t *other, trace_t *trace)
 
 	G_AddEvent(mine, EV_PROXIMITY_MINE_TRIGGER, 0);
 
-	mine->nextthink = level.time + 500;
+	G_SetNextThink(mine, level.time + 500);
 
 	G_FreeEntity(trigger);
 }
@@ -181,14 +181,14 @@ static void ProximityMine_Activate(gentity_t *ent) {
 	float r;
 
 	ent->think = ProximityMine_Explode;
-	ent->nextthink = level.time + g_proxMineTimeout.integer;
+	G_SetNextThink(ent, level.time + g_proxMineTimeout.integer);
 	ent->takedamage = qtrue;
 	ent->health = 1;
 	ent->die = ProximityMine_Die;
 	ent->s.loopSound = G_SoundIndex("sound/weapons/proxmine/wstbtick.wav");
 	// build the proximity trigger
 	trigger = G_Spawn();
-	trigger->classname = "proxmine_trigger";
+	G_SetClassname(trigger, "proxmine_trigger");
 	r = ent->splashRadius;
 
 	VectorSet(trigger->r.mins, -r, -r, -r);
@@ -240,7 +240,7 @@ static void ProximityMine_Player(gentity_t *mine, gentity_t *player) {
 		player->activator->splashDamage += mine->splashDamage;
 		player->activator->splashRadius *= 1.50;
 		mine->think = G_FreeEntity;
-		mine->nextthink = level.time;
+		G_SetNextThink(mine, level.time);
 		return;
 	}
 
@@ -255,7 +255,7 @@ static void ProximityMine_Player(gentity_t *mine, gentity_t *player) {
 
 	mine->enemy = player;
 	mine->think = ProximityMine_ExplodeOnPlayer;
-	mine->nextthink = level.time + 10 * 1000;
+	G_SetNextThink(mine, level.time + 10 * 1000);
 }
 
 /*
@@ -315,7 +315,7 @@ void G_MissileImpact(gentity_t *ent, trace_t *trace) {
 		G_AddEvent(ent, EV_PROXIMITY_MINE_STICK, trace->surfaceFlags);
 
 		ent->think = ProximityMine_Activate;
-		ent->nextthink = level.time + 2000;
+		G_SetNextThink(ent, level.time + 2000);
 
 		VectorToAngles(trace->plane.normal, ent->s.angles);
 
@@ -429,8 +429,8 @@ gentity_t *fire_nail(gentity_t *self, vec3_t start, vec3_t forward, vec3_t right
 	float r, u, scale;
 
 	bolt = G_Spawn();
-	bolt->classname = "nail";
-	bolt->nextthink = level.time + 10000;
+	G_SetClassname(bolt, "nail");
+	G_SetNextThink(bolt, level.time + 10000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_NAILGUN;
@@ -482,8 +482,8 @@ gentity_t *fire_prox(gentity_t *self, vec3_t start, vec3_t dir) {
 	VectorNormalize(dir);
 
 	bolt = G_Spawn();
-	bolt->classname = "prox mine";
-	bolt->nextthink = level.time + 3000;
+	G_SetClassname(bolt, "prox mine");
+	G_SetNextThink(bolt, level.time + 3000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_PROXLAUNCHER;
@@ -526,8 +526,8 @@ gentity_t *fire_grenade(gentity_t *self, vec3_t start, vec3_t dir) {
 	VectorNormalize(dir);
 
 	bolt = G_Spawn();
-	bolt->classname = "grenade";
-	bolt->nextthink = level.time + 2500;
+	G_SetClassname(bolt, "grenade");
+	G_SetNextThink(bolt, level.time + 2500);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_GRENADELAUNCHER;
@@ -570,8 +570,8 @@ gentity_t *fire_napalm(gentity_t *self, vec3_t start, vec3_t dir) {
 	VectorNormalize(dir);
 
 	bolt = G_Spawn();
-	bolt->classname = "napalm";
-	bolt->nextthink = level.time + 15000;
+	G_SetClassname(bolt, "napalm");
+	G_SetNextThink(bolt, level.time + 15000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_NAPALMLAUNCHER;
@@ -613,8 +613,8 @@ gentity_t *fire_rocket(gentity_t *self, vec3_t start, vec3_t dir) {
 	VectorNormalize(dir);
 
 	bolt = G_Spawn();
-	bolt->classname = "rocket";
-	bolt->nextthink = level.time + 15000;
+	G_SetClassname(bolt, "rocket");
+	G_SetNextThink(bolt, level.time + 15000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_ROCKETLAUNCHER;
@@ -656,8 +656,8 @@ gentity_t *fire_plasma(gentity_t *self, vec3_t start, vec3_t dir) {
 	VectorNormalize(dir);
 
 	bolt = G_Spawn();
-	bolt->classname = "plasma";
-	bolt->nextthink = level.time + 10000;
+	G_SetClassname(bolt, "plasma");
+	G_SetNextThink(bolt, level.time + 10000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_PLASMAGUN;
@@ -699,8 +699,8 @@ gentity_t *fire_bfg(gentity_t *self, vec3_t start, vec3_t dir) {
 	VectorNormalize(dir);
 
 	bolt = G_Spawn();
-	bolt->classname = "bfg";
-	bolt->nextthink = level.time + 10000;
+	G_SetClassname(bolt, "bfg");
+	G_SetNextThink(bolt, level.time + 10000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->s.weapon = WP_BFG;
@@ -594,7 +594,7 @@ void Reached_BinaryMover(gentity_t *ent) {
 		}
 		// return to pos1 after a delay
 		ent->think = ReturnToPos1;
-		ent->nextthink = level.time + ent->wait;
+		G_SetNextThink(ent, level.time + ent->wait);
 		// fire targets
 		if (!ent->activator) {
 			ent->activator = ent;
@@ -652,7 +652,7 @@ void Use_BinaryMover(gentity_t *ent, gentity_t *other, gentity_t *activator) {
 	}
 	// if all the way up, just delay before coming down
 	if (ent->moverState == MOVER_POS2) {
-		ent->nextthink = level.time + ent->wait;
+		G_SetNextThink(ent, level.time + ent->wait);
 		return;
 	}
 	// only partway down before reversing
@@ -905,7 +905,7 @@ void Think_SpawnNewDoorTrigger(gentity_t *ent) {
 	mins[best] -= 120;
 	// create a trigger with this size
 	other = G_Spawn();
-	other->classname = "door_trigger";
+	G_SetClassname(other, "door_trigger");
 
 	VectorCopy(mins, other->r.mins);
 	VectorCopy(maxs, other->r.maxs);
@@ -994,7 +994,7 @@ void SP_func_door(gentity_t *ent) {
 
 	InitMover(ent);
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(ent, level.time + FRAMETIME);
 
 	if (!(ent->flags & FL_TEAMSLAVE)) {
 		int health;
@@ -1036,7 +1036,7 @@ void Touch_Plat(gentity_t *ent, gentity_t *other, trace_t *trace) {
 	}
 	// delay return-to-pos1 by one second
 	if (ent->moverState == MOVER_POS2) {
-		ent->nextthink = level.time + 1000;
+		G_SetNextThink(ent, level.time + 1000);
 	}
 }
 
@@ -1072,7 +1072,7 @@ void SpawnPlatTrigger(gentity_t *ent) {
 
 	// the middle trigger will be a thin trigger just above the starting position
 	trigger = G_Spawn();
-	trigger->classname = "plat_trigger";
+	G_SetClassname(trigger, "plat_trigger");
 	trigger->touch = Touch_PlatCenterTrigger;
 	trigger->r.contents = CONTENTS_TRIGGER;
 	trigger->parent = ent;
@@ -1317,7 +1317,7 @@ void Reached_Train(gentity_t *ent) {
 	SetMoverState(ent, MOVER_1TO2, level.time);
 	// if there is a "wait" value on the target, don't start moving yet
 	if (next->wait) {
-		ent->nextthink = level.time + next->wait * 1000;
+		G_SetNextThink(ent, level.time + next->wait * 1000);
 		ent->think = Think_BeginMoving;
 		ent->s.pos.trType = TR_STATIONARY;
 	}
@@ -1424,7 +1424,7 @@ void SP_func_train(gentity_t *self) {
 
 	self->reached = Reached_Train;
 	// start trains on the second frame, to make sure their targets have had a chance to spawn
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 	self->think = Think_SetupTrainTargets;
 }
 
@@ -0,0 +1,340 @@
+/*
+=======================================================================================================================================
+Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+
+This file is part of Spearmint Source Code.
+
+Spearmint Source Code is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License, or (at your option) any later version.
+
+Spearmint Source Code is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Spearmint Source Code.
+If not, see <http://www.gnu.org/licenses/>.
+
+In addition, Spearmint Source Code is also subject to certain additional terms. You should have received a copy of these additional
+terms immediately following the terms and conditions of the GNU General Public License. If not, please request a copy in writing from
+id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o
+ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+=======================================================================================================================================
+*/
+
+#include "g_local.h"
+
+/*
+=======================================================================================================================================
+
+	PMOVE BENCHMARK
+
+	pmoverecord captures every Pmove of one client together with the playerstate it started from and a hash of the playerstate it
+	produced. pmovebench replays such a recording through Pmove on the currently loaded map, reports the time spent per command and
+	checks every result against the recorded hash, so physics changes can be validated for speed and bit-exact prediction at once.
+	Run it on the map it was recorded on and without other players or moving entities in the way, traces still see entities.
+
+=======================================================================================================================================
+*/
+
+#define PMOVE_RECORD_IDENT (('V' << 24) + ('O' << 16) + ('M' << 8) + 'P') // little-endian "PMOV"
+#define PMOVE_RECORD_VERSION 1
+#define PMOVE_BENCH_BATCH 256
+
+typedef struct {
+	int ident;
+	int version;
+	char mapname[MAX_QPATH];
+} pmoveRecordHeader_t;
+
+typedef struct {
+	playerState_t ps;		// state before the move
+	usercmd_t cmd;
+	int tracemask;
+	int gauntletHit;
+	int pmove_fixed;
+	int pmove_msec;
+	unsigned int hash;		// hash of the state after the move
+} pmoveRecord_t;
+
+static fileHandle_t pmoveRecordFile;
+static int pmoveRecordClient = -1;
+static int pmoveRecordCount;
+static pmoveRecord_t pmoveRecord;
+static pmoveRecord_t pmoveBenchRecords[PMOVE_BENCH_BATCH];
+static playerState_t pmoveBenchResults[PMOVE_BENCH_BATCH];
+
+/*
+=======================================================================================================================================
+G_PlayerStateHash
+=======================================================================================================================================
+*/
+static unsigned int G_PlayerStateHash(const playerState_t *ps) {
+	const byte *data;
+	unsigned int hash;
+	int i;
+
+	data = (const byte *)ps;
+	hash = 2166136261u;
+
+	for (i = 0; i < (int)sizeof(*ps); i++) {
+		hash = (hash ^ data[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+=======================================================================================================================================
+G_StopPmoveRecord
+
+Stops recording the given client, or any client when clientNum is -1.
+=======================================================================================================================================
+*/
+void G_StopPmoveRecord(int clientNum) {
+
+	if (pmoveRecordClient < 0 || (clientNum >= 0 && clientNum != pmoveRecordClient)) {
+		return;
+	}
+
+	trap_FS_FCloseFile(pmoveRecordFile);
+	G_Printf("Recorded %i pmove commands.\n", pmoveRecordCount);
+
+	pmoveRecordFile = 0;
+	pmoveRecordClient = -1;
+}
+
+/*
+=======================================================================================================================================
+G_PmoveRecordBegin
+
+Called right before the client's Pmove.
+=======================================================================================================================================
+*/
+void G_PmoveRecordBegin(gclient_t *client, pmove_t *pm) {
+
+	if (client - level.clients != pmoveRecordClient) {
+		return;
+	}
+
+	pmoveRecord.ps = *pm->ps;
+	pmoveRecord.cmd = pm->cmd;
+	pmoveRecord.tracemask = pm->tracemask;
+	pmoveRecord.gauntletHit = pm->gauntletHit;
+	pmoveRecord.pmove_fixed = pm->pmove_fixed;
+	pmoveRecord.pmove_msec = pm->pmove_msec;
+}
+
+/*
+=======================================================================================================================================
+G_PmoveRecordEnd
+
+Called right after the client's Pmove.
+=======================================================================================================================================
+*/
+void G_PmoveRecordEnd(gclient_t *client, pmove_t *pm) {
+
+	if (client - level.clients != pmoveRecordClient) {
+		return;
+	}
+
+	pmoveRecord.hash = G_PlayerStateHash(pm->ps);
+
+	trap_FS_Write(&pmoveRecord, sizeof(pmoveRecord), pmoveRecordFile);
+	pmoveRecordCount++;
+}
+
+/*
+=======================================================================================================================================
+Svcmd_PmoveRecord_f
+
+pmoverecord <player> <file>
+pmoverecord stop
+=======================================================================================================================================
+*/
+void Svcmd_PmoveRecord_f(void) {
+	pmoveRecordHeader_t header;
+	gclient_t *cl;
+	char str[MAX_TOKEN_CHARS];
+	char filename[MAX_QPATH];
+
+	if (trap_Argc() == 2) {
+		trap_Argv(1, str, sizeof(str));
+
+		if (!Q_stricmp(str, "stop")) {
+			G_StopPmoveRecord(-1);
+			return;
+		}
+	}
+
+	if (trap_Argc() != 3) {
+		G_Printf("Usage: pmoverecord <player> <file>\n       pmoverecord stop\n");
+		return;
+	}
+
+	trap_Argv(1, str, sizeof(str));
+	cl = ClientForString(str);
+
+	if (!cl) {
+		return;
+	}
+
+	G_StopPmoveRecord(-1);
+
+	trap_Argv(2, filename, sizeof(filename));
+	COM_DefaultExtension(filename, sizeof(filename), ".pmove");
+
+	if (trap_FS_FOpenFile(filename, &pmoveRecordFile, FS_WRITE) < 0 || !pmoveRecordFile) {
+		G_Printf("Couldn't open %s for writing.\n", filename);
+		return;
+	}
+
+	memset(&header, 0, sizeof(header));
+
+	header.ident = PMOVE_RECORD_IDENT;
+	header.version = PMOVE_RECORD_VERSION;
+
+	trap_Cvar_VariableStringBuffer("mapname", header.mapname, sizeof(header.mapname));
+	trap_FS_Write(&header, sizeof(header), pmoveRecordFile);
+
+	pmoveRecordClient = cl - level.clients;
+	pmoveRecordCount = 0;
+
+	G_Printf("Recording pmove commands of %s to %s.\n", cl->pers.netname, filename);
+}
+
+/*
+=======================================================================================================================================
+Svcmd_PmoveBench_f
+
+pmovebench <file> [iterations]
+
+Every batch of commands is replayed the given number of times. The timing covers Pmove and setting up its input, the results of the last
+pass are hashed and checked after the timed loop.
+=======================================================================================================================================
+*/
+void Svcmd_PmoveBench_f(void) {
+	pmoveRecordHeader_t header;
+	pmoveRecord_t *record;
+	pmove_t pm;
+	fileHandle_t f;
+	char str[MAX_TOKEN_CHARS];
+	char filename[MAX_QPATH];
+	char mapname[MAX_QPATH];
+	int length, iterations, numRecords, batch, i, j, start, msec;
+	int commands, mismatches;
+	unsigned int hash, stateHash;
+
+	if (trap_Argc() < 2) {
+		G_Printf("Usage: pmovebench <file> [iterations]\n");
+		return;
+	}
+
+	trap_Argv(1, filename, sizeof(filename));
+	COM_DefaultExtension(filename, sizeof(filename), ".pmove");
+
+	iterations = 1;
+
+	if (trap_Argc() > 2) {
+		trap_Argv(2, str, sizeof(str));
+		iterations = atoi(str);
+
+		if (iterations < 1) {
+			iterations = 1;
+		}
+	}
+
+	length = trap_FS_FOpenFile(filename, &f, FS_READ);
+
+	if (length < 0) {
+		G_Printf("Couldn't open %s.\n", filename);
+		return;
+	}
+
+	if (length < (int)sizeof(header)) {
+		G_Printf("%s is not a pmove recording.\n", filename);
+		trap_FS_FCloseFile(f);
+		return;
+	}
+
+	trap_FS_Read(&header, sizeof(header), f);
+
+	if (header.ident != PMOVE_RECORD_IDENT || header.version != PMOVE_RECORD_VERSION) {
+		G_Printf("%s is not a version %i pmove recording.\n", filename, PMOVE_RECORD_VERSION);
+		trap_FS_FCloseFile(f);
+		return;
+	}
+
+	header.mapname[sizeof(header.mapname) - 1] = '\0';
+	trap_Cvar_VariableStringBuffer("mapname", mapname, sizeof(mapname));
+
+	if (Q_stricmp(header.mapname, mapname)) {
+		G_Printf(S_COLOR_YELLOW "WARNING: %s was recorded on %s, not %s.\n", filename, header.mapname, mapname);
+	}
+
+	numRecords = (length - (int)sizeof(header)) / (int)sizeof(pmoveRecord_t);
+	commands = 0;
+	mismatches = 0;
+	msec = 0;
+	hash = 2166136261u;
+	stateHash = 0;
+
+	while (commands < numRecords) {
+		batch = numRecords - commands;
+
+		if (batch > PMOVE_BENCH_BATCH) {
+			batch = PMOVE_BENCH_BATCH;
+		}
+
+		trap_FS_Read(pmoveBenchRecords, batch * sizeof(pmoveRecord_t), f);
+
+		start = trap_Milliseconds();
+
+		for (i = 0; i < iterations; i++) {
+			for (j = 0, record = pmoveBenchRecords; j < batch; j++, record++) {
+				pmoveBenchResults[j] = record->ps;
+
+				memset(&pm, 0, sizeof(pm));
+
+				pm.ps = &pmoveBenchResults[j];
+				pm.cmd = record->cmd;
+				pm.tracemask = record->tracemask;
+				pm.gauntletHit = record->gauntletHit;
+				pm.pmove_fixed = record->pmove_fixed;
+				pm.pmove_msec = record->pmove_msec;
+				pm.trace = trap_Trace;
+				pm.pointcontents = trap_PointContents;
+
+				Pmove(&pm);
+			}
+		}
+
+		msec += trap_Milliseconds() - start;
+		// every pass starts from the recorded state, so the last one has to match the recording too
+		for (j = 0, record = pmoveBenchRecords; j < batch; j++, record++) {
+			stateHash = G_PlayerStateHash(&pmoveBenchResults[j]);
+
+			if (stateHash != record->hash) {
+				if (!mismatches) {
+					G_Printf("First mismatch at command %i (commandTime %i).\n", commands + j, record->ps.commandTime);
+				}
+
+				mismatches++;
+			}
+
+			hash = (hash ^ stateHash) * 16777619u;
+		}
+
+		commands += batch;
+	}
+
+	trap_FS_FCloseFile(f);
+
+	if (!numRecords) {
+		G_Printf("%s has no commands.\n", filename);
+		return;
+	}
+
+	G_Printf("%i commands x %i iterations in %i msec, %.0f ns per command\n", numRecords, iterations, msec, msec * 1000000.0f / ((float)numRecords * iterations));
+	G_Printf("playerstate hash %08x, %i of %i commands differ from the recording\n", hash, mismatches, numRecords);
+}
@@ -177,6 +177,8 @@ typedef enum {
 	G_BOT_ALLOCATE_CLIENT,		// (void);
 	G_BOT_FREE_CLIENT,			// (int clientNum);
 	// access for bots to get and free a server client (FIXME?)
+	G_TRACE_AT_TIME,			// (trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int time);
+	// collision detection with the clients where they were at the given level time, for lag compensation
 	BOTLIB_SETUP = 200,			// (void);
 	BOTLIB_SHUTDOWN,			// (void);
 	BOTLIB_LIBVAR_SET,
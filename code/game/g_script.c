@@ -77,16 +77,23 @@ qboolean G_ScriptAction_MusicFade(gentity_t *ent, char *params);
 qboolean G_ScriptAction_MusicQueue(gentity_t *ent, char *params);
 qboolean G_ScriptAction_ObjectivesNeeded(gentity_t *ent, char *params);
 qboolean G_ScriptAction_NumSecrets(gentity_t *ent, char *params);
+// compiled forms of the actions that run most often
+void G_ScriptCompile_Wait(g_script_stack_item_t *item);
+qboolean G_ScriptAction_WaitCompiled(gentity_t *ent, g_script_stack_item_t *item);
+void G_ScriptCompile_Trigger(g_script_stack_item_t *item);
+qboolean G_ScriptAction_TriggerCompiled(gentity_t *ent, g_script_stack_item_t *item);
+void G_ScriptCompile_Accum(g_script_stack_item_t *item);
+qboolean G_ScriptAction_AccumCompiled(gentity_t *ent, g_script_stack_item_t *item);
 // these are the actions that each event can call
 g_script_stack_action_t gScriptActions[] = {
 	{"gotomarker", G_ScriptAction_GotoMarker},
 	{"playsound", G_ScriptAction_PlaySound},
 	{"playanim", G_ScriptAction_PlayAnim},
-	{"wait", G_ScriptAction_Wait},
-	{"trigger", G_ScriptAction_Trigger},
+	{"wait", G_ScriptAction_Wait, G_ScriptCompile_Wait, G_ScriptAction_WaitCompiled},
+	{"trigger", G_ScriptAction_Trigger, G_ScriptCompile_Trigger, G_ScriptAction_TriggerCompiled},
 	{"alertentity", G_ScriptAction_AlertEntity},
 	{"removeentity", G_ScriptAction_RemoveEntity},
-	{"accum", G_ScriptAction_Accum},
+	{"accum", G_ScriptAction_Accum, G_ScriptCompile_Accum, G_ScriptAction_AccumCompiled},
 	{"missionfailed", G_ScriptAction_MissionFailed},
 	{"missionsuccess", G_ScriptAction_MissionSuccess},
 	{"print", G_ScriptAction_Print},
@@ -129,8 +136,8 @@ g_script_stack_action_t gScriptActions[] = {
 	{NULL, 0}
 };
 
-qboolean G_Script_EventMatch_StringEqual(g_script_event_t *event, char *eventParm);
-qboolean G_Script_EventMatch_IntInRange(g_script_event_t *event, char *eventParm);
+qboolean G_Script_EventMatch_StringEqual(g_script_event_t *event, char *eventParm, unsigned int eventParmKey);
+qboolean G_Script_EventMatch_IntInRange(g_script_event_t *event, char *eventParm, unsigned int eventParmKey);
 
 // the list of events that can start an action sequence
 g_script_event_define_t gScriptEvents[] = {
@@ -148,9 +155,9 @@ g_script_event_define_t gScriptEvents[] = {
 G_Script_EventMatch_StringEqual
 =======================================================================================================================================
 */
-qboolean G_Script_EventMatch_StringEqual(g_script_event_t *event, char *eventParm) {
+qboolean G_Script_EventMatch_StringEqual(g_script_event_t *event, char *eventParm, unsigned int eventParmKey) {
 
-	if (eventParm && !Q_strcasecmp(event->params, eventParm)) {
+	if (eventParm && event->paramsKey == eventParmKey && !Q_strcasecmp(event->params, eventParm)) {
 		return qtrue;
 	} else {
 		return qfalse;
@@ -162,7 +169,7 @@ qboolean G_Script_EventMatch_StringEqual(g_script_event_t *event, char *eventPar
 G_Script_EventMatch_IntInRange
 =======================================================================================================================================
 */
-qboolean G_Script_EventMatch_IntInRange(g_script_event_t *event, char *eventParm) {
+qboolean G_Script_EventMatch_IntInRange(g_script_event_t *event, char *eventParm, unsigned int eventParmKey) {
 	char *pString, *token;
 	int int1, int2, eInt;
 
@@ -172,7 +179,7 @@ qboolean G_Script_EventMatch_IntInRange(g_script_event_t *event, char *eventParm
 	int1 = atoi(token);
 	token = COM_ParseExt(&pString, qfalse);
 	int2 = atoi(token);
-	eInt = atoi(event->params);
+	eInt = event->paramsValue;
 
 	if (eventParm && eInt > int1 && eInt <= int2) {
 		return qtrue;
@@ -260,6 +267,52 @@ void G_Script_ScriptLoad(void) {
 
 #define MAX_SCRIPT_EVENTS 64
 g_script_event_t g_temp_events[MAX_SCRIPT_EVENTS];
+g_script_stack_item_t g_temp_items[G_MAX_SCRIPT_STACK_ITEMS];
+/*
+=======================================================================================================================================
+G_Script_CompileItem
+
+Splits the params of the action into arguments and converts them, so the compiled form of the action doesn't have to parse anything
+when it runs.
+=======================================================================================================================================
+*/
+static void G_Script_CompileItem(g_script_stack_item_t *item) {
+	char *pString, *token;
+	int i;
+
+	item->op = -1;
+
+	if (item->params) {
+		pString = item->params;
+
+		while (COM_ParseExt(&pString, qfalse)[0]) {
+			item->numArgs++;
+		}
+	}
+
+	if (item->numArgs) {
+		item->args = G_Alloc(item->numArgs * sizeof(item->args[0]));
+		item->values = G_Alloc(item->numArgs * sizeof(item->values[0]));
+		item->keys = G_Alloc(item->numArgs * sizeof(item->keys[0]));
+
+		pString = item->params;
+
+		for (i = 0; i < item->numArgs; i++) {
+			token = COM_ParseExt(&pString, qfalse);
+
+			item->args[i] = G_Alloc(strlen(token) + 1);
+			strcpy(item->args[i], token);
+
+			item->values[i] = atoi(token);
+			item->keys[i] = G_HashName(token);
+		}
+	}
+
+	if (item->action->compileFunc) {
+		item->action->compileFunc(item);
+	}
+}
+
 /*
 =======================================================================================================================================
 G_Script_ScriptParse
@@ -280,6 +333,7 @@ void G_Script_ScriptParse(gentity_t *ent) {
 	int i;
 	int bracketLevel;
 	qboolean buildScript;
+	g_script_stack_item_t *item;
 
 	if (!ent->scriptName) {
 		return;
@@ -370,7 +424,12 @@ void G_Script_ScriptParse(gentity_t *ent) {
 			if (strlen(params)) { // copy the params into the event
 				curEvent->params = G_Alloc(strlen(params) + 1);
 				Q_strncpyz(curEvent->params, params, strlen(params) + 1);
+
+				curEvent->paramsKey = G_HashName(curEvent->params);
+				curEvent->paramsValue = atoi(curEvent->params);
 			}
+
+			memset(g_temp_items, 0, sizeof(g_temp_items));
 			// parse the actions for this event
 			while ((token = COM_Parse(&pScript)) && (token[0] != '}')) {
 				if (!token[0]) {
@@ -383,7 +442,8 @@ void G_Script_ScriptParse(gentity_t *ent) {
 					G_Error("G_Script_ScriptParse(), Error (line %d): unknown action: %s.\n", COM_GetCurrentParseLine(), token);
 				}
 
-				curEvent->stack.items[curEvent->stack.numItems].action = action;
+				item = &g_temp_items[curEvent->stack.numItems];
+				item->action = action;
 
 				memset(params, 0, sizeof(params));
 
@@ -421,16 +481,24 @@ void G_Script_ScriptParse(gentity_t *ent) {
 				}
 
 				if (strlen(params)) { // copy the params into the event
-					curEvent->stack.items[curEvent->stack.numItems].params = G_Alloc(strlen(params) + 1);
-					Q_strncpyz(curEvent->stack.items[curEvent->stack.numItems].params, params, strlen(params) + 1);
+					item->params = G_Alloc(strlen(params) + 1);
+					Q_strncpyz(item->params, params, strlen(params) + 1);
 				}
 
+				G_Script_CompileItem(item);
+
 				curEvent->stack.numItems++;
 
 				if (curEvent->stack.numItems >= G_MAX_SCRIPT_STACK_ITEMS) {
 					G_Error("G_Script_ScriptParse(): script exceeded MAX_SCRIPT_ITEMS (%d), line %d.\n", G_MAX_SCRIPT_STACK_ITEMS, COM_GetCurrentParseLine());
 				}
 			}
+			// only keep as many items as the event uses
+			if (curEvent->stack.numItems > 0) {
+				curEvent->stack.items = G_Alloc(sizeof(g_script_stack_item_t) * curEvent->stack.numItems);
+
+				memcpy(curEvent->stack.items, g_temp_items, sizeof(g_script_stack_item_t) * curEvent->stack.numItems);
+			}
 
 			numEventItems++;
 		} else { // skip this character completely
@@ -489,16 +557,10 @@ An event has occured, for which a script may exist.
 =======================================================================================================================================
 */
 void G_Script_ScriptEvent(gentity_t *ent, char *eventStr, char *params) {
-	int i, eventNum;
+	int eventNum;
 
-	eventNum = -1;
 	// find out which event this is
-	for (i = 0; gScriptEvents[i].eventStr; i++) {
-		if (!Q_strcasecmp(eventStr, gScriptEvents[i].eventStr)) { // match found
-			eventNum = i;
-			break;
-		}
-	}
+	eventNum = G_Script_EventForString(eventStr);
 
 	if (eventNum < 0) {
 		if (g_cheats.integer) { // dev mode
@@ -507,10 +569,24 @@ void G_Script_ScriptEvent(gentity_t *ent, char *eventStr, char *params) {
 
 		return;
 	}
+
+	G_Script_ScriptEventNum(ent, eventNum, params, params ? G_HashName(params) : 0);
+}
+
+/*
+=======================================================================================================================================
+G_Script_ScriptEventNum
+
+Same as G_Script_ScriptEvent for callers that already know the event number and the G_HashName of the params.
+=======================================================================================================================================
+*/
+void G_Script_ScriptEventNum(gentity_t *ent, int eventNum, char *params, unsigned int paramsKey) {
+	int i;
+
 	// see if this entity has this event
 	for (i = 0; i < ent->numScriptEvents; i++) {
 		if (ent->scriptEvents[i].eventNum == eventNum) {
-			if ((!ent->scriptEvents[i].params) || (!gScriptEvents[eventNum].eventMatch || gScriptEvents[eventNum].eventMatch(&ent->scriptEvents[i], params))) {
+			if ((!ent->scriptEvents[i].params) || (!gScriptEvents[eventNum].eventMatch || gScriptEvents[eventNum].eventMatch(&ent->scriptEvents[i], params, paramsKey))) {
 				G_Script_ScriptChange(ent, i);
 				break;
 			}
@@ -527,6 +603,7 @@ Returns qtrue if the script completed.
 */
 qboolean G_Script_ScriptRun(gentity_t *ent) {
 	g_script_stack_t *stack;
+	g_script_stack_item_t *item;
 
 	if (strlen(g_missionStats.string) > 1) {
 		return qfalse;
@@ -565,7 +642,13 @@ qboolean G_Script_ScriptRun(gentity_t *ent) {
 	}
 
 	while (ent->scriptStatus.scriptStackHead < stack->numItems) {
-		if (!stack->items[ent->scriptStatus.scriptStackHead].action->actionFunc(ent, stack->items[ent->scriptStatus.scriptStackHead].params)) {
+		item = &stack->items[ent->scriptStatus.scriptStackHead];
+
+		if (item->op >= 0) {
+			if (!item->action->compiledFunc(ent, item)) {
+				return qfalse;
+			}
+		} else if (!item->action->actionFunc(ent, item->params)) {
 			return qfalse;
 		}
 		// move to the next action in the script
@@ -272,6 +272,28 @@ qboolean G_ScriptAction_Wait(gentity_t *ent, char *params) {
 	return (ent->scriptStatus.scriptStackChangeTime + duration < level.time);
 }
 
+/*
+=======================================================================================================================================
+G_ScriptCompile_Wait
+=======================================================================================================================================
+*/
+void G_ScriptCompile_Wait(g_script_stack_item_t *item) {
+
+	// without a duration G_ScriptAction_Wait reports the error
+	if (item->numArgs >= 1) {
+		item->op = 0;
+	}
+}
+
+/*
+=======================================================================================================================================
+G_ScriptAction_WaitCompiled
+=======================================================================================================================================
+*/
+qboolean G_ScriptAction_WaitCompiled(gentity_t *ent, g_script_stack_item_t *item) {
+	return (ent->scriptStatus.scriptStackChangeTime + item->values[0] < level.time);
+}
+
 /*
 =======================================================================================================================================
 G_ScriptAction_Trigger
@@ -326,6 +348,49 @@ qboolean G_ScriptAction_Trigger(gentity_t *ent, char *params) {
 	return qfalse; // shutup the compiler
 }
 
+/*
+=======================================================================================================================================
+G_ScriptCompile_Trigger
+=======================================================================================================================================
+*/
+void G_ScriptCompile_Trigger(g_script_stack_item_t *item) {
+
+	// without a name and an identifier G_ScriptAction_Trigger reports the error
+	if (item->numArgs >= 2) {
+		item->op = G_Script_EventForString("trigger");
+	}
+}
+
+/*
+=======================================================================================================================================
+G_ScriptAction_TriggerCompiled
+=======================================================================================================================================
+*/
+qboolean G_ScriptAction_TriggerCompiled(gentity_t *ent, g_script_stack_item_t *item) {
+	gentity_t *trent;
+	int oldId;
+
+	// look for an entity, the one found last time is used again as long as it keeps its name
+	trent = item->target;
+
+	if (!trent || !trent->inuse || trent->scriptName != item->targetName) {
+		trent = G_Find(&g_entities[MAX_CLIENTS], FOFS(scriptName), item->args[0]);
+
+		item->target = trent;
+		item->targetName = trent ? trent->scriptName : NULL;
+	}
+
+	if (trent) {
+		oldId = trent->scriptStatus.scriptId;
+		G_Script_ScriptEventNum(trent, item->op, item->args[1], item->keys[1]);
+		// if the script changed, return false so we don't muck with it's variables
+		return ((trent != ent) || (oldId == trent->scriptStatus.scriptId));
+	}
+
+	G_Printf("G_ScriptAction_Trigger: trigger has unknown name: %s.\n", item->args[0]);
+	return qfalse;
+}
+
 /*
 =======================================================================================================================================
 G_ScriptAction_PlaySound
@@ -810,6 +875,113 @@ qboolean G_ScriptAction_Accum(gentity_t *ent, char *params) {
 	return qtrue;
 }
 
+typedef enum {
+	ACCUM_INC,
+	ACCUM_ABORT_IF_LESS_THAN,
+	ACCUM_ABORT_IF_GREATER_THAN,
+	ACCUM_ABORT_IF_NOT_EQUAL,
+	ACCUM_ABORT_IF_EQUAL,
+	ACCUM_BITSET,
+	ACCUM_BITRESET,
+	ACCUM_ABORT_IF_BITSET,
+	ACCUM_ABORT_IF_NOT_BITSET,
+	ACCUM_SET,
+	ACCUM_RANDOM,
+	NUM_ACCUM_COMMANDS
+} accumCommand_t;
+
+static const char *accumCommands[NUM_ACCUM_COMMANDS] = {
+	"inc",
+	"abort_if_less_than",
+	"abort_if_greater_than",
+	"abort_if_not_equal",
+	"abort_if_equal",
+	"bitset",
+	"bitreset",
+	"abort_if_bitset",
+	"abort_if_not_bitset",
+	"set",
+	"random"
+};
+
+/*
+=======================================================================================================================================
+G_ScriptCompile_Accum
+=======================================================================================================================================
+*/
+void G_ScriptCompile_Accum(g_script_stack_item_t *item) {
+	int i;
+
+	// anything G_ScriptAction_Accum would complain about is left to it
+	if (item->numArgs < 3 || item->values[0] >= G_MAX_SCRIPT_ACCUM_BUFFERS) {
+		return;
+	}
+
+	for (i = 0; i < NUM_ACCUM_COMMANDS; i++) {
+		if (!Q_stricmp(item->args[1], accumCommands[i])) {
+			item->op = i;
+			return;
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+G_ScriptAction_AccumCompiled
+=======================================================================================================================================
+*/
+qboolean G_ScriptAction_AccumCompiled(gentity_t *ent, g_script_stack_item_t *item) {
+	int *buffer, value;
+	qboolean abort;
+
+	buffer = &ent->scriptAccumBuffer[item->values[0]];
+	value = item->values[2];
+	abort = qfalse;
+
+	switch (item->op) {
+		case ACCUM_INC:
+			*buffer += value;
+			break;
+		case ACCUM_ABORT_IF_LESS_THAN:
+			abort = (*buffer < value);
+			break;
+		case ACCUM_ABORT_IF_GREATER_THAN:
+			abort = (*buffer > value);
+			break;
+		case ACCUM_ABORT_IF_NOT_EQUAL:
+			abort = (*buffer != value);
+			break;
+		case ACCUM_ABORT_IF_EQUAL:
+			abort = (*buffer == value);
+			break;
+		case ACCUM_BITSET:
+			*buffer |= (1 << value);
+			break;
+		case ACCUM_BITRESET:
+			*buffer &= ~(1 << value);
+			break;
+		case ACCUM_ABORT_IF_BITSET:
+			abort = ((*buffer & (1 << value)) != 0);
+			break;
+		case ACCUM_ABORT_IF_NOT_BITSET:
+			abort = !(*buffer & (1 << value));
+			break;
+		case ACCUM_SET:
+			*buffer = value;
+			break;
+		case ACCUM_RANDOM:
+			*buffer = rand() % value;
+			break;
+	}
+
+	if (abort) {
+		// abort the current script
+		ent->scriptStatus.scriptStackHead = ent->scriptEvents[ent->scriptStatus.scriptEventIndex].stack.numItems;
+	}
+
+	return qtrue;
+}
+
 /*
 =======================================================================================================================================
 G_ScriptAction_MissionFailed
@@ -375,6 +375,7 @@ void G_ParseField(const char *key, const char *value, gentity_t *ent) {
 					break;
 				case F_STRING:
 					*(char **)(b + f->ofs) = G_NewString(value);
+					G_UpdateEntityNames(ent);
 					break;
 				case F_VECTOR:
 					sscanf(value, "%f %f %f", &vec[0], &vec[1], &vec[2]);
@@ -557,11 +558,11 @@ void SP_worldspawn(void) {
 #endif
 	g_entities[ENTITYNUM_WORLD].s.number = ENTITYNUM_WORLD;
 	g_entities[ENTITYNUM_WORLD].r.ownerNum = ENTITYNUM_NONE;
-	g_entities[ENTITYNUM_WORLD].classname = "worldspawn";
+	G_SetClassname(&g_entities[ENTITYNUM_WORLD], "worldspawn");
 
 	g_entities[ENTITYNUM_NONE].s.number = ENTITYNUM_NONE;
 	g_entities[ENTITYNUM_NONE].r.ownerNum = ENTITYNUM_NONE;
-	g_entities[ENTITYNUM_NONE].classname = "nothing";
+	G_SetClassname(&g_entities[ENTITYNUM_NONE], "nothing");
 	// see if we want a warmup time
 	trap_SetConfigstring(CS_WARMUP, "");
 
@@ -538,6 +538,8 @@ svcmds[] = {
 	{"forceteam", qfalse, Svcmd_ForceTeam_f},
 	{"gamememory", qfalse, Svcmd_GameMem_f},
 	{"listip", qfalse, Svcmd_ListIPs_f},
+	{"pmovebench", qfalse, Svcmd_PmoveBench_f},
+	{"pmoverecord", qfalse, Svcmd_PmoveRecord_f},
 	{"removeip", qfalse, Svcmd_RemoveIP_f},
 // Tobias DEBUG
 	{"teleport", qfalse, Svcmd_Teleport_f},
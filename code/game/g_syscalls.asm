@@ -69,6 +69,7 @@ equ trap_DebugPolygonCreate					-125
 equ trap_DebugPolygonDelete					-126
 equ trap_BotAllocateClient					-127
 equ trap_BotFreeClient						-128
+equ trap_TraceAtTime						-129
 
 equ trap_BotLibSetup						-201
 equ trap_BotLibShutdown						-202
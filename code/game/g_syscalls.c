@@ -573,6 +573,15 @@ void trap_BotFreeClient(int clientNum) {
 	syscall(G_BOT_FREE_CLIENT, clientNum);
 }
 
+/*
+=======================================================================================================================================
+trap_TraceAtTime
+=======================================================================================================================================
+*/
+void trap_TraceAtTime(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int time) {
+	syscall(G_TRACE_AT_TIME, results, start, mins, maxs, end, passEntityNum, contentmask, time);
+}
+
 // BotLib traps start here
 
 /*
@@ -52,7 +52,7 @@ void Use_Target_Give(gentity_t *ent, gentity_t *other, gentity_t *activator) {
 
 		Touch_Item(t, activator, &trace);
 		// make sure it isn't going to respawn or show any events
-		t->nextthink = 0;
+		G_SetNextThink(t, 0);
 
 		trap_UnlinkEntity(t);
 	}
@@ -111,7 +111,7 @@ Use_Target_Delay
 */
 void Use_Target_Delay(gentity_t *ent, gentity_t *other, gentity_t *activator) {
 
-	ent->nextthink = level.time + (ent->wait + ent->random * crandom()) * 1000;
+	G_SetNextThink(ent, level.time + (ent->wait + ent->random * crandom()) * 1000);
 	ent->think = Think_Target_Delay;
 	ent->activator = activator;
 }
@@ -290,7 +290,7 @@ void SP_target_speaker(gentity_t *ent) {
 
 	if (ent->spawnflags & 16) {
 		ent->think = Target_Speaker_Multiple_Think;
-		ent->nextthink = level.time + 50;
+		G_SetNextThink(ent, level.time + 50);
 	}
 
 	VectorCopy(ent->s.origin, ent->s.pos.trBase);
@@ -327,7 +327,7 @@ void Target_Laser_Think(gentity_t *self) {
 	VectorCopy(tr.endpos, self->s.origin2);
 	trap_LinkEntity(self);
 
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 }
 
 /*
@@ -353,7 +353,7 @@ void Target_Laser_Off(gentity_t *self) {
 
 	trap_UnlinkEntity(self);
 
-	self->nextthink = 0;
+	G_SetNextThink(self, 0);
 }
 
 /*
@@ -415,7 +415,7 @@ void SP_target_laser(gentity_t *self) {
 
 	// let everything else get spawned before we start firing
 	self->think = Target_Laser_Start;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 }
 
 /*
@@ -563,7 +563,7 @@ in site, closest in distance
 void SP_target_location(gentity_t *self) {
 
 	self->think = Target_Location_Linkup;
-	self->nextthink = level.time + 200; // let them all spawn first
+	G_SetNextThink(self, level.time + 200); // let them all spawn first
 
 	G_SetOrigin(self, self->s.origin);
 }
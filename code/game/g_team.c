@@ -1218,7 +1218,7 @@ ObeliskRegen
 */
 static void ObeliskRegen(gentity_t *self) {
 
-	self->nextthink = level.time + g_obeliskRegenPeriod.integer * 1000;
+	G_SetNextThink(self, level.time + g_obeliskRegenPeriod.integer * 1000);
 
 	if (self->health >= g_obeliskHealth.integer) {
 		return;
@@ -1246,7 +1246,7 @@ static void ObeliskRespawn(gentity_t *self) {
 	self->takedamage = qtrue;
 	self->health = g_obeliskHealth.integer;
 	self->think = ObeliskRegen;
-	self->nextthink = level.time + g_obeliskRegenPeriod.integer * 1000;
+	G_SetNextThink(self, level.time + g_obeliskRegenPeriod.integer * 1000);
 	self->activator->s.frame = 0;
 }
 
@@ -1262,7 +1262,7 @@ static void ObeliskDie(gentity_t *self, gentity_t *inflictor, gentity_t *attacke
 
 	self->takedamage = qfalse;
 	self->think = ObeliskRespawn;
-	self->nextthink = level.time + g_obeliskRespawnDelay.integer * 1000;
+	G_SetNextThink(self, level.time + g_obeliskRespawnDelay.integer * 1000);
 	self->activator->s.modelindex2 = 0xff;
 	self->activator->s.frame = 2;
 
@@ -1383,7 +1383,7 @@ gentity_t *SpawnObelisk(vec3_t origin, vec3_t mins, vec3_t maxs, int team) {
 		ent->die = ObeliskDie;
 		ent->pain = ObeliskPain;
 		ent->think = ObeliskRegen;
-		ent->nextthink = level.time + g_obeliskRegenPeriod.integer * 1000;
+		G_SetNextThink(ent, level.time + g_obeliskRegenPeriod.integer * 1000);
 	}
 
 	if (g_gametype.integer == GT_HARVESTER) {
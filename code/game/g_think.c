@@ -0,0 +1,349 @@
+/*
+=======================================================================================================================================
+Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+
+This file is part of Spearmint Source Code.
+
+Spearmint Source Code is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License, or (at your option) any later version.
+
+Spearmint Source Code is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Spearmint Source Code.
+If not, see <http://www.gnu.org/licenses/>.
+
+In addition, Spearmint Source Code is also subject to certain additional terms. You should have received a copy of these additional
+terms immediately following the terms and conditions of the GNU General Public License. If not, please request a copy in writing from
+id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o
+ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+=======================================================================================================================================
+*/
+
+#include "g_local.h"
+
+/*
+=======================================================================================================================================
+
+	THINK SCHEDULING
+
+	Only entities that have work to do are visited by G_RunFrame. Clients, missiles, movers, items, physics objects, scripted entities
+	and entities with a pending event stay in the active set, everything else only comes up when its nextthink is due. Pending thinks
+	are kept on a hierarchical timer wheel with a resolution of 16 msec, an entity is never woken up early because its nextthink is
+	still compared against level.time when its slot comes up.
+
+=======================================================================================================================================
+*/
+
+#define THINK_TICK_SHIFT 4 // 16 msec
+#define THINK_WHEEL0_BITS 8
+#define THINK_WHEEL_BITS 6
+#define THINK_WHEEL0_SIZE (1 << THINK_WHEEL0_BITS)
+#define THINK_WHEEL_SIZE (1 << THINK_WHEEL_BITS)
+#define THINK_WHEEL1_SHIFT THINK_WHEEL0_BITS
+#define THINK_WHEEL2_SHIFT (THINK_WHEEL0_BITS + THINK_WHEEL_BITS)
+#define THINK_OVERFLOW_SHIFT (THINK_WHEEL0_BITS + THINK_WHEEL_BITS * 2)
+
+static gentity_t *thinkWheel0[THINK_WHEEL0_SIZE];	// the next 4 seconds, one slot per tick
+static gentity_t *thinkWheel1[THINK_WHEEL_SIZE];	// the next 4 minutes
+static gentity_t *thinkWheel2[THINK_WHEEL_SIZE];	// the next 4 hours
+static gentity_t *thinkOverflow;					// anything further away
+static gentity_t *thinkPending;						// ticks that were already passed, checked again every frame
+static int thinkTick;								// last tick moved to the due set
+
+static unsigned int activeEntities[MAX_GENTITIES / 32];
+static unsigned int dueEntities[MAX_GENTITIES / 32];
+
+/*
+=======================================================================================================================================
+G_LinkThink
+=======================================================================================================================================
+*/
+static void G_LinkThink(gentity_t *ent, gentity_t **list) {
+
+	ent->thinkList = list;
+	ent->thinkPrev = NULL;
+	ent->thinkNext = *list;
+
+	if (*list) {
+		(*list)->thinkPrev = ent;
+	}
+
+	*list = ent;
+}
+
+/*
+=======================================================================================================================================
+G_UnlinkThink
+=======================================================================================================================================
+*/
+static void G_UnlinkThink(gentity_t *ent) {
+
+	if (!ent->thinkList) {
+		return;
+	}
+
+	if (ent->thinkPrev) {
+		ent->thinkPrev->thinkNext = ent->thinkNext;
+	} else {
+		*ent->thinkList = ent->thinkNext;
+	}
+
+	if (ent->thinkNext) {
+		ent->thinkNext->thinkPrev = ent->thinkPrev;
+	}
+
+	ent->thinkList = NULL;
+	ent->thinkPrev = NULL;
+	ent->thinkNext = NULL;
+}
+
+/*
+=======================================================================================================================================
+G_InsertThink
+
+Puts the entity in the wheel slot that covers its nextthink.
+=======================================================================================================================================
+*/
+static void G_InsertThink(gentity_t *ent) {
+	int tick, delta;
+
+	tick = ent->nextthink >> THINK_TICK_SHIFT;
+	delta = tick - thinkTick;
+
+	if (delta <= 0) {
+		G_LinkThink(ent, &thinkPending);
+	} else if (delta <= THINK_WHEEL0_SIZE) {
+		G_LinkThink(ent, &thinkWheel0[tick & (THINK_WHEEL0_SIZE - 1)]);
+	} else if (delta <= (1 << THINK_WHEEL2_SHIFT)) {
+		G_LinkThink(ent, &thinkWheel1[(tick >> THINK_WHEEL1_SHIFT) & (THINK_WHEEL_SIZE - 1)]);
+	} else if (delta <= (1 << THINK_OVERFLOW_SHIFT)) {
+		G_LinkThink(ent, &thinkWheel2[(tick >> THINK_WHEEL2_SHIFT) & (THINK_WHEEL_SIZE - 1)]);
+	} else {
+		G_LinkThink(ent, &thinkOverflow);
+	}
+}
+
+/*
+=======================================================================================================================================
+G_ReinsertThinks
+
+Takes all entities off the list and schedules them again, either into a finer slot or into the due set.
+=======================================================================================================================================
+*/
+static void G_ReinsertThinks(gentity_t **list) {
+	gentity_t *ent, *next;
+	int num;
+
+	ent = *list;
+	*list = NULL;
+
+	for (; ent; ent = next) {
+		next = ent->thinkNext;
+
+		ent->thinkList = NULL;
+		ent->thinkPrev = NULL;
+		ent->thinkNext = NULL;
+
+		if (ent->nextthink > level.time) {
+			G_InsertThink(ent);
+			continue;
+		}
+
+		num = ent - g_entities;
+		dueEntities[num >> 5] |= 1u << (num & 31);
+	}
+}
+
+/*
+=======================================================================================================================================
+G_InitThinks
+
+Called before the entities are spawned.
+=======================================================================================================================================
+*/
+void G_InitThinks(int levelTime) {
+	int i;
+
+	memset(thinkWheel0, 0, sizeof(thinkWheel0));
+	memset(thinkWheel1, 0, sizeof(thinkWheel1));
+	memset(thinkWheel2, 0, sizeof(thinkWheel2));
+	memset(activeEntities, 0, sizeof(activeEntities));
+	memset(dueEntities, 0, sizeof(dueEntities));
+
+	thinkOverflow = NULL;
+	thinkPending = NULL;
+	thinkTick = levelTime >> THINK_TICK_SHIFT;
+	// client slots are always visited
+	for (i = 0; i < MAX_CLIENTS; i++) {
+		activeEntities[i >> 5] |= 1u << (i & 31);
+	}
+}
+
+/*
+=======================================================================================================================================
+G_AdvanceThinks
+
+Moves every entity whose nextthink has come up to the due set.
+=======================================================================================================================================
+*/
+void G_AdvanceThinks(void) {
+	int tick, target;
+
+	G_ReinsertThinks(&thinkPending);
+
+	target = level.time >> THINK_TICK_SHIFT;
+
+	while (thinkTick < target) {
+		tick = thinkTick + 1;
+		// cascade the coarser wheels while thinkTick still refers to the last finished tick, so everything lands in a slot that is
+		// still ahead
+		if (!(tick & ((1 << THINK_WHEEL1_SHIFT) - 1))) {
+			if (!(tick & ((1 << THINK_WHEEL2_SHIFT) - 1))) {
+				if (!(tick & ((1 << THINK_OVERFLOW_SHIFT) - 1))) {
+					G_ReinsertThinks(&thinkOverflow);
+				}
+
+				G_ReinsertThinks(&thinkWheel2[(tick >> THINK_WHEEL2_SHIFT) & (THINK_WHEEL_SIZE - 1)]);
+			}
+
+			G_ReinsertThinks(&thinkWheel1[(tick >> THINK_WHEEL1_SHIFT) & (THINK_WHEEL_SIZE - 1)]);
+		}
+
+		thinkTick = tick;
+
+		G_ReinsertThinks(&thinkWheel0[tick & (THINK_WHEEL0_SIZE - 1)]);
+	}
+}
+
+/*
+=======================================================================================================================================
+G_SetNextThink
+
+All writes to nextthink go through here so the entity ends up in the right wheel slot. A time that has already passed makes the
+entity due for the next frame, just like the old full sweep did.
+=======================================================================================================================================
+*/
+void G_SetNextThink(gentity_t *ent, int time) {
+	int num;
+
+	ent->nextthink = time;
+
+	G_UnlinkThink(ent);
+
+	if (time <= 0) {
+		return;
+	}
+
+	if (time > level.time) {
+		G_InsertThink(ent);
+		return;
+	}
+
+	num = ent - g_entities;
+	dueEntities[num >> 5] |= 1u << (num & 31);
+}
+
+/*
+=======================================================================================================================================
+G_ActivateEntity
+
+Makes G_RunFrame visit the entity every frame until it goes idle again.
+=======================================================================================================================================
+*/
+void G_ActivateEntity(gentity_t *ent) {
+	int num;
+
+	num = ent - g_entities;
+	activeEntities[num >> 5] |= 1u << (num & 31);
+}
+
+/*
+=======================================================================================================================================
+G_RemoveThinks
+
+Called when the entity is freed.
+=======================================================================================================================================
+*/
+void G_RemoveThinks(gentity_t *ent) {
+	int num;
+
+	G_UnlinkThink(ent);
+
+	num = ent - g_entities;
+	dueEntities[num >> 5] &= ~(1u << (num & 31));
+
+	if (num >= MAX_CLIENTS) {
+		activeEntities[num >> 5] &= ~(1u << (num & 31));
+	}
+}
+
+/*
+=======================================================================================================================================
+G_NextRunnableEntity
+
+Returns the first active or due entity number at or after start, or level.num_entities if there are none left. The due bit is cleared,
+a think that makes the entity due again will run in the next frame.
+=======================================================================================================================================
+*/
+int G_NextRunnableEntity(int start) {
+	unsigned int bits;
+	int i;
+
+	for (i = start; i < level.num_entities; i = (i | 31) + 1) {
+		bits = (activeEntities[i >> 5]|dueEntities[i >> 5]) >> (i & 31);
+
+		if (!bits) {
+			continue;
+		}
+
+		while (!(bits & 1)) {
+			bits >>= 1;
+			i++;
+		}
+
+		if (i >= level.num_entities) {
+			break;
+		}
+
+		dueEntities[i >> 5] &= ~(1u << (i & 31));
+		return i;
+	}
+
+	return level.num_entities;
+}
+
+/*
+=======================================================================================================================================
+G_UpdateEntityActivity
+
+Called after the entity had its frame, decides if it has to be visited again in the next frame.
+=======================================================================================================================================
+*/
+void G_UpdateEntityActivity(gentity_t *ent) {
+	int num;
+
+	num = ent - g_entities;
+
+	if (num < MAX_CLIENTS) {
+		return;
+	}
+
+	if (ent->inuse) {
+		if (ent->s.event || ent->freeAfterEvent || ent->unlinkAfterEvent || ent->physicsObject || ent->numScriptEvents > 0) {
+			return;
+		}
+
+		if (ent->s.eType == ET_MISSILE || ent->s.eType == ET_ITEM || ent->s.eType == ET_MOVER) {
+			return;
+		}
+		// a think that was held back (unlinked neverFree entities) is checked again every frame
+		if (ent->nextthink > 0 && ent->nextthink <= level.time) {
+			return;
+		}
+	}
+
+	activeEntities[num >> 5] &= ~(1u << (num & 31));
+}
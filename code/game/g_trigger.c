@@ -49,7 +49,7 @@ The wait time has passed, so set back up for another activation.
 =======================================================================================================================================
 */
 void Multi_Wait(gentity_t *ent) {
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 /*
@@ -82,11 +82,11 @@ void Use_Trigger_Multiple(gentity_t *ent, gentity_t *activator) {
 
 	if (ent->wait > 0) {
 		ent->think = Multi_Wait;
-		ent->nextthink = level.time + (ent->wait + ent->random * crandom()) * 1000;
+		G_SetNextThink(ent, level.time + (ent->wait + ent->random * crandom()) * 1000);
 	} else {
 		// we can't just remove (self) here, because this is a touch function called while looping through area links...
 		ent->touch = 0;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink(ent, level.time + FRAMETIME);
 		ent->think = G_FreeEntity;
 	}
 }
@@ -163,7 +163,7 @@ This trigger will always fire. It is activated by the world.
 void SP_trigger_always(gentity_t *ent) {
 
 	// we must have some delay to make sure our use targets are present
-	ent->nextthink = level.time + 300;
+	G_SetNextThink(ent, level.time + 300);
 	ent->think = Trigger_Always_Think;
 }
 
@@ -248,7 +248,7 @@ void SP_trigger_push(gentity_t *self) {
 	self->s.eType = ET_PUSH_TRIGGER;
 	self->touch = Touch_PushTrigger;
 	self->think = AimAtTarget;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 
 	trap_LinkEntity(self);
 }
@@ -300,7 +300,7 @@ void SP_target_push(gentity_t *self) {
 		VectorCopy(self->s.origin, self->r.absmin);
 		VectorCopy(self->s.origin, self->r.absmax);
 		self->think = AimAtTarget;
-		self->nextthink = level.time + FRAMETIME;
+		G_SetNextThink(self, level.time + FRAMETIME);
 	}
 
 	self->use = Use_Target_Push;
@@ -478,7 +478,7 @@ void Func_Timer_Think(gentity_t *self) {
 
 	G_UseTargets(self, self->activator);
 	// set time before next firing
-	self->nextthink = level.time + 1000 * (self->wait + crandom() * self->random);
+	G_SetNextThink(self, level.time + 1000 * (self->wait + crandom() * self->random));
 }
 
 /*
@@ -491,7 +491,7 @@ void Use_Func_Timer(gentity_t *self, gentity_t *other, gentity_t *activator) {
 	self->activator = activator;
 	// if on, turn it off
 	if (self->nextthink) {
-		self->nextthink = 0;
+		G_SetNextThink(self, 0);
 		return;
 	}
 	// turn it on
@@ -523,7 +523,7 @@ void SP_func_timer(gentity_t *self) {
 	}
 
 	if (self->spawnflags & 1) {
-		self->nextthink = level.time + FRAMETIME;
+		G_SetNextThink(self, level.time + FRAMETIME);
 		self->activator = self;
 	}
 
@@ -84,6 +84,33 @@ const char *BuildShaderStateConfig(void) {
 	return buff;
 }
 
+/*
+=======================================================================================================================================
+G_HashName
+
+Case insensitive string hash for the lookup tables.
+=======================================================================================================================================
+*/
+unsigned int G_HashName(const char *name) {
+	unsigned int hash;
+	int c;
+
+	hash = 2166136261u;
+
+	while (*name) {
+		c = *name++;
+
+		if (c >= 'A' && c <= 'Z') {
+			c += 'a' - 'A';
+		}
+
+		hash ^= (unsigned char)c;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
 /*
 =======================================================================================================================================
 
@@ -94,17 +121,93 @@ const char *BuildShaderStateConfig(void) {
 
 /*
 =======================================================================================================================================
-G_FindConfigstringIndex
+
+	The strings of every range that is searched are hashed the first time the range is used after G_InitGame, so a lookup only has to
+	fetch the configstring it found to confirm the match. Nothing else in the game sets configstrings in these ranges, so the cache
+	stays coherent by updating it whenever a new index is created.
+
 =======================================================================================================================================
 */
-int G_FindConfigstringIndex(const char *name, int start, int max, qboolean create) {
+
+#define MAX_CONFIGSTRING_CACHES 4
+#define CONFIGSTRING_HASH_SIZE 512 // twice the largest cached range
+
+typedef struct {
+	int start;								// 0 if the cache is unused
+	int count;								// first unused index in the range
+	unsigned int hashes[CONFIGSTRING_HASH_SIZE];
+	int indexes[CONFIGSTRING_HASH_SIZE];	// 0 for an empty slot
+} configstringCache_t;
+
+static configstringCache_t configstringCaches[MAX_CONFIGSTRING_CACHES];
+
+/*
+=======================================================================================================================================
+G_InitConfigstringCaches
+=======================================================================================================================================
+*/
+void G_InitConfigstringCaches(void) {
 	int i;
+
+	for (i = 0; i < MAX_CONFIGSTRING_CACHES; i++) {
+		configstringCaches[i].start = 0;
+	}
+}
+
+/*
+=======================================================================================================================================
+G_AddConfigstringHash
+=======================================================================================================================================
+*/
+static void G_AddConfigstringHash(configstringCache_t *cache, unsigned int hash, int index) {
+	int slot;
+
+	slot = hash & (CONFIGSTRING_HASH_SIZE - 1);
+
+	while (cache->indexes[slot]) {
+		slot = (slot + 1) & (CONFIGSTRING_HASH_SIZE - 1);
+	}
+
+	cache->hashes[slot] = hash;
+	cache->indexes[slot] = index;
+}
+
+/*
+=======================================================================================================================================
+G_ConfigstringCache
+
+Returns the cache for the range, hashing the strings that are already set if it wasn't used yet. Returns NULL if the range can't be
+cached.
+=======================================================================================================================================
+*/
+static configstringCache_t *G_ConfigstringCache(int start, int max) {
+	configstringCache_t *cache;
 	char s[MAX_STRING_CHARS];
+	int i;
 
-	if (!name || !name[0]) {
-		return 0;
+	if (max > CONFIGSTRING_HASH_SIZE / 2) {
+		return NULL;
+	}
+
+	for (i = 0; i < MAX_CONFIGSTRING_CACHES; i++) {
+		if (configstringCaches[i].start == start) {
+			return &configstringCaches[i];
+		}
+
+		if (!configstringCaches[i].start) {
+			break;
+		}
+	}
+
+	if (i == MAX_CONFIGSTRING_CACHES) {
+		return NULL;
 	}
 
+	cache = &configstringCaches[i];
+	cache->start = start;
+
+	memset(cache->indexes, 0, sizeof(cache->indexes));
+
 	for (i = 1; i < max; i++) {
 		trap_GetConfigstring(start + i, s, sizeof(s));
 
@@ -112,8 +215,57 @@ int G_FindConfigstringIndex(const char *name, int start, int max, qboolean creat
 			break;
 		}
 
-		if (!strcmp(s, name)) {
-			return i;
+		G_AddConfigstringHash(cache, G_HashName(s), i);
+	}
+
+	cache->count = i;
+	return cache;
+}
+
+/*
+=======================================================================================================================================
+G_FindConfigstringIndex
+=======================================================================================================================================
+*/
+int G_FindConfigstringIndex(const char *name, int start, int max, qboolean create) {
+	configstringCache_t *cache;
+	unsigned int hash;
+	int i, slot;
+	char s[MAX_STRING_CHARS];
+
+	if (!name || !name[0]) {
+		return 0;
+	}
+
+	cache = G_ConfigstringCache(start, max);
+
+	if (cache) {
+		hash = G_HashName(name);
+
+		for (slot = hash & (CONFIGSTRING_HASH_SIZE - 1); cache->indexes[slot]; slot = (slot + 1) & (CONFIGSTRING_HASH_SIZE - 1)) {
+			if (cache->hashes[slot] != hash) {
+				continue;
+			}
+
+			trap_GetConfigstring(start + cache->indexes[slot], s, sizeof(s));
+
+			if (!strcmp(s, name)) {
+				return cache->indexes[slot];
+			}
+		}
+
+		i = cache->count;
+	} else {
+		for (i = 1; i < max; i++) {
+			trap_GetConfigstring(start + i, s, sizeof(s));
+
+			if (!s[0]) {
+				break;
+			}
+
+			if (!strcmp(s, name)) {
+				return i;
+			}
 		}
 	}
 
@@ -127,6 +279,11 @@ int G_FindConfigstringIndex(const char *name, int start, int max, qboolean creat
 
 	trap_SetConfigstring(start + i, name);
 
+	if (cache) {
+		G_AddConfigstringHash(cache, hash, i);
+		cache->count++;
+	}
+
 	return i;
 }
 
@@ -167,6 +324,177 @@ void G_TeamCommand(team_t team, const char *cmd) {
 	}
 }
 
+/*
+=======================================================================================================================================
+
+	ENTITY NAME INDEXES
+
+	classname, targetname and scriptName are hashed case insensitively into buckets of entity numbers sorted in ascending order, so G_Find
+	only has to look at the entities that have a name with the same hash. The indexes are updated by the G_Set* functions below, spawn
+	key parsing and G_FreeEntity, so these fields must not be assigned directly. Links are stored as entity number + 1, zero ends the
+	list.
+
+=======================================================================================================================================
+*/
+
+#define ENTITY_NAME_HASH_SIZE 1024
+
+typedef enum {
+	ENTITYNAME_CLASSNAME,
+	ENTITYNAME_TARGETNAME,
+	ENTITYNAME_SCRIPTNAME,
+	NUM_ENTITYNAMES
+} entityName_t;
+
+typedef struct {
+	int fieldofs;
+	int buckets[ENTITY_NAME_HASH_SIZE];
+	int next[MAX_GENTITIES];
+	int prev[MAX_GENTITIES];
+	unsigned int hashes[MAX_GENTITIES];
+	const char *names[MAX_GENTITIES];	// the string the entity was indexed with, NULL if it isn't indexed
+} entityNameIndex_t;
+
+static entityNameIndex_t entityNameIndexes[NUM_ENTITYNAMES];
+
+/*
+=======================================================================================================================================
+G_UnindexEntityName
+=======================================================================================================================================
+*/
+static void G_UnindexEntityName(entityNameIndex_t *index, int num) {
+
+	if (!index->names[num]) {
+		return;
+	}
+
+	if (index->prev[num]) {
+		index->next[index->prev[num] - 1] = index->next[num];
+	} else {
+		index->buckets[index->hashes[num] & (ENTITY_NAME_HASH_SIZE - 1)] = index->next[num];
+	}
+
+	if (index->next[num]) {
+		index->prev[index->next[num] - 1] = index->prev[num];
+	}
+
+	index->next[num] = 0;
+	index->prev[num] = 0;
+	index->names[num] = NULL;
+}
+
+/*
+=======================================================================================================================================
+G_IndexEntityName
+
+Keeps the index in sync with the field of the entity.
+=======================================================================================================================================
+*/
+static void G_IndexEntityName(entityNameIndex_t *index, gentity_t *ent) {
+	const char *name;
+	int num, prev, next;
+	unsigned int hash;
+
+	name = *(const char **)((byte *)ent + index->fieldofs);
+	num = ent - g_entities;
+
+	if (name == index->names[num]) {
+		return;
+	}
+
+	G_UnindexEntityName(index, num);
+
+	if (!name) {
+		return;
+	}
+
+	hash = G_HashName(name);
+	// keep the bucket sorted, G_Find returns the entities in order
+	prev = 0;
+
+	for (next = index->buckets[hash & (ENTITY_NAME_HASH_SIZE - 1)]; next && next - 1 < num; next = index->next[next - 1]) {
+		prev = next;
+	}
+
+	index->next[num] = next;
+	index->prev[num] = prev;
+
+	if (prev) {
+		index->next[prev - 1] = num + 1;
+	} else {
+		index->buckets[hash & (ENTITY_NAME_HASH_SIZE - 1)] = num + 1;
+	}
+
+	if (next) {
+		index->prev[next - 1] = num + 1;
+	}
+
+	index->hashes[num] = hash;
+	index->names[num] = name;
+}
+
+/*
+=======================================================================================================================================
+G_InitEntityNames
+=======================================================================================================================================
+*/
+void G_InitEntityNames(void) {
+
+	memset(entityNameIndexes, 0, sizeof(entityNameIndexes));
+
+	entityNameIndexes[ENTITYNAME_CLASSNAME].fieldofs = FOFS(classname);
+	entityNameIndexes[ENTITYNAME_TARGETNAME].fieldofs = FOFS(targetname);
+	entityNameIndexes[ENTITYNAME_SCRIPTNAME].fieldofs = FOFS(scriptName);
+}
+
+/*
+=======================================================================================================================================
+G_UpdateEntityNames
+
+Called after the name fields of the entity might have been changed behind the back of the indexes.
+=======================================================================================================================================
+*/
+void G_UpdateEntityNames(gentity_t *ent) {
+	int i;
+
+	for (i = 0; i < NUM_ENTITYNAMES; i++) {
+		G_IndexEntityName(&entityNameIndexes[i], ent);
+	}
+}
+
+/*
+=======================================================================================================================================
+G_SetClassname
+=======================================================================================================================================
+*/
+void G_SetClassname(gentity_t *ent, const char *classname) {
+
+	ent->classname = classname;
+	G_IndexEntityName(&entityNameIndexes[ENTITYNAME_CLASSNAME], ent);
+}
+
+/*
+=======================================================================================================================================
+G_SetTargetname
+=======================================================================================================================================
+*/
+void G_SetTargetname(gentity_t *ent, const char *targetname) {
+
+	ent->targetname = targetname;
+	G_IndexEntityName(&entityNameIndexes[ENTITYNAME_TARGETNAME], ent);
+}
+
+/*
+=======================================================================================================================================
+G_SetScriptName
+=======================================================================================================================================
+*/
+void G_SetScriptName(gentity_t *ent, char *scriptName) {
+
+	ent->scriptName = scriptName;
+	G_IndexEntityName(&entityNameIndexes[ENTITYNAME_SCRIPTNAME], ent);
+}
+
 /*
 =======================================================================================================================================
 G_Find
@@ -177,6 +505,9 @@ NULL will be returned if the end of the list is reached.
 =======================================================================================================================================
 */
 gentity_t *G_Find(gentity_t *from, int fieldofs, const char *match) {
+	entityNameIndex_t *index;
+	unsigned int hash;
+	int i, start;
 	char *s;
 
 	if (!from) {
@@ -185,6 +516,48 @@ gentity_t *G_Find(gentity_t *from, int fieldofs, const char *match) {
 		from++;
 	}
 
+	index = NULL;
+
+	for (i = 0; i < NUM_ENTITYNAMES; i++) {
+		if (entityNameIndexes[i].fieldofs == fieldofs) {
+			index = &entityNameIndexes[i];
+			break;
+		}
+	}
+
+	if (index) {
+		if (!match) {
+			return NULL;
+		}
+
+		hash = G_HashName(match);
+		start = from - g_entities;
+
+		for (i = index->buckets[hash & (ENTITY_NAME_HASH_SIZE - 1)]; i; i = index->next[i - 1]) {
+			if (i - 1 < start || index->hashes[i - 1] != hash) {
+				continue;
+			}
+
+			if (i - 1 >= level.num_entities) {
+				break;
+			}
+
+			from = &g_entities[i - 1];
+
+			if (!from->inuse) {
+				continue;
+			}
+
+			s = *(char **)((byte *)from + fieldofs);
+
+			if (s && !Q_stricmp(s, match)) {
+				return from;
+			}
+		}
+
+		return NULL;
+	}
+
 	for (; from < &g_entities[level.num_entities]; from++) {
 		if (!from->inuse) {
 			continue;
@@ -373,6 +746,89 @@ float VectorToYaw(const vec3_t vec) {
 	return yaw;
 }
 
+/*
+=======================================================================================================================================
+
+	FREE ENTITIES
+
+	Freed entities are queued in the order they were freed, so the head of the queue is always the one that has been free the longest.
+	Links are stored as entity number + 1, zero ends the list.
+
+=======================================================================================================================================
+*/
+
+static int freeEntityNext[MAX_GENTITIES];
+static int freeEntityPrev[MAX_GENTITIES];
+static int freeEntityHead;
+static int freeEntityTail;
+
+/*
+=======================================================================================================================================
+G_InitFreeEntities
+=======================================================================================================================================
+*/
+void G_InitFreeEntities(void) {
+
+	memset(freeEntityNext, 0, sizeof(freeEntityNext));
+	memset(freeEntityPrev, 0, sizeof(freeEntityPrev));
+
+	freeEntityHead = 0;
+	freeEntityTail = 0;
+}
+
+/*
+=======================================================================================================================================
+G_QueueFreeEntity
+=======================================================================================================================================
+*/
+static void G_QueueFreeEntity(int num) {
+
+	freeEntityNext[num] = 0;
+	freeEntityPrev[num] = freeEntityTail;
+
+	if (freeEntityTail) {
+		freeEntityNext[freeEntityTail - 1] = num + 1;
+	} else {
+		freeEntityHead = num + 1;
+	}
+
+	freeEntityTail = num + 1;
+}
+
+/*
+=======================================================================================================================================
+G_FreeEntityQueued
+
+Only the head has no previous link, slots that were never queued have neither.
+=======================================================================================================================================
+*/
+static qboolean G_FreeEntityQueued(int num) {
+	return freeEntityPrev[num] || freeEntityHead == num + 1;
+}
+
+/*
+=======================================================================================================================================
+G_DequeueFreeEntity
+=======================================================================================================================================
+*/
+static void G_DequeueFreeEntity(int num) {
+
+	if (freeEntityPrev[num]) {
+		freeEntityNext[freeEntityPrev[num] - 1] = freeEntityNext[num];
+	} else {
+		freeEntityHead = freeEntityNext[num];
+	}
+
+	if (freeEntityNext[num]) {
+		freeEntityPrev[freeEntityNext[num] - 1] = freeEntityPrev[num];
+	} else {
+		freeEntityTail = freeEntityPrev[num];
+	}
+
+	freeEntityNext[num] = 0;
+	freeEntityPrev[num] = 0;
+}
+
 /*
 =======================================================================================================================================
 G_InitGentity
@@ -381,11 +837,13 @@ G_InitGentity
 void G_InitGentity(gentity_t *e) {
 
 	e->inuse = qtrue;
-	e->classname = "noclass";
+	G_SetClassname(e, "noclass");
 	e->s.number = e - g_entities;
 	e->r.ownerNum = ENTITYNUM_NONE;
 	// init scripting
 	e->scriptStatus.scriptEventIndex = -1;
+
+	G_ActivateEntity(e);
 }
 
 /*
@@ -399,33 +857,24 @@ instead of being removed and recreated, which can cause interpolated angles and
 =======================================================================================================================================
 */
 gentity_t *G_Spawn(void) {
-	int i, force;
+	int i;
 	gentity_t *e;
 
-	e = NULL; // shut up warning
-
-	for (force = 0; force < 2; force++) {
-		// if we go through all entities and can't find one to free, override the normal minimum times before use
-		e = &g_entities[MAX_CLIENTS];
-
-		for (i = MAX_CLIENTS; i < level.num_entities; i++, e++) {
-			if (e->inuse) {
-				continue;
-			}
-			// the first couple seconds of server time can involve a lot of freeing and allocating, so relax the replacement policy
-			if (!force && e->freetime > level.startTime + 2000 && level.time - e->freetime < 1000) {
-				continue;
-			}
+	if (freeEntityHead) {
+		// the head of the queue has been free the longest, if it can't be reused yet none of the others can
+		e = &g_entities[freeEntityHead - 1];
+		// the first couple seconds of server time can involve a lot of freeing and allocating, so relax the replacement policy
+		// if we can't open a new slot, override the normal minimum times before use
+		if (e->freetime <= level.startTime + 2000 || level.time - e->freetime >= 1000 || level.num_entities >= ENTITYNUM_MAX_NORMAL) {
 			// reuse this slot
+			G_DequeueFreeEntity(freeEntityHead - 1);
 			G_InitGentity(e);
 			return e;
 		}
-
-		if (level.num_entities < ENTITYNUM_MAX_NORMAL) {
-			break;
-		}
 	}
 
+	e = &g_entities[level.num_entities];
+
 	if (level.num_entities == ENTITYNUM_MAX_NORMAL) {
 		for (i = 0; i < MAX_GENTITIES; i++) {
 			G_Printf("%4i: %s\n", i, g_entities[i].classname);
@@ -447,25 +896,13 @@ G_EntitiesFree
 =======================================================================================================================================
 */
 qboolean G_EntitiesFree(void) {
-	int i;
-	gentity_t *e;
 
 	if (level.num_entities < ENTITYNUM_MAX_NORMAL) {
 		// can open a new slot if needed
 		return qtrue;
 	}
-
-	e = &g_entities[MAX_CLIENTS];
-
-	for (i = MAX_CLIENTS; i < level.num_entities; i++, e++) {
-		if (e->inuse) {
-			continue;
-		}
-		// slot available
-		return qtrue;
-	}
-
-	return qfalse;
+	// slot available
+	return freeEntityHead != 0;
 }
 
 /*
@@ -476,6 +913,7 @@ Marks the entity as free.
 =======================================================================================================================================
 */
 void G_FreeEntity(gentity_t *ent) {
+	int num;
 
 	trap_UnlinkEntity(ent); // unlink from world
 
@@ -483,11 +921,24 @@ void G_FreeEntity(gentity_t *ent) {
 		return;
 	}
 
+	num = ent - g_entities;
+	// freeing an entity twice moves it to the back of the queue, as it gets a new freetime
+	if (num >= MAX_CLIENTS && !ent->inuse && G_FreeEntityQueued(num)) {
+		G_DequeueFreeEntity(num);
+	}
+
+	G_RemoveThinks(ent);
 	memset(ent, 0, sizeof(*ent));
 
 	ent->classname = "freed";
 	ent->freetime = level.time;
 	ent->inuse = qfalse;
+
+	G_UpdateEntityNames(ent);
+
+	if (num >= MAX_CLIENTS) {
+		G_QueueFreeEntity(num);
+	}
 }
 
 /*
@@ -504,7 +955,7 @@ gentity_t *G_TempEntity(const vec3_t origin, int event) {
 
 	e = G_Spawn();
 	e->s.eType = ET_EVENTS + event;
-	e->classname = "tempEntity";
+	G_SetClassname(e, "tempEntity");
 	e->eventTime = level.time;
 	e->freeAfterEvent = qtrue;
 
@@ -593,6 +1044,8 @@ void G_AddEvent(gentity_t *ent, int event, int eventParm) {
 	}
 
 	ent->eventTime = level.time;
+	// make sure the event gets cleared again
+	G_ActivateEntity(ent);
 }
 
 /*
@@ -939,7 +939,7 @@ static void KamikazeDamage(gentity_t *self) {
 		return;
 	}
 
-	self->nextthink = level.time + 100;
+	G_SetNextThink(self, level.time + 100);
 	// add earth quake effect
 	newangles[0] = crandom() * 2;
 	newangles[1] = crandom() * 2;
@@ -994,11 +994,11 @@ void G_StartKamikaze(gentity_t *ent) {
 	SnapVector(snapped); // save network bandwidth
 	G_SetOrigin(explosion, snapped);
 
-	explosion->classname = "kamikaze";
+	G_SetClassname(explosion, "kamikaze");
 	explosion->s.pos.trType = TR_STATIONARY;
 	explosion->kamikazeTime = level.time;
 	explosion->think = KamikazeDamage;
-	explosion->nextthink = level.time + 100;
+	G_SetNextThink(explosion, level.time + 100);
 	explosion->count = 0;
 
 	VectorClear(explosion->movedir);
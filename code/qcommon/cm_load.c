@@ -605,7 +605,7 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	}
 	// load the file
 #ifndef BSPC
-	length = FS_ReadFile(name, &buf.v);
+	length = FS_MapFile(name, &buf.v);
 #else
 	length = LoadQuakeFile((quakefile_t *)name, &buf.v);
 #endif
@@ -640,7 +640,11 @@ void CM_LoadMap(const char *name, qboolean clientload, int *checksum) {
 	CMod_LoadVisibility(&header.lumps[LUMP_VISIBILITY]);
 	CMod_LoadPatches(&header.lumps[LUMP_SURFACES], &header.lumps[LUMP_DRAWVERTS]);
 	// we are NOT freeing the file, because it is cached for the ref
+#ifndef BSPC
+	FS_FreeMappedFile(buf.v);
+#else
 	FS_FreeFile(buf.v);
+#endif
 
 	CM_InitBoxHull();
 	CM_FloodAreaConnections();
@@ -29,11 +29,16 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include "q_shared.h"
 #include "qcommon.h"
 
+#if idx64 || defined(__SSE2__)
+#include <emmintrin.h>
+#define CBUF_SSE2
+#endif
+
 #define MAX_CMD_BUFFER 131072
 #define MAX_CMD_LINE 1024
 
 typedef struct {
-	byte *data;
+	byte *data; // start of the pending text, advances through cmd_text_buf as commands are executed
 	int maxsize;
 	int cursize;
 } cmd_t;
@@ -83,6 +88,70 @@ void Cbuf_Init(void) {
 	cmd_text.cursize = 0;
 }
 
+/*
+=======================================================================================================================================
+Cbuf_Rewind
+
+Moves the pending text back to the start of the buffer.
+=======================================================================================================================================
+*/
+static void Cbuf_Rewind(void) {
+
+	if (cmd_text.data != cmd_text_buf) {
+		memmove(cmd_text_buf, cmd_text.data, cmd_text.cursize);
+		cmd_text.data = cmd_text_buf;
+	}
+}
+
+/*
+=======================================================================================================================================
+Cbuf_FindSpecial
+
+Returns the index of the first character at or after start that can end a command or change the quote or comment state, or end if
+there is none.
+=======================================================================================================================================
+*/
+static int Cbuf_FindSpecial(const char *text, int start, int end) {
+	int i, c;
+#ifdef CBUF_SSE2
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i semicolon = _mm_set1_epi8(';');
+	const __m128i newline = _mm_set1_epi8('\n');
+	const __m128i carriageReturn = _mm_set1_epi8('\r');
+	const __m128i slash = _mm_set1_epi8('/');
+	const __m128i star = _mm_set1_epi8('*');
+	__m128i chars, match;
+	int mask;
+
+	for (i = start; i + 16 <= end; i += 16) {
+		chars = _mm_loadu_si128((const __m128i *)(text + i));
+		match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, semicolon)), _mm_or_si128(_mm_cmpeq_epi8(chars, newline), _mm_cmpeq_epi8(chars, carriageReturn)));
+		match = _mm_or_si128(match, _mm_or_si128(_mm_cmpeq_epi8(chars, slash), _mm_cmpeq_epi8(chars, star)));
+		mask = _mm_movemask_epi8(match);
+
+		if (mask) {
+			while (!(mask & 1)) {
+				mask >>= 1;
+				i++;
+			}
+
+			return i;
+		}
+	}
+
+	start = i;
+#endif
+	for (i = start; i < end; i++) {
+		c = text[i];
+
+		if (c == '"' || c == ';' || c == '\n' || c == '\r' || c == '/' || c == '*') {
+			break;
+		}
+	}
+
+	return i;
+}
+
 /*
 =======================================================================================================================================
 Cbuf_AddText
@@ -100,6 +169,10 @@ void Cbuf_AddText(const char *text) {
 		return;
 	}
 
+	if ((cmd_text.data - cmd_text_buf) + cmd_text.cursize + l >= cmd_text.maxsize) {
+		Cbuf_Rewind();
+	}
+
 	Com_Memcpy(&cmd_text.data[cmd_text.cursize], text, l);
 
 	cmd_text.cursize += l;
@@ -115,7 +188,6 @@ Adds a \n to the text.
 */
 void Cbuf_InsertText(const char *text) {
 	int len;
-	int i;
 
 	len = strlen(text) + 1;
 
@@ -123,9 +195,12 @@ void Cbuf_InsertText(const char *text) {
 		Com_Printf("Cbuf_InsertText overflowed\n");
 		return;
 	}
-	// move the existing command text
-	for (i = cmd_text.cursize - 1; i >= 0; i--) {
-		cmd_text.data[i + len] = cmd_text.data[i];
+	// use the space left by executed commands if there is enough, otherwise move the existing command text
+	if (cmd_text.data - cmd_text_buf >= len) {
+		cmd_text.data -= len;
+	} else {
+		memmove(cmd_text_buf + len, cmd_text.data, cmd_text.cursize);
+		cmd_text.data = cmd_text_buf;
 	}
 	// copy the new text in
 	Com_Memcpy(cmd_text.data, text, len - 1);
@@ -204,7 +279,8 @@ void Cbuf_Execute(void) {
 		text = (char *)cmd_text.data;
 		quotes = 0;
 
-		for (i = 0; i < cmd_text.cursize; i++) {
+		// only the characters found by Cbuf_FindSpecial can change the state below, skip everything else
+		for (i = Cbuf_FindSpecial(text, 0, cmd_text.cursize); i < cmd_text.cursize; i = Cbuf_FindSpecial(text, i + 1, cmd_text.cursize)) {
 			if (text[i] == '"') {
 				quotes++;
 			}
@@ -242,15 +318,15 @@ void Cbuf_Execute(void) {
 		Com_Memcpy(line, text, i);
 
 		line[i] = 0;
-		// delete the text from the command buffer and move remaining commands down this is necessary because commands (exec) can
-		// insert data at the beginning of the text buffer
+		// delete the text from the command buffer before executing it because commands (exec) can insert data at the beginning of the
+		// text buffer, the remaining commands are only moved down when the buffer fills up
 		if (i == cmd_text.cursize) {
+			cmd_text.data = cmd_text_buf;
 			cmd_text.cursize = 0;
 		} else {
 			i++;
+			cmd_text.data += i;
 			cmd_text.cursize -= i;
-
-			memmove(text, text + i, cmd_text.cursize);
 		}
 		// execute the command line
 		Cmd_ExecuteString(line);
@@ -344,6 +420,7 @@ void Cmd_Echo_f(void) {
 
 typedef struct cmd_function_s {
 	struct cmd_function_s *next;
+	struct cmd_function_s *hashNext;
 	char *name;
 	xcommand_t function;
 	completionFunc_t complete;
@@ -355,6 +432,9 @@ static char cmd_tokenized[BIG_INFO_STRING + MAX_STRING_TOKENS]; // will have 0 b
 static char cmd_cmd[BIG_INFO_STRING]; // the original command we received (no token processing)
 static cmd_function_t *cmd_functions; // possible commands to execute
 
+#define CMD_HASH_SIZE 512
+static cmd_function_t *cmd_hashTable[CMD_HASH_SIZE];
+
 /*
 =======================================================================================================================================
 Cmd_Argc
@@ -505,6 +585,7 @@ appropriate place. The argv array will point into this temporary buffer.
 static void Cmd_TokenizeString2(const char *text_in, qboolean ignoreQuotes) {
 	const char *text;
 	char *textOut;
+	size_t len;
 #ifdef TKN_DBG
 	// FIXME: blunt hook to try to find the tokenization of userinfo
 	Com_DPrintf("Cmd_TokenizeString: %s\n", text_in);
@@ -516,8 +597,16 @@ static void Cmd_TokenizeString2(const char *text_in, qboolean ignoreQuotes) {
 		return;
 	}
 
-	Q_strncpyz(cmd_cmd, text_in, sizeof(cmd_cmd));
+	// Q_strncpyz would zero fill the whole buffer on every command
+	len = strlen(text_in);
+
+	if (len >= sizeof(cmd_cmd)) {
+		len = sizeof(cmd_cmd) - 1;
+	}
+
+	Com_Memcpy(cmd_cmd, text_in, len);
 
+	cmd_cmd[len] = 0;
 	text = text_in;
 	textOut = cmd_tokenized;
 
@@ -620,6 +709,15 @@ void Cmd_TokenizeStringIgnoreQuotes(const char *text_in) {
 	Cmd_TokenizeString2(text_in, qtrue);
 }
 
+/*
+=======================================================================================================================================
+Cmd_HashName
+=======================================================================================================================================
+*/
+static unsigned int Cmd_HashName(const char *name) {
+	return Com_HashName(name) & (CMD_HASH_SIZE - 1);
+}
+
 /*
 =======================================================================================================================================
 Cmd_FindCommand
@@ -628,7 +726,7 @@ Cmd_FindCommand
 cmd_function_t *Cmd_FindCommand(const char *cmd_name) {
 	cmd_function_t *cmd;
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next) {
+	for (cmd = cmd_hashTable[Cmd_HashName(cmd_name)]; cmd; cmd = cmd->hashNext) {
 		if (!Q_stricmp(cmd_name, cmd->name)) {
 			return cmd;
 		}
@@ -644,6 +742,7 @@ Cmd_AddCommand
 */
 void Cmd_AddCommand(const char *cmd_name, xcommand_t function) {
 	cmd_function_t *cmd;
+	unsigned int hash;
 
 	// fail if the command already exists
 	if (Cmd_FindCommand(cmd_name)) {
@@ -661,6 +760,10 @@ void Cmd_AddCommand(const char *cmd_name, xcommand_t function) {
 	cmd->complete = NULL;
 	cmd->next = cmd_functions;
 	cmd_functions = cmd;
+
+	hash = Cmd_HashName(cmd_name);
+	cmd->hashNext = cmd_hashTable[hash];
+	cmd_hashTable[hash] = cmd;
 }
 
 /*
@@ -671,11 +774,10 @@ Cmd_SetCommandCompletionFunc
 void Cmd_SetCommandCompletionFunc(const char *command, completionFunc_t complete) {
 	cmd_function_t *cmd;
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next) {
-		if (!Q_stricmp(command, cmd->name)) {
-			cmd->complete = complete;
-			return;
-		}
+	cmd = Cmd_FindCommand(command);
+
+	if (cmd) {
+		cmd->complete = complete;
 	}
 }
 
@@ -699,6 +801,14 @@ void Cmd_RemoveCommand(const char *cmd_name) {
 
 		if (!strcmp(cmd_name, cmd->name)) {
 			*back = cmd->next;
+			// unlink it from its hash chain as well
+			back = &cmd_hashTable[Cmd_HashName(cmd_name)];
+
+			while (*back != cmd) {
+				back = &(*back)->hashNext;
+			}
+
+			*back = cmd->hashNext;
 
 			Z_Free(cmd->name);
 			Z_Free(cmd);
@@ -752,14 +862,10 @@ Cmd_CompleteArgument
 void Cmd_CompleteArgument(const char *command, char *args, int argNum) {
 	cmd_function_t *cmd;
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next) {
-		if (!Q_stricmp(command, cmd->name)) {
-			if (cmd->complete) {
-				cmd->complete(args, argNum);
-			}
+	cmd = Cmd_FindCommand(command);
 
-			return;
-		}
+	if (cmd && cmd->complete) {
+		cmd->complete(args, argNum);
 	}
 }
 
@@ -771,7 +877,7 @@ A complete command line has been parsed, so try to execute it.
 =======================================================================================================================================
 */
 void Cmd_ExecuteString(const char *text) {
-	cmd_function_t *cmd, **prev;
+	cmd_function_t *cmd;
 
 	// execute the command line
 	Cmd_TokenizeString(text);
@@ -780,24 +886,11 @@ void Cmd_ExecuteString(const char *text) {
 		return; // no tokens
 	}
 	// check registered command functions
-	for (prev = &cmd_functions; *prev; prev = &cmd->next) {
-		cmd = *prev;
-
-		if (!Q_stricmp(cmd_argv[0], cmd->name)) {
-			// rearrange the links so that the command will be near the head of the list next time it is used
-			*prev = cmd->next;
-			cmd->next = cmd_functions;
-			cmd_functions = cmd;
-			// perform the action
-			if (!cmd->function) {
-				// let the cgame or game handle it
-				break;
-			} else {
-				cmd->function();
-			}
-
-			return;
-		}
+	cmd = Cmd_FindCommand(cmd_argv[0]);
+	// commands without a function are handled by the cgame or game
+	if (cmd && cmd->function) {
+		cmd->function();
+		return;
 	}
 	// check cvars
 	if (Cvar_Command()) {
@@ -852,6 +945,91 @@ void Cmd_List_f(void) {
 	Com_Printf("%i commands\n", i);
 }
 
+/*
+=======================================================================================================================================
+Cmd_BenchmarkNop_f
+=======================================================================================================================================
+*/
+static int cmd_benchArgs;
+
+static void Cmd_BenchmarkNop_f(void) {
+	cmd_benchArgs += Cmd_Argc();
+}
+
+/*
+=======================================================================================================================================
+Cmd_Benchmark_f
+
+Pushes a mix of plain, quoted, commented and cvar commands through the command buffer like a burst of rcon commands would.
+=======================================================================================================================================
+*/
+static void Cmd_Benchmark_f(void) {
+	static const char *lines[] = {
+		"cmdbench_nop a b c;",
+		"cmdbench_nop \"quoted; argument\" 42;",
+		"cmdbench_var 1;",
+		"cmdbench_nop x // comment; not a separator\n",
+		"/* block; comment */ cmdbench_nop y;",
+		"set cmdbench_var 2\n"
+	};
+	byte *saved;
+	char *chunk;
+	int savedSize, count, i, len, chunkSize, start, msec;
+
+	count = Cmd_Argc() > 1 ? atoi(Cmd_Argv(1)) : 100000;
+
+	if (count <= 0) {
+		Com_Printf("Usage: cmdbench [commands]\n");
+		return;
+	}
+	// we are running from inside Cbuf_Execute, keep the rest of its buffer away from the benchmark
+	savedSize = cmd_text.cursize;
+	saved = Z_Malloc(savedSize + 1);
+	Com_Memcpy(saved, cmd_text.data, savedSize);
+	Cbuf_Init();
+
+	chunk = Z_Malloc(MAX_CMD_BUFFER / 2);
+
+	Cmd_AddCommand("cmdbench_nop", Cmd_BenchmarkNop_f);
+	Cmd_ExecuteString("set cmdbench_var 0");
+
+	cmd_benchArgs = 0;
+	start = Sys_Milliseconds();
+
+	for (i = 0; i < count;) {
+		chunkSize = 0;
+
+		for (; i < count; i++) {
+			len = strlen(lines[i % ARRAY_LEN(lines)]);
+
+			if (chunkSize + len >= MAX_CMD_BUFFER / 2) {
+				break;
+			}
+
+			Com_Memcpy(chunk + chunkSize, lines[i % ARRAY_LEN(lines)], len);
+			chunkSize += len;
+		}
+
+		chunk[chunkSize] = 0;
+
+		Cbuf_AddText(chunk);
+		Cbuf_Execute();
+	}
+
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("%i commands, %i nop arguments: %i msec, %.1f ns per command\n", count, cmd_benchArgs, msec, msec * 1000000.0 / count);
+
+	Cmd_ExecuteString("unset cmdbench_var");
+	Cmd_RemoveCommand("cmdbench_nop");
+	Z_Free(chunk);
+
+	Cbuf_Init();
+	Com_Memcpy(cmd_text.data, saved, savedSize);
+	cmd_text.cursize = savedSize;
+	Z_Free(saved);
+}
+
 /*
 =======================================================================================================================================
 Cmd_CompleteCfgName
@@ -880,4 +1058,5 @@ void Cmd_Init(void) {
 	Cmd_SetCommandCompletionFunc("vstr", Cvar_CompleteCvarName);
 	Cmd_AddCommand("echo", Cmd_Echo_f);
 	Cmd_AddCommand("wait", Cmd_Wait_f);
+	Cmd_AddCommand("cmdbench", Cmd_Benchmark_f);
 }
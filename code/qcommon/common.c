@@ -212,6 +212,8 @@ void QDECL Com_Printf(const char *fmt, ...) {
 				if (com_logfile->integer > 1) {
 					// force it to not buffer so we get valid data even if we are crashing
 					FS_ForceFlush(logfile);
+				} else {
+					FS_SetAsyncWrite(logfile);
 				}
 			} else {
 				Com_Printf("Opening console.log failed!\n");
@@ -298,6 +300,8 @@ void QDECL Com_Error(int code, const char *fmt, ...) {
 
 	com_gameRestarting = qfalse;
 	com_gameClientRestarting = qfalse;
+	// the error may have aborted a load that was charging hunk memory to a subsystem
+	Hunk_SetSubsystem(HUNK_OTHER);
 
 	if (code == ERR_DISCONNECT || code == ERR_SERVERDISCONNECT) {
 		VM_Forced_Unload_Start();
@@ -734,6 +738,34 @@ int Com_FilterPath(char *filter, char *name, int casesensitive) {
 	return Com_Filter(new_filter, new_name, casesensitive);
 }
 
+/*
+=======================================================================================================================================
+Com_HashName
+
+Returns a case folded hash of a cvar or command name, matching the folding of Q_stricmp. The per character terms don't depend on each
+other so the loop pipelines well, the final mix spreads them over the whole word.
+=======================================================================================================================================
+*/
+unsigned int Com_HashName(const char *name) {
+	unsigned int hash;
+	int c, i;
+
+	hash = 0;
+
+	for (i = 0; (c = ((const unsigned char *)name)[i]) != 0; i++) {
+		if (c >= 'A' && c <= 'Z') {
+			c += 'a' - 'A';
+		}
+
+		hash += c * (i + 119);
+	}
+
+	hash ^= hash >> 16;
+	hash *= 0x45d9f3b;
+	hash ^= hash >> 16;
+	return hash;
+}
+
 /*
 =======================================================================================================================================
 Com_RealTime
@@ -775,11 +807,19 @@ int Com_RealTime(qtime_t *qtime) {
 	The rover can be left pointing at a non-empty block.
 	The zone calls are pretty much only used for small strings and structures, all big things are allocated on the hunk.
 
+	Allocations up to MAX_SLAB_ALLOC bytes don't go through the rover, they get a chunk of a fixed size class from a slab, a zone block
+	of SLAB_SIZE bytes that is cut into equal chunks. Chunks keep the memblock header, so tags work the same for both.
+	All zone calls hold a mutex so they can be used from any thread.
+
 =======================================================================================================================================
 */
 
 #define ZONEID 0x1d4a11
+#define SLABID 0x1d4a12 // id of a chunk in a slab
 #define MINFRAGMENT 64
+#define SLAB_SIZE 0x4000
+#define MAX_SLAB_ALLOC 512
+#define NUM_SLAB_CLASSES 12
 
 typedef struct zonedebug_s {
 	char *label;
@@ -791,8 +831,8 @@ typedef struct zonedebug_s {
 typedef struct memblock_s {
 	int size;	// including the header and possibly tiny fragments
 	int tag;	// a tag of 0 is a free block
-	struct memblock_s *next, *prev;
-	int id;		// should be ZONEID
+	struct memblock_s *next, *prev; // a free chunk in a slab uses next for the free list, prev always points to the slab
+	int id;		// should be ZONEID or SLABID
 #ifdef ZONE_DEBUG
 	zonedebug_t d;
 #endif
@@ -804,10 +844,35 @@ typedef struct {
 	memblock_t blocklist;	// start/end cap for linked list
 	memblock_t *rover;
 } memzone_t;
+
+typedef struct zoneSlab_s {
+	struct zoneSlab_s *next, *prev;	// slabs of the same size class
+	memblock_t *freeChunks;
+	int sizeClass;
+	int numChunks;
+	int numUsed;
+} zoneSlab_t;
+
+typedef struct {
+	int chunkSize;		// including the header and the memory trash tester
+	zoneSlab_t *partial;	// slabs with free chunks
+	zoneSlab_t *full;
+	int numSlabs;
+} zoneSlabClass_t;
 // main zone for all "dynamic" memory allocation
 static memzone_t *mainzone;
 // we also have a small zone for small allocations that would only fragment the main zone (think of cvar and cmd strings)
 static memzone_t *smallzone;
+// largest allocation of each size class
+static const int slabAllocSizes[NUM_SLAB_CLASSES] = {8, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, MAX_SLAB_ALLOC};
+static zoneSlabClass_t slabClasses[NUM_SLAB_CLASSES];
+static byte slabClassForSize[MAX_SLAB_ALLOC / 8 + 1];
+// the slab header is followed by the chunks
+#define SLAB_HEADER_SIZE PAD(sizeof(zoneSlab_t), 16)
+#define SLAB_CHUNK(slab, num) ((memblock_t *)((byte *)(slab) + SLAB_HEADER_SIZE + (num) * slabClasses[(slab)->sizeClass].chunkSize))
+
+static void *zoneMutex;
+static qboolean zoneNoSlabs; // only set by the benchmark
 
 static void Z_CheckHeap(void);
 
@@ -834,6 +899,53 @@ static void Z_ClearZone(memzone_t *zone, int size) {
 	block->size = size - sizeof(memzone_t);
 }
 
+/*
+=======================================================================================================================================
+Z_InitSlabClasses
+=======================================================================================================================================
+*/
+static void Z_InitSlabClasses(void) {
+	int i, size;
+
+	Com_Memset(slabClasses, 0, sizeof(slabClasses));
+
+	for (i = 0; i < NUM_SLAB_CLASSES; i++) {
+		slabClasses[i].chunkSize = PAD(sizeof(memblock_t) + slabAllocSizes[i] + 4, sizeof(intptr_t));
+	}
+
+	for (i = 0, size = 0; size <= MAX_SLAB_ALLOC; size += 8) {
+		if (size > slabAllocSizes[i]) {
+			i++;
+		}
+
+		slabClassForSize[size / 8] = i;
+	}
+}
+
+/*
+=======================================================================================================================================
+Z_Lock
+=======================================================================================================================================
+*/
+static void Z_Lock(void) {
+
+	if (zoneMutex) {
+		Sys_LockMutex(zoneMutex);
+	}
+}
+
+/*
+=======================================================================================================================================
+Z_Unlock
+=======================================================================================================================================
+*/
+static void Z_Unlock(void) {
+
+	if (zoneMutex) {
+		Sys_UnlockMutex(zoneMutex);
+	}
+}
+
 /*
 =======================================================================================================================================
 Z_AvailableZoneMemory
@@ -854,35 +966,15 @@ int Z_AvailableMemory(void) {
 
 /*
 =======================================================================================================================================
-Z_Free
+Z_ZoneFree
+
+Returns a block to its zone and merges it with free neighbors.
 =======================================================================================================================================
 */
-void Z_Free(void *ptr) {
-	memblock_t *block, *other;
+static void Z_ZoneFree(memblock_t *block) {
+	memblock_t *other;
 	memzone_t *zone;
 
-	if (!ptr) {
-		Com_Error(ERR_DROP, "Z_Free: NULL pointer");
-	}
-
-	block = (memblock_t *)((byte *)ptr - sizeof(memblock_t));
-
-	if (block->id != ZONEID) {
-		Com_Error(ERR_FATAL, "Z_Free: freed a pointer without ZONEID");
-	}
-
-	if (block->tag == 0) {
-		Com_Error(ERR_FATAL, "Z_Free: freed a freed pointer");
-	}
-	// if static memory
-	if (block->tag == TAG_STATIC) {
-		return;
-	}
-	// check the memory trash tester
-	if (*(int *)((byte *)block + block->size - 4) != ZONEID) {
-		Com_Error(ERR_FATAL, "Z_Free: memory block wrote past end");
-	}
-
 	if (block->tag == TAG_SMALL) {
 		zone = smallzone;
 	} else {
@@ -892,7 +984,7 @@ void Z_Free(void *ptr) {
 	zone->used -= block->size;
 	// set the block to something that should cause problems
 	// if it is referenced...
-	Com_Memset(ptr, 0xaa, block->size - sizeof(*block));
+	Com_Memset(block + 1, 0xaa, block->size - sizeof(*block));
 
 	block->tag = 0; // mark as free
 	other = block->prev;
@@ -921,6 +1013,277 @@ void Z_Free(void *ptr) {
 	}
 }
 
+/*
+=======================================================================================================================================
+Z_ZoneAlloc
+
+First fit search from the rover, returns the block header.
+=======================================================================================================================================
+*/
+static memblock_t *Z_ZoneAlloc(memzone_t *zone, int size, int tag) {
+	int extra;
+	memblock_t *start, *rover, *new, *base;
+
+	// scan through the block list looking for the first free block of sufficient size
+	size += sizeof(memblock_t); // account for size of block header
+	size += 4; // space for memory trash tester
+	size = PAD(size, sizeof(intptr_t)); // align to 32/64 bit boundary
+	base = rover = zone->rover;
+	start = base->prev;
+
+	do {
+		if (rover == start) {
+			// scaned all the way around the list
+			return NULL;
+		}
+
+		if (rover->tag) {
+			base = rover = rover->next;
+		} else {
+			rover = rover->next;
+		}
+	} while (base->tag || base->size < size);
+	// found a block big enough
+	extra = base->size - size;
+
+	if (extra > MINFRAGMENT) {
+		// there will be a free fragment after the allocated block
+		new = (memblock_t *)((byte *)base + size);
+		new->size = extra;
+		new->tag = 0; // free block
+		new->prev = base;
+		new->id = ZONEID;
+		new->next = base->next;
+		new->next->prev = new;
+		base->next = new;
+		base->size = size;
+	}
+
+	base->tag = tag; // no longer a free block
+
+	zone->rover = base->next; // next allocation will start looking here
+	zone->used += base->size;
+
+	base->id = ZONEID;
+	// marker for memory trash testing
+	*(int *)((byte *)base + base->size - 4) = ZONEID;
+
+	return base;
+}
+
+/*
+=======================================================================================================================================
+Z_SlabAlloc
+
+Returns the header of a chunk from the size class, a new slab is taken from the main zone when all slabs of the class are full.
+=======================================================================================================================================
+*/
+static memblock_t *Z_SlabAlloc(int sizeClass, int tag) {
+	zoneSlabClass_t *slabClass;
+	zoneSlab_t *slab;
+	memblock_t *block;
+	int i;
+
+	slabClass = &slabClasses[sizeClass];
+	slab = slabClass->partial;
+
+	if (!slab) {
+		block = Z_ZoneAlloc(mainzone, SLAB_SIZE - sizeof(memblock_t) - 4, TAG_SLAB);
+
+		if (!block) {
+			return NULL;
+		}
+
+#ifdef ZONE_DEBUG
+		block->d.label = "slab";
+		block->d.file = __FILE__;
+		block->d.line = __LINE__;
+		block->d.allocSize = SLAB_SIZE - sizeof(memblock_t) - 4;
+#endif
+		slab = (zoneSlab_t *)(block + 1);
+		slab->next = slab->prev = NULL;
+		slab->sizeClass = sizeClass;
+		slab->numChunks = (SLAB_SIZE - sizeof(memblock_t) - 4 - SLAB_HEADER_SIZE) / slabClass->chunkSize;
+		slab->numUsed = 0;
+		slab->freeChunks = NULL;
+		// the lowest chunk is handed out first
+		for (i = slab->numChunks - 1; i >= 0; i--) {
+			block = SLAB_CHUNK(slab, i);
+			block->size = slabClass->chunkSize;
+			block->tag = 0;
+			block->id = SLABID;
+			block->prev = (memblock_t *)slab;
+			block->next = slab->freeChunks;
+			slab->freeChunks = block;
+		}
+
+		slabClass->partial = slab;
+		slabClass->numSlabs++;
+	}
+
+	block = slab->freeChunks;
+	slab->freeChunks = block->next;
+	slab->numUsed++;
+
+	if (!slab->freeChunks) {
+		// move it to the full list
+		slabClass->partial = slab->next;
+
+		if (slab->next) {
+			slab->next->prev = NULL;
+		}
+
+		slab->prev = NULL;
+		slab->next = slabClass->full;
+
+		if (slabClass->full) {
+			slabClass->full->prev = slab;
+		}
+
+		slabClass->full = slab;
+	}
+
+	block->tag = tag;
+	block->next = NULL;
+	// marker for memory trash testing
+	*(int *)((byte *)block + block->size - 4) = ZONEID;
+
+	return block;
+}
+
+/*
+=======================================================================================================================================
+Z_UnlinkSlab
+=======================================================================================================================================
+*/
+static void Z_UnlinkSlab(zoneSlab_t **list, zoneSlab_t *slab) {
+
+	if (slab->prev) {
+		slab->prev->next = slab->next;
+	} else {
+		*list = slab->next;
+	}
+
+	if (slab->next) {
+		slab->next->prev = slab->prev;
+	}
+
+	slab->next = slab->prev = NULL;
+}
+
+/*
+=======================================================================================================================================
+Z_SlabFree
+
+Returns qtrue if the slab was empty and given back to the main zone.
+=======================================================================================================================================
+*/
+static qboolean Z_SlabFree(memblock_t *block) {
+	zoneSlabClass_t *slabClass;
+	zoneSlab_t *slab;
+
+	slab = (zoneSlab_t *)block->prev;
+	slabClass = &slabClasses[slab->sizeClass];
+
+	Com_Memset(block + 1, 0xaa, block->size - sizeof(*block));
+
+	block->tag = 0;
+
+	if (!slab->freeChunks) {
+		// it was full
+		Z_UnlinkSlab(&slabClass->full, slab);
+
+		slab->next = slabClass->partial;
+
+		if (slabClass->partial) {
+			slabClass->partial->prev = slab;
+		}
+
+		slabClass->partial = slab;
+	}
+
+	block->next = slab->freeChunks;
+	slab->freeChunks = block;
+	slab->numUsed--;
+	// keep one slab per class around so an allocation and free in a loop doesn't hit the zone every time
+	if (slab->numUsed || (slabClass->partial == slab && !slab->next)) {
+		return qfalse;
+	}
+
+	Z_UnlinkSlab(&slabClass->partial, slab);
+	slabClass->numSlabs--;
+	Z_ZoneFree((memblock_t *)slab - 1);
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+Z_Free
+=======================================================================================================================================
+*/
+void Z_Free(void *ptr) {
+	memblock_t *block;
+
+	if (!ptr) {
+		Com_Error(ERR_DROP, "Z_Free: NULL pointer");
+	}
+
+	block = (memblock_t *)((byte *)ptr - sizeof(memblock_t));
+	// another thread may free at the same time, and merging a neighbor rewrites this header, so only read it under the lock
+	Z_Lock();
+
+	if (block->id != ZONEID && block->id != SLABID) {
+		Z_Unlock();
+		Com_Error(ERR_FATAL, "Z_Free: freed a pointer without ZONEID");
+	}
+
+	if (block->tag == 0) {
+		Z_Unlock();
+		Com_Error(ERR_FATAL, "Z_Free: freed a freed pointer");
+	}
+	// if static memory
+	if (block->tag == TAG_STATIC) {
+		Z_Unlock();
+		return;
+	}
+	// check the memory trash tester
+	if (*(int *)((byte *)block + block->size - 4) != ZONEID) {
+		Z_Unlock();
+		Com_Error(ERR_FATAL, "Z_Free: memory block wrote past end");
+	}
+
+	if (block->id == SLABID) {
+		Z_SlabFree(block);
+	} else {
+		Z_ZoneFree(block);
+	}
+
+	Z_Unlock();
+}
+
+/*
+=======================================================================================================================================
+Z_FreeSlabTags
+=======================================================================================================================================
+*/
+static void Z_FreeSlabTags(zoneSlab_t *slab, int tag) {
+	zoneSlab_t *next;
+	memblock_t *block;
+	int i;
+
+	for (; slab; slab = next) {
+		next = slab->next;
+
+		for (i = 0; i < slab->numChunks; i++) {
+			block = SLAB_CHUNK(slab, i);
+
+			if (block->tag == tag && Z_SlabFree(block)) {
+				break; // the slab is gone
+			}
+		}
+	}
+}
+
 /*
 =======================================================================================================================================
 Z_FreeTags
@@ -928,23 +1291,33 @@ Z_FreeTags
 */
 void Z_FreeTags(int tag) {
 	memzone_t *zone;
+	int i;
+
+	Z_Lock();
+
+	for (i = 0; i < NUM_SLAB_CLASSES; i++) {
+		Z_FreeSlabTags(slabClasses[i].full, tag);
+		Z_FreeSlabTags(slabClasses[i].partial, tag);
+	}
 
 	if (tag == TAG_SMALL) {
 		zone = smallzone;
 	} else {
 		zone = mainzone;
 	}
-	// use the rover as our pointer, because Z_Free automatically adjusts it
+	// use the rover as our pointer, because Z_ZoneFree automatically adjusts it
 	zone->rover = zone->blocklist.next;
 
 	do {
 		if (zone->rover->tag == tag) {
-			Z_Free((void *)(zone->rover + 1));
+			Z_ZoneFree(zone->rover);
 			continue;
 		}
 
 		zone->rover = zone->rover->next;
 	} while (zone->rover != &zone->blocklist);
+
+	Z_Unlock();
 }
 
 /*
@@ -954,12 +1327,10 @@ Z_TagMalloc
 */
 #ifdef ZONE_DEBUG
 void *Z_TagMallocDebug(int size, int tag, char *label, char *file, int line) {
-	int allocSize;
 #else
 void *Z_TagMalloc(int size, int tag) {
 #endif
-	int extra;
-	memblock_t *start, *rover, *new, *base;
+	memblock_t *block;
 	memzone_t *zone;
 
 	if (!tag) {
@@ -971,67 +1342,39 @@ void *Z_TagMalloc(int size, int tag) {
 	} else {
 		zone = mainzone;
 	}
-#ifdef ZONE_DEBUG
-	allocSize = size;
-#endif
-	// scan through the block list looking for the first free block of sufficient size
-	size += sizeof(memblock_t); // account for size of block header
-	size += 4; // space for memory trash tester
-	size = PAD(size, sizeof(intptr_t)); // align to 32/64 bit boundary
-	base = rover = zone->rover;
-	start = base->prev;
 
-	do {
-		if (rover == start) {
-			// scaned all the way around the list
-#ifdef ZONE_DEBUG
-			Z_LogHeap();
+	Z_Lock();
 
-			Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone: %s, line: %d (%s)", size, zone == smallzone ? "small" : "main", file, line, label);
-#else
-			Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone", size, zone == smallzone ? "small" : "main");
-#endif
-			return NULL;
-		}
+	// slabs only serve the main zone, TAG_SMALL keeps using the small zone
+	block = NULL;
 
-		if (rover->tag) {
-			base = rover = rover->next;
-		} else {
-			rover = rover->next;
-		}
-	} while (base->tag || base->size < size);
-	// found a block big enough
-	extra = base->size - size;
-
-	if (extra > MINFRAGMENT) {
-		// there will be a free fragment after the allocated block
-		new = (memblock_t *)((byte *)base + size);
-		new->size = extra;
-		new->tag = 0; // free block
-		new->prev = base;
-		new->id = ZONEID;
-		new->next = base->next;
-		new->next->prev = new;
-		base->next = new;
-		base->size = size;
+	if (zone == mainzone && mainzone && !zoneNoSlabs && size >= 0 && size <= MAX_SLAB_ALLOC) {
+		block = Z_SlabAlloc(slabClassForSize[(size + 7) / 8], tag);
+	}
+	// a fragmented main zone may have no room for a new slab but still fit the block itself
+	if (!block) {
+		block = Z_ZoneAlloc(zone, size, tag);
 	}
 
-	base->tag = tag; // no longer a free block
+	Z_Unlock();
 
-	zone->rover = base->next; // next allocation will start looking here
-	zone->used += base->size;
+	if (!block) {
+#ifdef ZONE_DEBUG
+		Z_LogHeap();
 
-	base->id = ZONEID;
+		Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone: %s, line: %d (%s)", size, zone == smallzone ? "small" : "main", file, line, label);
+#else
+		Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone", size, zone == smallzone ? "small" : "main");
+#endif
+		return NULL;
+	}
 #ifdef ZONE_DEBUG
-	base->d.label = label;
-	base->d.file = file;
-	base->d.line = line;
-	base->d.allocSize = allocSize;
+	block->d.label = label;
+	block->d.file = file;
+	block->d.line = line;
+	block->d.allocSize = size;
 #endif
-	// marker for memory trash testing
-	*(int *)((byte *)base + base->size - 4) = ZONEID;
-
-	return (void *)((byte *)base + sizeof(memblock_t));
+	return (void *)(block + 1);
 }
 
 /*
@@ -1175,6 +1518,120 @@ void Z_LogHeap(void) {
 	Z_LogZoneHeap(smallzone, "SMALL");
 }
 
+#define ZONEBENCH_SLOTS 4096
+#define ZONEBENCH_THREADS 4
+
+typedef struct {
+	int iterations;
+	unsigned int seed;
+} zoneBench_t;
+
+/*
+=======================================================================================================================================
+Z_BenchmarkRun
+
+Allocates and frees a mix of sizes like the engine does, mostly short strings with some structures and a few larger buffers.
+=======================================================================================================================================
+*/
+static void Z_BenchmarkRun(void *data) {
+	zoneBench_t *bench = data;
+	void *slots[ZONEBENCH_SLOTS];
+	unsigned int r;
+	int i, slot, size;
+
+	Com_Memset(slots, 0, sizeof(slots));
+
+	for (i = 0; i < bench->iterations; i++) {
+		bench->seed = bench->seed * 1664525 + 1013904223;
+		r = bench->seed >> 8;
+		slot = r % ZONEBENCH_SLOTS;
+
+		if (slots[slot]) {
+			Z_Free(slots[slot]);
+			slots[slot] = NULL;
+			continue;
+		}
+
+		r >>= 12;
+
+		if ((r & 15) < 11) {
+			size = 8 + (r >> 4) % 56;
+		} else if ((r & 15) < 15) {
+			size = 64 + (r >> 4) % 448;
+		} else {
+			size = 512 + (r >> 4) % 3584;
+		}
+
+		slots[slot] = Z_TagMalloc(size, TAG_GENERAL);
+	}
+
+	for (i = 0; i < ZONEBENCH_SLOTS; i++) {
+		if (slots[i]) {
+			Z_Free(slots[i]);
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+Z_Benchmark_f
+
+Runs the same allocation mix with slabs, without slabs and on several threads at once.
+=======================================================================================================================================
+*/
+static void Z_Benchmark_f(void) {
+	zoneBench_t bench[ZONEBENCH_THREADS];
+	void *threads[ZONEBENCH_THREADS];
+	int i, iterations, start, msec;
+
+	iterations = Cmd_Argc() > 1 ? atoi(Cmd_Argv(1)) : 1000000;
+
+	if (iterations <= 0) {
+		Com_Printf("Usage: zonebench [iterations]\n");
+		return;
+	}
+
+	bench[0].iterations = iterations;
+	bench[0].seed = 1;
+	start = Sys_Milliseconds();
+	Z_BenchmarkRun(&bench[0]);
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("slabs: %i msec, %.1f ns per call\n", msec, msec * 1000000.0 / iterations);
+
+	zoneNoSlabs = qtrue;
+	bench[0].seed = 1;
+	start = Sys_Milliseconds();
+	Z_BenchmarkRun(&bench[0]);
+	msec = Sys_Milliseconds() - start;
+	zoneNoSlabs = qfalse;
+
+	Com_Printf("zone only: %i msec, %.1f ns per call\n", msec, msec * 1000000.0 / iterations);
+
+	start = Sys_Milliseconds();
+
+	for (i = 0; i < ZONEBENCH_THREADS; i++) {
+		bench[i].iterations = iterations;
+		bench[i].seed = i + 1;
+		threads[i] = Sys_CreateThread(Z_BenchmarkRun, &bench[i]);
+
+		if (!threads[i]) {
+			Z_BenchmarkRun(&bench[i]);
+		}
+	}
+
+	for (i = 0; i < ZONEBENCH_THREADS; i++) {
+		if (threads[i]) {
+			Sys_JoinThread(threads[i]);
+		}
+	}
+
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("%i threads: %i msec, %.1f ns per call\n", ZONEBENCH_THREADS, msec, msec * 1000000.0 / (iterations * ZONEBENCH_THREADS));
+	Z_CheckHeap();
+}
+
 // static mem blocks to reduce a lot of small zone overhead
 typedef struct memstatic_s {
 	memblock_t b;
@@ -1279,6 +1736,39 @@ static int s_hunkTotal;
 static int s_zoneTotal;
 static int s_smallZoneTotal;
 
+#define MAX_HUNK_MAP_STATS 32
+
+static const char *hunkSubsystemNames[HUNK_NUM_SUBSYSTEMS] = {
+	"other",
+	"renderer",
+	"cm",
+	"botlib",
+	"vm",
+	"temp"
+};
+
+typedef struct {
+	int bytes;
+	int markBytes;
+	int allocs;
+} hunkSubsystemStats_t;
+
+typedef struct {
+	char mapname[MAX_QPATH];
+	int lowPeak;
+	int highPeak;
+	int totalPeak;
+	int peak[HUNK_NUM_SUBSYSTEMS];
+} hunkMapStats_t;
+
+static hunkSubsystem_t hunk_subsystem;
+static hunkSubsystemStats_t hunk_stats[HUNK_NUM_SUBSYSTEMS];
+static hunkMapStats_t hunk_mapStats[MAX_HUNK_MAP_STATS]; // ring of the last maps played
+static hunkMapStats_t hunk_current; // peaks since the last Hunk_Clear
+static int hunk_numMapStats;
+static qboolean hunk_warned;
+static cvar_t *com_hunkWarn;
+
 /*
 =======================================================================================================================================
 Com_Meminfo_f
@@ -1286,22 +1776,63 @@ Com_Meminfo_f
 */
 void Com_Meminfo_f(void) {
 	memblock_t *block;
+	zoneSlab_t *slab;
 	int zoneBytes, zoneBlocks;
 	int smallZoneBytes;
 	int botlibBytes, rendererBytes;
+	int slabBytes, slabUsed, numSlabs;
 	int unused;
+	int i, j, list;
 
 	zoneBytes = 0;
 	botlibBytes = 0;
 	rendererBytes = 0;
 	zoneBlocks = 0;
+	smallZoneBytes = 0;
+	slabBytes = slabUsed = numSlabs = 0;
+
+	Z_Lock();
+	// slab pages are counted by the tags of their chunks
+	for (i = 0; i < NUM_SLAB_CLASSES; i++) {
+		for (list = 0; list < 2; list++) {
+			for (slab = list ? slabClasses[i].full : slabClasses[i].partial; slab; slab = slab->next) {
+				numSlabs++;
+
+				for (j = 0; j < slab->numChunks; j++) {
+					block = SLAB_CHUNK(slab, j);
+
+					if (!block->tag) {
+						continue;
+					}
+
+					slabUsed += block->size;
+
+					if (block->tag == TAG_SMALL) {
+						smallZoneBytes += block->size;
+						continue;
+					}
+
+					zoneBytes += block->size;
+					zoneBlocks++;
+
+					if (block->tag == TAG_BOTLIB) {
+						botlibBytes += block->size;
+					} else if (block->tag == TAG_RENDERER) {
+						rendererBytes += block->size;
+					}
+				}
+			}
+		}
+	}
 
 	for (block = mainzone->blocklist.next;; block = block->next) {
 		if (Cmd_Argc() != 1) {
 			Com_Printf("block:%p    size:%7i    tag:%3i\n", (void *)block, block->size, block->tag);
 		}
 
-		if (block->tag) {
+		if (block->tag == TAG_SLAB) {
+			slabBytes += block->size;
+		} else if (block->tag) {
 			zoneBytes += block->size;
 			zoneBlocks++;
 
@@ -1329,8 +1860,6 @@ void Com_Meminfo_f(void) {
 		}
 	}
 
-	smallZoneBytes = 0;
-
 	for (block = smallzone->blocklist.next;; block = block->next) {
 		if (block->tag) {
 			smallZoneBytes += block->size;
@@ -1341,6 +1870,8 @@ void Com_Meminfo_f(void) {
 		}
 	}
 
+	Z_Unlock();
+
 	Com_Printf("%8i bytes total hunk\n", s_hunkTotal);
 	Com_Printf("%8i bytes total zone\n", s_zoneTotal);
 	Com_Printf("\n");
@@ -1381,6 +1912,7 @@ void Com_Meminfo_f(void) {
 	Com_Printf("        %8i bytes in dynamic renderer\n", rendererBytes);
 	Com_Printf("        %8i bytes in dynamic other\n", zoneBytes - (botlibBytes + rendererBytes));
 	Com_Printf("        %8i bytes in small Zone memory\n", smallZoneBytes);
+	Com_Printf("%8i bytes in %i slabs, %i used\n", slabBytes, numSlabs, slabUsed);
 }
 
 /*
@@ -1447,6 +1979,13 @@ void Com_InitSmallZoneMemory(void) {
 	}
 
 	Z_ClearZone(smallzone, s_smallZoneTotal);
+	Z_InitSlabClasses();
+
+	zoneMutex = Sys_CreateMutex();
+
+	if (!zoneMutex) {
+		Com_Error(ERR_FATAL, "Zone mutex failed to allocate");
+	}
 }
 
 /*
@@ -1572,6 +2111,197 @@ void Hunk_SmallLog(void) {
 	FS_Write(buf, strlen(buf), logfile);
 }
 
+/*
+=======================================================================================================================================
+Hunk_SetSubsystem
+
+Charges the following permanent hunk allocations to the given subsystem, returns the previous one so it can be restored.
+=======================================================================================================================================
+*/
+hunkSubsystem_t Hunk_SetSubsystem(hunkSubsystem_t subsystem) {
+	hunkSubsystem_t previous;
+
+	previous = hunk_subsystem;
+	hunk_subsystem = subsystem;
+
+	return previous;
+}
+
+/*
+=======================================================================================================================================
+Hunk_Account
+=======================================================================================================================================
+*/
+static void Hunk_Account(hunkSubsystem_t subsystem, int size) {
+	int total;
+
+	hunk_stats[subsystem].bytes += size;
+	hunk_stats[subsystem].allocs++;
+
+	if (hunk_stats[subsystem].bytes > hunk_current.peak[subsystem]) {
+		hunk_current.peak[subsystem] = hunk_stats[subsystem].bytes;
+	}
+	// the temp mark is never below the permanent one on either side
+	if (hunk_low.temp > hunk_current.lowPeak) {
+		hunk_current.lowPeak = hunk_low.temp;
+	}
+
+	if (hunk_high.temp > hunk_current.highPeak) {
+		hunk_current.highPeak = hunk_high.temp;
+	}
+
+	total = hunk_low.temp + hunk_high.temp;
+
+	if (total <= hunk_current.totalPeak) {
+		return;
+	}
+
+	hunk_current.totalPeak = total;
+
+	if (!hunk_warned && com_hunkWarn && com_hunkWarn->integer > 0 && total >= (s_hunkTotal / 100) * com_hunkWarn->integer) {
+		hunk_warned = qtrue;
+		Com_Printf(S_COLOR_YELLOW "WARNING: hunk usage reached %i%% (%i of %i megs), consider raising com_hunkMegs\n", (int)((double)total * 100 / s_hunkTotal), total / (1024 * 1024), s_hunkTotal / (1024 * 1024));
+	}
+}
+
+/*
+=======================================================================================================================================
+Hunk_RecordMapStats
+
+Moves the peaks of the map that is being unloaded into the history.
+=======================================================================================================================================
+*/
+static void Hunk_RecordMapStats(void) {
+	hunkMapStats_t *stats;
+
+	if (!hunk_current.totalPeak) {
+		return;
+	}
+
+	stats = &hunk_mapStats[hunk_numMapStats % MAX_HUNK_MAP_STATS];
+	*stats = hunk_current;
+
+	Q_strncpyz(stats->mapname, Cvar_VariableString("mapname"), sizeof(stats->mapname));
+
+	hunk_numMapStats++;
+}
+
+/*
+=======================================================================================================================================
+Hunk_Stats_f
+=======================================================================================================================================
+*/
+static void Hunk_Stats_f(void) {
+	hunkMapStats_t *stats;
+	int i, j, first;
+
+	Com_Printf("%8i bytes total hunk\n", s_hunkTotal);
+	Com_Printf("%8i low peak\n", hunk_current.lowPeak);
+	Com_Printf("%8i high peak\n", hunk_current.highPeak);
+	Com_Printf("%8i peak in use (%i%%)\n", hunk_current.totalPeak, (int)((double)hunk_current.totalPeak * 100 / s_hunkTotal));
+	Com_Printf("\n");
+	Com_Printf("subsystem   current      peak  allocs\n");
+
+	for (i = 0; i < HUNK_NUM_SUBSYSTEMS; i++) {
+		Com_Printf("%-8s %10i %9i %7i\n", hunkSubsystemNames[i], hunk_stats[i].bytes, hunk_current.peak[i], hunk_stats[i].allocs);
+	}
+
+	if (!hunk_numMapStats) {
+		return;
+	}
+
+	Com_Printf("\n");
+	Com_Printf("map                     peak    %%");
+
+	for (i = 0; i < HUNK_NUM_SUBSYSTEMS; i++) {
+		Com_Printf(" %9s", hunkSubsystemNames[i]);
+	}
+
+	Com_Printf("\n");
+
+	first = hunk_numMapStats > MAX_HUNK_MAP_STATS ? hunk_numMapStats - MAX_HUNK_MAP_STATS : 0;
+
+	for (i = first; i < hunk_numMapStats; i++) {
+		stats = &hunk_mapStats[i % MAX_HUNK_MAP_STATS];
+
+		Com_Printf("%-18s %9i %3i%%", stats->mapname, stats->totalPeak, (int)((double)stats->totalPeak * 100 / s_hunkTotal));
+
+		for (j = 0; j < HUNK_NUM_SUBSYSTEMS; j++) {
+			Com_Printf(" %9i", stats->peak[j]);
+		}
+
+		Com_Printf("\n");
+	}
+}
+
+/*
+=======================================================================================================================================
+Hunk_WriteMapStats
+=======================================================================================================================================
+*/
+static void Hunk_WriteMapStats(fileHandle_t f, const char *mapname, const hunkMapStats_t *stats) {
+	int i;
+
+	FS_Printf(f, "%s,%i,%i,%i,%i", mapname, s_hunkTotal, stats->lowPeak, stats->highPeak, stats->totalPeak);
+
+	for (i = 0; i < HUNK_NUM_SUBSYSTEMS; i++) {
+		FS_Printf(f, ",%i", stats->peak[i]);
+	}
+
+	FS_Printf(f, "\n");
+}
+
+/*
+=======================================================================================================================================
+Hunk_Dump_f
+
+Writes the peaks of the recent maps and the current one as comma separated values.
+=======================================================================================================================================
+*/
+static void Hunk_Dump_f(void) {
+	char filename[MAX_QPATH];
+	fileHandle_t f;
+	int i, first;
+
+	if (Cmd_Argc() > 2) {
+		Com_Printf("usage: hunk_dump [filename]\n");
+		return;
+	}
+
+	if (Cmd_Argc() == 2) {
+		Q_strncpyz(filename, Cmd_Argv(1), sizeof(filename));
+		COM_DefaultExtension(filename, sizeof(filename), ".csv");
+	} else {
+		Q_strncpyz(filename, "hunkstats.csv", sizeof(filename));
+	}
+
+	f = FS_FOpenFileWrite(filename);
+
+	if (!f) {
+		Com_Printf("Couldn't open %s for writing.\n", filename);
+		return;
+	}
+
+	FS_Printf(f, "map,hunk,lowPeak,highPeak,peak");
+
+	for (i = 0; i < HUNK_NUM_SUBSYSTEMS; i++) {
+		FS_Printf(f, ",%s", hunkSubsystemNames[i]);
+	}
+
+	FS_Printf(f, "\n");
+
+	first = hunk_numMapStats > MAX_HUNK_MAP_STATS ? hunk_numMapStats - MAX_HUNK_MAP_STATS : 0;
+
+	for (i = first; i < hunk_numMapStats; i++) {
+		Hunk_WriteMapStats(f, hunk_mapStats[i % MAX_HUNK_MAP_STATS].mapname, &hunk_mapStats[i % MAX_HUNK_MAP_STATS]);
+	}
+
+	Hunk_WriteMapStats(f, Cvar_VariableString("mapname"), &hunk_current);
+
+	FS_FCloseFile(f);
+	Com_Printf("Wrote %s.\n", filename);
+}
+
 /*
 =======================================================================================================================================
 Com_InitHunkMemory
@@ -1616,9 +2346,15 @@ void Com_InitHunkMemory(void) {
 	// cacheline align
 	s_hunkData = (byte *)(((intptr_t)s_hunkData + 31) & ~31);
 
+	com_hunkWarn = Cvar_Get("com_hunkWarn", "90", CVAR_ARCHIVE);
+	Cvar_SetDescription(com_hunkWarn, "Warn when a map uses more than this percentage of the hunk, 0 disables the warning");
+
 	Hunk_Clear();
 
 	Cmd_AddCommand("meminfo", Com_Meminfo_f);
+	Cmd_AddCommand("hunk_stats", Hunk_Stats_f);
+	Cmd_AddCommand("hunk_dump", Hunk_Dump_f);
+	Cmd_AddCommand("zonebench", Z_Benchmark_f);
 #ifdef ZONE_DEBUG
 	Cmd_AddCommand("zonelog", Z_LogHeap);
 #endif
@@ -1650,9 +2386,14 @@ The server calls this after the level and game VM have been loaded.
 =======================================================================================================================================
 */
 void Hunk_SetMark(void) {
+	int i;
 
 	hunk_low.mark = hunk_low.permanent;
 	hunk_high.mark = hunk_high.permanent;
+
+	for (i = 0; i < HUNK_NUM_SUBSYSTEMS; i++) {
+		hunk_stats[i].markBytes = hunk_stats[i].bytes;
+	}
 }
 
 /*
@@ -1663,9 +2404,14 @@ The client calls this before starting a vid_restart or snd_restart.
 =======================================================================================================================================
 */
 void Hunk_ClearToMark(void) {
+	int i;
 
 	hunk_low.permanent = hunk_low.temp = hunk_low.mark;
 	hunk_high.permanent = hunk_high.temp = hunk_high.mark;
+
+	for (i = 0; i < HUNK_NUM_SUBSYSTEMS; i++) {
+		hunk_stats[i].bytes = hunk_stats[i].markBytes;
+	}
 }
 
 /*
@@ -1714,6 +2460,14 @@ void Hunk_Clear(void) {
 	hunk_permanent = &hunk_low;
 	hunk_temp = &hunk_high;
 
+	Hunk_RecordMapStats();
+
+	Com_Memset(hunk_stats, 0, sizeof(hunk_stats));
+	Com_Memset(&hunk_current, 0, sizeof(hunk_current));
+
+	hunk_subsystem = HUNK_OTHER;
+	hunk_warned = qfalse;
+
 	Com_Printf("Hunk_Clear: reset the hunk ok\n");
 	VM_Clear();
 #ifdef HUNK_DEBUG
@@ -1795,6 +2549,7 @@ void *Hunk_Alloc(int size, ha_pref preference) {
 
 	hunk_permanent->temp = hunk_permanent->permanent;
 
+	Hunk_Account(hunk_subsystem, size);
 	Com_Memset(buf, 0, size);
 #ifdef HUNK_DEBUG
 	{
@@ -1852,6 +2607,8 @@ void *Hunk_AllocateTempMemory(int size) {
 		hunk_temp->tempHighwater = hunk_temp->temp;
 	}
 
+	Hunk_Account(HUNK_TEMP, size);
+
 	hdr = (hunkHeader_t *)buf;
 	buf = (void *)(hdr + 1);
 
@@ -1888,12 +2645,14 @@ void Hunk_FreeTempMemory(void *buf) {
 	if (hunk_temp == &hunk_low) {
 		if (hdr == (void *)(s_hunkData + hunk_temp->temp - hdr->size)) {
 			hunk_temp->temp -= hdr->size;
+			hunk_stats[HUNK_TEMP].bytes -= hdr->size;
 		} else {
 			Com_Printf("Hunk_FreeTempMemory: not the final block\n");
 		}
 	} else {
 		if (hdr == (void *)(s_hunkData + s_hunkTotal - hunk_temp->temp)) {
 			hunk_temp->temp -= hdr->size;
+			hunk_stats[HUNK_TEMP].bytes -= hdr->size;
 		} else {
 			Com_Printf("Hunk_FreeTempMemory: not the final block\n");
 		}
@@ -1912,6 +2671,7 @@ void Hunk_ClearTempMemory(void) {
 
 	if (s_hunkData != NULL) {
 		hunk_temp->temp = hunk_temp->permanent;
+		hunk_stats[HUNK_TEMP].bytes = 0;
 	}
 }
 
@@ -0,0 +1,201 @@
+/*
+=======================================================================================================================================
+Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+
+This file is part of Spearmint Source Code.
+
+Spearmint Source Code is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License, or (at your option) any later version.
+
+Spearmint Source Code is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Spearmint Source Code.
+If not, see <http://www.gnu.org/licenses/>.
+
+In addition, Spearmint Source Code is also subject to certain additional terms. You should have received a copy of these additional
+terms immediately following the terms and conditions of the GNU General Public License. If not, please request a copy in writing from
+id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o
+ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+=======================================================================================================================================
+*/
+
+/**************************************************************************************************************************************
+ CRC-32 as used by zip files.
+
+ On x86 CPUs with the carry-less multiply instruction the data is folded 64 bytes at a time as described in Intel's "Fast CRC
+ Computation for Generic Polynomials Using PCLMULQDQ Instruction", everything else goes to the zlib tables.
+**************************************************************************************************************************************/
+
+#include "q_shared.h"
+#include "qcommon.h"
+#ifdef USE_LOCAL_HEADERS
+#include "../zlib/zlib.h"
+#else
+#include <zlib.h>
+#endif
+
+#if (idx64 || id386) && (defined(__GNUC__) || defined(_MSC_VER))
+#define CRC32_PCLMUL
+#endif
+
+#ifdef CRC32_PCLMUL
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define CRC32_TARGET
+#define CRC32_ALIGN(x) __declspec(align(16)) x
+#else
+#include <cpuid.h>
+#define CRC32_TARGET __attribute__((target("sse2,pclmul")))
+#define CRC32_ALIGN(x) x __attribute__((aligned(16)))
+#endif
+// folding constants for the bit reflected polynomial 0xedb88320
+static const CRC32_ALIGN(uint64_t crc32Fold4[2]) = {0x0154442bd4ULL, 0x01c6e41596ULL};	// x^(4*128+32) mod P, x^(4*128-32) mod P
+static const CRC32_ALIGN(uint64_t crc32Fold1[2]) = {0x01751997d0ULL, 0x00ccaa009eULL};	// x^(128+32) mod P, x^(128-32) mod P
+static const CRC32_ALIGN(uint64_t crc32Fold64[2]) = {0x0163cd6124ULL, 0};				// x^64 mod P
+static const CRC32_ALIGN(uint64_t crc32Barrett[2]) = {0x01db710641ULL, 0x01f7011641ULL};	// P and floor(x^64 / P)
+static int crc32Pclmul = -1;
+
+/*
+=======================================================================================================================================
+Crc32_HasPclmul
+=======================================================================================================================================
+*/
+static qboolean Crc32_HasPclmul(void) {
+#ifdef _MSC_VER
+	int regs[4];
+
+	__cpuid(regs, 1);
+	// PCLMULQDQ and SSE2
+	return (regs[2] & (1 << 1)) && (regs[3] & (1 << 26));
+#else
+	unsigned int eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return qfalse;
+	}
+	// PCLMULQDQ and SSE2
+	return (ecx & bit_PCLMUL) && (edx & bit_SSE2);
+#endif
+}
+
+/*
+=======================================================================================================================================
+Crc32_Fold
+
+Length must be at least 64 and a multiple of 16, the crc is passed and returned without the final inversion.
+=======================================================================================================================================
+*/
+static CRC32_TARGET unsigned int Crc32_Fold(unsigned int crc, const byte *buf, size_t len) {
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+	__m128i mask;
+
+	x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+	x0 = _mm_load_si128((const __m128i *)crc32Fold4);
+
+	buf += 64;
+	len -= 64;
+	// fold four 128 bit lanes in parallel
+	while (len >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(buf + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(buf + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(buf + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(buf + 0x30)));
+
+		buf += 64;
+		len -= 64;
+	}
+	// fold the lanes into one
+	x0 = _mm_load_si128((const __m128i *)crc32Fold1);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+	// fold the remaining 16 byte blocks
+	while (len >= 16) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)buf)), x5);
+
+		buf += 16;
+		len -= 16;
+	}
+	// reduce 128 bits to 64
+	mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x0 = _mm_loadl_epi64((const __m128i *)crc32Fold64);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, mask);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	// Barrett reduction to 32 bits
+	x0 = _mm_load_si128((const __m128i *)crc32Barrett);
+	x2 = _mm_and_si128(x1, mask);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, mask);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return _mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+#endif
+
+/*
+=======================================================================================================================================
+Com_Crc32
+
+Updates a running crc with the bytes in buf, start with a crc of 0.
+=======================================================================================================================================
+*/
+unsigned long Com_Crc32(unsigned long crc, const void *buf, size_t len) {
+	const byte *data;
+	size_t block;
+#ifdef CRC32_PCLMUL
+	if (crc32Pclmul == -1) {
+		crc32Pclmul = Crc32_HasPclmul();
+	}
+
+	if (crc32Pclmul && len >= 64) {
+		block = len & ~(size_t)15;
+		crc = ~Crc32_Fold(~(unsigned int)crc, buf, block) & 0xffffffffUL;
+		buf = (const byte *)buf + block;
+		len -= block;
+	}
+#endif
+	data = buf;
+	// zlib takes the length as an unsigned int
+	while (len) {
+		block = len > 0x40000000 ? 0x40000000 : len;
+		crc = crc32(crc, data, (uInt)block);
+		data += block;
+		len -= block;
+	}
+
+	return crc;
+}
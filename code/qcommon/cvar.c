@@ -37,32 +37,71 @@ int cvar_modifiedFlags;
 cvar_t cvar_indexes[MAX_CVARS];
 int cvar_numIndexes;
 
-#define FILE_HASH_SIZE 256
-static cvar_t *hashTable[FILE_HASH_SIZE];
+// open addressing, twice the number of cvars so a probe always ends at an empty slot
+#define CVAR_HASH_SIZE (MAX_CVARS * 2)
+#define CVAR_HASH_DELETED ((cvar_t *)-1)
+
+typedef struct {
+	unsigned int hash;
+	cvar_t *var;
+} cvarHashEntry_t;
+
+static cvarHashEntry_t hashTable[CVAR_HASH_SIZE];
+static int cvar_numHashDeleted;
+
+/*
+=======================================================================================================================================
+Cvar_HashInsert
+=======================================================================================================================================
+*/
+static void Cvar_HashInsert(cvar_t *var) {
+	unsigned int i;
+
+	i = var->hashValue & (CVAR_HASH_SIZE - 1);
+
+	while (hashTable[i].var && hashTable[i].var != CVAR_HASH_DELETED) {
+		i = (i + 1) & (CVAR_HASH_SIZE - 1);
+	}
+
+	if (hashTable[i].var == CVAR_HASH_DELETED) {
+		cvar_numHashDeleted--;
+	}
+
+	hashTable[i].hash = var->hashValue;
+	hashTable[i].var = var;
+}
 
 /*
 =======================================================================================================================================
-generateHashValue
+Cvar_HashRemove
 
-Return a hash value for the filename.
+Leaves a tombstone so probes for cvars behind it keep going, the table is rebuilt once there are too many of them.
 =======================================================================================================================================
 */
-static long generateHashValue(const char *fname) {
-	int i;
-	long hash;
-	char letter;
+static void Cvar_HashRemove(cvar_t *var) {
+	unsigned int i;
+	int index;
 
-	hash = 0;
-	i = 0;
+	for (i = var->hashValue & (CVAR_HASH_SIZE - 1); hashTable[i].var; i = (i + 1) & (CVAR_HASH_SIZE - 1)) {
+		if (hashTable[i].var == var) {
+			hashTable[i].var = CVAR_HASH_DELETED;
+			cvar_numHashDeleted++;
+			break;
+		}
+	}
 
-	while (fname[i] != '\0') {
-		letter = tolower(fname[i]);
-		hash += (long)(letter) * (i + 119);
-		i++;
+	if (cvar_numHashDeleted < CVAR_HASH_SIZE / 4) {
+		return;
 	}
 
-	hash &= (FILE_HASH_SIZE - 1);
-	return hash;
+	Com_Memset(hashTable, 0, sizeof(hashTable));
+	cvar_numHashDeleted = 0;
+
+	for (index = 0; index < cvar_numIndexes; index++) {
+		if (cvar_indexes[index].name && &cvar_indexes[index] != var) {
+			Cvar_HashInsert(&cvar_indexes[index]);
+		}
+	}
 }
 
 /*
@@ -97,18 +136,26 @@ Cvar_FindVar
 =======================================================================================================================================
 */
 static cvar_t *Cvar_FindVar(const char *var_name) {
-	cvar_t *var;
-	long hash;
+	cvarHashEntry_t *entry;
+	unsigned int hash, i;
 
-	hash = generateHashValue(var_name);
+	hash = Com_HashName(var_name);
 
-	for (var = hashTable[hash]; var; var = var->hashNext) {
-		if (!Q_stricmp(var_name, var->name)) {
-			return var;
+	for (i = hash & (CVAR_HASH_SIZE - 1);; i = (i + 1) & (CVAR_HASH_SIZE - 1)) {
+		entry = &hashTable[i];
+
+		if (!entry->var) {
+			return NULL;
 		}
-	}
 
-	return NULL;
+		if (entry->hash != hash || entry->var == CVAR_HASH_DELETED) {
+			continue;
+		}
+		// callers almost always use the registered spelling
+		if (!strcmp(var_name, entry->var->name) || !Q_stricmp(var_name, entry->var->name)) {
+			return entry->var;
+		}
+	}
 }
 
 /*
@@ -319,7 +366,6 @@ If the variable already exists, the value will not be set unless CVAR_ROM. The f
 */
 cvar_t *Cvar_Get(const char *var_name, const char *var_value, int flags) {
 	cvar_t *var;
-	long hash;
 	int index;
 
 	if (!var_name || !var_value) {
@@ -443,16 +489,9 @@ cvar_t *Cvar_Get(const char *var_name, const char *var_value, int flags) {
 	var->flags = flags;
 	// note what types of cvars have been modified (userinfo, archive, serverinfo, systeminfo)
 	cvar_modifiedFlags |= var->flags;
-	hash = generateHashValue(var_name);
-	var->hashIndex = hash;
-	var->hashNext = hashTable[hash];
-
-	if (hashTable[hash]) {
-		hashTable[hash]->hashPrev = var;
-	}
+	var->hashValue = Com_HashName(var_name);
 
-	var->hashPrev = NULL;
-	hashTable[hash] = var;
+	Cvar_HashInsert(var);
 
 	return var;
 }
@@ -1146,15 +1185,7 @@ cvar_t *Cvar_Unset(cvar_t *cv) {
 		cv->next->prev = cv->prev;
 	}
 
-	if (cv->hashPrev) {
-		cv->hashPrev->hashNext = cv->hashNext;
-	} else {
-		hashTable[cv->hashIndex] = cv->hashNext;
-	}
-
-	if (cv->hashNext) {
-		cv->hashNext->hashPrev = cv->hashPrev;
-	}
+	Cvar_HashRemove(cv);
 
 	Com_Memset(cv, '\0', sizeof(*cv));
 
@@ -1417,6 +1448,88 @@ void Cvar_CompleteCvarName(char *args, int argNum) {
 	}
 }
 
+/*
+=======================================================================================================================================
+Cvar_Benchmark_f
+
+Times name lookups of every registered cvar, lookups of missing names and refreshing a vmCvar_t through its handle.
+=======================================================================================================================================
+*/
+static void Cvar_Benchmark_f(void) {
+	const char *names[MAX_CVARS];
+	char missing[16][32];
+	char buffer[MAX_CVAR_VALUE_STRING];
+	vmCvar_t vmCvar;
+	int i, numNames, iterations, start, msec, found;
+
+	iterations = Cmd_Argc() > 1 ? atoi(Cmd_Argv(1)) : 1000000;
+
+	if (iterations <= 0) {
+		Com_Printf("Usage: cvarbench [iterations]\n");
+		return;
+	}
+
+	numNames = 0;
+
+	for (i = 0; i < cvar_numIndexes; i++) {
+		if (cvar_indexes[i].name) {
+			names[numNames++] = cvar_indexes[i].name;
+		}
+	}
+
+	for (i = 0; i < ARRAY_LEN(missing); i++) {
+		Com_sprintf(missing[i], sizeof(missing[i]), "cl_benchMissing%i", i);
+	}
+
+	found = 0;
+	start = Sys_Milliseconds();
+
+	for (i = 0; i < iterations; i++) {
+		if (Cvar_FindVar(names[i % numNames])) {
+			found++;
+		}
+	}
+
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("%i cvars, %i found: %i msec, %.1f ns per lookup\n", numNames, found, msec, msec * 1000000.0 / iterations);
+
+	found = 0;
+	start = Sys_Milliseconds();
+
+	for (i = 0; i < iterations; i++) {
+		if (Cvar_FindVar(missing[i & 15])) {
+			found++;
+		}
+	}
+
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("missing: %i msec, %.1f ns per lookup\n", msec, msec * 1000000.0 / iterations);
+
+	start = Sys_Milliseconds();
+
+	for (i = 0; i < iterations; i++) {
+		Cvar_VariableStringBuffer("sv_cheats", buffer, sizeof(buffer));
+	}
+
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("string buffer by name: %i msec, %.1f ns per call\n", msec, msec * 1000000.0 / iterations);
+
+	Cvar_Register(&vmCvar, "sv_cheats", "0", CVAR_ROM|CVAR_SYSTEMINFO);
+	start = Sys_Milliseconds();
+
+	for (i = 0; i < iterations; i++) {
+		vmCvar.modificationCount = -1;
+		Cvar_Update(&vmCvar);
+	}
+
+	msec = Sys_Milliseconds() - start;
+
+	Com_Printf("vmCvar_t by handle: %i msec, %.1f ns per call\n", msec, msec * 1000000.0 / iterations);
+}
+
 /*
 =======================================================================================================================================
 Cvar_Init
@@ -1428,6 +1541,7 @@ void Cvar_Init(void) {
 
 	Com_Memset(cvar_indexes, '\0', sizeof(cvar_indexes));
 	Com_Memset(hashTable, '\0', sizeof(hashTable));
+	cvar_numHashDeleted = 0;
 
 	cvar_cheats = Cvar_Get("sv_cheats", "0", CVAR_ROM|CVAR_SYSTEMINFO);
 
@@ -1449,4 +1563,5 @@ void Cvar_Init(void) {
 	Cmd_AddCommand("cvarlist", Cvar_List_f);
 	Cmd_AddCommand("cvar_modified", Cvar_ListModified_f);
 	Cmd_AddCommand("cvar_restart", Cvar_Restart_f);
+	Cmd_AddCommand("cvarbench", Cvar_Benchmark_f);
 }
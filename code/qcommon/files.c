@@ -166,6 +166,7 @@ static const unsigned int pak_checksums[] = {
 #define MAX_ZPATH 256
 #define MAX_SEARCH_PATHS 4096
 #define MAX_FILEHASH_SIZE 1024
+#define MAX_FOUND_FILES 0x1000
 
 typedef struct fileInPack_s {
 	char *name;					// name of the file
@@ -199,7 +200,25 @@ typedef struct searchpath_s {
 	struct searchpath_s *next;
 	pack_t *pack; // only one of pack/dir will be non NULL
 	directory_t *dir;
+	int order;				// position in the search order, set when the file index is built
+	qboolean unindexed;		// directory that isn't in the file index and is checked on disk for every file
 } searchpath_t;
+// the file index maps file names to all the search paths that contain them, entries with the same name are kept in search order
+typedef struct fileIndexEntry_s {
+	const char *name;					// name of the file relative to the search path
+	searchpath_t *search;				// search path that contains the file
+	unsigned int hash;					// full hash of the name
+	struct fileIndexEntry_s *next;		// next entry in the hash chain
+} fileIndexEntry_t;
+
+#define FILEINDEX_BLOCKSIZE 0x10000
+#define FILEINDEX_MINSIZE 1024
+#define FILEINDEX_MAXDEPTH 32
+
+typedef struct fileIndexBlock_s {
+	struct fileIndexBlock_s *next;
+	int used;
+} fileIndexBlock_t;
 
 static char fs_gamedir[MAX_OSPATH]; // this will be a single file name with no separators
 static cvar_t *fs_debug;
@@ -218,6 +237,80 @@ static int fs_readCount;		// total bytes read
 static int fs_loadCount;		// total files read
 static int fs_loadStack;		// total files in memory
 static int fs_packFiles = 0;	// total number of files in packs
+static cvar_t *fs_indexDirs;
+static fileIndexEntry_t **fs_fileIndex;
+static int fs_fileIndexSize;		// hash table size (power of 2)
+static int fs_fileIndexCount;		// number of entries in the index
+static fileIndexBlock_t *fs_fileIndexBlocks;
+static searchpath_t **fs_unindexedDirs;	// directories not in the index, in search order
+static int fs_numUnindexedDirs;
+// files mapped by FS_MapFile
+#define MAX_MAPPED_FILES 16
+#define MAPPEDFILE_MINSIZE 0x10000
+
+typedef struct {
+	void *data;
+	long offset;
+	long length;
+} mappedFile_t;
+
+static mappedFile_t fs_mappedFiles[MAX_MAPPED_FILES];
+// files that worker threads read and inflate ahead of FS_ReadFile
+#define MAX_PREFETCH_THREADS 8
+#define PREFETCH_HASH_SIZE 256
+
+typedef enum {
+	PREFETCH_QUEUED,
+	PREFETCH_RUNNING,
+	PREFETCH_DONE,
+	PREFETCH_FAILED
+} prefetchState_t;
+
+typedef struct prefetchJob_s {
+	char pakFilename[MAX_OSPATH];	// pk3 the worker reads the file from
+	unzFile handle;					// handle of the pk3, only used to match the file when it is read
+	unsigned long pos;				// file info position in zip
+	unsigned long len;				// uncompressed file size
+	prefetchState_t state;
+	byte *data;						// allocated by the worker with malloc
+	struct prefetchJob_s *next;		// next job in the queue
+	struct prefetchJob_s *hashNext;	// next job in the hash chain
+} prefetchJob_t;
+
+static cvar_t *fs_prefetch;
+static cvar_t *fs_prefetchMegs;
+static void *fs_prefetchThreads[MAX_PREFETCH_THREADS];
+static int fs_numPrefetchThreads;
+static void *fs_prefetchMutex;			// guards the queue and the job states
+static void *fs_prefetchWork;			// raised when jobs are queued
+static void *fs_prefetchDone;			// raised when a job is finished
+static qboolean fs_prefetchQuit;
+static prefetchJob_t *fs_prefetchQueue;
+static prefetchJob_t *fs_prefetchQueueTail;
+static prefetchJob_t *fs_prefetchHash[PREFETCH_HASH_SIZE];	// all jobs that weren't read yet, only used by the main thread
+static long fs_prefetchBytes;
+// writes to log files are queued in a ring buffer and done by a writer thread, so a slow disk doesn't stall the frame
+typedef struct {
+	int handle;	// 0 marks the unused end of the ring
+	int length;
+} asyncWriteHeader_t;
+
+static cvar_t *fs_asyncWrite;
+static cvar_t *fs_asyncWriteKB;
+static void *fs_asyncThread;
+static void *fs_asyncMutex;		// guards the ring positions
+static void *fs_asyncWork;		// raised when data is queued
+static void *fs_asyncDone;		// raised when the writer caught up with the data it saw
+static qboolean fs_asyncQuit;
+static byte *fs_asyncBuffer;
+static int fs_asyncSize;
+static int fs_asyncHead;		// next free byte, only changed by the main thread
+static int fs_asyncTail;		// oldest byte not written yet, only changed by the writer thread
+static int fs_asyncPeak;
+static int fs_asyncWritten;
+static int fs_asyncDroppedLines;
+// largest chunk of compressed data read at once when a whole file is read from a pk3
+#define ZIPREAD_BUFFERSIZE 0x100000
 
 static int fs_checksumFeed;
 
@@ -234,6 +327,8 @@ typedef struct qfile_us {
 typedef struct {
 	qfile_ut handleFiles;
 	qboolean handleSync;
+	qboolean handleAsync;
+	int asyncDroppedLines;	// lines dropped since the last write that made it into the queue
 	int fileSize;
 	int zipFilePos;
 	int zipFileLen;
@@ -352,6 +447,378 @@ static long FS_HashFileName(const char *fname, int hashSize) {
 	return hash;
 }
 
+/*
+=======================================================================================================================================
+FS_HashIndexName
+
+Return a hash value for the full filename, ignoring case and separator char distinctions like FS_FilenameCompare.
+=======================================================================================================================================
+*/
+static unsigned int FS_HashIndexName(const char *fname) {
+	unsigned int hash;
+	int letter;
+
+	hash = 0;
+
+	for (; *fname; fname++) {
+		letter = *fname;
+
+		if (letter >= 'A' && letter <= 'Z') {
+			letter += ('a' - 'A');
+		}
+
+		if (letter == '\\' || letter == ':') {
+			letter = '/';
+		}
+
+		hash = hash * 31 + letter;
+	}
+
+	return hash ^ (hash >> 16);
+}
+
+/*
+=======================================================================================================================================
+FS_IndexAlloc
+
+Allocates memory for the file index, all of it is released at once by FS_FreeFileIndex.
+=======================================================================================================================================
+*/
+static void *FS_IndexAlloc(int size) {
+	fileIndexBlock_t *block;
+	void *ptr;
+
+	size = PAD(size, (int)sizeof(void *));
+	block = fs_fileIndexBlocks;
+
+	if (!block || block->used + size > FILEINDEX_BLOCKSIZE) {
+		block = Z_Malloc(PAD((int)sizeof(fileIndexBlock_t), (int)sizeof(void *)) + FILEINDEX_BLOCKSIZE);
+		block->next = fs_fileIndexBlocks;
+		block->used = 0;
+		fs_fileIndexBlocks = block;
+	}
+
+	ptr = (byte *)block + PAD((int)sizeof(fileIndexBlock_t), (int)sizeof(void *)) + block->used;
+	block->used += size;
+	return ptr;
+}
+
+/*
+=======================================================================================================================================
+FS_IndexInsert
+
+Inserts the entry after all entries of the same or earlier search paths in its hash chain.
+=======================================================================================================================================
+*/
+static void FS_IndexInsert(fileIndexEntry_t *entry) {
+	fileIndexEntry_t **prev;
+
+	prev = &fs_fileIndex[entry->hash & (fs_fileIndexSize - 1)];
+
+	while (*prev && (*prev)->search->order <= entry->search->order) {
+		prev = &(*prev)->next;
+	}
+
+	entry->next = *prev;
+	*prev = entry;
+}
+
+/*
+=======================================================================================================================================
+FS_GrowFileIndex
+=======================================================================================================================================
+*/
+static void FS_GrowFileIndex(void) {
+	fileIndexEntry_t **oldIndex, *entry, *next;
+	int i, oldSize;
+
+	oldIndex = fs_fileIndex;
+	oldSize = fs_fileIndexSize;
+
+	fs_fileIndexSize = oldSize ? oldSize * 2 : FILEINDEX_MINSIZE;
+	fs_fileIndex = Z_Malloc(fs_fileIndexSize * sizeof(*fs_fileIndex));
+
+	for (i = 0; i < oldSize; i++) {
+		for (entry = oldIndex[i]; entry; entry = next) {
+			next = entry->next;
+			FS_IndexInsert(entry);
+		}
+	}
+
+	if (oldIndex) {
+		Z_Free(oldIndex);
+	}
+}
+
+/*
+=======================================================================================================================================
+FS_IndexAddEntry
+=======================================================================================================================================
+*/
+static void FS_IndexAddEntry(searchpath_t *search, const char *name, qboolean copyName) {
+	fileIndexEntry_t *entry;
+
+	if (fs_fileIndexCount >= fs_fileIndexSize) {
+		FS_GrowFileIndex();
+	}
+
+	if (copyName) {
+		entry = FS_IndexAlloc(sizeof(*entry) + strlen(name) + 1);
+		entry->name = strcpy((char *)(entry + 1), name);
+	} else {
+		entry = FS_IndexAlloc(sizeof(*entry));
+		entry->name = name;
+	}
+
+	entry->search = search;
+	entry->hash = FS_HashIndexName(name);
+
+	FS_IndexInsert(entry);
+
+	fs_fileIndexCount++;
+}
+
+/*
+=======================================================================================================================================
+FS_IndexDirectory
+
+Adds all files in the directory tree to the file index. Returns qfalse if not all files could be listed.
+=======================================================================================================================================
+*/
+static qboolean FS_IndexDirectory(searchpath_t *search, const char *osPath, const char *prefix, int depth) {
+	char name[MAX_OSPATH], subPath[MAX_OSPATH];
+	char **list;
+	int i, numFiles;
+	qboolean complete;
+
+	complete = qtrue;
+	list = Sys_ListFiles(osPath, "", NULL, &numFiles, qfalse);
+
+	if (numFiles >= MAX_FOUND_FILES - 1) {
+		complete = qfalse;
+	}
+
+	for (i = 0; i < numFiles; i++) {
+		if (strlen(prefix) + strlen(list[i]) >= sizeof(name)) {
+			complete = qfalse;
+			continue;
+		}
+
+		Com_sprintf(name, sizeof(name), "%s%s", prefix, list[i]);
+		FS_IndexAddEntry(search, name, qtrue);
+	}
+
+	Sys_FreeFileList(list);
+
+	list = Sys_ListFiles(osPath, "/", NULL, &numFiles, qfalse);
+
+	if (numFiles >= MAX_FOUND_FILES - 1) {
+		complete = qfalse;
+	}
+
+	for (i = 0; i < numFiles; i++) {
+		if (!strcmp(list[i], ".") || !strcmp(list[i], "..")) {
+			continue;
+		}
+
+		if (depth >= FILEINDEX_MAXDEPTH || strlen(osPath) + strlen(list[i]) + 1 >= sizeof(subPath) || strlen(prefix) + strlen(list[i]) + 1 >= sizeof(name)) {
+			complete = qfalse;
+			continue;
+		}
+
+		Com_sprintf(subPath, sizeof(subPath), "%s%c%s", osPath, PATH_SEP, list[i]);
+		Com_sprintf(name, sizeof(name), "%s%s/", prefix, list[i]);
+
+		if (!FS_IndexDirectory(search, subPath, name, depth + 1)) {
+			complete = qfalse;
+		}
+	}
+
+	Sys_FreeFileList(list);
+	return complete;
+}
+
+/*
+=======================================================================================================================================
+FS_FreeFileIndex
+=======================================================================================================================================
+*/
+static void FS_FreeFileIndex(void) {
+	fileIndexBlock_t *block, *next;
+
+	for (block = fs_fileIndexBlocks; block; block = next) {
+		next = block->next;
+		Z_Free(block);
+	}
+
+	fs_fileIndexBlocks = NULL;
+
+	if (fs_fileIndex) {
+		Z_Free(fs_fileIndex);
+	}
+
+	fs_fileIndex = NULL;
+	fs_fileIndexSize = 0;
+	fs_fileIndexCount = 0;
+
+	if (fs_unindexedDirs) {
+		Z_Free(fs_unindexedDirs);
+	}
+
+	fs_unindexedDirs = NULL;
+	fs_numUnindexedDirs = 0;
+}
+
+/*
+=======================================================================================================================================
+FS_BuildFileIndex
+
+Builds a single index with the files of all search paths so looking up a file doesn't have to probe every pak and directory. Directory
+trees are scanned once, a directory that can't be listed completely (or when fs_indexDirs is 0) is checked on disk for every file.
+=======================================================================================================================================
+*/
+static void FS_BuildFileIndex(void) {
+	searchpath_t *search;
+	int i, order;
+
+	FS_FreeFileIndex();
+
+	for (order = 0, search = fs_searchpaths; search; search = search->next) {
+		order++;
+	}
+
+	fs_unindexedDirs = Z_Malloc((order + 1) * sizeof(*fs_unindexedDirs));
+
+	FS_GrowFileIndex();
+
+	for (order = 0, search = fs_searchpaths; search; search = search->next, order++) {
+		search->order = order;
+		search->unindexed = qfalse;
+
+		if (search->pack) {
+			for (i = 0; i < search->pack->numfiles; i++) {
+				if (search->pack->buildBuffer[i].name) {
+					FS_IndexAddEntry(search, search->pack->buildBuffer[i].name, qfalse);
+				}
+			}
+		} else if (search->dir) {
+			if (!fs_indexDirs->integer || !FS_IndexDirectory(search, search->dir->fullpath, "", 0)) {
+				search->unindexed = qtrue;
+				fs_unindexedDirs[fs_numUnindexedDirs++] = search;
+
+				if (fs_indexDirs->integer) {
+					Com_DPrintf("FS_BuildFileIndex: %s is too large to index\n", search->dir->fullpath);
+				}
+			}
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+FS_IndexAddFile
+
+Adds a file that was written outside of the directory scan to the file index.
+=======================================================================================================================================
+*/
+static void FS_IndexAddFile(const char *osPath) {
+	searchpath_t *search;
+	fileIndexEntry_t *entry;
+	const char *name;
+	unsigned int hash;
+	int len;
+
+	if (!fs_fileIndex) {
+		return;
+	}
+
+	for (search = fs_searchpaths; search; search = search->next) {
+		if (!search->dir || search->unindexed) {
+			continue;
+		}
+
+		len = strlen(search->dir->fullpath);
+
+		if (Q_stricmpn(osPath, search->dir->fullpath, len) || osPath[len] != PATH_SEP) {
+			continue;
+		}
+
+		name = osPath + len + 1;
+		hash = FS_HashIndexName(name);
+
+		for (entry = fs_fileIndex[hash & (fs_fileIndexSize - 1)]; entry; entry = entry->next) {
+			if (entry->search == search && entry->hash == hash && !FS_FilenameCompare(entry->name, name)) {
+				break;
+			}
+		}
+
+		if (!entry) {
+			FS_IndexAddEntry(search, name, qtrue);
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+FS_IndexableName
+
+Returns qfalse for names that may resolve to a different file on disk than their spelling suggests, these are looked up the slow way.
+=======================================================================================================================================
+*/
+static qboolean FS_IndexableName(const char *name) {
+	const char *s;
+
+	if (!*name) {
+		return qfalse;
+	}
+
+	for (s = name; *s; s++) {
+		if (*s != '/' && *s != '\\' && *s != '.') {
+			continue;
+		}
+		// empty path component
+		if ((*s == '/' || *s == '\\') && (s == name || s[-1] == '/' || s[-1] == '\\' || !s[1])) {
+			return qfalse;
+		}
+		// "." path component
+		if (*s == '.' && (s == name || s[-1] == '/' || s[-1] == '\\') && (!s[1] || s[1] == '/' || s[1] == '\\')) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+FS_NextIndexedSearchPath
+
+Returns the next search path that may contain the file, merging the index entries for the file with the unindexed directories.
+=======================================================================================================================================
+*/
+static searchpath_t *FS_NextIndexedSearchPath(const char *name, unsigned int hash, fileIndexEntry_t **entry, int *unindexed) {
+	fileIndexEntry_t *e;
+
+	for (e = *entry; e; e = e->next) {
+		if (e->hash == hash && !e->search->unindexed && !FS_FilenameCompare(e->name, name)) {
+			break;
+		}
+	}
+
+	if (e && (*unindexed >= fs_numUnindexedDirs || e->search->order < fs_unindexedDirs[*unindexed]->order)) {
+		*entry = e->next;
+		return e->search;
+	}
+
+	*entry = e;
+
+	if (*unindexed < fs_numUnindexedDirs) {
+		return fs_unindexedDirs[(*unindexed)++];
+	}
+
+	return NULL;
+}
+
 /*
 =======================================================================================================================================
 FS_HandleForFile
@@ -656,6 +1123,8 @@ fileHandle_t FS_SV_FOpenFileWrite(const char *filename) {
 
 	if (!fsh[f].handleFiles.file.o) {
 		f = 0;
+	} else {
+		FS_IndexAddFile(ospath);
 	}
 
 	return f;
@@ -778,7 +1247,9 @@ void FS_SV_Rename(const char *from, const char *to, qboolean safe) {
 		FS_CheckFilenameIsMutable(to_ospath, __func__);
 	}
 
-	rename(from_ospath, to_ospath);
+	if (!rename(from_ospath, to_ospath)) {
+		FS_IndexAddFile(to_ospath);
+	}
 }
 
 /*
@@ -808,60 +1279,405 @@ void FS_Rename(const char *from, const char *to) {
 
 	FS_CheckFilenameIsMutable(to_ospath, __func__);
 
-	rename(from_ospath, to_ospath);
+	if (!rename(from_ospath, to_ospath)) {
+		FS_IndexAddFile(to_ospath);
+	}
 }
 
 /*
 =======================================================================================================================================
-FS_FCloseFile
 
-If the FILE pointer is an open pak file, leave it open.
-For some reason, other dll's can't just cal fclose() on files returned by FS_FOpenFile...
+	ASYNCHRONOUS WRITES
+
 =======================================================================================================================================
 */
-void FS_FCloseFile(fileHandle_t f) {
 
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
-	}
+/*
+=======================================================================================================================================
+FS_AsyncWriteThread
+=======================================================================================================================================
+*/
+static void FS_AsyncWriteThread(void *data) {
+	asyncWriteHeader_t *header;
+	qboolean touched[MAX_FILE_HANDLES];
+	int head, tail, written, i;
+
+	Sys_LockMutex(fs_asyncMutex);
+
+	while (!fs_asyncQuit || fs_asyncTail != fs_asyncHead) {
+		if (fs_asyncTail == fs_asyncHead) {
+			Sys_UnlockMutex(fs_asyncMutex);
+			Sys_RaiseSignal(fs_asyncDone);
+			Sys_WaitSignal(fs_asyncWork);
+			Sys_LockMutex(fs_asyncMutex);
+			continue;
+		}
 
-	if (f < 1 || f >= MAX_FILE_HANDLES) {
-		return;
-	}
+		head = fs_asyncHead;
+		tail = fs_asyncTail;
 
-	if (fsh[f].zipFile == qtrue) {
-		unzCloseCurrentFile(fsh[f].handleFiles.file.z);
+		Sys_UnlockMutex(fs_asyncMutex);
+		// the main thread doesn't touch anything between tail and head, write it all before flushing once per file
+		Com_Memset(touched, 0, sizeof(touched));
 
-		if (fsh[f].handleFiles.unique) {
-			unzClose(fsh[f].handleFiles.file.z);
+		written = 0;
+
+		while (tail != head) {
+			header = (asyncWriteHeader_t *)(fs_asyncBuffer + tail);
+
+			if (!header->handle) {
+				tail = 0;
+				continue;
+			}
+
+			fwrite(header + 1, 1, header->length, fsh[header->handle].handleFiles.file.o);
+
+			touched[header->handle] = qtrue;
+			written += header->length;
+			tail += PAD(sizeof(*header) + header->length, sizeof(*header));
+
+			if (tail == fs_asyncSize) {
+				tail = 0;
+			}
 		}
 
-		Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
-		return;
-	}
-	// we didn't find it as a pak, so close it as a unique file
-	if (fsh[f].handleFiles.file.o) {
-		fclose(fsh[f].handleFiles.file.o);
+		for (i = 1; i < MAX_FILE_HANDLES; i++) {
+			if (touched[i]) {
+				fflush(fsh[i].handleFiles.file.o);
+			}
+		}
+
+		Sys_LockMutex(fs_asyncMutex);
+
+		fs_asyncTail = tail;
+		fs_asyncWritten += written;
 	}
 
-	Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
+	Sys_UnlockMutex(fs_asyncMutex);
+	Sys_RaiseSignal(fs_asyncDone);
 }
 
 /*
 =======================================================================================================================================
-FS_FOpenFileWrite
+FS_StartAsyncWrite
 =======================================================================================================================================
 */
-fileHandle_t FS_FOpenFileWrite(const char *filename) {
-	char *ospath;
-	fileHandle_t f;
+static qboolean FS_StartAsyncWrite(void) {
 
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	fs_asyncSize = PAD(fs_asyncWriteKB->integer, 1) * 1024;
+
+	if (fs_asyncSize < 16 * 1024) {
+		fs_asyncSize = 16 * 1024;
 	}
 
-	f = FS_HandleForFile();
-	fsh[f].zipFile = qfalse;
+	fs_asyncBuffer = malloc(fs_asyncSize);
+	fs_asyncMutex = Sys_CreateMutex();
+	fs_asyncWork = Sys_CreateSignal();
+	fs_asyncDone = Sys_CreateSignal();
+	fs_asyncHead = fs_asyncTail = 0;
+	fs_asyncQuit = qfalse;
+
+	if (fs_asyncBuffer && fs_asyncMutex && fs_asyncWork && fs_asyncDone) {
+		fs_asyncThread = Sys_CreateThread(FS_AsyncWriteThread, NULL);
+	}
+
+	if (!fs_asyncThread) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't start the log writer thread\n");
+
+		if (fs_asyncBuffer) {
+			free(fs_asyncBuffer);
+		}
+
+		if (fs_asyncMutex) {
+			Sys_DestroyMutex(fs_asyncMutex);
+		}
+
+		if (fs_asyncWork) {
+			Sys_DestroySignal(fs_asyncWork);
+		}
+
+		if (fs_asyncDone) {
+			Sys_DestroySignal(fs_asyncDone);
+		}
+
+		fs_asyncBuffer = NULL;
+		fs_asyncMutex = fs_asyncWork = fs_asyncDone = NULL;
+		// don't try again for every file
+		Cvar_Set("fs_asyncWrite", "0");
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+FS_StopAsyncWrite
+
+Writes everything that is still queued and stops the writer thread.
+=======================================================================================================================================
+*/
+static void FS_StopAsyncWrite(void) {
+	int i;
+
+	if (!fs_asyncThread) {
+		return;
+	}
+
+	Sys_LockMutex(fs_asyncMutex);
+	fs_asyncQuit = qtrue;
+	Sys_UnlockMutex(fs_asyncMutex);
+	Sys_RaiseSignal(fs_asyncWork);
+	Sys_JoinThread(fs_asyncThread);
+
+	free(fs_asyncBuffer);
+	Sys_DestroyMutex(fs_asyncMutex);
+	Sys_DestroySignal(fs_asyncWork);
+	Sys_DestroySignal(fs_asyncDone);
+
+	fs_asyncThread = NULL;
+	fs_asyncBuffer = NULL;
+	fs_asyncMutex = fs_asyncWork = fs_asyncDone = NULL;
+	// files that are kept open are written directly from now on
+	for (i = 1; i < MAX_FILE_HANDLES; i++) {
+		fsh[i].handleAsync = qfalse;
+	}
+}
+
+/*
+=======================================================================================================================================
+FS_AsyncWriteDrain
+
+Waits until the writer thread wrote all queued data, needed before the main thread touches a file with queued writes.
+=======================================================================================================================================
+*/
+static void FS_AsyncWriteDrain(void) {
+
+	if (!fs_asyncThread) {
+		return;
+	}
+
+	Sys_LockMutex(fs_asyncMutex);
+
+	while (fs_asyncTail != fs_asyncHead) {
+		Sys_UnlockMutex(fs_asyncMutex);
+		Sys_RaiseSignal(fs_asyncWork);
+		Sys_WaitSignal(fs_asyncDone);
+		Sys_LockMutex(fs_asyncMutex);
+	}
+
+	Sys_UnlockMutex(fs_asyncMutex);
+}
+
+/*
+=======================================================================================================================================
+FS_AsyncWriteQueue
+
+Copies a write into the ring. Returns qfalse without queueing anything if the ring is too full, one byte always stays free so a full
+ring can't be mistaken for an empty one. Called with the mutex held.
+=======================================================================================================================================
+*/
+static qboolean FS_AsyncWriteQueue(fileHandle_t h, const void *buffer, int len) {
+	asyncWriteHeader_t *header;
+	int size, offset, tail, used;
+
+	size = PAD(sizeof(*header) + len, sizeof(*header));
+	tail = fs_asyncTail;
+
+	if (fs_asyncHead >= tail) {
+		if (fs_asyncHead + size < fs_asyncSize || (fs_asyncHead + size == fs_asyncSize && tail > 0)) {
+			offset = fs_asyncHead;
+		} else if (size < tail) {
+			// doesn't fit at the end, mark it unused and start over at the beginning
+			((asyncWriteHeader_t *)(fs_asyncBuffer + fs_asyncHead))->handle = 0;
+			offset = 0;
+		} else {
+			return qfalse;
+		}
+	} else if (fs_asyncHead + size < tail) {
+		offset = fs_asyncHead;
+	} else {
+		return qfalse;
+	}
+
+	header = (asyncWriteHeader_t *)(fs_asyncBuffer + offset);
+	header->handle = h;
+	header->length = len;
+
+	Com_Memcpy(header + 1, buffer, len);
+
+	fs_asyncHead = offset + size;
+
+	if (fs_asyncHead == fs_asyncSize) {
+		fs_asyncHead = 0;
+	}
+
+	used = fs_asyncHead - tail;
+
+	if (used < 0) {
+		used += fs_asyncSize;
+	}
+
+	if (used > fs_asyncPeak) {
+		fs_asyncPeak = used;
+	}
+
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+FS_AsyncWrite
+
+Queues a write for the writer thread. When the ring is full the write is dropped, and a note with the number of dropped lines goes
+into the file once there is room again.
+=======================================================================================================================================
+*/
+static void FS_AsyncWrite(fileHandle_t h, const void *buffer, int len) {
+	char note[64];
+	const char *s;
+	int lines;
+
+	Sys_LockMutex(fs_asyncMutex);
+
+	if (fsh[h].asyncDroppedLines) {
+		Com_sprintf(note, sizeof(note), "*** %i lines dropped, the log writer fell behind ***\n", fsh[h].asyncDroppedLines);
+
+		if (FS_AsyncWriteQueue(h, note, strlen(note))) {
+			fsh[h].asyncDroppedLines = 0;
+		}
+	}
+
+	if (fsh[h].asyncDroppedLines || !FS_AsyncWriteQueue(h, buffer, len)) {
+		lines = 0;
+
+		for (s = buffer; s < (const char *)buffer + len; s++) {
+			if (*s == '\n') {
+				lines++;
+			}
+		}
+
+		if (!lines) {
+			lines = 1;
+		}
+
+		fsh[h].asyncDroppedLines += lines;
+		fs_asyncDroppedLines += lines;
+	}
+
+	Sys_UnlockMutex(fs_asyncMutex);
+	Sys_RaiseSignal(fs_asyncWork);
+}
+
+/*
+=======================================================================================================================================
+FS_SetAsyncWrite
+
+Lets the writer thread do the writes to a log file. Seeking, flushing or closing the file waits for the queued writes.
+=======================================================================================================================================
+*/
+void FS_SetAsyncWrite(fileHandle_t f) {
+
+	if (f < 1 || f >= MAX_FILE_HANDLES || fsh[f].zipFile || !fsh[f].handleFiles.file.o) {
+		return;
+	}
+
+	if (!fs_asyncWrite->integer) {
+		return;
+	}
+
+	if (!fs_asyncThread && !FS_StartAsyncWrite()) {
+		return;
+	}
+
+	fsh[f].handleAsync = qtrue;
+}
+
+/*
+=======================================================================================================================================
+FS_AsyncWriteInfo_f
+=======================================================================================================================================
+*/
+static void FS_AsyncWriteInfo_f(void) {
+	int used, peak, written, dropped;
+
+	if (!fs_asyncThread) {
+		Com_Printf("The log writer thread isn't running.\n");
+		return;
+	}
+
+	Sys_LockMutex(fs_asyncMutex);
+
+	used = fs_asyncHead - fs_asyncTail;
+
+	if (used < 0) {
+		used += fs_asyncSize;
+	}
+
+	peak = fs_asyncPeak;
+	written = fs_asyncWritten;
+	dropped = fs_asyncDroppedLines;
+
+	Sys_UnlockMutex(fs_asyncMutex);
+	// printing goes through the queue too
+	Com_Printf("%i KB ring, %i bytes queued, %i bytes peak, %i bytes written, %i lines dropped\n", fs_asyncSize / 1024, used, peak, written, dropped);
+}
+
+/*
+=======================================================================================================================================
+FS_FCloseFile
+
+If the FILE pointer is an open pak file, leave it open.
+For some reason, other dll's can't just cal fclose() on files returned by FS_FOpenFile...
+=======================================================================================================================================
+*/
+void FS_FCloseFile(fileHandle_t f) {
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (f < 1 || f >= MAX_FILE_HANDLES) {
+		return;
+	}
+
+	if (fsh[f].handleAsync) {
+		FS_AsyncWriteDrain();
+	}
+
+	if (fsh[f].zipFile == qtrue) {
+		unzCloseCurrentFile(fsh[f].handleFiles.file.z);
+
+		if (fsh[f].handleFiles.unique) {
+			unzClose(fsh[f].handleFiles.file.z);
+		}
+
+		Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
+		return;
+	}
+	// we didn't find it as a pak, so close it as a unique file
+	if (fsh[f].handleFiles.file.o) {
+		fclose(fsh[f].handleFiles.file.o);
+	}
+
+	Com_Memset(&fsh[f], 0, sizeof(fsh[f]));
+}
+
+/*
+=======================================================================================================================================
+FS_FOpenFileWrite
+=======================================================================================================================================
+*/
+fileHandle_t FS_FOpenFileWrite(const char *filename) {
+	char *ospath;
+	fileHandle_t f;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	f = FS_HandleForFile();
+	fsh[f].zipFile = qfalse;
 	ospath = FS_BuildOSPath(fs_homepath->string, fs_gamedir, filename);
 
 	if (fs_debug->integer) {
@@ -883,6 +1699,8 @@ fileHandle_t FS_FOpenFileWrite(const char *filename) {
 
 	if (!fsh[f].handleFiles.file.o) {
 		f = 0;
+	} else {
+		FS_IndexAddFile(ospath);
 	}
 
 	return f;
@@ -925,6 +1743,8 @@ fileHandle_t FS_FOpenFileAppend(const char *filename) {
 
 	if (!fsh[f].handleFiles.file.o) {
 		f = 0;
+	} else {
+		FS_IndexAddFile(ospath);
 	}
 
 	return f;
@@ -964,6 +1784,8 @@ fileHandle_t FS_FCreateOpenPipeFile(const char *filename) {
 	if (fifo) {
 		fsh[f].handleFiles.file.o = fifo;
 		fsh[f].handleSync = qfalse;
+
+		FS_IndexAddFile(ospath);
 	} else {
 		Com_Printf(S_COLOR_YELLOW "WARNING: Could not create new com_pipefile at %s. com_pipefile will not be used.\n", ospath);
 		f = 0;
@@ -1257,6 +2079,40 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 	return -1;
 }
 
+/*
+=======================================================================================================================================
+FS_FOpenFileReadUnlisted
+
+Checks the indexed directories on disk for a file the index doesn't list, so files added while the game runs (copied in by hand or
+written by a tool) are still found. A file that is found is added to the index.
+=======================================================================================================================================
+*/
+static long FS_FOpenFileReadUnlisted(const char *filename, const char *name, fileHandle_t *file, qboolean uniqueFILE) {
+	searchpath_t *search;
+	long len;
+
+	for (search = fs_searchpaths; search; search = search->next) {
+		// pk3 contents don't change and unindexed directories were already checked
+		if (!search->dir || search->unindexed) {
+			continue;
+		}
+
+		len = FS_FOpenFileReadDir(filename, search, file, uniqueFILE, qfalse);
+
+		if (file == NULL ? len > 0 : len >= 0 && *file) {
+			FS_IndexAddEntry(search, name, qtrue);
+			return len;
+		}
+	}
+
+	if (file) {
+		*file = 0;
+		return -1;
+	}
+
+	return 0;
+}
+
 /*
 =======================================================================================================================================
 FS_FOpenFileRead
@@ -1267,16 +2123,40 @@ Used for streaming data out of either a separate file or a ZIP file.
 */
 long FS_FOpenFileRead(const char *filename, fileHandle_t *file, qboolean uniqueFILE) {
 	searchpath_t *search;
+	fileIndexEntry_t *entry;
+	const char *name;
+	unsigned int hash;
+	int unindexed;
 	long len;
-	qboolean isLocalConfig;
+	qboolean isLocalConfig, useIndex;
 
 	if (!fs_searchpaths) {
 		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
 	}
 
 	isLocalConfig = !strcmp(filename, "autoexec.cfg") || !strcmp(filename, QWCONFIG_CFG);
+	// only visit the search paths the file index lists for this file
+	name = filename;
 
-	for (search = fs_searchpaths; search; search = search->next) {
+	if (name[0] == '/' || name[0] == '\\') {
+		name++;
+	}
+
+	useIndex = fs_fileIndex && FS_IndexableName(name);
+
+	if (useIndex) {
+		hash = FS_HashIndexName(name);
+		entry = fs_fileIndex[hash & (fs_fileIndexSize - 1)];
+		unindexed = 0;
+		search = FS_NextIndexedSearchPath(name, hash, &entry, &unindexed);
+	} else {
+		hash = 0;
+		entry = NULL;
+		unindexed = 0;
+		search = fs_searchpaths;
+	}
+
+	for (; search; search = useIndex ? FS_NextIndexedSearchPath(name, hash, &entry, &unindexed) : search->next) {
 		// autoexec.cfg and config.cfg can only be loaded outside of pk3 files
 		if (isLocalConfig && search->pack) {
 			continue;
@@ -1294,6 +2174,14 @@ long FS_FOpenFileRead(const char *filename, fileHandle_t *file, qboolean uniqueF
 			}
 		}
 	}
+	// the index only knows the files that were in the indexed directories when it was built
+	if (useIndex) {
+		len = FS_FOpenFileReadUnlisted(filename, name, file, uniqueFILE);
+
+		if (file == NULL ? len > 0 : len >= 0 && *file) {
+			return len;
+		}
+	}
 #ifdef FS_MISSING
 	if (missingFiles) {
 		fprintf(missingFiles, "%s\n", filename);
@@ -1475,6 +2363,11 @@ int FS_Write(const void *buffer, int len, fileHandle_t h) {
 		return 0;
 	}
 
+	if (fsh[h].handleAsync) {
+		FS_AsyncWrite(h, buffer, len);
+		return len;
+	}
+
 	f = FS_FileForHandle(h);
 	buf = (byte *)buffer;
 	remaining = len;
@@ -1578,118 +2471,702 @@ int FS_Seek(fileHandle_t f, long offset, int origin) {
 			}
 		}
 
-		switch (origin) {
-			case FS_SEEK_SET:
-				if (remainder == currentPosition) {
-					return 0;
-				}
+		switch (origin) {
+			case FS_SEEK_SET:
+				if (remainder == currentPosition) {
+					return 0;
+				}
+
+				unzSetOffset(fsh[f].handleFiles.file.z, fsh[f].zipFilePos);
+				unzOpenCurrentFile(fsh[f].handleFiles.file.z);
+			// fall through
+			case FS_SEEK_END:
+			case FS_SEEK_CUR:
+				while (remainder > PK3_SEEK_BUFFER_SIZE) {
+					FS_Read(buffer, PK3_SEEK_BUFFER_SIZE, f);
+					remainder -= PK3_SEEK_BUFFER_SIZE;
+				}
+
+				FS_Read(buffer, remainder, f);
+				return 0;
+			default:
+				Com_Error(ERR_FATAL, "Bad origin in FS_Seek");
+				return -1;
+		}
+	} else {
+		FILE *file;
+
+		if (fsh[f].handleAsync) {
+			FS_AsyncWriteDrain();
+		}
+
+		file = FS_FileForHandle(f);
+
+		switch (origin) {
+			case FS_SEEK_CUR:
+				_origin = SEEK_CUR;
+				break;
+			case FS_SEEK_END:
+				_origin = SEEK_END;
+				break;
+			case FS_SEEK_SET:
+				_origin = SEEK_SET;
+				break;
+			default:
+				Com_Error(ERR_FATAL, "Bad origin in FS_Seek");
+				break;
+		}
+
+		return fseek(file, offset, _origin);
+	}
+}
+
+/*
+=======================================================================================================================================
+
+	CONVENIENCE FUNCTIONS FOR ENTIRE FILES
+
+=======================================================================================================================================
+*/
+
+/*
+=======================================================================================================================================
+FS_FileIsInPAK
+=======================================================================================================================================
+*/
+int FS_FileIsInPAK(const char *filename, int *pChecksum) {
+	searchpath_t *search;
+	pack_t *pak;
+	fileInPack_t *pakFile;
+	long hash = 0;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!filename) {
+		Com_Error(ERR_FATAL, "FS_FOpenFileRead: NULL 'filename' parameter passed");
+	}
+	// qpaths are not supposed to have a leading slash
+	if (filename[0] == '/' || filename[0] == '\\') {
+		filename++;
+	}
+	// make absolutely sure that it can't back up the path
+	// the searchpaths do guarantee that something will always be prepended, so we don't need to worry about "c:" or "//limbo"
+	if (strstr(filename, "..") || strstr(filename, "::")) {
+		return -1;
+	}
+	// search through the path, one element at a time
+	for (search = fs_searchpaths; search; search = search->next) {
+		if (search->pack) {
+			hash = FS_HashFileName(filename, search->pack->hashSize);
+		}
+		// is the element a pak file?
+		if (search->pack && search->pack->hashTable[hash]) {
+			// disregard if it doesn't match one of the allowed pure pak files
+			if (!FS_PakIsPure(search->pack)) {
+				continue;
+			}
+			// look through all the pak file elements
+			pak = search->pack;
+			pakFile = pak->hashTable[hash];
+
+			do {
+				// case and separator insensitive comparisons
+				if (!FS_FilenameCompare(pakFile->name, filename)) {
+					if (pChecksum) {
+						*pChecksum = pak->pure_checksum;
+					}
+
+					return 1;
+				}
+
+				pakFile = pakFile->next;
+			} while (pakFile != NULL);
+		}
+	}
+
+	return -1;
+}
+
+/*
+=======================================================================================================================================
+FS_PrefetchReadFile
+
+Reads and inflates the file of a prefetch job straight from the pk3, the unzip code isn't thread safe so the zip headers are parsed
+here. Runs on a worker thread and returns a buffer allocated with malloc or NULL if anything unexpected is found, the file is then
+read the normal way.
+=======================================================================================================================================
+*/
+static byte *FS_PrefetchReadFile(const prefetchJob_t *job) {
+	byte header[46];
+	byte *in, *out;
+	unsigned long crc, compressedLen, dataPos;
+	int method, flags;
+	z_stream stream;
+	FILE *f;
+
+	f = Sys_FOpen(job->pakFilename, "rb");
+
+	if (!f) {
+		return NULL;
+	}
+
+	in = out = NULL;
+	// central directory file header
+	if (fseek(f, job->pos, SEEK_SET) || fread(header, 1, 46, f) != 46 || header[0] != 'P' || header[1] != 'K' || header[2] != 1 || header[3] != 2) {
+		goto fail;
+	}
+
+	flags = header[8]|(header[9] << 8);
+	method = header[10]|(header[11] << 8);
+	crc = header[16]|(header[17] << 8)|(header[18] << 16)|((unsigned long)header[19] << 24);
+	compressedLen = header[20]|(header[21] << 8)|(header[22] << 16)|((unsigned long)header[23] << 24);
+	dataPos = header[42]|(header[43] << 8)|(header[44] << 16)|((unsigned long)header[45] << 24);
+	// encrypted files are left to unzip
+	if ((flags & 1) || (method != 0 && method != Z_DEFLATED) || (header[24]|(header[25] << 8)|(header[26] << 16)|((unsigned long)header[27] << 24)) != job->len) {
+		goto fail;
+	}
+
+	if (method == 0 && compressedLen != job->len) {
+		goto fail;
+	}
+	// local file header
+	if (fseek(f, dataPos, SEEK_SET) || fread(header, 1, 30, f) != 30 || header[0] != 'P' || header[1] != 'K' || header[2] != 3 || header[3] != 4) {
+		goto fail;
+	}
+
+	dataPos += 30 + (header[26]|(header[27] << 8)) + (header[28]|(header[29] << 8));
+	in = malloc(compressedLen + 1);
+
+	if (!in || fseek(f, dataPos, SEEK_SET) || fread(in, 1, compressedLen, f) != compressedLen) {
+		goto fail;
+	}
+
+	if (method == 0) {
+		out = in;
+		in = NULL;
+	} else {
+		out = malloc(job->len + 1);
+
+		if (!out) {
+			goto fail;
+		}
+
+		Com_Memset(&stream, 0, sizeof(stream));
+		// the default allocator of zlib is malloc, unlike unzip it doesn't touch the zone
+		if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+			goto fail;
+		}
+
+		stream.next_in = in;
+		stream.avail_in = compressedLen;
+		stream.next_out = out;
+		stream.avail_out = job->len;
+
+		if (inflate(&stream, Z_FINISH) != Z_STREAM_END || stream.total_out != job->len) {
+			inflateEnd(&stream);
+			goto fail;
+		}
+
+		inflateEnd(&stream);
+	}
+
+	if (Com_Crc32(0, out, job->len) != crc) {
+		goto fail;
+	}
+
+	free(in);
+	fclose(f);
+	return out;
+fail:
+	free(in);
+	free(out);
+	fclose(f);
+	return NULL;
+}
+
+/*
+=======================================================================================================================================
+FS_PrefetchThread
+=======================================================================================================================================
+*/
+static void FS_PrefetchThread(void *data) {
+	prefetchJob_t *job;
+	byte *buf;
+
+	Sys_LockMutex(fs_prefetchMutex);
+
+	while (!fs_prefetchQuit) {
+		job = fs_prefetchQueue;
+
+		if (!job) {
+			Sys_UnlockMutex(fs_prefetchMutex);
+			Sys_WaitSignal(fs_prefetchWork);
+			Sys_LockMutex(fs_prefetchMutex);
+			continue;
+		}
+
+		fs_prefetchQueue = job->next;
+
+		if (fs_prefetchQueue) {
+			// the signal only releases one worker, pass it on for the rest of the queue
+			Sys_RaiseSignal(fs_prefetchWork);
+		} else {
+			fs_prefetchQueueTail = NULL;
+		}
+
+		job->state = PREFETCH_RUNNING;
+
+		Sys_UnlockMutex(fs_prefetchMutex);
+		buf = FS_PrefetchReadFile(job);
+		Sys_LockMutex(fs_prefetchMutex);
+
+		job->data = buf;
+		job->state = buf ? PREFETCH_DONE : PREFETCH_FAILED;
+
+		Sys_RaiseSignal(fs_prefetchDone);
+	}
+
+	Sys_UnlockMutex(fs_prefetchMutex);
+	// wake the next worker so it sees the quit too
+	Sys_RaiseSignal(fs_prefetchWork);
+}
+
+/*
+=======================================================================================================================================
+FS_StartPrefetch
+
+Starts one worker thread per core that isn't running the main thread.
+=======================================================================================================================================
+*/
+static qboolean FS_StartPrefetch(void) {
+	int i, numThreads;
+
+	numThreads = Sys_ProcessorCount() - 1;
+
+	if (numThreads < 1) {
+		numThreads = 1;
+	} else if (numThreads > MAX_PREFETCH_THREADS) {
+		numThreads = MAX_PREFETCH_THREADS;
+	}
+
+	fs_prefetchMutex = Sys_CreateMutex();
+	fs_prefetchWork = Sys_CreateSignal();
+	fs_prefetchDone = Sys_CreateSignal();
+	fs_prefetchQuit = qfalse;
+
+	if (fs_prefetchMutex && fs_prefetchWork && fs_prefetchDone) {
+		for (i = 0; i < numThreads; i++) {
+			fs_prefetchThreads[i] = Sys_CreateThread(FS_PrefetchThread, NULL);
+
+			if (!fs_prefetchThreads[i]) {
+				break;
+			}
+
+			fs_numPrefetchThreads++;
+		}
+	}
+
+	if (!fs_numPrefetchThreads) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't start the prefetch threads\n");
+
+		if (fs_prefetchMutex) {
+			Sys_DestroyMutex(fs_prefetchMutex);
+		}
+
+		if (fs_prefetchWork) {
+			Sys_DestroySignal(fs_prefetchWork);
+		}
+
+		if (fs_prefetchDone) {
+			Sys_DestroySignal(fs_prefetchDone);
+		}
+
+		fs_prefetchMutex = fs_prefetchWork = fs_prefetchDone = NULL;
+		return qfalse;
+	}
+
+	Com_DPrintf("%d prefetch threads started\n", fs_numPrefetchThreads);
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+FS_FindPrefetchJob
+=======================================================================================================================================
+*/
+static prefetchJob_t **FS_FindPrefetchJob(unzFile handle, unsigned long pos) {
+	prefetchJob_t **link;
+
+	for (link = &fs_prefetchHash[pos & (PREFETCH_HASH_SIZE - 1)]; *link; link = &(*link)->hashNext) {
+		if ((*link)->handle == handle && (*link)->pos == pos) {
+			break;
+		}
+	}
+
+	return link;
+}
+
+/*
+=======================================================================================================================================
+FS_PrefetchTake
+
+Removes the job of the open file from the prefetch cache, waiting for a worker that is still reading it. Returns qtrue if the file
+was copied into buf, a NULL buf just drops the job.
+=======================================================================================================================================
+*/
+static qboolean FS_PrefetchTake(fileHandle_t f, byte *buf) {
+	prefetchJob_t **link, *job, *queued, *prev;
+	qboolean taken;
+
+	if (!fs_numPrefetchThreads || !fsh[f].zipFile || fsh[f].handleFiles.unique) {
+		return qfalse;
+	}
+
+	link = FS_FindPrefetchJob(fsh[f].handleFiles.file.z, fsh[f].zipFilePos);
+	job = *link;
+
+	if (!job) {
+		return qfalse;
+	}
+
+	*link = job->hashNext;
+
+	Sys_LockMutex(fs_prefetchMutex);
+	// no worker got to it yet, it's quicker to read it right away
+	if (job->state == PREFETCH_QUEUED) {
+		prev = NULL;
+
+		for (queued = fs_prefetchQueue; queued != job; queued = queued->next) {
+			prev = queued;
+		}
+
+		if (prev) {
+			prev->next = job->next;
+		} else {
+			fs_prefetchQueue = job->next;
+		}
+
+		if (fs_prefetchQueueTail == job) {
+			fs_prefetchQueueTail = prev;
+		}
+	}
+
+	while (job->state == PREFETCH_RUNNING) {
+		Sys_UnlockMutex(fs_prefetchMutex);
+		Sys_WaitSignal(fs_prefetchDone);
+		Sys_LockMutex(fs_prefetchMutex);
+	}
+
+	Sys_UnlockMutex(fs_prefetchMutex);
+
+	taken = qfalse;
+
+	if (job->state == PREFETCH_DONE && buf) {
+		Com_Memcpy(buf, job->data, job->len);
+		fs_readCount += job->len;
+		taken = qtrue;
+	}
+
+	fs_prefetchBytes -= job->len;
+
+	free(job->data);
+	Z_Free(job);
+	return taken;
+}
+
+/*
+=======================================================================================================================================
+FS_ClearPrefetch
+
+Drops all prefetched files that weren't read, call it when loading is done.
+=======================================================================================================================================
+*/
+void FS_ClearPrefetch(void) {
+	prefetchJob_t *job, *next;
+	int i, dropped;
+
+	if (!fs_numPrefetchThreads) {
+		return;
+	}
+
+	Sys_LockMutex(fs_prefetchMutex);
+	// the queued jobs are freed with the others below
+	fs_prefetchQueue = fs_prefetchQueueTail = NULL;
+
+	dropped = 0;
+
+	for (i = 0; i < PREFETCH_HASH_SIZE; i++) {
+		for (job = fs_prefetchHash[i]; job; job = next) {
+			next = job->hashNext;
+
+			while (job->state == PREFETCH_RUNNING) {
+				Sys_UnlockMutex(fs_prefetchMutex);
+				Sys_WaitSignal(fs_prefetchDone);
+				Sys_LockMutex(fs_prefetchMutex);
+			}
+
+			free(job->data);
+			Z_Free(job);
+
+			dropped++;
+		}
+
+		fs_prefetchHash[i] = NULL;
+	}
+
+	Sys_UnlockMutex(fs_prefetchMutex);
+
+	if (fs_debug->integer && dropped) {
+		Com_Printf("FS_ClearPrefetch: %d prefetched files weren't read\n", dropped);
+	}
+
+	fs_prefetchBytes = 0;
+}
+
+/*
+=======================================================================================================================================
+FS_StopPrefetch
+=======================================================================================================================================
+*/
+static void FS_StopPrefetch(void) {
+	int i;
+
+	if (!fs_numPrefetchThreads) {
+		return;
+	}
+
+	FS_ClearPrefetch();
+
+	Sys_LockMutex(fs_prefetchMutex);
+	fs_prefetchQuit = qtrue;
+	Sys_UnlockMutex(fs_prefetchMutex);
+	Sys_RaiseSignal(fs_prefetchWork);
+
+	for (i = 0; i < fs_numPrefetchThreads; i++) {
+		Sys_JoinThread(fs_prefetchThreads[i]);
+		fs_prefetchThreads[i] = NULL;
+	}
+
+	fs_numPrefetchThreads = 0;
+
+	Sys_DestroyMutex(fs_prefetchMutex);
+	Sys_DestroySignal(fs_prefetchWork);
+	Sys_DestroySignal(fs_prefetchDone);
+
+	fs_prefetchMutex = fs_prefetchWork = fs_prefetchDone = NULL;
+}
+
+/*
+=======================================================================================================================================
+FS_PrefetchFindFile
+
+Finds the pk3 entry FS_FOpenFileRead would open for the file, without marking the pk3 as referenced. Returns qfalse if the file isn't
+there or comes from a directory.
+=======================================================================================================================================
+*/
+static qboolean FS_PrefetchFindFile(const char *filename, pack_t **pak, fileInPack_t **pakFile) {
+	searchpath_t *search;
+	fileIndexEntry_t *entry;
+	fileInPack_t *file;
+	unsigned int hash;
+	int unindexed;
+	qboolean useIndex;
+
+	useIndex = fs_fileIndex && FS_IndexableName(filename);
+
+	if (useIndex) {
+		hash = FS_HashIndexName(filename);
+		entry = fs_fileIndex[hash & (fs_fileIndexSize - 1)];
+		unindexed = 0;
+		search = FS_NextIndexedSearchPath(filename, hash, &entry, &unindexed);
+	} else {
+		hash = 0;
+		entry = NULL;
+		unindexed = 0;
+		search = fs_searchpaths;
+	}
+
+	for (; search; search = useIndex ? FS_NextIndexedSearchPath(filename, hash, &entry, &unindexed) : search->next) {
+		if (search->dir) {
+			if (FS_FOpenFileReadDir(filename, search, NULL, qfalse, qfalse) > 0) {
+				return qfalse;
+			}
+
+			continue;
+		}
+
+		if (!search->pack || !FS_PakIsPure(search->pack)) {
+			continue;
+		}
+
+		for (file = search->pack->hashTable[FS_HashFileName(filename, search->pack->hashSize)]; file; file = file->next) {
+			if (!FS_FilenameCompare(file->name, filename)) {
+				*pak = search->pack;
+				*pakFile = file;
+				return qtrue;
+			}
+		}
+	}
+
+	return qfalse;
+}
+
+/*
+=======================================================================================================================================
+FS_PrefetchFiles
+
+Hands the files a map load is going to read to the worker threads, which read and inflate them from the pk3 files while the main
+thread is busy with the files before them. FS_ReadFile then only copies the data. Files that aren't in a pk3 or don't fit in
+fs_prefetchMegs are skipped. Returns the number of files queued.
+=======================================================================================================================================
+*/
+int FS_PrefetchFiles(const char **filenames, int numFiles) {
+	prefetchJob_t **link, *job;
+	pack_t *pak;
+	fileInPack_t *pakFile;
+	const char *filename;
+	long budget;
+	int i, count;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!fs_prefetch->integer) {
+		return 0;
+	}
+
+	if (!fs_numPrefetchThreads && !FS_StartPrefetch()) {
+		return 0;
+	}
+
+	budget = fs_prefetchMegs->integer * 1024 * 1024;
+	count = 0;
+
+	for (i = 0; i < numFiles; i++) {
+		filename = filenames[i];
+
+		if (!filename || !filename[0]) {
+			continue;
+		}
+		// qpaths are not supposed to have a leading slash
+		if (filename[0] == '/' || filename[0] == '\\') {
+			filename++;
+		}
+
+		if (strstr(filename, "..") || strstr(filename, "::")) {
+			continue;
+		}
+		// config files may have to come from the journal
+		if (FS_IsExt(filename, ".cfg", strlen(filename))) {
+			continue;
+		}
+
+		if (!FS_PrefetchFindFile(filename, &pak, &pakFile)) {
+			continue;
+		}
+
+		if (!pakFile->len || fs_prefetchBytes + (long)pakFile->len > budget) {
+			continue;
+		}
+
+		link = FS_FindPrefetchJob(pak->handle, pakFile->pos);
+
+		if (*link) {
+			continue;
+		}
+
+		job = Z_Malloc(sizeof(*job));
 
-				unzSetOffset(fsh[f].handleFiles.file.z, fsh[f].zipFilePos);
-				unzOpenCurrentFile(fsh[f].handleFiles.file.z);
-			// fall through
-			case FS_SEEK_END:
-			case FS_SEEK_CUR:
-				while (remainder > PK3_SEEK_BUFFER_SIZE) {
-					FS_Read(buffer, PK3_SEEK_BUFFER_SIZE, f);
-					remainder -= PK3_SEEK_BUFFER_SIZE;
-				}
+		Q_strncpyz(job->pakFilename, pak->pakFilename, sizeof(job->pakFilename));
 
-				FS_Read(buffer, remainder, f);
-				return 0;
-			default:
-				Com_Error(ERR_FATAL, "Bad origin in FS_Seek");
-				return -1;
-		}
-	} else {
-		FILE *file;
+		job->handle = pak->handle;
+		job->pos = pakFile->pos;
+		job->len = pakFile->len;
+		job->state = PREFETCH_QUEUED;
+		*link = job;
 
-		file = FS_FileForHandle(f);
+		fs_prefetchBytes += job->len;
 
-		switch (origin) {
-			case FS_SEEK_CUR:
-				_origin = SEEK_CUR;
-				break;
-			case FS_SEEK_END:
-				_origin = SEEK_END;
-				break;
-			case FS_SEEK_SET:
-				_origin = SEEK_SET;
-				break;
-			default:
-				Com_Error(ERR_FATAL, "Bad origin in FS_Seek");
-				break;
+		Sys_LockMutex(fs_prefetchMutex);
+
+		if (fs_prefetchQueueTail) {
+			fs_prefetchQueueTail->next = job;
+		} else {
+			fs_prefetchQueue = job;
 		}
 
-		return fseek(file, offset, _origin);
-	}
-}
+		fs_prefetchQueueTail = job;
 
-/*
-=======================================================================================================================================
+		Sys_UnlockMutex(fs_prefetchMutex);
+		Sys_RaiseSignal(fs_prefetchWork);
 
-	CONVENIENCE FUNCTIONS FOR ENTIRE FILES
+		count++;
+	}
 
-=======================================================================================================================================
-*/
+	if (fs_debug->integer) {
+		Com_Printf("FS_PrefetchFiles: %d of %d files queued\n", count, numFiles);
+	}
+
+	return count;
+}
 
 /*
 =======================================================================================================================================
-FS_FileIsInPAK
+FS_ReadFileData
+
+Reads a whole file that was just opened. Files in a pk3 are inflated into the buffer in one call instead of in small blocks.
+Returns qfalse if the pk3 data is damaged, the buffer doesn't hold the file then.
 =======================================================================================================================================
 */
-int FS_FileIsInPAK(const char *filename, int *pChecksum) {
-	searchpath_t *search;
-	pack_t *pak;
-	fileInPack_t *pakFile;
-	long hash = 0;
+static qboolean FS_ReadFileData(fileHandle_t f, byte *buf, long len) {
+	unz_file_info info;
+	unsigned long scratchSize;
+	void *scratch;
+	int r;
 
-	if (!fs_searchpaths) {
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	if (FS_PrefetchTake(f, buf)) {
+		return qtrue;
 	}
 
-	if (!filename) {
-		Com_Error(ERR_FATAL, "FS_FOpenFileRead: NULL 'filename' parameter passed");
-	}
-	// qpaths are not supposed to have a leading slash
-	if (filename[0] == '/' || filename[0] == '\\') {
-		filename++;
+	if (!fsh[f].zipFile || unzGetCurrentFileInfo(fsh[f].handleFiles.file.z, &info, NULL, 0, NULL, 0, NULL, 0) != UNZ_OK) {
+		FS_Read(buf, len, f);
+		return qtrue;
 	}
-	// make absolutely sure that it can't back up the path
-	// the searchpaths do guarantee that something will always be prepended, so we don't need to worry about "c:" or "//limbo"
-	if (strstr(filename, "..") || strstr(filename, "::")) {
-		return -1;
+
+	scratch = NULL;
+	scratchSize = 0;
+
+	if (info.compression_method && info.compressed_size) {
+		scratchSize = info.compressed_size < ZIPREAD_BUFFERSIZE ? info.compressed_size : ZIPREAD_BUFFERSIZE;
+		scratch = Hunk_AllocateTempMemory(scratchSize);
 	}
-	// search through the path, one element at a time
-	for (search = fs_searchpaths; search; search = search->next) {
-		if (search->pack) {
-			hash = FS_HashFileName(filename, search->pack->hashSize);
-		}
-		// is the element a pak file?
-		if (search->pack && search->pack->hashTable[hash]) {
-			// disregard if it doesn't match one of the allowed pure pak files
-			if (!FS_PakIsPure(search->pack)) {
-				continue;
-			}
-			// look through all the pak file elements
-			pak = search->pack;
-			pakFile = pak->hashTable[hash];
 
-			do {
-				// case and separator insensitive comparisons
-				if (!FS_FilenameCompare(pakFile->name, filename)) {
-					if (pChecksum) {
-						*pChecksum = pak->pure_checksum;
-					}
+	r = unzReadCurrentFileWhole(fsh[f].handleFiles.file.z, buf, len, scratch, scratchSize);
 
-					return 1;
-				}
+	if (scratch) {
+		Hunk_FreeTempMemory(scratch);
+	}
 
-				pakFile = pakFile->next;
-			} while (pakFile != NULL);
+	if (r == UNZ_PARAMERROR) {
+		FS_Read(buf, len, f);
+		return qtrue;
+	}
+	// the inflate state is gone, the file can't be streamed from here either
+	if (r != len) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't read %s, the pk3 data is damaged (%i)\n", fsh[f].name, r);
+
+		if (r > 0) {
+			fs_readCount += r;
 		}
+
+		return qfalse;
 	}
 
-	return -1;
+	fs_readCount += r;
+	return qtrue;
 }
 
 /*
@@ -1807,9 +3284,18 @@ long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void *
 	fs_loadStack++;
 
 	buf = Hunk_AllocateTempMemory(len + 1);
-	*buffer = buf;
 
-	FS_Read(buf, len, h);
+	if (!FS_ReadFileData(h, buf, len)) {
+		Hunk_FreeTempMemory(buf);
+		FS_FCloseFile(h);
+
+		fs_loadStack--;
+
+		*buffer = NULL;
+		return -1;
+	}
+
+	*buffer = buf;
 	// guarantee that it will have a trailing 0 for string operations
 	buf[len] = 0;
 
@@ -1860,6 +3346,127 @@ void FS_FreeFile(void *buffer) {
 	}
 }
 
+/*
+=======================================================================================================================================
+FS_MapFile
+
+Like FS_ReadFile, but files that are stored uncompressed in a pk3 and are large enough are memory mapped straight from the pk3 instead
+of being copied. The mapping is copy-on-write so the caller may still modify the buffer. The buffer is not zero terminated and must be
+released with FS_FreeMappedFile.
+=======================================================================================================================================
+*/
+long FS_MapFile(const char *qpath, void **buffer) {
+	fileHandle_t h;
+	searchpath_t *search;
+	mappedFile_t *mapped;
+	unsigned long pos;
+	int i, method;
+	byte *buf;
+	long len;
+
+	if (!fs_searchpaths) {
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+	}
+
+	if (!qpath || !qpath[0]) {
+		Com_Error(ERR_FATAL, "FS_MapFile with empty name");
+	}
+
+	for (i = 0; i < MAX_MAPPED_FILES; i++) {
+		if (!fs_mappedFiles[i].data) {
+			break;
+		}
+	}
+	// config files may have to come from the journal
+	if (!buffer || i >= MAX_MAPPED_FILES || strstr(qpath, ".cfg")) {
+		return FS_ReadFile(qpath, buffer);
+	}
+
+	mapped = &fs_mappedFiles[i];
+	pos = 0;
+	len = FS_FOpenFileRead(qpath, &h, qfalse);
+
+	if (h == 0) {
+		*buffer = NULL;
+		return -1;
+	}
+
+	fs_loadCount++;
+	// only stored files can be mapped, inflating a deflated file needs a copy anyway
+	if (fsh[h].zipFile && len >= MAPPEDFILE_MINSIZE) {
+		pos = unzGetCurrentFileDataPos(fsh[h].handleFiles.file.z, &method);
+		// the data has no alignment guarantee inside the pak, the bsp lumps are read as ints and floats so they need 4 byte alignment
+		if (pos && method == 0 && !(pos & 3)) {
+			for (search = fs_searchpaths; search; search = search->next) {
+				if (search->pack && search->pack->handle == fsh[h].handleFiles.file.z) {
+					mapped->data = Sys_MapFile(search->pack->pakFilename, pos, len);
+					break;
+				}
+			}
+		}
+	}
+
+	if (mapped->data) {
+		mapped->offset = pos;
+		mapped->length = len;
+		// a prefetched copy isn't needed anymore
+		FS_PrefetchTake(h, NULL);
+
+		FS_FCloseFile(h);
+
+		if (fs_debug->integer) {
+			Com_Printf("FS_MapFile: %s (%ld bytes mapped)\n", qpath, len);
+		}
+
+		*buffer = mapped->data;
+		return len;
+	}
+
+	fs_loadStack++;
+
+	buf = Hunk_AllocateTempMemory(len + 1);
+
+	if (!FS_ReadFileData(h, buf, len)) {
+		Hunk_FreeTempMemory(buf);
+		FS_FCloseFile(h);
+
+		fs_loadStack--;
+
+		*buffer = NULL;
+		return -1;
+	}
+
+	*buffer = buf;
+	// guarantee that it will have a trailing 0 like FS_ReadFile
+	buf[len] = 0;
+
+	FS_FCloseFile(h);
+	return len;
+}
+
+/*
+=======================================================================================================================================
+FS_FreeMappedFile
+=======================================================================================================================================
+*/
+void FS_FreeMappedFile(void *buffer) {
+	int i;
+
+	if (!buffer) {
+		Com_Error(ERR_FATAL, "FS_FreeMappedFile(NULL)");
+	}
+
+	for (i = 0; i < MAX_MAPPED_FILES; i++) {
+		if (fs_mappedFiles[i].data == buffer) {
+			Sys_UnmapFile(buffer, fs_mappedFiles[i].offset, fs_mappedFiles[i].length);
+			Com_Memset(&fs_mappedFiles[i], 0, sizeof(fs_mappedFiles[i]));
+			return;
+		}
+	}
+
+	FS_FreeFile(buffer);
+}
+
 /*
 =======================================================================================================================================
 FS_WriteFile
@@ -2064,8 +3671,6 @@ qboolean FS_CompareZipChecksum(const char *zipfile) {
 =======================================================================================================================================
 */
 
-#define MAX_FOUND_FILES 0x1000
-
 /*
 =======================================================================================================================================
 FS_ReturnPath
@@ -2800,6 +4405,100 @@ void FS_Which_f(void) {
 	Com_Printf("File not found: \"%s\"\n", filename);
 }
 
+/*
+=======================================================================================================================================
+FS_PakBenchmark_f
+
+Reads every file from the pk3 files, or only from the given ones, once in one call and once in blocks like a streamed file and
+prints the speed of both. The files are read once before so both passes find them in the OS cache.
+=======================================================================================================================================
+*/
+static void FS_PakBenchmark_f(void) {
+	searchpath_t *search;
+	pack_t *pak;
+	fileHandle_t h;
+	byte *buf;
+	double totalBytes, totalWhole, totalStreamed;
+	double bytes, whole, streamed;
+	int i, j, pass, numFiles, referenced, start;
+	long len;
+
+	totalBytes = totalWhole = totalStreamed = 0;
+	numFiles = 0;
+
+	for (search = fs_searchpaths; search; search = search->next) {
+		pak = search->pack;
+
+		if (!pak) {
+			continue;
+		}
+
+		if (Cmd_Argc() > 1) {
+			for (i = 1; i < Cmd_Argc(); i++) {
+				if (!Q_stricmp(Cmd_Argv(i), pak->pakBasename)) {
+					break;
+				}
+			}
+
+			if (i == Cmd_Argc()) {
+				continue;
+			}
+		}
+		// reading the files for a benchmark doesn't make the pk3 referenced
+		referenced = pak->referenced;
+		bytes = whole = streamed = 0;
+
+		for (pass = 0; pass < 3; pass++) {
+			start = Sys_Milliseconds();
+
+			for (i = 0; i < pak->numfiles; i++) {
+				if (!pak->buildBuffer[i].len) {
+					continue;
+				}
+
+				len = FS_FOpenFileReadDir(pak->buildBuffer[i].name, search, &h, qfalse, qtrue);
+
+				if (!h) {
+					continue;
+				}
+
+				buf = Hunk_AllocateTempMemory(len + 1);
+
+				if (pass == 1) {
+					if (FS_ReadFileData(h, buf, len)) {
+						bytes += len;
+						numFiles++;
+					}
+				} else {
+					// the way FS_Read feeds a streamed file
+					for (j = 0; j < len; j += 0x4000) {
+						FS_Read(buf + j, len - j < 0x4000 ? len - j : 0x4000, h);
+					}
+				}
+
+				Hunk_FreeTempMemory(buf);
+				FS_FCloseFile(h);
+			}
+
+			if (pass == 1) {
+				whole = Sys_Milliseconds() - start;
+			} else if (pass == 2) {
+				streamed = Sys_Milliseconds() - start;
+			}
+		}
+
+		pak->referenced = referenced;
+
+		Com_Printf("%s: %.1f MB, %.1f MB/s whole, %.1f MB/s streamed\n", pak->pakFilename, bytes / (1024 * 1024), bytes * 1000 / (1024 * 1024) / (whole > 0 ? whole : 1), bytes * 1000 / (1024 * 1024) / (streamed > 0 ? streamed : 1));
+
+		totalBytes += bytes;
+		totalWhole += whole;
+		totalStreamed += streamed;
+	}
+
+	Com_Printf("%d files, %.1f MB, %.1f MB/s whole, %.1f MB/s streamed\n", numFiles, totalBytes / (1024 * 1024), totalBytes * 1000 / (1024 * 1024) / (totalWhole > 0 ? totalWhole : 1), totalBytes * 1000 / (1024 * 1024) / (totalStreamed > 0 ? totalStreamed : 1));
+}
+
 /*
 =======================================================================================================================================
 paksort
@@ -3117,6 +4816,16 @@ void FS_Shutdown(qboolean closemfp) {
 			FS_FCloseFile(i);
 		}
 	}
+	// write handles such as console.log stay open across FS_Restart and keep their queue, the writer thread only stops on quit
+	if (closemfp) {
+		FS_StopAsyncWrite();
+	} else {
+		FS_AsyncWriteDrain();
+	}
+	// the prefetch jobs point into the paks too
+	FS_StopPrefetch();
+	// the file index points into the paks
+	FS_FreeFileIndex();
 	// free everything
 	for (p = fs_searchpaths; p; p = next) {
 		next = p->next;
@@ -3139,6 +4848,7 @@ void FS_Shutdown(qboolean closemfp) {
 	Cmd_RemoveCommand("fdir");
 	Cmd_RemoveCommand("touchFile");
 	Cmd_RemoveCommand("which");
+	Cmd_RemoveCommand("pakbench");
 #ifdef FS_MISSING
 	if (closemfp) {
 		fclose(missingFiles);
@@ -3201,6 +4911,16 @@ static void FS_Startup(const char *gameName) {
 
 	fs_packFiles = 0;
 	fs_debug = Cvar_Get("fs_debug", "0", 0);
+	fs_indexDirs = Cvar_Get("fs_indexDirs", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(fs_indexDirs, "Scan game directories once at startup instead of checking the disk for every file, files added later are still found but are slower to look up the first time");
+	fs_prefetch = Cvar_Get("fs_prefetch", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(fs_prefetch, "Read and inflate the files of a map on worker threads while loading");
+	fs_prefetchMegs = Cvar_Get("fs_prefetchMegs", "64", CVAR_ARCHIVE);
+	Cvar_SetDescription(fs_prefetchMegs, "Memory in MB the prefetched files may use");
+	fs_asyncWrite = Cvar_Get("fs_asyncWrite", "1", CVAR_ARCHIVE);
+	Cvar_SetDescription(fs_asyncWrite, "Write console.log and game logs on a separate thread, logs opened with flushing after each line stay synchronous");
+	fs_asyncWriteKB = Cvar_Get("fs_asyncWriteKB", "512", CVAR_ARCHIVE|CVAR_LATCH);
+	Cvar_SetDescription(fs_asyncWriteKB, "Size in KB of the queue for log writes, lines are dropped when it is full");
 	fs_basepath = Cvar_Get("fs_basepath", Sys_DefaultInstallPath(), CVAR_INIT|CVAR_PROTECTED);
 	fs_basegame = Cvar_Get("fs_basegame", "", CVAR_INIT);
 	homePath = Sys_DefaultHomePath();
@@ -3304,9 +5024,13 @@ static void FS_Startup(const char *gameName) {
 	Cmd_AddCommand("fdir", FS_NewDir_f);
 	Cmd_AddCommand("touchFile", FS_TouchFile_f);
 	Cmd_AddCommand("which", FS_Which_f);
+	Cmd_AddCommand("pakbench", FS_PakBenchmark_f);
+	Cmd_AddCommand("asyncWriteInfo", FS_AsyncWriteInfo_f);
 	// https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=506
 	// reorder the pure pk3 files according to server order
 	FS_ReorderPurePaks();
+	// index the files of all search paths
+	FS_BuildFileIndex();
 	// print the current search paths
 	FS_Path_f();
 
@@ -3319,6 +5043,7 @@ static void FS_Startup(const char *gameName) {
 	}
 #endif
 	Com_Printf("%d files in pk3 files\n", fs_packFiles);
+	Com_Printf("%d files indexed, %d directories not indexed\n", fs_fileIndexCount, fs_numUnindexedDirs);
 }
 
 /*
@@ -3802,6 +5527,10 @@ qboolean FS_ConditionalRestart(int checksumFeed, qboolean disconnect) {
 		FS_Restart(checksumFeed);
 	} else if (fs_numServerPaks && !fs_reordered) {
 		FS_ReorderPurePaks();
+		// the file index follows the search order
+		if (fs_reordered) {
+			FS_BuildFileIndex();
+		}
 	}
 
 	return qfalse;
@@ -3877,6 +5606,10 @@ int FS_FOpenFileByMode(const char *qpath, fileHandle_t *f, fsMode_t mode) {
 	}
 
 	fsh[*f].handleSync = sync;
+	// logs that don't ask for a flush after every line are written by the writer thread
+	if (*f && mode == FS_APPEND) {
+		FS_SetAsyncWrite(*f);
+	}
 
 	return r;
 }
@@ -3900,6 +5633,10 @@ int FS_FTell(fileHandle_t f) {
 	if (fsh[f].zipFile == qtrue) {
 		pos = unztell(fsh[f].handleFiles.file.z);
 	} else {
+		if (fsh[f].handleAsync) {
+			FS_AsyncWriteDrain();
+		}
+
 		pos = ftell(fsh[f].handleFiles.file.o);
 	}
 
@@ -3912,6 +5649,11 @@ FS_Flush
 =======================================================================================================================================
 */
 void FS_Flush(fileHandle_t f) {
+
+	if (fsh[f].handleAsync) {
+		FS_AsyncWriteDrain();
+	}
+
 	fflush(fsh[f].handleFiles.file.o);
 }
 
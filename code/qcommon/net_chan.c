@@ -477,6 +477,10 @@ NET_SendPacket
 */
 void NET_SendPacket(netsrc_t sock, int length, const void *data, netadr_t to) {
 
+	// the clients of a server replay only exist in the capture
+	if (sock == NS_SERVER && SV_Replaying()) {
+		return;
+	}
 	// sequenced packets are shown in netchan, so just show oob
 	if (showpackets->integer && *(int *)data == -1) {
 		Com_Printf("send packet %4i\n", length);
@@ -867,9 +867,7 @@ struct cvar_s {
 	char *description;
 	cvar_t *next;
 	cvar_t *prev;
-	cvar_t *hashNext;
-	cvar_t *hashPrev;
-	int hashIndex;
+	unsigned int hashValue; // case folded hash of the name
 };
 
 #define MAX_CVAR_VALUE_STRING 256
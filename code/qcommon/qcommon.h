@@ -500,6 +500,8 @@ long FS_FOpenFileRead(const char *qpath, fileHandle_t *file, qboolean uniqueFILE
 int FS_FileIsInPAK(const char *filename, int *pChecksum);
 // returns 1 if a file is in the PAK file, otherwise -1
 int FS_Write(const void *buffer, int len, fileHandle_t f);
+// lets a thread do the writes to a log file, see fs_asyncWrite
+void FS_SetAsyncWrite(fileHandle_t f);
 int FS_Read(void *buffer, int len, fileHandle_t f);
 // properly handles partial reads and reads from other dlls
 void FS_FCloseFile(fileHandle_t f);
@@ -515,6 +517,15 @@ void FS_ForceFlush(fileHandle_t f);
 // forces flush on files we're writing to.
 void FS_FreeFile(void *buffer);
 // frees the memory returned by FS_ReadFile
+long FS_MapFile(const char *qpath, void **buffer);
+// like FS_ReadFile, but large files stored uncompressed in a pk3 are memory mapped instead of copied
+// the buffer is NOT zero terminated and changes made to it are private to the caller
+void FS_FreeMappedFile(void *buffer);
+// releases the buffer returned by FS_MapFile
+int FS_PrefetchFiles(const char **filenames, int numFiles);
+// starts reading and inflating files from pk3 files on worker threads, so a later FS_ReadFile only copies them
+void FS_ClearPrefetch(void);
+// drops the prefetched files that weren't read
 void FS_WriteFile(const char *qpath, const void *buffer, int size);
 // writes a complete file, creating any subdirectories needed
 long FS_filelength(fileHandle_t f);
@@ -634,9 +645,11 @@ void Com_Quit_f(void) __attribute__((noreturn));
 void Com_GameRestart(int checksumFeed, qboolean disconnect);
 int Com_Milliseconds(void); // will be journaled properly
 unsigned Com_BlockChecksum(const void *buffer, int length);
+unsigned long Com_Crc32(unsigned long crc, const void *buf, size_t len);
 char *Com_MD5File(const char *filename, int length, const char *prefix, int prefix_len);
 int Com_Filter(char *filter, char *name, int casesensitive);
 int Com_FilterPath(char *filter, char *name, int casesensitive);
+unsigned int Com_HashName(const char *name);
 int Com_RealTime(qtime_t *qtime);
 qboolean Com_SafeMode(void);
 void Com_RunAndTimeServerPacket(netadr_t *evFrom, msg_t *buf);
@@ -699,7 +712,8 @@ typedef enum {
 	TAG_BOTLIB,
 	TAG_RENDERER,
 	TAG_SMALL,
-	TAG_STATIC
+	TAG_STATIC,
+	TAG_SLAB // zone blocks that hold the chunks of small allocations
 } memtag_t;
 
 /*
@@ -737,6 +751,17 @@ void Z_Free(void *ptr);
 void Z_FreeTags(int tag);
 int Z_AvailableMemory(void);
 void Z_LogHeap(void);
+// subsystems that permanent hunk allocations are charged to for hunk_stats
+typedef enum {
+	HUNK_OTHER,
+	HUNK_RENDERER,
+	HUNK_CM,
+	HUNK_BOTLIB,
+	HUNK_VM,
+	HUNK_TEMP,
+	HUNK_NUM_SUBSYSTEMS
+} hunkSubsystem_t;
+
 void Hunk_Clear(void);
 void Hunk_ClearToMark(void);
 void Hunk_SetMark(void);
@@ -745,6 +770,7 @@ void Hunk_ClearTempMemory(void);
 void *Hunk_AllocateTempMemory(int size);
 void Hunk_FreeTempMemory(void *buf);
 int Hunk_MemoryRemaining(void);
+hunkSubsystem_t Hunk_SetSubsystem(hunkSubsystem_t subsystem);
 void Hunk_Log(void);
 void Com_TouchMemory(void);
 // commandLine should not include the executable name (argv[0])
@@ -806,6 +832,7 @@ void SV_Shutdown(char *finalmsg);
 void SV_Frame(int msec);
 void SV_PacketEvent(netadr_t from, msg_t *msg);
 int SV_FrameMsec(void);
+qboolean SV_Replaying(void);
 qboolean SV_GameCommand(void);
 int SV_SendQueuedPackets(void);
 // UI interface
@@ -837,6 +864,8 @@ char *Sys_GetClipboardData(void); // note that this isn't journaled...
 void Sys_Print(const char *msg);
 // Sys_Milliseconds should only be used for profiling purposes, any game related timing information should come from event timestamps
 int Sys_Milliseconds(void);
+// high resolution counter with an arbitrary origin, for timing short intervals
+int64_t Sys_Microseconds(void);
 qboolean Sys_RandomBytes(byte *string, int len);
 // the system console is shown when a dedicated server is running
 void Sys_DisplaySystemConsole(qboolean show);
@@ -850,6 +879,19 @@ void Sys_ShowIP(void);
 FILE *Sys_FOpen(const char *ospath, const char *mode);
 qboolean Sys_Mkdir(const char *path);
 FILE *Sys_Mkfifo(const char *ospath);
+void *Sys_MapFile(const char *ospath, long offset, long length);
+void Sys_UnmapFile(void *data, long offset, long length);
+int Sys_ProcessorCount(void);
+void *Sys_CreateThread(void (*function)(void *data), void *data);
+void Sys_JoinThread(void *thread);
+void *Sys_CreateMutex(void);
+void Sys_DestroyMutex(void *mutex);
+void Sys_LockMutex(void *mutex);
+void Sys_UnlockMutex(void *mutex);
+void *Sys_CreateSignal(void);
+void Sys_DestroySignal(void *sysSignal);
+void Sys_RaiseSignal(void *sysSignal);
+void Sys_WaitSignal(void *sysSignal);
 char *Sys_Cwd(void);
 void Sys_SetDefaultInstallPath(const char *path);
 char *Sys_DefaultInstallPath(void);
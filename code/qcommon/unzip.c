@@ -1283,7 +1283,7 @@ extern int ZEXPORT unzReadCurrentFile(file, buf, len)
 				*(pfile_in_zip_read_info->stream.next_out + i) = *(pfile_in_zip_read_info->stream.next_in + i);
 			}
 
-			pfile_in_zip_read_info->crc32 = crc32(pfile_in_zip_read_info->crc32, pfile_in_zip_read_info->stream.next_out, uDoCopy);
+			pfile_in_zip_read_info->crc32 = Com_Crc32(pfile_in_zip_read_info->crc32, pfile_in_zip_read_info->stream.next_out, uDoCopy);
 			pfile_in_zip_read_info->rest_read_uncompressed -= uDoCopy;
 			pfile_in_zip_read_info->stream.avail_in -= uDoCopy;
 			pfile_in_zip_read_info->stream.avail_out -= uDoCopy;
@@ -1313,7 +1313,7 @@ extern int ZEXPORT unzReadCurrentFile(file, buf, len)
 			uTotalOutAfter = pfile_in_zip_read_info->stream.total_out;
 			uOutThis = uTotalOutAfter - uTotalOutBefore;
 
-			pfile_in_zip_read_info->crc32 = crc32(pfile_in_zip_read_info->crc32, bufBefore, (uInt)(uOutThis));
+			pfile_in_zip_read_info->crc32 = Com_Crc32(pfile_in_zip_read_info->crc32, bufBefore, (uInt)(uOutThis));
 			pfile_in_zip_read_info->rest_read_uncompressed -= uOutThis;
 
 			iRead += (uInt)(uTotalOutAfter - uTotalOutBefore);
@@ -1335,6 +1335,119 @@ extern int ZEXPORT unzReadCurrentFile(file, buf, len)
 	return err;
 }
 
+/*
+  Read the whole current file in one go, it must not have been read from yet.
+  buf must hold the uncompressed size of the file.
+  scratch is a buffer of scratchSize bytes for the compressed data, it's only used for compressed files.
+
+  return the number of byte copied
+  return UNZ_PARAMERROR if the file can't be read that way, it can still be read with unzReadCurrentFile
+  return < 0 with error code if there is an error
+*/
+extern int ZEXPORT unzReadCurrentFileWhole(file, buf, len, scratch, scratchSize)
+	unzFile file;
+	voidp buf;
+	unsigned len;
+	voidp scratch;
+	unsigned scratchSize;
+{
+	int err;
+	uInt uReadThis;
+	uLong uRead;
+	unz_s *s;
+	file_in_zip_read_info_s *pfile_in_zip_read_info;
+
+	if (file == NULL) {
+		return UNZ_PARAMERROR;
+	}
+
+	s = (unz_s *)file;
+	pfile_in_zip_read_info = s->pfile_in_zip_read;
+
+	if (pfile_in_zip_read_info == NULL || pfile_in_zip_read_info->read_buffer == NULL || pfile_in_zip_read_info->raw) {
+		return UNZ_PARAMERROR;
+	}
+
+	if (pfile_in_zip_read_info->stream.total_out != 0 || pfile_in_zip_read_info->rest_read_uncompressed > len) {
+		return UNZ_PARAMERROR;
+	}
+
+	if (pfile_in_zip_read_info->compression_method != 0 && (scratch == NULL || scratchSize == 0)) {
+		return UNZ_PARAMERROR;
+	}
+
+	if (ZSEEK(pfile_in_zip_read_info->z_filefunc, pfile_in_zip_read_info->filestream, pfile_in_zip_read_info->pos_in_zipfile + pfile_in_zip_read_info->byte_before_the_zipfile, ZLIB_FILEFUNC_SEEK_SET) != 0) {
+		return UNZ_ERRNO;
+	}
+
+	if (pfile_in_zip_read_info->compression_method == 0) {
+		// stored data goes straight into the buffer
+		uRead = pfile_in_zip_read_info->rest_read_uncompressed;
+
+		if (pfile_in_zip_read_info->rest_read_compressed < uRead) {
+			uRead = pfile_in_zip_read_info->rest_read_compressed;
+		}
+
+		if (ZREAD(pfile_in_zip_read_info->z_filefunc, pfile_in_zip_read_info->filestream, buf, uRead) != uRead) {
+			return UNZ_ERRNO;
+		}
+
+		pfile_in_zip_read_info->pos_in_zipfile += uRead;
+		pfile_in_zip_read_info->rest_read_compressed -= uRead;
+	} else {
+		// inflate into the whole output buffer, the compressed data is read in chunks of scratchSize
+		pfile_in_zip_read_info->stream.next_out = (Bytef *)buf;
+		pfile_in_zip_read_info->stream.avail_out = (uInt)pfile_in_zip_read_info->rest_read_uncompressed;
+
+		for (;;) {
+			if (pfile_in_zip_read_info->stream.avail_in == 0 && pfile_in_zip_read_info->rest_read_compressed > 0) {
+				uReadThis = scratchSize;
+
+				if (pfile_in_zip_read_info->rest_read_compressed < uReadThis) {
+					uReadThis = (uInt)pfile_in_zip_read_info->rest_read_compressed;
+				}
+
+				if (ZREAD(pfile_in_zip_read_info->z_filefunc, pfile_in_zip_read_info->filestream, scratch, uReadThis) != uReadThis) {
+					return UNZ_ERRNO;
+				}
+
+				pfile_in_zip_read_info->pos_in_zipfile += uReadThis;
+				pfile_in_zip_read_info->rest_read_compressed -= uReadThis;
+				pfile_in_zip_read_info->stream.next_in = (Bytef *)scratch;
+				pfile_in_zip_read_info->stream.avail_in = uReadThis;
+			}
+
+			err = inflate(&pfile_in_zip_read_info->stream, Z_NO_FLUSH);
+
+			if ((err >= 0) && (pfile_in_zip_read_info->stream.msg != NULL)) {
+				err = Z_DATA_ERROR;
+			}
+
+			if (err == Z_STREAM_END) {
+				break;
+			}
+
+			if (err != Z_OK) {
+				return err;
+			}
+
+			if (pfile_in_zip_read_info->stream.avail_in == 0 && pfile_in_zip_read_info->rest_read_compressed == 0) {
+				return Z_DATA_ERROR;
+			}
+		}
+
+		uRead = pfile_in_zip_read_info->stream.total_out;
+		// the read buffer of unzReadCurrentFile doesn't hold anything now
+		pfile_in_zip_read_info->stream.next_in = (Bytef *)pfile_in_zip_read_info->read_buffer;
+		pfile_in_zip_read_info->stream.avail_in = 0;
+	}
+
+	pfile_in_zip_read_info->crc32 = Com_Crc32(pfile_in_zip_read_info->crc32, buf, uRead);
+	pfile_in_zip_read_info->rest_read_uncompressed -= uRead;
+	pfile_in_zip_read_info->stream.total_out = uRead;
+	return (int)uRead;
+}
+
 /*
   Give the current position in uncompressed data
 */
@@ -1574,3 +1687,28 @@ extern int ZEXPORT unzSetOffset(file, pos)
 	s->current_file_ok = (err == UNZ_OK);
 	return err;
 }
+
+extern uLong ZEXPORT unzGetCurrentFileDataPos(file, method)
+	unzFile file;
+	int *method;
+{
+	unz_s *s;
+	file_in_zip_read_info_s *pfile_in_zip_read_info;
+
+	if (file == NULL) {
+		return 0;
+	}
+
+	s = (unz_s *)file;
+	pfile_in_zip_read_info = s->pfile_in_zip_read;
+
+	if (pfile_in_zip_read_info == NULL || s->encrypted) {
+		return 0;
+	}
+
+	if (method != NULL) {
+		*method = (int)pfile_in_zip_read_info->compression_method;
+	}
+
+	return pfile_in_zip_read_info->pos_in_zipfile + pfile_in_zip_read_info->byte_before_the_zipfile;
+}
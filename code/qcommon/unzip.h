@@ -243,6 +243,16 @@ extern "C" {
 	  return < 0 with error code if there is an error
 	    (UNZ_ERRNO for IO error, or zLib error for uncompress error)
 	*/
+	extern int ZEXPORT unzReadCurrentFileWhole OF((unzFile file, voidp buf, unsigned len, voidp scratch, unsigned scratchSize));
+	/*
+	  Read the whole current file (opened by unzOpenCurrentFile) in one go, nothing must have been read from it yet
+	  buf must hold the uncompressed size of the file
+	  scratch is a buffer of scratchSize bytes for the compressed data, it's only used for compressed files
+
+	  return the number of byte copied
+	  return UNZ_PARAMERROR if the file can't be read that way, it can still be read with unzReadCurrentFile
+	  return < 0 with error code if there is an error
+	*/
 	extern z_off_t ZEXPORT unztell OF((unzFile file));
 	/*
 	  Give the current position in uncompressed data
@@ -271,6 +281,9 @@ extern "C" {
 	extern uLong ZEXPORT unzGetOffset(unzFile file);
 	// Set the current file offset
 	extern int ZEXPORT unzSetOffset(unzFile file, uLong pos);
+	// Get the position of the data of the current opened file in the zip file, must be called before reading from the file
+	// returns 0 if no file is opened or the data is encrypted
+	extern uLong ZEXPORT unzGetCurrentFileDataPos(unzFile file, int *method);
 	#ifdef __cplusplus
 }
 #endif
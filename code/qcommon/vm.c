@@ -497,6 +497,7 @@ argument.
 =======================================================================================================================================
 */
 vm_t *VM_Restart(vm_t *vm, qboolean unpure) {
+	hunkSubsystem_t previous;
 	vmHeader_t *header;
 
 	// DLL's can't be restarted in place
@@ -515,7 +516,11 @@ vm_t *VM_Restart(vm_t *vm, qboolean unpure) {
 	// load the image
 	Com_Printf("VM_Restart()\n");
 
-	if (!(header = VM_LoadQVM(vm, qfalse, unpure))) {
+	previous = Hunk_SetSubsystem(HUNK_VM);
+	header = VM_LoadQVM(vm, qfalse, unpure);
+	Hunk_SetSubsystem(previous);
+
+	if (!header) {
 		Com_Error(ERR_DROP, "VM_Restart failed");
 		return NULL;
 	}
@@ -527,12 +532,12 @@ vm_t *VM_Restart(vm_t *vm, qboolean unpure) {
 
 /*
 =======================================================================================================================================
-VM_Create
+VM_LoadModule
 
 If image ends in .qvm it will be interpreted, otherwise it will attempt to load as a system dll.
 =======================================================================================================================================
 */
-vm_t *VM_Create(const char *module, intptr_t(*systemCalls)(intptr_t *), vmInterpret_t interpret) {
+static vm_t *VM_LoadModule(const char *module, intptr_t(*systemCalls)(intptr_t *), vmInterpret_t interpret) {
 	vm_t *vm;
 	vmHeader_t *header;
 	int i, remaining, retval;
@@ -629,6 +634,23 @@ vm_t *VM_Create(const char *module, intptr_t(*systemCalls)(intptr_t *), vmInterp
 	return vm;
 }
 
+/*
+=======================================================================================================================================
+VM_Create
+
+Charges the hunk memory of the loaded image to the VMs for hunk_stats.
+=======================================================================================================================================
+*/
+vm_t *VM_Create(const char *module, intptr_t(*systemCalls)(intptr_t *), vmInterpret_t interpret) {
+	hunkSubsystem_t previous;
+	vm_t *vm;
+
+	previous = Hunk_SetSubsystem(HUNK_VM);
+	vm = VM_LoadModule(module, systemCalls, interpret);
+	Hunk_SetSubsystem(previous);
+	return vm;
+}
+
 /*
 =======================================================================================================================================
 VM_Free
@@ -32,7 +32,7 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 #include "tr_types.h"
 
-#define	REF_API_VERSION		8
+#define	REF_API_VERSION		9
 
 //
 // these are the functions exported by the refresh module
@@ -180,6 +180,9 @@ typedef struct {
 	void	(*FS_FreeFileList)( char **filelist );
 	void	(*FS_WriteFile)( const char *qpath, const void *buffer, int size );
 	qboolean (*FS_FileExists)( const char *file );
+	// large files stored uncompressed in a pk3 are mapped instead of copied, the buffer is not zero terminated
+	long	(*FS_MapFile)( const char *name, void **buf );
+	void	(*FS_FreeMappedFile)( void *buf );
 
 	// cinematic stuff
 	void	(*CIN_UploadCinematic)(int handle);
@@ -29,6 +29,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 
 #define PERS_SCORE 0 // !!! MUST NOT CHANGE, SERVER AND GAME BOTH REFERENCE !!!
 #define MAX_ENT_CLUSTERS 16
+#define MAX_ENT_HISTORY 64 // must be a power of two, about one second at sv_fps 60
 #ifdef USE_VOIP
 #define VOIP_QUEUE_LENGTH 64
 
@@ -53,6 +54,24 @@ typedef struct svEntity_s {
 	int snapshotCounter;	// used to prevent double adding from portal views
 } svEntity_t;
 
+// where a client entity was linked, kept for tracing against earlier positions
+typedef struct {
+	int time;				// sv.time the entity got here, sv.time + 1 if a snapshot for sv.time was already built
+	qboolean linked;
+	qboolean capsule;
+	int contents;
+	int ownerNum;
+	vec3_t origin;
+	vec3_t mins, maxs;
+	vec3_t absmin, absmax;
+} svEntityHistory_t;
+
+typedef struct {
+	svEntityHistory_t entries[MAX_ENT_HISTORY];
+	int head;
+	int numEntries;
+} svEntityHistoryRing_t;
+
 typedef enum {
 	SS_DEAD,	// no map loaded
 	SS_LOADING,	// spawning level entities
@@ -82,6 +101,8 @@ typedef struct {
 	int gameClientSize;		// will be > sizeof(playerState_t) due to game private data
 	int restartTime;
 	int time;
+	int snapshotTime;		// sv.time of the last snapshot built
+	svEntityHistoryRing_t entityHistory[MAX_CLIENTS];
 } server_t;
 
 typedef struct {
@@ -292,6 +313,17 @@ int SV_SendDownloadMessages(void);
 int SV_SendQueuedMessages(void);
 // sv_ccmds.c
 void SV_Heartbeat_f(void);
+// sv_capture.c
+void SV_CaptureSpawn(const char *mapname);
+void SV_CaptureFrame(int msec);
+void SV_CapturePacket(const netadr_t *from, const msg_t *msg);
+void SV_CaptureRestart(void);
+void SV_CaptureValue(int *value);
+void SV_CaptureShutdown(void);
+int SV_ReplayMilliseconds(void);
+void SV_Capture_f(void);
+void SV_CaptureStop_f(void);
+void SV_Replay_f(void);
 // sv_snapshot.c
 void SV_AddServerCommand(client_t *client, const char *cmd);
 void SV_UpdateServerCommandsToClient(client_t *client, msg_t *msg);
@@ -346,6 +378,8 @@ void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec
 // if the starting point is in a solid, it will be allowed to move out to an open area
 void SV_TraceEntities(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule);
 // trace against entities, but not world
+void SV_TraceAtTime(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule, int time);
+// SV_Trace with the clients at the positions they had at the given sv.time, other entities are where they are now
 void SV_ClipToEntity(trace_t *trace, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int entityNum, int contentmask, int capsule);
 // clip to a specific entity
 // sv_net_chan.c
@@ -311,12 +311,17 @@ BotImport_HunkAlloc
 =======================================================================================================================================
 */
 static void *BotImport_HunkAlloc(int size) {
+	hunkSubsystem_t previous;
+	void *buf;
 
 	if (Hunk_CheckMark()) {
 		Com_Error(ERR_DROP, "SV_Bot_HunkAlloc: Alloc with marks already set");
 	}
 
-	return Hunk_Alloc(size, h_high);
+	previous = Hunk_SetSubsystem(HUNK_BOTLIB);
+	buf = Hunk_Alloc(size, h_high);
+	Hunk_SetSubsystem(previous);
+	return buf;
 }
 
 /*
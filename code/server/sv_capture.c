@@ -0,0 +1,647 @@
+/*
+=======================================================================================================================================
+Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+
+This file is part of Spearmint Source Code.
+
+Spearmint Source Code is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 3 of the License, or (at your option) any later version.
+
+Spearmint Source Code is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Spearmint Source Code.
+If not, see <http://www.gnu.org/licenses/>.
+
+In addition, Spearmint Source Code is also subject to certain additional terms. You should have received a copy of these additional
+terms immediately following the terms and conditions of the GNU General Public License. If not, please request a copy in writing from
+id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o
+ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+=======================================================================================================================================
+*/
+
+/**************************************************************************************************************************************
+ Server traffic capture and replay.
+
+ "svcapture <file>" records every packet handed to SV_PacketEvent and the msec of every SV_Frame from the next map load on, together
+ with the random values the server hands out to clients (checksum feed, server id, challenges). "svreplay <file>" loads the same map
+ and feeds the recording back through SV_PacketEvent and SV_Frame as fast as possible, then prints how long the frames took.
+**************************************************************************************************************************************/
+
+#include "server.h"
+
+#define CAPTURE_IDENT (('P' << 24) + ('C' << 16) + ('V' << 8) + 'S')
+#define CAPTURE_VERSION 1
+#define CAPTURE_EXTENSION "svcap"
+
+typedef enum {
+	CAPREC_FRAME,	// msec passed to SV_Frame
+	CAPREC_PACKET,	// a packet passed to SV_PacketEvent
+	CAPREC_VALUE,	// a random value generated by the server
+	CAPREC_RESTART	// map_restart
+} captureRecordType_t;
+
+typedef enum {
+	CAPTURE_OFF,
+	CAPTURE_ARMED,	// waiting for the next map load to start recording
+	CAPTURE_RECORDING,
+	CAPTURE_REPLAYING
+} captureMode_t;
+
+typedef struct {
+	int ident;
+	int version;
+	char mapname[MAX_QPATH];
+	int gametype;
+	int maxclients;
+	int fps;
+	int svsTime;
+} captureHeader_t;
+
+typedef struct {
+	int type;
+	int time;	// msec since the start of the capture
+	int value;	// frame msec, random value or packet length
+	netadr_t adr;
+	byte data[MAX_MSGLEN];
+} captureRecord_t;
+
+typedef struct {
+	captureMode_t mode;
+	char filename[MAX_QPATH];
+	fileHandle_t file;
+	int startTime;
+	int numFrames;
+	int numPackets;
+	// replay only
+	captureHeader_t header;
+	captureRecord_t next;
+	qboolean haveNext;
+	qboolean spawned;
+	qboolean mapChanged;
+	int time;	// capture time of the record being replayed
+	int numUnusedValues;
+	int *frameTimes;
+	int maxFrameTimes;
+} captureState_t;
+
+static captureState_t capture;
+
+static qboolean SV_ReplayReadRecord(void);
+
+/*
+=======================================================================================================================================
+
+	RECORDING
+
+=======================================================================================================================================
+*/
+
+/*
+=======================================================================================================================================
+SV_CaptureWriteInt
+=======================================================================================================================================
+*/
+static void SV_CaptureWriteInt(int value) {
+
+	value = LittleLong(value);
+
+	FS_Write(&value, sizeof(value), capture.file);
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureWriteRecord
+=======================================================================================================================================
+*/
+static void SV_CaptureWriteRecord(captureRecordType_t type, int value) {
+
+	SV_CaptureWriteInt(type);
+	SV_CaptureWriteInt(Sys_Milliseconds() - capture.startTime);
+	SV_CaptureWriteInt(value);
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureClose
+=======================================================================================================================================
+*/
+static void SV_CaptureClose(void) {
+
+	if (capture.mode == CAPTURE_RECORDING) {
+		Com_Printf("Stopped capture %s: %i frames, %i packets\n", capture.filename, capture.numFrames, capture.numPackets);
+	}
+
+	if (capture.file) {
+		FS_FCloseFile(capture.file);
+	}
+
+	if (capture.frameTimes) {
+		Z_Free(capture.frameTimes);
+	}
+
+	Com_Memset(&capture, 0, sizeof(capture));
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureBegin
+=======================================================================================================================================
+*/
+static void SV_CaptureBegin(const char *mapname) {
+	char buffer[MAX_QPATH];
+
+	capture.file = FS_FOpenFileWrite(capture.filename);
+
+	if (!capture.file) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: couldn't open capture file %s\n", capture.filename);
+		capture.mode = CAPTURE_OFF;
+		return;
+	}
+
+	capture.mode = CAPTURE_RECORDING;
+	capture.startTime = Sys_Milliseconds();
+	capture.numFrames = 0;
+	capture.numPackets = 0;
+
+	SV_CaptureWriteInt(CAPTURE_IDENT);
+	SV_CaptureWriteInt(CAPTURE_VERSION);
+
+	Com_Memset(buffer, 0, sizeof(buffer));
+	Q_strncpyz(buffer, mapname, sizeof(buffer));
+	FS_Write(buffer, sizeof(buffer), capture.file);
+
+	SV_CaptureWriteInt(sv_gametype->integer);
+	SV_CaptureWriteInt(sv_maxclients->integer);
+	SV_CaptureWriteInt(sv_fps->integer);
+	SV_CaptureWriteInt(svs.time);
+
+	Com_Printf("Capturing server traffic to %s\n", capture.filename);
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureSpawn
+
+Called by SV_SpawnServer once the client array is set up. Starts an armed capture, ends a running one.
+=======================================================================================================================================
+*/
+void SV_CaptureSpawn(const char *mapname) {
+
+	switch (capture.mode) {
+		case CAPTURE_ARMED:
+			SV_CaptureBegin(mapname);
+			break;
+		case CAPTURE_RECORDING:
+			// clients connected to the previous map can't be replayed
+			SV_CaptureClose();
+			break;
+		case CAPTURE_REPLAYING:
+			if (capture.spawned) {
+				capture.mapChanged = qtrue;
+				break;
+			}
+
+			svs.time = capture.header.svsTime;
+			capture.spawned = qtrue;
+			break;
+		default:
+			break;
+	}
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureFrame
+=======================================================================================================================================
+*/
+void SV_CaptureFrame(int msec) {
+
+	if (capture.mode != CAPTURE_RECORDING) {
+		return;
+	}
+
+	SV_CaptureWriteRecord(CAPREC_FRAME, msec);
+	capture.numFrames++;
+}
+
+/*
+=======================================================================================================================================
+SV_CapturePacket
+=======================================================================================================================================
+*/
+void SV_CapturePacket(const netadr_t *from, const msg_t *msg) {
+
+	if (capture.mode != CAPTURE_RECORDING) {
+		return;
+	}
+
+	SV_CaptureWriteRecord(CAPREC_PACKET, msg->cursize);
+	SV_CaptureWriteInt(from->type);
+	FS_Write(from->ip, sizeof(from->ip), capture.file);
+	FS_Write(from->ip6, sizeof(from->ip6), capture.file);
+	SV_CaptureWriteInt(from->port);
+	SV_CaptureWriteInt(from->scope_id);
+	FS_Write(msg->data, msg->cursize, capture.file);
+
+	capture.numPackets++;
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureRestart
+=======================================================================================================================================
+*/
+void SV_CaptureRestart(void) {
+
+	if (capture.mode != CAPTURE_RECORDING) {
+		return;
+	}
+
+	SV_CaptureWriteRecord(CAPREC_RESTART, 0);
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureValue
+
+Records a random value the server sends to clients. During replay the recorded value is restored instead, so the captured clients keep
+matching the server.
+=======================================================================================================================================
+*/
+void SV_CaptureValue(int *value) {
+
+	if (capture.mode == CAPTURE_RECORDING) {
+		SV_CaptureWriteRecord(CAPREC_VALUE, *value);
+		return;
+	}
+
+	if (capture.mode == CAPTURE_REPLAYING && capture.haveNext && capture.next.type == CAPREC_VALUE) {
+		*value = capture.next.value;
+		SV_ReplayReadRecord();
+	}
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureShutdown
+
+Called by SV_Shutdown, also cleans up after a replay that was aborted by an error.
+=======================================================================================================================================
+*/
+void SV_CaptureShutdown(void) {
+
+	if (capture.mode == CAPTURE_RECORDING || capture.mode == CAPTURE_REPLAYING) {
+		SV_CaptureClose();
+	}
+}
+
+/*
+=======================================================================================================================================
+SV_Replaying
+=======================================================================================================================================
+*/
+qboolean SV_Replaying(void) {
+	return capture.mode == CAPTURE_REPLAYING;
+}
+
+/*
+=======================================================================================================================================
+SV_ReplayMilliseconds
+
+Returns the time the record being replayed was captured at.
+=======================================================================================================================================
+*/
+int SV_ReplayMilliseconds(void) {
+	return capture.time;
+}
+
+/*
+=======================================================================================================================================
+SV_Capture_f
+=======================================================================================================================================
+*/
+void SV_Capture_f(void) {
+
+	if (Cmd_Argc() != 2) {
+		Com_Printf("Usage: svcapture <file>\n");
+		return;
+	}
+
+	if (capture.mode == CAPTURE_RECORDING || capture.mode == CAPTURE_REPLAYING) {
+		Com_Printf("%s is already in use, use svcapturestop first\n", capture.filename);
+		return;
+	}
+
+	Q_strncpyz(capture.filename, Cmd_Argv(1), sizeof(capture.filename));
+	COM_DefaultExtension(capture.filename, sizeof(capture.filename), "." CAPTURE_EXTENSION);
+
+	capture.mode = CAPTURE_ARMED;
+
+	Com_Printf("Server traffic will be captured to %s from the next map load on\n", capture.filename);
+}
+
+/*
+=======================================================================================================================================
+SV_CaptureStop_f
+=======================================================================================================================================
+*/
+void SV_CaptureStop_f(void) {
+
+	if (capture.mode == CAPTURE_REPLAYING) {
+		return;
+	}
+
+	if (capture.mode == CAPTURE_OFF) {
+		Com_Printf("Not capturing.\n");
+		return;
+	}
+
+	SV_CaptureClose();
+}
+
+/*
+=======================================================================================================================================
+
+	REPLAY
+
+=======================================================================================================================================
+*/
+
+/*
+=======================================================================================================================================
+SV_ReplayReadInt
+=======================================================================================================================================
+*/
+static qboolean SV_ReplayReadInt(int *value) {
+
+	if (FS_Read(value, sizeof(*value), capture.file) != sizeof(*value)) {
+		return qfalse;
+	}
+
+	*value = LittleLong(*value);
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+SV_ReplayReadRecord
+
+Reads the next record into capture.next. Returns qfalse at the end of the file.
+=======================================================================================================================================
+*/
+static qboolean SV_ReplayReadRecord(void) {
+	captureRecord_t *rec;
+	int type, port, scope;
+
+	rec = &capture.next;
+	capture.haveNext = qfalse;
+
+	if (!SV_ReplayReadInt(&rec->type) || !SV_ReplayReadInt(&rec->time) || !SV_ReplayReadInt(&rec->value)) {
+		return qfalse;
+	}
+
+	if (rec->type == CAPREC_PACKET) {
+		if (rec->value < 0 || rec->value > (int)sizeof(rec->data)) {
+			Com_Printf(S_COLOR_YELLOW "WARNING: bad packet length %i in %s\n", rec->value, capture.filename);
+			return qfalse;
+		}
+
+		Com_Memset(&rec->adr, 0, sizeof(rec->adr));
+
+		if (!SV_ReplayReadInt(&type) || FS_Read(rec->adr.ip, sizeof(rec->adr.ip), capture.file) != sizeof(rec->adr.ip)
+			|| FS_Read(rec->adr.ip6, sizeof(rec->adr.ip6), capture.file) != sizeof(rec->adr.ip6) || !SV_ReplayReadInt(&port)
+			|| !SV_ReplayReadInt(&scope) || FS_Read(rec->data, rec->value, capture.file) != rec->value) {
+			return qfalse;
+		}
+
+		rec->adr.type = type;
+		rec->adr.port = port;
+		rec->adr.scope_id = scope;
+	} else if (rec->type != CAPREC_FRAME && rec->type != CAPREC_VALUE && rec->type != CAPREC_RESTART) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: unknown record type %i in %s\n", rec->type, capture.filename);
+		return qfalse;
+	}
+
+	capture.haveNext = qtrue;
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+SV_ReplayOpen
+=======================================================================================================================================
+*/
+static qboolean SV_ReplayOpen(const char *filename) {
+	captureHeader_t *header;
+
+	Q_strncpyz(capture.filename, filename, sizeof(capture.filename));
+	COM_DefaultExtension(capture.filename, sizeof(capture.filename), "." CAPTURE_EXTENSION);
+
+	FS_FOpenFileRead(capture.filename, &capture.file, qtrue);
+
+	if (!capture.file) {
+		Com_Printf("Couldn't open %s\n", capture.filename);
+		return qfalse;
+	}
+
+	header = &capture.header;
+
+	if (!SV_ReplayReadInt(&header->ident) || !SV_ReplayReadInt(&header->version)) {
+		header->ident = 0;
+	}
+
+	if (header->ident != CAPTURE_IDENT || header->version != CAPTURE_VERSION) {
+		Com_Printf("%s is not a version %i server capture\n", capture.filename, CAPTURE_VERSION);
+		return qfalse;
+	}
+
+	if (FS_Read(header->mapname, sizeof(header->mapname), capture.file) != sizeof(header->mapname) || !SV_ReplayReadInt(&header->gametype)
+		|| !SV_ReplayReadInt(&header->maxclients) || !SV_ReplayReadInt(&header->fps)
+		|| !SV_ReplayReadInt(&header->svsTime)) {
+		Com_Printf("%s is truncated\n", capture.filename);
+		return qfalse;
+	}
+
+	header->mapname[sizeof(header->mapname) - 1] = '\0';
+	return qtrue;
+}
+
+/*
+=======================================================================================================================================
+SV_ReplayCompareTimes
+=======================================================================================================================================
+*/
+static int QDECL SV_ReplayCompareTimes(const void *a, const void *b) {
+	return *(const int *)a - *(const int *)b;
+}
+
+/*
+=======================================================================================================================================
+SV_ReplayAddFrameTime
+=======================================================================================================================================
+*/
+static void SV_ReplayAddFrameTime(int usec) {
+	int *times;
+
+	if (capture.numFrames == capture.maxFrameTimes) {
+		capture.maxFrameTimes = capture.maxFrameTimes ? capture.maxFrameTimes * 2 : 4096;
+		times = Z_Malloc(capture.maxFrameTimes * sizeof(*times));
+
+		if (capture.frameTimes) {
+			Com_Memcpy(times, capture.frameTimes, capture.numFrames * sizeof(*times));
+			Z_Free(capture.frameTimes);
+		}
+
+		capture.frameTimes = times;
+	}
+
+	capture.frameTimes[capture.numFrames++] = usec;
+}
+
+/*
+=======================================================================================================================================
+SV_ReplayReport
+=======================================================================================================================================
+*/
+static void SV_ReplayReport(int totalUsec) {
+	static const int bucketLimits[] = {100, 250, 500, 1000, 2000, 4000, 8000, 16000};
+	int buckets[ARRAY_LEN(bucketLimits) + 1];
+	int *times;
+	int n, i, j;
+	int64_t frameUsec;
+
+	n = capture.numFrames;
+
+	Com_Printf("%i frames, %i packets replayed in %.1f msec\n", n, capture.numPackets, totalUsec / 1000.0f);
+
+	if (!n) {
+		return;
+	}
+
+	times = capture.frameTimes;
+	frameUsec = 0;
+
+	Com_Memset(buckets, 0, sizeof(buckets));
+
+	for (i = 0; i < n; i++) {
+		frameUsec += times[i];
+
+		j = 0;
+
+		while (j < ARRAY_LEN(bucketLimits) && times[i] >= bucketLimits[j]) {
+			j++;
+		}
+
+		buckets[j]++;
+	}
+
+	qsort(times, n, sizeof(*times), SV_ReplayCompareTimes);
+
+	Com_Printf("frame msec: avg %.3f min %.3f p50 %.3f p90 %.3f p99 %.3f max %.3f\n", frameUsec / 1000.0 / n, times[0] / 1000.0f, times[n / 2] / 1000.0f,
+		times[n * 90 / 100] / 1000.0f, times[n * 99 / 100] / 1000.0f, times[n - 1] / 1000.0f);
+
+	for (j = 0; j < ARRAY_LEN(buckets); j++) {
+		if (j < ARRAY_LEN(bucketLimits)) {
+			Com_Printf("  < %6.2f msec: %7i (%5.1f%%)\n", bucketLimits[j] / 1000.0f, buckets[j], buckets[j] * 100.0f / n);
+		} else {
+			Com_Printf(" >= %6.2f msec: %7i (%5.1f%%)\n", bucketLimits[j - 1] / 1000.0f, buckets[j], buckets[j] * 100.0f / n);
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+SV_Replay_f
+
+Replays a capture as fast as possible. Outgoing server packets are dropped while the replay runs.
+=======================================================================================================================================
+*/
+void SV_Replay_f(void) {
+	static byte msgData[MAX_MSGLEN];
+	msg_t msg;
+	netadr_t from;
+	int msec;
+	int64_t start, frameStart, totalUsec;
+
+	if (Cmd_Argc() != 2) {
+		Com_Printf("Usage: svreplay <file>\n");
+		return;
+	}
+	// the replay needs a freshly started server
+	SV_Shutdown("Server replay");
+	SV_CaptureClose();
+
+	if (!SV_ReplayOpen(Cmd_Argv(1))) {
+		SV_CaptureClose();
+		return;
+	}
+
+	Com_Printf("Replaying %s on %s\n", capture.filename, capture.header.mapname);
+
+	Cvar_SetValue("g_gametype", capture.header.gametype);
+	Cvar_Get("g_gametype", "0", CVAR_SERVERINFO|CVAR_USERINFO|CVAR_LATCH);
+	Cvar_SetLatched("sv_maxclients", va("%i", capture.header.maxclients));
+	Cvar_SetValue("sv_fps", capture.header.fps);
+
+	capture.mode = CAPTURE_REPLAYING;
+	// the first records are the values generated during the map load
+	SV_ReplayReadRecord();
+	SV_SpawnServer(capture.header.mapname);
+
+	capture.numFrames = 0;
+	capture.numPackets = 0;
+
+	start = Sys_Microseconds();
+
+	while (com_sv_running->integer && !capture.mapChanged) {
+		if (!capture.haveNext && !SV_ReplayReadRecord()) {
+			break;
+		}
+		capture.time = capture.next.time;
+		// read ahead before processing a record, SV_CaptureValue picks up the values generated while it is processed
+		switch (capture.next.type) {
+			case CAPREC_PACKET:
+				from = capture.next.adr;
+				MSG_Init(&msg, msgData, sizeof(msgData));
+				Com_Memcpy(msgData, capture.next.data, capture.next.value);
+				msg.cursize = capture.next.value;
+				SV_ReplayReadRecord();
+				SV_PacketEvent(from, &msg);
+				capture.numPackets++;
+				break;
+			case CAPREC_FRAME:
+				msec = capture.next.value;
+				SV_ReplayReadRecord();
+				frameStart = Sys_Microseconds();
+				SV_Frame(msec);
+				SV_ReplayAddFrameTime(Sys_Microseconds() - frameStart);
+				break;
+			case CAPREC_RESTART:
+				SV_ReplayReadRecord();
+				Cmd_ExecuteString("map_restart 0");
+				break;
+			default:
+				// a value that wasn't asked for, the server took a different path than in the capture
+				capture.numUnusedValues++;
+				capture.haveNext = qfalse;
+				break;
+		}
+	}
+
+	totalUsec = Sys_Microseconds() - start;
+
+	if (capture.mapChanged) {
+		Com_Printf("The map changed, stopping the replay\n");
+	}
+
+	if (capture.numUnusedValues) {
+		Com_Printf(S_COLOR_YELLOW "WARNING: %i captured values were not used, the replay diverged from the capture\n", capture.numUnusedValues);
+	}
+
+	SV_ReplayReport(totalUsec);
+	SV_Shutdown("Server replay finished");
+	SV_CaptureClose();
+}
@@ -257,6 +257,9 @@ static void SV_MapRestart_f(void) {
 	// don't update restartedserverId there, otherwise we won't deal correctly with multiple map_restart
 	sv.serverId = com_frameTime;
 
+	SV_CaptureRestart();
+	SV_CaptureValue(&sv.serverId);
+
 	Cvar_Set("sv_serverid", va("%i", sv.serverId));
 	// if a map_restart occurs while a client is changing maps, we need to give them the correct time so that when they finish loading
 	// they don't violate the backwards time check in cl_cgame.c
@@ -1366,6 +1369,9 @@ void SV_AddOperatorCommands(void) {
 	Cmd_AddCommand("bandel", SV_BanDel_f);
 	Cmd_AddCommand("exceptdel", SV_ExceptDel_f);
 	Cmd_AddCommand("flushbans", SV_FlushBans_f);
+	Cmd_AddCommand("svcapture", SV_Capture_f);
+	Cmd_AddCommand("svcapturestop", SV_CaptureStop_f);
+	Cmd_AddCommand("svreplay", SV_Replay_f);
 }
 
 /*
@@ -111,6 +111,8 @@ void SV_GetChallenge(netadr_t from) {
 	}
 	// always generate a new challenge number, so the client cannot circumvent sv_maxping
 	challenge->challenge = (((unsigned int)rand() << 16) ^ (unsigned int)rand()) ^ svs.time;
+
+	SV_CaptureValue(&challenge->challenge);
 	challenge->wasrefused = qfalse;
 	challenge->time = svs.time;
 	challenge->pingTime = svs.time;
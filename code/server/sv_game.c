@@ -506,6 +506,9 @@ intptr_t SV_GameSystemCalls(intptr_t *args) {
 		case G_BOT_FREE_CLIENT:
 			SV_BotFreeClient(args[1]);
 			return 0;
+		case G_TRACE_AT_TIME:
+			SV_TraceAtTime(VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse, args[8]);
+			return 0;
 		case BOTLIB_SETUP:
 			return SV_BotLibSetup();
 		case BOTLIB_SHUTDOWN:
@@ -380,6 +380,7 @@ Change the server to a new map, taking all connected clients along with it. This
 =======================================================================================================================================
 */
 void SV_SpawnServer(char *server) {
+	hunkSubsystem_t previous;
 	int i;
 	int checksum;
 	qboolean isBot;
@@ -409,6 +410,8 @@ void SV_SpawnServer(char *server) {
 			SV_ChangeMaxClients();
 		}
 	}
+
+	SV_CaptureSpawn(server);
 	// clear pak references
 	FS_ClearPakReferences(0);
 	// allocate the snapshot entities on the hunk
@@ -437,13 +440,20 @@ void SV_SpawnServer(char *server) {
 	// get a new checksum feed and restart the file system
 	sv.checksumFeed = (((unsigned int)rand() << 16) ^ (unsigned int)rand()) ^ Com_Milliseconds();
 
+	SV_CaptureValue(&sv.checksumFeed);
+
 	FS_Restart(sv.checksumFeed);
+	previous = Hunk_SetSubsystem(HUNK_CM);
 	CM_LoadMap(va("maps/%s.bsp", server), qfalse, &checksum);
+	Hunk_SetSubsystem(previous);
 	// set serverinfo visible name
 	Cvar_Set("mapname", server);
 	Cvar_Set("sv_mapChecksum", va("%i", checksum));
 	// serverid should be different each time
 	sv.serverId = com_frameTime;
+
+	SV_CaptureValue(&sv.serverId);
+
 	sv.restartedServerId = sv.serverId; // I suppose the init here is just to be safe
 	sv.checksumFeedServerId = sv.serverId;
 
@@ -677,6 +687,8 @@ Called when each game quits, before Sys_Quit or Sys_Error.
 */
 void SV_Shutdown(char *finalmsg) {
 
+	SV_CaptureShutdown();
+
 	if (!com_sv_running || !com_sv_running->integer) {
 		return;
 	}
@@ -244,7 +244,7 @@ void SV_MasterHeartbeat(const char *message) {
 
 	netenabled = Cvar_VariableIntegerValue("net_enabled");
 	// "dedicated 1" is for lan play, "dedicated 2" is for inet public play
-	if (!com_dedicated || com_dedicated->integer != 2 || !(netenabled & (NET_ENABLEV4|NET_ENABLEV6))) {
+	if (!com_dedicated || com_dedicated->integer != 2 || !(netenabled & (NET_ENABLEV4|NET_ENABLEV6)) || SV_Replaying()) {
 		return; // only dedicated servers send heartbeats
 	}
 	// if not time yet, don't send anything
@@ -482,7 +482,8 @@ SVC_RateLimit
 qboolean SVC_RateLimit(leakyBucket_t *bucket, int burst, int period) {
 
 	if (bucket != NULL) {
-		int now = Sys_Milliseconds();
+		// a replay runs much faster than the captured clients sent their packets, use the time they arrived at
+		int now = SV_Replaying() ? SV_ReplayMilliseconds() : Sys_Milliseconds();
 		int interval = now - bucket->lastTime;
 		int expired = interval / period;
 		int expiredRemainder = interval % period;
@@ -804,6 +805,7 @@ void SV_PacketEvent(netadr_t from, msg_t *msg) {
 	client_t *cl;
 	int qport;
 
+	SV_CapturePacket(&from, msg);
 	// check for connectionless packet (0xffffffff) first
 	if (msg->cursize >= 4 && *(int *)msg->data == -1) {
 		SV_ConnectionlessPacket(from, msg);
@@ -1025,6 +1027,7 @@ void SV_Frame(int msec) {
 	int frameMsec;
 	int startTime;
 
+	SV_CaptureFrame(msec);
 	// the menu kills the server with this cvar
 	if (sv_killserver->integer) {
 		SV_Shutdown("Server was killed.");
@@ -497,6 +497,8 @@ static void SV_BuildClientSnapshot(client_t *client) {
 
 	// bump the counter used to prevent double adding
 	sv.snapshotCounter++;
+	// clients moving from here on were not in this snapshot yet
+	sv.snapshotTime = sv.time;
 	// this is the frame we are creating
 	frame = &client->frames[client->netchan.outgoingSequence & PACKET_MASK];
 	// clear everything in this snapshot
@@ -160,6 +160,92 @@ void SV_ClearWorld(void) {
 	SV_CreateworldSector(0, mins, maxs);
 }
 
+/*
+=======================================================================================================================================
+SV_RecordEntityHistory
+
+Clients keep a ring of the places they were linked at, so traces can be run against earlier positions without relinking anything.
+Every link or unlink overwrites the entry of the current frame, unless a snapshot of this frame was already sent out.
+=======================================================================================================================================
+*/
+static void SV_RecordEntityHistory(sharedEntity_t *gEnt) {
+	svEntityHistoryRing_t *ring;
+	svEntityHistory_t *entry;
+	int num, time;
+
+	num = gEnt->s.number;
+
+	if (num < 0 || num >= sv_maxclients->integer) {
+		return;
+	}
+
+	time = sv.time;
+
+	if (sv.snapshotTime == sv.time) {
+		time++;
+	}
+
+	ring = &sv.entityHistory[num];
+	entry = &ring->entries[ring->head];
+
+	if (!ring->numEntries || entry->time != time) {
+		ring->head = (ring->head + 1) & (MAX_ENT_HISTORY - 1);
+
+		if (ring->numEntries < MAX_ENT_HISTORY) {
+			ring->numEntries++;
+		}
+
+		entry = &ring->entries[ring->head];
+	}
+
+	entry->time = time;
+	entry->linked = gEnt->r.linked;
+	entry->capsule = (gEnt->r.svFlags & SVF_CAPSULE) != 0;
+	entry->contents = gEnt->r.contents;
+	entry->ownerNum = gEnt->r.ownerNum;
+
+	VectorCopy(gEnt->r.currentOrigin, entry->origin);
+	VectorCopy(gEnt->r.mins, entry->mins);
+	VectorCopy(gEnt->r.maxs, entry->maxs);
+	VectorCopy(gEnt->r.absmin, entry->absmin);
+	VectorCopy(gEnt->r.absmax, entry->absmax);
+}
+
+/*
+=======================================================================================================================================
+SV_EntityHistoryAtTime
+
+Returns where the client was linked at the given time, or NULL if it wasn't linked. Times before the start of a full ring use the
+oldest entry.
+=======================================================================================================================================
+*/
+static const svEntityHistory_t *SV_EntityHistoryAtTime(int num, int time) {
+	const svEntityHistoryRing_t *ring;
+	const svEntityHistory_t *entry;
+	int i;
+
+	ring = &sv.entityHistory[num];
+	entry = NULL;
+
+	for (i = 0; i < ring->numEntries; i++) {
+		entry = &ring->entries[(ring->head - i) & (MAX_ENT_HISTORY - 1)];
+
+		if (entry->time <= time) {
+			break;
+		}
+	}
+
+	if (!entry || (i == ring->numEntries && ring->numEntries < MAX_ENT_HISTORY)) {
+		return NULL; // wasn't around yet
+	}
+
+	if (!entry->linked) {
+		return NULL;
+	}
+
+	return entry;
+}
+
 /*
 =======================================================================================================================================
 SV_UnlinkEntity
@@ -172,6 +258,9 @@ void SV_UnlinkEntity(sharedEntity_t *gEnt) {
 
 	ent = SV_SvEntityForGentity(gEnt);
 	gEnt->r.linked = qfalse;
+
+	SV_RecordEntityHistory(gEnt);
+
 	ws = ent->worldSector;
 
 	if (!ws) {
@@ -291,6 +380,7 @@ void SV_LinkEntity(sharedEntity_t *gEnt) {
 	num_leafs = CM_BoxLeafnums(gEnt->r.absmin, gEnt->r.absmax, leafs, MAX_TOTAL_ENT_LEAFS, &lastLeaf);
 	// if none of the leafs were inside the map, the entity is outside the world and can be considered unlinked
 	if (!num_leafs) {
+		SV_RecordEntityHistory(gEnt);
 		return;
 	}
 	// set areas, even from clusters that don't fit in the entity array
@@ -351,6 +441,8 @@ void SV_LinkEntity(sharedEntity_t *gEnt) {
 	ent->nextEntityInWorldSector = node->entities;
 	node->entities = ent;
 	gEnt->r.linked = qtrue;
+
+	SV_RecordEntityHistory(gEnt);
 }
 
 /*
@@ -442,6 +534,8 @@ typedef struct {
 	int passEntityNum;
 	int contentmask;
 	int capsule;
+	qboolean rewind;			// clip against the clients at rewindTime
+	int rewindTime;
 } moveclip_t;
 
 /*
@@ -509,6 +603,11 @@ static void SV_ClipMoveToEntities(moveclip_t *clip) {
 			return;
 		}
 
+		// clients are clipped at their earlier positions by SV_ClipMoveToHistory
+		if (clip->rewind && touchlist[i] < sv_maxclients->integer) {
+			continue;
+		}
+
 		touch = SV_GentityNum(touchlist[i]);
 		// see if we should ignore this entity
 		if (clip->passEntityNum != ENTITYNUM_NONE) {
@@ -566,13 +665,91 @@ static void SV_ClipMoveToEntities(moveclip_t *clip) {
 
 /*
 =======================================================================================================================================
-SV_Trace
+SV_ClipMoveToHistory
 
-Moves the given mins/maxs volume through the world from start to end. passEntityNum and entities owned by passEntityNum are explicitly
-not checked.
+Clips against the clients where they were linked at clip->rewindTime. Only the boxes kept in the history are looked at, nothing gets
+relinked.
 =======================================================================================================================================
 */
-void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule) {
+static void SV_ClipMoveToHistory(moveclip_t *clip) {
+	const svEntityHistory_t *entry;
+	int i, passOwnerNum;
+	trace_t trace;
+	clipHandle_t clipHandle;
+
+	if (clip->passEntityNum != ENTITYNUM_NONE) {
+		passOwnerNum = (SV_GentityNum(clip->passEntityNum))->r.ownerNum;
+
+		if (passOwnerNum == ENTITYNUM_NONE) {
+			passOwnerNum = -1;
+		}
+	} else {
+		passOwnerNum = -1;
+	}
+
+	for (i = 0; i < sv_maxclients->integer; i++) {
+		if (clip->trace.allsolid) {
+			return;
+		}
+
+		entry = SV_EntityHistoryAtTime(i, clip->rewindTime);
+
+		if (!entry) {
+			continue;
+		}
+
+		if (entry->absmin[0] > clip->boxmaxs[0] || entry->absmin[1] > clip->boxmaxs[1] || entry->absmin[2] > clip->boxmaxs[2] || entry->absmax[0] < clip->boxmins[0] || entry->absmax[1] < clip->boxmins[1] || entry->absmax[2] < clip->boxmins[2]) {
+			continue;
+		}
+		// see if we should ignore this entity
+		if (clip->passEntityNum != ENTITYNUM_NONE) {
+			if (i == clip->passEntityNum) {
+				continue; // don't clip against the pass entity
+			}
+
+			if (entry->ownerNum == clip->passEntityNum) {
+				continue; // don't clip against own missiles
+			}
+
+			if (entry->ownerNum == passOwnerNum) {
+				continue; // don't clip against other missiles from our owner
+			}
+		}
+		// if it doesn't have any brushes of a type we are looking for, ignore it
+		if (!(clip->contentmask & entry->contents)) {
+			continue;
+		}
+
+		clipHandle = CM_TempBoxModel(entry->mins, entry->maxs, entry->capsule);
+
+		CM_TransformedBoxTrace(&trace, (float *)clip->start, (float *)clip->end, (float *)clip->mins, (float *)clip->maxs, clipHandle, clip->contentmask, entry->origin, vec3_origin, clip->capsule);
+
+		if (trace.allsolid) {
+			clip->trace.allsolid = qtrue;
+			clip->trace.entityNum = i;
+		} else if (trace.startsolid) {
+			clip->trace.startsolid = qtrue;
+			clip->trace.entityNum = i;
+		}
+
+		if (trace.fraction < clip->trace.fraction) {
+			qboolean oldStart;
+
+			// make sure we keep a startsolid from a previous trace
+			oldStart = clip->trace.startsolid;
+			trace.entityNum = i;
+			clip->trace = trace;
+			clip->trace.startsolid |= oldStart;
+		}
+	}
+}
+
+/*
+=======================================================================================================================================
+SV_ClipMove
+=======================================================================================================================================
+*/
+static void SV_ClipMove(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule, qboolean rewind, int rewindTime) {
 	moveclip_t clip;
 	int i;
 
@@ -605,6 +782,8 @@ void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec
 	clip.maxs = maxs;
 	clip.passEntityNum = passEntityNum;
 	clip.capsule = capsule;
+	clip.rewind = rewind;
+	clip.rewindTime = rewindTime;
 	// create the bounding box of the entire move
 	// we can limit it to the part of the move not already clipped off by the world,
 	// which can be a significant savings for line of sight and shot traces
@@ -620,9 +799,36 @@ void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec
 	// clip to other solid entities
 	SV_ClipMoveToEntities(&clip);
 
+	if (rewind) {
+		SV_ClipMoveToHistory(&clip);
+	}
+
 	*results = clip.trace;
 }
 
+/*
+=======================================================================================================================================
+SV_Trace
+
+Moves the given mins/maxs volume through the world from start to end. passEntityNum and entities owned by passEntityNum are explicitly
+not checked.
+=======================================================================================================================================
+*/
+void SV_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule) {
+	SV_ClipMove(results, start, mins, maxs, end, passEntityNum, contentmask, capsule, qfalse, 0);
+}
+
+/*
+=======================================================================================================================================
+SV_TraceAtTime
+
+SV_Trace with the clients at the positions they were linked at the given sv.time, used for lag compensated hit scans.
+=======================================================================================================================================
+*/
+void SV_TraceAtTime(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule, int time) {
+	SV_ClipMove(results, start, mins, maxs, end, passEntityNum, contentmask, capsule, qtrue, time);
+}
+
 /*
 =======================================================================================================================================
 SV_TraceEntities
@@ -39,6 +39,7 @@ ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
 #include <fcntl.h>
 #include <fenv.h>
 #include <sys/wait.h>
+#include <pthread.h>
 
 qboolean stdinIsATTY;
 // used to determine where to store user-specific files
@@ -145,6 +146,19 @@ int Sys_Milliseconds(void) {
 	return curtime;
 }
 
+/*
+=======================================================================================================================================
+Sys_Microseconds
+=======================================================================================================================================
+*/
+int64_t Sys_Microseconds(void) {
+	struct timeval tp;
+
+	gettimeofday(&tp, NULL);
+
+	return (int64_t)tp.tv_sec * 1000000 + tp.tv_usec;
+}
+
 /*
 =======================================================================================================================================
 Sys_RandomBytes
@@ -279,6 +293,260 @@ FILE *Sys_Mkfifo(const char *ospath) {
 	return fifo;
 }
 
+/*
+=======================================================================================================================================
+Sys_MapFile
+
+Maps length bytes of the file starting at offset copy-on-write into memory.
+=======================================================================================================================================
+*/
+void *Sys_MapFile(const char *ospath, long offset, long length) {
+	long pageSize, delta;
+	int fd;
+	void *base;
+
+	pageSize = sysconf(_SC_PAGESIZE);
+	delta = offset % pageSize;
+	fd = open(ospath, O_RDONLY);
+
+	if (fd == -1) {
+		return NULL;
+	}
+
+	base = mmap(NULL, length + delta, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, offset - delta);
+	// the mapping stays valid after closing the file
+	close(fd);
+
+	if (base == MAP_FAILED) {
+		return NULL;
+	}
+
+	return (byte *)base + delta;
+}
+
+/*
+=======================================================================================================================================
+Sys_UnmapFile
+=======================================================================================================================================
+*/
+void Sys_UnmapFile(void *data, long offset, long length) {
+	long delta;
+
+	delta = offset % sysconf(_SC_PAGESIZE);
+
+	munmap((byte *)data - delta, length + delta);
+}
+
+/*
+=======================================================================================================================================
+Sys_ProcessorCount
+=======================================================================================================================================
+*/
+int Sys_ProcessorCount(void) {
+	long count;
+
+	count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (count < 1) {
+		return 1;
+	}
+
+	return count;
+}
+
+typedef struct {
+	void (*function)(void *data);
+	void *data;
+	pthread_t thread;
+} sysThread_t;
+
+/*
+=======================================================================================================================================
+Sys_ThreadMain
+=======================================================================================================================================
+*/
+static void *Sys_ThreadMain(void *arg) {
+	sysThread_t *thread = arg;
+
+	thread->function(thread->data);
+	return NULL;
+}
+
+/*
+=======================================================================================================================================
+Sys_CreateThread
+
+Returns NULL if the thread couldn't be started.
+=======================================================================================================================================
+*/
+void *Sys_CreateThread(void (*function)(void *data), void *data) {
+	sysThread_t *thread;
+
+	thread = malloc(sizeof(*thread));
+
+	if (!thread) {
+		return NULL;
+	}
+
+	thread->function = function;
+	thread->data = data;
+
+	if (pthread_create(&thread->thread, NULL, Sys_ThreadMain, thread)) {
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+=======================================================================================================================================
+Sys_JoinThread
+
+Waits for the thread to return and frees it.
+=======================================================================================================================================
+*/
+void Sys_JoinThread(void *thread) {
+
+	pthread_join(((sysThread_t *)thread)->thread, NULL);
+	free(thread);
+}
+
+/*
+=======================================================================================================================================
+Sys_CreateMutex
+=======================================================================================================================================
+*/
+void *Sys_CreateMutex(void) {
+	pthread_mutex_t *mutex;
+
+	mutex = malloc(sizeof(*mutex));
+
+	if (!mutex) {
+		return NULL;
+	}
+
+	if (pthread_mutex_init(mutex, NULL)) {
+		free(mutex);
+		return NULL;
+	}
+
+	return mutex;
+}
+
+/*
+=======================================================================================================================================
+Sys_DestroyMutex
+=======================================================================================================================================
+*/
+void Sys_DestroyMutex(void *mutex) {
+
+	pthread_mutex_destroy(mutex);
+	free(mutex);
+}
+
+/*
+=======================================================================================================================================
+Sys_LockMutex
+=======================================================================================================================================
+*/
+void Sys_LockMutex(void *mutex) {
+	pthread_mutex_lock(mutex);
+}
+
+/*
+=======================================================================================================================================
+Sys_UnlockMutex
+=======================================================================================================================================
+*/
+void Sys_UnlockMutex(void *mutex) {
+	pthread_mutex_unlock(mutex);
+}
+
+typedef struct {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	qboolean raised;
+} sysSignal_t;
+
+/*
+=======================================================================================================================================
+Sys_CreateSignal
+
+A signal stays raised until one waiting thread is released by it, raising it again before that has no further effect.
+=======================================================================================================================================
+*/
+void *Sys_CreateSignal(void) {
+	sysSignal_t *sysSignal;
+
+	sysSignal = malloc(sizeof(*sysSignal));
+
+	if (!sysSignal) {
+		return NULL;
+	}
+
+	if (pthread_mutex_init(&sysSignal->mutex, NULL)) {
+		free(sysSignal);
+		return NULL;
+	}
+
+	if (pthread_cond_init(&sysSignal->cond, NULL)) {
+		pthread_mutex_destroy(&sysSignal->mutex);
+		free(sysSignal);
+		return NULL;
+	}
+
+	sysSignal->raised = qfalse;
+	return sysSignal;
+}
+
+/*
+=======================================================================================================================================
+Sys_DestroySignal
+=======================================================================================================================================
+*/
+void Sys_DestroySignal(void *sysSignal) {
+	sysSignal_t *s = sysSignal;
+
+	pthread_cond_destroy(&s->cond);
+	pthread_mutex_destroy(&s->mutex);
+	free(s);
+}
+
+/*
+=======================================================================================================================================
+Sys_RaiseSignal
+=======================================================================================================================================
+*/
+void Sys_RaiseSignal(void *sysSignal) {
+	sysSignal_t *s = sysSignal;
+
+	pthread_mutex_lock(&s->mutex);
+	s->raised = qtrue;
+	pthread_cond_signal(&s->cond);
+	pthread_mutex_unlock(&s->mutex);
+}
+
+/*
+=======================================================================================================================================
+Sys_WaitSignal
+
+Blocks until the signal is raised and lowers it again.
+=======================================================================================================================================
+*/
+void Sys_WaitSignal(void *sysSignal) {
+	sysSignal_t *s = sysSignal;
+
+	pthread_mutex_lock(&s->mutex);
+
+	while (!s->raised) {
+		pthread_cond_wait(&s->cond, &s->mutex);
+	}
+
+	s->raised = qfalse;
+	pthread_mutex_unlock(&s->mutex);
+}
+
 /*
 =======================================================================================================================================
 Sys_Cwd
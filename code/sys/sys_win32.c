@@ -224,6 +224,24 @@ int Sys_Milliseconds(void) {
 	return sys_curtime;
 }
 
+/*
+=======================================================================================================================================
+Sys_Microseconds
+=======================================================================================================================================
+*/
+int64_t Sys_Microseconds(void) {
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+
+	if (!frequency.QuadPart) {
+		QueryPerformanceFrequency(&frequency);
+	}
+
+	QueryPerformanceCounter(&counter);
+
+	return (int64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 + (counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+}
+
 /*
 =======================================================================================================================================
 Sys_RandomBytes
@@ -376,6 +394,225 @@ FILE *Sys_Mkfifo(const char *ospath) {
 	return NULL;
 }
 
+/*
+=======================================================================================================================================
+Sys_MapFile
+
+Maps length bytes of the file starting at offset copy-on-write into memory.
+=======================================================================================================================================
+*/
+void *Sys_MapFile(const char *ospath, long offset, long length) {
+	SYSTEM_INFO systemInfo;
+	HANDLE file, mapping;
+	long delta;
+	void *base;
+
+	GetSystemInfo(&systemInfo);
+
+	delta = offset % systemInfo.dwAllocationGranularity;
+	file = CreateFileA(ospath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (file == INVALID_HANDLE_VALUE) {
+		return NULL;
+	}
+
+	mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+	CloseHandle(file);
+
+	if (!mapping) {
+		return NULL;
+	}
+
+	base = MapViewOfFile(mapping, FILE_MAP_COPY, 0, offset - delta, length + delta);
+	// the view keeps the mapping alive
+	CloseHandle(mapping);
+
+	if (!base) {
+		return NULL;
+	}
+
+	return (byte *)base + delta;
+}
+
+/*
+=======================================================================================================================================
+Sys_UnmapFile
+=======================================================================================================================================
+*/
+void Sys_UnmapFile(void *data, long offset, long length) {
+	SYSTEM_INFO systemInfo;
+
+	GetSystemInfo(&systemInfo);
+	UnmapViewOfFile((byte *)data - offset % systemInfo.dwAllocationGranularity);
+}
+
+/*
+=======================================================================================================================================
+Sys_ProcessorCount
+=======================================================================================================================================
+*/
+int Sys_ProcessorCount(void) {
+	SYSTEM_INFO systemInfo;
+
+	GetSystemInfo(&systemInfo);
+
+	if (systemInfo.dwNumberOfProcessors < 1) {
+		return 1;
+	}
+
+	return systemInfo.dwNumberOfProcessors;
+}
+
+typedef struct {
+	void (*function)(void *data);
+	void *data;
+	HANDLE thread;
+} sysThread_t;
+
+/*
+=======================================================================================================================================
+Sys_ThreadMain
+=======================================================================================================================================
+*/
+static DWORD WINAPI Sys_ThreadMain(LPVOID arg) {
+	sysThread_t *thread = arg;
+
+	thread->function(thread->data);
+	return 0;
+}
+
+/*
+=======================================================================================================================================
+Sys_CreateThread
+
+Returns NULL if the thread couldn't be started.
+=======================================================================================================================================
+*/
+void *Sys_CreateThread(void (*function)(void *data), void *data) {
+	sysThread_t *thread;
+
+	thread = malloc(sizeof(*thread));
+
+	if (!thread) {
+		return NULL;
+	}
+
+	thread->function = function;
+	thread->data = data;
+	thread->thread = CreateThread(NULL, 0, Sys_ThreadMain, thread, 0, NULL);
+
+	if (!thread->thread) {
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+=======================================================================================================================================
+Sys_JoinThread
+
+Waits for the thread to return and frees it.
+=======================================================================================================================================
+*/
+void Sys_JoinThread(void *thread) {
+	sysThread_t *t = thread;
+
+	WaitForSingleObject(t->thread, INFINITE);
+	CloseHandle(t->thread);
+	free(t);
+}
+
+/*
+=======================================================================================================================================
+Sys_CreateMutex
+=======================================================================================================================================
+*/
+void *Sys_CreateMutex(void) {
+	CRITICAL_SECTION *mutex;
+
+	mutex = malloc(sizeof(*mutex));
+
+	if (!mutex) {
+		return NULL;
+	}
+
+	InitializeCriticalSection(mutex);
+	return mutex;
+}
+
+/*
+=======================================================================================================================================
+Sys_DestroyMutex
+=======================================================================================================================================
+*/
+void Sys_DestroyMutex(void *mutex) {
+
+	DeleteCriticalSection(mutex);
+	free(mutex);
+}
+
+/*
+=======================================================================================================================================
+Sys_LockMutex
+=======================================================================================================================================
+*/
+void Sys_LockMutex(void *mutex) {
+	EnterCriticalSection(mutex);
+}
+
+/*
+=======================================================================================================================================
+Sys_UnlockMutex
+=======================================================================================================================================
+*/
+void Sys_UnlockMutex(void *mutex) {
+	LeaveCriticalSection(mutex);
+}
+
+/*
+=======================================================================================================================================
+Sys_CreateSignal
+
+A signal stays raised until one waiting thread is released by it, raising it again before that has no further effect.
+=======================================================================================================================================
+*/
+void *Sys_CreateSignal(void) {
+	// an auto-reset event
+	return CreateEvent(NULL, FALSE, FALSE, NULL);
+}
+
+/*
+=======================================================================================================================================
+Sys_DestroySignal
+=======================================================================================================================================
+*/
+void Sys_DestroySignal(void *sysSignal) {
+	CloseHandle(sysSignal);
+}
+
+/*
+=======================================================================================================================================
+Sys_RaiseSignal
+=======================================================================================================================================
+*/
+void Sys_RaiseSignal(void *sysSignal) {
+	SetEvent(sysSignal);
+}
+
+/*
+=======================================================================================================================================
+Sys_WaitSignal
+
+Blocks until the signal is raised and lowers it again.
+=======================================================================================================================================
+*/
+void Sys_WaitSignal(void *sysSignal) {
+	WaitForSingleObject(sysSignal, INFINITE);
+}
+
 /*
 =======================================================================================================================================
 Sys_Cwd